@@ -180,6 +180,11 @@ EGLAPI EGLint EGLAPIENTRY eglProgramCacheResizeANGLE(EGLDisplay dpy, EGLint limi
 #define EGL_EXTENSIONS_ENABLED_ANGLE 0x345F
 #endif /* EGL_ANGLE_create_context_extensions_enabled */
 
+#ifndef EGL_ANGLE_deferred_command_stream
+#define EGL_ANGLE_deferred_command_stream 1
+#define EGL_CONTEXT_DEFERRED_COMMAND_STREAM_ANGLE 0x3AB0
+#endif /* EGL_ANGLE_deferred_command_stream */
+
 // clang-format on
 
 #endif  // INCLUDE_EGL_EGLEXT_ANGLE_
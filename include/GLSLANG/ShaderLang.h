@@ -25,7 +25,7 @@
 
 // Version number for shader translation API.
 // It is incremented every time the API changes.
-#define ANGLE_SH_VERSION 197
+#define ANGLE_SH_VERSION 200
 
 enum ShShaderSpec
 {
@@ -265,6 +265,18 @@ const ShCompileOptions SH_CLAMP_FRAG_DEPTH = UINT64_C(1) << 38;
 // prior to version 397.31.
 const ShCompileOptions SH_REWRITE_REPEATED_ASSIGN_TO_SWIZZLED = UINT64_C(1) << 39;
 
+// Allocate the memory used during translation in large pages. This reduces the number of
+// allocations from the OS when translating very large shaders.
+const ShCompileOptions SH_LARGE_POOL_PAGES = UINT64_C(1) << 40;
+
+// Look the shader up in the process-wide translation cache before compiling it, and add the
+// results of a successful compile to the cache. See ConfigureTranslationCache.
+const ShCompileOptions SH_CACHE_TRANSLATION = UINT64_C(1) << 41;
+
+// Record the time and pool memory spent in each phase of the compile, and the number of AST nodes
+// visited by it. See GetCompileStatistics.
+const ShCompileOptions SH_COLLECT_COMPILE_STATISTICS = UINT64_C(1) << 42;
+
 // Defines alternate strategies for implementing array index clamping.
 enum ShArrayIndexClampingStrategy
 {
@@ -539,6 +551,38 @@ bool Compile(const ShHandle handle,
 // Clears the results from the previous compilation.
 void ClearResults(const ShHandle handle);
 
+// Configures the translation cache used by compiles with SH_CACHE_TRANSLATION. The cache is shared
+// by all compilers of the process.
+// Parameters:
+// maxMemorySizeBytes: Translations are evicted from memory once they use more than this.
+// directory: If not empty, translations are also stored as files in this existing directory,
+//            where they are found by later processes.
+void ConfigureTranslationCache(size_t maxMemorySizeBytes, const std::string &directory);
+
+// Drops the translations kept in memory by the translation cache.
+void ClearTranslationCache();
+
+// The cost of one phase of a compile with SH_COLLECT_COMPILE_STATISTICS. Preprocessing is counted
+// as part of parsing, since the parser pulls its tokens from the preprocessor.
+struct CompilePhaseStatistics
+{
+    // The phase, usually named after the AST transformation it runs.
+    std::string name;
+    double wallTimeSeconds;
+    // The number of nodes visited by all the traversals of the phase.
+    size_t nodesVisited;
+    // The growth of the memory used from the translator's pool allocator.
+    size_t poolBytes;
+    size_t poolPages;
+};
+
+// Returns the phases of the last compile in the order they ran, or an empty list if the compile
+// didn't collect statistics. A compile restored from the translation cache only has the cache
+// lookup phase.
+// Parameters:
+// handle: Specifies the compiler
+const std::vector<CompilePhaseStatistics> *GetCompileStatistics(const ShHandle handle);
+
 // Return the version of the shader language.
 int GetShaderVersion(const ShHandle handle);
 
@@ -9,6 +9,7 @@
 #ifndef ANGLE_PLATFORM_H
 #define ANGLE_PLATFORM_H
 
+#include <stddef.h>
 #include <stdint.h>
 #include <array>
 
@@ -245,6 +246,35 @@ inline void DefaultCacheProgram(PlatformMethods *platform,
 {
 }
 
+// Blob cache callbacks with the semantics of EGL_ANDROID_blob_cache. Used to persist driver caches,
+// such as the Vulkan pipeline cache, between runs. getBlob returns the size of the value stored for
+// the key, or zero if there is none, and only copies the value out if it fits in valueSize bytes.
+using SetBlobFunc = void (*)(PlatformMethods *platform,
+                             const void *key,
+                             size_t keySize,
+                             const void *value,
+                             size_t valueSize);
+inline void DefaultSetBlob(PlatformMethods *platform,
+                           const void *key,
+                           size_t keySize,
+                           const void *value,
+                           size_t valueSize)
+{
+}
+using GetBlobFunc = size_t (*)(PlatformMethods *platform,
+                               const void *key,
+                               size_t keySize,
+                               void *value,
+                               size_t valueSize);
+inline size_t DefaultGetBlob(PlatformMethods *platform,
+                             const void *key,
+                             size_t keySize,
+                             void *value,
+                             size_t valueSize)
+{
+    return 0;
+}
+
 // Platform methods are enumerated here once.
 #define ANGLE_PLATFORM_OP(OP)                                    \
     OP(currentTime, CurrentTime)                                 \
@@ -260,7 +290,9 @@ inline void DefaultCacheProgram(PlatformMethods *platform,
     OP(histogramSparse, HistogramSparse)                         \
     OP(histogramBoolean, HistogramBoolean)                       \
     OP(overrideWorkaroundsD3D, OverrideWorkaroundsD3D)           \
-    OP(cacheProgram, CacheProgram)
+    OP(cacheProgram, CacheProgram)                               \
+    OP(setBlob, SetBlob)                                         \
+    OP(getBlob, GetBlob)
 
 #define ANGLE_PLATFORM_METHOD_DEF(Name, CapsName) CapsName##Func Name = Default##CapsName;
 
@@ -41,6 +41,12 @@ gles1_no_context_decl_extensions = [
     "GL_OES_framebuffer_object",
 ]
 
+# List of extensions added after the export ordinals were published. Their exports are appended
+# after all the others, so that programs importing by ordinal keep working.
+appended_export_extensions = [
+    "GL_KHR_parallel_shader_compile",
+]
+
 # List of GLES1 API calls that have had their semantics changed in later GLES versions, but the
 # name was kept the same
 gles1_overloaded = [
@@ -62,6 +68,7 @@ supported_extensions = sorted(angle_extensions + gles1_extensions + [
     "GL_EXT_robustness",
     "GL_EXT_texture_storage",
     "GL_KHR_debug",
+    "GL_KHR_parallel_shader_compile",
     "GL_NV_fence",
     "GL_OES_EGL_image",
     "GL_OES_get_program_binary",
@@ -177,7 +184,7 @@ template_entry_point_def = """{return_type}GL_APIENTRY {name}({params})
 
     Context *context = {context_getter}();
     if (context)
-    {{{packed_gl_enum_conversions}
+    {{{deferred_call}{packed_gl_enum_conversions}
         context->gatherParams<EntryPoint::{name}>({internal_params});
 
         if (context->skipValidation() || Validate{name}({validate_params}))
@@ -298,12 +305,79 @@ def default_return_value(cmd_name, return_type):
         return ""
     return "GetDefaultReturnValue<EntryPoint::" + cmd_name[2:] + ", " + return_type + ">()"
 
-def get_context_getter_function(cmd_name):
+def get_context_getter_function(cmd_name, return_type, params):
     if cmd_name == "glGetError":
         return "GetGlobalContext"
+    elif is_deferrable(cmd_name, return_type, params):
+        return "GetValidGlobalContextDeferrable"
     else:
         return "GetValidGlobalContext"
 
+# Entry points that must not be deferred even though they don't return a value or take pointers.
+no_deferred_call_list = [
+    "glFinish",
+    # Resizes the worker pool that deferred compiles and links run on.
+    "glMaxShaderCompilerThreadsKHR",
+]
+
+# Opaque handles to client objects or code.
+no_deferred_call_types = [
+    "GLDEBUGPROC",
+    "GLDEBUGPROCKHR",
+    "GLeglImageOES",
+    "GLsync",
+]
+
+template_deferred_call = """
+        if (context->isDeferringCommands())
+        {{
+            {call}
+            return;
+        }}
+"""
+
+def is_deferrable(cmd_name, return_type, params):
+    if return_type != "void" or cmd_name in no_deferred_call_list:
+        return False
+    for param in params:
+        if "*" in param or just_the_type(param) in no_deferred_call_types:
+            return False
+    return True
+
+# Wraps the arguments the way clang-format does for a statement indented by |indent| spaces.
+def format_call(indent, function, args):
+    single_line = function + "(" + ", ".join(args) + ");"
+    if indent + len(single_line) <= 100:
+        return single_line
+
+    def pack(first_line_start, continuation):
+        lines = []
+        line = ""
+        start = first_line_start
+        for index, arg in enumerate(args):
+            arg += ");" if index == len(args) - 1 else ","
+            if line and start + len(line) + 1 + len(arg) > 100:
+                lines.append(line)
+                line = arg
+                start = continuation
+            else:
+                line = line + " " + arg if line else arg
+        lines.append(line)
+        return lines
+
+    aligned = pack(indent + len(function) + 1, indent + len(function) + 1)
+    wrapped = pack(indent + 4, indent + 4)
+    if len(aligned) <= len(wrapped):
+        return ("\n" + " " * (indent + len(function) + 1)).join(
+            [function + "(" + aligned[0]] + aligned[1:])
+    return function + "(\n" + "\n".join([" " * (indent + 4) + line for line in wrapped])
+
+def format_deferred_call(cmd_name, return_type, params):
+    if not is_deferrable(cmd_name, return_type, params):
+        return ""
+    args = ["context", cmd_name[2:]] + [just_the_name(param) for param in params]
+    return template_deferred_call.format(call = format_call(12, "DeferEntryPoint", args))
+
 template_event_comment = """// Don't run an EVENT() macro on the EXT_debug_marker entry points.
     // It can interfere with the debug events being set by the caller.
     // """
@@ -344,7 +418,8 @@ def format_entry_point_def(cmd_name, proto, params):
         format_params = ", ".join(format_params),
         return_if_needed = "" if default_return == "" else "return ",
         default_return_if_needed = "" if default_return == "" else "\n    return " + default_return + ";\n",
-        context_getter = get_context_getter_function(cmd_name),
+        context_getter = get_context_getter_function(cmd_name, return_type.strip(), params),
+        deferred_call = format_deferred_call(cmd_name, return_type.strip(), params),
         event_comment = event_comment)
 
 def format_context_gles_decl(cmd_name, proto, params):
@@ -524,6 +599,7 @@ template_sources_includes = """#include "libGLESv2/entry_points_gles_{}_autogen.
 
 #include "libANGLE/Context.h"
 #include "libANGLE/validationES{}{}.h"
+#include "libGLESv2/entry_points_deferred.h"
 #include "libGLESv2/global_state.h"
 """
 
@@ -626,6 +702,8 @@ for extension in root.findall("extensions/extension"):
 
     ext_data[extension_name] = sorted(ext_cmd_names)
 
+appended_ext_cmd_names = {}
+
 for extension_name, ext_cmd_names in sorted(ext_data.iteritems()):
 
     # Detect and filter duplicate extensions.
@@ -647,26 +725,36 @@ for extension_name, ext_cmd_names in sorted(ext_data.iteritems()):
         msg = "// {} is already defined.\n".format(dupe[2:])
         defs.append(msg)
 
-    # Increment starting ordinal before adding extension comment
-    ordinal_start += len(libgles_exports)
-
     # Write the extension name as a comment before the first EP.
     comment = "\n// {}".format(extension_name)
     defs.insert(0, comment)
     decls.insert(0, comment)
     libgles_defs.insert(0, comment)
-    libgles_exports.insert(0, "\n    ; {}".format(extension_name))
 
     extension_defs += defs
     extension_decls += decls
 
     libgles_ep_defs += libgles_defs
-    libgles_ep_exports += libgles_exports
+
+    if extension_name in appended_export_extensions:
+        appended_ext_cmd_names[extension_name] = ext_cmd_names
+    else:
+        # Increment starting ordinal before adding extension comment
+        ordinal_start += len(libgles_exports)
+        libgles_exports.insert(0, "\n    ; {}".format(extension_name))
+        libgles_ep_exports += libgles_exports
 
     if extension_name in gles1_extensions:
         if extension_name not in gles1_no_context_decl_extensions:
             gles1decls['exts'][extension_name] = get_gles1_decls(all_commands, ext_cmd_names)
 
+for extension_name in appended_export_extensions:
+    _, _, _, libgles_exports = get_entry_points(
+        all_commands, appended_ext_cmd_names[extension_name], ordinal_start)
+    ordinal_start += len(libgles_exports)
+    libgles_exports.insert(0, "\n    ; {}".format(extension_name))
+    libgles_ep_exports += libgles_exports
+
 header_includes = template_header_includes.format(
     major="", minor="")
 header_includes += """
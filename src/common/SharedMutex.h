@@ -0,0 +1,125 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// SharedMutex.h:
+//   A reader/writer lock for data that is read far more often than it is written, and lock guards
+//   that only lock when the data can be reached from more than one thread.
+//
+
+#ifndef COMMON_SHAREDMUTEX_H_
+#define COMMON_SHAREDMUTEX_H_
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+#include "common/angleutils.h"
+
+namespace angle
+{
+
+// Readers take the lock with a single compare-and-swap when no writer is waiting. A waiting writer
+// stops new readers from entering, so a steady stream of readers can't starve it.
+class SharedMutex final : angle::NonCopyable
+{
+  public:
+    SharedMutex() : mState(0) {}
+
+    void lock()
+    {
+        mWriterMutex.lock();
+
+        mState.fetch_or(kWriterBit, std::memory_order_acquire);
+        while (mState.load(std::memory_order_acquire) != kWriterBit)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    void unlock()
+    {
+        mState.fetch_and(~kWriterBit, std::memory_order_release);
+        mWriterMutex.unlock();
+    }
+
+    void lock_shared()
+    {
+        uint32_t state = mState.load(std::memory_order_relaxed);
+        while (true)
+        {
+            if ((state & kWriterBit) != 0)
+            {
+                std::this_thread::yield();
+                state = mState.load(std::memory_order_relaxed);
+            }
+            else if (mState.compare_exchange_weak(state, state + 1, std::memory_order_acquire,
+                                                  std::memory_order_relaxed))
+            {
+                return;
+            }
+        }
+    }
+
+    void unlock_shared() { mState.fetch_sub(1, std::memory_order_release); }
+
+  private:
+    static constexpr uint32_t kWriterBit = 0x80000000u;
+
+    // The number of readers holding the lock, plus kWriterBit while a writer holds or waits for it.
+    std::atomic<uint32_t> mState;
+    std::mutex mWriterMutex;
+};
+
+template <typename MutexT>
+class ConditionalLockGuard final : angle::NonCopyable
+{
+  public:
+    ConditionalLockGuard(MutexT &mutex, bool enabled) : mMutex(enabled ? &mutex : nullptr)
+    {
+        if (mMutex)
+        {
+            mMutex->lock();
+        }
+    }
+
+    ~ConditionalLockGuard()
+    {
+        if (mMutex)
+        {
+            mMutex->unlock();
+        }
+    }
+
+  private:
+    MutexT *mMutex;
+};
+
+template <typename MutexT>
+class ConditionalSharedLockGuard final : angle::NonCopyable
+{
+  public:
+    ConditionalSharedLockGuard(MutexT &mutex, bool enabled) : mMutex(enabled ? &mutex : nullptr)
+    {
+        if (mMutex)
+        {
+            mMutex->lock_shared();
+        }
+    }
+
+    ~ConditionalSharedLockGuard()
+    {
+        if (mMutex)
+        {
+            mMutex->unlock_shared();
+        }
+    }
+
+  private:
+    MutexT *mMutex;
+};
+
+}  // namespace angle
+
+#endif  // COMMON_SHAREDMUTEX_H_
@@ -0,0 +1,96 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// SharedMutex_unittest:
+//   Tests of the SharedMutex class and the conditional lock guards
+//
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <thread>
+
+#include "common/SharedMutex.h"
+
+namespace angle
+{
+// Readers never see a half finished write, and no write is lost.
+TEST(SharedMutex, ReadersAndWriters)
+{
+    constexpr size_t kThreadCount = 8;
+    constexpr int kIterations     = 10000;
+
+    SharedMutex mutex;
+    int first  = 0;
+    int second = 0;
+    std::atomic<int> mismatches(0);
+
+    std::array<std::thread, kThreadCount> threads;
+    for (size_t thread = 0; thread < kThreadCount; ++thread)
+    {
+        bool writer     = (thread % 2) == 0;
+        threads[thread] = std::thread([&, writer]() {
+            for (int iteration = 0; iteration < kIterations; ++iteration)
+            {
+                if (writer)
+                {
+                    ConditionalLockGuard<SharedMutex> lock(mutex, true);
+                    first++;
+                    second++;
+                }
+                else
+                {
+                    ConditionalSharedLockGuard<SharedMutex> lock(mutex, true);
+                    if (first != second)
+                    {
+                        mismatches++;
+                    }
+                }
+            }
+        });
+    }
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(0, mismatches.load());
+    EXPECT_EQ(static_cast<int>(kThreadCount / 2) * kIterations, first);
+    EXPECT_EQ(first, second);
+}
+
+// Several readers can hold the lock at once.
+TEST(SharedMutex, ConcurrentReaders)
+{
+    SharedMutex mutex;
+    mutex.lock_shared();
+
+    std::thread reader([&mutex]() {
+        mutex.lock_shared();
+        mutex.unlock_shared();
+    });
+    reader.join();
+
+    mutex.unlock_shared();
+
+    mutex.lock();
+    mutex.unlock();
+}
+
+// The guards leave the mutex alone when they're disabled.
+TEST(SharedMutex, DisabledGuards)
+{
+    SharedMutex mutex;
+    mutex.lock();
+
+    {
+        ConditionalLockGuard<SharedMutex> writeLock(mutex, false);
+        ConditionalSharedLockGuard<SharedMutex> readLock(mutex, false);
+    }
+
+    mutex.unlock();
+}
+}  // namespace angle
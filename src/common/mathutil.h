@@ -164,6 +164,8 @@ inline bool supportsSSE2()
             supports = (info[3] >> 26) & 1;
         }
     }
+#elif defined(__GNUC__)
+    supports = __builtin_cpu_supports("sse2");
 #endif  // defined(ANGLE_PLATFORM_WINDOWS) && !defined(_M_ARM)
     checked = true;
     return supports;
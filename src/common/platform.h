@@ -90,6 +90,9 @@
 #elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
 #include <x86intrin.h>
 #define ANGLE_USE_SSE
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define ANGLE_USE_NEON
 #endif
 
 // Mips and arm devices need to include stddef for size_t.
@@ -11,6 +11,9 @@
 #include "common/mathutil.h"
 #include "common/platform.h"
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
 #include <set>
 
 #if defined(ANGLE_ENABLE_WINDOWS_STORE)
@@ -23,73 +26,463 @@
 namespace
 {
 
-template <class IndexType>
-gl::IndexRange ComputeTypedIndexRange(const IndexType *indices,
-                                      size_t count,
-                                      bool primitiveRestartEnabled,
-                                      GLuint primitiveRestartIndex)
+// The vector kernels below scan a prefix of the indices, optionally copying or widening them to
+// |output| in the same pass, and return how many indices they handled. They fold the min and max
+// of the non primitive restart indices into |minOut| and |maxOut| and add the number of primitive
+// restart indices to |restartCountOut|. Primitive restart indices are always the largest value of
+// their type, so they can be left in the minimum and only have to be masked out of the maximum.
+#if defined(ANGLE_USE_SSE)
+
+// SSE2 only has unsigned min and max for bytes. Wider indices are biased by flipping their sign bit
+// so that signed comparisons order them as unsigned values.
+template <typename IndexType>
+struct IndexVectorOps;
+
+template <>
+struct IndexVectorOps<GLubyte>
 {
-    ASSERT(count > 0);
+    static __m128i Bias() { return _mm_setzero_si128(); }
+    static __m128i Equal(__m128i a, __m128i b) { return _mm_cmpeq_epi8(a, b); }
+    static __m128i Min(__m128i a, __m128i b) { return _mm_min_epu8(a, b); }
+    static __m128i Max(__m128i a, __m128i b) { return _mm_max_epu8(a, b); }
+};
+
+template <>
+struct IndexVectorOps<GLushort>
+{
+    static __m128i Bias() { return _mm_set1_epi16(std::numeric_limits<short>::min()); }
+    static __m128i Equal(__m128i a, __m128i b) { return _mm_cmpeq_epi16(a, b); }
+    static __m128i Min(__m128i a, __m128i b) { return _mm_min_epi16(a, b); }
+    static __m128i Max(__m128i a, __m128i b) { return _mm_max_epi16(a, b); }
+};
+
+template <>
+struct IndexVectorOps<GLuint>
+{
+    static __m128i Bias() { return _mm_set1_epi32(std::numeric_limits<int>::min()); }
+    static __m128i Equal(__m128i a, __m128i b) { return _mm_cmpeq_epi32(a, b); }
+    static __m128i Min(__m128i a, __m128i b)
+    {
+        __m128i greater = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(greater, b), _mm_andnot_si128(greater, a));
+    }
+    static __m128i Max(__m128i a, __m128i b)
+    {
+        __m128i greater = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(greater, a), _mm_andnot_si128(greater, b));
+    }
+};
 
-    IndexType minIndex                = 0;
-    IndexType maxIndex                = 0;
-    size_t nonPrimitiveRestartIndices = 0;
+// Writes the indices to the output type. Interleaving the indices with the all ones restart mask
+// widens restart indices to the restart index of the wider type and zero extends everything else.
+template <typename IndexType, typename DestType>
+struct IndexVectorStore
+{
+    static constexpr bool kSupported = false;
+    static void Store(DestType *dest, __m128i values, __m128i isRestart) {}
+};
+
+template <typename IndexType>
+struct IndexVectorStore<IndexType, IndexType>
+{
+    static constexpr bool kSupported = true;
+    static void Store(IndexType *dest, __m128i values, __m128i isRestart)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest), values);
+    }
+};
 
-    if (primitiveRestartEnabled)
+template <>
+struct IndexVectorStore<GLubyte, GLushort>
+{
+    static constexpr bool kSupported = true;
+    static void Store(GLushort *dest, __m128i values, __m128i isRestart)
     {
-        // Find the first non-primitive restart index to initialize the min and max values
-        size_t i = 0;
-        for (; i < count; i++)
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest), _mm_unpacklo_epi8(values, isRestart));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + 8),
+                         _mm_unpackhi_epi8(values, isRestart));
+    }
+};
+
+template <>
+struct IndexVectorStore<GLushort, GLuint>
+{
+    static constexpr bool kSupported = true;
+    static void Store(GLuint *dest, __m128i values, __m128i isRestart)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest), _mm_unpacklo_epi16(values, isRestart));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + 4),
+                         _mm_unpackhi_epi16(values, isRestart));
+    }
+};
+
+template <typename IndexType, typename DestType>
+size_t ComputeIndexRangeVector(const IndexType *indices,
+                               size_t count,
+                               bool primitiveRestartEnabled,
+                               DestType *output,
+                               IndexType *minOut,
+                               IndexType *maxOut,
+                               size_t *restartCountOut)
+{
+    using Ops   = IndexVectorOps<IndexType>;
+    using Store = IndexVectorStore<IndexType, DestType>;
+    constexpr size_t kLanes = sizeof(__m128i) / sizeof(IndexType);
+
+    if (!Store::kSupported || !gl::supportsSSE2())
+    {
+        return 0;
+    }
+
+    const __m128i bias    = Ops::Bias();
+    const __m128i allOnes = _mm_set1_epi32(-1);
+    const __m128i zero    = _mm_setzero_si128();
+    __m128i minValues     = _mm_xor_si128(allOnes, bias);
+    __m128i maxValues     = bias;
+    __m128i restartBytes  = zero;
+
+    size_t i = 0;
+    for (; i + kLanes <= count; i += kLanes)
+    {
+        __m128i values    = _mm_loadu_si128(reinterpret_cast<const __m128i *>(indices + i));
+        __m128i isRestart = zero;
+        if (primitiveRestartEnabled)
         {
-            if (indices[i] != primitiveRestartIndex)
-            {
-                minIndex = indices[i];
-                maxIndex = indices[i];
-                nonPrimitiveRestartIndices++;
-                break;
-            }
+            isRestart    = Ops::Equal(values, allOnes);
+            restartBytes = _mm_add_epi64(restartBytes, _mm_sad_epu8(isRestart, zero));
         }
+        if (output)
+        {
+            Store::Store(output + i, values, isRestart);
+        }
+        minValues = Ops::Min(minValues, _mm_xor_si128(values, bias));
+        maxValues = Ops::Max(maxValues, _mm_xor_si128(_mm_andnot_si128(isRestart, values), bias));
+    }
+
+    IndexType minLanes[kLanes];
+    IndexType maxLanes[kLanes];
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(minLanes), _mm_xor_si128(minValues, bias));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(maxLanes), _mm_xor_si128(maxValues, bias));
+    for (size_t lane = 0; lane < kLanes; lane++)
+    {
+        *minOut = std::min(*minOut, minLanes[lane]);
+        *maxOut = std::max(*maxOut, maxLanes[lane]);
+    }
+
+    // Each restart index added 0xFF for each of its bytes to one of the two sums.
+    uint64_t restartSums[2];
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(restartSums), restartBytes);
+    *restartCountOut +=
+        static_cast<size_t>((restartSums[0] + restartSums[1]) / (0xFF * sizeof(IndexType)));
+    return i;
+}
+
+template <typename IndexType, typename DestType>
+size_t ConvertIndicesVector(const IndexType *indices,
+                            size_t count,
+                            bool primitiveRestartEnabled,
+                            DestType *output)
+{
+    using Ops   = IndexVectorOps<IndexType>;
+    using Store = IndexVectorStore<IndexType, DestType>;
+    constexpr size_t kLanes = sizeof(__m128i) / sizeof(IndexType);
+
+    if (!Store::kSupported || !gl::supportsSSE2())
+    {
+        return 0;
+    }
+
+    const __m128i allOnes = _mm_set1_epi32(-1);
+    const __m128i zero    = _mm_setzero_si128();
+
+    size_t i = 0;
+    for (; i + kLanes <= count; i += kLanes)
+    {
+        __m128i values    = _mm_loadu_si128(reinterpret_cast<const __m128i *>(indices + i));
+        __m128i isRestart = primitiveRestartEnabled ? Ops::Equal(values, allOnes) : zero;
+        Store::Store(output + i, values, isRestart);
+    }
+    return i;
+}
+
+#elif defined(ANGLE_USE_NEON)
 
-        // Loop over the rest of the indices
-        for (; i < count; i++)
+template <typename IndexType>
+struct IndexVectorOps;
+
+template <>
+struct IndexVectorOps<GLubyte>
+{
+    using Vector = uint8x16_t;
+    static Vector Load(const GLubyte *source) { return vld1q_u8(source); }
+    static void Store(GLubyte *dest, Vector values) { vst1q_u8(dest, values); }
+    static Vector Splat(GLubyte value) { return vdupq_n_u8(value); }
+    static Vector Equal(Vector a, Vector b) { return vceqq_u8(a, b); }
+    static Vector AndNot(Vector a, Vector b) { return vbicq_u8(a, b); }
+    static Vector Min(Vector a, Vector b) { return vminq_u8(a, b); }
+    static Vector Max(Vector a, Vector b) { return vmaxq_u8(a, b); }
+    static uint32x4_t CountRestarts(uint32x4_t counts, Vector isRestart)
+    {
+        return vpadalq_u16(counts, vpaddlq_u8(vshrq_n_u8(isRestart, 7)));
+    }
+};
+
+template <>
+struct IndexVectorOps<GLushort>
+{
+    using Vector = uint16x8_t;
+    static Vector Load(const GLushort *source) { return vld1q_u16(source); }
+    static void Store(GLushort *dest, Vector values) { vst1q_u16(dest, values); }
+    static Vector Splat(GLushort value) { return vdupq_n_u16(value); }
+    static Vector Equal(Vector a, Vector b) { return vceqq_u16(a, b); }
+    static Vector AndNot(Vector a, Vector b) { return vbicq_u16(a, b); }
+    static Vector Min(Vector a, Vector b) { return vminq_u16(a, b); }
+    static Vector Max(Vector a, Vector b) { return vmaxq_u16(a, b); }
+    static uint32x4_t CountRestarts(uint32x4_t counts, Vector isRestart)
+    {
+        return vpadalq_u16(counts, vshrq_n_u16(isRestart, 15));
+    }
+};
+
+template <>
+struct IndexVectorOps<GLuint>
+{
+    using Vector = uint32x4_t;
+    static Vector Load(const GLuint *source) { return vld1q_u32(source); }
+    static void Store(GLuint *dest, Vector values) { vst1q_u32(dest, values); }
+    static Vector Splat(GLuint value) { return vdupq_n_u32(value); }
+    static Vector Equal(Vector a, Vector b) { return vceqq_u32(a, b); }
+    static Vector AndNot(Vector a, Vector b) { return vbicq_u32(a, b); }
+    static Vector Min(Vector a, Vector b) { return vminq_u32(a, b); }
+    static Vector Max(Vector a, Vector b) { return vmaxq_u32(a, b); }
+    static uint32x4_t CountRestarts(uint32x4_t counts, Vector isRestart)
+    {
+        return vsubq_u32(counts, isRestart);
+    }
+};
+
+// Writes the indices to the output type. Interleaving the indices with the all ones restart mask
+// widens restart indices to the restart index of the wider type and zero extends everything else.
+template <typename IndexType, typename DestType>
+struct IndexVectorStore
+{
+    using Vector                     = typename IndexVectorOps<IndexType>::Vector;
+    static constexpr bool kSupported = false;
+    static void Store(DestType *dest, Vector values, Vector isRestart) {}
+};
+
+template <typename IndexType>
+struct IndexVectorStore<IndexType, IndexType>
+{
+    using Vector                     = typename IndexVectorOps<IndexType>::Vector;
+    static constexpr bool kSupported = true;
+    static void Store(IndexType *dest, Vector values, Vector isRestart)
+    {
+        IndexVectorOps<IndexType>::Store(dest, values);
+    }
+};
+
+template <>
+struct IndexVectorStore<GLubyte, GLushort>
+{
+    static constexpr bool kSupported = true;
+    static void Store(GLushort *dest, uint8x16_t values, uint8x16_t isRestart)
+    {
+        uint8x16x2_t interleaved = {{values, isRestart}};
+        vst2q_u8(reinterpret_cast<uint8_t *>(dest), interleaved);
+    }
+};
+
+template <>
+struct IndexVectorStore<GLushort, GLuint>
+{
+    static constexpr bool kSupported = true;
+    static void Store(GLuint *dest, uint16x8_t values, uint16x8_t isRestart)
+    {
+        uint16x8x2_t interleaved = {{values, isRestart}};
+        vst2q_u16(reinterpret_cast<uint16_t *>(dest), interleaved);
+    }
+};
+
+template <typename IndexType, typename DestType>
+size_t ComputeIndexRangeVector(const IndexType *indices,
+                               size_t count,
+                               bool primitiveRestartEnabled,
+                               DestType *output,
+                               IndexType *minOut,
+                               IndexType *maxOut,
+                               size_t *restartCountOut)
+{
+    using Ops    = IndexVectorOps<IndexType>;
+    using Store  = IndexVectorStore<IndexType, DestType>;
+    using Vector = typename Ops::Vector;
+    constexpr size_t kLanes = sizeof(Vector) / sizeof(IndexType);
+
+    if (!Store::kSupported)
+    {
+        return 0;
+    }
+
+    const Vector restartIndex = Ops::Splat(std::numeric_limits<IndexType>::max());
+    const Vector zero         = Ops::Splat(0);
+    Vector minValues          = restartIndex;
+    Vector maxValues          = zero;
+    uint32x4_t restartCounts  = vdupq_n_u32(0);
+
+    size_t i = 0;
+    for (; i + kLanes <= count; i += kLanes)
+    {
+        Vector values    = Ops::Load(indices + i);
+        Vector isRestart = zero;
+        if (primitiveRestartEnabled)
         {
-            if (indices[i] != primitiveRestartIndex)
-            {
-                if (minIndex > indices[i])
-                {
-                    minIndex = indices[i];
-                }
-                if (maxIndex < indices[i])
-                {
-                    maxIndex = indices[i];
-                }
-                nonPrimitiveRestartIndices++;
-            }
+            isRestart     = Ops::Equal(values, restartIndex);
+            restartCounts = Ops::CountRestarts(restartCounts, isRestart);
+        }
+        if (output)
+        {
+            Store::Store(output + i, values, isRestart);
         }
+        minValues = Ops::Min(minValues, values);
+        maxValues = Ops::Max(maxValues, Ops::AndNot(values, isRestart));
     }
-    else
+
+    IndexType minLanes[kLanes];
+    IndexType maxLanes[kLanes];
+    Ops::Store(minLanes, minValues);
+    Ops::Store(maxLanes, maxValues);
+    for (size_t lane = 0; lane < kLanes; lane++)
     {
-        minIndex                   = indices[0];
-        maxIndex                   = indices[0];
-        nonPrimitiveRestartIndices = count;
+        *minOut = std::min(*minOut, minLanes[lane]);
+        *maxOut = std::max(*maxOut, maxLanes[lane]);
+    }
+
+    uint32_t countLanes[4];
+    vst1q_u32(countLanes, restartCounts);
+    *restartCountOut += countLanes[0] + countLanes[1] + countLanes[2] + countLanes[3];
+    return i;
+}
+
+template <typename IndexType, typename DestType>
+size_t ConvertIndicesVector(const IndexType *indices,
+                            size_t count,
+                            bool primitiveRestartEnabled,
+                            DestType *output)
+{
+    using Ops    = IndexVectorOps<IndexType>;
+    using Store  = IndexVectorStore<IndexType, DestType>;
+    using Vector = typename Ops::Vector;
+    constexpr size_t kLanes = sizeof(Vector) / sizeof(IndexType);
+
+    if (!Store::kSupported)
+    {
+        return 0;
+    }
+
+    const Vector restartIndex = Ops::Splat(std::numeric_limits<IndexType>::max());
+    const Vector zero         = Ops::Splat(0);
+
+    size_t i = 0;
+    for (; i + kLanes <= count; i += kLanes)
+    {
+        Vector values    = Ops::Load(indices + i);
+        Vector isRestart = primitiveRestartEnabled ? Ops::Equal(values, restartIndex) : zero;
+        Store::Store(output + i, values, isRestart);
+    }
+    return i;
+}
+
+#else
 
-        for (size_t i = 1; i < count; i++)
+template <typename IndexType, typename DestType>
+size_t ComputeIndexRangeVector(const IndexType *indices,
+                               size_t count,
+                               bool primitiveRestartEnabled,
+                               DestType *output,
+                               IndexType *minOut,
+                               IndexType *maxOut,
+                               size_t *restartCountOut)
+{
+    return 0;
+}
+
+template <typename IndexType, typename DestType>
+size_t ConvertIndicesVector(const IndexType *indices,
+                            size_t count,
+                            bool primitiveRestartEnabled,
+                            DestType *output)
+{
+    return 0;
+}
+
+#endif  // defined(ANGLE_USE_SSE)
+
+// Finds the range of the indices and, if |output| is not null, converts them to DestType. Primitive
+// restart indices are converted to the primitive restart index of DestType when primitive restart
+// is enabled.
+template <class IndexType, class DestType>
+gl::IndexRange ComputeTypedIndexRange(const IndexType *indices,
+                                      size_t count,
+                                      bool primitiveRestartEnabled,
+                                      DestType *output)
+{
+    ASSERT(count > 0);
+
+    const IndexType primitiveRestartIndex    = std::numeric_limits<IndexType>::max();
+    const DestType destPrimitiveRestartIndex = std::numeric_limits<DestType>::max();
+
+    IndexType minIndex  = std::numeric_limits<IndexType>::max();
+    IndexType maxIndex  = 0;
+    size_t restartCount = 0;
+
+    size_t i = ComputeIndexRangeVector(indices, count, primitiveRestartEnabled, output, &minIndex,
+                                       &maxIndex, &restartCount);
+    for (; i < count; i++)
+    {
+        IndexType index = indices[i];
+        bool isRestart  = primitiveRestartEnabled && index == primitiveRestartIndex;
+        if (output)
         {
-            if (minIndex > indices[i])
-            {
-                minIndex = indices[i];
-            }
-            if (maxIndex < indices[i])
-            {
-                maxIndex = indices[i];
-            }
+            output[i] = isRestart ? destPrimitiveRestartIndex : static_cast<DestType>(index);
         }
+        if (isRestart)
+        {
+            restartCount++;
+            continue;
+        }
+        minIndex = std::min(minIndex, index);
+        maxIndex = std::max(maxIndex, index);
+    }
+
+    size_t nonPrimitiveRestartIndices = count - restartCount;
+    if (nonPrimitiveRestartIndices == 0)
+    {
+        return gl::IndexRange(0, 0, 0);
     }
 
     return gl::IndexRange(static_cast<size_t>(minIndex), static_cast<size_t>(maxIndex),
                           nonPrimitiveRestartIndices);
 }
 
+// Converts the indices to DestType like ComputeTypedIndexRange, without finding their range.
+template <class IndexType, class DestType>
+void ConvertTypedIndices(const IndexType *indices,
+                         size_t count,
+                         bool primitiveRestartEnabled,
+                         DestType *output)
+{
+    const IndexType primitiveRestartIndex    = std::numeric_limits<IndexType>::max();
+    const DestType destPrimitiveRestartIndex = std::numeric_limits<DestType>::max();
+
+    size_t i = ConvertIndicesVector(indices, count, primitiveRestartEnabled, output);
+    for (; i < count; i++)
+    {
+        IndexType index = indices[i];
+        bool isRestart  = primitiveRestartEnabled && index == primitiveRestartIndex;
+        output[i]       = isRestart ? destPrimitiveRestartIndex : static_cast<DestType>(index);
+    }
+}
+
 }  // anonymous namespace
 
 namespace gl
@@ -510,22 +903,117 @@ IndexRange ComputeIndexRange(GLenum indexType,
     {
         case GL_UNSIGNED_BYTE:
             return ComputeTypedIndexRange(static_cast<const GLubyte *>(indices), count,
-                                          primitiveRestartEnabled,
-                                          GetPrimitiveRestartIndex(indexType));
+                                          primitiveRestartEnabled, static_cast<GLubyte *>(nullptr));
         case GL_UNSIGNED_SHORT:
             return ComputeTypedIndexRange(static_cast<const GLushort *>(indices), count,
                                           primitiveRestartEnabled,
-                                          GetPrimitiveRestartIndex(indexType));
+                                          static_cast<GLushort *>(nullptr));
         case GL_UNSIGNED_INT:
             return ComputeTypedIndexRange(static_cast<const GLuint *>(indices), count,
-                                          primitiveRestartEnabled,
-                                          GetPrimitiveRestartIndex(indexType));
+                                          primitiveRestartEnabled, static_cast<GLuint *>(nullptr));
         default:
             UNREACHABLE();
             return IndexRange();
     }
 }
 
+IndexRange ComputeIndexRangeAndConvert(GLenum indexType,
+                                       const GLvoid *indices,
+                                       size_t count,
+                                       bool primitiveRestartEnabled,
+                                       GLenum destinationType,
+                                       GLvoid *output)
+{
+    switch (destinationType)
+    {
+        case GL_UNSIGNED_BYTE:
+            ASSERT(indexType == GL_UNSIGNED_BYTE);
+            return ComputeTypedIndexRange(static_cast<const GLubyte *>(indices), count,
+                                          primitiveRestartEnabled, static_cast<GLubyte *>(output));
+        case GL_UNSIGNED_SHORT:
+            if (indexType == GL_UNSIGNED_BYTE)
+            {
+                return ComputeTypedIndexRange(static_cast<const GLubyte *>(indices), count,
+                                              primitiveRestartEnabled,
+                                              static_cast<GLushort *>(output));
+            }
+            ASSERT(indexType == GL_UNSIGNED_SHORT);
+            return ComputeTypedIndexRange(static_cast<const GLushort *>(indices), count,
+                                          primitiveRestartEnabled, static_cast<GLushort *>(output));
+        case GL_UNSIGNED_INT:
+            switch (indexType)
+            {
+                case GL_UNSIGNED_BYTE:
+                    return ComputeTypedIndexRange(static_cast<const GLubyte *>(indices), count,
+                                                  primitiveRestartEnabled,
+                                                  static_cast<GLuint *>(output));
+                case GL_UNSIGNED_SHORT:
+                    return ComputeTypedIndexRange(static_cast<const GLushort *>(indices), count,
+                                                  primitiveRestartEnabled,
+                                                  static_cast<GLuint *>(output));
+                case GL_UNSIGNED_INT:
+                    return ComputeTypedIndexRange(static_cast<const GLuint *>(indices), count,
+                                                  primitiveRestartEnabled,
+                                                  static_cast<GLuint *>(output));
+                default:
+                    UNREACHABLE();
+                    return IndexRange();
+            }
+        default:
+            UNREACHABLE();
+            return IndexRange();
+    }
+}
+
+void ConvertIndices(GLenum indexType,
+                    const GLvoid *indices,
+                    size_t count,
+                    bool primitiveRestartEnabled,
+                    GLenum destinationType,
+                    GLvoid *output)
+{
+    // Restart indices keep their value when the types match, so those are plain copies.
+    switch (destinationType)
+    {
+        case GL_UNSIGNED_BYTE:
+            ASSERT(indexType == GL_UNSIGNED_BYTE);
+            memcpy(output, indices, count * sizeof(GLubyte));
+            break;
+        case GL_UNSIGNED_SHORT:
+            if (indexType == GL_UNSIGNED_BYTE)
+            {
+                ConvertTypedIndices(static_cast<const GLubyte *>(indices), count,
+                                    primitiveRestartEnabled, static_cast<GLushort *>(output));
+                break;
+            }
+            ASSERT(indexType == GL_UNSIGNED_SHORT);
+            memcpy(output, indices, count * sizeof(GLushort));
+            break;
+        case GL_UNSIGNED_INT:
+            switch (indexType)
+            {
+                case GL_UNSIGNED_BYTE:
+                    ConvertTypedIndices(static_cast<const GLubyte *>(indices), count,
+                                        primitiveRestartEnabled, static_cast<GLuint *>(output));
+                    break;
+                case GL_UNSIGNED_SHORT:
+                    ConvertTypedIndices(static_cast<const GLushort *>(indices), count,
+                                        primitiveRestartEnabled, static_cast<GLuint *>(output));
+                    break;
+                case GL_UNSIGNED_INT:
+                    memcpy(output, indices, count * sizeof(GLuint));
+                    break;
+                default:
+                    UNREACHABLE();
+                    break;
+            }
+            break;
+        default:
+            UNREACHABLE();
+            break;
+    }
+}
+
 GLuint GetPrimitiveRestartIndex(GLenum indexType)
 {
     switch (indexType)
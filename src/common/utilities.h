@@ -67,6 +67,26 @@ IndexRange ComputeIndexRange(GLenum indexType,
                              size_t count,
                              bool primitiveRestartEnabled);
 
+// Find the range of the indices like ComputeIndexRange while converting them to |destinationType|,
+// which must be at least as wide as |indexType|, in the same pass. If primitive restart is enabled,
+// primitive restart indices are converted to the primitive restart index of |destinationType|, and
+// the indices contain some if the returned vertexIndexCount is less than |count|.
+IndexRange ComputeIndexRangeAndConvert(GLenum indexType,
+                                       const GLvoid *indices,
+                                       size_t count,
+                                       bool primitiveRestartEnabled,
+                                       GLenum destinationType,
+                                       GLvoid *output);
+
+// Convert the indices to |destinationType| like ComputeIndexRangeAndConvert, for callers that
+// already know the range or don't need it.
+void ConvertIndices(GLenum indexType,
+                    const GLvoid *indices,
+                    size_t count,
+                    bool primitiveRestartEnabled,
+                    GLenum destinationType,
+                    GLvoid *output);
+
 // Get the primitive restart index value for the given index type.
 GLuint GetPrimitiveRestartIndex(GLenum indexType);
 
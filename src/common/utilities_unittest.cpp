@@ -8,6 +8,11 @@
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
 #include "common/utilities.h"
 
 namespace
@@ -177,4 +182,104 @@ TEST(ParseArrayIndex, ArrayIndexOutOfRange)
     EXPECT_EQ(15u, nameLengthWithoutArrayIndex);
 }
 
+// Finds the range and converts the indices one at a time.
+template <typename IndexType, typename DestType>
+gl::IndexRange ReferenceIndexRange(const std::vector<IndexType> &indices,
+                                   bool primitiveRestartEnabled,
+                                   std::vector<DestType> *converted)
+{
+    size_t minIndex         = std::numeric_limits<size_t>::max();
+    size_t maxIndex         = 0;
+    size_t vertexIndexCount = 0;
+    for (IndexType index : indices)
+    {
+        if (primitiveRestartEnabled && index == std::numeric_limits<IndexType>::max())
+        {
+            converted->push_back(std::numeric_limits<DestType>::max());
+            continue;
+        }
+        converted->push_back(index);
+        minIndex = std::min<size_t>(minIndex, index);
+        maxIndex = std::max<size_t>(maxIndex, index);
+        vertexIndexCount++;
+    }
+    return vertexIndexCount == 0 ? gl::IndexRange(0, 0, 0)
+                                 : gl::IndexRange(minIndex, maxIndex, vertexIndexCount);
+}
+
+// Compares ComputeIndexRange, ComputeIndexRangeAndConvert and ConvertIndices with the reference for
+// every count up to a few vectors long, with and without primitive restart indices and small or full range values.
+template <typename IndexType, typename DestType>
+void CheckIndexRange(GLenum indexType, GLenum destinationType)
+{
+    std::mt19937 rng(1);
+
+    for (size_t count = 1; count <= 70; count++)
+    {
+        for (unsigned int restartFrequency : {0u, 1u, 5u})
+        {
+            for (IndexType valueMask : {IndexType(0x3F), std::numeric_limits<IndexType>::max()})
+            {
+                std::vector<IndexType> indices(count);
+                for (IndexType &index : indices)
+                {
+                    bool isRestart = restartFrequency > 0 && rng() % restartFrequency == 0;
+                    index = isRestart ? std::numeric_limits<IndexType>::max()
+                                      : static_cast<IndexType>(rng() & valueMask);
+                }
+
+                for (bool primitiveRestartEnabled : {false, true})
+                {
+                    std::vector<DestType> expectedIndices;
+                    gl::IndexRange expected =
+                        ReferenceIndexRange(indices, primitiveRestartEnabled, &expectedIndices);
+
+                    gl::IndexRange range = gl::ComputeIndexRange(indexType, indices.data(), count,
+                                                                 primitiveRestartEnabled);
+                    EXPECT_EQ(expected.start, range.start);
+                    EXPECT_EQ(expected.end, range.end);
+                    EXPECT_EQ(expected.vertexIndexCount, range.vertexIndexCount);
+
+                    std::vector<DestType> convertedIndices(count + 1, 0xCD);
+                    range = gl::ComputeIndexRangeAndConvert(indexType, indices.data(), count,
+                                                            primitiveRestartEnabled,
+                                                            destinationType,
+                                                            convertedIndices.data());
+                    EXPECT_EQ(expected.start, range.start);
+                    EXPECT_EQ(expected.end, range.end);
+                    EXPECT_EQ(expected.vertexIndexCount, range.vertexIndexCount);
+
+                    expectedIndices.push_back(0xCD);
+                    ASSERT_EQ(expectedIndices, convertedIndices)
+                        << "count " << count << " restart " << primitiveRestartEnabled;
+
+                    std::fill(convertedIndices.begin(), convertedIndices.end(), 0xCD);
+                    gl::ConvertIndices(indexType, indices.data(), count, primitiveRestartEnabled,
+                                       destinationType, convertedIndices.data());
+                    ASSERT_EQ(expectedIndices, convertedIndices)
+                        << "count " << count << " restart " << primitiveRestartEnabled;
+                }
+            }
+        }
+    }
+}
+
+TEST(ComputeIndexRange, UnsignedByte)
+{
+    CheckIndexRange<GLubyte, GLubyte>(GL_UNSIGNED_BYTE, GL_UNSIGNED_BYTE);
+    CheckIndexRange<GLubyte, GLushort>(GL_UNSIGNED_BYTE, GL_UNSIGNED_SHORT);
+    CheckIndexRange<GLubyte, GLuint>(GL_UNSIGNED_BYTE, GL_UNSIGNED_INT);
+}
+
+TEST(ComputeIndexRange, UnsignedShort)
+{
+    CheckIndexRange<GLushort, GLushort>(GL_UNSIGNED_SHORT, GL_UNSIGNED_SHORT);
+    CheckIndexRange<GLushort, GLuint>(GL_UNSIGNED_SHORT, GL_UNSIGNED_INT);
+}
+
+TEST(ComputeIndexRange, UnsignedInt)
+{
+    CheckIndexRange<GLuint, GLuint>(GL_UNSIGNED_INT, GL_UNSIGNED_INT);
+}
+
 }  // anonymous namespace
@@ -133,8 +133,8 @@ bool hasDoubleUnderscores(const std::string &name)
 
 bool isMacroPredefined(const std::string &name, const pp::MacroSet &macroSet)
 {
-    pp::MacroSet::const_iterator iter = macroSet.find(name);
-    return iter != macroSet.end() ? iter->second->predefined : false;
+    const std::shared_ptr<pp::Macro> *macro = macroSet.find(name);
+    return macro != nullptr ? (*macro)->predefined : false;
 }
 
 }  // namespace anonymous
@@ -175,8 +175,7 @@ class DefinedParser : public Lexer
             skipUntilEOD(mLexer, token);
             return;
         }
-        MacroSet::const_iterator iter = mMacroSet->find(token->text);
-        std::string expression        = iter != mMacroSet->end() ? "1" : "0";
+        std::string expression = mMacroSet->contains(token->text) ? "1" : "0";
 
         if (paren)
         {
@@ -417,14 +416,33 @@ void DirectiveParser::parseDefine(Token *token)
         macro->replacements.front().setHasLeadingSpace(false);
     }
 
+    if (macro->type == Macro::kTypeFunc)
+    {
+        macro->replacementParameters.reserve(macro->replacements.size());
+        for (const Token &repl : macro->replacements)
+        {
+            int parameterIndex = -1;
+            if (repl.type == Token::IDENTIFIER)
+            {
+                Macro::Parameters::const_iterator iter =
+                    std::find(macro->parameters.begin(), macro->parameters.end(), repl.text);
+                if (iter != macro->parameters.end())
+                {
+                    parameterIndex = static_cast<int>(iter - macro->parameters.begin());
+                }
+            }
+            macro->replacementParameters.push_back(parameterIndex);
+        }
+    }
+
     // Check for macro redefinition.
-    MacroSet::const_iterator iter = mMacroSet->find(macro->name);
-    if (iter != mMacroSet->end() && !macro->equals(*iter->second))
+    const std::shared_ptr<Macro> *existingMacro = mMacroSet->find(macro->name);
+    if (existingMacro != nullptr && !macro->equals(**existingMacro))
     {
         mDiagnostics->report(Diagnostics::PP_MACRO_REDEFINED, token->location, macro->name);
         return;
     }
-    mMacroSet->insert(std::make_pair(macro->name, macro));
+    mMacroSet->insert(macro);
 }
 
 void DirectiveParser::parseUndef(Token *token)
@@ -438,16 +456,16 @@ void DirectiveParser::parseUndef(Token *token)
         return;
     }
 
-    MacroSet::iterator iter = mMacroSet->find(token->text);
-    if (iter != mMacroSet->end())
+    const std::shared_ptr<Macro> *macro = mMacroSet->find(token->text);
+    if (macro != nullptr)
     {
-        if (iter->second->predefined)
+        if ((*macro)->predefined)
         {
             mDiagnostics->report(Diagnostics::PP_MACRO_PREDEFINED_UNDEFINED, token->location,
                                  token->text);
             return;
         }
-        else if (iter->second->expansionCount > 0)
+        else if ((*macro)->expansionCount > 0)
         {
             mDiagnostics->report(Diagnostics::PP_MACRO_UNDEFINED_WHILE_INVOKED, token->location,
                                  token->text);
@@ -455,7 +473,7 @@ void DirectiveParser::parseUndef(Token *token)
         }
         else
         {
-            mMacroSet->erase(iter);
+            mMacroSet->erase(token->text);
         }
     }
 
@@ -986,8 +1004,7 @@ int DirectiveParser::parseExpressionIfdef(Token *token)
         return 0;
     }
 
-    MacroSet::const_iterator iter = mMacroSet->find(token->text);
-    int expression                = iter != mMacroSet->end() ? 1 : 0;
+    int expression = mMacroSet->contains(token->text) ? 1 : 0;
 
     // Check if there are tokens after #ifdef expression.
     mTokenizer->lex(token);
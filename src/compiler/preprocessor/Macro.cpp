@@ -6,7 +6,10 @@
 
 #include "compiler/preprocessor/Macro.h"
 
+#include <functional>
+
 #include "common/angleutils.h"
+#include "common/debug.h"
 #include "compiler/preprocessor/Token.h"
 
 namespace angle
@@ -15,6 +18,19 @@ namespace angle
 namespace pp
 {
 
+namespace
+{
+
+// A power of two, large enough for the predefined macros.
+constexpr size_t kInitialSlotCount = 16;
+
+size_t HashName(const std::string &name)
+{
+    return std::hash<std::string>()(name);
+}
+
+}  // anonymous namespace
+
 Macro::Macro() : predefined(false), disabled(false), expansionCount(0), type(kTypeObj)
 {
 }
@@ -29,6 +45,117 @@ bool Macro::equals(const Macro &other) const
            (replacements == other.replacements);
 }
 
+MacroSet::Slot::Slot() : hash(0), removed(false)
+{
+}
+
+MacroSet::MacroSet() : mSlots(kInitialSlotCount), mSize(0), mRemovedCount(0)
+{
+}
+
+MacroSet::~MacroSet()
+{
+}
+
+const std::shared_ptr<Macro> *MacroSet::find(const std::string &name) const
+{
+    const Slot &slot = mSlots[findSlot(name, HashName(name))];
+    return slot.macro ? &slot.macro : nullptr;
+}
+
+bool MacroSet::insert(const std::shared_ptr<Macro> &macro)
+{
+    ASSERT(macro);
+    size_t hash      = HashName(macro->name);
+    size_t slotIndex = findSlot(macro->name, hash);
+    if (mSlots[slotIndex].macro)
+    {
+        return false;
+    }
+
+    // Removed slots still lengthen probe sequences, so they count towards the load. Keeping the
+    // table at most half full keeps the probe sequences short.
+    if ((mSize + mRemovedCount + 1) * 2 > mSlots.size())
+    {
+        size_t slotCount = mSlots.size();
+        while ((mSize + 1) * 4 > slotCount)
+        {
+            slotCount *= 2;
+        }
+        rehash(slotCount);
+        slotIndex = findSlot(macro->name, hash);
+    }
+
+    Slot &slot = mSlots[slotIndex];
+    slot.hash  = hash;
+    slot.macro = macro;
+    mSize++;
+    return true;
+}
+
+bool MacroSet::erase(const std::string &name)
+{
+    Slot &slot = mSlots[findSlot(name, HashName(name))];
+    if (!slot.macro)
+    {
+        return false;
+    }
+
+    slot.macro.reset();
+    slot.removed = true;
+    mSize--;
+    mRemovedCount++;
+    return true;
+}
+
+size_t MacroSet::findSlot(const std::string &name, size_t hash) const
+{
+    size_t mask      = mSlots.size() - 1;
+    size_t slotIndex = hash & mask;
+    while (true)
+    {
+        const Slot &slot = mSlots[slotIndex];
+        if (slot.macro)
+        {
+            if (slot.hash == hash && slot.macro->name == name)
+            {
+                return slotIndex;
+            }
+        }
+        else if (!slot.removed)
+        {
+            return slotIndex;
+        }
+        slotIndex = (slotIndex + 1) & mask;
+    }
+}
+
+void MacroSet::rehash(size_t slotCount)
+{
+    ASSERT((slotCount & (slotCount - 1)) == 0);
+
+    std::vector<Slot> oldSlots(slotCount);
+    oldSlots.swap(mSlots);
+    mRemovedCount = 0;
+
+    size_t mask = slotCount - 1;
+    for (Slot &oldSlot : oldSlots)
+    {
+        if (!oldSlot.macro)
+        {
+            continue;
+        }
+
+        size_t slotIndex = oldSlot.hash & mask;
+        while (mSlots[slotIndex].macro)
+        {
+            slotIndex = (slotIndex + 1) & mask;
+        }
+        mSlots[slotIndex].hash = oldSlot.hash;
+        mSlots[slotIndex].macro.swap(oldSlot.macro);
+    }
+}
+
 void PredefineMacro(MacroSet *macroSet, const char *name, int value)
 {
     Token token;
@@ -41,7 +168,9 @@ void PredefineMacro(MacroSet *macroSet, const char *name, int value)
     macro->name                  = name;
     macro->replacements.push_back(token);
 
-    (*macroSet)[name] = macro;
+    // Predefining a macro again replaces its value, as is done for __VERSION__.
+    macroSet->erase(macro->name);
+    macroSet->insert(macro);
 }
 
 }  // namespace pp
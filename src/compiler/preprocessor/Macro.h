@@ -7,11 +7,12 @@
 #ifndef COMPILER_PREPROCESSOR_MACRO_H_
 #define COMPILER_PREPROCESSOR_MACRO_H_
 
-#include <map>
 #include <memory>
 #include <string>
 #include <vector>
 
+#include "common/angleutils.h"
+
 namespace angle
 {
 
@@ -42,9 +43,53 @@ struct Macro
     std::string name;
     Parameters parameters;
     Replacements replacements;
+
+    // For each replacement token of a function-like macro, the index of the parameter it names, or
+    // -1. Macros are expanded far more often than they are defined, so this is found once when the
+    // macro is defined.
+    std::vector<int> replacementParameters;
 };
 
-typedef std::map<std::string, std::shared_ptr<Macro>> MacroSet;
+// Every identifier the preprocessor sees is looked up in the macro set, so it is an open-addressed
+// table rather than a tree. Names are stored once, in the macro itself, and each slot keeps the
+// hash of the name so that most probes don't compare strings.
+class MacroSet final : angle::NonCopyable
+{
+  public:
+    MacroSet();
+    ~MacroSet();
+
+    // Returns nullptr if there is no macro with this name. The pointer is invalidated when the set
+    // changes.
+    const std::shared_ptr<Macro> *find(const std::string &name) const;
+    bool contains(const std::string &name) const { return find(name) != nullptr; }
+
+    // Returns false and leaves the set unchanged if there already is a macro with the same name.
+    bool insert(const std::shared_ptr<Macro> &macro);
+
+    // Returns false if there is no macro with this name.
+    bool erase(const std::string &name);
+
+    size_t size() const { return mSize; }
+
+  private:
+    struct Slot
+    {
+        Slot();
+
+        size_t hash;
+        bool removed;
+        std::shared_ptr<Macro> macro;
+    };
+
+    // Returns the slot holding the name, or the empty slot which ends its probe sequence.
+    size_t findSlot(const std::string &name, size_t hash) const;
+    void rehash(size_t slotCount);
+
+    std::vector<Slot> mSlots;
+    size_t mSize;
+    size_t mRemovedCount;
+};
 
 void PredefineMacro(MacroSet *macroSet, const char *name, int value);
 
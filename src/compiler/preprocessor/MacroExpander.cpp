@@ -6,8 +6,6 @@
 
 #include "compiler/preprocessor/MacroExpander.h"
 
-#include <algorithm>
-
 #include "common/debug.h"
 #include "compiler/preprocessor/DiagnosticsBase.h"
 #include "compiler/preprocessor/Token.h"
@@ -103,6 +101,10 @@ MacroExpander::~MacroExpander()
     {
         delete context;
     }
+    for (MacroContext *context : mFreeContexts)
+    {
+        delete context;
+    }
 }
 
 void MacroExpander::lex(Token *token)
@@ -117,11 +119,12 @@ void MacroExpander::lex(Token *token)
         if (token->expansionDisabled())
             break;
 
-        MacroSet::const_iterator iter = mMacroSet->find(token->text);
-        if (iter == mMacroSet->end())
+        const std::shared_ptr<Macro> *macroEntry = mMacroSet->find(token->text);
+        if (macroEntry == nullptr)
             break;
 
-        std::shared_ptr<Macro> macro = iter->second;
+        // Peeking at the next token may run a directive that changes the macro set.
+        std::shared_ptr<Macro> macro = *macroEntry;
         if (macro->disabled)
         {
             // If a particular token is not expanded, it is never expanded.
@@ -203,16 +206,17 @@ bool MacroExpander::pushMacro(std::shared_ptr<Macro> macro, const Token &identif
     ASSERT(identifier.type == Token::IDENTIFIER);
     ASSERT(identifier.text == macro->name);
 
-    std::vector<Token> replacements;
-    if (!expandMacro(*macro, identifier, &replacements))
+    MacroContext *context = allocateContext();
+    if (!expandMacro(*macro, identifier, &context->replacements))
+    {
+        releaseContext(context);
         return false;
+    }
 
     // Macro is disabled for expansion until it is popped off the stack.
     macro->disabled = true;
 
-    MacroContext *context = new MacroContext;
-    context->macro        = macro;
-    context->replacements.swap(replacements);
+    context->macro = macro;
     mContextStack.push_back(context);
     mTotalTokensInContexts += context->replacements.size();
     return true;
@@ -238,15 +242,34 @@ void MacroExpander::popMacro()
     }
     context->macro->expansionCount--;
     mTotalTokensInContexts -= context->replacements.size();
-    delete context;
+    releaseContext(context);
+}
+
+MacroExpander::MacroContext *MacroExpander::allocateContext()
+{
+    if (mFreeContexts.empty())
+    {
+        return new MacroContext;
+    }
+
+    MacroContext *context = mFreeContexts.back();
+    mFreeContexts.pop_back();
+    return context;
+}
+
+void MacroExpander::releaseContext(MacroContext *context)
+{
+    // The replacement tokens are left in place. Assigning over them when the context is reused
+    // keeps the storage of their text.
+    context->macro.reset();
+    context->index = 0;
+    mFreeContexts.push_back(context);
 }
 
 bool MacroExpander::expandMacro(const Macro &macro,
                                 const Token &identifier,
                                 std::vector<Token> *replacements)
 {
-    replacements->clear();
-
     // In the case of an object-like macro, the replacement list gets its location
     // from the identifier, but in the case of a function-like macro, the replacement
     // list gets its location from the closing parenthesis of the macro invocation.
@@ -254,6 +277,7 @@ bool MacroExpander::expandMacro(const Macro &macro,
     SourceLocation replacementLocation = identifier.location;
     if (macro.type == Macro::kTypeObj)
     {
+        // Assigning over the previous contents of the list reuses their storage.
         replacements->assign(macro.replacements.begin(), macro.replacements.end());
 
         if (macro.predefined)
@@ -276,6 +300,8 @@ bool MacroExpander::expandMacro(const Macro &macro,
     else
     {
         ASSERT(macro.type == Macro::kTypeFunc);
+        replacements->clear();
+
         std::vector<MacroArg> args;
         args.reserve(macro.parameters.size());
         if (!collectMacroArgs(macro, identifier, &args, &replacementLocation))
@@ -415,6 +441,7 @@ void MacroExpander::replaceMacroParams(const Macro &macro,
                                        const std::vector<MacroArg> &args,
                                        std::vector<Token> *replacements)
 {
+    ASSERT(macro.replacementParameters.size() == macro.replacements.size());
     for (std::size_t i = 0; i < macro.replacements.size(); ++i)
     {
         if (!replacements->empty() &&
@@ -425,26 +452,15 @@ void MacroExpander::replaceMacroParams(const Macro &macro,
             return;
         }
 
-        const Token &repl = macro.replacements[i];
-        if (repl.type != Token::IDENTIFIER)
-        {
-            replacements->push_back(repl);
-            continue;
-        }
-
-        // TODO(alokp): Optimize this.
-        // There is no need to search for macro params every time.
-        // The param index can be cached with the replacement token.
-        Macro::Parameters::const_iterator iter =
-            std::find(macro.parameters.begin(), macro.parameters.end(), repl.text);
-        if (iter == macro.parameters.end())
+        const Token &repl  = macro.replacements[i];
+        int parameterIndex = macro.replacementParameters[i];
+        if (parameterIndex < 0)
         {
             replacements->push_back(repl);
             continue;
         }
 
-        std::size_t iArg    = std::distance(macro.parameters.begin(), iter);
-        const MacroArg &arg = args[iArg];
+        const MacroArg &arg = args[parameterIndex];
         if (arg.empty())
         {
             continue;
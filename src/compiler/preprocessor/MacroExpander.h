@@ -65,12 +65,18 @@ class MacroExpander : public Lexer
         std::vector<Token> replacements;
     };
 
+    MacroContext *allocateContext();
+    void releaseContext(MacroContext *context);
+
     Lexer *mLexer;
     MacroSet *mMacroSet;
     Diagnostics *mDiagnostics;
 
     std::unique_ptr<Token> mReserveToken;
     std::vector<MacroContext *> mContextStack;
+    // Contexts popped off the stack are kept for reuse along with the storage of their replacement
+    // lists, so that expanding a macro usually doesn't allocate.
+    std::vector<MacroContext *> mFreeContexts;
     size_t mTotalTokensInContexts;
 
     int mAllowedMacroExpansionDepth;
@@ -8,16 +8,26 @@
 #include "angle_gl.h"
 #include "compiler/translator/StaticType.h"
 #include "compiler/translator/Symbol.h"
-#include "compiler/translator/tree_util/IntermTraverse.h"
+#include "compiler/translator/tree_util/TreePassManager.h"
 
 namespace sh
 {
 
-class BuiltInFunctionEmulator::BuiltInFunctionEmulationMarker : public TIntermTraverser
+namespace
+{
+
+// The marker only sets flags on the function calls it visits.
+constexpr TreePass::Requirements kEmulationMarkerRequirements = {
+    TreePass::Effect::CHANGES_IN_PRE_VISIT, TreePass::kUnary | TreePass::kAggregate,
+    TreePass::kUnary | TreePass::kAggregate};
+
+}  // anonymous namespace
+
+class BuiltInFunctionEmulator::BuiltInFunctionEmulationMarker : public TreePass
 {
   public:
     BuiltInFunctionEmulationMarker(BuiltInFunctionEmulator &emulator)
-        : TIntermTraverser(true, false, false), mEmulator(emulator)
+        : TreePass(true, false, nullptr, kEmulationMarkerRequirements), mEmulator(emulator)
     {
     }
 
@@ -144,6 +154,16 @@ void BuiltInFunctionEmulator::markBuiltInFunctionsForEmulation(TIntermNode *root
     root->traverse(&marker);
 }
 
+void BuiltInFunctionEmulator::markBuiltInFunctionsForEmulation(TreePassManager *passes)
+{
+    ASSERT(passes);
+
+    if (mEmulatedFunctions.empty() && mQueryFunctions.empty())
+        return;
+
+    passes->add(new BuiltInFunctionEmulationMarker(*this));
+}
+
 void BuiltInFunctionEmulator::cleanup()
 {
     mFunctions.clear();
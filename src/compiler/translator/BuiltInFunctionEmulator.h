@@ -15,6 +15,7 @@ namespace sh
 class TIntermNode;
 class TFunction;
 class TSymbolUniqueId;
+class TreePassManager;
 
 using BuiltinQueryFunc = const char *(int);
 
@@ -29,6 +30,8 @@ class BuiltInFunctionEmulator
     BuiltInFunctionEmulator();
 
     void markBuiltInFunctionsForEmulation(TIntermNode *root);
+    // Same as above, but only adds the marking pass, to share a walk with the other passes.
+    void markBuiltInFunctionsForEmulation(TreePassManager *passes);
 
     void cleanup();
 
@@ -11,7 +11,7 @@
 #include "common/utilities.h"
 #include "compiler/translator/HashNames.h"
 #include "compiler/translator/SymbolTable.h"
-#include "compiler/translator/tree_util/IntermTraverse.h"
+#include "compiler/translator/tree_util/TreePassManager.h"
 #include "compiler/translator/util.h"
 
 namespace sh
@@ -101,9 +101,15 @@ ShaderVariable *FindVariableInInterfaceBlock(const ImmutableString &name,
     return FindVariable(name, &namedBlock->fields);
 }
 
+constexpr TreePass::Requirements kCollectVariablesRequirements = {
+    TreePass::Effect::READ_ONLY,
+    TreePass::kInvariantDeclaration | TreePass::kSymbol | TreePass::kDeclaration |
+        TreePass::kBinary,
+    0u};
+
 // Traverses the intermediate tree to collect all attributes, uniforms, varyings, fragment outputs,
 // and interface blocks.
-class CollectVariablesTraverser : public TIntermTraverser
+class CollectVariablesTraverser : public TreePass
 {
   public:
     CollectVariablesTraverser(std::vector<Attribute> *attribs,
@@ -218,7 +224,7 @@ CollectVariablesTraverser::CollectVariablesTraverser(
     TSymbolTable *symbolTable,
     GLenum shaderType,
     const TExtensionBehavior &extensionBehavior)
-    : TIntermTraverser(true, false, false, symbolTable),
+    : TreePass(true, false, symbolTable, kCollectVariablesRequirements),
       mAttribs(attribs),
       mOutputVariables(outputVariables),
       mUniforms(uniforms),
@@ -948,4 +954,23 @@ void CollectVariables(TIntermBlock *root,
     root->traverse(&collect);
 }
 
+TreePass *CreateCollectVariablesPass(std::vector<Attribute> *attributes,
+                                     std::vector<OutputVariable> *outputVariables,
+                                     std::vector<Uniform> *uniforms,
+                                     std::vector<Varying> *inputVaryings,
+                                     std::vector<Varying> *outputVaryings,
+                                     std::vector<InterfaceBlock> *uniformBlocks,
+                                     std::vector<InterfaceBlock> *shaderStorageBlocks,
+                                     std::vector<InterfaceBlock> *inBlocks,
+                                     ShHashFunction64 hashFunction,
+                                     TSymbolTable *symbolTable,
+                                     GLenum shaderType,
+                                     const TExtensionBehavior &extensionBehavior)
+{
+    return new CollectVariablesTraverser(attributes, outputVariables, uniforms, inputVaryings,
+                                         outputVaryings, uniformBlocks, shaderStorageBlocks,
+                                         inBlocks, hashFunction, symbolTable, shaderType,
+                                         extensionBehavior);
+}
+
 }  // namespace sh
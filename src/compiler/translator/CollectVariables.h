@@ -17,6 +17,7 @@ namespace sh
 
 class TIntermBlock;
 class TSymbolTable;
+class TreePass;
 
 void CollectVariables(TIntermBlock *root,
                       std::vector<Attribute> *attributes,
@@ -31,6 +32,20 @@ void CollectVariables(TIntermBlock *root,
                       TSymbolTable *symbolTable,
                       GLenum shaderType,
                       const TExtensionBehavior &extensionBehavior);
+
+// Same as above, for running with TreePassManager.
+TreePass *CreateCollectVariablesPass(std::vector<Attribute> *attributes,
+                                     std::vector<OutputVariable> *outputVariables,
+                                     std::vector<Uniform> *uniforms,
+                                     std::vector<Varying> *inputVaryings,
+                                     std::vector<Varying> *outputVaryings,
+                                     std::vector<InterfaceBlock> *uniformBlocks,
+                                     std::vector<InterfaceBlock> *shaderStorageBlocks,
+                                     std::vector<InterfaceBlock> *inBlocks,
+                                     ShHashFunction64 hashFunction,
+                                     TSymbolTable *symbolTable,
+                                     GLenum shaderType,
+                                     const TExtensionBehavior &extensionBehavior);
 }
 
 #endif  // COMPILER_TRANSLATOR_COLLECTVARIABLES_H_
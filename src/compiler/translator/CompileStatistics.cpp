@@ -0,0 +1,78 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CompileStatistics.cpp: Records the time, AST nodes and pool memory spent in each phase of a
+//   compile, see SH_COLLECT_COMPILE_STATISTICS.
+//
+
+#include "compiler/translator/CompileStatistics.h"
+
+#include "compiler/translator/PoolAlloc.h"
+#include "compiler/translator/tree_util/IntermTraverse.h"
+
+namespace sh
+{
+
+CompileStatistics::CompileStatistics(const TPoolAllocator *allocator)
+    : mAllocator(allocator),
+      mEnabled(false),
+      mCurrentName(nullptr),
+      mNodesVisited(0),
+      mStartPoolBytes(0),
+      mStartPoolPages(0)
+{
+}
+
+CompileStatistics::~CompileStatistics()
+{
+    ASSERT(mCurrentName == nullptr);
+}
+
+void CompileStatistics::reset(bool enabled)
+{
+    ASSERT(mCurrentName == nullptr);
+    mEnabled = enabled;
+    mPhases.clear();
+}
+
+void CompileStatistics::beginPhaseImpl(const char *name)
+{
+    ASSERT(name);
+    endPhaseImpl();
+
+    mCurrentName    = name;
+    mNodesVisited   = 0;
+    mStartPoolBytes = mAllocator->getUsedBytes();
+    mStartPoolPages = mAllocator->getUsedPageCount();
+    SetTraversalNodeCounter(&mNodesVisited);
+    mStartTime = std::chrono::steady_clock::now();
+}
+
+void CompileStatistics::endPhaseImpl()
+{
+    if (mCurrentName == nullptr)
+    {
+        return;
+    }
+
+    std::chrono::duration<double> wallTime = std::chrono::steady_clock::now() - mStartTime;
+    SetTraversalNodeCounter(nullptr);
+
+    // Memory the phase popped doesn't make the usage negative.
+    size_t poolBytes = mAllocator->getUsedBytes();
+    size_t poolPages = mAllocator->getUsedPageCount();
+
+    CompilePhaseStatistics phase;
+    phase.name            = mCurrentName;
+    phase.wallTimeSeconds = wallTime.count();
+    phase.nodesVisited    = mNodesVisited;
+    phase.poolBytes       = poolBytes > mStartPoolBytes ? poolBytes - mStartPoolBytes : 0u;
+    phase.poolPages       = poolPages > mStartPoolPages ? poolPages - mStartPoolPages : 0u;
+    mPhases.push_back(phase);
+
+    mCurrentName = nullptr;
+}
+
+}  // namespace sh
@@ -0,0 +1,73 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CompileStatistics.h: Records the time, AST nodes and pool memory spent in each phase of a
+//   compile, see SH_COLLECT_COMPILE_STATISTICS.
+//
+
+#ifndef COMPILER_TRANSLATOR_COMPILESTATISTICS_H_
+#define COMPILER_TRANSLATOR_COMPILESTATISTICS_H_
+
+#include <chrono>
+#include <vector>
+
+#include "GLSLANG/ShaderLang.h"
+#include "common/angleutils.h"
+
+class TPoolAllocator;
+
+namespace sh
+{
+
+class CompileStatistics : angle::NonCopyable
+{
+  public:
+    // Pool memory is counted from the allocator the compiler uses.
+    explicit CompileStatistics(const TPoolAllocator *allocator);
+    ~CompileStatistics();
+
+    // Drops the phases of the previous compile. Phases are only recorded if enabled.
+    void reset(bool enabled);
+
+    // Ends the current phase, if any, and starts the next one. The name must be a literal.
+    void beginPhase(const char *name)
+    {
+        if (mEnabled)
+        {
+            beginPhaseImpl(name);
+        }
+    }
+
+    // Ends the current phase, if any. Must be called before the pool allocator used by the compile
+    // is popped.
+    void endPhase()
+    {
+        if (mEnabled)
+        {
+            endPhaseImpl();
+        }
+    }
+
+    const std::vector<CompilePhaseStatistics> &getPhases() const { return mPhases; }
+
+  private:
+    void beginPhaseImpl(const char *name);
+    void endPhaseImpl();
+
+    const TPoolAllocator *mAllocator;
+    bool mEnabled;
+    std::vector<CompilePhaseStatistics> mPhases;
+
+    // The phase being recorded.
+    const char *mCurrentName;
+    std::chrono::steady_clock::time_point mStartTime;
+    size_t mNodesVisited;
+    size_t mStartPoolBytes;
+    size_t mStartPoolPages;
+};
+
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_COMPILESTATISTICS_H_
@@ -16,6 +16,7 @@
 #include "compiler/translator/IsASTDepthBelowLimit.h"
 #include "compiler/translator/OutputTree.h"
 #include "compiler/translator/ParseContext.h"
+#include "compiler/translator/TranslationCache.h"
 #include "compiler/translator/ValidateLimitations.h"
 #include "compiler/translator/ValidateMaxParameters.h"
 #include "compiler/translator/ValidateOutputs.h"
@@ -174,9 +175,10 @@ namespace
 class TScopedPoolAllocator
 {
   public:
-    TScopedPoolAllocator(TPoolAllocator *allocator) : mAllocator(allocator)
+    TScopedPoolAllocator(TPoolAllocator *allocator, size_t growthIncrement)
+        : mAllocator(allocator)
     {
-        mAllocator->push();
+        mAllocator->push(growthIncrement);
         SetGlobalPoolAllocator(mAllocator);
     }
     ~TScopedPoolAllocator()
@@ -298,6 +300,7 @@ TCompiler::TCompiler(sh::GLenum type, ShShaderSpec spec, ShShaderOutput output)
       fragmentPrecisionHigh(false),
       clampingStrategy(SH_CLAMP_WITH_CLAMP_INTRINSIC),
       builtInFunctionEmulator(),
+      mStatistics(&allocator),
       mDiagnostics(infoSink.info),
       mSourcePath(nullptr),
       mComputeShaderLocalSizeDeclared(false),
@@ -352,6 +355,7 @@ TIntermBlock *TCompiler::compileTreeForTesting(const char *const shaderStrings[]
                                                size_t numStrings,
                                                ShCompileOptions compileOptions)
 {
+    mStatistics.reset(false);
     return compileTreeImpl(shaderStrings, numStrings, compileOptions);
 }
 
@@ -386,6 +390,7 @@ TIntermBlock *TCompiler::compileTreeImpl(const char *const shaderStrings[],
     ASSERT(symbolTable.atGlobalLevel());
 
     // Parse shader.
+    mStatistics.beginPhase("Parse");
     if (PaParseStrings(numStrings - firstSource, &shaderStrings[firstSource], nullptr,
                        &parseContext) != 0)
     {
@@ -485,6 +490,8 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
                                     const TParseContext &parseContext,
                                     ShCompileOptions compileOptions)
 {
+    mStatistics.beginPhase("Validate");
+
     // Disallow expressions deemed too complex.
     if ((compileOptions & SH_LIMIT_EXPRESSION_COMPLEXITY) && !limitExpressionComplexity(root))
     {
@@ -504,6 +511,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     // Fold expressions that could not be folded before validation that was done as a part of
     // parsing.
+    mStatistics.beginPhase("FoldExpressions");
     FoldExpressions(root, &mDiagnostics);
     // Folding should only be able to generate warnings.
     ASSERT(mDiagnostics.numErrors() == 0);
@@ -515,9 +523,11 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     //      for float, so float literal statements would end up with no precision which is
     //      invalid ESSL.
     // After this empty declarations are not allowed in the AST.
+    mStatistics.beginPhase("PruneNoOps");
     PruneNoOps(root, &symbolTable);
 
     // Create the function DAG and check there is no recursion
+    mStatistics.beginPhase("CallDag");
     if (!initCallDag(root))
     {
         return false;
@@ -541,6 +551,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         pruneUnusedFunctions(root);
     }
 
+    mStatistics.beginPhase("ValidateInterface");
     if (shaderVersion >= 310 && !ValidateVaryingLocations(root, &mDiagnostics, shaderType))
     {
         return false;
@@ -564,6 +575,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // Clamping uniform array bounds needs to happen after validateLimitations pass.
     if (compileOptions & SH_CLAMP_INDIRECT_ARRAY_BOUNDS)
     {
+        mStatistics.beginPhase("MarkIndirectArrayBoundsForClamping");
         arrayBoundsClamper.MarkIndirectArrayBoundsForClamping(root);
     }
 
@@ -571,29 +583,41 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         parseContext.isExtensionEnabled(TExtension::OVR_multiview) &&
         getShaderType() != GL_COMPUTE_SHADER)
     {
+        mStatistics.beginPhase("DeclareAndInitBuiltinsForInstancedMultiview");
         DeclareAndInitBuiltinsForInstancedMultiview(root, mNumViews, shaderType, compileOptions,
                                                     outputType, &symbolTable);
     }
 
     // This pass might emit short circuits so keep it before the short circuit unfolding
     if (compileOptions & SH_REWRITE_DO_WHILE_LOOPS)
-        RewriteDoWhile(root, &symbolTable);
+        mTreePasses.add(CreateRewriteDoWhilePass(&symbolTable));
 
     if (compileOptions & SH_ADD_AND_TRUE_TO_LOOP_CONDITION)
-        AddAndTrueToLoopCondition(root);
+        mTreePasses.add(CreateAddAndTrueToLoopConditionPass());
 
     if (compileOptions & SH_UNFOLD_SHORT_CIRCUIT)
     {
-        UnfoldShortCircuitAST(root);
+        mTreePasses.add(CreateUnfoldShortCircuitASTPass());
     }
 
+    // The loop and short circuit workarounds share a walk over the tree, so they are a single
+    // phase in the compile statistics.
+    if (compileOptions & (SH_REWRITE_DO_WHILE_LOOPS | SH_ADD_AND_TRUE_TO_LOOP_CONDITION |
+                          SH_UNFOLD_SHORT_CIRCUIT))
+    {
+        mStatistics.beginPhase("LoopAndShortCircuitWorkarounds");
+    }
+    mTreePasses.run(root);
+
     if (compileOptions & SH_REMOVE_POW_WITH_CONSTANT_EXPONENT)
     {
+        mStatistics.beginPhase("RemovePow");
         RemovePow(root, &symbolTable);
     }
 
     if (compileOptions & SH_REGENERATE_STRUCT_NAMES)
     {
+        mStatistics.beginPhase("RegenerateStructNames");
         RegenerateStructNames gen(&symbolTable);
         root->traverse(&gen);
     }
@@ -602,6 +626,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         compileResources.EXT_draw_buffers && compileResources.MaxDrawBuffers > 1 &&
         IsExtensionEnabled(extensionBehavior, TExtension::EXT_draw_buffers))
     {
+        mStatistics.beginPhase("EmulateGLFragColorBroadcast");
         EmulateGLFragColorBroadcast(root, compileResources.MaxDrawBuffers, &outputVariables,
                                     &symbolTable, shaderVersion);
     }
@@ -613,6 +638,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // Split multi declarations and remove calls to array length().
     // Note that SimplifyLoopConditions needs to be run before any other AST transformations
     // that may need to generate new statements from loop conditions or loop expressions.
+    mStatistics.beginPhase("SimplifyLoopConditions");
     SimplifyLoopConditions(root,
                            IntermNodePatternMatcher::kMultiDeclaration |
                                IntermNodePatternMatcher::kArrayLengthMethod | simplifyScalarized,
@@ -620,13 +646,17 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     // Note that separate declarations need to be run before other AST transformations that
     // generate new statements from expressions.
+    mStatistics.beginPhase("SeparateDeclarations");
     SeparateDeclarations(root);
 
+    mStatistics.beginPhase("SplitSequenceOperator");
     SplitSequenceOperator(root, IntermNodePatternMatcher::kArrayLengthMethod | simplifyScalarized,
                           &getSymbolTable());
 
+    mStatistics.beginPhase("RemoveArrayLengthMethod");
     RemoveArrayLengthMethod(root);
 
+    mStatistics.beginPhase("RemoveUnreferencedVariables");
     RemoveUnreferencedVariables(root, &symbolTable);
 
     // In case the last case inside a switch statement is a certain type of no-op, GLSL compilers in
@@ -635,26 +665,44 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // left switch statements that only contained an empty declaration inside the final case in an
     // invalid state. Relies on that PruneNoOps and RemoveUnreferencedVariables have already been
     // run.
+    mStatistics.beginPhase("PruneEmptyCases");
     PruneEmptyCases(root);
 
     // Built-in function emulation needs to happen after validateLimitations pass.
     // TODO(jmadill): Remove global pool allocator.
+    mStatistics.beginPhase("EmulateBuiltInFunctions");
     GetGlobalPoolAllocator()->lock();
     initBuiltInFunctionEmulator(&builtInFunctionEmulator, compileOptions);
     GetGlobalPoolAllocator()->unlock();
-    builtInFunctionEmulator.markBuiltInFunctionsForEmulation(root);
+    builtInFunctionEmulator.markBuiltInFunctionsForEmulation(&mTreePasses);
 
     if (compileOptions & SH_SCALARIZE_VEC_AND_MAT_CONSTRUCTOR_ARGS)
     {
+        mTreePasses.run(root);
+        mStatistics.beginPhase("ScalarizeVecAndMatConstructorArgs");
         ScalarizeVecAndMatConstructorArgs(root, shaderType, fragmentPrecisionHigh, &symbolTable);
     }
 
-    if (shouldCollectVariables(compileOptions))
+    bool collectVariables = shouldCollectVariables(compileOptions);
+    if (collectVariables)
     {
         ASSERT(!variablesCollected);
-        CollectVariables(root, &attributes, &outputVariables, &uniforms, &inputVaryings,
-                         &outputVaryings, &uniformBlocks, &shaderStorageBlocks, &inBlocks,
-                         hashFunction, &symbolTable, shaderType, extensionBehavior);
+        mTreePasses.add(CreateCollectVariablesPass(
+            &attributes, &outputVariables, &uniforms, &inputVaryings, &outputVaryings,
+            &uniformBlocks, &shaderStorageBlocks, &inBlocks, hashFunction, &symbolTable,
+            shaderType, extensionBehavior));
+    }
+
+    // Marking built-ins for emulation and collecting variables share a walk over the tree, which is
+    // counted as collecting variables in the compile statistics.
+    if (collectVariables)
+    {
+        mStatistics.beginPhase("CollectVariables");
+    }
+    mTreePasses.run(root);
+
+    if (collectVariables)
+    {
         collectInterfaceBlocks();
         variablesCollected = true;
         if (compileOptions & SH_USE_UNUSED_STANDARD_SHARED_BLOCKS)
@@ -673,6 +721,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         }
         if (compileOptions & SH_INIT_OUTPUT_VARIABLES)
         {
+            mStatistics.beginPhase("InitializeOutputVariables");
             initializeOutputVariables(root);
         }
     }
@@ -681,6 +730,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // Otherwise, built-in invariant declarations don't apply.
     if (RemoveInvariant(shaderType, shaderVersion, outputType, compileOptions))
     {
+        mStatistics.beginPhase("RemoveInvariantDeclaration");
         RemoveInvariantDeclaration(root);
     }
 
@@ -690,6 +740,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     if (shaderType == GL_VERTEX_SHADER && !mGLPositionInitialized &&
         ((compileOptions & SH_INIT_GL_POSITION) || (outputType == SH_GLSL_COMPATIBILITY_OUTPUT)))
     {
+        mStatistics.beginPhase("InitializeGLPosition");
         initializeGLPosition(root);
         mGLPositionInitialized = true;
     }
@@ -703,11 +754,14 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     bool canUseLoopsToInitialize = !(compileOptions & SH_DONT_USE_LOOPS_TO_INITIALIZE_VARIABLES);
     bool highPrecisionSupported =
         shaderType != GL_FRAGMENT_SHADER || compileResources.FragmentPrecisionHigh;
+    mStatistics.beginPhase("DeferGlobalInitializers");
     DeferGlobalInitializers(root, initializeLocalsAndGlobals, canUseLoopsToInitialize,
                             highPrecisionSupported, &symbolTable);
 
     if (initializeLocalsAndGlobals)
     {
+        mStatistics.beginPhase("InitializeUninitializedLocals");
+
         // Initialize uninitialized local variables.
         // In some cases initializing can generate extra statements in the parent block, such as
         // when initializing nameless structs or initializing arrays in ESSL 1.00. In that case
@@ -730,24 +784,29 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (getShaderType() == GL_VERTEX_SHADER && (compileOptions & SH_CLAMP_POINT_SIZE))
     {
+        mStatistics.beginPhase("ClampPointSize");
         ClampPointSize(root, compileResources.MaxPointSize, &getSymbolTable());
     }
 
     if (getShaderType() == GL_FRAGMENT_SHADER && (compileOptions & SH_CLAMP_FRAG_DEPTH))
     {
+        mStatistics.beginPhase("ClampFragDepth");
         ClampFragDepth(root, &getSymbolTable());
     }
 
     if (compileOptions & SH_REWRITE_REPEATED_ASSIGN_TO_SWIZZLED)
     {
+        mStatistics.beginPhase("RewriteRepeatedAssignToSwizzled");
         sh::RewriteRepeatedAssignToSwizzled(root);
     }
 
     if (compileOptions & SH_REWRITE_VECTOR_SCALAR_ARITHMETIC)
     {
+        mStatistics.beginPhase("VectorizeVectorScalarArithmetic");
         VectorizeVectorScalarArithmetic(root, &getSymbolTable());
     }
 
+    mStatistics.endPhase();
     return true;
 }
 
@@ -763,6 +822,7 @@ bool TCompiler::compile(const char *const shaderStrings[],
         return true;
 
     ShCompileOptions compileOptions = compileOptionsIn;
+    mStatistics.reset((compileOptions & SH_COLLECT_COMPILE_STATISTICS) != 0);
 
     // Apply key workarounds.
     if (shouldFlattenPragmaStdglInvariantAll())
@@ -771,9 +831,38 @@ bool TCompiler::compile(const char *const shaderStrings[],
         compileOptions |= SH_FLATTEN_PRAGMA_STDGL_INVARIANT_ALL;
     }
 
-    TScopedPoolAllocator scopedAlloc(&allocator);
+    // A shader that was already translated with the same options and resources is restored from
+    // the translation cache without being parsed.
+    const bool useTranslationCache = (compileOptions & SH_CACHE_TRANSLATION) != 0;
+    TranslationKey translationKey;
+    if (useTranslationCache)
+    {
+        mStatistics.beginPhase("TranslationCache");
+        translationKey = TranslationCache::ComputeKey(shaderStrings, numStrings,
+                                                      getTranslationCacheDescription(compileOptions));
+        std::shared_ptr<const TranslationResult> cachedResult =
+            TranslationCache::GetInstance()->get(translationKey);
+        if (cachedResult)
+        {
+            clearResults();
+            if (compileOptions & SH_SOURCE_PATH)
+            {
+                mSourcePath = shaderStrings[0];
+            }
+            restoreTranslationResult(*cachedResult);
+            mStatistics.endPhase();
+            return true;
+        }
+    }
+
+    TScopedPoolAllocator scopedAlloc(&allocator, (compileOptions & SH_LARGE_POOL_PAGES)
+                                                     ? TPoolAllocator::kLargeGrowthIncrement
+                                                     : TPoolAllocator::kDefaultGrowthIncrement);
     TIntermBlock *root = compileTreeImpl(shaderStrings, numStrings, compileOptions);
 
+    // Ends the phase that failed, if any.
+    mStatistics.endPhase();
+
     if (root)
     {
         if (compileOptions & SH_INTERMEDIATE_TREE)
@@ -781,8 +870,20 @@ bool TCompiler::compile(const char *const shaderStrings[],
 
         if (compileOptions & SH_OBJECT_CODE)
         {
+            mStatistics.beginPhase("Output");
             PerformanceDiagnostics perfDiagnostics(&mDiagnostics);
             translate(root, compileOptions, &perfDiagnostics);
+            mStatistics.endPhase();
+        }
+
+        if (useTranslationCache)
+        {
+            std::shared_ptr<TranslationResult> result(new TranslationResult());
+            saveTranslationResult(result.get());
+
+            // The address of the name hashing function is only meaningful in this process.
+            TranslationCache::GetInstance()->put(translationKey, std::move(result),
+                                                 hashFunction == nullptr);
         }
 
         // The IntermNode tree doesn't need to be deleted here, since the
@@ -904,6 +1005,85 @@ void TCompiler::collectInterfaceBlocks()
     interfaceBlocks.insert(interfaceBlocks.end(), inBlocks.begin(), inBlocks.end());
 }
 
+std::string TCompiler::getTranslationCacheDescription(ShCompileOptions compileOptions) const
+{
+    // Options which don't change the translation are left out so that they don't split the cache.
+    compileOptions &=
+        ~(SH_CACHE_TRANSLATION | SH_LARGE_POOL_PAGES | SH_COLLECT_COMPILE_STATISTICS);
+
+    std::ostringstream stream;
+    stream << ANGLE_SH_VERSION << ":" << shaderType << ":" << shaderSpec << ":" << outputType
+           << ":" << compileOptions << ":" << clampingStrategy << ":"
+           << reinterpret_cast<uintptr_t>(hashFunction) << builtInResourcesString;
+    return stream.str();
+}
+
+void TCompiler::saveTranslationResult(TranslationResult *result) const
+{
+    result->objectCode    = infoSink.obj.str();
+    result->infoLog       = infoSink.info.str();
+    result->shaderVersion = shaderVersion;
+
+    result->variablesCollected  = variablesCollected;
+    result->attributes          = attributes;
+    result->outputVariables     = outputVariables;
+    result->uniforms            = uniforms;
+    result->inputVaryings       = inputVaryings;
+    result->outputVaryings      = outputVaryings;
+    result->interfaceBlocks     = interfaceBlocks;
+    result->uniformBlocks       = uniformBlocks;
+    result->shaderStorageBlocks = shaderStorageBlocks;
+    result->inBlocks            = inBlocks;
+
+    result->computeShaderLocalSizeDeclared = mComputeShaderLocalSizeDeclared;
+    result->computeShaderLocalSize         = mComputeShaderLocalSize;
+    result->numViews                       = mNumViews;
+
+    result->geometryShaderMaxVertices         = mGeometryShaderMaxVertices;
+    result->geometryShaderInvocations         = mGeometryShaderInvocations;
+    result->geometryShaderInputPrimitiveType  = mGeometryShaderInputPrimitiveType;
+    result->geometryShaderOutputPrimitiveType = mGeometryShaderOutputPrimitiveType;
+
+    result->nameMap = nameMap;
+
+    result->pragma                = mPragma;
+    result->extensionBehavior     = extensionBehavior;
+    result->glPositionInitialized = mGLPositionInitialized;
+}
+
+void TCompiler::restoreTranslationResult(const TranslationResult &result)
+{
+    infoSink.obj << result.objectCode;
+    infoSink.info << result.infoLog;
+    shaderVersion = result.shaderVersion;
+
+    variablesCollected  = result.variablesCollected;
+    attributes          = result.attributes;
+    outputVariables     = result.outputVariables;
+    uniforms            = result.uniforms;
+    inputVaryings       = result.inputVaryings;
+    outputVaryings      = result.outputVaryings;
+    interfaceBlocks     = result.interfaceBlocks;
+    uniformBlocks       = result.uniformBlocks;
+    shaderStorageBlocks = result.shaderStorageBlocks;
+    inBlocks            = result.inBlocks;
+
+    mComputeShaderLocalSizeDeclared = result.computeShaderLocalSizeDeclared;
+    mComputeShaderLocalSize         = result.computeShaderLocalSize;
+    mNumViews                       = result.numViews;
+
+    mGeometryShaderMaxVertices         = result.geometryShaderMaxVertices;
+    mGeometryShaderInvocations         = result.geometryShaderInvocations;
+    mGeometryShaderInputPrimitiveType  = result.geometryShaderInputPrimitiveType;
+    mGeometryShaderOutputPrimitiveType = result.geometryShaderOutputPrimitiveType;
+
+    nameMap = result.nameMap;
+
+    mPragma                = result.pragma;
+    extensionBehavior      = result.extensionBehavior;
+    mGLPositionInitialized = result.glPositionInitialized;
+}
+
 void TCompiler::clearResults()
 {
     arrayBoundsClamper.Cleanup();
@@ -933,6 +1113,8 @@ void TCompiler::clearResults()
 
     builtInFunctionEmulator.cleanup();
 
+    mTreePasses.resetCounts();
+
     nameMap.clear();
 
     mSourcePath     = nullptr;
@@ -18,12 +18,14 @@
 
 #include "compiler/translator/BuiltInFunctionEmulator.h"
 #include "compiler/translator/CallDAG.h"
+#include "compiler/translator/CompileStatistics.h"
 #include "compiler/translator/Diagnostics.h"
 #include "compiler/translator/ExtensionBehavior.h"
 #include "compiler/translator/HashNames.h"
 #include "compiler/translator/InfoSink.h"
 #include "compiler/translator/Pragma.h"
 #include "compiler/translator/SymbolTable.h"
+#include "compiler/translator/tree_util/TreePassManager.h"
 #include "third_party/compiler/ArrayBoundsClamper.h"
 
 namespace sh
@@ -31,6 +33,7 @@ namespace sh
 
 class TCompiler;
 class TParseContext;
+struct TranslationResult;
 #ifdef ANGLE_ENABLE_HLSL
 class TranslatorHLSL;
 #endif  // ANGLE_ENABLE_HLSL
@@ -106,6 +109,14 @@ class TCompiler : public TShHandleBase
     const sh::WorkGroupSize &getComputeShaderLocalSize() const { return mComputeShaderLocalSize; }
     int getNumViews() const { return mNumViews; }
 
+    // The number of AST passes run through the pass manager, and the number of walks over the tree
+    // they took.
+    size_t getTreePassCount() const { return mTreePasses.getPassCount(); }
+    size_t getTreeWalkCount() const { return mTreePasses.getWalkCount(); }
+
+    // The phases of the last compile, if it was run with SH_COLLECT_COMPILE_STATISTICS.
+    const CompileStatistics &getCompileStatistics() const { return mStatistics; }
+
     // Clears the results from the previous compilation.
     void clearResults();
 
@@ -190,6 +201,11 @@ class TCompiler : public TShHandleBase
     virtual bool shouldFlattenPragmaStdglInvariantAll() = 0;
     virtual bool shouldCollectVariables(ShCompileOptions compileOptions);
 
+    // Copy the results of the last compilation to and from the translation cache. Translators
+    // with results of their own must override both.
+    virtual void saveTranslationResult(TranslationResult *result) const;
+    virtual void restoreTranslationResult(const TranslationResult &result);
+
     bool wereVariablesCollected() const;
     std::vector<sh::Attribute> attributes;
     std::vector<sh::OutputVariable> outputVariables;
@@ -224,6 +240,10 @@ class TCompiler : public TShHandleBase
                                   size_t numStrings,
                                   const ShCompileOptions compileOptions);
 
+    // Describes everything besides the source that changes the translation, for the translation
+    // cache key.
+    std::string getTranslationCacheDescription(ShCompileOptions compileOptions) const;
+
     // Fetches and stores shader metadata that is not stored within the AST itself, such as shader
     // version.
     void setASTMetadata(const TParseContext &parseContext);
@@ -268,6 +288,11 @@ class TCompiler : public TShHandleBase
     ShArrayIndexClampingStrategy clampingStrategy;
     BuiltInFunctionEmulator builtInFunctionEmulator;
 
+    // Runs the AST passes that can share walks over the tree.
+    TreePassManager mTreePasses;
+
+    CompileStatistics mStatistics;
+
     // Results of compilation.
     int shaderVersion;
     TInfoSink infoSink;       // Output sink.
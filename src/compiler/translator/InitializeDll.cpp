@@ -22,11 +22,19 @@ bool InitProcess()
         return false;
     }
 
+    if (!InitializeTraversalNodeCounterIndex())
+    {
+        assert(0 && "InitProcess(): Failed to initialize the traversal node counter");
+        FreePoolIndex();
+        return false;
+    }
+
     return true;
 }
 
 void DetachProcess()
 {
+    FreeTraversalNodeCounterIndex();
     FreePoolIndex();
 }
 
@@ -10,4 +10,7 @@
 bool InitializePoolIndex();
 void FreePoolIndex();
 
+bool InitializeTraversalNodeCounterIndex();
+void FreeTraversalNodeCounterIndex();
+
 #endif  // COMPILER_TRANSLATOR_INITIALIZEGLOBALS_H_
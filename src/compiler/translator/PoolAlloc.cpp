@@ -10,12 +10,128 @@
 #include <stdio.h>
 #include <assert.h>
 
+#include <algorithm>
+
 #include "common/angleutils.h"
 #include "common/debug.h"
 #include "common/platform.h"
 #include "common/tls.h"
 #include "compiler/translator/InitializeGlobals.h"
 
+namespace
+{
+
+//
+// Pages left over by destroyed allocators, kept per thread so that taking and
+// returning a page needs no lock.  Taking a page from here is cheaper than
+// getting a fresh one from the OS, and compilers which run one after another
+// on the same thread, e.g. a worker thread, share their memory.  Pages of the
+// default and of the large growth increment have a list each.  Pages made for
+// a single oversized allocation vary in size, so they go back to the OS.
+//
+// The lists are trivially destructible, so that allocators destroyed late in
+// the life of a thread still find them.  TPageCacheOwner frees the pages when
+// the thread exits and closes the lists.
+//
+struct TFreePage
+{
+    TFreePage *next;
+};
+
+struct TFreePageList
+{
+    TFreePage *pages;
+    size_t count;
+};
+
+struct TPageCache
+{
+    TFreePageList defaultPages;
+    TFreePageList largePages;
+    bool closed;
+};
+
+// Keep up to 1MB of each page size around.
+constexpr size_t kMaxFreeDefaultPages = 128;
+constexpr size_t kMaxFreeLargePages   = 4;
+
+thread_local TPageCache PageCache = {{nullptr, 0}, {nullptr, 0}, false};
+
+void FreePageList(TFreePageList *list)
+{
+    while (list->pages)
+    {
+        TFreePage *next = list->pages->next;
+        delete[] reinterpret_cast<char *>(list->pages);
+        list->pages = next;
+    }
+    list->count = 0;
+}
+
+class TPageCacheOwner : angle::NonCopyable
+{
+  public:
+    ~TPageCacheOwner()
+    {
+        FreePageList(&PageCache.defaultPages);
+        FreePageList(&PageCache.largePages);
+        PageCache.closed = true;
+    }
+};
+
+thread_local TPageCacheOwner PageCacheOwner;
+
+TFreePageList *GetFreePageList(size_t pageSize, size_t *maxCountOut)
+{
+    if (PageCache.closed)
+        return nullptr;
+
+    switch (pageSize)
+    {
+        case TPoolAllocator::kDefaultGrowthIncrement:
+            *maxCountOut = kMaxFreeDefaultPages;
+            return &PageCache.defaultPages;
+        case TPoolAllocator::kLargeGrowthIncrement:
+            *maxCountOut = kMaxFreeLargePages;
+            return &PageCache.largePages;
+        default:
+            return nullptr;
+    }
+}
+
+void *AcquireCachedPage(size_t pageSize)
+{
+    size_t maxCount     = 0;
+    TFreePageList *list = GetFreePageList(pageSize, &maxCount);
+    if (!list || !list->pages)
+        return nullptr;
+
+    TFreePage *page = list->pages;
+    list->pages     = page->next;
+    --list->count;
+    return page;
+}
+
+// Returns false if the page can't be cached, in which case the caller must free it.
+bool ReleaseCachedPage(void *memory, size_t pageSize)
+{
+    size_t maxCount     = 0;
+    TFreePageList *list = GetFreePageList(pageSize, &maxCount);
+    if (!list || list->count >= maxCount)
+        return false;
+
+    // Makes sure the pages are freed when the thread exits.
+    (void)&PageCacheOwner;
+
+    TFreePage *page = reinterpret_cast<TFreePage *>(memory);
+    page->next      = list->pages;
+    list->pages     = page;
+    ++list->count;
+    return true;
+}
+
+}  // anonymous namespace
+
 TLSIndex PoolIndex = TLS_INVALID_INDEX;
 
 bool InitializePoolIndex()
@@ -56,8 +172,8 @@ TPoolAllocator::TPoolAllocator(int growthIncrement, int allocationAlignment)
       pageSize(growthIncrement),
       freeList(0),
       inUseList(0),
-      numCalls(0),
-      totalBytes(0),
+      inUseBytes(0),
+      inUsePageCount(0),
 #endif
       mLocked(false)
 {
@@ -82,6 +198,7 @@ TPoolAllocator::TPoolAllocator(int growthIncrement, int allocationAlignment)
     //
     if (pageSize < 4 * 1024)
         pageSize = 4 * 1024;
+    defaultPageSize = pageSize;
 
     //
     // A large currentPageOffset indicates a new page needs to
@@ -109,7 +226,7 @@ TPoolAllocator::~TPoolAllocator()
     {
         tHeader *next = inUseList->nextPage;
         inUseList->~tHeader();
-        delete[] reinterpret_cast<char *>(inUseList);
+        releasePage(inUseList);
         inUseList = next;
     }
 
@@ -120,7 +237,7 @@ TPoolAllocator::~TPoolAllocator()
     while (freeList)
     {
         tHeader *next = freeList->nextPage;
-        delete[] reinterpret_cast<char *>(freeList);
+        releasePage(freeList);
         freeList = next;
     }
 #else  // !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
@@ -177,13 +294,23 @@ void TAllocation::checkGuardBlock(unsigned char *blockMem,
 void TPoolAllocator::push()
 {
 #if !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
-    tAllocState state = {currentPageOffset, inUseList};
+    push(pageSize);
+#else  // !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
+    mStack.push_back({});
+#endif
+}
+
+void TPoolAllocator::push(size_t growthIncrement)
+{
+#if !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
+    tAllocState state = {currentPageOffset, inUseList, pageSize};
 
     mStack.push_back(state);
 
     //
     // Indicate there is no current page to allocate from.
     //
+    pageSize          = std::max(growthIncrement, defaultPageSize);
     currentPageOffset = pageSize;
 #else  // !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
     mStack.push_back({});
@@ -205,6 +332,7 @@ void TPoolAllocator::pop()
 #if !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
     tHeader *page     = mStack.back().page;
     currentPageOffset = mStack.back().offset;
+    pageSize          = mStack.back().pageSize;
 
     while (inUseList != page)
     {
@@ -212,8 +340,10 @@ void TPoolAllocator::pop()
         inUseList->~tHeader();
 
         tHeader *nextInUse = inUseList->nextPage;
-        if (inUseList->pageCount > 1)
-            delete[] reinterpret_cast<char *>(inUseList);
+        inUseBytes -= inUseList->size;
+        --inUsePageCount;
+        if (inUseList->size != defaultPageSize)
+            releasePage(inUseList);
         else
         {
             inUseList->nextPage = freeList;
@@ -242,17 +372,12 @@ void TPoolAllocator::popAll()
         pop();
 }
 
-void *TPoolAllocator::allocate(size_t numBytes)
+//
+// Called by allocate() when the allocation does not fit in the current page.
+//
+void *TPoolAllocator::allocateSlow(size_t numBytes)
 {
-    ASSERT(!mLocked);
-
 #if !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
-    //
-    // Just keep some interesting statistics.
-    //
-    ++numCalls;
-    totalBytes += numBytes;
-
     // If we are using guard blocks, all allocations are bracketed by
     // them: [guardblock][allocation][guardblock].  numBytes is how
     // much memory the caller asked for.  allocationSize is the total
@@ -263,22 +388,6 @@ void *TPoolAllocator::allocate(size_t numBytes)
     if (allocationSize < numBytes)
         return 0;
 
-    //
-    // Do the allocation, most likely case first, for efficiency.
-    // This step could be moved to be inline sometime.
-    //
-    if (allocationSize <= pageSize - currentPageOffset)
-    {
-        //
-        // Safe to allocate from currentPageOffset.
-        //
-        unsigned char *memory = reinterpret_cast<unsigned char *>(inUseList) + currentPageOffset;
-        currentPageOffset += allocationSize;
-        currentPageOffset = (currentPageOffset + alignmentMask) & ~alignmentMask;
-
-        return initializeAllocation(inUseList, memory, numBytes);
-    }
-
     if (allocationSize > pageSize - headerSkip)
     {
         //
@@ -295,8 +404,10 @@ void *TPoolAllocator::allocate(size_t numBytes)
             return 0;
 
         // Use placement-new to initialize header
-        new (memory) tHeader(inUseList, (numBytesToAlloc + pageSize - 1) / pageSize);
+        new (memory) tHeader(inUseList, numBytesToAlloc);
         inUseList = memory;
+        inUseBytes += numBytesToAlloc;
+        ++inUsePageCount;
 
         currentPageOffset = pageSize;  // make next allocation come from a new page
 
@@ -307,22 +418,15 @@ void *TPoolAllocator::allocate(size_t numBytes)
     //
     // Need a simple page to allocate from.
     //
-    tHeader *memory;
-    if (freeList)
-    {
-        memory   = freeList;
-        freeList = freeList->nextPage;
-    }
-    else
-    {
-        memory = reinterpret_cast<tHeader *>(::new char[pageSize]);
-        if (memory == 0)
-            return 0;
-    }
+    tHeader *memory = acquirePage();
+    if (memory == 0)
+        return 0;
 
     // Use placement-new to initialize header
-    new (memory) tHeader(inUseList, 1);
+    new (memory) tHeader(inUseList, pageSize);
     inUseList = memory;
+    inUseBytes += pageSize;
+    ++inUsePageCount;
 
     unsigned char *ret = reinterpret_cast<unsigned char *>(inUseList) + headerSkip;
     currentPageOffset  = (headerSkip + allocationSize + alignmentMask) & ~alignmentMask;
@@ -338,6 +442,51 @@ void *TPoolAllocator::allocate(size_t numBytes)
 #endif
 }
 
+#if !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
+TPoolAllocator::tHeader *TPoolAllocator::acquirePage()
+{
+    if (pageSize == defaultPageSize && freeList)
+    {
+        tHeader *page = freeList;
+        freeList      = freeList->nextPage;
+        return page;
+    }
+
+    void *page = AcquireCachedPage(pageSize);
+    if (page)
+        return reinterpret_cast<tHeader *>(page);
+
+    return reinterpret_cast<tHeader *>(::new char[pageSize]);
+}
+
+void TPoolAllocator::releasePage(tHeader *page)
+{
+    if (ReleaseCachedPage(page, page->size))
+        return;
+
+    delete[] reinterpret_cast<char *>(page);
+}
+#endif  // !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
+
+size_t TPoolAllocator::getUsedBytes() const
+{
+#if !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
+    // The rest of the current page is still free.
+    return inUseBytes - (pageSize - currentPageOffset);
+#else
+    return 0;
+#endif
+}
+
+size_t TPoolAllocator::getUsedPageCount() const
+{
+#if !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
+    return inUsePageCount;
+#else
+    return 0;
+#endif
+}
+
 void TPoolAllocator::lock()
 {
     ASSERT(!mLocked);
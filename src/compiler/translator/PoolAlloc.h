@@ -35,6 +35,8 @@
 #include <string.h>
 #include <vector>
 
+#include "common/debug.h"
+
 // If we are using guard blocks, we must track each indivual
 // allocation.  If we aren't using guard blocks, these
 // never get instantiated, so won't have any impact.
@@ -112,7 +114,13 @@ class TAllocation
 // Page stacks are linked together with a simple header at the beginning
 // of each allocation obtained from the underlying OS.  Multi-page allocations
 // are returned to the OS.  Individual page allocations are kept for future
-// re-use.
+// re-use.  When an allocator is destroyed, its pages of the default and of
+// the large size are handed to a cache of the current thread, so that the
+// next allocator on that thread does not have to get them from the OS again.
+//
+// An allocator is not thread-safe, but separate allocators can be used
+// concurrently on separate threads.  They share no state, and individual
+// allocations only bump a pointer.
 //
 // The "page size" used is not, nor must it match, the underlying OS
 // page size.  But, having it be about that size or equal to a set of
@@ -121,7 +129,12 @@ class TAllocation
 class TPoolAllocator
 {
   public:
-    TPoolAllocator(int growthIncrement = 8 * 1024, int allocationAlignment = 16);
+    static const int kDefaultGrowthIncrement = 8 * 1024;
+
+    // Page size for large shaders, see push(size_t).
+    static const int kLargeGrowthIncrement = 256 * 1024;
+
+    TPoolAllocator(int growthIncrement = kDefaultGrowthIncrement, int allocationAlignment = 16);
 
     //
     // Don't call the destructor just to free up the memory, call pop()
@@ -134,6 +147,13 @@ class TPoolAllocator
     //
     void push();
 
+    //
+    // Same as push(), but memory allocated until the matching pop() comes
+    // from pages of 'growthIncrement' bytes.  Large pages save page refills
+    // when translating large shaders.  They go to the page cache on pop().
+    //
+    void push(size_t growthIncrement);
+
     //
     // Call pop() to free all memory allocated since the last call to push(),
     // or if no last call to push, frees all memory since first allocation.
@@ -158,12 +178,22 @@ class TPoolAllocator
     // by calling pop(), and to not have to solve memory leak problems.
     //
 
+    //
+    // The memory allocated since the object's creation and not popped yet,
+    // and the number of pages it takes.  Memory skipped at the end of a page
+    // counts as used.
+    //
+    size_t getUsedBytes() const;
+    size_t getUsedPageCount() const;
+
     // Catch unwanted allocations.
     // TODO(jmadill): Remove this when we remove the global allocator.
     void lock();
     void unlock();
 
   private:
+    void *allocateSlow(size_t numBytes);
+
     size_t alignment;  // all returned allocations will be aligned at
                        // this granularity, which will be a power of 2
     size_t alignmentMask;
@@ -173,9 +203,9 @@ class TPoolAllocator
 
     struct tHeader
     {
-        tHeader(tHeader *nextPage, size_t pageCount)
+        tHeader(tHeader *nextPage, size_t size)
             : nextPage(nextPage),
-              pageCount(pageCount)
+              size(size)
 #ifdef GUARD_BLOCKS
               ,
               lastAllocation(0)
@@ -192,7 +222,7 @@ class TPoolAllocator
         }
 
         tHeader *nextPage;
-        size_t pageCount;
+        size_t size;  // size of the whole allocation, including this header
 #ifdef GUARD_BLOCKS
         TAllocation *lastAllocation;
 #endif
@@ -202,6 +232,7 @@ class TPoolAllocator
     {
         size_t offset;
         tHeader *page;
+        size_t pageSize;
     };
     typedef std::vector<tAllocState> tAllocStack;
 
@@ -216,6 +247,10 @@ class TPoolAllocator
         return TAllocation::offsetAllocation(memory);
     }
 
+    tHeader *acquirePage();
+    void releasePage(tHeader *page);
+
+    size_t defaultPageSize;    // size of the pages kept in freeList
     size_t pageSize;           // granularity of allocation from the OS
     size_t headerSkip;         // amount of memory to skip to make room for the
                                //      header (basically, size of header, rounded
@@ -224,9 +259,8 @@ class TPoolAllocator
     tHeader *freeList;         // list of popped memory
     tHeader *inUseList;        // list of all memory currently being used
     tAllocStack mStack;        // stack of where to allocate from, to partition pool
-
-    int numCalls;       // just an interesting statistic
-    size_t totalBytes;  // just an interesting statistic
+    size_t inUseBytes;         // size of all the pages in inUseList
+    size_t inUsePageCount;     // number of pages in inUseList
 
 #else  // !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
     std::vector<std::vector<void *>> mStack;
@@ -237,6 +271,34 @@ class TPoolAllocator
     bool mLocked;
 };
 
+inline void *TPoolAllocator::allocate(size_t numBytes)
+{
+    ASSERT(!mLocked);
+
+#if !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
+    //
+    // Do the allocation, most likely case first, for efficiency.
+    // If we are using guard blocks, allocationSize also includes
+    // them.  In release build, guardBlockSize=0 and this all gets
+    // optimized away.
+    //
+    size_t allocationSize = TAllocation::allocationSize(numBytes);
+    if (allocationSize >= numBytes && allocationSize <= pageSize - currentPageOffset)
+    {
+        //
+        // Safe to allocate from currentPageOffset.
+        //
+        unsigned char *memory = reinterpret_cast<unsigned char *>(inUseList) + currentPageOffset;
+        currentPageOffset += allocationSize;
+        currentPageOffset = (currentPageOffset + alignmentMask) & ~alignmentMask;
+
+        return initializeAllocation(inUseList, memory, numBytes);
+    }
+#endif  // !defined(ANGLE_TRANSLATOR_DISABLE_POOL_ALLOC)
+
+    return allocateSlow(numBytes);
+}
+
 //
 // There could potentially be many pools with pops happening at
 // different times.  But a simple use is to have a global pop
@@ -13,6 +13,7 @@
 
 #include "compiler/translator/Compiler.h"
 #include "compiler/translator/InitializeDll.h"
+#include "compiler/translator/TranslationCache.h"
 #include "compiler/translator/length_limits.h"
 #ifdef ANGLE_ENABLE_HLSL
 #include "compiler/translator/TranslatorHLSL.h"
@@ -359,6 +360,26 @@ void ClearResults(const ShHandle handle)
     compiler->clearResults();
 }
 
+void ConfigureTranslationCache(size_t maxMemorySizeBytes, const std::string &directory)
+{
+    TranslationCache::GetInstance()->configure(maxMemorySizeBytes, directory);
+}
+
+void ClearTranslationCache()
+{
+    TranslationCache::GetInstance()->clear();
+}
+
+const std::vector<CompilePhaseStatistics> *GetCompileStatistics(const ShHandle handle)
+{
+    TCompiler *compiler = GetCompilerFromHandle(handle);
+    if (compiler == nullptr)
+    {
+        return nullptr;
+    }
+    return &compiler->getCompileStatistics().getPhases();
+}
+
 int GetShaderVersion(const ShHandle handle)
 {
     TCompiler *compiler = GetCompilerFromHandle(handle);
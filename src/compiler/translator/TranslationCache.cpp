@@ -0,0 +1,761 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// TranslationCache.cpp: Implements the process-wide cache of translation results.
+//
+
+#include "compiler/translator/TranslationCache.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <thread>
+#include <type_traits>
+
+#include "common/debug.h"
+#include "common/third_party/base/anglebase/sha1.h"
+#include "common/third_party/smhasher/src/PMurHash.h"
+#include "common/version.h"
+
+namespace sh
+{
+
+namespace
+{
+// A cache file is a FileHeader followed by a serialized TranslationResult. Values are stored in
+// host byte order. Files written by other versions of ANGLE are never looked up, since the commit
+// hash is part of the key.
+constexpr uint32_t kFileMagic     = 0x54474E41;  // "ANGT"
+constexpr uint32_t kFormatVersion = 2;
+constexpr char kFileSuffix[]      = ".angletr";
+
+constexpr size_t kDefaultMaxMemorySize = 4 * 1024 * 1024;
+
+struct FileHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint8_t key[std::tuple_size<TranslationKey>::value];
+    uint32_t size;
+    uint32_t checksum;
+};
+
+class BlobWriter : angle::NonCopyable
+{
+  public:
+    BlobWriter(std::vector<uint8_t> *data) : mData(data) {}
+
+    template <typename T>
+    void writeInt(T value)
+    {
+        static_assert(std::is_integral<T>::value || std::is_enum<T>::value,
+                      "Only integers and enums can be written directly");
+        const uint8_t *bytes = reinterpret_cast<const uint8_t *>(&value);
+        mData->insert(mData->end(), bytes, bytes + sizeof(T));
+    }
+
+    void writeString(const std::string &value)
+    {
+        writeInt(value.size());
+        mData->insert(mData->end(), value.begin(), value.end());
+    }
+
+  private:
+    std::vector<uint8_t> *mData;
+};
+
+class BlobReader : angle::NonCopyable
+{
+  public:
+    BlobReader(const uint8_t *data, size_t size)
+        : mData(data), mSize(size), mOffset(0), mError(false)
+    {
+    }
+
+    template <typename T>
+    void readInt(T *valueOut)
+    {
+        static_assert(std::is_integral<T>::value || std::is_enum<T>::value,
+                      "Only integers and enums can be read directly");
+        if (!canRead(sizeof(T)))
+        {
+            *valueOut = T();
+            return;
+        }
+        memcpy(valueOut, mData + mOffset, sizeof(T));
+        mOffset += sizeof(T);
+    }
+
+    void readBool(bool *valueOut)
+    {
+        uint8_t value = 0;
+        readInt(&value);
+        *valueOut = value != 0;
+    }
+
+    void readString(std::string *valueOut)
+    {
+        size_t length = 0;
+        readInt(&length);
+        if (!canRead(length))
+        {
+            valueOut->clear();
+            return;
+        }
+        valueOut->assign(reinterpret_cast<const char *>(mData + mOffset), length);
+        mOffset += length;
+    }
+
+    // Reads an element count, making sure that the blob is large enough for that many elements
+    // so that corrupt data cannot trigger huge allocations.
+    size_t readCount()
+    {
+        size_t count = 0;
+        readInt(&count);
+        if (count > mSize - mOffset)
+        {
+            mError = true;
+            return 0;
+        }
+        return count;
+    }
+
+    bool error() const { return mError; }
+    bool endOfBlob() const { return mOffset == mSize; }
+
+  private:
+    bool canRead(size_t size)
+    {
+        if (mError || size > mSize - mOffset)
+        {
+            mError = true;
+            return false;
+        }
+        return true;
+    }
+
+    const uint8_t *mData;
+    size_t mSize;
+    size_t mOffset;
+    bool mError;
+};
+
+void WriteShaderVariable(BlobWriter *writer, const ShaderVariable &var)
+{
+    writer->writeInt(var.type);
+    writer->writeInt(var.precision);
+    writer->writeString(var.name);
+    writer->writeString(var.mappedName);
+    writer->writeInt(var.arraySizes.size());
+    for (unsigned int arraySize : var.arraySizes)
+    {
+        writer->writeInt(arraySize);
+    }
+    writer->writeInt(var.flattenedOffsetInParentArrays);
+    writer->writeInt<uint8_t>(var.staticUse);
+    writer->writeInt<uint8_t>(var.active);
+    writer->writeInt(var.fields.size());
+    for (const ShaderVariable &field : var.fields)
+    {
+        WriteShaderVariable(writer, field);
+    }
+    writer->writeString(var.structName);
+}
+
+void ReadShaderVariable(BlobReader *reader, ShaderVariable *var)
+{
+    reader->readInt(&var->type);
+    reader->readInt(&var->precision);
+    reader->readString(&var->name);
+    reader->readString(&var->mappedName);
+    var->arraySizes.resize(reader->readCount());
+    for (unsigned int &arraySize : var->arraySizes)
+    {
+        reader->readInt(&arraySize);
+    }
+    reader->readInt(&var->flattenedOffsetInParentArrays);
+    reader->readBool(&var->staticUse);
+    reader->readBool(&var->active);
+    var->fields.resize(reader->readCount());
+    for (ShaderVariable &field : var->fields)
+    {
+        ReadShaderVariable(reader, &field);
+    }
+    reader->readString(&var->structName);
+}
+
+void WriteVariable(BlobWriter *writer, const Attribute &var)
+{
+    WriteShaderVariable(writer, var);
+    writer->writeInt(var.location);
+}
+
+void ReadVariable(BlobReader *reader, Attribute *var)
+{
+    ReadShaderVariable(reader, var);
+    reader->readInt(&var->location);
+}
+
+void WriteVariable(BlobWriter *writer, const OutputVariable &var)
+{
+    WriteShaderVariable(writer, var);
+    writer->writeInt(var.location);
+}
+
+void ReadVariable(BlobReader *reader, OutputVariable *var)
+{
+    ReadShaderVariable(reader, var);
+    reader->readInt(&var->location);
+}
+
+void WriteVariable(BlobWriter *writer, const Uniform &var)
+{
+    WriteShaderVariable(writer, var);
+    writer->writeInt(var.location);
+    writer->writeInt(var.binding);
+    writer->writeInt(var.offset);
+    writer->writeInt<uint8_t>(var.readonly);
+    writer->writeInt<uint8_t>(var.writeonly);
+}
+
+void ReadVariable(BlobReader *reader, Uniform *var)
+{
+    ReadShaderVariable(reader, var);
+    reader->readInt(&var->location);
+    reader->readInt(&var->binding);
+    reader->readInt(&var->offset);
+    reader->readBool(&var->readonly);
+    reader->readBool(&var->writeonly);
+}
+
+void WriteVariable(BlobWriter *writer, const Varying &var)
+{
+    WriteShaderVariable(writer, var);
+    writer->writeInt(var.location);
+    writer->writeInt(var.interpolation);
+    writer->writeInt<uint8_t>(var.isInvariant);
+}
+
+void ReadVariable(BlobReader *reader, Varying *var)
+{
+    ReadShaderVariable(reader, var);
+    reader->readInt(&var->location);
+    reader->readInt(&var->interpolation);
+    reader->readBool(&var->isInvariant);
+}
+
+void WriteVariable(BlobWriter *writer, const InterfaceBlockField &var)
+{
+    WriteShaderVariable(writer, var);
+    writer->writeInt<uint8_t>(var.isRowMajorLayout);
+}
+
+void ReadVariable(BlobReader *reader, InterfaceBlockField *var)
+{
+    ReadShaderVariable(reader, var);
+    reader->readBool(&var->isRowMajorLayout);
+}
+
+void WriteVariable(BlobWriter *writer, const InterfaceBlock &block);
+void ReadVariable(BlobReader *reader, InterfaceBlock *block);
+
+template <typename VarT>
+void WriteVariableList(BlobWriter *writer, const std::vector<VarT> &variables)
+{
+    writer->writeInt(variables.size());
+    for (const VarT &var : variables)
+    {
+        WriteVariable(writer, var);
+    }
+}
+
+template <typename VarT>
+void ReadVariableList(BlobReader *reader, std::vector<VarT> *variables)
+{
+    variables->resize(reader->readCount());
+    for (VarT &var : *variables)
+    {
+        ReadVariable(reader, &var);
+    }
+}
+
+void WriteVariable(BlobWriter *writer, const InterfaceBlock &block)
+{
+    writer->writeString(block.name);
+    writer->writeString(block.mappedName);
+    writer->writeString(block.instanceName);
+    writer->writeInt(block.arraySize);
+    writer->writeInt(block.layout);
+    writer->writeInt<uint8_t>(block.isRowMajorLayout);
+    writer->writeInt(block.binding);
+    writer->writeInt<uint8_t>(block.staticUse);
+    writer->writeInt<uint8_t>(block.active);
+    writer->writeInt(block.blockType);
+    WriteVariableList(writer, block.fields);
+}
+
+void ReadVariable(BlobReader *reader, InterfaceBlock *block)
+{
+    reader->readString(&block->name);
+    reader->readString(&block->mappedName);
+    reader->readString(&block->instanceName);
+    reader->readInt(&block->arraySize);
+    reader->readInt(&block->layout);
+    reader->readBool(&block->isRowMajorLayout);
+    reader->readInt(&block->binding);
+    reader->readBool(&block->staticUse);
+    reader->readBool(&block->active);
+    reader->readInt(&block->blockType);
+    ReadVariableList(reader, &block->fields);
+}
+
+template <typename KeyT, typename ValueT>
+void WriteMap(BlobWriter *writer, const std::map<KeyT, ValueT> &map)
+{
+    writer->writeInt(map.size());
+    for (const auto &entry : map)
+    {
+        writer->writeString(entry.first);
+        writer->writeInt(entry.second);
+    }
+}
+
+void WriteMap(BlobWriter *writer, const NameMap &map)
+{
+    writer->writeInt(map.size());
+    for (const auto &entry : map)
+    {
+        writer->writeString(entry.first);
+        writer->writeString(entry.second);
+    }
+}
+
+void WriteMap(BlobWriter *writer, const TExtensionBehavior &map)
+{
+    writer->writeInt(map.size());
+    for (const auto &entry : map)
+    {
+        writer->writeInt(entry.first);
+        writer->writeInt(entry.second);
+    }
+}
+
+void WritePragma(BlobWriter *writer, const TPragma &pragma)
+{
+    writer->writeInt<uint8_t>(pragma.optimize);
+    writer->writeInt<uint8_t>(pragma.debug);
+    writer->writeInt<uint8_t>(pragma.debugShaderPrecision);
+    writer->writeInt<uint8_t>(pragma.stdgl.invariantAll);
+}
+
+void ReadMap(BlobReader *reader, std::map<std::string, unsigned int> *map)
+{
+    size_t count = reader->readCount();
+    for (size_t index = 0; index < count && !reader->error(); ++index)
+    {
+        std::string key;
+        reader->readString(&key);
+        reader->readInt(&(*map)[key]);
+    }
+}
+
+void ReadMap(BlobReader *reader, NameMap *map)
+{
+    size_t count = reader->readCount();
+    for (size_t index = 0; index < count && !reader->error(); ++index)
+    {
+        std::string key;
+        reader->readString(&key);
+        reader->readString(&(*map)[key]);
+    }
+}
+
+void ReadMap(BlobReader *reader, TExtensionBehavior *map)
+{
+    size_t count = reader->readCount();
+    for (size_t index = 0; index < count && !reader->error(); ++index)
+    {
+        TExtension extension = TExtension::UNDEFINED;
+        reader->readInt(&extension);
+        reader->readInt(&(*map)[extension]);
+    }
+}
+
+void ReadPragma(BlobReader *reader, TPragma *pragma)
+{
+    reader->readBool(&pragma->optimize);
+    reader->readBool(&pragma->debug);
+    reader->readBool(&pragma->debugShaderPrecision);
+    reader->readBool(&pragma->stdgl.invariantAll);
+}
+
+uint32_t ComputeChecksum(const uint8_t *data, size_t size)
+{
+    return angle::PMurHash32(0, data, static_cast<int>(size));
+}
+
+}  // anonymous namespace
+
+TranslationResult::TranslationResult()
+    : shaderVersion(100),
+      variablesCollected(false),
+      computeShaderLocalSizeDeclared(false),
+      computeShaderLocalSize(1),
+      numViews(-1),
+      geometryShaderMaxVertices(-1),
+      geometryShaderInvocations(0),
+      geometryShaderInputPrimitiveType(EptUndefined),
+      geometryShaderOutputPrimitiveType(EptUndefined),
+      glPositionInitialized(false)
+{
+}
+
+TranslationResult::~TranslationResult()
+{
+}
+
+size_t TranslationKeyHash::operator()(const TranslationKey &key) const
+{
+    // The key is already a hash.
+    size_t value = 0;
+    memcpy(&value, key.data(), sizeof(value));
+    return value;
+}
+
+TranslationCache::TranslationCache()
+    : mMaxMemorySize(kDefaultMaxMemorySize), mMemorySize(0), mHitCount(0), mMissCount(0)
+{
+}
+
+TranslationCache::~TranslationCache()
+{
+}
+
+// static
+TranslationCache *TranslationCache::GetInstance()
+{
+    // Intentionally leaked, so that compilers destroyed during shutdown can still use it.
+    static TranslationCache *instance = new TranslationCache();
+    return instance;
+}
+
+// static
+TranslationKey TranslationCache::ComputeKey(const char *const shaderStrings[],
+                                            size_t numStrings,
+                                            const std::string &compilerDescription)
+{
+    std::vector<uint8_t> keyData;
+    BlobWriter writer(&keyData);
+    writer.writeString(ANGLE_COMMIT_HASH);
+    writer.writeString(compilerDescription);
+    writer.writeInt(numStrings);
+    for (size_t index = 0; index < numStrings; ++index)
+    {
+        writer.writeString(shaderStrings[index]);
+    }
+
+    TranslationKey key;
+    angle::base::SHA1HashBytes(keyData.data(), keyData.size(), key.data());
+    return key;
+}
+
+void TranslationCache::configure(size_t maxMemorySizeBytes, const std::string &directory)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mMaxMemorySize = maxMemorySizeBytes;
+    mDirectory     = directory;
+    evictToSize(mMaxMemorySize);
+}
+
+std::shared_ptr<const TranslationResult> TranslationCache::get(const TranslationKey &key)
+{
+    std::string path;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        auto iter = mEntryMap.find(key);
+        if (iter != mEntryMap.end())
+        {
+            mEntries.splice(mEntries.begin(), mEntries, iter->second);
+            ++mHitCount;
+            return iter->second->result;
+        }
+        if (!mDirectory.empty())
+        {
+            path = getFilePath(key);
+        }
+    }
+
+    // Read the backing file without holding the lock, so that other compilers are not blocked on
+    // the file system.
+    std::shared_ptr<const TranslationResult> result;
+    if (!path.empty())
+    {
+        result = loadFile(key, path);
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (result)
+    {
+        ++mHitCount;
+    }
+    else
+    {
+        ++mMissCount;
+    }
+    return result;
+}
+
+void TranslationCache::put(const TranslationKey &key,
+                           std::shared_ptr<const TranslationResult> result,
+                           bool persistent)
+{
+    std::vector<uint8_t> blob;
+    Serialize(*result, &blob);
+
+    std::string path;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        insert(key, std::move(result), blob.size());
+        if (persistent && !mDirectory.empty())
+        {
+            path = getFilePath(key);
+        }
+    }
+
+    if (!path.empty())
+    {
+        storeFile(key, path, blob);
+    }
+}
+
+void TranslationCache::clear()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mEntries.clear();
+    mEntryMap.clear();
+    mMemorySize = 0;
+    mHitCount   = 0;
+    mMissCount  = 0;
+}
+
+size_t TranslationCache::getHitCount() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mHitCount;
+}
+
+size_t TranslationCache::getMissCount() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mMissCount;
+}
+
+size_t TranslationCache::getMemorySize() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mMemorySize;
+}
+
+// static
+void TranslationCache::Serialize(const TranslationResult &result, std::vector<uint8_t> *blobOut)
+{
+    BlobWriter writer(blobOut);
+
+    writer.writeString(result.objectCode);
+    writer.writeString(result.infoLog);
+    writer.writeInt(result.shaderVersion);
+
+    writer.writeInt<uint8_t>(result.variablesCollected);
+    WriteVariableList(&writer, result.attributes);
+    WriteVariableList(&writer, result.outputVariables);
+    WriteVariableList(&writer, result.uniforms);
+    WriteVariableList(&writer, result.inputVaryings);
+    WriteVariableList(&writer, result.outputVaryings);
+    WriteVariableList(&writer, result.interfaceBlocks);
+    WriteVariableList(&writer, result.uniformBlocks);
+    WriteVariableList(&writer, result.shaderStorageBlocks);
+    WriteVariableList(&writer, result.inBlocks);
+
+    writer.writeInt<uint8_t>(result.computeShaderLocalSizeDeclared);
+    for (size_t index = 0; index < result.computeShaderLocalSize.size(); ++index)
+    {
+        writer.writeInt(result.computeShaderLocalSize[index]);
+    }
+    writer.writeInt(result.numViews);
+
+    writer.writeInt(result.geometryShaderMaxVertices);
+    writer.writeInt(result.geometryShaderInvocations);
+    writer.writeInt(result.geometryShaderInputPrimitiveType);
+    writer.writeInt(result.geometryShaderOutputPrimitiveType);
+
+    WriteMap(&writer, result.nameMap);
+    WriteMap(&writer, result.uniformBlockRegisterMap);
+    WriteMap(&writer, result.uniformRegisterMap);
+
+    WritePragma(&writer, result.pragma);
+    WriteMap(&writer, result.extensionBehavior);
+    writer.writeInt<uint8_t>(result.glPositionInitialized);
+}
+
+// static
+bool TranslationCache::Deserialize(const uint8_t *blob, size_t size, TranslationResult *resultOut)
+{
+    BlobReader reader(blob, size);
+
+    reader.readString(&resultOut->objectCode);
+    reader.readString(&resultOut->infoLog);
+    reader.readInt(&resultOut->shaderVersion);
+
+    reader.readBool(&resultOut->variablesCollected);
+    ReadVariableList(&reader, &resultOut->attributes);
+    ReadVariableList(&reader, &resultOut->outputVariables);
+    ReadVariableList(&reader, &resultOut->uniforms);
+    ReadVariableList(&reader, &resultOut->inputVaryings);
+    ReadVariableList(&reader, &resultOut->outputVaryings);
+    ReadVariableList(&reader, &resultOut->interfaceBlocks);
+    ReadVariableList(&reader, &resultOut->uniformBlocks);
+    ReadVariableList(&reader, &resultOut->shaderStorageBlocks);
+    ReadVariableList(&reader, &resultOut->inBlocks);
+
+    reader.readBool(&resultOut->computeShaderLocalSizeDeclared);
+    for (size_t index = 0; index < resultOut->computeShaderLocalSize.size(); ++index)
+    {
+        reader.readInt(&resultOut->computeShaderLocalSize[index]);
+    }
+    reader.readInt(&resultOut->numViews);
+
+    reader.readInt(&resultOut->geometryShaderMaxVertices);
+    reader.readInt(&resultOut->geometryShaderInvocations);
+    reader.readInt(&resultOut->geometryShaderInputPrimitiveType);
+    reader.readInt(&resultOut->geometryShaderOutputPrimitiveType);
+
+    ReadMap(&reader, &resultOut->nameMap);
+    ReadMap(&reader, &resultOut->uniformBlockRegisterMap);
+    ReadMap(&reader, &resultOut->uniformRegisterMap);
+
+    ReadPragma(&reader, &resultOut->pragma);
+    ReadMap(&reader, &resultOut->extensionBehavior);
+    reader.readBool(&resultOut->glPositionInitialized);
+
+    return !reader.error() && reader.endOfBlob();
+}
+
+void TranslationCache::insert(const TranslationKey &key,
+                              std::shared_ptr<const TranslationResult> result,
+                              size_t size)
+{
+    if (size > mMaxMemorySize)
+    {
+        return;
+    }
+
+    auto iter = mEntryMap.find(key);
+    if (iter != mEntryMap.end())
+    {
+        // Another compiler translated the same shader concurrently.
+        mEntries.splice(mEntries.begin(), mEntries, iter->second);
+        return;
+    }
+
+    evictToSize(mMaxMemorySize - size);
+
+    Entry entry = {key, std::move(result), size};
+    mEntries.push_front(std::move(entry));
+    mEntryMap[key] = mEntries.begin();
+    mMemorySize += size;
+}
+
+void TranslationCache::evictToSize(size_t maxSize)
+{
+    while (mMemorySize > maxSize)
+    {
+        ASSERT(!mEntries.empty());
+        const Entry &entry = mEntries.back();
+        mMemorySize -= entry.size;
+        mEntryMap.erase(entry.key);
+        mEntries.pop_back();
+    }
+}
+
+std::string TranslationCache::getFilePath(const TranslationKey &key) const
+{
+    static const char kHexDigits[] = "0123456789abcdef";
+
+    std::string path = mDirectory + "/";
+    for (uint8_t byte : key)
+    {
+        path += kHexDigits[byte >> 4];
+        path += kHexDigits[byte & 0xF];
+    }
+    return path + kFileSuffix;
+}
+
+std::shared_ptr<const TranslationResult> TranslationCache::loadFile(const TranslationKey &key,
+                                                                    const std::string &path)
+{
+    FILE *file = fopen(path.c_str(), "rb");
+    if (!file)
+    {
+        return nullptr;
+    }
+
+    FileHeader header;
+    std::vector<uint8_t> blob;
+    bool valid = fread(&header, sizeof(header), 1, file) == 1 && header.magic == kFileMagic &&
+                 header.version == kFormatVersion &&
+                 memcmp(header.key, key.data(), key.size()) == 0;
+    if (valid)
+    {
+        blob.resize(header.size);
+        valid = fread(blob.data(), 1, blob.size(), file) == blob.size() &&
+                fgetc(file) == EOF && ComputeChecksum(blob.data(), blob.size()) == header.checksum;
+    }
+    fclose(file);
+
+    std::shared_ptr<TranslationResult> result(new TranslationResult());
+    if (!valid || !Deserialize(blob.data(), blob.size(), result.get()))
+    {
+        // Torn or corrupt file, most likely from a process that crashed while writing it.
+        remove(path.c_str());
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    insert(key, result, blob.size());
+    return result;
+}
+
+void TranslationCache::storeFile(const TranslationKey &key,
+                                 const std::string &path,
+                                 const std::vector<uint8_t> &blob)
+{
+    // Write to a file private to this thread first so that readers never see a partial file.
+    std::string tempPath =
+        path + ".tmp" + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id()));
+
+    FILE *file = fopen(tempPath.c_str(), "wb");
+    if (!file)
+    {
+        return;
+    }
+
+    FileHeader header;
+    header.magic   = kFileMagic;
+    header.version = kFormatVersion;
+    memcpy(header.key, key.data(), key.size());
+    header.size     = static_cast<uint32_t>(blob.size());
+    header.checksum = ComputeChecksum(blob.data(), blob.size());
+
+    bool written = fwrite(&header, sizeof(header), 1, file) == 1 &&
+                   fwrite(blob.data(), 1, blob.size(), file) == blob.size();
+    written      = fclose(file) == 0 && written;
+
+    if (!written || rename(tempPath.c_str(), path.c_str()) != 0)
+    {
+        remove(tempPath.c_str());
+    }
+}
+
+}  // namespace sh
@@ -0,0 +1,157 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// TranslationCache.h: Process-wide cache of translation results. Entries are keyed by a hash of
+// the shader sources, the compile options, the built-in resources and the output type, so that
+// compiling a shader that was already translated skips parsing and translation entirely. The
+// cache can be backed by a directory, in which case translations are also found by later
+// processes.
+//
+
+#ifndef COMPILER_TRANSLATOR_TRANSLATIONCACHE_H_
+#define COMPILER_TRANSLATOR_TRANSLATIONCACHE_H_
+
+#include <array>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <GLSLANG/ShaderVars.h>
+
+#include "common/angleutils.h"
+#include "compiler/translator/BaseTypes.h"
+#include "compiler/translator/ExtensionBehavior.h"
+#include "compiler/translator/HashNames.h"
+#include "compiler/translator/Pragma.h"
+
+namespace sh
+{
+
+// Everything a TCompiler reports about a successful compile.
+struct TranslationResult
+{
+    TranslationResult();
+    ~TranslationResult();
+
+    std::string objectCode;
+    std::string infoLog;
+    int shaderVersion;
+
+    bool variablesCollected;
+    std::vector<Attribute> attributes;
+    std::vector<OutputVariable> outputVariables;
+    std::vector<Uniform> uniforms;
+    std::vector<Varying> inputVaryings;
+    std::vector<Varying> outputVaryings;
+    std::vector<InterfaceBlock> interfaceBlocks;
+    std::vector<InterfaceBlock> uniformBlocks;
+    std::vector<InterfaceBlock> shaderStorageBlocks;
+    std::vector<InterfaceBlock> inBlocks;
+
+    bool computeShaderLocalSizeDeclared;
+    WorkGroupSize computeShaderLocalSize;
+    int numViews;
+
+    int geometryShaderMaxVertices;
+    int geometryShaderInvocations;
+    TLayoutPrimitiveType geometryShaderInputPrimitiveType;
+    TLayoutPrimitiveType geometryShaderOutputPrimitiveType;
+
+    NameMap nameMap;
+
+    // State left behind by the parser and the output passes.
+    TPragma pragma;
+    TExtensionBehavior extensionBehavior;
+    bool glPositionInitialized;
+
+    // Only filled by the HLSL translator.
+    std::map<std::string, unsigned int> uniformBlockRegisterMap;
+    std::map<std::string, unsigned int> uniformRegisterMap;
+};
+
+using TranslationKey = std::array<uint8_t, 20>;
+
+struct TranslationKeyHash
+{
+    size_t operator()(const TranslationKey &key) const;
+};
+
+class TranslationCache : angle::NonCopyable
+{
+  public:
+    TranslationCache();
+    ~TranslationCache();
+
+    // The cache shared by all compilers of the process.
+    static TranslationCache *GetInstance();
+
+    // Hashes the source strings with everything else that changes the output of the translator.
+    static TranslationKey ComputeKey(const char *const shaderStrings[],
+                                     size_t numStrings,
+                                     const std::string &compilerDescription);
+
+    // Sets the memory budget and the backing directory. An empty directory keeps the cache in
+    // memory only. Entries over the new budget are evicted.
+    void configure(size_t maxMemorySizeBytes, const std::string &directory);
+
+    // Returns nullptr on a miss. Entries missing from memory are looked up in the backing
+    // directory.
+    std::shared_ptr<const TranslationResult> get(const TranslationKey &key);
+
+    // Stores a translation. If |persistent| is set, it is also written to the backing directory.
+    void put(const TranslationKey &key,
+             std::shared_ptr<const TranslationResult> result,
+             bool persistent);
+
+    // Drops the entries kept in memory. Files in the backing directory are left alone.
+    void clear();
+
+    size_t getHitCount() const;
+    size_t getMissCount() const;
+    size_t getMemorySize() const;
+
+    static void Serialize(const TranslationResult &result, std::vector<uint8_t> *blobOut);
+    static bool Deserialize(const uint8_t *blob, size_t size, TranslationResult *resultOut);
+
+  private:
+    struct Entry
+    {
+        TranslationKey key;
+        std::shared_ptr<const TranslationResult> result;
+        size_t size;
+    };
+    using EntryList = std::list<Entry>;
+
+    void insert(const TranslationKey &key,
+                std::shared_ptr<const TranslationResult> result,
+                size_t size);
+    void evictToSize(size_t maxSize);
+    std::string getFilePath(const TranslationKey &key) const;
+    std::shared_ptr<const TranslationResult> loadFile(const TranslationKey &key,
+                                                      const std::string &path);
+    void storeFile(const TranslationKey &key,
+                   const std::string &path,
+                   const std::vector<uint8_t> &blob);
+
+    mutable std::mutex mMutex;
+    size_t mMaxMemorySize;
+    size_t mMemorySize;
+    std::string mDirectory;
+
+    // Most recently used entries first.
+    EntryList mEntries;
+    std::unordered_map<TranslationKey, EntryList::iterator, TranslationKeyHash> mEntryMap;
+
+    size_t mHitCount;
+    size_t mMissCount;
+};
+
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_TRANSLATIONCACHE_H_
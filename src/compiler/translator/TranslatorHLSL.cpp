@@ -7,6 +7,7 @@
 #include "compiler/translator/TranslatorHLSL.h"
 
 #include "compiler/translator/OutputHLSL.h"
+#include "compiler/translator/TranslationCache.h"
 #include "compiler/translator/tree_ops/AddDefaultReturnStatements.h"
 #include "compiler/translator/tree_ops/ArrayReturnValueToOutParameter.h"
 #include "compiler/translator/tree_ops/BreakVariableAliasingInInnerLoops.h"
@@ -142,6 +143,20 @@ bool TranslatorHLSL::shouldFlattenPragmaStdglInvariantAll()
     return false;
 }
 
+void TranslatorHLSL::saveTranslationResult(TranslationResult *result) const
+{
+    TCompiler::saveTranslationResult(result);
+    result->uniformBlockRegisterMap = mUniformBlockRegisterMap;
+    result->uniformRegisterMap      = mUniformRegisterMap;
+}
+
+void TranslatorHLSL::restoreTranslationResult(const TranslationResult &result)
+{
+    TCompiler::restoreTranslationResult(result);
+    mUniformBlockRegisterMap = result.uniformBlockRegisterMap;
+    mUniformRegisterMap      = result.uniformRegisterMap;
+}
+
 bool TranslatorHLSL::hasUniformBlock(const std::string &uniformBlockName) const
 {
     return (mUniformBlockRegisterMap.count(uniformBlockName) > 0);
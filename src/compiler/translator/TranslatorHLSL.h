@@ -32,6 +32,9 @@ class TranslatorHLSL : public TCompiler
     // collectVariables needs to be run always so registers can be assigned.
     bool shouldCollectVariables(ShCompileOptions compileOptions) override { return true; }
 
+    void saveTranslationResult(TranslationResult *result) const override;
+    void restoreTranslationResult(const TranslationResult &result) override;
+
     std::map<std::string, unsigned int> mUniformBlockRegisterMap;
     std::map<std::string, unsigned int> mUniformRegisterMap;
 };
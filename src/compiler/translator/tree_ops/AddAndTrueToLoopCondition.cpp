@@ -7,7 +7,7 @@
 #include "compiler/translator/tree_ops/AddAndTrueToLoopCondition.h"
 
 #include "compiler/translator/tree_util/IntermNode_util.h"
-#include "compiler/translator/tree_util/IntermTraverse.h"
+#include "compiler/translator/tree_util/TreePassManager.h"
 
 namespace sh
 {
@@ -15,12 +15,18 @@ namespace sh
 namespace
 {
 
+constexpr TreePass::Requirements kAddAndTrueRequirements = {
+    TreePass::Effect::CHANGES_IN_PRE_VISIT, TreePass::kLoop,
+    TreePass::kLoop | TreePass::kBinary | TreePass::kConstantUnion};
+
 // An AST traverser that rewrites for and while loops by replacing "condition" with
 // "condition && true" to work around condition bug on Intel Mac.
-class AddAndTrueToLoopConditionTraverser : public TIntermTraverser
+class AddAndTrueToLoopConditionTraverser : public TreePass
 {
   public:
-    AddAndTrueToLoopConditionTraverser() : TIntermTraverser(true, false, false) {}
+    AddAndTrueToLoopConditionTraverser() : TreePass(true, false, nullptr, kAddAndTrueRequirements)
+    {
+    }
 
     bool visitLoop(Visit, TIntermLoop *loop) override
     {
@@ -55,4 +61,9 @@ void AddAndTrueToLoopCondition(TIntermNode *root)
     root->traverse(&traverser);
 }
 
+TreePass *CreateAddAndTrueToLoopConditionPass()
+{
+    return new AddAndTrueToLoopConditionTraverser();
+}
+
 }  // namespace sh
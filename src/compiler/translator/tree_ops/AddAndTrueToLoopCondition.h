@@ -13,8 +13,13 @@ class TIntermNode;
 namespace sh
 {
 
+class TreePass;
+
 void AddAndTrueToLoopCondition(TIntermNode *root);
 
+// Same as above, for running with TreePassManager.
+TreePass *CreateAddAndTrueToLoopConditionPass();
+
 }  // namespace sh
 
 #endif  // COMPILER_TRANSLATOR_TREEOPS_ADDANDTRUETOLOOPCONDITION_H_
@@ -11,7 +11,7 @@
 
 #include "compiler/translator/StaticType.h"
 #include "compiler/translator/tree_util/IntermNode_util.h"
-#include "compiler/translator/tree_util/IntermTraverse.h"
+#include "compiler/translator/tree_util/TreePassManager.h"
 
 namespace sh
 {
@@ -19,6 +19,13 @@ namespace sh
 namespace
 {
 
+// The loops are rewritten from the pre-visit of the block that contains them.
+constexpr TreePass::Requirements kRewriteDoWhileRequirements = {
+    TreePass::Effect::CHANGES_IN_PRE_VISIT, TreePass::kBlock,
+    TreePass::kBlock | TreePass::kLoop | TreePass::kDeclaration | TreePass::kBinary |
+        TreePass::kUnary | TreePass::kIfElse | TreePass::kBranch | TreePass::kSymbol |
+        TreePass::kConstantUnion};
+
 // An AST traverser that rewrites loops of the form
 //   do {
 //     CODE;
@@ -43,10 +50,11 @@ namespace
 // TODO(cwallez) when UnfoldShortCircuitIntoIf handles loops correctly, revisit this as we might
 // be able to use while (temp || CONDITION) with temp initially set to true then run
 // UnfoldShortCircuitIntoIf
-class DoWhileRewriter : public TIntermTraverser
+class DoWhileRewriter : public TreePass
 {
   public:
-    DoWhileRewriter(TSymbolTable *symbolTable) : TIntermTraverser(true, false, false, symbolTable)
+    DoWhileRewriter(TSymbolTable *symbolTable)
+        : TreePass(true, false, symbolTable, kRewriteDoWhileRequirements)
     {
     }
 
@@ -142,4 +150,9 @@ void RewriteDoWhile(TIntermNode *root, TSymbolTable *symbolTable)
     root->traverse(&rewriter);
 }
 
+TreePass *CreateRewriteDoWhilePass(TSymbolTable *symbolTable)
+{
+    return new DoWhileRewriter(symbolTable);
+}
+
 }  // namespace sh
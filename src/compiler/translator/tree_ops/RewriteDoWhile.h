@@ -15,9 +15,13 @@ namespace sh
 
 class TIntermNode;
 class TSymbolTable;
+class TreePass;
 
 void RewriteDoWhile(TIntermNode *root, TSymbolTable *symbolTable);
 
+// Same as above, for running with TreePassManager.
+TreePass *CreateRewriteDoWhilePass(TSymbolTable *symbolTable);
+
 }  // namespace sh
 
 #endif  // COMPILER_TRANSLATOR_TREEOPS_REWRITEDOWHILE_H_
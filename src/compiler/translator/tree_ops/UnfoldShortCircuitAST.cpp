@@ -8,7 +8,7 @@
 
 #include "compiler/translator/IntermNode.h"
 #include "compiler/translator/tree_util/IntermNode_util.h"
-#include "compiler/translator/tree_util/IntermTraverse.h"
+#include "compiler/translator/tree_util/TreePassManager.h"
 
 namespace sh
 {
@@ -28,14 +28,21 @@ TIntermTernary *UnfoldAND(TIntermTyped *x, TIntermTyped *y)
     return new TIntermTernary(x, y, CreateBoolNode(false));
 }
 
+constexpr TreePass::Requirements kUnfoldShortCircuitRequirements = {
+    TreePass::Effect::QUEUES_REPLACEMENTS, TreePass::kBinary,
+    TreePass::kBinary | TreePass::kTernary | TreePass::kConstantUnion};
+
 // This traverser identifies all the short circuit binary  nodes that need to
 // be replaced, and creates the corresponding replacement nodes. However,
 // the actual replacements happen after the traverse through updateTree().
 
-class UnfoldShortCircuitASTTraverser : public TIntermTraverser
+class UnfoldShortCircuitASTTraverser : public TreePass
 {
   public:
-    UnfoldShortCircuitASTTraverser() : TIntermTraverser(true, false, false) {}
+    UnfoldShortCircuitASTTraverser()
+        : TreePass(true, false, nullptr, kUnfoldShortCircuitRequirements)
+    {
+    }
 
     bool visitBinary(Visit visit, TIntermBinary *) override;
 };
@@ -71,4 +78,9 @@ void UnfoldShortCircuitAST(TIntermBlock *root)
     traverser.updateTree();
 }
 
+TreePass *CreateUnfoldShortCircuitASTPass()
+{
+    return new UnfoldShortCircuitASTTraverser();
+}
+
 }  // namespace sh
@@ -14,9 +14,13 @@ namespace sh
 {
 
 class TIntermBlock;
+class TreePass;
 
 void UnfoldShortCircuitAST(TIntermBlock *root);
 
+// Same as above, for running with TreePassManager.
+TreePass *CreateUnfoldShortCircuitASTPass();
+
 }  // namespace sh
 
 #endif  // COMPILER_TRANSLATOR_TREEOPS_UNFOLDSHORTCIRCUITAST_H_
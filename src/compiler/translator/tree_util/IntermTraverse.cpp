@@ -6,13 +6,55 @@
 
 #include "compiler/translator/tree_util/IntermTraverse.h"
 
+#include "common/tls.h"
 #include "compiler/translator/InfoSink.h"
+#include "compiler/translator/InitializeGlobals.h"
 #include "compiler/translator/SymbolTable.h"
 #include "compiler/translator/tree_util/IntermNode_util.h"
 
+namespace
+{
+
+TLSIndex TraversalNodeCounterIndex = TLS_INVALID_INDEX;
+
+size_t *GetTraversalNodeCounter()
+{
+    // Compilers used without InitProcess() don't count nodes.
+    if (TraversalNodeCounterIndex == TLS_INVALID_INDEX)
+        return nullptr;
+
+    return static_cast<size_t *>(GetTLSValue(TraversalNodeCounterIndex));
+}
+
+}  // anonymous namespace
+
+bool InitializeTraversalNodeCounterIndex()
+{
+    ASSERT(TraversalNodeCounterIndex == TLS_INVALID_INDEX);
+
+    TraversalNodeCounterIndex = CreateTLSIndex();
+    return TraversalNodeCounterIndex != TLS_INVALID_INDEX;
+}
+
+void FreeTraversalNodeCounterIndex()
+{
+    ASSERT(TraversalNodeCounterIndex != TLS_INVALID_INDEX);
+
+    DestroyTLSIndex(TraversalNodeCounterIndex);
+    TraversalNodeCounterIndex = TLS_INVALID_INDEX;
+}
+
 namespace sh
 {
 
+void SetTraversalNodeCounter(size_t *counter)
+{
+    if (TraversalNodeCounterIndex != TLS_INVALID_INDEX)
+    {
+        SetTLSValue(TraversalNodeCounterIndex, counter);
+    }
+}
+
 void TIntermSymbol::traverse(TIntermTraverser *it)
 {
     it->traverseSymbol(this);
@@ -113,6 +155,7 @@ TIntermTraverser::TIntermTraverser(bool preVisit,
       mMaxDepth(0),
       mMaxAllowedDepth(std::numeric_limits<int>::max()),
       mInGlobalScope(true),
+      mNodeCounter(GetTraversalNodeCounter()),
       mSymbolTable(symbolTable)
 {
 }
@@ -24,6 +24,10 @@ enum Visit
     PostVisit
 };
 
+// While a counter is set for a thread, the traversers created on that thread add the number of
+// nodes they visit to it. Used to collect compile statistics.
+void SetTraversalNodeCounter(size_t *counter);
+
 // For traversing the tree.  User should derive from this class overriding the visit functions,
 // and then pass an object of the subclass to a traverse method of a node.
 //
@@ -108,6 +112,10 @@ class TIntermTraverser : angle::NonCopyable
     {
         mMaxDepth = std::max(mMaxDepth, static_cast<int>(mPath.size()));
         mPath.push_back(current);
+        if (mNodeCounter)
+        {
+            ++(*mNodeCounter);
+        }
         return mMaxDepth < mMaxAllowedDepth;
     }
 
@@ -210,6 +218,9 @@ class TIntermTraverser : angle::NonCopyable
 
     bool mInGlobalScope;
 
+    // See SetTraversalNodeCounter.
+    size_t *mNodeCounter;
+
     // During traversing, save all the changes that need to happen into
     // mReplacements/mMultiReplacements, then do them by calling updateTree().
     // Multi replacements are processed after single replacements.
@@ -218,6 +229,9 @@ class TIntermTraverser : angle::NonCopyable
     TSymbolTable *mSymbolTable;
 
   private:
+    // Forwards the visits of a single walk to several traversers.
+    friend class TreePassManager;
+
     // To insert multiple nodes into the parent block.
     struct NodeInsertMultipleEntry
     {
@@ -0,0 +1,355 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// TreePassManager.cpp: Runs AST passes in order, and walks the tree once for neighbouring passes
+//   that can't observe each other's changes.
+//
+
+#include "compiler/translator/tree_util/TreePassManager.h"
+
+namespace sh
+{
+
+namespace
+{
+
+constexpr int kNotSkipped = -1;
+
+}  // anonymous namespace
+
+// Forwards the visits of a single walk to several passes, in the order the passes were added. Each
+// pass sees the same path and scope as it would when walking the tree on its own. The replacements
+// the passes queue are applied together after the walk, in the order they were queued, which is
+// the order updateTree() expects them in.
+class TreePassManager::FusedTraverser : public TIntermTraverser
+{
+  public:
+    FusedTraverser(const std::vector<std::unique_ptr<TreePass>> &passes,
+                   size_t beginIndex,
+                   size_t endIndex);
+
+    void visitSymbol(TIntermSymbol *node) override
+    {
+        visitLeaf(node, &TIntermTraverser::visitSymbol);
+    }
+    void visitRaw(TIntermRaw *node) override { visitLeaf(node, &TIntermTraverser::visitRaw); }
+    void visitConstantUnion(TIntermConstantUnion *node) override
+    {
+        visitLeaf(node, &TIntermTraverser::visitConstantUnion);
+    }
+    void visitFunctionPrototype(TIntermFunctionPrototype *node) override
+    {
+        visitLeaf(node, &TIntermTraverser::visitFunctionPrototype);
+    }
+
+    bool visitSwizzle(Visit visit, TIntermSwizzle *node) override
+    {
+        return visitNode(visit, node, &TIntermTraverser::visitSwizzle, false);
+    }
+    bool visitBinary(Visit visit, TIntermBinary *node) override
+    {
+        return visitNode(visit, node, &TIntermTraverser::visitBinary, false);
+    }
+    bool visitUnary(Visit visit, TIntermUnary *node) override
+    {
+        return visitNode(visit, node, &TIntermTraverser::visitUnary, false);
+    }
+    bool visitTernary(Visit visit, TIntermTernary *node) override
+    {
+        return visitNode(visit, node, &TIntermTraverser::visitTernary, false);
+    }
+    bool visitIfElse(Visit visit, TIntermIfElse *node) override
+    {
+        return visitNode(visit, node, &TIntermTraverser::visitIfElse, false);
+    }
+    bool visitSwitch(Visit visit, TIntermSwitch *node) override
+    {
+        return visitNode(visit, node, &TIntermTraverser::visitSwitch, false);
+    }
+    bool visitCase(Visit visit, TIntermCase *node) override
+    {
+        return visitNode(visit, node, &TIntermTraverser::visitCase, false);
+    }
+    bool visitFunctionDefinition(Visit visit, TIntermFunctionDefinition *node) override
+    {
+        return visitNode(visit, node, &TIntermTraverser::visitFunctionDefinition, true);
+    }
+    bool visitAggregate(Visit visit, TIntermAggregate *node) override
+    {
+        return visitNode(visit, node, &TIntermTraverser::visitAggregate, false);
+    }
+    bool visitBlock(Visit visit, TIntermBlock *node) override
+    {
+        return visitNode(visit, node, &TIntermTraverser::visitBlock, false);
+    }
+    bool visitInvariantDeclaration(Visit visit, TIntermInvariantDeclaration *node) override
+    {
+        return visitNode(visit, node, &TIntermTraverser::visitInvariantDeclaration, false);
+    }
+    bool visitDeclaration(Visit visit, TIntermDeclaration *node) override
+    {
+        return visitNode(visit, node, &TIntermTraverser::visitDeclaration, false);
+    }
+    bool visitLoop(Visit visit, TIntermLoop *node) override
+    {
+        return visitNode(visit, node, &TIntermTraverser::visitLoop, false);
+    }
+    bool visitBranch(Visit visit, TIntermBranch *node) override
+    {
+        return visitNode(visit, node, &TIntermTraverser::visitBranch, false);
+    }
+
+  private:
+    struct PassState
+    {
+        TreePass *pass;
+        // The depth of the node whose subtree the pass doesn't want to visit, or kNotSkipped.
+        int skippedAtDepth;
+    };
+
+    template <typename NodeT>
+    void visitLeaf(NodeT *node, void (TIntermTraverser::*visitFunction)(NodeT *));
+
+    template <typename NodeT>
+    bool visitNode(Visit visit,
+                   NodeT *node,
+                   bool (TIntermTraverser::*visitFunction)(Visit, NodeT *),
+                   bool isFunctionDefinition);
+
+    void takeReplacements(TreePass *pass);
+
+    std::vector<PassState> mPassStates;
+};
+
+TreePassManager::FusedTraverser::FusedTraverser(
+    const std::vector<std::unique_ptr<TreePass>> &passes,
+    size_t beginIndex,
+    size_t endIndex)
+    : TIntermTraverser(true, false, true)
+{
+    for (size_t passIndex = beginIndex; passIndex < endIndex; ++passIndex)
+    {
+        ASSERT(!passes[passIndex]->inVisit);
+        mPassStates.push_back({passes[passIndex].get(), kNotSkipped});
+    }
+}
+
+template <typename NodeT>
+void TreePassManager::FusedTraverser::visitLeaf(NodeT *node,
+                                                void (TIntermTraverser::*visitFunction)(NodeT *))
+{
+    for (PassState &state : mPassStates)
+    {
+        if (state.skippedAtDepth != kNotSkipped)
+        {
+            continue;
+        }
+
+        TreePass *pass = state.pass;
+        pass->incrementDepth(node);
+        (pass->*visitFunction)(node);
+        pass->decrementDepth();
+        takeReplacements(pass);
+    }
+}
+
+template <typename NodeT>
+bool TreePassManager::FusedTraverser::visitNode(
+    Visit visit,
+    NodeT *node,
+    bool (TIntermTraverser::*visitFunction)(Visit, NodeT *),
+    bool isFunctionDefinition)
+{
+    int depth = getCurrentTraversalDepth();
+
+    if (visit == PreVisit)
+    {
+        bool visitChildren = false;
+        for (PassState &state : mPassStates)
+        {
+            if (state.skippedAtDepth != kNotSkipped)
+            {
+                continue;
+            }
+
+            TreePass *pass = state.pass;
+            pass->incrementDepth(node);
+            bool passVisitsChildren = !pass->preVisit || (pass->*visitFunction)(PreVisit, node);
+            takeReplacements(pass);
+
+            if (passVisitsChildren)
+            {
+                visitChildren = true;
+                if (isFunctionDefinition)
+                {
+                    pass->mInGlobalScope = false;
+                }
+            }
+            else
+            {
+                pass->decrementDepth();
+                state.skippedAtDepth = depth;
+            }
+        }
+
+        if (!visitChildren)
+        {
+            // There won't be a post-visit to end the skips at this node.
+            for (PassState &state : mPassStates)
+            {
+                if (state.skippedAtDepth == depth)
+                {
+                    state.skippedAtDepth = kNotSkipped;
+                }
+            }
+        }
+        return visitChildren;
+    }
+
+    ASSERT(visit == PostVisit);
+    for (PassState &state : mPassStates)
+    {
+        if (state.skippedAtDepth != kNotSkipped)
+        {
+            if (state.skippedAtDepth == depth)
+            {
+                state.skippedAtDepth = kNotSkipped;
+            }
+            continue;
+        }
+
+        TreePass *pass = state.pass;
+        if (isFunctionDefinition)
+        {
+            pass->mInGlobalScope = true;
+        }
+        if (pass->postVisit)
+        {
+            (pass->*visitFunction)(PostVisit, node);
+            takeReplacements(pass);
+        }
+        pass->decrementDepth();
+    }
+    return true;
+}
+
+void TreePassManager::FusedTraverser::takeReplacements(TreePass *pass)
+{
+    ASSERT(pass->mInsertions.empty() && pass->mMultiReplacements.empty());
+    if (pass->mReplacements.empty())
+    {
+        return;
+    }
+    mReplacements.insert(mReplacements.end(), pass->mReplacements.begin(),
+                         pass->mReplacements.end());
+    pass->mReplacements.clear();
+}
+
+TreePass::TreePass(bool preVisit,
+                   bool postVisit,
+                   TSymbolTable *symbolTable,
+                   const Requirements &requirements)
+    : TIntermTraverser(preVisit, false, postVisit, symbolTable), mRequirements(requirements)
+{
+    ASSERT(requirements.effect != Effect::READ_ONLY || requirements.changedNodes == 0u);
+}
+
+TreePassManager::TreePassManager() : mPassCount(0), mWalkCount(0)
+{
+}
+
+TreePassManager::~TreePassManager()
+{
+    ASSERT(mPasses.empty());
+}
+
+void TreePassManager::add(TreePass *pass)
+{
+    ASSERT(pass);
+    mPasses.emplace_back(pass);
+}
+
+void TreePassManager::run(TIntermBlock *root)
+{
+    size_t beginIndex = 0;
+    while (beginIndex < mPasses.size())
+    {
+        // Each walk takes as many of the following passes as can share it.
+        size_t endIndex = beginIndex + 1;
+        bool canShare   = true;
+        while (canShare && endIndex < mPasses.size())
+        {
+            for (size_t passIndex = beginIndex; canShare && passIndex < endIndex; ++passIndex)
+            {
+                canShare = CanShareWalk(*mPasses[passIndex], *mPasses[endIndex]);
+            }
+            if (canShare)
+            {
+                ++endIndex;
+            }
+        }
+
+        if (endIndex - beginIndex == 1u)
+        {
+            TreePass *pass = mPasses[beginIndex].get();
+            root->traverse(pass);
+            pass->updateTree();
+        }
+        else
+        {
+            FusedTraverser fused(mPasses, beginIndex, endIndex);
+            root->traverse(&fused);
+            fused.updateTree();
+        }
+
+        ++mWalkCount;
+        beginIndex = endIndex;
+    }
+
+    mPassCount += mPasses.size();
+    mPasses.clear();
+}
+
+void TreePassManager::resetCounts()
+{
+    mPassCount = 0;
+    mWalkCount = 0;
+}
+
+// static
+bool TreePassManager::CanShareWalk(const TreePass &earlier, const TreePass &later)
+{
+    const TreePass::Requirements &first  = earlier.getRequirements();
+    const TreePass::Requirements &second = later.getRequirements();
+
+    // The earlier pass would visit nodes that the later pass already changed when it visited one
+    // of their ancestors.
+    if (second.effect == TreePass::Effect::CHANGES_IN_PRE_VISIT &&
+        (second.changedNodes & first.visitedNodes) != 0u)
+    {
+        return false;
+    }
+
+    if (first.effect == TreePass::Effect::QUEUES_REPLACEMENTS)
+    {
+        // Replacements are only made after the walk, so the later pass wouldn't see them, and any
+        // changes it makes to the replaced nodes would be lost.
+        if ((first.changedNodes & (second.visitedNodes | second.changedNodes)) != 0u)
+        {
+            return false;
+        }
+
+        // A replacement that drops a node can move its children elsewhere in the tree, which
+        // updateTree() can't account for in replacements of the children queued by another pass.
+        if (second.effect == TreePass::Effect::QUEUES_REPLACEMENTS)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+}  // namespace sh
@@ -0,0 +1,117 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// TreePassManager.h: Runs AST passes in order, and walks the tree once for neighbouring passes
+//   that can't observe each other's changes.
+//
+
+#ifndef COMPILER_TRANSLATOR_TREEUTIL_TREEPASSMANAGER_H_
+#define COMPILER_TRANSLATOR_TREEUTIL_TREEPASSMANAGER_H_
+
+#include <memory>
+#include <vector>
+
+#include "compiler/translator/tree_util/IntermTraverse.h"
+
+namespace sh
+{
+
+// A traverser that declares which nodes it visits and changes, so that it can share a walk over
+// the tree with other passes. A pass that shares a walk is only visited through its visit*()
+// functions, so it must not:
+//  - use InVisit, override traverse*() or limit the traversal depth,
+//  - insert statements in the parent block or queue multi-replacements,
+//  - change nodes outside the subtree of the node being visited.
+// A pass that runs on its own has no such restrictions.
+class TreePass : public TIntermTraverser
+{
+  public:
+    enum NodeKind : unsigned int
+    {
+        kSymbol               = 1u << 0,
+        kRaw                  = 1u << 1,
+        kConstantUnion        = 1u << 2,
+        kSwizzle              = 1u << 3,
+        kBinary               = 1u << 4,
+        kUnary                = 1u << 5,
+        kTernary              = 1u << 6,
+        kIfElse               = 1u << 7,
+        kSwitch               = 1u << 8,
+        kCase                 = 1u << 9,
+        kFunctionPrototype    = 1u << 10,
+        kFunctionDefinition   = 1u << 11,
+        kAggregate            = 1u << 12,
+        kBlock                = 1u << 13,
+        kInvariantDeclaration = 1u << 14,
+        kDeclaration          = 1u << 15,
+        kLoop                 = 1u << 16,
+        kBranch               = 1u << 17,
+        kAllNodes             = (1u << 18) - 1u,
+    };
+
+    enum class Effect
+    {
+        // The pass doesn't change the tree.
+        READ_ONLY,
+        // The pass changes the node it visits or its subtree from a pre-visit.
+        CHANGES_IN_PRE_VISIT,
+        // The pass changes the tree only through queueReplacement(), applied after the walk.
+        QUEUES_REPLACEMENTS,
+    };
+
+    struct Requirements
+    {
+        Effect effect;
+        // The kinds of nodes the pass does something with when visiting them.
+        unsigned int visitedNodes;
+        // The kinds of nodes the pass changes, creates or replaces.
+        unsigned int changedNodes;
+    };
+
+    TreePass(bool preVisit,
+             bool postVisit,
+             TSymbolTable *symbolTable,
+             const Requirements &requirements);
+
+    const Requirements &getRequirements() const { return mRequirements; }
+
+  private:
+    Requirements mRequirements;
+};
+
+class TreePassManager : angle::NonCopyable
+{
+  public:
+    TreePassManager();
+    ~TreePassManager();
+
+    // Passes are allocated from the pool, and are released at the end of run().
+    void add(TreePass *pass);
+
+    // Runs the added passes in the order they were added, with the same results as walking the
+    // tree once for each of them.
+    void run(TIntermBlock *root);
+
+    // The number of passes run and the number of walks over the tree they took, since the last
+    // resetCounts().
+    size_t getPassCount() const { return mPassCount; }
+    size_t getWalkCount() const { return mWalkCount; }
+    void resetCounts();
+
+  private:
+    class FusedTraverser;
+
+    // Whether a pass can share a walk with a pass that runs before it.
+    static bool CanShareWalk(const TreePass &earlier, const TreePass &later);
+
+    std::vector<std::unique_ptr<TreePass>> mPasses;
+
+    size_t mPassCount;
+    size_t mWalkCount;
+};
+
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_TREEUTIL_TREEPASSMANAGER_H_
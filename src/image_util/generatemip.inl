@@ -9,6 +9,7 @@
 
 #include "common/mathutil.h"
 
+#include "image_util/generatemip_simd.h"
 #include "image_util/imageformats.h"
 
 namespace angle
@@ -29,6 +30,123 @@ static inline const T *GetPixel(const uint8_t *data, size_t x, size_t y, size_t
     return reinterpret_cast<const T*>(data + (x * sizeof(T)) + (y * rowPitch) + (z * depthPitch));
 }
 
+// Vector row kernels, for the formats that have them. Each returns the number of leading pixels
+// of the destination row that it wrote.
+template <typename T>
+struct MipRowKernels
+{
+    static size_t XY(const T *row0, const T *row1, T *dest, size_t destWidth) { return 0; }
+    static size_t XYZ(const T *row00,
+                      const T *row01,
+                      const T *row10,
+                      const T *row11,
+                      T *dest,
+                      size_t destWidth)
+    {
+        return 0;
+    }
+};
+
+template <typename T, typename ComponentType>
+static inline const ComponentType *GetComponents(const T *pixels)
+{
+    return reinterpret_cast<const ComponentType *>(pixels);
+}
+
+template <typename T, typename ComponentType>
+static inline ComponentType *GetComponents(T *pixels)
+{
+    return reinterpret_cast<ComponentType *>(pixels);
+}
+
+// The formats with four 8-bit components that are averaged independently.
+template <typename T>
+struct MipRowKernelsRGBA8
+{
+    static size_t XY(const T *row0, const T *row1, T *dest, size_t destWidth)
+    {
+        return GenerateMipRowXYRGBA8(GetComponents<T, uint32_t>(row0),
+                                     GetComponents<T, uint32_t>(row1),
+                                     GetComponents<T, uint32_t>(dest), destWidth);
+    }
+    static size_t XYZ(const T *row00,
+                      const T *row01,
+                      const T *row10,
+                      const T *row11,
+                      T *dest,
+                      size_t destWidth)
+    {
+        return GenerateMipRowXYZRGBA8(
+            GetComponents<T, uint32_t>(row00), GetComponents<T, uint32_t>(row01),
+            GetComponents<T, uint32_t>(row10), GetComponents<T, uint32_t>(row11),
+            GetComponents<T, uint32_t>(dest), destWidth);
+    }
+};
+
+template <>
+struct MipRowKernels<R8G8B8A8> : MipRowKernelsRGBA8<R8G8B8A8>
+{
+};
+
+template <>
+struct MipRowKernels<B8G8R8A8> : MipRowKernelsRGBA8<B8G8R8A8>
+{
+};
+
+template <>
+struct MipRowKernels<A8R8G8B8> : MipRowKernelsRGBA8<A8R8G8B8>
+{
+};
+
+template <>
+struct MipRowKernels<R16G16B16A16F>
+{
+    using T = R16G16B16A16F;
+
+    static size_t XY(const T *row0, const T *row1, T *dest, size_t destWidth)
+    {
+        return GenerateMipRowXYRGBA16F(GetComponents<T, uint16_t>(row0),
+                                       GetComponents<T, uint16_t>(row1),
+                                       GetComponents<T, uint16_t>(dest), destWidth);
+    }
+    static size_t XYZ(const T *row00,
+                      const T *row01,
+                      const T *row10,
+                      const T *row11,
+                      T *dest,
+                      size_t destWidth)
+    {
+        return GenerateMipRowXYZRGBA16F(
+            GetComponents<T, uint16_t>(row00), GetComponents<T, uint16_t>(row01),
+            GetComponents<T, uint16_t>(row10), GetComponents<T, uint16_t>(row11),
+            GetComponents<T, uint16_t>(dest), destWidth);
+    }
+};
+
+template <>
+struct MipRowKernels<R32G32B32A32F>
+{
+    using T = R32G32B32A32F;
+
+    static size_t XY(const T *row0, const T *row1, T *dest, size_t destWidth)
+    {
+        return GenerateMipRowXYRGBA32F(GetComponents<T, float>(row0), GetComponents<T, float>(row1),
+                                       GetComponents<T, float>(dest), destWidth);
+    }
+    static size_t XYZ(const T *row00,
+                      const T *row01,
+                      const T *row10,
+                      const T *row11,
+                      T *dest,
+                      size_t destWidth)
+    {
+        return GenerateMipRowXYZRGBA32F(
+            GetComponents<T, float>(row00), GetComponents<T, float>(row01),
+            GetComponents<T, float>(row10), GetComponents<T, float>(row11),
+            GetComponents<T, float>(dest), destWidth);
+    }
+};
+
 template <typename T>
 static void GenerateMip_Y(size_t sourceWidth, size_t sourceHeight, size_t sourceDepth,
                           const uint8_t *sourceData, size_t sourceRowPitch, size_t sourceDepthPitch,
@@ -101,7 +219,12 @@ static void GenerateMip_XY(size_t sourceWidth, size_t sourceHeight, size_t sourc
 
     for (size_t y = 0; y < destHeight; y++)
     {
-        for (size_t x = 0; x < destWidth; x++)
+        size_t x = MipRowKernels<T>::XY(
+            GetPixel<T>(sourceData, 0, y * 2, 0, sourceRowPitch, sourceDepthPitch),
+            GetPixel<T>(sourceData, 0, y * 2 + 1, 0, sourceRowPitch, sourceDepthPitch),
+            GetPixel<T>(destData, 0, y, 0, destRowPitch, destDepthPitch), destWidth);
+
+        for (; x < destWidth; x++)
         {
             const T *src0 = GetPixel<T>(sourceData, x * 2, y * 2, 0, sourceRowPitch, sourceDepthPitch);
             const T *src1 = GetPixel<T>(sourceData, x * 2, y * 2 + 1, 0, sourceRowPitch, sourceDepthPitch);
@@ -190,7 +313,14 @@ static void GenerateMip_XYZ(size_t sourceWidth, size_t sourceHeight, size_t sour
     {
         for (size_t y = 0; y < destHeight; y++)
         {
-            for (size_t x = 0; x < destWidth; x++)
+            size_t x = MipRowKernels<T>::XYZ(
+                GetPixel<T>(sourceData, 0, y * 2, z * 2, sourceRowPitch, sourceDepthPitch),
+                GetPixel<T>(sourceData, 0, y * 2, z * 2 + 1, sourceRowPitch, sourceDepthPitch),
+                GetPixel<T>(sourceData, 0, y * 2 + 1, z * 2, sourceRowPitch, sourceDepthPitch),
+                GetPixel<T>(sourceData, 0, y * 2 + 1, z * 2 + 1, sourceRowPitch, sourceDepthPitch),
+                GetPixel<T>(destData, 0, y, z, destRowPitch, destDepthPitch), destWidth);
+
+            for (; x < destWidth; x++)
             {
                 const T *src0 = GetPixel<T>(sourceData, x * 2, y * 2, z * 2, sourceRowPitch, sourceDepthPitch);
                 const T *src1 = GetPixel<T>(sourceData, x * 2, y * 2, z * 2 + 1, sourceRowPitch, sourceDepthPitch);
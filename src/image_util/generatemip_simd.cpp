@@ -0,0 +1,348 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// generatemip_simd.cpp: Vectorized row kernels used by the mip generation functions.
+
+#include "image_util/generatemip_simd.h"
+
+#include "common/mathutil.h"
+#include "common/platform.h"
+#include "image_util/simd_utils.h"
+
+namespace angle
+{
+
+namespace priv
+{
+
+namespace
+{
+
+#if defined(ANGLE_USE_SSE)
+
+// Same as gl::average for each byte. _mm_avg_epu8 rounds up where the scalar average rounds down.
+inline __m128i AverageBytes(__m128i a, __m128i b)
+{
+    __m128i roundedUp = _mm_and_si128(_mm_xor_si128(a, b), _mm_set1_epi8(1));
+    return _mm_sub_epi8(_mm_avg_epu8(a, b), roundedUp);
+}
+
+// Averages the even and the odd pixels of eight consecutive RGBA8 pixels.
+inline __m128i AveragePixelPairsRGBA8(__m128i lo, __m128i hi)
+{
+    __m128i loSorted = _mm_shuffle_epi32(lo, _MM_SHUFFLE(3, 1, 2, 0));
+    __m128i hiSorted = _mm_shuffle_epi32(hi, _MM_SHUFFLE(3, 1, 2, 0));
+    return AverageBytes(_mm_unpacklo_epi64(loSorted, hiSorted),
+                        _mm_unpackhi_epi64(loSorted, hiSorted));
+}
+
+// Converts the halves in the low 16 bits of each 32-bit lane the same way as
+// gl::float16ToFloat32. Lanes with denormals, infinities or NaNs are flagged in |special|.
+inline __m128 Float16ToFloat32(__m128i halves, __m128i *special)
+{
+    __m128i abs      = _mm_and_si128(halves, _mm_set1_epi32(0x7FFF));
+    __m128i exponent = _mm_and_si128(halves, _mm_set1_epi32(0x7C00));
+    __m128i zero     = _mm_cmpeq_epi32(abs, _mm_setzero_si128());
+    __m128i denormal = _mm_andnot_si128(zero, _mm_cmpeq_epi32(exponent, _mm_setzero_si128()));
+    __m128i infinity = _mm_cmpeq_epi32(exponent, _mm_set1_epi32(0x7C00));
+    *special         = _mm_or_si128(*special, _mm_or_si128(denormal, infinity));
+
+    // Rebias the exponent from 15 to 127.
+    __m128i bits = _mm_add_epi32(_mm_slli_epi32(abs, 13), _mm_set1_epi32(112 << 23));
+    bits         = _mm_andnot_si128(zero, bits);
+    __m128i sign = _mm_slli_epi32(_mm_and_si128(halves, _mm_set1_epi32(0x8000)), 16);
+    return _mm_castsi128_ps(_mm_or_si128(bits, sign));
+}
+
+// Same as gl::averageHalfFloat for the lanes that aren't flagged in |special|.
+inline __m128i AverageHalves(__m128i a, __m128i b, __m128i *special)
+{
+    __m128 sum = _mm_add_ps(Float16ToFloat32(a, special), Float16ToFloat32(b, special));
+    __m128i denormal;
+    __m128i average =
+        Float32ToFloat16(_mm_castps_si128(_mm_mul_ps(sum, _mm_set1_ps(0.5f))), &denormal);
+    *special = _mm_or_si128(*special, denormal);
+    return average;
+}
+
+// Loads four consecutive RGBA16F pixels, with each component widened to a 32-bit lane.
+inline void LoadPixelsRGBA16F(const uint16_t *source, __m128i *pixels)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i lo         = LoadU(&source[0]);
+    __m128i hi         = LoadU(&source[8]);
+    pixels[0]          = _mm_unpacklo_epi16(lo, zero);
+    pixels[1]          = _mm_unpackhi_epi16(lo, zero);
+    pixels[2]          = _mm_unpacklo_epi16(hi, zero);
+    pixels[3]          = _mm_unpackhi_epi16(hi, zero);
+}
+
+// Averages the pairs of four consecutive RGBA16F pixels, and stores the two results.
+inline void StorePixelPairsRGBA16F(const __m128i *pixels, uint16_t *dest, __m128i *special)
+{
+    __m128i first  = AverageHalves(pixels[0], pixels[1], special);
+    __m128i second = AverageHalves(pixels[2], pixels[3], special);
+    StoreU(dest, Pack32To16(first, second));
+}
+
+// The scalar loops, for the pixels that the kernels flagged.
+void GenerateMipPixelsXYRGBA16F(const uint16_t *row0,
+                                const uint16_t *row1,
+                                uint16_t *dest,
+                                size_t begin,
+                                size_t end)
+{
+    for (size_t x = begin; x < end; x++)
+    {
+        for (size_t component = 0; component < 4; component++)
+        {
+            size_t left  = 8 * x + component;
+            size_t right = left + 4;
+            dest[4 * x + component] =
+                gl::averageHalfFloat(gl::averageHalfFloat(row0[left], row1[left]),
+                                     gl::averageHalfFloat(row0[right], row1[right]));
+        }
+    }
+}
+
+void GenerateMipPixelsXYZRGBA16F(const uint16_t *row00,
+                                 const uint16_t *row01,
+                                 const uint16_t *row10,
+                                 const uint16_t *row11,
+                                 uint16_t *dest,
+                                 size_t begin,
+                                 size_t end)
+{
+    for (size_t x = begin; x < end; x++)
+    {
+        for (size_t component = 0; component < 4; component++)
+        {
+            size_t left  = 8 * x + component;
+            size_t right = left + 4;
+            uint16_t leftAverage =
+                gl::averageHalfFloat(gl::averageHalfFloat(row00[left], row01[left]),
+                                     gl::averageHalfFloat(row10[left], row11[left]));
+            uint16_t rightAverage =
+                gl::averageHalfFloat(gl::averageHalfFloat(row00[right], row01[right]),
+                                     gl::averageHalfFloat(row10[right], row11[right]));
+            dest[4 * x + component] = gl::averageHalfFloat(leftAverage, rightAverage);
+        }
+    }
+}
+
+// Same as gl::average for each float.
+inline __m128 AverageFloats(__m128 a, __m128 b)
+{
+    return _mm_mul_ps(_mm_add_ps(a, b), _mm_set1_ps(0.5f));
+}
+
+#elif defined(ANGLE_USE_NEON)
+
+inline uint8x16_t LoadPixelsRGBA8(const uint32_t *source)
+{
+    return vreinterpretq_u8_u32(vld1q_u32(source));
+}
+
+// Averages the even and the odd pixels of eight consecutive RGBA8 pixels. vhaddq_u8 rounds down,
+// like the scalar average.
+inline uint32x4_t AveragePixelPairsRGBA8(uint8x16_t lo, uint8x16_t hi)
+{
+    uint32x4x2_t pairs = vuzpq_u32(vreinterpretq_u32_u8(lo), vreinterpretq_u32_u8(hi));
+    return vreinterpretq_u32_u8(
+        vhaddq_u8(vreinterpretq_u8_u32(pairs.val[0]), vreinterpretq_u8_u32(pairs.val[1])));
+}
+
+#endif
+
+}  // anonymous namespace
+
+size_t GenerateMipRowXYRGBA8(const uint32_t *row0,
+                             const uint32_t *row1,
+                             uint32_t *dest,
+                             size_t destWidth)
+{
+    size_t x = 0;
+#if defined(ANGLE_USE_SSE)
+    if (gl::supportsSSE2())
+    {
+        for (; x + 4 <= destWidth; x += 4)
+        {
+            __m128i lo = AverageBytes(LoadU(&row0[2 * x]), LoadU(&row1[2 * x]));
+            __m128i hi = AverageBytes(LoadU(&row0[2 * x + 4]), LoadU(&row1[2 * x + 4]));
+            StoreU(&dest[x], AveragePixelPairsRGBA8(lo, hi));
+        }
+    }
+#elif defined(ANGLE_USE_NEON)
+    for (; x + 4 <= destWidth; x += 4)
+    {
+        uint8x16_t lo = vhaddq_u8(LoadPixelsRGBA8(&row0[2 * x]), LoadPixelsRGBA8(&row1[2 * x]));
+        uint8x16_t hi =
+            vhaddq_u8(LoadPixelsRGBA8(&row0[2 * x + 4]), LoadPixelsRGBA8(&row1[2 * x + 4]));
+        vst1q_u32(&dest[x], AveragePixelPairsRGBA8(lo, hi));
+    }
+#endif
+    return x;
+}
+
+size_t GenerateMipRowXYZRGBA8(const uint32_t *row00,
+                              const uint32_t *row01,
+                              const uint32_t *row10,
+                              const uint32_t *row11,
+                              uint32_t *dest,
+                              size_t destWidth)
+{
+    size_t x = 0;
+#if defined(ANGLE_USE_SSE)
+    if (gl::supportsSSE2())
+    {
+        for (; x + 4 <= destWidth; x += 4)
+        {
+            __m128i lo = AverageBytes(AverageBytes(LoadU(&row00[2 * x]), LoadU(&row01[2 * x])),
+                                      AverageBytes(LoadU(&row10[2 * x]), LoadU(&row11[2 * x])));
+            __m128i hi =
+                AverageBytes(AverageBytes(LoadU(&row00[2 * x + 4]), LoadU(&row01[2 * x + 4])),
+                             AverageBytes(LoadU(&row10[2 * x + 4]), LoadU(&row11[2 * x + 4])));
+            StoreU(&dest[x], AveragePixelPairsRGBA8(lo, hi));
+        }
+    }
+#elif defined(ANGLE_USE_NEON)
+    for (; x + 4 <= destWidth; x += 4)
+    {
+        uint8x16_t lo =
+            vhaddq_u8(vhaddq_u8(LoadPixelsRGBA8(&row00[2 * x]), LoadPixelsRGBA8(&row01[2 * x])),
+                      vhaddq_u8(LoadPixelsRGBA8(&row10[2 * x]), LoadPixelsRGBA8(&row11[2 * x])));
+        uint8x16_t hi = vhaddq_u8(
+            vhaddq_u8(LoadPixelsRGBA8(&row00[2 * x + 4]), LoadPixelsRGBA8(&row01[2 * x + 4])),
+            vhaddq_u8(LoadPixelsRGBA8(&row10[2 * x + 4]), LoadPixelsRGBA8(&row11[2 * x + 4])));
+        vst1q_u32(&dest[x], AveragePixelPairsRGBA8(lo, hi));
+    }
+#endif
+    return x;
+}
+
+size_t GenerateMipRowXYRGBA16F(const uint16_t *row0,
+                               const uint16_t *row1,
+                               uint16_t *dest,
+                               size_t destWidth)
+{
+    size_t x = 0;
+#if defined(ANGLE_USE_SSE)
+    if (gl::supportsSSE2())
+    {
+        for (; x + 2 <= destWidth; x += 2)
+        {
+            __m128i top[4];
+            __m128i bottom[4];
+            LoadPixelsRGBA16F(&row0[8 * x], top);
+            LoadPixelsRGBA16F(&row1[8 * x], bottom);
+
+            __m128i special = _mm_setzero_si128();
+            __m128i columns[4];
+            for (size_t pixel = 0; pixel < 4; pixel++)
+            {
+                columns[pixel] = AverageHalves(top[pixel], bottom[pixel], &special);
+            }
+            StorePixelPairsRGBA16F(columns, &dest[4 * x], &special);
+
+            if (_mm_movemask_epi8(special) != 0)
+            {
+                GenerateMipPixelsXYRGBA16F(row0, row1, dest, x, x + 2);
+            }
+        }
+    }
+#endif
+    return x;
+}
+
+size_t GenerateMipRowXYZRGBA16F(const uint16_t *row00,
+                                const uint16_t *row01,
+                                const uint16_t *row10,
+                                const uint16_t *row11,
+                                uint16_t *dest,
+                                size_t destWidth)
+{
+    size_t x = 0;
+#if defined(ANGLE_USE_SSE)
+    if (gl::supportsSSE2())
+    {
+        for (; x + 2 <= destWidth; x += 2)
+        {
+            __m128i pixels00[4];
+            __m128i pixels01[4];
+            __m128i pixels10[4];
+            __m128i pixels11[4];
+            LoadPixelsRGBA16F(&row00[8 * x], pixels00);
+            LoadPixelsRGBA16F(&row01[8 * x], pixels01);
+            LoadPixelsRGBA16F(&row10[8 * x], pixels10);
+            LoadPixelsRGBA16F(&row11[8 * x], pixels11);
+
+            __m128i special = _mm_setzero_si128();
+            __m128i columns[4];
+            for (size_t pixel = 0; pixel < 4; pixel++)
+            {
+                __m128i top    = AverageHalves(pixels00[pixel], pixels01[pixel], &special);
+                __m128i bottom = AverageHalves(pixels10[pixel], pixels11[pixel], &special);
+                columns[pixel] = AverageHalves(top, bottom, &special);
+            }
+            StorePixelPairsRGBA16F(columns, &dest[4 * x], &special);
+
+            if (_mm_movemask_epi8(special) != 0)
+            {
+                GenerateMipPixelsXYZRGBA16F(row00, row01, row10, row11, dest, x, x + 2);
+            }
+        }
+    }
+#endif
+    return x;
+}
+
+size_t GenerateMipRowXYRGBA32F(const float *row0, const float *row1, float *dest, size_t destWidth)
+{
+    size_t x = 0;
+#if defined(ANGLE_USE_SSE)
+    if (gl::supportsSSE2())
+    {
+        for (; x < destWidth; x++)
+        {
+            __m128 left  = AverageFloats(_mm_loadu_ps(&row0[8 * x]), _mm_loadu_ps(&row1[8 * x]));
+            __m128 right =
+                AverageFloats(_mm_loadu_ps(&row0[8 * x + 4]), _mm_loadu_ps(&row1[8 * x + 4]));
+            _mm_storeu_ps(&dest[4 * x], AverageFloats(left, right));
+        }
+    }
+#endif
+    return x;
+}
+
+size_t GenerateMipRowXYZRGBA32F(const float *row00,
+                                const float *row01,
+                                const float *row10,
+                                const float *row11,
+                                float *dest,
+                                size_t destWidth)
+{
+    size_t x = 0;
+#if defined(ANGLE_USE_SSE)
+    if (gl::supportsSSE2())
+    {
+        for (; x < destWidth; x++)
+        {
+            __m128 left = AverageFloats(
+                AverageFloats(_mm_loadu_ps(&row00[8 * x]), _mm_loadu_ps(&row01[8 * x])),
+                AverageFloats(_mm_loadu_ps(&row10[8 * x]), _mm_loadu_ps(&row11[8 * x])));
+            __m128 right = AverageFloats(
+                AverageFloats(_mm_loadu_ps(&row00[8 * x + 4]), _mm_loadu_ps(&row01[8 * x + 4])),
+                AverageFloats(_mm_loadu_ps(&row10[8 * x + 4]), _mm_loadu_ps(&row11[8 * x + 4])));
+            _mm_storeu_ps(&dest[4 * x], AverageFloats(left, right));
+        }
+    }
+#endif
+    return x;
+}
+
+}  // namespace priv
+
+}  // namespace angle
@@ -0,0 +1,66 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// generatemip_simd.h: Vectorized row kernels used by the mip generation functions. Each kernel
+// writes as many leading pixels of a destination row as its vector width allows and returns how
+// many it wrote; the caller finishes the row with its scalar loop. The kernels average in the same
+// order, and round the same way, as the scalar loops, so they produce exactly the same bits.
+//
+// The XY kernels filter source rows |row0| and |row1| of a 2D image. The XYZ kernels filter source
+// rows |row00| and |row10| of a slice and rows |row01| and |row11| of the next slice of a 3D image.
+// SSE2 is selected at runtime and NEON at compile time; without either, the kernels return 0.
+
+#ifndef IMAGEUTIL_GENERATEMIP_SIMD_H_
+#define IMAGEUTIL_GENERATEMIP_SIMD_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace angle
+{
+
+namespace priv
+{
+
+// Any format with four unsigned normalized 8-bit components, which are averaged independently.
+size_t GenerateMipRowXYRGBA8(const uint32_t *row0,
+                             const uint32_t *row1,
+                             uint32_t *dest,
+                             size_t destWidth);
+size_t GenerateMipRowXYZRGBA8(const uint32_t *row00,
+                              const uint32_t *row01,
+                              const uint32_t *row10,
+                              const uint32_t *row11,
+                              uint32_t *dest,
+                              size_t destWidth);
+
+// Only SSE2 has the float kernels. 32-bit ARM NEON flushes denormals to zero, unlike the scalar
+// loops.
+size_t GenerateMipRowXYRGBA16F(const uint16_t *row0,
+                               const uint16_t *row1,
+                               uint16_t *dest,
+                               size_t destWidth);
+size_t GenerateMipRowXYZRGBA16F(const uint16_t *row00,
+                                const uint16_t *row01,
+                                const uint16_t *row10,
+                                const uint16_t *row11,
+                                uint16_t *dest,
+                                size_t destWidth);
+
+// The payload of a NaN result may come from the other operand than in the scalar loops.
+size_t GenerateMipRowXYRGBA32F(const float *row0, const float *row1, float *dest, size_t destWidth);
+size_t GenerateMipRowXYZRGBA32F(const float *row00,
+                                const float *row01,
+                                const float *row10,
+                                const float *row11,
+                                float *dest,
+                                size_t destWidth);
+
+}  // namespace priv
+
+}  // namespace angle
+
+#endif  // IMAGEUTIL_GENERATEMIP_SIMD_H_
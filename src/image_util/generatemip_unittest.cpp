@@ -0,0 +1,198 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// generatemip_unittest:
+//   Tests that the mip generation functions with vector kernels match a per-texel reference for
+//   2D and 3D images of all small sizes, including the leftover pixels the kernels don't handle.
+//
+
+#include <gtest/gtest.h>
+
+#include <string.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "image_util/generatemip.h"
+
+namespace
+{
+
+// Keeps every row and slice aligned to the largest pixel.
+constexpr size_t kPadding = 16;
+
+template <typename T>
+const T *GetSourceTexel(const uint8_t *source,
+                        size_t rowPitch,
+                        size_t depthPitch,
+                        size_t x,
+                        size_t y,
+                        size_t z)
+{
+    return reinterpret_cast<const T *>(source + x * sizeof(T) + y * rowPitch + z * depthPitch);
+}
+
+// Averages the source texels of one destination texel, in the same order as the scalar loops:
+// slices first, then rows, then columns.
+template <typename T>
+T FilterTexel(const uint8_t *source,
+              size_t rowPitch,
+              size_t depthPitch,
+              size_t x,
+              size_t y,
+              size_t z,
+              bool filterX,
+              bool filterY,
+              bool filterZ)
+{
+    T first;
+    T second;
+    if (filterX)
+    {
+        first  = FilterTexel<T>(source, rowPitch, depthPitch, x, y, z, false, filterY, filterZ);
+        second = FilterTexel<T>(source, rowPitch, depthPitch, x + 1, y, z, false, filterY, filterZ);
+    }
+    else if (filterY)
+    {
+        first  = FilterTexel<T>(source, rowPitch, depthPitch, x, y, z, false, false, filterZ);
+        second = FilterTexel<T>(source, rowPitch, depthPitch, x, y + 1, z, false, false, filterZ);
+    }
+    else if (filterZ)
+    {
+        first  = *GetSourceTexel<T>(source, rowPitch, depthPitch, x, y, z);
+        second = *GetSourceTexel<T>(source, rowPitch, depthPitch, x, y, z + 1);
+    }
+    else
+    {
+        return *GetSourceTexel<T>(source, rowPitch, depthPitch, x, y, z);
+    }
+
+    T average;
+    T::average(&average, &first, &second);
+    return average;
+}
+
+// Fills the source with random bits. Half floats can be restricted to normal values, which the
+// vector kernels handle themselves, and floats to a finite range, whose results don't depend on
+// how the compiler orders the operands.
+template <typename T>
+void FillSource(std::mt19937 *rng, std::vector<uint8_t> *source, bool normalHalves)
+{
+    for (uint8_t &byte : *source)
+    {
+        byte = static_cast<uint8_t>((*rng)());
+    }
+}
+
+template <>
+void FillSource<angle::R16G16B16A16F>(std::mt19937 *rng,
+                                      std::vector<uint8_t> *source,
+                                      bool normalHalves)
+{
+    uint16_t *halves = reinterpret_cast<uint16_t *>(source->data());
+    for (size_t index = 0; index < source->size() / sizeof(uint16_t); index++)
+    {
+        uint16_t half = static_cast<uint16_t>((*rng)());
+        if (normalHalves)
+        {
+            half = (half & 0x83FF) | static_cast<uint16_t>((1 + (*rng)() % 30) << 10);
+        }
+        halves[index] = half;
+    }
+}
+
+template <>
+void FillSource<angle::R32G32B32A32F>(std::mt19937 *rng,
+                                      std::vector<uint8_t> *source,
+                                      bool normalHalves)
+{
+    std::uniform_real_distribution<float> distribution(-1000.0f, 1000.0f);
+    float *floats = reinterpret_cast<float *>(source->data());
+    for (size_t index = 0; index < source->size() / sizeof(float); index++)
+    {
+        floats[index] = distribution(*rng);
+    }
+}
+
+template <typename T>
+void CheckGenerateMip(size_t width, size_t height, size_t depth, bool normalHalves)
+{
+    std::mt19937 rng(static_cast<uint32_t>(width * 10000 + height * 100 + depth));
+
+    size_t destWidth      = std::max<size_t>(1, width >> 1);
+    size_t destHeight     = std::max<size_t>(1, height >> 1);
+    size_t destDepth      = std::max<size_t>(1, depth >> 1);
+    size_t rowPitch       = width * sizeof(T) + kPadding;
+    size_t depthPitch     = rowPitch * height + kPadding;
+    size_t destRowPitch   = destWidth * sizeof(T) + kPadding;
+    size_t destDepthPitch = destRowPitch * destHeight + kPadding;
+
+    std::vector<uint8_t> source(depthPitch * depth);
+    FillSource<T>(&rng, &source, normalHalves);
+
+    std::vector<uint8_t> dest(destDepthPitch * destDepth, 0xCD);
+    std::vector<uint8_t> expected(dest);
+    for (size_t z = 0; z < destDepth; z++)
+    {
+        for (size_t y = 0; y < destHeight; y++)
+        {
+            for (size_t x = 0; x < destWidth; x++)
+            {
+                T texel = FilterTexel<T>(source.data(), rowPitch, depthPitch, x * 2, y * 2, z * 2,
+                                         width > 1, height > 1, depth > 1);
+                memcpy(&expected[x * sizeof(T) + y * destRowPitch + z * destDepthPitch], &texel,
+                       sizeof(T));
+            }
+        }
+    }
+
+    angle::GenerateMip<T>(width, height, depth, source.data(), rowPitch, depthPitch, dest.data(),
+                          destRowPitch, destDepthPitch);
+    ASSERT_EQ(expected, dest) << width << "x" << height << "x" << depth;
+}
+
+template <typename T>
+void CheckGenerateMipSizes(bool normalHalves)
+{
+    // 2D images of every width and a few heights, and smaller 3D images.
+    for (size_t width = 1; width <= 37; width++)
+    {
+        for (size_t height : {1, 2, 3, 6})
+        {
+            if (width == 1 && height == 1)
+            {
+                // Images with a single texel have no mips.
+                continue;
+            }
+            CheckGenerateMip<T>(width, height, 1, normalHalves);
+        }
+        for (size_t depth : {2, 3, 5})
+        {
+            CheckGenerateMip<T>(width, 1, depth, normalHalves);
+            CheckGenerateMip<T>(width, 4, depth, normalHalves);
+        }
+    }
+}
+
+TEST(GenerateMipTest, RGBA8)
+{
+    CheckGenerateMipSizes<angle::R8G8B8A8>(false);
+    CheckGenerateMipSizes<angle::B8G8R8A8>(false);
+    CheckGenerateMipSizes<angle::A8R8G8B8>(false);
+}
+
+// Random bits cover NaNs, infinities and denormals, which the kernels leave to the scalar path.
+TEST(GenerateMipTest, RGBA16F)
+{
+    CheckGenerateMipSizes<angle::R16G16B16A16F>(false);
+    CheckGenerateMipSizes<angle::R16G16B16A16F>(true);
+}
+
+TEST(GenerateMipTest, RGBA32F)
+{
+    CheckGenerateMipSizes<angle::R32G32B32A32F>(false);
+}
+
+}  // anonymous namespace
@@ -11,6 +11,7 @@
 #include "common/mathutil.h"
 #include "common/platform.h"
 #include "image_util/imageformats.h"
+#include "image_util/loadimage_simd.h"
 
 namespace angle
 {
@@ -25,54 +26,6 @@ void LoadA8ToRGBA8(size_t width,
                    size_t outputRowPitch,
                    size_t outputDepthPitch)
 {
-#if defined(ANGLE_USE_SSE)
-    if (gl::supportsSSE2())
-    {
-        __m128i zeroWide = _mm_setzero_si128();
-
-        for (size_t z = 0; z < depth; z++)
-        {
-            for (size_t y = 0; y < height; y++)
-            {
-                const uint8_t *source =
-                    priv::OffsetDataPointer<uint8_t>(input, y, z, inputRowPitch, inputDepthPitch);
-                uint32_t *dest = priv::OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch,
-                                                                   outputDepthPitch);
-
-                size_t x = 0;
-
-                // Make output writes aligned
-                for (; ((reinterpret_cast<intptr_t>(&dest[x]) & 0xF) != 0 && x < width); x++)
-                {
-                    dest[x] = static_cast<uint32_t>(source[x]) << 24;
-                }
-
-                for (; x + 7 < width; x += 8)
-                {
-                    __m128i sourceData =
-                        _mm_loadl_epi64(reinterpret_cast<const __m128i *>(&source[x]));
-                    // Interleave each byte to 16bit, make the lower byte to zero
-                    sourceData = _mm_unpacklo_epi8(zeroWide, sourceData);
-                    // Interleave each 16bit to 32bit, make the lower 16bit to zero
-                    __m128i lo = _mm_unpacklo_epi16(zeroWide, sourceData);
-                    __m128i hi = _mm_unpackhi_epi16(zeroWide, sourceData);
-
-                    _mm_store_si128(reinterpret_cast<__m128i *>(&dest[x]), lo);
-                    _mm_store_si128(reinterpret_cast<__m128i *>(&dest[x + 4]), hi);
-                }
-
-                // Handle the remainder
-                for (; x < width; x++)
-                {
-                    dest[x] = static_cast<uint32_t>(source[x]) << 24;
-                }
-            }
-        }
-
-        return;
-    }
-#endif
-
     for (size_t z = 0; z < depth; z++)
     {
         for (size_t y = 0; y < height; y++)
@@ -81,7 +34,7 @@ void LoadA8ToRGBA8(size_t width,
                 priv::OffsetDataPointer<uint8_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint32_t *dest =
                 priv::OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = priv::LoadRowA8ToRGBA8(source, dest, width); x < width; x++)
             {
                 dest[x] = static_cast<uint32_t>(source[x]) << 24;
             }
@@ -180,7 +133,7 @@ void LoadL8ToRGBA8(size_t width,
                 priv::OffsetDataPointer<uint8_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint8_t *dest =
                 priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = priv::LoadRowL8ToRGBA8(source, dest, width); x < width; x++)
             {
                 uint8_t sourceVal = source[x];
                 dest[4 * x + 0]   = sourceVal;
@@ -283,7 +236,7 @@ void LoadLA8ToRGBA8(size_t width,
                 priv::OffsetDataPointer<uint8_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint8_t *dest =
                 priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = priv::LoadRowLA8ToRGBA8(source, dest, width); x < width; x++)
             {
                 dest[4 * x + 0] = source[2 * x + 0];
                 dest[4 * x + 1] = source[2 * x + 0];
@@ -385,7 +338,7 @@ void LoadRGB8ToBGR565(size_t width,
                 priv::OffsetDataPointer<uint8_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint16_t *dest =
                 priv::OffsetDataPointer<uint16_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = priv::LoadRowRGB8ToBGR565(source, dest, width); x < width; x++)
             {
                 uint8_t r8 = source[x * 3 + 0];
                 uint8_t g8 = source[x * 3 + 1];
@@ -417,16 +370,10 @@ void LoadRGB565ToBGR565(size_t width,
                 priv::OffsetDataPointer<uint16_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint16_t *dest =
                 priv::OffsetDataPointer<uint16_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
-            {
-                // The GL type RGB is packed with with red in the MSB, while the D3D11 type BGR
-                // is packed with red in the LSB
-                auto rgb    = source[x];
-                uint16_t r5 = gl::getShiftedData<5, 11>(rgb);
-                uint16_t g6 = gl::getShiftedData<6, 5>(rgb);
-                uint16_t b5 = gl::getShiftedData<5, 0>(rgb);
-                dest[x]     = (r5 << 11) | (g6 << 5) | b5;
-            }
+            // The GL type RGB is packed with with red in the MSB, while the D3D11 type BGR
+            // is packed with red in the LSB. Both put red in the same bits of the 16-bit value,
+            // so the rows are copied as is.
+            memcpy(dest, source, width * sizeof(uint16_t));
         }
     }
 }
@@ -449,7 +396,7 @@ void LoadRGB8ToBGRX8(size_t width,
                 priv::OffsetDataPointer<uint8_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint8_t *dest =
                 priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = priv::LoadRowRGB8ToBGRX8(source, dest, width); x < width; x++)
             {
                 dest[4 * x + 0] = source[x * 3 + 2];
                 dest[4 * x + 1] = source[x * 3 + 1];
@@ -594,58 +541,6 @@ void LoadRGBA8ToBGRA8(size_t width,
                       size_t outputRowPitch,
                       size_t outputDepthPitch)
 {
-#if defined(ANGLE_USE_SSE)
-    if (gl::supportsSSE2())
-    {
-        __m128i brMask = _mm_set1_epi32(0x00ff00ff);
-
-        for (size_t z = 0; z < depth; z++)
-        {
-            for (size_t y = 0; y < height; y++)
-            {
-                const uint32_t *source =
-                    priv::OffsetDataPointer<uint32_t>(input, y, z, inputRowPitch, inputDepthPitch);
-                uint32_t *dest = priv::OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch,
-                                                                   outputDepthPitch);
-
-                size_t x = 0;
-
-                // Make output writes aligned
-                for (; ((reinterpret_cast<intptr_t>(&dest[x]) & 15) != 0) && x < width; x++)
-                {
-                    uint32_t rgba = source[x];
-                    dest[x]       = (ANGLE_ROTL(rgba, 16) & 0x00ff00ff) | (rgba & 0xff00ff00);
-                }
-
-                for (; x + 3 < width; x += 4)
-                {
-                    __m128i sourceData =
-                        _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[x]));
-                    // Mask out g and a, which don't change
-                    __m128i gaComponents = _mm_andnot_si128(brMask, sourceData);
-                    // Mask out b and r
-                    __m128i brComponents = _mm_and_si128(sourceData, brMask);
-                    // Swap b and r
-                    __m128i brSwapped = _mm_shufflehi_epi16(
-                        _mm_shufflelo_epi16(brComponents, _MM_SHUFFLE(2, 3, 0, 1)),
-                        _MM_SHUFFLE(2, 3, 0, 1));
-                    __m128i result = _mm_or_si128(gaComponents, brSwapped);
-                    _mm_store_si128(reinterpret_cast<__m128i *>(&dest[x]), result);
-                }
-
-                // Perform leftover writes
-                for (; x < width; x++)
-                {
-                    uint32_t rgba = source[x];
-                    dest[x]       = (ANGLE_ROTL(rgba, 16) & 0x00ff00ff) | (rgba & 0xff00ff00);
-                }
-            }
-        }
-
-        return;
-    }
-#endif
-
     for (size_t z = 0; z < depth; z++)
     {
         for (size_t y = 0; y < height; y++)
@@ -654,7 +549,7 @@ void LoadRGBA8ToBGRA8(size_t width,
                 priv::OffsetDataPointer<uint32_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint32_t *dest =
                 priv::OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = priv::LoadRowRGBA8ToBGRA8(source, dest, width); x < width; x++)
             {
                 uint32_t rgba = source[x];
                 dest[x]       = (ANGLE_ROTL(rgba, 16) & 0x00ff00ff) | (rgba & 0xff00ff00);
@@ -681,7 +576,7 @@ void LoadRGBA8ToBGRA4(size_t width,
                 priv::OffsetDataPointer<uint32_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint16_t *dest =
                 priv::OffsetDataPointer<uint16_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = priv::LoadRowRGBA8ToBGRA4(source, dest, width); x < width; x++)
             {
                 uint32_t rgba8 = source[x];
                 auto r4        = static_cast<uint16_t>((rgba8 & 0x000000FF) >> 4);
@@ -840,7 +735,7 @@ void LoadRGBA8ToBGR5A1(size_t width,
                 priv::OffsetDataPointer<uint32_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint16_t *dest =
                 priv::OffsetDataPointer<uint16_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = priv::LoadRowRGBA8ToBGR5A1(source, dest, width); x < width; x++)
             {
                 uint32_t rgba8 = source[x];
                 auto r5        = static_cast<uint16_t>((rgba8 & 0x000000FF) >> 3);
@@ -5,6 +5,7 @@
 //
 
 #include "common/mathutil.h"
+#include "image_util/loadimage_simd.h"
 
 #include <string.h>
 
@@ -73,13 +74,19 @@ inline void LoadToNative3To4(size_t width, size_t height, size_t depth,
 {
     const type fourthValue = gl::bitCast<type>(fourthComponentBits);
 
+    // The vector kernels only move bits around, so they work on the unsigned type of the same size.
+    using UnsignedType = typename priv::UnsignedOfSize<sizeof(type)>::Type;
+    const UnsignedType fourthBits = gl::bitCast<UnsignedType>(fourthValue);
+
     for (size_t z = 0; z < depth; z++)
     {
         for (size_t y = 0; y < height; y++)
         {
             const type *source = priv::OffsetDataPointer<type>(input, y, z, inputRowPitch, inputDepthPitch);
             type *dest = priv::OffsetDataPointer<type>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            size_t x = priv::LoadRow3To4(reinterpret_cast<const UnsignedType *>(source),
+                                         reinterpret_cast<UnsignedType *>(dest), width, fourthBits);
+            for (; x < width; x++)
             {
                 dest[x * 4 + 0] = source[x * 3 + 0];
                 dest[x * 4 + 1] = source[x * 3 + 1];
@@ -104,7 +111,7 @@ inline void Load32FTo16F(size_t width, size_t height, size_t depth,
             const float *source = priv::OffsetDataPointer<float>(input, y, z, inputRowPitch, inputDepthPitch);
             uint16_t *dest = priv::OffsetDataPointer<uint16_t>(output, y, z, outputRowPitch, outputDepthPitch);
 
-            for (size_t x = 0; x < elementWidth; x++)
+            for (size_t x = priv::LoadRow32FTo16F(source, dest, elementWidth); x < elementWidth; x++)
             {
                 dest[x] = gl::float32ToFloat16(source[x]);
             }
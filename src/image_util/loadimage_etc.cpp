@@ -11,6 +11,7 @@
 #include "common/mathutil.h"
 
 #include "image_util/imageformats.h"
+#include "image_util/loadimage_simd.h"
 
 namespace angle
 {
@@ -51,6 +52,56 @@ static IntensityModifier intensityModifierNonOpaque[] =
 
 static const int kNumPixelsInBlock = 16;
 
+// Encodes the values of a block, in row-major order, as a BC4 block. BC3 stores its alpha in the
+// same kind of block. Values range from 0, or -|valueMax| when signed, to |valueMax|, and endpoints
+// from 0, or -|endpointMax|, to |endpointMax|. The larger endpoint comes first, which selects the
+// mode with six interpolated values evenly spaced between the two.
+void EncodeBC4Block(const int16_t values[kNumPixelsInBlock],
+                    int valueMax,
+                    int endpointMax,
+                    uint8_t *dest)
+{
+    int minValue = values[0];
+    int maxValue = values[0];
+    for (int i = 1; i < kNumPixelsInBlock; i++)
+    {
+        minValue = std::min<int>(minValue, values[i]);
+        maxValue = std::max<int>(maxValue, values[i]);
+    }
+
+    const float toEndpoint = static_cast<float>(endpointMax) / valueMax;
+    const int high = static_cast<int>(std::floor(static_cast<float>(maxValue) * toEndpoint + 0.5f));
+    const int low  = static_cast<int>(std::floor(static_cast<float>(minValue) * toEndpoint + 0.5f));
+    dest[0]        = static_cast<uint8_t>(high);
+    dest[1]        = static_cast<uint8_t>(low);
+
+    uint8_t indices[kNumPixelsInBlock] = {};
+    if (high > low)
+    {
+        // Index 0 is the high endpoint, 1 the low one and 2 to 7 go from high to low.
+        const float lowValue = static_cast<float>(low) / toEndpoint;
+        const float scale    = 7.0f * toEndpoint / static_cast<float>(high - low);
+        for (size_t i = priv::EncodeBC4Indices(values, lowValue, scale, indices, kNumPixelsInBlock);
+             i < kNumPixelsInBlock; i++)
+        {
+            int position =
+                gl::clamp(static_cast<int>((values[i] - lowValue) * scale + 0.5f), 0, 7);
+            int index  = (8 - position) & 7;
+            indices[i] = static_cast<uint8_t>(index < 2 ? index ^ 1 : index);
+        }
+    }
+
+    uint64_t indexBits = 0;
+    for (int i = kNumPixelsInBlock - 1; i >= 0; i--)
+    {
+        indexBits = (indexBits << 3) | indices[i];
+    }
+    for (size_t byte = 0; byte < 6; byte++)
+    {
+        dest[2 + byte] = static_cast<uint8_t>(indexBits >> (byte * 8));
+    }
+}
+
 struct ETC2Block
 {
     // Decodes unsigned single or dual channel ETC2 block to 8-bit color
@@ -63,20 +114,24 @@ struct ETC2Block
                                    size_t destRowPitch,
                                    bool isSigned) const
     {
+        uint16_t values[kNumPixelsInBlock];
+        if (isSigned)
+        {
+            decodeSingleChannelValues(u.scblk.base_codeword.s, u.scblk.multiplier, -128, 127, 0,
+                                      values);
+        }
+        else
+        {
+            decodeSingleChannelValues(u.scblk.base_codeword.us, u.scblk.multiplier, 0, 255, 0,
+                                      values);
+        }
+
         for (size_t j = 0; j < 4 && (y + j) < h; j++)
         {
             uint8_t *row = dest + (j * destRowPitch);
             for (size_t i = 0; i < 4 && (x + i) < w; i++)
             {
-                uint8_t *pixel = row + (i * destPixelStride);
-                if (isSigned)
-                {
-                    *pixel = clampSByte(getSingleETC2Channel(i, j, isSigned));
-                }
-                else
-                {
-                    *pixel = clampByte(getSingleETC2Channel(i, j, isSigned));
-                }
+                row[i * destPixelStride] = static_cast<uint8_t>(values[j * 4 + i]);
             }
         }
     }
@@ -91,21 +146,17 @@ struct ETC2Block
                                   size_t destRowPitch,
                                   bool isSigned) const
     {
+        // The 11-bit values are scaled to 16 bits.
+        uint16_t values[kNumPixelsInBlock];
+        decodeEACValues(isSigned, 5, values);
+
         for (size_t j = 0; j < 4 && (y + j) < h; j++)
         {
             uint16_t *row = reinterpret_cast<uint16_t *>(reinterpret_cast<uint8_t *>(dest) +
                                                          (j * destRowPitch));
             for (size_t i = 0; i < 4 && (x + i) < w; i++)
             {
-                uint16_t *pixel = row + (i * destPixelStride);
-                if (isSigned)
-                {
-                    *pixel = renormalizeSignedEAC(getSingleEACChannel(i, j, isSigned));
-                }
-                else
-                {
-                    *pixel = renormalizeUnsignedEAC(getSingleEACChannel(i, j, isSigned));
-                }
+                row[i * destPixelStride] = values[j * 4 + i];
             }
         }
     }
@@ -199,6 +250,29 @@ struct ETC2Block
         }
     }
 
+    // Transcodes an 8-bit ETC2 alpha block to a BC3 alpha block
+    void transcodeAlphaAsBC3(uint8_t *dest) const
+    {
+        uint16_t values[kNumPixelsInBlock];
+        decodeSingleChannelValues(u.scblk.base_codeword.us, u.scblk.multiplier, 0, 255, 0, values);
+        EncodeBC4Block(reinterpret_cast<const int16_t *>(values), 255, 255, dest);
+    }
+
+    // Transcodes an 11-bit EAC block to BC4
+    void transcodeAsBC4(uint8_t *dest, bool isSigned) const
+    {
+        uint16_t values[kNumPixelsInBlock];
+        decodeEACValues(isSigned, 0, values);
+        if (isSigned)
+        {
+            EncodeBC4Block(reinterpret_cast<const int16_t *>(values), 1023, 127, dest);
+        }
+        else
+        {
+            EncodeBC4Block(reinterpret_cast<const int16_t *>(values), 2047, 255, dest);
+        }
+    }
+
   private:
     union {
         // Individual, differential, H and T modes
@@ -352,24 +426,6 @@ struct ETC2Block
         return static_cast<unsigned char>(gl::clamp(value, 0, 255));
     }
 
-    static signed char clampSByte(int value)
-    {
-        return static_cast<signed char>(gl::clamp(value, -128, 127));
-    }
-
-    static uint16_t renormalizeUnsignedEAC(int value)
-    {
-        // Data is in the range 0 to 2047, clamp it and then scale it to 16-bit
-        return static_cast<uint16_t>(gl::clamp(value, 0, 2047)) << 5;
-    }
-
-    static int16_t renormalizeSignedEAC(int value)
-    {
-        // Data is in the range -1023 to 1023, clamp it and then scale it to 16-bit
-        // The spec states that -1024 invalid and should be clamped to -1023
-        return static_cast<int16_t>(gl::clamp(value, -1023, 1023)) * 32;
-    }
-
     static R8G8B8A8 createRGBA(int red, int green, int blue, int alpha)
     {
         R8G8B8A8 rgba;
@@ -448,64 +504,18 @@ struct ETC2Block
         const IntensityModifier *intensityModifier =
             nonOpaquePunchThroughAlpha ? intensityModifierNonOpaque : intensityModifierDefault;
 
-        R8G8B8A8 subblockColors0[4];
-        R8G8B8A8 subblockColors1[4];
+        R8G8B8A8 subblockColors[8];
         for (size_t modifierIdx = 0; modifierIdx < 4; modifierIdx++)
         {
-            const int i1                 = intensityModifier[u.idht.mode.idm.cw1][modifierIdx];
-            subblockColors0[modifierIdx] = createRGBA(r1 + i1, g1 + i1, b1 + i1);
+            const int i1                = intensityModifier[u.idht.mode.idm.cw1][modifierIdx];
+            subblockColors[modifierIdx] = createRGBA(r1 + i1, g1 + i1, b1 + i1);
 
-            const int i2                 = intensityModifier[u.idht.mode.idm.cw2][modifierIdx];
-            subblockColors1[modifierIdx] = createRGBA(r2 + i2, g2 + i2, b2 + i2);
+            const int i2                    = intensityModifier[u.idht.mode.idm.cw2][modifierIdx];
+            subblockColors[4 + modifierIdx] = createRGBA(r2 + i2, g2 + i2, b2 + i2);
         }
 
-        if (u.idht.mode.idm.flipbit)
-        {
-            uint8_t *curPixel = dest;
-            for (size_t j = 0; j < 2 && (y + j) < h; j++)
-            {
-                R8G8B8A8 *row = reinterpret_cast<R8G8B8A8 *>(curPixel);
-                for (size_t i = 0; i < 4 && (x + i) < w; i++)
-                {
-                    row[i]   = subblockColors0[getIndex(i, j)];
-                    row[i].A = alphaValues[j][i];
-                }
-                curPixel += destRowPitch;
-            }
-            for (size_t j = 2; j < 4 && (y + j) < h; j++)
-            {
-                R8G8B8A8 *row = reinterpret_cast<R8G8B8A8 *>(curPixel);
-                for (size_t i = 0; i < 4 && (x + i) < w; i++)
-                {
-                    row[i]   = subblockColors1[getIndex(i, j)];
-                    row[i].A = alphaValues[j][i];
-                }
-                curPixel += destRowPitch;
-            }
-        }
-        else
-        {
-            uint8_t *curPixel = dest;
-            for (size_t j = 0; j < 4 && (y + j) < h; j++)
-            {
-                R8G8B8A8 *row = reinterpret_cast<R8G8B8A8 *>(curPixel);
-                for (size_t i = 0; i < 2 && (x + i) < w; i++)
-                {
-                    row[i]   = subblockColors0[getIndex(i, j)];
-                    row[i].A = alphaValues[j][i];
-                }
-                for (size_t i = 2; i < 4 && (x + i) < w; i++)
-                {
-                    row[i]   = subblockColors1[getIndex(i, j)];
-                    row[i].A = alphaValues[j][i];
-                }
-                curPixel += destRowPitch;
-            }
-        }
-        if (nonOpaquePunchThroughAlpha)
-        {
-            decodePunchThroughAlphaBlock(dest, x, y, w, h, destRowPitch);
-        }
+        decodeIndexedBlock(dest, x, y, w, h, destRowPitch, subblockColors, u.idht.mode.idm.flipbit,
+                           alphaValues, nonOpaquePunchThroughAlpha);
     }
 
     void decodeTBlock(uint8_t *dest,
@@ -530,27 +540,16 @@ struct ETC2Block
         static int distance[8] = {3, 6, 11, 16, 23, 32, 41, 64};
         const int d            = distance[block.Tda << 1 | block.Tdb];
 
-        const R8G8B8A8 paintColors[4] = {
+        // Both subblocks have the same colors.
+        const R8G8B8A8 paintColors[8] = {
             createRGBA(r1, g1, b1), createRGBA(r2 + d, g2 + d, b2 + d), createRGBA(r2, g2, b2),
+            createRGBA(r2 - d, g2 - d, b2 - d), createRGBA(r1, g1, b1),
+            createRGBA(r2 + d, g2 + d, b2 + d), createRGBA(r2, g2, b2),
             createRGBA(r2 - d, g2 - d, b2 - d),
         };
 
-        uint8_t *curPixel = dest;
-        for (size_t j = 0; j < 4 && (y + j) < h; j++)
-        {
-            R8G8B8A8 *row = reinterpret_cast<R8G8B8A8 *>(curPixel);
-            for (size_t i = 0; i < 4 && (x + i) < w; i++)
-            {
-                row[i]   = paintColors[getIndex(i, j)];
-                row[i].A = alphaValues[j][i];
-            }
-            curPixel += destRowPitch;
-        }
-
-        if (nonOpaquePunchThroughAlpha)
-        {
-            decodePunchThroughAlphaBlock(dest, x, y, w, h, destRowPitch);
-        }
+        decodeIndexedBlock(dest, x, y, w, h, destRowPitch, paintColors, false, alphaValues,
+                           nonOpaquePunchThroughAlpha);
     }
 
     void decodeHBlock(uint8_t *dest,
@@ -577,27 +576,16 @@ struct ETC2Block
             ((r1 << 16 | g1 << 8 | b1) >= (r2 << 16 | g2 << 8 | b2) ? 1 : 0);
         const int d = distance[(block.Hda << 2) | (block.Hdb << 1) | orderingTrickBit];
 
-        const R8G8B8A8 paintColors[4] = {
+        // Both subblocks have the same colors.
+        const R8G8B8A8 paintColors[8] = {
+            createRGBA(r1 + d, g1 + d, b1 + d), createRGBA(r1 - d, g1 - d, b1 - d),
+            createRGBA(r2 + d, g2 + d, b2 + d), createRGBA(r2 - d, g2 - d, b2 - d),
             createRGBA(r1 + d, g1 + d, b1 + d), createRGBA(r1 - d, g1 - d, b1 - d),
             createRGBA(r2 + d, g2 + d, b2 + d), createRGBA(r2 - d, g2 - d, b2 - d),
         };
 
-        uint8_t *curPixel = dest;
-        for (size_t j = 0; j < 4 && (y + j) < h; j++)
-        {
-            R8G8B8A8 *row = reinterpret_cast<R8G8B8A8 *>(curPixel);
-            for (size_t i = 0; i < 4 && (x + i) < w; i++)
-            {
-                row[i]   = paintColors[getIndex(i, j)];
-                row[i].A = alphaValues[j][i];
-            }
-            curPixel += destRowPitch;
-        }
-
-        if (nonOpaquePunchThroughAlpha)
-        {
-            decodePunchThroughAlphaBlock(dest, x, y, w, h, destRowPitch);
-        }
+        decodeIndexedBlock(dest, x, y, w, h, destRowPitch, paintColors, false, alphaValues,
+                           nonOpaquePunchThroughAlpha);
     }
 
     void decodePlanarBlock(uint8_t *dest,
@@ -619,22 +607,88 @@ struct ETC2Block
         int gv = extend_7to8bits(u.pblk.GVa << 2 | u.pblk.GVb);
         int bv = extend_6to8bits(u.pblk.BV);
 
-        uint8_t *curPixel = dest;
-        for (size_t j = 0; j < 4 && (y + j) < h; j++)
+        const int origin[3]     = {ro, go, bo};
+        const int horizontal[3] = {rh, gh, bh};
+        const int vertical[3]   = {rv, gv, bv};
+
+        R8G8B8A8 pixels[kNumPixelsInBlock];
+        if (priv::DecodeETCPlanarBlock(origin, horizontal, vertical, &alphaValues[0][0],
+                                       reinterpret_cast<uint32_t *>(pixels)) != kNumPixelsInBlock)
         {
-            R8G8B8A8 *row = reinterpret_cast<R8G8B8A8 *>(curPixel);
+            for (size_t j = 0; j < 4; j++)
+            {
+                int ry = static_cast<int>(j) * (rv - ro) + 2;
+                int gy = static_cast<int>(j) * (gv - go) + 2;
+                int by = static_cast<int>(j) * (bv - bo) + 2;
+                for (size_t i = 0; i < 4; i++)
+                {
+                    pixels[j * 4 + i] =
+                        createRGBA(((static_cast<int>(i) * (rh - ro) + ry) >> 2) + ro,
+                                   ((static_cast<int>(i) * (gh - go) + gy) >> 2) + go,
+                                   ((static_cast<int>(i) * (bh - bo) + by) >> 2) + bo,
+                                   alphaValues[j][i]);
+                }
+            }
+        }
 
-            int ry = static_cast<int>(j) * (rv - ro) + 2;
-            int gy = static_cast<int>(j) * (gv - go) + 2;
-            int by = static_cast<int>(j) * (bv - bo) + 2;
-            for (size_t i = 0; i < 4 && (x + i) < w; i++)
+        writeBlockPixels(pixels, dest, x, y, w, h, pitch);
+    }
+
+    // Decodes an individual, differential, T or H block, whose pixels have the color of their index
+    // among the four colors of their subblock in |subblockColors|.
+    void decodeIndexedBlock(uint8_t *dest,
+                            size_t x,
+                            size_t y,
+                            size_t w,
+                            size_t h,
+                            size_t destRowPitch,
+                            const R8G8B8A8 subblockColors[8],
+                            bool flipbit,
+                            const uint8_t alphaValues[4][4],
+                            bool nonOpaquePunchThroughAlpha) const
+    {
+        const uint32_t msbBits = u.idht.pixelIndexMSB[0] << 8 | u.idht.pixelIndexMSB[1];
+        const uint32_t lsbBits = u.idht.pixelIndexLSB[0] << 8 | u.idht.pixelIndexLSB[1];
+
+        R8G8B8A8 pixels[kNumPixelsInBlock];
+        if (priv::DecodeETCIndexedBlock(msbBits, lsbBits,
+                                        reinterpret_cast<const uint32_t *>(subblockColors), flipbit,
+                                        &alphaValues[0][0], nonOpaquePunchThroughAlpha,
+                                        reinterpret_cast<uint32_t *>(pixels)) != kNumPixelsInBlock)
+        {
+            for (size_t j = 0; j < 4; j++)
             {
-                row[i] = createRGBA(((static_cast<int>(i) * (rh - ro) + ry) >> 2) + ro,
-                                    ((static_cast<int>(i) * (gh - go) + gy) >> 2) + go,
-                                    ((static_cast<int>(i) * (bh - bo) + by) >> 2) + bo,
-                                    alphaValues[j][i]);
+                for (size_t i = 0; i < 4; i++)
+                {
+                    size_t subblock = (flipbit ? j : i) / 2;
+                    size_t index    = getIndex(i, j);
+                    R8G8B8A8 &pixel = pixels[j * 4 + i];
+                    pixel           = subblockColors[subblock * 4 + index];
+                    pixel.A         = alphaValues[j][i];
+                    if (nonOpaquePunchThroughAlpha && index == 2)
+                    {
+                        pixel = createRGBA(0, 0, 0, 0);
+                    }
+                }
             }
-            curPixel += pitch;
+        }
+
+        writeBlockPixels(pixels, dest, x, y, w, h, destRowPitch);
+    }
+
+    // Writes the pixels of a decoded block that are inside the image.
+    static void writeBlockPixels(const R8G8B8A8 pixels[kNumPixelsInBlock],
+                                 uint8_t *dest,
+                                 size_t x,
+                                 size_t y,
+                                 size_t w,
+                                 size_t h,
+                                 size_t destRowPitch)
+    {
+        const size_t rowBytes = std::min<size_t>(4, w - x) * sizeof(R8G8B8A8);
+        for (size_t j = 0; j < 4 && (y + j) < h; j++)
+        {
+            memcpy(dest + j * destRowPitch, &pixels[j * 4], rowBytes);
         }
     }
 
@@ -648,28 +702,6 @@ struct ETC2Block
         return (msb << 1) | lsb;
     }
 
-    void decodePunchThroughAlphaBlock(uint8_t *dest,
-                                      size_t x,
-                                      size_t y,
-                                      size_t w,
-                                      size_t h,
-                                      size_t destRowPitch) const
-    {
-        uint8_t *curPixel = dest;
-        for (size_t j = 0; j < 4 && (y + j) < h; j++)
-        {
-            R8G8B8A8 *row = reinterpret_cast<R8G8B8A8 *>(curPixel);
-            for (size_t i = 0; i < 4 && (x + i) < w; i++)
-            {
-                if (getIndex(i, j) == 2)  //  msb == 1 && lsb == 0
-                {
-                    row[i] = createRGBA(0, 0, 0, 0);
-                }
-            }
-            curPixel += destRowPitch;
-        }
-    }
-
     uint16_t RGB8ToRGB565(const R8G8B8A8 &rgba) const
     {
         return (static_cast<uint16_t>(rgba.R >> 3) << 11) |
@@ -1283,8 +1315,10 @@ struct ETC2Block
     {
         static const size_t kNumColors = kNumPixelsInBlock;
 
+        // Decode the whole block, like the other modes, even where it's past the edge of the image.
+        // The colors of the pixels that aren't decoded would be undefined.
         R8G8B8A8 rgbaBlock[kNumColors];
-        decodePlanarBlock(reinterpret_cast<uint8_t *>(rgbaBlock), x, y, w, h, sizeof(R8G8B8A8) * 4,
+        decodePlanarBlock(reinterpret_cast<uint8_t *>(rgbaBlock), 0, 0, 4, 4, sizeof(R8G8B8A8) * 4,
                           alphaValues);
 
         // Planar block doesn't have a color table, fill indices as full
@@ -1300,48 +1334,72 @@ struct ETC2Block
     }
 
     // Single channel utility functions
-    int getSingleEACChannel(size_t x, size_t y, bool isSigned) const
+
+    // Decodes the pixels of a single channel block in row-major order: |base| plus the modifier of
+    // each pixel times |multiplier|, clamped to [|minValue|, |maxValue|] and multiplied by
+    // 2^|shift|.
+    void decodeSingleChannelValues(int base,
+                                   int multiplier,
+                                   int minValue,
+                                   int maxValue,
+                                   int shift,
+                                   uint16_t values[kNumPixelsInBlock]) const
     {
-        int codeword   = isSigned ? u.scblk.base_codeword.s : u.scblk.base_codeword.us;
-        int multiplier = (u.scblk.multiplier == 0) ? 1 : u.scblk.multiplier * 8;
-        return codeword * 8 + 4 + getSingleChannelModifier(x, y) * multiplier;
+        uint64_t indexBits = getSingleChannelIndexBits();
+        int16_t modifiers[kNumPixelsInBlock];
+        for (size_t k = 0; k < kNumPixelsInBlock; k++)
+        {
+            int modifier = getSingleChannelModifierFromIndex(getIndexFromBits(indexBits, k));
+            modifiers[getRowMajorIndex(k)] = static_cast<int16_t>(modifier);
+        }
+
+        size_t decoded = priv::DecodeEACValues(modifiers, base, multiplier, minValue, maxValue,
+                                               shift, values, kNumPixelsInBlock);
+        for (size_t i = decoded; i < kNumPixelsInBlock; i++)
+        {
+            int value = gl::clamp(base + modifiers[i] * multiplier, minValue, maxValue);
+            values[i] = static_cast<uint16_t>(value * (1 << shift));
+        }
     }
 
-    int getSingleETC2Channel(size_t x, size_t y, bool isSigned) const
+    // Decodes the 11-bit values of an EAC block, multiplied by 2^|shift|. The spec states that
+    // -1024 is invalid and should be clamped to -1023.
+    void decodeEACValues(bool isSigned, int shift, uint16_t values[kNumPixelsInBlock]) const
     {
-        int codeword = isSigned ? u.scblk.base_codeword.s : u.scblk.base_codeword.us;
-        return codeword + getSingleChannelModifier(x, y) * u.scblk.multiplier;
+        int codeword   = isSigned ? u.scblk.base_codeword.s : u.scblk.base_codeword.us;
+        int multiplier = (u.scblk.multiplier == 0) ? 1 : u.scblk.multiplier * 8;
+        if (isSigned)
+        {
+            decodeSingleChannelValues(codeword * 8 + 4, multiplier, -1023, 1023, shift, values);
+        }
+        else
+        {
+            decodeSingleChannelValues(codeword * 8 + 4, multiplier, 0, 2047, shift, values);
+        }
     }
 
-    int getSingleChannelIndex(size_t x, size_t y) const
+    // All the 3-bit indices of a single channel block, to be read with getIndexFromBits.
+    uint64_t getSingleChannelIndexBits() const
     {
-        ASSERT(x < 4 && y < 4);
-
-        // clang-format off
-        switch (x * 4 + y)
+        const uint8_t *bytes = reinterpret_cast<const uint8_t *>(&u.scblk);
+        uint64_t indexBits   = 0;
+        for (size_t byte = 2; byte < 8; byte++)
         {
-            case 0: return u.scblk.ma;
-            case 1: return u.scblk.mb;
-            case 2: return u.scblk.mc1 << 1 | u.scblk.mc2;
-            case 3: return u.scblk.md;
-            case 4: return u.scblk.me;
-            case 5: return u.scblk.mf1 << 2 | u.scblk.mf2;
-            case 6: return u.scblk.mg;
-            case 7: return u.scblk.mh;
-            case 8: return u.scblk.mi;
-            case 9: return u.scblk.mj;
-            case 10: return u.scblk.mk1 << 1 | u.scblk.mk2;
-            case 11: return u.scblk.ml;
-            case 12: return u.scblk.mm;
-            case 13: return u.scblk.mn1 << 2 | u.scblk.mn2;
-            case 14: return u.scblk.mo;
-            case 15: return u.scblk.mp;
-            default: UNREACHABLE(); return 0;
+            indexBits = (indexBits << 8) | bytes[byte];
         }
-        // clang-format on
+        return indexBits;
     }
 
-    int getSingleChannelModifier(size_t x, size_t y) const
+    // The index of the |k|th pixel of the block, which stores its pixels column by column.
+    static int getIndexFromBits(uint64_t indexBits, size_t k)
+    {
+        return static_cast<int>((indexBits >> (45 - 3 * k)) & 7);
+    }
+
+    // BC blocks store their pixels row by row.
+    static size_t getRowMajorIndex(size_t k) { return (k % 4) * 4 + k / 4; }
+
+    int getSingleChannelModifierFromIndex(int index) const
     {
         // clang-format off
         static const int modifierTable[16][8] =
@@ -1365,7 +1423,7 @@ struct ETC2Block
         };
         // clang-format on
 
-        return modifierTable[u.scblk.table_index][getSingleChannelIndex(x, y)];
+        return modifierTable[u.scblk.table_index][index];
     }
 };
 
@@ -1515,6 +1573,71 @@ void LoadRG11EACToRG16(size_t width,
     }
 }
 
+void LoadR11EACToBC4(size_t width,
+                     size_t height,
+                     size_t depth,
+                     const uint8_t *input,
+                     size_t inputRowPitch,
+                     size_t inputDepthPitch,
+                     uint8_t *output,
+                     size_t outputRowPitch,
+                     size_t outputDepthPitch,
+                     bool isSigned)
+{
+    for (size_t z = 0; z < depth; z++)
+    {
+        for (size_t y = 0; y < height; y += 4)
+        {
+            const ETC2Block *sourceRow =
+                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
+            uint8_t *destRow = priv::OffsetDataPointer<uint8_t>(output, y / 4, z, outputRowPitch,
+                                                                outputDepthPitch);
+
+            for (size_t x = 0; x < width; x += 4)
+            {
+                const ETC2Block *sourceBlock = sourceRow + (x / 4);
+                uint8_t *destBlock           = destRow + (x * 2);
+
+                sourceBlock->transcodeAsBC4(destBlock, isSigned);
+            }
+        }
+    }
+}
+
+void LoadRG11EACToBC5(size_t width,
+                      size_t height,
+                      size_t depth,
+                      const uint8_t *input,
+                      size_t inputRowPitch,
+                      size_t inputDepthPitch,
+                      uint8_t *output,
+                      size_t outputRowPitch,
+                      size_t outputDepthPitch,
+                      bool isSigned)
+{
+    for (size_t z = 0; z < depth; z++)
+    {
+        for (size_t y = 0; y < height; y += 4)
+        {
+            const ETC2Block *sourceRow =
+                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
+            uint8_t *destRow = priv::OffsetDataPointer<uint8_t>(output, y / 4, z, outputRowPitch,
+                                                                outputDepthPitch);
+
+            for (size_t x = 0; x < width; x += 4)
+            {
+                const ETC2Block *sourceBlockRed = sourceRow + (x / 2);
+                uint8_t *destBlockRed           = destRow + (x * 4);
+                sourceBlockRed->transcodeAsBC4(destBlockRed, isSigned);
+
+                const ETC2Block *sourceBlockGreen = sourceBlockRed + 1;
+                uint8_t *destBlockGreen           = destBlockRed + 8;
+                sourceBlockGreen->transcodeAsBC4(destBlockGreen, isSigned);
+            }
+        }
+    }
+}
+
 void LoadETC2RGB8ToRGBA8(size_t width,
                          size_t height,
                          size_t depth,
@@ -1603,10 +1726,10 @@ void LoadETC2RGBA8ToRGBA8(size_t width,
 
             for (size_t x = 0; x < width; x += 4)
             {
+                // The whole alpha block is decoded since the color blocks are decoded whole.
                 const ETC2Block *sourceBlockAlpha = sourceRow + (x / 2);
                 sourceBlockAlpha->decodeAsSingleETC2Channel(
-                    reinterpret_cast<uint8_t *>(decodedAlphaValues), x, y, width, height, 1, 4,
-                    false);
+                    reinterpret_cast<uint8_t *>(decodedAlphaValues), 0, 0, 4, 4, 1, 4, false);
 
                 uint8_t *destPixels             = destRow + (x * 4);
                 const ETC2Block *sourceBlockRGB = sourceBlockAlpha + 1;
@@ -1617,6 +1740,42 @@ void LoadETC2RGBA8ToRGBA8(size_t width,
     }
 }
 
+void LoadETC2RGBA8ToBC3(size_t width,
+                        size_t height,
+                        size_t depth,
+                        const uint8_t *input,
+                        size_t inputRowPitch,
+                        size_t inputDepthPitch,
+                        uint8_t *output,
+                        size_t outputRowPitch,
+                        size_t outputDepthPitch,
+                        bool srgb)
+{
+    for (size_t z = 0; z < depth; z++)
+    {
+        for (size_t y = 0; y < height; y += 4)
+        {
+            const ETC2Block *sourceRow =
+                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
+            uint8_t *destRow = priv::OffsetDataPointer<uint8_t>(output, y / 4, z, outputRowPitch,
+                                                                outputDepthPitch);
+
+            for (size_t x = 0; x < width; x += 4)
+            {
+                const ETC2Block *sourceBlockAlpha = sourceRow + (x / 2);
+                uint8_t *destBlock                = destRow + (x * 4);
+                sourceBlockAlpha->transcodeAlphaAsBC3(destBlock);
+
+                // BC3 always decodes its color block with four colors, which is what the BC1
+                // transcoding of opaque blocks produces.
+                const ETC2Block *sourceBlockRGB = sourceBlockAlpha + 1;
+                sourceBlockRGB->transcodeAsBC1(destBlock + 8, x, y, width, height,
+                                               DefaultETCAlphaValues, false);
+            }
+        }
+    }
+}
+
 }  // anonymous namespace
 
 void LoadETC1RGB8ToRGBA8(size_t width,
@@ -1759,6 +1918,62 @@ void LoadEACRG11SToRG16(size_t width,
                       outputRowPitch, outputDepthPitch, true);
 }
 
+void LoadEACR11ToBC4(size_t width,
+                     size_t height,
+                     size_t depth,
+                     const uint8_t *input,
+                     size_t inputRowPitch,
+                     size_t inputDepthPitch,
+                     uint8_t *output,
+                     size_t outputRowPitch,
+                     size_t outputDepthPitch)
+{
+    LoadR11EACToBC4(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
+                    outputRowPitch, outputDepthPitch, false);
+}
+
+void LoadEACR11SToBC4(size_t width,
+                      size_t height,
+                      size_t depth,
+                      const uint8_t *input,
+                      size_t inputRowPitch,
+                      size_t inputDepthPitch,
+                      uint8_t *output,
+                      size_t outputRowPitch,
+                      size_t outputDepthPitch)
+{
+    LoadR11EACToBC4(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
+                    outputRowPitch, outputDepthPitch, true);
+}
+
+void LoadEACRG11ToBC5(size_t width,
+                      size_t height,
+                      size_t depth,
+                      const uint8_t *input,
+                      size_t inputRowPitch,
+                      size_t inputDepthPitch,
+                      uint8_t *output,
+                      size_t outputRowPitch,
+                      size_t outputDepthPitch)
+{
+    LoadRG11EACToBC5(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
+                     outputRowPitch, outputDepthPitch, false);
+}
+
+void LoadEACRG11SToBC5(size_t width,
+                       size_t height,
+                       size_t depth,
+                       const uint8_t *input,
+                       size_t inputRowPitch,
+                       size_t inputDepthPitch,
+                       uint8_t *output,
+                       size_t outputRowPitch,
+                       size_t outputDepthPitch)
+{
+    LoadRG11EACToBC5(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
+                     outputRowPitch, outputDepthPitch, true);
+}
+
 void LoadETC2RGB8ToRGBA8(size_t width,
                          size_t height,
                          size_t depth,
@@ -1899,4 +2114,32 @@ void LoadETC2SRGBA8ToSRGBA8(size_t width,
                          outputRowPitch, outputDepthPitch, true);
 }
 
+void LoadETC2RGBA8ToBC3(size_t width,
+                        size_t height,
+                        size_t depth,
+                        const uint8_t *input,
+                        size_t inputRowPitch,
+                        size_t inputDepthPitch,
+                        uint8_t *output,
+                        size_t outputRowPitch,
+                        size_t outputDepthPitch)
+{
+    LoadETC2RGBA8ToBC3(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
+                       outputRowPitch, outputDepthPitch, false);
+}
+
+void LoadETC2SRGBA8ToBC3(size_t width,
+                         size_t height,
+                         size_t depth,
+                         const uint8_t *input,
+                         size_t inputRowPitch,
+                         size_t inputDepthPitch,
+                         uint8_t *output,
+                         size_t outputRowPitch,
+                         size_t outputDepthPitch)
+{
+    LoadETC2RGBA8ToBC3(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
+                       outputRowPitch, outputDepthPitch, true);
+}
+
 }  // namespace angle
@@ -0,0 +1,293 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// loadimage_etc_unittest:
+//   Tests that the ETC decoders, which decode whole blocks, write only the pixels of images with
+//   partial blocks, and that the ETC2 and EAC to BC transcoders decode to the values of the ETC2
+//   and EAC decoders, within the precision of the BC formats, for images with partial blocks.
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "image_util/loadimage.h"
+
+namespace
+{
+
+constexpr size_t kBlockSize = 4;
+
+struct ImageSize
+{
+    size_t width;
+    size_t height;
+};
+
+const ImageSize kSizes[] = {{4, 4}, {13, 7}, {1, 2}, {64, 32}};
+
+size_t BlockCount(size_t size)
+{
+    return (size + kBlockSize - 1) / kBlockSize;
+}
+
+size_t Padded(size_t size)
+{
+    return BlockCount(size) * kBlockSize;
+}
+
+// Every combination of bits is a valid ETC2 or EAC block.
+std::vector<uint8_t> RandomBlocks(std::mt19937 *rng, const ImageSize &size, size_t blockBytes)
+{
+    std::vector<uint8_t> blocks(BlockCount(size.width) * BlockCount(size.height) * blockBytes);
+    for (uint8_t &byte : blocks)
+    {
+        byte = static_cast<uint8_t>((*rng)());
+    }
+    return blocks;
+}
+
+using LoadFunction = void (*)(size_t,
+                              size_t,
+                              size_t,
+                              const uint8_t *,
+                              size_t,
+                              size_t,
+                              uint8_t *,
+                              size_t,
+                              size_t);
+
+// Decodes an image with partial blocks into a buffer of the padded size, and compares it with the
+// decoding of the padded image: the pixels inside the image are the same and the others are not
+// written.
+void CheckPartialBlocks(LoadFunction decode, size_t blockBytes, size_t pixelBytes)
+{
+    for (const ImageSize &size : kSizes)
+    {
+        std::mt19937 rng(static_cast<uint32_t>(size.width * 100 + size.height));
+        std::vector<uint8_t> input = RandomBlocks(&rng, size, blockBytes);
+        const size_t rowPitch      = BlockCount(size.width) * blockBytes;
+        const size_t depthPitch    = rowPitch * BlockCount(size.height);
+
+        const size_t decodedRowPitch = Padded(size.width) * pixelBytes;
+        std::vector<uint8_t> padded(decodedRowPitch * Padded(size.height));
+        decode(Padded(size.width), Padded(size.height), 1, input.data(), rowPitch, depthPitch,
+               padded.data(), decodedRowPitch, padded.size());
+
+        std::vector<uint8_t> partial(padded.size(), 0xCD);
+        decode(size.width, size.height, 1, input.data(), rowPitch, depthPitch, partial.data(),
+               decodedRowPitch, partial.size());
+
+        for (size_t y = 0; y < Padded(size.height); y++)
+        {
+            for (size_t x = 0; x < Padded(size.width); x++)
+            {
+                for (size_t byte = 0; byte < pixelBytes; byte++)
+                {
+                    size_t offset = y * decodedRowPitch + x * pixelBytes + byte;
+                    bool inside   = x < size.width && y < size.height;
+                    EXPECT_EQ(inside ? padded[offset] : 0xCD, partial[offset])
+                        << size.width << "x" << size.height << " " << x << "," << y;
+                }
+            }
+        }
+    }
+}
+
+TEST(LoadImageETCTest, PartialBlocks)
+{
+    CheckPartialBlocks(angle::LoadETC1RGB8ToRGBA8, 8, 4);
+    CheckPartialBlocks(angle::LoadETC2RGB8ToRGBA8, 8, 4);
+    CheckPartialBlocks(angle::LoadETC2RGB8A1ToRGBA8, 8, 4);
+    CheckPartialBlocks(angle::LoadETC2RGBA8ToRGBA8, 16, 4);
+    CheckPartialBlocks(angle::LoadEACR11ToR8, 8, 1);
+    CheckPartialBlocks(angle::LoadEACR11SToR16, 8, 2);
+    CheckPartialBlocks(angle::LoadEACRG11ToRG16, 16, 4);
+}
+
+// Decodes pixel |index|, in row-major order, of a BC4 block to [0, 1], or to [-1, 1] if signed.
+float DecodeBC4(const uint8_t *block, size_t index, bool isSigned)
+{
+    float endpoint0 = isSigned ? std::max(-127.0f, static_cast<float>(int8_t(block[0]))) / 127.0f
+                               : block[0] / 255.0f;
+    float endpoint1 = isSigned ? std::max(-127.0f, static_cast<float>(int8_t(block[1]))) / 127.0f
+                               : block[1] / 255.0f;
+
+    uint64_t bits = 0;
+    for (size_t byte = 0; byte < 6; byte++)
+    {
+        bits |= static_cast<uint64_t>(block[2 + byte]) << (byte * 8);
+    }
+    size_t code = (bits >> (index * 3)) & 7;
+
+    switch (code)
+    {
+        case 0:
+            return endpoint0;
+        case 1:
+            return endpoint1;
+        default:
+            break;
+    }
+    if (endpoint0 > endpoint1)
+    {
+        return ((8 - code) * endpoint0 + (code - 1) * endpoint1) / 7.0f;
+    }
+    if (code >= 6)
+    {
+        return code == 6 ? (isSigned ? -1.0f : 0.0f) : 1.0f;
+    }
+    return ((6 - code) * endpoint0 + (code - 1) * endpoint1) / 5.0f;
+}
+
+// Checks a BC4 block against the 4x4 reference values in [0, 1] or [-1, 1]. Each value is at most
+// half an interpolation step away from the reference, plus the rounding of the endpoints.
+void CheckBC4Block(const uint8_t *block, const float reference[16], bool isSigned)
+{
+    float minValue = *std::min_element(reference, reference + 16);
+    float maxValue = *std::max_element(reference, reference + 16);
+    float rounding = isSigned ? 1.0f / 127.0f : 1.0f / 255.0f;
+    float bound    = (maxValue - minValue) / 14.0f + rounding + 1e-5f;
+
+    for (size_t index = 0; index < 16; index++)
+    {
+        EXPECT_NEAR(reference[index], DecodeBC4(block, index, isSigned), bound) << index;
+    }
+}
+
+// Compares |channels| interleaved BC4 blocks with the 16-bit EAC decoding of the same blocks, which
+// is decoded for whole blocks.
+void CheckEACToBC(const ImageSize &size, size_t channels, bool isSigned)
+{
+    LoadFunction transcode = nullptr;
+    LoadFunction decode    = nullptr;
+    if (channels == 1)
+    {
+        transcode = isSigned ? angle::LoadEACR11SToBC4 : angle::LoadEACR11ToBC4;
+        decode    = isSigned ? angle::LoadEACR11SToR16 : angle::LoadEACR11ToR16;
+    }
+    else
+    {
+        transcode = isSigned ? angle::LoadEACRG11SToBC5 : angle::LoadEACRG11ToBC5;
+        decode    = isSigned ? angle::LoadEACRG11SToRG16 : angle::LoadEACRG11ToRG16;
+    }
+
+    std::mt19937 rng(static_cast<uint32_t>(size.width * 100 + size.height));
+    const size_t blockBytes    = 8 * channels;
+    std::vector<uint8_t> input = RandomBlocks(&rng, size, blockBytes);
+    const size_t rowPitch      = BlockCount(size.width) * blockBytes;
+    const size_t depthPitch    = rowPitch * BlockCount(size.height);
+
+    std::vector<uint8_t> bc(input.size(), 0xCD);
+    transcode(size.width, size.height, 1, input.data(), rowPitch, depthPitch, bc.data(), rowPitch,
+              depthPitch);
+
+    const size_t decodedRowPitch = Padded(size.width) * channels * sizeof(uint16_t);
+    std::vector<uint8_t> decoded(decodedRowPitch * Padded(size.height));
+    decode(Padded(size.width), Padded(size.height), 1, input.data(), rowPitch, depthPitch,
+           decoded.data(), decodedRowPitch, decoded.size());
+
+    for (size_t blockY = 0; blockY < BlockCount(size.height); blockY++)
+    {
+        for (size_t blockX = 0; blockX < BlockCount(size.width); blockX++)
+        {
+            for (size_t channel = 0; channel < channels; channel++)
+            {
+                float reference[16];
+                for (size_t index = 0; index < 16; index++)
+                {
+                    size_t x              = blockX * kBlockSize + index % 4;
+                    size_t y              = blockY * kBlockSize + index / 4;
+                    const uint8_t *pixel  = &decoded[y * decodedRowPitch + x * channels * 2];
+                    const uint16_t *value = reinterpret_cast<const uint16_t *>(pixel) + channel;
+                    // The decoders scale 11 bits to 16.
+                    reference[index] = isSigned ? static_cast<int16_t>(*value) / 32 / 1023.0f
+                                                : (*value >> 5) / 2047.0f;
+                }
+
+                const uint8_t *block = &bc[blockY * rowPitch + blockX * blockBytes + channel * 8];
+                CheckBC4Block(block, reference, isSigned);
+            }
+        }
+    }
+}
+
+TEST(LoadImageETCTest, EACR11ToBC4)
+{
+    for (const ImageSize &size : kSizes)
+    {
+        CheckEACToBC(size, 1, false);
+        CheckEACToBC(size, 1, true);
+    }
+}
+
+TEST(LoadImageETCTest, EACRG11ToBC5)
+{
+    for (const ImageSize &size : kSizes)
+    {
+        CheckEACToBC(size, 2, false);
+        CheckEACToBC(size, 2, true);
+    }
+}
+
+// The alpha blocks decode to the alpha of the RGBA8 decoding, and the color blocks are the BC1
+// blocks of the RGB8 part.
+TEST(LoadImageETCTest, ETC2RGBA8ToBC3)
+{
+    for (const ImageSize &size : kSizes)
+    {
+        std::mt19937 rng(static_cast<uint32_t>(size.width * 100 + size.height));
+        std::vector<uint8_t> input = RandomBlocks(&rng, size, 16);
+        const size_t rowPitch      = BlockCount(size.width) * 16;
+        const size_t depthPitch    = rowPitch * BlockCount(size.height);
+
+        std::vector<uint8_t> bc(input.size(), 0xCD);
+        angle::LoadETC2RGBA8ToBC3(size.width, size.height, 1, input.data(), rowPitch, depthPitch,
+                                  bc.data(), rowPitch, depthPitch);
+
+        std::vector<uint8_t> rgbInput;
+        for (size_t block = 0; block < input.size() / 16; block++)
+        {
+            rgbInput.insert(rgbInput.end(), input.begin() + block * 16 + 8,
+                            input.begin() + block * 16 + 16);
+        }
+        const size_t rgbRowPitch   = rowPitch / 2;
+        const size_t rgbDepthPitch = depthPitch / 2;
+        std::vector<uint8_t> bc1(rgbInput.size(), 0xCD);
+        angle::LoadETC2RGB8ToBC1(size.width, size.height, 1, rgbInput.data(), rgbRowPitch,
+                                 rgbDepthPitch, bc1.data(), rgbRowPitch, rgbDepthPitch);
+
+        const size_t decodedRowPitch = Padded(size.width) * 4;
+        std::vector<uint8_t> decoded(decodedRowPitch * Padded(size.height));
+        angle::LoadETC2RGBA8ToRGBA8(Padded(size.width), Padded(size.height), 1, input.data(),
+                                    rowPitch, depthPitch, decoded.data(), decodedRowPitch,
+                                    decoded.size());
+
+        for (size_t blockY = 0; blockY < BlockCount(size.height); blockY++)
+        {
+            for (size_t blockX = 0; blockX < BlockCount(size.width); blockX++)
+            {
+                float reference[16];
+                for (size_t index = 0; index < 16; index++)
+                {
+                    size_t x         = blockX * kBlockSize + index % 4;
+                    size_t y         = blockY * kBlockSize + index / 4;
+                    reference[index] = decoded[y * decodedRowPitch + x * 4 + 3] / 255.0f;
+                }
+
+                const uint8_t *block = &bc[blockY * rowPitch + blockX * 16];
+                CheckBC4Block(block, reference, false);
+
+                const uint8_t *colorBlock = &bc1[blockY * rgbRowPitch + blockX * 8];
+                EXPECT_TRUE(std::equal(colorBlock, colorBlock + 8, block + 8))
+                    << blockX << "," << blockY;
+            }
+        }
+    }
+}
+
+}  // anonymous namespace
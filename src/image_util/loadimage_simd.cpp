@@ -0,0 +1,731 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// loadimage_simd.cpp: Vectorized row kernels used by the image loading functions.
+
+#include "image_util/loadimage_simd.h"
+
+#include <string.h>
+
+#include "common/mathutil.h"
+#include "common/platform.h"
+#include "image_util/simd_utils.h"
+
+namespace angle
+{
+
+namespace priv
+{
+
+namespace
+{
+
+#if defined(ANGLE_USE_SSE)
+
+// Loads four packed 3-byte pixels into the low three bytes of each 32-bit lane. Reads 16 bytes.
+inline __m128i Gather3To4(const uint8_t *source)
+{
+    __m128i data = LoadU(source);
+    __m128i ab   = _mm_unpacklo_epi32(data, _mm_srli_si128(data, 3));
+    __m128i cd   = _mm_unpacklo_epi32(_mm_srli_si128(data, 6), _mm_srli_si128(data, 9));
+    return _mm_and_si128(_mm_unpacklo_epi64(ab, cd), _mm_set1_epi32(0x00FFFFFF));
+}
+
+// Swaps the first and third bytes of each 32-bit lane.
+inline __m128i SwapRB(__m128i rgba)
+{
+    __m128i ga = _mm_and_si128(rgba, _mm_set1_epi32(static_cast<int>(0xFF00FF00)));
+    __m128i r  = _mm_slli_epi32(_mm_and_si128(rgba, _mm_set1_epi32(0x000000FF)), 16);
+    __m128i b  = _mm_and_si128(_mm_srli_epi32(rgba, 16), _mm_set1_epi32(0x000000FF));
+    return _mm_or_si128(ga, _mm_or_si128(r, b));
+}
+
+inline __m128i RGBA8ToBGRA4(__m128i rgba)
+{
+    __m128i r = _mm_and_si128(_mm_slli_epi32(rgba, 4), _mm_set1_epi32(0x0F00));
+    __m128i g = _mm_and_si128(_mm_srli_epi32(rgba, 8), _mm_set1_epi32(0x00F0));
+    __m128i b = _mm_and_si128(_mm_srli_epi32(rgba, 20), _mm_set1_epi32(0x000F));
+    __m128i a = _mm_and_si128(_mm_srli_epi32(rgba, 16), _mm_set1_epi32(0xF000));
+    return _mm_or_si128(_mm_or_si128(r, g), _mm_or_si128(b, a));
+}
+
+inline __m128i RGBA8ToBGR5A1(__m128i rgba)
+{
+    __m128i r = _mm_and_si128(_mm_slli_epi32(rgba, 7), _mm_set1_epi32(0x7C00));
+    __m128i g = _mm_and_si128(_mm_srli_epi32(rgba, 6), _mm_set1_epi32(0x03E0));
+    __m128i b = _mm_and_si128(_mm_srli_epi32(rgba, 19), _mm_set1_epi32(0x001F));
+    __m128i a = _mm_and_si128(_mm_srli_epi32(rgba, 16), _mm_set1_epi32(0x8000));
+    return _mm_or_si128(_mm_or_si128(r, g), _mm_or_si128(b, a));
+}
+
+inline __m128i RGB8ToBGR565(__m128i rgb)
+{
+    __m128i r = _mm_and_si128(_mm_slli_epi32(rgb, 8), _mm_set1_epi32(0xF800));
+    __m128i g = _mm_and_si128(_mm_srli_epi32(rgb, 5), _mm_set1_epi32(0x07E0));
+    __m128i b = _mm_and_si128(_mm_srli_epi32(rgb, 19), _mm_set1_epi32(0x001F));
+    return _mm_or_si128(r, _mm_or_si128(g, b));
+}
+
+#endif
+
+}  // anonymous namespace
+
+size_t LoadRowA8ToRGBA8(const uint8_t *source, uint32_t *dest, size_t width)
+{
+    size_t x = 0;
+#if defined(ANGLE_USE_SSE)
+    if (gl::supportsSSE2())
+    {
+        const __m128i zero = _mm_setzero_si128();
+        for (; x + 16 <= width; x += 16)
+        {
+            __m128i alpha = LoadU(&source[x]);
+            // Interleave with zeros twice to move each byte to the top of a 32-bit lane.
+            __m128i lo = _mm_unpacklo_epi8(zero, alpha);
+            __m128i hi = _mm_unpackhi_epi8(zero, alpha);
+            StoreU(&dest[x + 0], _mm_unpacklo_epi16(zero, lo));
+            StoreU(&dest[x + 4], _mm_unpackhi_epi16(zero, lo));
+            StoreU(&dest[x + 8], _mm_unpacklo_epi16(zero, hi));
+            StoreU(&dest[x + 12], _mm_unpackhi_epi16(zero, hi));
+        }
+    }
+#elif defined(ANGLE_USE_NEON)
+    uint8x16x4_t pixels;
+    pixels.val[0] = vdupq_n_u8(0);
+    pixels.val[1] = vdupq_n_u8(0);
+    pixels.val[2] = vdupq_n_u8(0);
+    for (; x + 16 <= width; x += 16)
+    {
+        pixels.val[3] = vld1q_u8(&source[x]);
+        vst4q_u8(reinterpret_cast<uint8_t *>(&dest[x]), pixels);
+    }
+#endif
+    return x;
+}
+
+size_t LoadRowL8ToRGBA8(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    size_t x = 0;
+#if defined(ANGLE_USE_SSE)
+    if (gl::supportsSSE2())
+    {
+        const __m128i opaque = _mm_set1_epi8(static_cast<char>(0xFF));
+        for (; x + 16 <= width; x += 16)
+        {
+            __m128i luminance = LoadU(&source[x]);
+            __m128i llLo      = _mm_unpacklo_epi8(luminance, luminance);
+            __m128i llHi      = _mm_unpackhi_epi8(luminance, luminance);
+            __m128i laLo      = _mm_unpacklo_epi8(luminance, opaque);
+            __m128i laHi      = _mm_unpackhi_epi8(luminance, opaque);
+            StoreU(&dest[4 * x + 0], _mm_unpacklo_epi16(llLo, laLo));
+            StoreU(&dest[4 * x + 16], _mm_unpackhi_epi16(llLo, laLo));
+            StoreU(&dest[4 * x + 32], _mm_unpacklo_epi16(llHi, laHi));
+            StoreU(&dest[4 * x + 48], _mm_unpackhi_epi16(llHi, laHi));
+        }
+    }
+#elif defined(ANGLE_USE_NEON)
+    uint8x16x4_t pixels;
+    pixels.val[3] = vdupq_n_u8(0xFF);
+    for (; x + 16 <= width; x += 16)
+    {
+        uint8x16_t luminance = vld1q_u8(&source[x]);
+        pixels.val[0]        = luminance;
+        pixels.val[1]        = luminance;
+        pixels.val[2]        = luminance;
+        vst4q_u8(&dest[4 * x], pixels);
+    }
+#endif
+    return x;
+}
+
+size_t LoadRowLA8ToRGBA8(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    size_t x = 0;
+#if defined(ANGLE_USE_SSE)
+    if (gl::supportsSSE2())
+    {
+        const __m128i lowByte = _mm_set1_epi16(0x00FF);
+        for (; x + 8 <= width; x += 8)
+        {
+            __m128i la = LoadU(&source[2 * x]);
+            __m128i l  = _mm_and_si128(la, lowByte);
+            __m128i ll = _mm_or_si128(l, _mm_slli_epi16(l, 8));
+            StoreU(&dest[4 * x + 0], _mm_unpacklo_epi16(ll, la));
+            StoreU(&dest[4 * x + 16], _mm_unpackhi_epi16(ll, la));
+        }
+    }
+#elif defined(ANGLE_USE_NEON)
+    for (; x + 16 <= width; x += 16)
+    {
+        uint8x16x2_t la = vld2q_u8(&source[2 * x]);
+        uint8x16x4_t pixels;
+        pixels.val[0] = la.val[0];
+        pixels.val[1] = la.val[0];
+        pixels.val[2] = la.val[0];
+        pixels.val[3] = la.val[1];
+        vst4q_u8(&dest[4 * x], pixels);
+    }
+#endif
+    return x;
+}
+
+size_t LoadRowRGBA8ToBGRA8(const uint32_t *source, uint32_t *dest, size_t width)
+{
+    size_t x = 0;
+#if defined(ANGLE_USE_SSE)
+    if (gl::supportsSSE2())
+    {
+        for (; x + 4 <= width; x += 4)
+        {
+            StoreU(&dest[x], SwapRB(LoadU(&source[x])));
+        }
+    }
+#elif defined(ANGLE_USE_NEON)
+    for (; x + 16 <= width; x += 16)
+    {
+        uint8x16x4_t pixels = vld4q_u8(reinterpret_cast<const uint8_t *>(&source[x]));
+        uint8x16_t red      = pixels.val[0];
+        pixels.val[0]       = pixels.val[2];
+        pixels.val[2]       = red;
+        vst4q_u8(reinterpret_cast<uint8_t *>(&dest[x]), pixels);
+    }
+#endif
+    return x;
+}
+
+size_t LoadRowRGB8ToBGRX8(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    size_t x = 0;
+#if defined(ANGLE_USE_SSE)
+    if (gl::supportsSSE2())
+    {
+        const __m128i opaque = _mm_set1_epi32(static_cast<int>(0xFF000000));
+        // Each gather reads 16 bytes for 12 bytes of pixels.
+        for (; x + 6 <= width; x += 4)
+        {
+            StoreU(&dest[4 * x], _mm_or_si128(SwapRB(Gather3To4(&source[3 * x])), opaque));
+        }
+    }
+#elif defined(ANGLE_USE_NEON)
+    uint8x16x4_t pixels;
+    pixels.val[3] = vdupq_n_u8(0xFF);
+    for (; x + 16 <= width; x += 16)
+    {
+        uint8x16x3_t rgb = vld3q_u8(&source[3 * x]);
+        pixels.val[0]    = rgb.val[2];
+        pixels.val[1]    = rgb.val[1];
+        pixels.val[2]    = rgb.val[0];
+        vst4q_u8(&dest[4 * x], pixels);
+    }
+#endif
+    return x;
+}
+
+size_t LoadRowRGB8ToBGR565(const uint8_t *source, uint16_t *dest, size_t width)
+{
+    size_t x = 0;
+#if defined(ANGLE_USE_SSE)
+    if (gl::supportsSSE2())
+    {
+        for (; x + 10 <= width; x += 8)
+        {
+            __m128i lo = RGB8ToBGR565(Gather3To4(&source[3 * x]));
+            __m128i hi = RGB8ToBGR565(Gather3To4(&source[3 * x + 12]));
+            StoreU(&dest[x], Pack32To16(lo, hi));
+        }
+    }
+#elif defined(ANGLE_USE_NEON)
+    for (; x + 8 <= width; x += 8)
+    {
+        uint8x8x3_t rgb = vld3_u8(&source[3 * x]);
+        uint16x8_t r5   = vmovl_u8(vshr_n_u8(rgb.val[0], 3));
+        uint16x8_t g6   = vmovl_u8(vshr_n_u8(rgb.val[1], 2));
+        uint16x8_t b5   = vmovl_u8(vshr_n_u8(rgb.val[2], 3));
+        vst1q_u16(&dest[x], vorrq_u16(vorrq_u16(vshlq_n_u16(r5, 11), vshlq_n_u16(g6, 5)), b5));
+    }
+#endif
+    return x;
+}
+
+size_t LoadRowRGBA8ToBGRA4(const uint32_t *source, uint16_t *dest, size_t width)
+{
+    size_t x = 0;
+#if defined(ANGLE_USE_SSE)
+    if (gl::supportsSSE2())
+    {
+        for (; x + 8 <= width; x += 8)
+        {
+            __m128i lo = RGBA8ToBGRA4(LoadU(&source[x]));
+            __m128i hi = RGBA8ToBGRA4(LoadU(&source[x + 4]));
+            StoreU(&dest[x], Pack32To16(lo, hi));
+        }
+    }
+#elif defined(ANGLE_USE_NEON)
+    for (; x + 8 <= width; x += 8)
+    {
+        uint8x8x4_t rgba = vld4_u8(reinterpret_cast<const uint8_t *>(&source[x]));
+        uint16x8_t r4    = vmovl_u8(vshr_n_u8(rgba.val[0], 4));
+        uint16x8_t g4    = vmovl_u8(vshr_n_u8(rgba.val[1], 4));
+        uint16x8_t b4    = vmovl_u8(vshr_n_u8(rgba.val[2], 4));
+        uint16x8_t a4    = vmovl_u8(vshr_n_u8(rgba.val[3], 4));
+        uint16x8_t ar    = vorrq_u16(vshlq_n_u16(a4, 12), vshlq_n_u16(r4, 8));
+        uint16x8_t gb    = vorrq_u16(vshlq_n_u16(g4, 4), b4);
+        vst1q_u16(&dest[x], vorrq_u16(ar, gb));
+    }
+#endif
+    return x;
+}
+
+size_t LoadRowRGBA8ToBGR5A1(const uint32_t *source, uint16_t *dest, size_t width)
+{
+    size_t x = 0;
+#if defined(ANGLE_USE_SSE)
+    if (gl::supportsSSE2())
+    {
+        for (; x + 8 <= width; x += 8)
+        {
+            __m128i lo = RGBA8ToBGR5A1(LoadU(&source[x]));
+            __m128i hi = RGBA8ToBGR5A1(LoadU(&source[x + 4]));
+            StoreU(&dest[x], Pack32To16(lo, hi));
+        }
+    }
+#elif defined(ANGLE_USE_NEON)
+    for (; x + 8 <= width; x += 8)
+    {
+        uint8x8x4_t rgba = vld4_u8(reinterpret_cast<const uint8_t *>(&source[x]));
+        uint16x8_t r5    = vmovl_u8(vshr_n_u8(rgba.val[0], 3));
+        uint16x8_t g5    = vmovl_u8(vshr_n_u8(rgba.val[1], 3));
+        uint16x8_t b5    = vmovl_u8(vshr_n_u8(rgba.val[2], 3));
+        uint16x8_t a1    = vmovl_u8(vshr_n_u8(rgba.val[3], 7));
+        uint16x8_t ar    = vorrq_u16(vshlq_n_u16(a1, 15), vshlq_n_u16(r5, 10));
+        uint16x8_t gb    = vorrq_u16(vshlq_n_u16(g5, 5), b5);
+        vst1q_u16(&dest[x], vorrq_u16(ar, gb));
+    }
+#endif
+    return x;
+}
+
+size_t LoadRow3To4(const uint8_t *source, uint8_t *dest, size_t width, uint8_t fourthValue)
+{
+    size_t x = 0;
+#if defined(ANGLE_USE_SSE)
+    if (gl::supportsSSE2())
+    {
+        const __m128i fourth = _mm_set1_epi32(static_cast<int>(uint32_t(fourthValue) << 24));
+        for (; x + 6 <= width; x += 4)
+        {
+            StoreU(&dest[4 * x], _mm_or_si128(Gather3To4(&source[3 * x]), fourth));
+        }
+    }
+#elif defined(ANGLE_USE_NEON)
+    uint8x16x4_t pixels;
+    pixels.val[3] = vdupq_n_u8(fourthValue);
+    for (; x + 16 <= width; x += 16)
+    {
+        uint8x16x3_t rgb = vld3q_u8(&source[3 * x]);
+        pixels.val[0]    = rgb.val[0];
+        pixels.val[1]    = rgb.val[1];
+        pixels.val[2]    = rgb.val[2];
+        vst4q_u8(&dest[4 * x], pixels);
+    }
+#endif
+    return x;
+}
+
+size_t LoadRow3To4(const uint16_t *source, uint16_t *dest, size_t width, uint16_t fourthValue)
+{
+    size_t x = 0;
+#if defined(ANGLE_USE_SSE)
+    if (gl::supportsSSE2())
+    {
+        const __m128i rgbMask   = _mm_set_epi32(0x0000FFFF, -1, 0x0000FFFF, -1);
+        const int shiftedFourth = static_cast<int>(uint32_t(fourthValue) << 16);
+        const __m128i fourth    = _mm_set_epi32(shiftedFourth, 0, shiftedFourth, 0);
+        // Two pixels per load, which reads 16 bytes for 12 bytes of pixels.
+        for (; x + 3 <= width; x += 2)
+        {
+            __m128i data   = LoadU(&source[3 * x]);
+            __m128i pixels = _mm_unpacklo_epi64(data, _mm_srli_si128(data, 6));
+            StoreU(&dest[4 * x], _mm_or_si128(_mm_and_si128(pixels, rgbMask), fourth));
+        }
+    }
+#elif defined(ANGLE_USE_NEON)
+    uint16x8x4_t pixels;
+    pixels.val[3] = vdupq_n_u16(fourthValue);
+    for (; x + 8 <= width; x += 8)
+    {
+        uint16x8x3_t rgb = vld3q_u16(&source[3 * x]);
+        pixels.val[0]    = rgb.val[0];
+        pixels.val[1]    = rgb.val[1];
+        pixels.val[2]    = rgb.val[2];
+        vst4q_u16(&dest[4 * x], pixels);
+    }
+#endif
+    return x;
+}
+
+size_t LoadRow3To4(const uint32_t *source, uint32_t *dest, size_t width, uint32_t fourthValue)
+{
+    size_t x = 0;
+#if defined(ANGLE_USE_SSE)
+    if (gl::supportsSSE2())
+    {
+        const __m128i rgbMask = _mm_set_epi32(0, -1, -1, -1);
+        const __m128i fourth  = _mm_set_epi32(static_cast<int>(fourthValue), 0, 0, 0);
+        // One pixel per load, which reads 16 bytes for 12 bytes of pixels.
+        for (; x + 2 <= width; x++)
+        {
+            __m128i pixel = _mm_and_si128(LoadU(&source[3 * x]), rgbMask);
+            StoreU(&dest[4 * x], _mm_or_si128(pixel, fourth));
+        }
+    }
+#elif defined(ANGLE_USE_NEON)
+    uint32x4x4_t pixels;
+    pixels.val[3] = vdupq_n_u32(fourthValue);
+    for (; x + 4 <= width; x += 4)
+    {
+        uint32x4x3_t rgb = vld3q_u32(&source[3 * x]);
+        pixels.val[0]    = rgb.val[0];
+        pixels.val[1]    = rgb.val[1];
+        pixels.val[2]    = rgb.val[2];
+        vst4q_u32(&dest[4 * x], pixels);
+    }
+#endif
+    return x;
+}
+
+size_t LoadRow32FTo16F(const float *source, uint16_t *dest, size_t count)
+{
+    size_t x = 0;
+#if defined(ANGLE_USE_SSE)
+    if (gl::supportsSSE2())
+    {
+        for (; x + 8 <= count; x += 8)
+        {
+            __m128i denormalLo;
+            __m128i denormalHi;
+            __m128i lo = Float32ToFloat16(LoadU(&source[x]), &denormalLo);
+            __m128i hi = Float32ToFloat16(LoadU(&source[x + 4]), &denormalHi);
+            StoreU(&dest[x], Pack32To16(lo, hi));
+
+            if (_mm_movemask_epi8(_mm_or_si128(denormalLo, denormalHi)) != 0)
+            {
+                for (size_t i = x; i < x + 8; i++)
+                {
+                    dest[i] = gl::float32ToFloat16(source[i]);
+                }
+            }
+        }
+    }
+#elif defined(ANGLE_USE_NEON)
+    for (; x + 8 <= count; x += 8)
+    {
+        const uint32_t *bits = reinterpret_cast<const uint32_t *>(&source[x]);
+        uint32x4_t denormalLo;
+        uint32x4_t denormalHi;
+        uint16x4_t lo = Float32ToFloat16(vld1q_u32(&bits[0]), &denormalLo);
+        uint16x4_t hi = Float32ToFloat16(vld1q_u32(&bits[4]), &denormalHi);
+        vst1q_u16(&dest[x], vcombine_u16(lo, hi));
+
+        if (AnyLane(vorrq_u32(denormalLo, denormalHi)))
+        {
+            for (size_t i = x; i < x + 8; i++)
+            {
+                dest[i] = gl::float32ToFloat16(source[i]);
+            }
+        }
+    }
+#endif
+    return x;
+}
+
+size_t EncodeBC4Indices(const int16_t *values,
+                        float low,
+                        float scale,
+                        uint8_t *indices,
+                        size_t count)
+{
+    size_t i = 0;
+#if defined(ANGLE_USE_SSE)
+    if (gl::supportsSSE2())
+    {
+        const __m128 lowValue  = _mm_set1_ps(low);
+        const __m128 scaleBy   = _mm_set1_ps(scale);
+        const __m128 half      = _mm_set1_ps(0.5f);
+        const __m128i zero     = _mm_setzero_si128();
+        const __m128i one      = _mm_set1_epi16(1);
+        const __m128i two      = _mm_set1_epi16(2);
+        const __m128i seven    = _mm_set1_epi16(7);
+        const __m128i eight    = _mm_set1_epi16(8);
+        for (; i + 8 <= count; i += 8)
+        {
+            __m128i value = LoadU(&values[i]);
+            __m128i sign  = _mm_srai_epi16(value, 15);
+            __m128 lo     = _mm_cvtepi32_ps(_mm_unpacklo_epi16(value, sign));
+            __m128 hi     = _mm_cvtepi32_ps(_mm_unpackhi_epi16(value, sign));
+            lo            = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(lo, lowValue), scaleBy), half);
+            hi            = _mm_add_ps(_mm_mul_ps(_mm_sub_ps(hi, lowValue), scaleBy), half);
+
+            __m128i position = _mm_packs_epi32(_mm_cvttps_epi32(lo), _mm_cvttps_epi32(hi));
+            position         = _mm_min_epi16(_mm_max_epi16(position, zero), seven);
+
+            // Positions 7 and 0 are the endpoints, indices 0 and 1. The others count down from 2.
+            __m128i index = _mm_and_si128(_mm_sub_epi16(eight, position), seven);
+            index = _mm_xor_si128(index, _mm_and_si128(_mm_cmplt_epi16(index, two), one));
+            _mm_storel_epi64(reinterpret_cast<__m128i *>(&indices[i]),
+                             _mm_packus_epi16(index, index));
+        }
+    }
+#elif defined(ANGLE_USE_NEON)
+    const float32x4_t lowValue = vdupq_n_f32(low);
+    const float32x4_t scaleBy  = vdupq_n_f32(scale);
+    const float32x4_t half     = vdupq_n_f32(0.5f);
+    const int16x8_t zero       = vdupq_n_s16(0);
+    const int16x8_t one        = vdupq_n_s16(1);
+    const int16x8_t two        = vdupq_n_s16(2);
+    const int16x8_t seven      = vdupq_n_s16(7);
+    const int16x8_t eight      = vdupq_n_s16(8);
+    for (; i + 8 <= count; i += 8)
+    {
+        int16x8_t value = vld1q_s16(&values[i]);
+        float32x4_t lo  = vcvtq_f32_s32(vmovl_s16(vget_low_s16(value)));
+        float32x4_t hi  = vcvtq_f32_s32(vmovl_s16(vget_high_s16(value)));
+        lo              = vaddq_f32(vmulq_f32(vsubq_f32(lo, lowValue), scaleBy), half);
+        hi              = vaddq_f32(vmulq_f32(vsubq_f32(hi, lowValue), scaleBy), half);
+
+        int16x8_t position =
+            vcombine_s16(vqmovn_s32(vcvtq_s32_f32(lo)), vqmovn_s32(vcvtq_s32_f32(hi)));
+        position = vminq_s16(vmaxq_s16(position, zero), seven);
+
+        // Positions 7 and 0 are the endpoints, indices 0 and 1. The others count down from 2.
+        int16x8_t index = vandq_s16(vsubq_s16(eight, position), seven);
+        index = veorq_s16(index, vandq_s16(vreinterpretq_s16_u16(vcltq_s16(index, two)), one));
+        vst1_u8(&indices[i], vqmovun_s16(index));
+    }
+#endif
+    return i;
+}
+
+size_t DecodeETCIndexedBlock(uint32_t msbBits,
+                             uint32_t lsbBits,
+                             const uint32_t *palettes,
+                             bool flip,
+                             const uint8_t *alphaValues,
+                             bool punchThroughAlpha,
+                             uint32_t *pixels)
+{
+#if defined(ANGLE_USE_SSE)
+    if (gl::supportsSSE2())
+    {
+        const __m128i msb       = _mm_set1_epi32(static_cast<int>(msbBits));
+        const __m128i lsb       = _mm_set1_epi32(static_cast<int>(lsbBits));
+        const __m128i colorMask = _mm_set1_epi32(0x00FFFFFF);
+        const __m128i zero      = _mm_setzero_si128();
+
+        // The colors of each index for the pixels of a row, in the first and last two rows.
+        __m128i colors[2][4];
+        for (size_t index = 0; index < 4; index++)
+        {
+            int first  = static_cast<int>(palettes[index]);
+            int second = static_cast<int>(palettes[4 + index]);
+            colors[0][index] =
+                flip ? _mm_set1_epi32(first) : _mm_setr_epi32(first, first, second, second);
+            colors[1][index] = flip ? _mm_set1_epi32(second) : colors[0][index];
+        }
+
+        // The index bits of the pixels of the first row.
+        __m128i rowBits = _mm_setr_epi32(0x1, 0x10, 0x100, 0x1000);
+        for (size_t y = 0; y < 4; y++)
+        {
+            const __m128i *rowColors = colors[y / 2];
+            __m128i msbSet           = _mm_cmpeq_epi32(_mm_and_si128(msb, rowBits), rowBits);
+            __m128i lsbSet           = _mm_cmpeq_epi32(_mm_and_si128(lsb, rowBits), rowBits);
+            __m128i color            = Select(msbSet, Select(lsbSet, rowColors[3], rowColors[2]),
+                                   Select(lsbSet, rowColors[1], rowColors[0]));
+
+            int alpha;
+            memcpy(&alpha, alphaValues + y * 4, sizeof(alpha));
+            __m128i alpha32 =
+                _mm_unpacklo_epi16(zero, _mm_unpacklo_epi8(zero, _mm_cvtsi32_si128(alpha)));
+            color = _mm_or_si128(_mm_and_si128(color, colorMask), alpha32);
+            if (punchThroughAlpha)
+            {
+                color = _mm_andnot_si128(_mm_andnot_si128(lsbSet, msbSet), color);
+            }
+
+            StoreU(pixels + y * 4, color);
+            rowBits = _mm_add_epi32(rowBits, rowBits);
+        }
+        return 16;
+    }
+#elif defined(ANGLE_USE_NEON)
+    const uint32x4_t msb       = vdupq_n_u32(msbBits);
+    const uint32x4_t lsb       = vdupq_n_u32(lsbBits);
+    const uint32x4_t colorMask = vdupq_n_u32(0x00FFFFFF);
+
+    // The colors of each index for the pixels of a row, in the first and last two rows.
+    uint32x4_t colors[2][4];
+    for (size_t index = 0; index < 4; index++)
+    {
+        uint32_t first  = palettes[index];
+        uint32_t second = palettes[4 + index];
+        colors[0][index] =
+            flip ? vdupq_n_u32(first) : vcombine_u32(vdup_n_u32(first), vdup_n_u32(second));
+        colors[1][index] = flip ? vdupq_n_u32(second) : colors[0][index];
+    }
+
+    // The index bits of the pixels of the first row.
+    static const uint32_t kFirstRowBits[4] = {0x1, 0x10, 0x100, 0x1000};
+    uint32x4_t rowBits                     = vld1q_u32(kFirstRowBits);
+    for (size_t y = 0; y < 4; y++)
+    {
+        const uint32x4_t *rowColors = colors[y / 2];
+        uint32x4_t msbSet           = vtstq_u32(msb, rowBits);
+        uint32x4_t lsbSet           = vtstq_u32(lsb, rowBits);
+        uint32x4_t color =
+            vbslq_u32(msbSet, vbslq_u32(lsbSet, rowColors[3], rowColors[2]),
+                      vbslq_u32(lsbSet, rowColors[1], rowColors[0]));
+
+        uint32_t alpha;
+        memcpy(&alpha, alphaValues + y * 4, sizeof(alpha));
+        uint32x4_t alpha32 = vshlq_n_u32(vmovl_u16(vget_low_u16(vmovl_u8(vcreate_u8(alpha)))), 24);
+        color              = vorrq_u32(vandq_u32(color, colorMask), alpha32);
+        if (punchThroughAlpha)
+        {
+            color = vbicq_u32(color, vbicq_u32(msbSet, lsbSet));
+        }
+
+        vst1q_u32(pixels + y * 4, color);
+        rowBits = vshlq_n_u32(rowBits, 1);
+    }
+    return 16;
+#endif
+    return 0;
+}
+
+size_t DecodeETCPlanarBlock(const int *origin,
+                            const int *horizontal,
+                            const int *vertical,
+                            const uint8_t *alphaValues,
+                            uint32_t *pixels)
+{
+    // Each pixel is ((x * (horizontal - origin) + y * (vertical - origin) + 2) >> 2) + origin, in
+    // 16-bit lanes, two pixels to a vector. The alpha lanes stay 0 until the alpha is inserted.
+    int16_t dx[3];
+    int16_t dy[3];
+    for (size_t channel = 0; channel < 3; channel++)
+    {
+        dx[channel] = static_cast<int16_t>(horizontal[channel] - origin[channel]);
+        dy[channel] = static_cast<int16_t>(vertical[channel] - origin[channel]);
+    }
+    const int16_t o[3] = {static_cast<int16_t>(origin[0]), static_cast<int16_t>(origin[1]),
+                          static_cast<int16_t>(origin[2])};
+
+#if defined(ANGLE_USE_SSE)
+    if (gl::supportsSSE2())
+    {
+        const __m128i zero      = _mm_setzero_si128();
+        const __m128i originRGB = _mm_setr_epi16(o[0], o[1], o[2], 0, o[0], o[1], o[2], 0);
+        const __m128i stepX     = _mm_setr_epi16(dx[0], dx[1], dx[2], 0, dx[0], dx[1], dx[2], 0);
+        const __m128i stepY     = _mm_setr_epi16(dy[0], dy[1], dy[2], 0, dy[0], dy[1], dy[2], 0);
+        const __m128i left  = _mm_mullo_epi16(_mm_setr_epi16(0, 0, 0, 0, 1, 1, 1, 1), stepX);
+        const __m128i right = _mm_mullo_epi16(_mm_setr_epi16(2, 2, 2, 2, 3, 3, 3, 3), stepX);
+
+        __m128i row = _mm_set1_epi16(2);
+        for (size_t y = 0; y < 4; y++)
+        {
+            __m128i left16 =
+                _mm_add_epi16(_mm_srai_epi16(_mm_add_epi16(left, row), 2), originRGB);
+            __m128i right16 =
+                _mm_add_epi16(_mm_srai_epi16(_mm_add_epi16(right, row), 2), originRGB);
+            __m128i color = _mm_packus_epi16(left16, right16);
+
+            int alpha;
+            memcpy(&alpha, alphaValues + y * 4, sizeof(alpha));
+            __m128i alpha32 =
+                _mm_unpacklo_epi16(zero, _mm_unpacklo_epi8(zero, _mm_cvtsi32_si128(alpha)));
+            StoreU(pixels + y * 4, _mm_or_si128(color, alpha32));
+            row = _mm_add_epi16(row, stepY);
+        }
+        return 16;
+    }
+#elif defined(ANGLE_USE_NEON)
+    const int16_t originLanes[8] = {o[0], o[1], o[2], 0, o[0], o[1], o[2], 0};
+    const int16_t stepXLanes[8]  = {dx[0], dx[1], dx[2], 0, dx[0], dx[1], dx[2], 0};
+    const int16_t stepYLanes[8]  = {dy[0], dy[1], dy[2], 0, dy[0], dy[1], dy[2], 0};
+    static const int16_t kLeftX[8]  = {0, 0, 0, 0, 1, 1, 1, 1};
+    static const int16_t kRightX[8] = {2, 2, 2, 2, 3, 3, 3, 3};
+
+    const int16x8_t originRGB = vld1q_s16(originLanes);
+    const int16x8_t stepX     = vld1q_s16(stepXLanes);
+    const int16x8_t stepY     = vld1q_s16(stepYLanes);
+    const int16x8_t left      = vmulq_s16(vld1q_s16(kLeftX), stepX);
+    const int16x8_t right     = vmulq_s16(vld1q_s16(kRightX), stepX);
+
+    int16x8_t row = vdupq_n_s16(2);
+    for (size_t y = 0; y < 4; y++)
+    {
+        int16x8_t left16  = vaddq_s16(vshrq_n_s16(vaddq_s16(left, row), 2), originRGB);
+        int16x8_t right16 = vaddq_s16(vshrq_n_s16(vaddq_s16(right, row), 2), originRGB);
+        uint32x4_t color =
+            vreinterpretq_u32_u8(vcombine_u8(vqmovun_s16(left16), vqmovun_s16(right16)));
+
+        uint32_t alpha;
+        memcpy(&alpha, alphaValues + y * 4, sizeof(alpha));
+        uint32x4_t alpha32 = vshlq_n_u32(vmovl_u16(vget_low_u16(vmovl_u8(vcreate_u8(alpha)))), 24);
+        vst1q_u32(pixels + y * 4, vorrq_u32(color, alpha32));
+        row = vaddq_s16(row, stepY);
+    }
+    return 16;
+#endif
+    return 0;
+}
+
+size_t DecodeEACValues(const int16_t *modifiers,
+                       int base,
+                       int multiplier,
+                       int minValue,
+                       int maxValue,
+                       int shift,
+                       uint16_t *values,
+                       size_t count)
+{
+    size_t i = 0;
+#if defined(ANGLE_USE_SSE)
+    if (gl::supportsSSE2())
+    {
+        const __m128i baseValue  = _mm_set1_epi16(static_cast<short>(base));
+        const __m128i multiplyBy = _mm_set1_epi16(static_cast<short>(multiplier));
+        const __m128i low        = _mm_set1_epi16(static_cast<short>(minValue));
+        const __m128i high       = _mm_set1_epi16(static_cast<short>(maxValue));
+        const __m128i shiftBy    = _mm_cvtsi32_si128(shift);
+        for (; i + 8 <= count; i += 8)
+        {
+            __m128i value =
+                _mm_add_epi16(_mm_mullo_epi16(LoadU(&modifiers[i]), multiplyBy), baseValue);
+            value = _mm_min_epi16(_mm_max_epi16(value, low), high);
+            StoreU(&values[i], _mm_sll_epi16(value, shiftBy));
+        }
+    }
+#elif defined(ANGLE_USE_NEON)
+    const int16x8_t baseValue = vdupq_n_s16(static_cast<int16_t>(base));
+    const int16x8_t low       = vdupq_n_s16(static_cast<int16_t>(minValue));
+    const int16x8_t high      = vdupq_n_s16(static_cast<int16_t>(maxValue));
+    const int16x8_t shiftBy   = vdupq_n_s16(static_cast<int16_t>(shift));
+    for (; i + 8 <= count; i += 8)
+    {
+        int16x8_t value = vmlaq_n_s16(baseValue, vld1q_s16(&modifiers[i]),
+                                      static_cast<int16_t>(multiplier));
+        value           = vminq_s16(vmaxq_s16(value, low), high);
+        vst1q_u16(&values[i], vreinterpretq_u16_s16(vshlq_s16(value, shiftBy)));
+    }
+#endif
+    return i;
+}
+
+}  // namespace priv
+
+}  // namespace angle
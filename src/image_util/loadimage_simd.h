@@ -0,0 +1,110 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// loadimage_simd.h: Vectorized row kernels used by the image loading functions. Each kernel
+// converts as many leading pixels of a row as its vector width allows and returns how many it
+// wrote; the caller finishes the row with its scalar loop. The block kernels decode all the pixels
+// of a 4x4 block, or none. The kernels produce exactly the same bits as the scalar loops. SSE2 is
+// selected at runtime and NEON at compile time; without either, the kernels return 0.
+
+#ifndef IMAGEUTIL_LOADIMAGE_SIMD_H_
+#define IMAGEUTIL_LOADIMAGE_SIMD_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace angle
+{
+
+namespace priv
+{
+
+size_t LoadRowA8ToRGBA8(const uint8_t *source, uint32_t *dest, size_t width);
+size_t LoadRowL8ToRGBA8(const uint8_t *source, uint8_t *dest, size_t width);
+size_t LoadRowLA8ToRGBA8(const uint8_t *source, uint8_t *dest, size_t width);
+size_t LoadRowRGBA8ToBGRA8(const uint32_t *source, uint32_t *dest, size_t width);
+size_t LoadRowRGB8ToBGRX8(const uint8_t *source, uint8_t *dest, size_t width);
+
+size_t LoadRowRGB8ToBGR565(const uint8_t *source, uint16_t *dest, size_t width);
+size_t LoadRowRGBA8ToBGRA4(const uint32_t *source, uint16_t *dest, size_t width);
+size_t LoadRowRGBA8ToBGR5A1(const uint32_t *source, uint16_t *dest, size_t width);
+
+// Expands three component pixels to four, setting the fourth component to |fourthValue|.
+size_t LoadRow3To4(const uint8_t *source, uint8_t *dest, size_t width, uint8_t fourthValue);
+size_t LoadRow3To4(const uint16_t *source, uint16_t *dest, size_t width, uint16_t fourthValue);
+size_t LoadRow3To4(const uint32_t *source, uint32_t *dest, size_t width, uint32_t fourthValue);
+
+// Same results as gl::float32ToFloat16. |count| is in components, not pixels.
+size_t LoadRow32FTo16F(const float *source, uint16_t *dest, size_t count);
+
+// Picks the BC4 index of each value: the position of the value between the low endpoint |low| and
+// the high one, (value - |low|) * |scale| rounded to [0, 7], reordered the way BC4 numbers them.
+size_t EncodeBC4Indices(const int16_t *values,
+                        float low,
+                        float scale,
+                        uint8_t *indices,
+                        size_t count);
+
+// Decodes the pixels of an ETC1 or ETC2 individual, differential, T or H block to RGBA8, in
+// row-major order. Bit x * 4 + y of |msbBits| and |lsbBits| holds the index of pixel (x, y) in its
+// subblock's four colors of |palettes|, which has those of the first subblock then the second. The
+// second subblock is the bottom half of a flipped block and the right half otherwise. The alpha of
+// the pixels is |alphaValues|, in row-major order, except for the transparent black pixels of index
+// 2 of punch-through alpha blocks.
+size_t DecodeETCIndexedBlock(uint32_t msbBits,
+                             uint32_t lsbBits,
+                             const uint32_t *palettes,
+                             bool flip,
+                             const uint8_t *alphaValues,
+                             bool punchThroughAlpha,
+                             uint32_t *pixels);
+
+// Decodes the pixels of an ETC2 planar block to RGBA8, in row-major order, from the 8-bit RGB
+// colors of its origin, horizontal and vertical corners and the alpha in |alphaValues|.
+size_t DecodeETCPlanarBlock(const int *origin,
+                            const int *horizontal,
+                            const int *vertical,
+                            const uint8_t *alphaValues,
+                            uint32_t *pixels);
+
+// Computes |base| + |modifiers| * |multiplier|, clamped to [|minValue|, |maxValue|] and multiplied
+// by 2^|shift|, for the pixels of single channel ETC2 and EAC blocks. The unclamped values must fit
+// in 16 signed bits.
+size_t DecodeEACValues(const int16_t *modifiers,
+                       int base,
+                       int multiplier,
+                       int minValue,
+                       int maxValue,
+                       int shift,
+                       uint16_t *values,
+                       size_t count);
+
+template <size_t size>
+struct UnsignedOfSize;
+
+template <>
+struct UnsignedOfSize<1>
+{
+    using Type = uint8_t;
+};
+
+template <>
+struct UnsignedOfSize<2>
+{
+    using Type = uint16_t;
+};
+
+template <>
+struct UnsignedOfSize<4>
+{
+    using Type = uint32_t;
+};
+
+}  // namespace priv
+
+}  // namespace angle
+
+#endif  // IMAGEUTIL_LOADIMAGE_SIMD_H_
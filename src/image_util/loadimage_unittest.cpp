@@ -0,0 +1,400 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// loadimage_unittest:
+//   Tests that the image loading functions with vector kernels match a per-pixel reference for
+//   all row widths, including the leftover pixels the kernels don't handle.
+//
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "common/mathutil.h"
+#include "image_util/loadimage.h"
+#include "image_util/loadimage_simd.h"
+
+namespace
+{
+
+using LoadFunction = void (*)(size_t,
+                              size_t,
+                              size_t,
+                              const uint8_t *,
+                              size_t,
+                              size_t,
+                              uint8_t *,
+                              size_t,
+                              size_t);
+
+// Computes one output pixel from one input pixel.
+using ReferenceFunction = void (*)(const uint8_t *source, uint8_t *dest);
+
+constexpr size_t kMaxWidth  = 67;
+constexpr size_t kHeight    = 3;
+constexpr size_t kRowOffset = 5;
+
+// Loads images of every width up to kMaxWidth, with rows that start at odd offsets, and compares
+// the results and the padding between rows with the reference.
+void CheckLoadFunction(LoadFunction loadFunction,
+                       ReferenceFunction referenceFunction,
+                       size_t inputPixelBytes,
+                       size_t outputPixelBytes)
+{
+    std::mt19937 rng(1);
+
+    for (size_t width = 1; width <= kMaxWidth; width++)
+    {
+        size_t inputRowPitch  = width * inputPixelBytes + kRowOffset;
+        size_t outputRowPitch = width * outputPixelBytes + kRowOffset;
+
+        std::vector<uint8_t> input(inputRowPitch * kHeight);
+        for (uint8_t &byte : input)
+        {
+            byte = static_cast<uint8_t>(rng());
+        }
+
+        std::vector<uint8_t> output(outputRowPitch * kHeight, 0xCD);
+        std::vector<uint8_t> expected(output);
+        for (size_t y = 0; y < kHeight; y++)
+        {
+            for (size_t x = 0; x < width; x++)
+            {
+                referenceFunction(&input[y * inputRowPitch + x * inputPixelBytes],
+                                  &expected[y * outputRowPitch + x * outputPixelBytes]);
+            }
+        }
+
+        loadFunction(width, kHeight, 1, input.data(), inputRowPitch, 0, output.data(),
+                     outputRowPitch, 0);
+        ASSERT_EQ(expected, output) << "width " << width;
+    }
+}
+
+template <typename T>
+T Read(const uint8_t *source, size_t index)
+{
+    T value;
+    memcpy(&value, source + index * sizeof(T), sizeof(T));
+    return value;
+}
+
+template <typename T>
+void Write(uint8_t *dest, size_t index, T value)
+{
+    memcpy(dest + index * sizeof(T), &value, sizeof(T));
+}
+
+void ReferenceA8ToRGBA8(const uint8_t *source, uint8_t *dest)
+{
+    Write<uint32_t>(dest, 0, static_cast<uint32_t>(source[0]) << 24);
+}
+
+void ReferenceL8ToRGBA8(const uint8_t *source, uint8_t *dest)
+{
+    dest[0] = dest[1] = dest[2] = source[0];
+    dest[3]                     = 0xFF;
+}
+
+void ReferenceLA8ToRGBA8(const uint8_t *source, uint8_t *dest)
+{
+    dest[0] = dest[1] = dest[2] = source[0];
+    dest[3]                     = source[1];
+}
+
+void ReferenceRGBA8ToBGRA8(const uint8_t *source, uint8_t *dest)
+{
+    dest[0] = source[2];
+    dest[1] = source[1];
+    dest[2] = source[0];
+    dest[3] = source[3];
+}
+
+void ReferenceRGB8ToBGRX8(const uint8_t *source, uint8_t *dest)
+{
+    dest[0] = source[2];
+    dest[1] = source[1];
+    dest[2] = source[0];
+    dest[3] = 0xFF;
+}
+
+void ReferenceRGB8ToBGR565(const uint8_t *source, uint8_t *dest)
+{
+    Write<uint16_t>(dest, 0, static_cast<uint16_t>(((source[0] >> 3) << 11) |
+                                                   ((source[1] >> 2) << 5) | (source[2] >> 3)));
+}
+
+void ReferenceRGBA8ToBGRA4(const uint8_t *source, uint8_t *dest)
+{
+    Write<uint16_t>(dest, 0, static_cast<uint16_t>(((source[3] >> 4) << 12) |
+                                                   ((source[0] >> 4) << 8) |
+                                                   ((source[1] >> 4) << 4) | (source[2] >> 4)));
+}
+
+void ReferenceRGBA8ToBGR5A1(const uint8_t *source, uint8_t *dest)
+{
+    Write<uint16_t>(dest, 0, static_cast<uint16_t>(((source[3] >> 7) << 15) |
+                                                   ((source[0] >> 3) << 10) |
+                                                   ((source[1] >> 3) << 5) | (source[2] >> 3)));
+}
+
+template <typename T, uint32_t fourthComponentBits>
+void Reference3To4(const uint8_t *source, uint8_t *dest)
+{
+    memcpy(dest, source, 3 * sizeof(T));
+    Write<T>(dest, 3, gl::bitCast<T>(fourthComponentBits));
+}
+
+template <size_t componentCount>
+void Reference32FTo16F(const uint8_t *source, uint8_t *dest)
+{
+    for (size_t component = 0; component < componentCount; component++)
+    {
+        Write<uint16_t>(dest, component,
+                        gl::float32ToFloat16(Read<float>(source, component)));
+    }
+}
+
+TEST(LoadImageTest, Swizzles)
+{
+    CheckLoadFunction(angle::LoadA8ToRGBA8, ReferenceA8ToRGBA8, 1, 4);
+    CheckLoadFunction(angle::LoadL8ToRGBA8, ReferenceL8ToRGBA8, 1, 4);
+    CheckLoadFunction(angle::LoadLA8ToRGBA8, ReferenceLA8ToRGBA8, 2, 4);
+    CheckLoadFunction(angle::LoadRGBA8ToBGRA8, ReferenceRGBA8ToBGRA8, 4, 4);
+    CheckLoadFunction(angle::LoadRGB8ToBGRX8, ReferenceRGB8ToBGRX8, 3, 4);
+}
+
+TEST(LoadImageTest, Packing)
+{
+    CheckLoadFunction(angle::LoadRGB8ToBGR565, ReferenceRGB8ToBGR565, 3, 2);
+    CheckLoadFunction(angle::LoadRGBA8ToBGRA4, ReferenceRGBA8ToBGRA4, 4, 2);
+    CheckLoadFunction(angle::LoadRGBA8ToBGR5A1, ReferenceRGBA8ToBGR5A1, 4, 2);
+}
+
+TEST(LoadImageTest, ThreeToFour)
+{
+    CheckLoadFunction(angle::LoadToNative3To4<uint8_t, 0xFF>, Reference3To4<uint8_t, 0xFF>, 3,
+                      4);
+    CheckLoadFunction(angle::LoadToNative3To4<int8_t, 0x7F>, Reference3To4<int8_t, 0x7F>, 3, 4);
+    CheckLoadFunction(angle::LoadToNative3To4<uint16_t, gl::Float16One>,
+                      Reference3To4<uint16_t, gl::Float16One>, 6, 8);
+    CheckLoadFunction(angle::LoadToNative3To4<uint32_t, 0xFFFFFFFF>,
+                      Reference3To4<uint32_t, 0xFFFFFFFF>, 12, 16);
+    CheckLoadFunction(angle::LoadToNative3To4<float, gl::Float32One>,
+                      Reference3To4<float, gl::Float32One>, 12, 16);
+}
+
+TEST(LoadImageTest, Float32ToFloat16)
+{
+    // Random bit patterns cover NaNs, infinities and denormals along with everything else.
+    CheckLoadFunction(angle::Load32FTo16F<1>, Reference32FTo16F<1>, 4, 2);
+    CheckLoadFunction(angle::Load32FTo16F<3>, Reference32FTo16F<3>, 12, 6);
+    CheckLoadFunction(angle::Load32FTo16F<4>, Reference32FTo16F<4>, 16, 8);
+}
+
+// Values around every threshold of the conversion, in runs long enough for the vector kernel.
+TEST(LoadImageTest, Float32ToFloat16Thresholds)
+{
+    const uint32_t kThresholds[] = {0x00000000, 0x2D000000, 0x33000000, 0x38800000,
+                                    0x3F800000, 0x477FE000, 0x47FFEFFF, 0x7F800000,
+                                    0x7FC00000, 0x7FFFFFFF};
+
+    std::vector<float> input;
+    for (uint32_t threshold : kThresholds)
+    {
+        for (uint32_t sign : {0u, 0x80000000u})
+        {
+            for (uint32_t delta = 0; delta < 32; delta++)
+            {
+                input.push_back(gl::bitCast<float>((threshold - 16 + delta) | sign));
+                input.push_back(gl::bitCast<float>((threshold + (delta << 13)) | sign));
+            }
+        }
+    }
+
+    std::vector<uint16_t> output(input.size());
+    size_t converted = angle::priv::LoadRow32FTo16F(input.data(), output.data(), input.size());
+    for (size_t index = converted; index < input.size(); index++)
+    {
+        output[index] = gl::float32ToFloat16(input[index]);
+    }
+
+    for (size_t index = 0; index < input.size(); index++)
+    {
+        EXPECT_EQ(gl::float32ToFloat16(input[index]), output[index])
+            << std::hex << gl::bitCast<uint32_t>(input[index]);
+    }
+}
+
+// The vector kernel picks the same BC4 indices as the scalar loop of the ETC2 transcoders, for
+// values between the endpoints and values the rounding of the endpoints left outside of them.
+TEST(LoadImageTest, EncodeBC4Indices)
+{
+    std::mt19937 rng(1);
+
+    for (size_t block = 0; block < 1000; block++)
+    {
+        int low  = static_cast<int>(rng() % 2048) - 1024;
+        int high = low + 1 + static_cast<int>(rng() % 300);
+        std::vector<int16_t> values(37);
+        for (int16_t &value : values)
+        {
+            value = static_cast<int16_t>(low - 4 + static_cast<int>(rng() % (high - low + 9)));
+        }
+
+        const float lowValue = static_cast<float>(low) + 0.25f;
+        const float scale    = 7.0f / static_cast<float>(high - low);
+
+        std::vector<uint8_t> indices(values.size());
+        size_t encoded = angle::priv::EncodeBC4Indices(values.data(), lowValue, scale,
+                                                       indices.data(), values.size());
+        for (size_t index = 0; index < encoded; index++)
+        {
+            int position =
+                gl::clamp(static_cast<int>((values[index] - lowValue) * scale + 0.5f), 0, 7);
+            int expected = (8 - position) & 7;
+            expected     = expected < 2 ? expected ^ 1 : expected;
+            EXPECT_EQ(expected, indices[index]) << values[index];
+        }
+    }
+}
+
+// The ETC block kernels decode the same pixels as the per-pixel formulas.
+TEST(LoadImageTest, DecodeETCIndexedBlock)
+{
+    std::mt19937 rng(1);
+
+    for (size_t block = 0; block < 1000; block++)
+    {
+        uint32_t msbBits = rng() & 0xFFFF;
+        uint32_t lsbBits = rng() & 0xFFFF;
+        uint32_t palettes[8];
+        for (uint32_t &color : palettes)
+        {
+            color = rng();
+        }
+        uint8_t alphaValues[16];
+        for (uint8_t &alpha : alphaValues)
+        {
+            alpha = static_cast<uint8_t>(rng());
+        }
+        bool flip              = (block & 1) != 0;
+        bool punchThroughAlpha = (block & 2) != 0;
+
+        uint32_t pixels[16];
+        size_t decoded = angle::priv::DecodeETCIndexedBlock(
+            msbBits, lsbBits, palettes, flip, alphaValues, punchThroughAlpha, pixels);
+        if (decoded == 0)
+        {
+            continue;
+        }
+        ASSERT_EQ(16u, decoded);
+
+        for (size_t y = 0; y < 4; y++)
+        {
+            for (size_t x = 0; x < 4; x++)
+            {
+                size_t bit      = x * 4 + y;
+                size_t index    = ((msbBits >> bit) & 1) << 1 | ((lsbBits >> bit) & 1);
+                size_t subblock = (flip ? y : x) / 2;
+                uint32_t expected = (palettes[subblock * 4 + index] & 0x00FFFFFF) |
+                                    static_cast<uint32_t>(alphaValues[y * 4 + x]) << 24;
+                if (punchThroughAlpha && index == 2)
+                {
+                    expected = 0;
+                }
+                EXPECT_EQ(expected, pixels[y * 4 + x]) << x << "," << y;
+            }
+        }
+    }
+}
+
+TEST(LoadImageTest, DecodeETCPlanarBlock)
+{
+    std::mt19937 rng(1);
+
+    for (size_t block = 0; block < 1000; block++)
+    {
+        int origin[3];
+        int horizontal[3];
+        int vertical[3];
+        for (size_t channel = 0; channel < 3; channel++)
+        {
+            origin[channel]     = static_cast<int>(rng() % 256);
+            horizontal[channel] = static_cast<int>(rng() % 256);
+            vertical[channel]   = static_cast<int>(rng() % 256);
+        }
+        uint8_t alphaValues[16];
+        for (uint8_t &alpha : alphaValues)
+        {
+            alpha = static_cast<uint8_t>(rng());
+        }
+
+        uint32_t pixels[16];
+        size_t decoded =
+            angle::priv::DecodeETCPlanarBlock(origin, horizontal, vertical, alphaValues, pixels);
+        if (decoded == 0)
+        {
+            continue;
+        }
+        ASSERT_EQ(16u, decoded);
+
+        for (int y = 0; y < 4; y++)
+        {
+            for (int x = 0; x < 4; x++)
+            {
+                uint32_t expected = static_cast<uint32_t>(alphaValues[y * 4 + x]) << 24;
+                for (size_t channel = 0; channel < 3; channel++)
+                {
+                    int stepX = horizontal[channel] - origin[channel];
+                    int stepY = vertical[channel] - origin[channel];
+                    int value = ((x * stepX + y * stepY + 2) >> 2) + origin[channel];
+                    expected |= static_cast<uint32_t>(gl::clamp(value, 0, 255)) << (channel * 8);
+                }
+                EXPECT_EQ(expected, pixels[y * 4 + x]) << x << "," << y;
+            }
+        }
+    }
+}
+
+TEST(LoadImageTest, DecodeEACValues)
+{
+    std::mt19937 rng(1);
+
+    for (size_t block = 0; block < 1000; block++)
+    {
+        // The 11-bit EAC values scaled to 16 bits, and the 8-bit ETC2 values.
+        bool isEAC    = (block & 1) != 0;
+        bool isSigned = (block & 2) != 0;
+        int minValue  = isEAC ? (isSigned ? -1023 : 0) : (isSigned ? -128 : 0);
+        int maxValue  = isEAC ? (isSigned ? 1023 : 2047) : (isSigned ? 127 : 255);
+        int base = isEAC ? static_cast<int>(rng() % 256) * 8 + 4 : static_cast<int>(rng() % 256);
+        if (isSigned)
+        {
+            base -= isEAC ? 1024 : 128;
+        }
+        int multiplier = isEAC ? static_cast<int>(rng() % 16) * 8 : static_cast<int>(rng() % 16);
+        int shift      = isEAC ? 5 : 0;
+
+        std::vector<int16_t> modifiers(37);
+        for (int16_t &modifier : modifiers)
+        {
+            modifier = static_cast<int16_t>(static_cast<int>(rng() % 31) - 15);
+        }
+
+        std::vector<uint16_t> values(modifiers.size());
+        size_t decoded = angle::priv::DecodeEACValues(modifiers.data(), base, multiplier, minValue,
+                                                      maxValue, shift, values.data(),
+                                                      modifiers.size());
+        for (size_t index = 0; index < decoded; index++)
+        {
+            int value = gl::clamp(base + modifiers[index] * multiplier, minValue, maxValue);
+            EXPECT_EQ(static_cast<uint16_t>(value * (1 << shift)), values[index]) << index;
+        }
+    }
+}
+
+}  // anonymous namespace
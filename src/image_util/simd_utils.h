@@ -0,0 +1,106 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// simd_utils.h: Vector helpers shared by the image loading and mip generation kernels. Only
+// included by the files that implement kernels, after checking which instruction set is in use.
+
+#ifndef IMAGEUTIL_SIMD_UTILS_H_
+#define IMAGEUTIL_SIMD_UTILS_H_
+
+#include "common/platform.h"
+
+namespace angle
+{
+
+namespace priv
+{
+
+#if defined(ANGLE_USE_SSE)
+
+inline __m128i LoadU(const void *source)
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(source));
+}
+
+inline void StoreU(void *dest, __m128i value)
+{
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dest), value);
+}
+
+// Packs the low halves of the 32-bit lanes of |lo| and |hi| into 16-bit lanes. SSE2 only has a
+// signed saturating pack, so the values are biased into the signed range and back.
+inline __m128i Pack32To16(__m128i lo, __m128i hi)
+{
+    const __m128i bias32 = _mm_set1_epi32(0x8000);
+    const __m128i bias16 = _mm_set1_epi16(static_cast<short>(0x8000));
+    __m128i packed       = _mm_packs_epi32(_mm_sub_epi32(lo, bias32), _mm_sub_epi32(hi, bias32));
+    return _mm_xor_si128(packed, bias16);
+}
+
+inline __m128i Select(__m128i mask, __m128i ifTrue, __m128i ifFalse)
+{
+    return _mm_or_si128(_mm_and_si128(mask, ifTrue), _mm_andnot_si128(mask, ifFalse));
+}
+
+// Converts four floats the same way as gl::float32ToFloat16, except for results that are half
+// float denormals. Lanes that need the denormal path are flagged in |denormalOut|.
+inline __m128i Float32ToFloat16(__m128i bits, __m128i *denormalOut)
+{
+    __m128i sign = _mm_and_si128(_mm_srli_epi32(bits, 16), _mm_set1_epi32(0x8000));
+    __m128i abs  = _mm_and_si128(bits, _mm_set1_epi32(0x7FFFFFFF));
+
+    __m128i infinity = _mm_cmpgt_epi32(abs, _mm_set1_epi32(0x47FFEFFF));
+    __m128i small    = _mm_cmplt_epi32(abs, _mm_set1_epi32(0x38800000));
+    // Values this small are shifted all the way out by the denormal path and become zero.
+    __m128i zero = _mm_cmplt_epi32(abs, _mm_set1_epi32(0x2D000000));
+    *denormalOut = _mm_andnot_si128(zero, small);
+
+    __m128i bias   = _mm_set1_epi32(static_cast<int>(0xC8000FFF));
+    __m128i round  = _mm_and_si128(_mm_srli_epi32(abs, 13), _mm_set1_epi32(1));
+    __m128i normal = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(abs, bias), round), 13);
+
+    __m128i result = Select(infinity, _mm_set1_epi32(0x7FFF), normal);
+    result         = _mm_andnot_si128(small, result);
+    return _mm_or_si128(result, sign);
+}
+
+#elif defined(ANGLE_USE_NEON)
+
+// Converts four floats the same way as gl::float32ToFloat16, except for results that are half
+// float denormals. Lanes that need the denormal path are flagged in |denormalOut|.
+inline uint16x4_t Float32ToFloat16(uint32x4_t bits, uint32x4_t *denormalOut)
+{
+    uint32x4_t sign = vandq_u32(vshrq_n_u32(bits, 16), vdupq_n_u32(0x8000));
+    uint32x4_t abs  = vandq_u32(bits, vdupq_n_u32(0x7FFFFFFF));
+
+    uint32x4_t infinity = vcgtq_u32(abs, vdupq_n_u32(0x47FFEFFF));
+    uint32x4_t small    = vcltq_u32(abs, vdupq_n_u32(0x38800000));
+    // Values this small are shifted all the way out by the denormal path and become zero.
+    uint32x4_t zero = vcltq_u32(abs, vdupq_n_u32(0x2D000000));
+    *denormalOut    = vbicq_u32(small, zero);
+
+    uint32x4_t round  = vandq_u32(vshrq_n_u32(abs, 13), vdupq_n_u32(1));
+    uint32x4_t normal = vaddq_u32(vaddq_u32(abs, vdupq_n_u32(0xC8000FFF)), round);
+    normal            = vshrq_n_u32(normal, 13);
+
+    uint32x4_t result = vbslq_u32(infinity, vdupq_n_u32(0x7FFF), normal);
+    result            = vbicq_u32(result, small);
+    return vmovn_u32(vorrq_u32(result, sign));
+}
+
+inline bool AnyLane(uint32x4_t mask)
+{
+    uint32x2_t folded = vorr_u32(vget_low_u32(mask), vget_high_u32(mask));
+    return (vget_lane_u32(folded, 0) | vget_lane_u32(folded, 1)) != 0;
+}
+
+#endif
+
+}  // namespace priv
+
+}  // namespace angle
+
+#endif  // IMAGEUTIL_SIMD_UTILS_H_
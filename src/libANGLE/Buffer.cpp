@@ -17,6 +17,15 @@
 namespace gl
 {
 
+namespace
+{
+// Buffers in a shared BufferManager can be changed by contexts on several threads at once.
+bool IsShared(const Context *context)
+{
+    return context && context->getContextState().areBuffersShared();
+}
+}  // anonymous namespace
+
 BufferState::BufferState()
     : mLabel(),
       mUsage(BufferUsage::StaticDraw),
@@ -70,6 +79,8 @@ Error Buffer::bufferData(const Context *context,
                          GLsizeiptr size,
                          BufferUsage usage)
 {
+    angle::ConditionalLockGuard<std::mutex> lock(mMutex, IsShared(context));
+
     const void *dataForImpl = data;
 
     // If we are using robust resource init, make sure the buffer starts cleared.
@@ -100,6 +111,8 @@ Error Buffer::bufferSubData(const Context *context,
                             GLsizeiptr size,
                             GLintptr offset)
 {
+    angle::ConditionalLockGuard<std::mutex> lock(mMutex, IsShared(context));
+
     ANGLE_TRY(mImpl->setSubData(context, target, data, size, offset));
 
     mIndexRangeCache.invalidateRange(static_cast<unsigned int>(offset), static_cast<unsigned int>(size));
@@ -116,6 +129,8 @@ Error Buffer::copyBufferSubData(const Context *context,
                                 GLintptr destOffset,
                                 GLsizeiptr size)
 {
+    angle::ConditionalLockGuard<std::mutex> lock(mMutex, IsShared(context));
+
     ANGLE_TRY(
         mImpl->copySubData(context, source->getImplementation(), sourceOffset, destOffset, size));
 
@@ -129,6 +144,8 @@ Error Buffer::copyBufferSubData(const Context *context,
 
 Error Buffer::map(const Context *context, GLenum access)
 {
+    angle::ConditionalLockGuard<std::mutex> lock(mMutex, IsShared(context));
+
     ASSERT(!mState.mMapped);
 
     mState.mMapPointer = nullptr;
@@ -143,6 +160,9 @@ Error Buffer::map(const Context *context, GLenum access)
     mState.mAccessFlags = GL_MAP_WRITE_BIT;
     mIndexRangeCache.clear();
 
+    // Notify when the mapping changes, since mapped buffers can't be used for drawing.
+    mImpl->onStateChange(context, angle::SubjectMessage::MAPPING_CHANGED);
+
     return NoError();
 }
 
@@ -151,6 +171,8 @@ Error Buffer::mapRange(const Context *context,
                        GLsizeiptr length,
                        GLbitfield access)
 {
+    angle::ConditionalLockGuard<std::mutex> lock(mMutex, IsShared(context));
+
     ASSERT(!mState.mMapped);
     ASSERT(offset + length <= mState.mSize);
 
@@ -173,11 +195,16 @@ Error Buffer::mapRange(const Context *context,
         mIndexRangeCache.invalidateRange(static_cast<unsigned int>(offset), static_cast<unsigned int>(length));
     }
 
+    // Notify when the mapping changes, since mapped buffers can't be used for drawing.
+    mImpl->onStateChange(context, angle::SubjectMessage::MAPPING_CHANGED);
+
     return NoError();
 }
 
 Error Buffer::unmap(const Context *context, GLboolean *result)
 {
+    angle::ConditionalLockGuard<std::mutex> lock(mMutex, IsShared(context));
+
     ASSERT(mState.mMapped);
 
     *result = GL_FALSE;
@@ -192,12 +219,15 @@ Error Buffer::unmap(const Context *context, GLboolean *result)
 
     // Notify when data changes.
     mImpl->onStateChange(context, angle::SubjectMessage::CONTENTS_CHANGED);
+    mImpl->onStateChange(context, angle::SubjectMessage::MAPPING_CHANGED);
 
     return NoError();
 }
 
 void Buffer::onTransformFeedback(const Context *context)
 {
+    angle::ConditionalLockGuard<std::mutex> lock(mMutex, IsShared(context));
+
     mIndexRangeCache.clear();
 
     // Notify when data changes.
@@ -206,6 +236,8 @@ void Buffer::onTransformFeedback(const Context *context)
 
 void Buffer::onPixelPack(const Context *context)
 {
+    angle::ConditionalLockGuard<std::mutex> lock(mMutex, IsShared(context));
+
     mIndexRangeCache.clear();
 
     // Notify when data changes.
@@ -219,17 +251,10 @@ Error Buffer::getIndexRange(const gl::Context *context,
                             bool primitiveRestartEnabled,
                             IndexRange *outRange) const
 {
-    if (mIndexRangeCache.findRange(type, offset, count, primitiveRestartEnabled, outRange))
-    {
-        return NoError();
-    }
+    angle::ConditionalLockGuard<std::mutex> lock(mMutex, IsShared(context));
 
-    ANGLE_TRY(
-        mImpl->getIndexRange(context, type, offset, count, primitiveRestartEnabled, outRange));
-
-    mIndexRangeCache.addRange(type, offset, count, primitiveRestartEnabled, *outRange);
-
-    return NoError();
+    return mIndexRangeCache.getRange(context, mImpl, type, offset, count, primitiveRestartEnabled,
+                                     outRange);
 }
 
 bool Buffer::isBound() const
@@ -245,6 +270,8 @@ bool Buffer::isBoundForTransformFeedbackAndOtherUse() const
 
 void Buffer::onBindingChanged(const Context *context, bool bound, BufferBinding target)
 {
+    angle::ConditionalLockGuard<std::mutex> lock(mMutex, IsShared(context));
+
     ASSERT(bound || mState.mBindingCount > 0);
     mState.mBindingCount += bound ? 1 : -1;
     if (target == BufferBinding::TransformFeedback)
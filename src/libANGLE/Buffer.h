@@ -11,6 +11,9 @@
 #ifndef LIBANGLE_BUFFER_H_
 #define LIBANGLE_BUFFER_H_
 
+#include <mutex>
+
+#include "common/SharedMutex.h"
 #include "common/angleutils.h"
 #include "libANGLE/Debug.h"
 #include "libANGLE/Error.h"
@@ -123,6 +126,9 @@ class Buffer final : public RefCountObject, public LabeledObject
     rx::BufferImpl *mImpl;
 
     mutable IndexRangeCache mIndexRangeCache;
+
+    // Serializes changes made by contexts on different threads. Unused if the buffer isn't shared.
+    mutable std::mutex mMutex;
 };
 
 }  // namespace gl
@@ -235,6 +235,7 @@ Extensions::Extensions()
       clientArrays(false),
       robustResourceInitialization(false),
       programCacheControl(false),
+      parallelShaderCompile(false),
       textureRectangle(false),
       geometryShader(false),
       pointSizeArray(false),
@@ -830,6 +831,7 @@ const ExtensionInfoMap &GetExtensionInfoMap()
         map["GL_ANGLE_client_arrays"] = esOnlyExtension(&Extensions::clientArrays);
         map["GL_ANGLE_robust_resource_initialization"] = esOnlyExtension(&Extensions::robustResourceInitialization);
         map["GL_ANGLE_program_cache_control"] = esOnlyExtension(&Extensions::programCacheControl);
+        map["GL_KHR_parallel_shader_compile"] = esOnlyExtension(&Extensions::parallelShaderCompile);
         map["GL_ANGLE_texture_rectangle"] = enableableExtension(&Extensions::textureRectangle);
         map["GL_EXT_geometry_shader"] = enableableExtension(&Extensions::geometryShader);
         // GLES1 extensinos
@@ -1309,7 +1311,8 @@ DisplayExtensions::DisplayExtensions()
       programCacheControl(false),
       robustResourceInitialization(false),
       iosurfaceClientBuffer(false),
-      createContextExtensionsEnabled(false)
+      createContextExtensionsEnabled(false),
+      deferredCommandStream(false)
 {
 }
 
@@ -1356,6 +1359,7 @@ std::vector<std::string> DisplayExtensions::getStrings() const
     InsertExtensionString("EGL_ANGLE_robust_resource_initialization",            robustResourceInitialization,       &extensionStrings);
     InsertExtensionString("EGL_ANGLE_iosurface_client_buffer",                   iosurfaceClientBuffer,              &extensionStrings);
     InsertExtensionString("EGL_ANGLE_create_context_extensions_enabled",         createContextExtensionsEnabled,     &extensionStrings);
+    InsertExtensionString("EGL_ANGLE_deferred_command_stream",                   deferredCommandStream,              &extensionStrings);
     // TODO(jmadill): Enable this when complete.
     //InsertExtensionString("KHR_create_context_no_error",                       createContextNoError,               &extensionStrings);
     // clang-format on
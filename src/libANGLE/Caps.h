@@ -399,6 +399,9 @@ struct Extensions
     // GL_ANGLE_program_cache_control
     bool programCacheControl;
 
+    // GL_KHR_parallel_shader_compile
+    bool parallelShaderCompile;
+
     // GL_ANGLE_texture_rectangle
     bool textureRectangle;
 
@@ -764,6 +767,9 @@ struct DisplayExtensions
 
     // EGL_ANGLE_create_context_extensions_enabled
     bool createContextExtensionsEnabled;
+
+    // EGL_ANGLE_deferred_command_stream
+    bool deferredCommandStream;
 };
 
 struct DeviceExtensions
@@ -0,0 +1,196 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CommandStream.cpp: Implements the gl::CommandStream class.
+
+#include "libANGLE/CommandStream.h"
+
+#include "common/debug.h"
+#include "common/mathutil.h"
+
+namespace gl
+{
+
+namespace
+{
+// Yielding a few times before sleeping keeps short waits off the condition variable.
+constexpr unsigned int kSpinCount = 64;
+}  // anonymous namespace
+
+constexpr size_t CommandStream::kDefaultCapacity;
+
+CommandStream::CommandStream(Context *context, size_t capacity)
+    : mContext(context),
+      mStorage(capacity + alignof(RecordHeader)),
+      mRing(nullptr),
+      mCapacity(capacity),
+      mWritePosition(0),
+      mPublishedPosition(0),
+      mReadPosition(0),
+      mConsumerWaiting(false),
+      mProducerWaiting(false),
+      mStopping(false)
+{
+    ASSERT(capacity % sizeof(RecordHeader) == 0);
+
+    uintptr_t storageAddress = reinterpret_cast<uintptr_t>(mStorage.data());
+    mRing = mStorage.data() + (rx::roundUp(storageAddress, alignof(RecordHeader)) - storageAddress);
+
+    mConsumerThread   = std::thread(&CommandStream::consumerLoop, this);
+    mConsumerThreadId = mConsumerThread.get_id();
+}
+
+CommandStream::~CommandStream()
+{
+    finish();
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStopping = true;
+    }
+    mCondition.notify_all();
+    mConsumerThread.join();
+}
+
+void CommandStream::finish()
+{
+    if (onConsumerThread())
+    {
+        return;
+    }
+
+    waitForReadPosition(mWritePosition);
+}
+
+void *CommandStream::allocate(ReplayFunction replay, size_t payloadSize)
+{
+    size_t recordSize = rx::roundUp(sizeof(RecordHeader) + payloadSize, sizeof(RecordHeader));
+    ASSERT(recordSize <= mCapacity / 2);
+
+    // Records are contiguous, so skip to the start of the ring if this one would straddle its end.
+    size_t offset   = static_cast<size_t>(mWritePosition % mCapacity);
+    size_t untilEnd = mCapacity - offset;
+    if (untilEnd < recordSize)
+    {
+        waitForSpace(untilEnd);
+
+        RecordHeader *padding = getRecord(mWritePosition);
+        padding->replay       = nullptr;
+        padding->size         = untilEnd;
+        mWritePosition += untilEnd;
+    }
+
+    waitForSpace(recordSize);
+
+    RecordHeader *header = getRecord(mWritePosition);
+    header->replay       = replay;
+    header->size         = recordSize;
+    mWritePosition += recordSize;
+
+    return header + 1;
+}
+
+void CommandStream::publish()
+{
+    mPublishedPosition.store(mWritePosition);
+    if (mConsumerWaiting.load())
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mCondition.notify_all();
+    }
+}
+
+void CommandStream::waitForSpace(size_t size)
+{
+    uint64_t end = mWritePosition + size;
+    if (end > mReadPosition.load(std::memory_order_acquire) + mCapacity)
+    {
+        waitForReadPosition(end - mCapacity);
+    }
+}
+
+void CommandStream::waitForReadPosition(uint64_t position)
+{
+    // The consumer can only get this far if everything written so far is visible to it.
+    if (mPublishedPosition.load(std::memory_order_relaxed) != mWritePosition)
+    {
+        publish();
+    }
+
+    for (unsigned int spin = 0; spin < kSpinCount; ++spin)
+    {
+        if (mReadPosition.load(std::memory_order_acquire) >= position)
+        {
+            return;
+        }
+        std::this_thread::yield();
+    }
+
+    std::unique_lock<std::mutex> lock(mMutex);
+    mProducerWaiting = true;
+    mCondition.wait(lock, [this, position]() { return mReadPosition.load() >= position; });
+    mProducerWaiting = false;
+}
+
+CommandStream::RecordHeader *CommandStream::getRecord(uint64_t position)
+{
+    return reinterpret_cast<RecordHeader *>(mRing + position % mCapacity);
+}
+
+void CommandStream::consumerLoop()
+{
+    uint64_t readPosition = 0;
+    while (true)
+    {
+        uint64_t publishedPosition = waitForRecords(readPosition);
+        if (publishedPosition == readPosition)
+        {
+            return;
+        }
+
+        while (readPosition != publishedPosition)
+        {
+            const RecordHeader *header = getRecord(readPosition);
+            if (header->replay)
+            {
+                header->replay(mContext, header + 1);
+            }
+            readPosition += header->size;
+
+            // Hand each record back as soon as it has run, so that a producer waiting on a full
+            // ring doesn't wait for the whole batch.
+            mReadPosition.store(readPosition);
+            if (mProducerWaiting.load())
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                mCondition.notify_all();
+            }
+        }
+    }
+}
+
+uint64_t CommandStream::waitForRecords(uint64_t readPosition)
+{
+    for (unsigned int spin = 0; spin < kSpinCount; ++spin)
+    {
+        uint64_t publishedPosition = mPublishedPosition.load(std::memory_order_acquire);
+        if (publishedPosition != readPosition)
+        {
+            return publishedPosition;
+        }
+        std::this_thread::yield();
+    }
+
+    // Returns |readPosition| when stopping with nothing left to replay.
+    std::unique_lock<std::mutex> lock(mMutex);
+    mConsumerWaiting = true;
+    mCondition.wait(lock, [this, readPosition]() {
+        return mPublishedPosition.load() != readPosition || mStopping.load();
+    });
+    mConsumerWaiting = false;
+    return mPublishedPosition.load();
+}
+
+}  // namespace gl
@@ -0,0 +1,101 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CommandStream.h: Defines the gl::CommandStream class, a single producer, single consumer ring
+// of recorded calls that a dedicated thread replays against a Context. Used by contexts created
+// with EGL_CONTEXT_DEFERRED_COMMAND_STREAM_ANGLE.
+
+#ifndef LIBANGLE_COMMANDSTREAM_H_
+#define LIBANGLE_COMMANDSTREAM_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "common/angleutils.h"
+
+namespace gl
+{
+class Context;
+
+class CommandStream final : angle::NonCopyable
+{
+  public:
+    using ReplayFunction = void (*)(Context *context, const void *payload);
+
+    static constexpr size_t kDefaultCapacity = 1024 * 1024;
+
+    CommandStream(Context *context, size_t capacity);
+    ~CommandStream();
+
+    // Records a call. The consumer thread passes a copy of |payload| to |replay|. Only the thread
+    // the context is current on may enqueue.
+    template <typename PayloadT>
+    void enqueue(ReplayFunction replay, const PayloadT &payload);
+
+    // Returns once every recorded call has been replayed. Does nothing on the consumer thread.
+    void finish();
+
+    bool onConsumerThread() const { return std::this_thread::get_id() == mConsumerThreadId; }
+
+  private:
+    struct alignas(16) RecordHeader
+    {
+        // Null for the padding record that skips the end of the ring.
+        ReplayFunction replay;
+        size_t size;
+    };
+
+    void *allocate(ReplayFunction replay, size_t payloadSize);
+    void publish();
+    void waitForSpace(size_t size);
+    void waitForReadPosition(uint64_t position);
+    RecordHeader *getRecord(uint64_t position);
+
+    void consumerLoop();
+    uint64_t waitForRecords(uint64_t readPosition);
+
+    Context *mContext;
+    std::vector<uint8_t> mStorage;
+    uint8_t *mRing;
+    size_t mCapacity;
+
+    // Only accessed by the producer.
+    uint64_t mWritePosition;
+
+    // Positions only grow, so they can't wrap around in practice.
+    std::atomic<uint64_t> mPublishedPosition;
+    std::atomic<uint64_t> mReadPosition;
+
+    // Each side sets its flag before sleeping and checks the other side's position after, so the
+    // other side either sees the flag and wakes it, or it sees the new position and doesn't sleep.
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    std::atomic<bool> mConsumerWaiting;
+    std::atomic<bool> mProducerWaiting;
+    std::atomic<bool> mStopping;
+
+    std::thread mConsumerThread;
+    std::thread::id mConsumerThreadId;
+};
+
+template <typename PayloadT>
+void CommandStream::enqueue(ReplayFunction replay, const PayloadT &payload)
+{
+    static_assert(std::is_trivially_destructible<PayloadT>::value,
+                  "Recorded payloads are never destroyed.");
+    static_assert(alignof(PayloadT) <= alignof(RecordHeader), "Payload alignment is too large.");
+
+    new (allocate(replay, sizeof(PayloadT))) PayloadT(payload);
+    publish();
+}
+
+}  // namespace gl
+
+#endif  // LIBANGLE_COMMANDSTREAM_H_
@@ -0,0 +1,281 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CommandStream_unittest:
+//   Tests of the deferred command stream ring, replayed without a Context.
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "libANGLE/CommandStream.h"
+
+using namespace gl;
+
+namespace
+{
+
+// Records are a 16 byte header followed by the payload, rounded up to 16 bytes.
+constexpr size_t kSmallRecordSize = 32;
+constexpr size_t kLargeRecordSize = 64;
+
+struct ReplayState
+{
+    std::vector<uint32_t> replayed;
+    std::thread::id replayThreadId;
+    std::atomic<bool> blocked{false};
+    std::atomic<bool> started{false};
+    std::chrono::milliseconds delay{0};
+    CommandStream *stream = nullptr;
+};
+
+struct SmallPayload
+{
+    ReplayState *state;
+    uint32_t sequence;
+};
+
+struct LargePayload
+{
+    ReplayState *state;
+    uint32_t sequence;
+    uint32_t words[9];
+};
+
+static_assert(sizeof(SmallPayload) + 16 <= kSmallRecordSize, "Unexpected small record size.");
+static_assert(sizeof(LargePayload) + 16 > kSmallRecordSize &&
+                  sizeof(LargePayload) + 16 <= kLargeRecordSize,
+              "Unexpected large record size.");
+
+void Record(ReplayState *state, uint32_t sequence)
+{
+    state->replayThreadId = std::this_thread::get_id();
+    state->started        = true;
+    while (state->blocked)
+    {
+        std::this_thread::yield();
+    }
+    if (state->delay.count() > 0)
+    {
+        std::this_thread::sleep_for(state->delay);
+    }
+    state->replayed.push_back(sequence);
+}
+
+void ReplaySmall(Context *context, const void *payload)
+{
+    EXPECT_EQ(nullptr, context);
+    const SmallPayload *small = reinterpret_cast<const SmallPayload *>(payload);
+    Record(small->state, small->sequence);
+}
+
+void ReplayLarge(Context *context, const void *payload)
+{
+    EXPECT_EQ(nullptr, context);
+    const LargePayload *large = reinterpret_cast<const LargePayload *>(payload);
+    for (uint32_t word : large->words)
+    {
+        EXPECT_EQ(large->sequence * 31u, word);
+    }
+    Record(large->state, large->sequence);
+}
+
+void ReplayFinish(Context *context, const void *payload)
+{
+    const SmallPayload *small = reinterpret_cast<const SmallPayload *>(payload);
+    small->state->stream->finish();
+    Record(small->state, small->sequence);
+}
+
+void EnqueueSmall(CommandStream *stream, ReplayState *state, uint32_t sequence)
+{
+    SmallPayload payload = {state, sequence};
+    stream->enqueue(ReplaySmall, payload);
+}
+
+void EnqueueLarge(CommandStream *stream, ReplayState *state, uint32_t sequence)
+{
+    LargePayload payload;
+    payload.state    = state;
+    payload.sequence = sequence;
+    for (uint32_t &word : payload.words)
+    {
+        word = sequence * 31u;
+    }
+    stream->enqueue(ReplayLarge, payload);
+}
+
+std::vector<uint32_t> Sequence(uint32_t count)
+{
+    std::vector<uint32_t> sequence(count);
+    for (uint32_t index = 0; index < count; ++index)
+    {
+        sequence[index] = index;
+    }
+    return sequence;
+}
+
+// Tests that records are replayed in order on the stream's own thread.
+TEST(CommandStreamTest, ReplaysInOrder)
+{
+    ReplayState state;
+    CommandStream stream(nullptr, CommandStream::kDefaultCapacity);
+
+    for (uint32_t sequence = 0; sequence < 100; ++sequence)
+    {
+        EnqueueSmall(&stream, &state, sequence);
+    }
+    stream.finish();
+
+    EXPECT_EQ(Sequence(100), state.replayed);
+    EXPECT_NE(std::this_thread::get_id(), state.replayThreadId);
+    EXPECT_FALSE(stream.onConsumerThread());
+}
+
+// Tests that records keep their payload when the ring wraps around many times. Records of the
+// same size that divide the ring evenly never need padding.
+TEST(CommandStreamTest, WrapsAroundRingEnd)
+{
+    ReplayState state;
+    CommandStream stream(nullptr, kSmallRecordSize * 4);
+
+    for (uint32_t sequence = 0; sequence < 1000; ++sequence)
+    {
+        EnqueueSmall(&stream, &state, sequence);
+    }
+    stream.finish();
+
+    EXPECT_EQ(Sequence(1000), state.replayed);
+}
+
+// Tests that a record that doesn't fit before the ring end is moved to its start, and that the
+// padding record left behind isn't replayed.
+TEST(CommandStreamTest, PadsRecordsThatStraddleRingEnd)
+{
+    ReplayState state;
+
+    // Small record at 0, large record at 32, and the next large record at 96 leaves 48 bytes that
+    // are skipped with a padding record.
+    CommandStream stream(nullptr, kSmallRecordSize + kLargeRecordSize + 48);
+
+    for (uint32_t sequence = 0; sequence < 300; sequence += 3)
+    {
+        EnqueueSmall(&stream, &state, sequence);
+        EnqueueLarge(&stream, &state, sequence + 1);
+        EnqueueLarge(&stream, &state, sequence + 2);
+    }
+    stream.finish();
+
+    EXPECT_EQ(Sequence(300), state.replayed);
+}
+
+// Tests that finish() returns only once every record has run.
+TEST(CommandStreamTest, FinishWaitsForReplay)
+{
+    ReplayState state;
+    state.delay = std::chrono::milliseconds(1);
+    CommandStream stream(nullptr, CommandStream::kDefaultCapacity);
+
+    for (uint32_t sequence = 0; sequence < 20; ++sequence)
+    {
+        EnqueueSmall(&stream, &state, sequence);
+    }
+    stream.finish();
+    EXPECT_EQ(Sequence(20), state.replayed);
+
+    // Finishing an idle stream returns immediately.
+    stream.finish();
+    EXPECT_EQ(Sequence(20), state.replayed);
+}
+
+// Tests that finish() called by a replayed record doesn't wait for that record.
+TEST(CommandStreamTest, FinishOnConsumerThread)
+{
+    ReplayState state;
+    CommandStream stream(nullptr, CommandStream::kDefaultCapacity);
+    state.stream = &stream;
+
+    SmallPayload payload = {&state, 0};
+    stream.enqueue(ReplayFinish, payload);
+    EnqueueSmall(&stream, &state, 1);
+    stream.finish();
+
+    EXPECT_EQ(Sequence(2), state.replayed);
+}
+
+// Tests that the producer blocks while the ring is full, and resumes once a record is freed.
+TEST(CommandStreamTest, BlocksWhenFull)
+{
+    constexpr uint32_t kRingRecords = 4;
+
+    ReplayState state;
+    state.blocked = true;
+    CommandStream stream(nullptr, kSmallRecordSize * kRingRecords);
+
+    // The first record stays in the ring while it runs, so the ring is full after kRingRecords and
+    // the next record has to wait.
+    std::atomic<uint32_t> enqueued(0);
+    std::thread producer([&]() {
+        for (uint32_t sequence = 0; sequence <= kRingRecords; ++sequence)
+        {
+            EnqueueSmall(&stream, &state, sequence);
+            enqueued = sequence + 1;
+        }
+    });
+
+    while (!state.started || enqueued < kRingRecords)
+    {
+        std::this_thread::yield();
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(kRingRecords, enqueued.load());
+
+    state.blocked = false;
+    producer.join();
+    EXPECT_EQ(kRingRecords + 1, enqueued.load());
+
+    stream.finish();
+    EXPECT_EQ(Sequence(kRingRecords + 1), state.replayed);
+}
+
+// Tests that destroying the stream replays the records still queued before stopping its thread.
+TEST(CommandStreamTest, ShutdownReplaysQueuedRecords)
+{
+    ReplayState state;
+    state.blocked = true;
+    std::unique_ptr<CommandStream> stream(new CommandStream(nullptr, kSmallRecordSize * 8));
+
+    for (uint32_t sequence = 0; sequence < 8; ++sequence)
+    {
+        EnqueueSmall(stream.get(), &state, sequence);
+    }
+
+    while (!state.started)
+    {
+        std::this_thread::yield();
+    }
+    std::thread release([&state]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        state.blocked = false;
+    });
+
+    stream.reset();
+    release.join();
+
+    EXPECT_EQ(Sequence(8), state.replayed);
+}
+
+// Tests that an idle stream shuts down.
+TEST(CommandStreamTest, ShutdownWhenIdle)
+{
+    std::unique_ptr<CommandStream> stream(
+        new CommandStream(nullptr, CommandStream::kDefaultCapacity));
+    stream.reset();
+}
+
+}  // anonymous namespace
@@ -8,6 +8,9 @@
 
 #include "libANGLE/Compiler.h"
 
+#include <algorithm>
+#include <thread>
+
 #include "common/debug.h"
 #include "libANGLE/ContextState.h"
 #include "libANGLE/renderer/CompilerImpl.h"
@@ -55,7 +58,8 @@ Compiler::Compiler(rx::GLImplFactory *implFactory, const ContextState &state)
                              state.getExtensions().webglCompatibility)),
       mOutputType(mImplementation->getTranslatorOutputType()),
       mResources(),
-      mShaderCompilers({})
+      mShaderCompilers({}),
+      mMaxPooledCompilerHandles(1)
 {
     ASSERT(state.getClientMajorVersion() == 1 || state.getClientMajorVersion() == 2 ||
            state.getClientMajorVersion() == 3);
@@ -159,12 +163,15 @@ Compiler::~Compiler()
         ShHandle compilerHandle = mShaderCompilers[shaderType];
         if (compilerHandle)
         {
-            sh::Destruct(compilerHandle);
+            destructCompilerHandle(compilerHandle);
             mShaderCompilers[shaderType] = nullptr;
+        }
 
-            ASSERT(activeCompilerHandles > 0);
-            activeCompilerHandles--;
+        for (ShHandle pooledHandle : mPooledShaderCompilers[shaderType])
+        {
+            destructCompilerHandle(pooledHandle);
         }
+        mPooledShaderCompilers[shaderType].clear();
     }
 
     if (activeCompilerHandles == 0)
@@ -182,17 +189,80 @@ ShHandle Compiler::getCompilerHandle(ShaderType type)
 
     if (!(*compiler))
     {
-        if (activeCompilerHandles == 0)
+        *compiler = constructCompilerHandle(type);
+    }
+
+    return *compiler;
+}
+
+ShHandle Compiler::acquireCompilerHandle(ShaderType type)
+{
+    ASSERT(type != ShaderType::InvalidEnum);
+    std::vector<ShHandle> *pool = &mPooledShaderCompilers[type];
+
+    if (pool->empty())
+    {
+        return constructCompilerHandle(type);
+    }
+
+    ShHandle compilerHandle = pool->back();
+    pool->pop_back();
+    return compilerHandle;
+}
+
+void Compiler::releaseCompilerHandle(ShaderType type, ShHandle compilerHandle)
+{
+    ASSERT(type != ShaderType::InvalidEnum);
+    ASSERT(compilerHandle);
+
+    std::vector<ShHandle> *pool = &mPooledShaderCompilers[type];
+    if (pool->size() >= mMaxPooledCompilerHandles)
+    {
+        destructCompilerHandle(compilerHandle);
+        return;
+    }
+
+    pool->push_back(compilerHandle);
+}
+
+void Compiler::setMaxPooledCompilerHandles(size_t maxHandles)
+{
+    // The default thread count is unbounded, so it's clamped to the threads that can actually run.
+    // Keep at least one handle so serial compiles don't rebuild the translator every time.
+    size_t hardwareThreads    = std::max(1u, std::thread::hardware_concurrency());
+    mMaxPooledCompilerHandles = std::max<size_t>(1, std::min(maxHandles, hardwareThreads));
+
+    for (std::vector<ShHandle> &pool : mPooledShaderCompilers)
+    {
+        while (pool.size() > mMaxPooledCompilerHandles)
         {
-            sh::Initialize();
+            destructCompilerHandle(pool.back());
+            pool.pop_back();
         }
+    }
+}
 
-        *compiler = sh::ConstructCompiler(ToGLenum(type), mSpec, mOutputType, &mResources);
-        ASSERT(*compiler);
-        activeCompilerHandles++;
+ShHandle Compiler::constructCompilerHandle(ShaderType type)
+{
+    if (activeCompilerHandles == 0)
+    {
+        sh::Initialize();
     }
 
-    return *compiler;
+    ShHandle compilerHandle =
+        sh::ConstructCompiler(ToGLenum(type), mSpec, mOutputType, &mResources);
+    ASSERT(compilerHandle);
+    activeCompilerHandles++;
+
+    return compilerHandle;
+}
+
+void Compiler::destructCompilerHandle(ShHandle compilerHandle)
+{
+    sh::Destruct(compilerHandle);
+
+    ASSERT(activeCompilerHandles > 0);
+    activeCompilerHandles--;
 }
 
 const std::string &Compiler::getBuiltinResourcesString(ShaderType type)
@@ -10,6 +10,8 @@
 #ifndef LIBANGLE_COMPILER_H_
 #define LIBANGLE_COMPILER_H_
 
+#include <vector>
+
 #include "GLSLANG/ShaderLang.h"
 #include "libANGLE/Error.h"
 #include "libANGLE/PackedEnums.h"
@@ -34,14 +36,29 @@ class Compiler final : public RefCountObjectNoID
     ShShaderOutput getShaderOutputType() const { return mOutputType; }
     const std::string &getBuiltinResourcesString(ShaderType type);
 
+    // A translator handle can only run one compile at a time. Each pending compile checks out its
+    // own handle so several shaders can be translated concurrently on worker threads. Handles are
+    // returned to a per-stage pool once the compile is resolved.
+    ShHandle acquireCompilerHandle(ShaderType shaderType);
+    void releaseCompilerHandle(ShaderType shaderType, ShHandle compilerHandle);
+
+    // No more compiles than the context's compiler threads run at once, so each stage's pool keeps
+    // at most that many idle handles and destroys the ones released beyond it.
+    void setMaxPooledCompilerHandles(size_t maxHandles);
+
   private:
     ~Compiler() override;
+
+    ShHandle constructCompilerHandle(ShaderType shaderType);
+    void destructCompilerHandle(ShHandle compilerHandle);
     std::unique_ptr<rx::CompilerImpl> mImplementation;
     ShShaderSpec mSpec;
     ShShaderOutput mOutputType;
     ShBuiltInResources mResources;
 
     ShaderMap<ShHandle> mShaderCompilers;
+    ShaderMap<std::vector<ShHandle>> mPooledShaderCompilers;
+    size_t mMaxPooledCompilerHandles;
 };
 
 }  // namespace gl
@@ -17,6 +17,20 @@ namespace gl
 // The binary cache is currently left disable by default, and the application can enable it.
 const size_t kDefaultMaxProgramCacheMemoryBytes = 0;
 
+// The on-disk program cache is enabled by pointing this environment variable at a directory.
+constexpr char kProgramCacheDirectoryEnvVar[] = "ANGLE_PROGRAM_CACHE_DIR";
+const size_t kDefaultMaxProgramCacheDiskBytes  = 64 * 1024 * 1024;
+
+// Translated shaders are kept in memory up to this size. They are also stored next to the on-disk
+// program cache when it is enabled.
+const size_t kDefaultMaxTranslationCacheMemoryBytes = 4 * 1024 * 1024;
+
+// SPIR-V generated by glslang for the Vulkan back-end, kept the same way as translated shaders.
+const size_t kDefaultMaxSpirvCacheMemoryBytes = 4 * 1024 * 1024;
+
+// KHR_parallel_shader_compile: 0xFFFFFFFF lets the implementation pick the number of threads.
+const unsigned int kDefaultMaxShaderCompilerThreads = 0xFFFFFFFFu;
+
 enum
 {
     // Implementation upper limits, real maximums depend on the hardware
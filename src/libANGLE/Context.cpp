@@ -208,9 +208,16 @@ bool GetBindGeneratesResource(const egl::AttributeMap &attribs)
     return (attribs.get(EGL_CONTEXT_BIND_GENERATES_RESOURCE_CHROMIUM, EGL_TRUE) == EGL_TRUE);
 }
 
+bool GetDeferredCommandStream(const egl::AttributeMap &attribs)
+{
+    return (attribs.get(EGL_CONTEXT_DEFERRED_COMMAND_STREAM_ANGLE, EGL_FALSE) == EGL_TRUE);
+}
+
 bool GetClientArraysEnabled(const egl::AttributeMap &attribs)
 {
-    return (attribs.get(EGL_CONTEXT_CLIENT_ARRAYS_ENABLED_ANGLE, EGL_TRUE) == EGL_TRUE);
+    // Deferred calls can't read client memory, so client arrays are disabled by default.
+    EGLAttrib defaultValue = GetDeferredCommandStream(attribs) ? EGL_FALSE : EGL_TRUE;
+    return (attribs.get(EGL_CONTEXT_CLIENT_ARRAYS_ENABLED_ANGLE, defaultValue) == EGL_TRUE);
 }
 
 bool GetRobustResourceInit(const egl::AttributeMap &attribs)
@@ -294,8 +301,15 @@ Context::Context(rx::EGLImplFactory *implFactory,
       mWebGLContext(GetWebGLContext(attribs)),
       mExtensionsEnabled(GetExtensionsEnabled(attribs, mWebGLContext)),
       mMemoryProgramCache(memoryProgramCache),
+      mBasicDrawStatesValid(false),
+      mBasicDrawStatesFramebuffer(nullptr),
+      mBasicDrawStatesFramebufferSerial(0),
+      mBasicDrawStatesProgram(nullptr),
+      mBasicDrawStatesProgramLinkSerial(0),
       mScratchBuffer(1000u),
-      mZeroFilledBuffer(1000u)
+      mZeroFilledBuffer(1000u),
+      mWorkerThreadPool(kDefaultMaxShaderCompilerThreads),
+      mMaxShaderCompilerThreads(kDefaultMaxShaderCompilerThreads)
 {
     // Needed to solve a Clang warning of unused variables.
     ANGLE_UNUSED_VARIABLE(mSavedArgsType);
@@ -311,6 +325,11 @@ Context::Context(rx::EGLImplFactory *implFactory,
                         GetClientArraysEnabled(attribs), robustResourceInit,
                         mMemoryProgramCache != nullptr);
 
+    if (GetDeferredCommandStream(attribs))
+    {
+        mCommandStream.reset(new CommandStream(this, CommandStream::kDefaultCapacity));
+    }
+
     mFenceNVHandleAllocator.setBaseHandle(0);
 
     // [OpenGL ES 2.0.24] section 3.7 page 83:
@@ -433,11 +452,28 @@ Context::Context(rx::EGLImplFactory *implFactory,
     mComputeDirtyBits.set(State::DIRTY_BIT_DISPATCH_INDIRECT_BUFFER_BINDING);
     mComputeDirtyObjects.set(State::DIRTY_OBJECT_PROGRAM_TEXTURES);
 
+    // The draw framebuffer's completeness is tracked separately with its serial.
+    mBasicDrawStatesDirtyBits.set(State::DIRTY_BIT_DRAW_FRAMEBUFFER_BINDING);
+    mBasicDrawStatesDirtyBits.set(State::DIRTY_BIT_PROGRAM_BINDING);
+    mBasicDrawStatesDirtyBits.set(State::DIRTY_BIT_PROGRAM_EXECUTABLE);
+    mBasicDrawStatesDirtyBits.set(State::DIRTY_BIT_STENCIL_TEST_ENABLED);
+    mBasicDrawStatesDirtyBits.set(State::DIRTY_BIT_STENCIL_FUNCS_FRONT);
+    mBasicDrawStatesDirtyBits.set(State::DIRTY_BIT_STENCIL_FUNCS_BACK);
+    mBasicDrawStatesDirtyBits.set(State::DIRTY_BIT_STENCIL_WRITEMASK_FRONT);
+    mBasicDrawStatesDirtyBits.set(State::DIRTY_BIT_STENCIL_WRITEMASK_BACK);
+
     handleError(mImplementation->initialize());
 }
 
 egl::Error Context::onDestroy(const egl::Display *display)
 {
+    // Replays the remaining deferred calls and stops the thread running them.
+    mCommandStream.reset();
+
+    // Compiles and links started from this context use its compiler and worker threads.
+    mState.mShaderPrograms->resolveShaderCompiles(this);
+    mState.mShaderPrograms->resolveProgramLinks(this);
+
     if (mGLES1Renderer)
     {
         mGLES1Renderer->onDestroy(this, &mGLState);
@@ -1260,6 +1296,7 @@ Compiler *Context::getCompiler() const
     if (mCompiler.get() == nullptr)
     {
         mCompiler.set(this, new Compiler(mImplementation.get(), mState));
+        mCompiler->setMaxPooledCompilerHandles(mMaxShaderCompilerThreads);
     }
     return mCompiler.get();
 }
@@ -1366,6 +1403,9 @@ void Context::getIntegervImpl(GLenum pname, GLint *params)
         case GL_MAX_RENDERBUFFER_SIZE:
             *params = mCaps.maxRenderbufferSize;
             break;
+        case GL_MAX_SHADER_COMPILER_THREADS_KHR:
+            *params = clampCast<GLint>(mMaxShaderCompilerThreads);
+            break;
         case GL_MAX_COLOR_ATTACHMENTS_EXT:
             *params = mCaps.maxColorAttachments;
             break;
@@ -2972,6 +3012,9 @@ void Context::requestExtension(const char *name)
         return;
     }
 
+    // Pending links read the caps and extensions from worker threads.
+    mState.mShaderPrograms->resolveProgramLinks(this);
+
     mExtensions.*(extension.ExtensionsMember) = true;
     updateCaps();
     initExtensionStrings();
@@ -3087,6 +3130,9 @@ Extensions Context::generateSupportedExtensions(const egl::DisplayExtensions &di
     // Enable the cache control query unconditionally.
     supportedExtensions.programCacheControl = true;
 
+    // Program links are finished lazily by the front-end, so this works with every back-end.
+    supportedExtensions.parallelShaderCompile = true;
+
     return supportedExtensions;
 }
 
@@ -5179,7 +5225,9 @@ void Context::getIntegervRobust(GLenum pname, GLsizei bufSize, GLsizei *length,
 
 void Context::getProgramiv(GLuint program, GLenum pname, GLint *params)
 {
-    Program *programObject = getProgram(program);
+    Program *programObject = (pname == GL_COMPLETION_STATUS_KHR)
+                                 ? getProgramNoResolveLink(program)
+                                 : getProgram(program);
     ASSERT(programObject);
     QueryProgramiv(this, programObject, pname, params);
 }
@@ -5422,10 +5470,26 @@ GLboolean Context::isTexture(GLuint texture)
 
 void Context::linkProgram(GLuint program)
 {
-    Program *programObject = getProgram(program);
+    Program *programObject = getProgramNoResolveLink(program);
     ASSERT(programObject);
     handleError(programObject->link(this));
-    mGLState.onProgramExecutableChange(programObject);
+
+    // The executable of a program in use must be replaced right away.
+    if (programObject->getRefCount() > 0)
+    {
+        programObject->resolveLink(this);
+        mGLState.onProgramExecutableChange(programObject);
+    }
+}
+
+void Context::maxShaderCompilerThreads(GLuint count)
+{
+    mMaxShaderCompilerThreads = count;
+    mWorkerThreadPool.setMaxThreads(count);
+    if (mCompiler.get() != nullptr)
+    {
+        mCompiler->setMaxPooledCompilerHandles(count);
+    }
 }
 
 void Context::releaseShaderCompiler()
@@ -6407,6 +6471,35 @@ bool Context::isCurrentVertexArray(const VertexArray *va) const
     return mGLState.isCurrentVertexArray(va);
 }
 
+bool Context::areBasicDrawStatesValid()
+{
+    // Always consume the dirty bits so changes made while the cache is invalid aren't seen twice.
+    if ((mGLState.getAndResetValidationDirtyBits() & mBasicDrawStatesDirtyBits).any())
+    {
+        mBasicDrawStatesValid = false;
+    }
+
+    // The program can be relinked by any context in the share group, which doesn't set this
+    // context's dirty bits, so its link serial is compared as well.
+    const Framebuffer *framebuffer = mGLState.getDrawFramebuffer();
+    const Program *program         = mGLState.getProgram();
+    return mBasicDrawStatesValid && framebuffer == mBasicDrawStatesFramebuffer &&
+           framebuffer->getCompletenessSerial() == mBasicDrawStatesFramebufferSerial &&
+           program == mBasicDrawStatesProgram &&
+           (!program || program->getLinkSerial() == mBasicDrawStatesProgramLinkSerial);
+}
+
+void Context::onBasicDrawStatesValidated()
+{
+    const Framebuffer *framebuffer    = mGLState.getDrawFramebuffer();
+    const Program *program            = mGLState.getProgram();
+    mBasicDrawStatesValid             = true;
+    mBasicDrawStatesFramebuffer       = framebuffer;
+    mBasicDrawStatesFramebufferSerial = framebuffer->getCompletenessSerial();
+    mBasicDrawStatesProgram           = program;
+    mBasicDrawStatesProgramLinkSerial = program ? program->getLinkSerial() : 0;
+}
+
 void Context::genProgramPipelines(GLsizei count, GLuint *pipelines)
 {
     for (int i = 0; i < count; i++)
@@ -6924,6 +7017,13 @@ bool Context::getQueryParameterInfo(GLenum pname, GLenum *type, unsigned int *nu
         return true;
     }
 
+    if (getExtensions().parallelShaderCompile && pname == GL_MAX_SHADER_COMPILER_THREADS_KHR)
+    {
+        *type      = GL_INT;
+        *numParams = 1;
+        return true;
+    }
+
     // Check for ES3.0+ parameter names which are also exposed as ES2 extensions
     switch (pname)
     {
@@ -7342,6 +7442,16 @@ bool Context::getIndexedQueryParameterInfo(GLenum target, GLenum *type, unsigned
 }
 
 Program *Context::getProgram(GLuint handle) const
+{
+    Program *program = mState.mShaderPrograms->getProgram(handle);
+    if (program)
+    {
+        program->resolveLink(this);
+    }
+    return program;
+}
+
+Program *Context::getProgramNoResolveLink(GLuint handle) const
 {
     return mState.mShaderPrograms->getProgram(handle);
 }
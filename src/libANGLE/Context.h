@@ -10,6 +10,7 @@
 #ifndef LIBANGLE_CONTEXT_H_
 #define LIBANGLE_CONTEXT_H_
 
+#include <atomic>
 #include <set>
 #include <string>
 
@@ -17,6 +18,7 @@
 #include "common/MemoryBuffer.h"
 #include "common/angleutils.h"
 #include "libANGLE/Caps.h"
+#include "libANGLE/CommandStream.h"
 #include "libANGLE/Constants.h"
 #include "libANGLE/ContextState.h"
 #include "libANGLE/Context_gles_1_0_autogen.h"
@@ -27,6 +29,7 @@
 #include "libANGLE/ResourceMap.h"
 #include "libANGLE/VertexAttribute.h"
 #include "libANGLE/Workarounds.h"
+#include "libANGLE/WorkerThread.h"
 #include "libANGLE/angletypes.h"
 
 namespace rx
@@ -1405,6 +1408,11 @@ class Context final : angle::NonCopyable
 
     MemoryProgramCache *getMemoryProgramCache() const { return mMemoryProgramCache; }
 
+    // KHR_parallel_shader_compile. A limit of zero disables linking on worker threads.
+    void maxShaderCompilerThreads(GLuint count);
+    GLuint getMaxShaderCompilerThreads() const { return mMaxShaderCompilerThreads; }
+    angle::WorkerThreadPool *getWorkerThreadPool() const { return &mWorkerThreadPool; }
+
     template <EntryPoint EP, typename... ParamsT>
     void gatherParams(ParamsT &&... params);
 
@@ -1435,7 +1443,10 @@ class Context final : angle::NonCopyable
     bool getQueryParameterInfo(GLenum pname, GLenum *type, unsigned int *numParams);
     bool getIndexedQueryParameterInfo(GLenum target, GLenum *type, unsigned int *numParams);
 
+    // Finishes a pending link of the program before returning it.
     Program *getProgram(GLuint handle) const;
+    // Used by queries that must not block on a pending link, e.g. GL_COMPLETION_STATUS_KHR.
+    Program *getProgramNoResolveLink(GLuint handle) const;
     Shader *getShader(GLuint handle) const;
 
     bool isTextureGenerated(GLuint texture) const;
@@ -1462,6 +1473,26 @@ class Context final : angle::NonCopyable
     static int TexCoordArrayIndex(unsigned int unit);
     AttributesMask getVertexArraysAttributeMask() const;
 
+    // Draw validation only re-checks the stencil, framebuffer and program state when something
+    // they depend on changed since they last passed.
+    bool areBasicDrawStatesValid();
+    void onBasicDrawStatesValidated();
+
+    // EGL_ANGLE_deferred_command_stream. Calls that can be deferred are recorded into the command
+    // stream, unless they are being replayed by its thread. Everything else finishes it first.
+    bool isDeferringCommands() const
+    {
+        return mCommandStream && !mCommandStream->onConsumerThread();
+    }
+    CommandStream *getCommandStream() const { return mCommandStream.get(); }
+    void finishDeferredCommands()
+    {
+        if (mCommandStream)
+        {
+            mCommandStream->finish();
+        }
+    }
+
   private:
     Error prepareForDraw();
     Error prepareForClear(GLbitfield mask);
@@ -1564,7 +1595,8 @@ class Context final : angle::NonCopyable
 
     // Current/lost context flags
     bool mHasBeenCurrent;
-    mutable bool mContextLost;
+    // Read by the application thread while deferred calls run, see isDeferringCommands().
+    mutable std::atomic<bool> mContextLost;
     mutable GLenum mResetStatus;
     mutable bool mContextLostForced;
     GLenum mResetStrategy;
@@ -1587,11 +1619,24 @@ class Context final : angle::NonCopyable
     State::DirtyBits mComputeDirtyBits;
     State::DirtyObjects mComputeDirtyObjects;
 
+    State::DirtyBits mBasicDrawStatesDirtyBits;
+    bool mBasicDrawStatesValid;
+    const Framebuffer *mBasicDrawStatesFramebuffer;
+    unsigned int mBasicDrawStatesFramebufferSerial;
+    const Program *mBasicDrawStatesProgram;
+    unsigned int mBasicDrawStatesProgramLinkSerial;
+
     Workarounds mWorkarounds;
 
     // Not really a property of context state. The size and contexts change per-api-call.
     mutable angle::ScratchBuffer mScratchBuffer;
     mutable angle::ScratchBuffer mZeroFilledBuffer;
+
+    // Runs the front-end part of program links.
+    mutable angle::WorkerThreadPool mWorkerThreadPool;
+    GLuint mMaxShaderCompilerThreads;
+
+    std::unique_ptr<CommandStream> mCommandStream;
 };
 
 template <typename T>
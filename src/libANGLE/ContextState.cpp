@@ -108,6 +108,16 @@ bool ContextState::isWebGL1() const
     return (isWebGL() && mClientVersion.major == 2);
 }
 
+bool ContextState::areBuffersShared() const
+{
+    return mBuffers->isShared();
+}
+
+bool ContextState::areTexturesShared() const
+{
+    return mTextures->isShared();
+}
+
 const TextureCaps &ContextState::getTextureCap(GLenum internalFormat) const
 {
     return mTextureCaps.get(internalFormat);
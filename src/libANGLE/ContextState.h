@@ -63,6 +63,10 @@ class ContextState final : angle::NonCopyable
     bool isWebGL() const;
     bool isWebGL1() const;
 
+    // Objects in shared managers can be used from several threads at once.
+    bool areBuffersShared() const;
+    bool areTexturesShared() const;
+
   private:
     friend class Context;
 
@@ -0,0 +1,1003 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// DiskProgramCache: Persistent second tier for the MemoryProgramCache. Program binaries are
+//   appended to a pack file on a worker thread. The pack and its sorted index are memory-mapped
+//   when the cache is opened, so lookups return pointers directly into the mapping.
+
+#include "libANGLE/DiskProgramCache.h"
+
+#include <string.h>
+#include <algorithm>
+#include <limits>
+#include <tuple>
+
+#include "common/debug.h"
+#include "common/platform.h"
+#include "common/version.h"
+#include "common/third_party/smhasher/src/PMurHash.h"
+
+#if defined(ANGLE_PLATFORM_POSIX)
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#elif defined(ANGLE_PLATFORM_WINDOWS)
+#include <io.h>
+#endif
+
+namespace gl
+{
+
+namespace
+{
+// The pack file is a PackHeader followed by a sequence of records, each made of a RecordHeader
+// and the program binary. The index file is an IndexHeader followed by IndexEntries sorted by
+// program hash. Both files store values in host byte order, since binaries are not portable
+// across machines anyway.
+constexpr uint32_t kPackMagic     = 0x50474E41;  // "ANGP"
+constexpr uint32_t kIndexMagic    = 0x49474E41;  // "ANGI"
+constexpr uint32_t kFormatVersion = 1;
+constexpr size_t kCommitHashFieldLength = 24;
+
+constexpr char kPackFileName[]  = "angle_program_cache.pack";
+constexpr char kIndexFileName[] = "angle_program_cache.index";
+constexpr char kLockFileName[]  = "angle_program_cache.lock";
+constexpr char kTempFileSuffix[] = ".tmp";
+
+struct PackHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    char commitHash[kCommitHashFieldLength];
+};
+
+struct RecordHeader
+{
+    uint8_t programHash[kProgramHashLength];
+    uint32_t length;
+    uint32_t checksum;
+};
+
+struct IndexHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint64_t packSize;
+    uint64_t entryCount;
+};
+
+struct IndexEntry
+{
+    uint8_t programHash[kProgramHashLength];
+    uint32_t length;
+    uint64_t offset;
+    uint32_t checksum;
+    uint32_t padding;
+};
+
+static_assert(sizeof(PackHeader) == 32, "Unexpected PackHeader size");
+static_assert(sizeof(RecordHeader) == 28, "Unexpected RecordHeader size");
+static_assert(sizeof(IndexHeader) == 24, "Unexpected IndexHeader size");
+static_assert(sizeof(IndexEntry) == 40, "Unexpected IndexEntry size");
+
+PackHeader MakePackHeader()
+{
+    PackHeader header = {};
+    header.magic      = kPackMagic;
+    header.version    = kFormatVersion;
+    strncpy(header.commitHash, ANGLE_COMMIT_HASH, kCommitHashFieldLength - 1);
+    return header;
+}
+
+template <typename T>
+T ReadStruct(const uint8_t *data)
+{
+    T value;
+    memcpy(&value, data, sizeof(T));
+    return value;
+}
+
+bool TruncateFile(FILE *file, size_t size)
+{
+#if defined(ANGLE_PLATFORM_POSIX)
+    return ftruncate(fileno(file), static_cast<off_t>(size)) == 0;
+#elif defined(ANGLE_PLATFORM_WINDOWS)
+    return _chsize_s(_fileno(file), static_cast<__int64>(size)) == 0;
+#else
+    return false;
+#endif
+}
+
+bool AtomicReplaceFile(const std::string &from, const std::string &to)
+{
+#if defined(ANGLE_PLATFORM_WINDOWS)
+    // rename() doesn't replace existing files on Windows.
+    return MoveFileExA(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING) != FALSE;
+#else
+    return rename(from.c_str(), to.c_str()) == 0;
+#endif
+}
+
+// Returns false once |path| names another file than the open |file|, e.g. because another process
+// moved a compacted pack into place.
+bool IsSameFile(FILE *file, const std::string &path)
+{
+#if defined(ANGLE_PLATFORM_POSIX)
+    struct stat fileStat;
+    struct stat pathStat;
+    if (fstat(fileno(file), &fileStat) != 0 || stat(path.c_str(), &pathStat) != 0)
+    {
+        return false;
+    }
+    return fileStat.st_dev == pathStat.st_dev && fileStat.st_ino == pathStat.st_ino;
+#else
+    // Files that are open can't be replaced on Windows.
+    return true;
+#endif
+}
+
+// Holds an exclusive advisory lock on a file for its lifetime, so that processes sharing the cache
+// directory don't change the pack and index files at the same time. Without a lock file the cache
+// goes on unlocked, which is only unsafe when several processes share the directory.
+class ScopedFileLock final : angle::NonCopyable
+{
+  public:
+    explicit ScopedFileLock(const std::string &path)
+    {
+#if defined(ANGLE_PLATFORM_POSIX)
+        mFile = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+        if (mFile >= 0)
+        {
+            while (flock(mFile, LOCK_EX) != 0 && errno == EINTR)
+            {
+            }
+        }
+#elif defined(ANGLE_PLATFORM_WINDOWS) && !defined(ANGLE_ENABLE_WINDOWS_STORE)
+        mFile = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE,
+                            FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+                            OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (mFile != INVALID_HANDLE_VALUE)
+        {
+            OVERLAPPED overlapped = {};
+            LockFileEx(mFile, LOCKFILE_EXCLUSIVE_LOCK, 0, 1, 0, &overlapped);
+        }
+#endif
+    }
+
+    ~ScopedFileLock()
+    {
+#if defined(ANGLE_PLATFORM_POSIX)
+        if (mFile >= 0)
+        {
+            flock(mFile, LOCK_UN);
+            ::close(mFile);
+        }
+#elif defined(ANGLE_PLATFORM_WINDOWS) && !defined(ANGLE_ENABLE_WINDOWS_STORE)
+        if (mFile != INVALID_HANDLE_VALUE)
+        {
+            OVERLAPPED overlapped = {};
+            UnlockFileEx(mFile, 0, 1, 0, &overlapped);
+            CloseHandle(mFile);
+        }
+#endif
+    }
+
+  private:
+#if defined(ANGLE_PLATFORM_POSIX)
+    int mFile;
+#elif defined(ANGLE_PLATFORM_WINDOWS) && !defined(ANGLE_ENABLE_WINDOWS_STORE)
+    HANDLE mFile;
+#endif
+};
+}  // anonymous namespace
+
+// MappedFile implementation.
+MappedFile::MappedFile() : mData(nullptr), mSize(0), mIsMapped(false)
+{
+}
+
+MappedFile::~MappedFile()
+{
+    unmap();
+}
+
+bool MappedFile::map(const std::string &path)
+{
+    ASSERT(mData == nullptr);
+
+#if defined(ANGLE_PLATFORM_POSIX)
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0)
+    {
+        ::close(fd);
+        return false;
+    }
+
+    size_t size  = static_cast<size_t>(fileStat.st_size);
+    void *mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+
+    if (mapped == MAP_FAILED)
+    {
+        return false;
+    }
+
+    mData     = static_cast<const uint8_t *>(mapped);
+    mSize     = size;
+    mIsMapped = true;
+    return true;
+#else
+    FILE *file = fopen(path.c_str(), "rb");
+    if (!file)
+    {
+        return false;
+    }
+
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    bool success = size > 0 && mFallbackBuffer.resize(static_cast<size_t>(size)) &&
+                   fread(mFallbackBuffer.data(), static_cast<size_t>(size), 1, file) == 1;
+    fclose(file);
+
+    if (!success)
+    {
+        mFallbackBuffer.resize(0);
+        return false;
+    }
+
+    mData = mFallbackBuffer.data();
+    mSize = mFallbackBuffer.size();
+    return true;
+#endif  // defined(ANGLE_PLATFORM_POSIX)
+}
+
+void MappedFile::unmap()
+{
+#if defined(ANGLE_PLATFORM_POSIX)
+    if (mIsMapped)
+    {
+        munmap(const_cast<uint8_t *>(mData), mSize);
+    }
+#endif  // defined(ANGLE_PLATFORM_POSIX)
+
+    mFallbackBuffer.resize(0);
+    mData     = nullptr;
+    mSize     = 0;
+    mIsMapped = false;
+}
+
+// DiskProgramCache implementation.
+DiskProgramCache::DiskProgramCache()
+    : mMaxSize(0),
+      mIsOpen(false),
+      mIndexEntries(nullptr),
+      mIndexEntryCount(0),
+      mPackFile(nullptr),
+      mPackSize(0),
+      mWriteInFlight(false),
+      mPackFull(false),
+      mPackReplaced(false),
+      mWorkerPool(1),
+      mWriteTask(this)
+{
+}
+
+DiskProgramCache::~DiskProgramCache()
+{
+    close();
+}
+
+// static
+uint32_t DiskProgramCache::ComputeChecksum(const uint8_t *data, size_t length)
+{
+    static const uint32_t seed = 0x414E474C;
+    return angle::PMurHash32(seed, data, static_cast<int>(length));
+}
+
+bool DiskProgramCache::open(const std::string &directory, size_t maxCacheSizeBytes)
+{
+    ASSERT(!isOpen());
+
+    mPackPath  = directory + "/" + kPackFileName;
+    mIndexPath = directory + "/" + kIndexFileName;
+    mLockPath  = directory + "/" + kLockFileName;
+    mMaxSize   = maxCacheSizeBytes;
+
+    ScopedFileLock fileLock(mLockPath);
+    if (!mapPack())
+    {
+        return resetFiles();
+    }
+
+    // Records appended after the index was last saved are recovered by scanning the pack. The scan
+    // stops at the first torn or corrupt record, and everything after it is discarded.
+    size_t validSize = scanPack(loadIndex());
+    if (validSize > mMaxSize)
+    {
+        WARN() << "Program cache on disk exceeds its size limit, discarding it.";
+        return resetFiles();
+    }
+
+    mPackFile = fopen(mPackPath.c_str(), "r+b");
+    if (!mPackFile)
+    {
+        return resetFiles();
+    }
+
+    if (validSize < mMappedPack->size())
+    {
+        WARN() << "Program cache pack file is corrupt, truncating it to " << validSize
+               << " bytes.";
+        if (!TruncateFile(mPackFile, validSize))
+        {
+            fclose(mPackFile);
+            mPackFile = nullptr;
+            return resetFiles();
+        }
+    }
+
+    fseek(mPackFile, static_cast<long>(validSize), SEEK_SET);
+    mPackSize = validSize;
+    mIsOpen   = true;
+    return true;
+}
+
+void DiskProgramCache::close()
+{
+    if (!isOpen())
+    {
+        return;
+    }
+
+    flush();
+
+    fclose(mPackFile);
+    mPackFile = nullptr;
+    mIsOpen   = false;
+
+    {
+        // Other processes may have appended to the pack or rewritten the index since it was
+        // opened, so the entries are read from the files again.
+        ScopedFileLock fileLock(mLockPath);
+        unmapFiles();
+
+        if (mapPack())
+        {
+            size_t packSize  = scanPack(loadIndex());
+            EntryMap entries = collectMappedEntries();
+
+            bool changed = !mUnindexedEntries.empty() || !mRemovedEntries.empty();
+            for (const auto &removed : mRemovedEntries)
+            {
+                auto iter = entries.find(removed.first);
+                if (iter != entries.end() && iter->second.offset == removed.second)
+                {
+                    entries.erase(iter);
+                }
+            }
+
+            size_t liveSize = sizeof(PackHeader);
+            for (const auto &entry : entries)
+            {
+                liveSize += sizeof(RecordHeader) + entry.second.length;
+            }
+
+            // Records of removed or rewritten entries are dead weight. Reclaim them once they make
+            // up a quarter of the pack.
+            bool evict = mPackFull || liveSize > mMaxSize;
+            if (evict || packSize - liveSize > packSize / 4)
+            {
+                changed = compact(&entries, &packSize, evict) || changed;
+            }
+
+            if (changed)
+            {
+                saveIndex(entries, packSize);
+            }
+        }
+
+        unmapFiles();
+    }
+
+    mRemovedEntries.clear();
+    mUsedEntries.clear();
+    mWrittenEntries.clear();
+    mPackSize     = 0;
+    mPackFull     = false;
+    mPackReplaced = false;
+}
+
+bool DiskProgramCache::get(const ProgramHash &programHash,
+                           std::shared_ptr<const uint8_t> *binaryOut,
+                           size_t *lengthOut)
+{
+    if (!isOpen())
+    {
+        return false;
+    }
+
+    remapReplacedPack();
+    if (mRemovedEntries.count(programHash) > 0)
+    {
+        return false;
+    }
+
+    Entry entry;
+    if (!findMappedEntry(programHash, &entry))
+    {
+        return false;
+    }
+
+    // Index entries are only checked for bounds when the index is loaded. Verify the contents
+    // lazily so opening a large cache stays cheap.
+    const uint8_t *binary = mMappedPack->data() + entry.offset;
+    if (ComputeChecksum(binary, entry.length) != entry.checksum)
+    {
+        WARN() << "Program cache entry on disk is corrupt, discarding it.";
+        mRemovedEntries[programHash] = entry.offset;
+        return false;
+    }
+
+    mUsedEntries.insert(programHash);
+    *binaryOut = std::shared_ptr<const uint8_t>(mMappedPack, binary);
+    *lengthOut = entry.length;
+    return true;
+}
+
+void DiskProgramCache::put(const ProgramHash &programHash, const uint8_t *binary, size_t length)
+{
+    if (!isOpen())
+    {
+        return;
+    }
+
+    remapReplacedPack();
+    mUsedEntries.insert(programHash);
+
+    Entry existing;
+    if (mRemovedEntries.count(programHash) == 0 && findMappedEntry(programHash, &existing))
+    {
+        return;
+    }
+
+    size_t recordSize = sizeof(RecordHeader) + length;
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        if (mWrittenEntries.count(programHash) > 0)
+        {
+            return;
+        }
+
+        for (const PendingWrite &pending : mPendingWrites)
+        {
+            if (pending.programHash == programHash)
+            {
+                return;
+            }
+        }
+
+        if (length > std::numeric_limits<uint32_t>::max())
+        {
+            return;
+        }
+
+        if (mPackSize + recordSize > mMaxSize)
+        {
+            mPackFull = true;
+            return;
+        }
+
+        PendingWrite pending;
+        pending.programHash = programHash;
+        if (!pending.binary.resize(length))
+        {
+            return;
+        }
+        memcpy(pending.binary.data(), binary, length);
+
+        mPendingWrites.push_back(std::move(pending));
+        mPackSize += recordSize;
+
+        // The in-flight task drains the queue before finishing, so only start a new one if there
+        // is none.
+        if (mWriteInFlight)
+        {
+            return;
+        }
+        mWriteInFlight = true;
+    }
+
+    mWriteEvent = mWorkerPool.postWorkerTask(&mWriteTask);
+}
+
+void DiskProgramCache::remove(const ProgramHash &programHash)
+{
+    if (!isOpen())
+    {
+        return;
+    }
+
+    remapReplacedPack();
+    Entry entry;
+    if (findMappedEntry(programHash, &entry))
+    {
+        mRemovedEntries[programHash] = entry.offset;
+    }
+}
+
+void DiskProgramCache::flush()
+{
+    mWriteEvent.wait();
+    ASSERT(mPendingWrites.empty());
+}
+
+size_t DiskProgramCache::entryCount() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mIndexEntryCount + mUnindexedEntries.size() + mWrittenEntries.size() +
+           mPendingWrites.size();
+}
+
+size_t DiskProgramCache::size() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mPackSize;
+}
+
+bool DiskProgramCache::mapPack()
+{
+    // Binaries returned by get() keep the previous mapping alive until they are released.
+    mMappedPack = std::make_shared<MappedFile>();
+    return mMappedPack->map(mPackPath) && validatePack();
+}
+
+bool DiskProgramCache::validatePack()
+{
+    if (mMappedPack->size() < sizeof(PackHeader))
+    {
+        return false;
+    }
+
+    PackHeader expected = MakePackHeader();
+    return memcmp(mMappedPack->data(), &expected, sizeof(PackHeader)) == 0;
+}
+
+size_t DiskProgramCache::loadIndex()
+{
+    const size_t unindexed = sizeof(PackHeader);
+
+    if (!mMappedIndex.map(mIndexPath))
+    {
+        return unindexed;
+    }
+
+    bool valid = mMappedIndex.size() >= sizeof(IndexHeader);
+
+    IndexHeader header = {};
+    if (valid)
+    {
+        header = ReadStruct<IndexHeader>(mMappedIndex.data());
+        valid  = header.magic == kIndexMagic && header.version == kFormatVersion &&
+                header.packSize >= sizeof(PackHeader) && header.packSize <= mMappedPack->size() &&
+                header.entryCount ==
+                    (mMappedIndex.size() - sizeof(IndexHeader)) / sizeof(IndexEntry) &&
+                (mMappedIndex.size() - sizeof(IndexHeader)) % sizeof(IndexEntry) == 0;
+    }
+
+    // Check every entry points inside the indexed part of the pack, and that entries are sorted so
+    // that lookups can use a binary search.
+    const uint8_t *entries = mMappedIndex.data() + sizeof(IndexHeader);
+    for (uint64_t entryIndex = 0; valid && entryIndex < header.entryCount; ++entryIndex)
+    {
+        IndexEntry entry = ReadStruct<IndexEntry>(entries + entryIndex * sizeof(IndexEntry));
+        valid = entry.offset >= sizeof(PackHeader) + sizeof(RecordHeader) &&
+                entry.offset <= header.packSize && entry.length <= header.packSize - entry.offset;
+
+        if (valid && entryIndex > 0)
+        {
+            const uint8_t *previous = entries + (entryIndex - 1) * sizeof(IndexEntry);
+            valid = memcmp(previous, entry.programHash, kProgramHashLength) < 0;
+        }
+    }
+
+    if (!valid)
+    {
+        WARN() << "Program cache index is corrupt, rebuilding it.";
+        mMappedIndex.unmap();
+        return unindexed;
+    }
+
+    mIndexEntries    = entries;
+    mIndexEntryCount = static_cast<size_t>(header.entryCount);
+    return static_cast<size_t>(header.packSize);
+}
+
+size_t DiskProgramCache::scanPack(size_t offset)
+{
+    const uint8_t *pack = mMappedPack->data();
+    size_t packSize     = mMappedPack->size();
+
+    while (packSize - offset >= sizeof(RecordHeader))
+    {
+        RecordHeader header = ReadStruct<RecordHeader>(pack + offset);
+        size_t dataOffset   = offset + sizeof(RecordHeader);
+        if (header.length > packSize - dataOffset ||
+            ComputeChecksum(pack + dataOffset, header.length) != header.checksum)
+        {
+            break;
+        }
+
+        ProgramHash programHash;
+        memcpy(programHash.data(), header.programHash, kProgramHashLength);
+        mUnindexedEntries[programHash] = {dataOffset, header.length, header.checksum};
+
+        offset = dataOffset + header.length;
+    }
+
+    return offset;
+}
+
+bool DiskProgramCache::findMappedEntry(const ProgramHash &programHash, Entry *entryOut) const
+{
+    size_t low  = 0;
+    size_t high = mIndexEntryCount;
+    while (low < high)
+    {
+        size_t middle        = low + (high - low) / 2;
+        const uint8_t *entry = mIndexEntries + middle * sizeof(IndexEntry);
+        int compare          = memcmp(entry, programHash.data(), kProgramHashLength);
+        if (compare == 0)
+        {
+            IndexEntry indexEntry = ReadStruct<IndexEntry>(entry);
+            *entryOut = {indexEntry.offset, indexEntry.length, indexEntry.checksum};
+            return true;
+        }
+
+        if (compare < 0)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    auto iter = mUnindexedEntries.find(programHash);
+    if (iter != mUnindexedEntries.end())
+    {
+        *entryOut = iter->second;
+        return true;
+    }
+
+    return false;
+}
+
+DiskProgramCache::EntryMap DiskProgramCache::collectMappedEntries() const
+{
+    // Records found by scanning the pack are newer than the indexed ones.
+    EntryMap entries;
+    for (size_t entryIndex = 0; entryIndex < mIndexEntryCount; ++entryIndex)
+    {
+        IndexEntry indexEntry =
+            ReadStruct<IndexEntry>(mIndexEntries + entryIndex * sizeof(IndexEntry));
+
+        ProgramHash programHash;
+        memcpy(programHash.data(), indexEntry.programHash, kProgramHashLength);
+        entries[programHash] = {indexEntry.offset, indexEntry.length, indexEntry.checksum};
+    }
+
+    for (const auto &unindexed : mUnindexedEntries)
+    {
+        entries[unindexed.first] = unindexed.second;
+    }
+
+    return entries;
+}
+
+void DiskProgramCache::unmapFiles()
+{
+    mMappedPack.reset();
+    mMappedIndex.unmap();
+    mIndexEntries    = nullptr;
+    mIndexEntryCount = 0;
+    mUnindexedEntries.clear();
+}
+
+bool DiskProgramCache::resetFiles()
+{
+    unmapFiles();
+
+    ::remove(mIndexPath.c_str());
+
+    mPackFile = fopen(mPackPath.c_str(), "w+b");
+    if (!mPackFile)
+    {
+        WARN() << "Failed to create program cache pack file " << mPackPath;
+        return false;
+    }
+
+    PackHeader header = MakePackHeader();
+    if (fwrite(&header, sizeof(PackHeader), 1, mPackFile) != 1 || fflush(mPackFile) != 0)
+    {
+        WARN() << "Failed to write program cache pack file " << mPackPath;
+        fclose(mPackFile);
+        mPackFile = nullptr;
+        return false;
+    }
+
+    mPackSize = sizeof(PackHeader);
+    mIsOpen   = true;
+    return true;
+}
+
+bool DiskProgramCache::compact(EntryMap *entries, size_t *packSize, bool evict)
+{
+    // Records are kept in the order they were written, so the oldest entries come first.
+    using Record = std::tuple<bool, uint64_t, ProgramHash>;
+    std::vector<Record> records;
+    size_t liveSize = sizeof(PackHeader);
+    for (const auto &entry : *entries)
+    {
+        bool used = mUsedEntries.count(entry.first) > 0;
+        records.emplace_back(used, entry.second.offset, entry.first);
+        liveSize += sizeof(RecordHeader) + entry.second.length;
+    }
+
+    if (evict)
+    {
+        // Leave room for a while, so that the pack isn't compacted again on every run.
+        std::sort(records.begin(), records.end());
+        size_t evicted = 0;
+        while (evicted < records.size() && liveSize > mMaxSize / 2)
+        {
+            liveSize -= sizeof(RecordHeader) + entries->at(std::get<2>(records[evicted])).length;
+            evicted++;
+        }
+        records.erase(records.begin(), records.begin() + evicted);
+    }
+
+    std::sort(records.begin(), records.end(), [](const Record &a, const Record &b) {
+        return std::get<1>(a) < std::get<1>(b);
+    });
+
+    std::string tempPath = mPackPath + kTempFileSuffix;
+    FILE *file           = fopen(tempPath.c_str(), "wb");
+    if (!file)
+    {
+        WARN() << "Failed to create program cache pack file " << tempPath;
+        return false;
+    }
+
+    PackHeader header = MakePackHeader();
+    bool success      = fwrite(&header, sizeof(PackHeader), 1, file) == 1;
+
+    EntryMap compacted;
+    uint64_t offset = sizeof(PackHeader);
+    for (const Record &record : records)
+    {
+        const ProgramHash &programHash = std::get<2>(record);
+        const Entry &entry             = entries->at(programHash);
+
+        RecordHeader recordHeader = {};
+        memcpy(recordHeader.programHash, programHash.data(), kProgramHashLength);
+        recordHeader.length   = entry.length;
+        recordHeader.checksum = entry.checksum;
+
+        const uint8_t *binary = mMappedPack->data() + entry.offset;
+        success = success && fwrite(&recordHeader, sizeof(RecordHeader), 1, file) == 1 &&
+                  fwrite(binary, entry.length, 1, file) == 1;
+
+        offset += sizeof(RecordHeader);
+        compacted[programHash] = {offset, entry.length, entry.checksum};
+        offset += entry.length;
+    }
+    success = fclose(file) == 0 && success;
+
+    // Binaries still held by lookups keep the old mapping alive. Only POSIX maps the pack, and
+    // rename() replaces files that are mapped.
+    mMappedPack.reset();
+    if (!success || !AtomicReplaceFile(tempPath, mPackPath))
+    {
+        WARN() << "Failed to compact program cache pack file " << mPackPath;
+        ::remove(tempPath.c_str());
+        return false;
+    }
+
+    entries->swap(compacted);
+    *packSize = static_cast<size_t>(offset);
+    return true;
+}
+
+void DiskProgramCache::saveIndex(const EntryMap &entries, size_t packSize)
+{
+    IndexHeader header = {};
+    header.magic       = kIndexMagic;
+    header.version     = kFormatVersion;
+    header.packSize    = packSize;
+    header.entryCount  = entries.size();
+
+    // Write to a temporary file and move it into place, so a crash never leaves a torn index.
+    mMappedIndex.unmap();
+    mIndexEntries    = nullptr;
+    mIndexEntryCount = 0;
+
+    std::string tempPath = mIndexPath + kTempFileSuffix;
+    FILE *file           = fopen(tempPath.c_str(), "wb");
+    if (!file)
+    {
+        WARN() << "Failed to create program cache index file " << tempPath;
+        return;
+    }
+
+    bool success = fwrite(&header, sizeof(IndexHeader), 1, file) == 1;
+    for (const auto &entry : entries)
+    {
+        IndexEntry indexEntry = {};
+        memcpy(indexEntry.programHash, entry.first.data(), kProgramHashLength);
+        indexEntry.length   = entry.second.length;
+        indexEntry.offset   = entry.second.offset;
+        indexEntry.checksum = entry.second.checksum;
+        success             = success && fwrite(&indexEntry, sizeof(IndexEntry), 1, file) == 1;
+    }
+    success = fclose(file) == 0 && success;
+
+    if (!success || !AtomicReplaceFile(tempPath, mIndexPath))
+    {
+        WARN() << "Failed to write program cache index file " << mIndexPath;
+        ::remove(tempPath.c_str());
+    }
+}
+
+void DiskProgramCache::writePending()
+{
+    std::vector<PendingWrite> writes;
+    while (true)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            if (mPendingWrites.empty())
+            {
+                mWriteInFlight = false;
+                return;
+            }
+            writes.swap(mPendingWrites);
+        }
+
+        // Only this task touches the pack file while a write is in flight. Other processes may
+        // append to the pack too, so records go wherever the file ends while the lock is held.
+        ScopedFileLock fileLock(mLockPath);
+
+        // Another process may have compacted the pack and moved the result into place. Records
+        // appended to the replaced file would be lost, so they go to the new pack, which the next
+        // call on the cache maps.
+        if (!IsSameFile(mPackFile, mPackPath))
+        {
+            FILE *packFile = fopen(mPackPath.c_str(), "r+b");
+            if (packFile)
+            {
+                fclose(mPackFile);
+                mPackFile = packFile;
+
+                std::lock_guard<std::mutex> lock(mMutex);
+                mPackReplaced = true;
+            }
+        }
+
+        fseek(mPackFile, 0, SEEK_END);
+
+        for (const PendingWrite &pending : writes)
+        {
+            RecordHeader header = {};
+            memcpy(header.programHash, pending.programHash.data(), kProgramHashLength);
+            header.length   = static_cast<uint32_t>(pending.binary.size());
+            header.checksum = ComputeChecksum(pending.binary.data(), pending.binary.size());
+
+            long recordOffset = ftell(mPackFile);
+            bool success      = recordOffset >= 0 &&
+                           fwrite(&header, sizeof(RecordHeader), 1, mPackFile) == 1 &&
+                           fwrite(pending.binary.data(), pending.binary.size(), 1, mPackFile) == 1;
+
+            if (success)
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                Entry entry = {static_cast<uint64_t>(recordOffset) + sizeof(RecordHeader),
+                               header.length, header.checksum};
+                mWrittenEntries[pending.programHash] = entry;
+            }
+            else if (recordOffset >= 0)
+            {
+                // Cut the torn record off before other processes append after it.
+                fflush(mPackFile);
+                TruncateFile(mPackFile, static_cast<size_t>(recordOffset));
+                fseek(mPackFile, recordOffset, SEEK_SET);
+            }
+        }
+
+        fflush(mPackFile);
+        long packEnd = ftell(mPackFile);
+        writes.clear();
+
+        // Account for the records appended by other processes.
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (packEnd >= 0)
+        {
+            mPackSize = static_cast<size_t>(packEnd);
+            for (const PendingWrite &pending : mPendingWrites)
+            {
+                mPackSize += sizeof(RecordHeader) + pending.binary.size();
+            }
+        }
+    }
+}
+
+void DiskProgramCache::remapReplacedPack()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (!mPackReplaced)
+        {
+            return;
+        }
+        mPackReplaced = false;
+    }
+
+    // The worker can't append while the file lock is held, so the scan sees every record it wrote.
+    ScopedFileLock fileLock(mLockPath);
+    unmapFiles();
+
+    size_t packSize = 0;
+    if (mapPack())
+    {
+        packSize = scanPack(loadIndex());
+    }
+    else
+    {
+        unmapFiles();
+    }
+
+    // Removed entries stay hidden, at the offsets of their records in the new pack.
+    for (auto &removed : mRemovedEntries)
+    {
+        Entry entry;
+        if (findMappedEntry(removed.first, &entry))
+        {
+            removed.second = entry.offset;
+        }
+    }
+
+    // The records written so far are either in the new pack, or were evicted by the compaction
+    // and may be written again.
+    std::lock_guard<std::mutex> lock(mMutex);
+    mWrittenEntries.clear();
+    if (packSize > 0)
+    {
+        mPackSize = packSize;
+        for (const PendingWrite &pending : mPendingWrites)
+        {
+            mPackSize += sizeof(RecordHeader) + pending.binary.size();
+        }
+    }
+}
+
+void DiskProgramCache::WriteTask::operator()()
+{
+    mCache->writePending();
+}
+
+}  // namespace gl
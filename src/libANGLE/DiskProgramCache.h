@@ -0,0 +1,170 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// DiskProgramCache: Persistent second tier for the MemoryProgramCache. Program binaries are
+//   appended to a pack file on a worker thread. The pack and its sorted index are memory-mapped
+//   when the cache is opened, so lookups return pointers directly into the mapping. Processes
+//   sharing the directory serialize their changes to the files with an advisory file lock.
+
+#ifndef LIBANGLE_DISK_PROGRAM_CACHE_H_
+#define LIBANGLE_DISK_PROGRAM_CACHE_H_
+
+#include <cstdio>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "common/MemoryBuffer.h"
+#include "libANGLE/MemoryProgramCache.h"
+#include "libANGLE/WorkerThread.h"
+
+namespace gl
+{
+// A read-only view of a whole file. Uses mmap where available and falls back to reading the file
+// into memory otherwise.
+class MappedFile final : angle::NonCopyable
+{
+  public:
+    MappedFile();
+    ~MappedFile();
+
+    bool map(const std::string &path);
+    void unmap();
+
+    const uint8_t *data() const { return mData; }
+    size_t size() const { return mSize; }
+
+  private:
+    const uint8_t *mData;
+    size_t mSize;
+    bool mIsMapped;
+    angle::MemoryBuffer mFallbackBuffer;
+};
+
+class DiskProgramCache final : angle::NonCopyable
+{
+  public:
+    DiskProgramCache();
+    ~DiskProgramCache();
+
+    // Maps the pack and index files stored in |directory|. Files which are stale, truncated or
+    // corrupt are discarded. Returns false if the directory cannot be used for the cache.
+    bool open(const std::string &directory, size_t maxCacheSizeBytes);
+
+    // Waits for pending writes, saves the index and unmaps the files. A pack that filled up, or
+    // that holds many removed records, is compacted first. Filling up evicts the oldest entries
+    // that were not used in this session, then the oldest used ones, until the pack is half full.
+    void close();
+
+    bool isOpen() const { return mIsOpen; }
+
+    // Returns a pointer into the mapped pack file. It shares ownership of the mapping, so it stays
+    // valid after close(). Binaries written since open() are not mapped yet and are only found on
+    // the next run.
+    bool get(const ProgramHash &programHash,
+             std::shared_ptr<const uint8_t> *binaryOut,
+             size_t *lengthOut);
+
+    // Copies the binary and queues it to be appended to the pack file on a worker thread. Binaries
+    // that would grow the pack file past the maximum size are dropped until the pack is compacted
+    // by close().
+    void put(const ProgramHash &programHash, const uint8_t *binary, size_t length);
+
+    // Hides an entry, e.g. because it failed to load. It is dropped from the index on close().
+    void remove(const ProgramHash &programHash);
+
+    // Blocks until all queued binaries have been written to the pack file.
+    void flush();
+
+    // Returns the number of entries in the pack file, including queued writes.
+    size_t entryCount() const;
+
+    // Returns the size of the pack file in bytes, including queued writes.
+    size_t size() const;
+
+    size_t maxSize() const { return mMaxSize; }
+
+    static uint32_t ComputeChecksum(const uint8_t *data, size_t length);
+
+  private:
+    struct Entry
+    {
+        uint64_t offset;
+        uint32_t length;
+        uint32_t checksum;
+    };
+
+    using EntryMap = std::map<ProgramHash, Entry>;
+
+    struct PendingWrite
+    {
+        ProgramHash programHash;
+        angle::MemoryBuffer binary;
+    };
+
+    class WriteTask : public angle::Closure
+    {
+      public:
+        WriteTask(DiskProgramCache *cache) : mCache(cache) {}
+        void operator()() override;
+
+      private:
+        DiskProgramCache *mCache;
+    };
+
+    bool mapPack();
+    bool validatePack();
+    size_t loadIndex();
+    size_t scanPack(size_t offset);
+    bool findMappedEntry(const ProgramHash &programHash, Entry *entryOut) const;
+    EntryMap collectMappedEntries() const;
+    void unmapFiles();
+    bool resetFiles();
+    bool compact(EntryMap *entries, size_t *packSize, bool evict);
+    void saveIndex(const EntryMap &entries, size_t packSize);
+    void writePending();
+    void remapReplacedPack();
+
+    std::string mPackPath;
+    std::string mIndexPath;
+    std::string mLockPath;
+    size_t mMaxSize;
+    bool mIsOpen;
+
+    // The mapped files and the entries found in them only change when the worker finds that another
+    // process replaced the pack, and are remapped by the next call on the cache. The pack mapping
+    // is shared with the binaries returned by get().
+    // Entries found in the pack but missing from the index, e.g. after a crash, are kept on the
+    // side until the index is rewritten. Removed entries remember the offset of their record, so
+    // that a newer record of the same program survives.
+    std::shared_ptr<MappedFile> mMappedPack;
+    MappedFile mMappedIndex;
+    const uint8_t *mIndexEntries;
+    size_t mIndexEntryCount;
+    EntryMap mUnindexedEntries;
+    std::map<ProgramHash, uint64_t> mRemovedEntries;
+    std::set<ProgramHash> mUsedEntries;
+
+    // State shared with the worker thread.
+    mutable std::mutex mMutex;
+    FILE *mPackFile;
+    size_t mPackSize;
+    bool mWriteInFlight;
+    std::vector<PendingWrite> mPendingWrites;
+    EntryMap mWrittenEntries;
+    bool mPackFull;
+    bool mPackReplaced;
+
+    angle::WorkerThreadPool mWorkerPool;
+    WriteTask mWriteTask;
+    angle::WaitableEvent mWriteEvent;
+};
+
+}  // namespace gl
+
+#endif  // LIBANGLE_DISK_PROGRAM_CACHE_H_
@@ -0,0 +1,372 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// DiskProgramCache_unittest:
+//   Tests for the persistent tier of the program cache.
+
+#include <gtest/gtest.h>
+
+#include <stdio.h>
+#include <vector>
+
+#include "common/system_utils.h"
+#include "libANGLE/DiskProgramCache.h"
+
+using namespace gl;
+
+namespace
+{
+using Blob = std::vector<uint8_t>;
+
+constexpr size_t kMaxCacheSize = 64 * 1024;
+
+ProgramHash MakeHash(uint8_t seed)
+{
+    ProgramHash hash;
+    for (size_t index = 0; index < hash.size(); ++index)
+    {
+        hash[index] = static_cast<uint8_t>(seed * 7 + index);
+    }
+    return hash;
+}
+
+Blob MakeBlob(size_t size, uint8_t seed)
+{
+    Blob blob(size);
+    for (size_t index = 0; index < size; ++index)
+    {
+        blob[index] = static_cast<uint8_t>(seed + index);
+    }
+    return blob;
+}
+
+class DiskProgramCacheTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        mDirectory = angle::GetExecutableDirectory();
+        removeFiles();
+    }
+
+    void TearDown() override
+    {
+        mCache.close();
+        removeFiles();
+    }
+
+    std::string packPath() const { return mDirectory + "/angle_program_cache.pack"; }
+    std::string indexPath() const { return mDirectory + "/angle_program_cache.index"; }
+    std::string lockPath() const { return mDirectory + "/angle_program_cache.lock"; }
+
+    void removeFiles()
+    {
+        remove(packPath().c_str());
+        remove(indexPath().c_str());
+        remove(lockPath().c_str());
+    }
+
+    void put(uint8_t seed, size_t size) { put(&mCache, seed, size); }
+
+    void put(DiskProgramCache *cache, uint8_t seed, size_t size)
+    {
+        Blob blob = MakeBlob(size, seed);
+        cache->put(MakeHash(seed), blob.data(), blob.size());
+    }
+
+    bool contains(uint8_t seed, size_t size)
+    {
+        std::shared_ptr<const uint8_t> binary;
+        size_t length = 0;
+        if (!mCache.get(MakeHash(seed), &binary, &length))
+        {
+            return false;
+        }
+        return Blob(binary.get(), binary.get() + length) == MakeBlob(size, seed);
+    }
+
+    void reopen()
+    {
+        mCache.close();
+        ASSERT_TRUE(mCache.open(mDirectory, kMaxCacheSize));
+    }
+
+    long fileSize(const std::string &path)
+    {
+        FILE *file = fopen(path.c_str(), "rb");
+        fseek(file, 0, SEEK_END);
+        long size = ftell(file);
+        fclose(file);
+        return size;
+    }
+
+    void overwriteFile(const std::string &path, long offset, const Blob &data)
+    {
+        FILE *file = fopen(path.c_str(), "r+b");
+        fseek(file, offset, SEEK_SET);
+        fwrite(data.data(), data.size(), 1, file);
+        fclose(file);
+    }
+
+    std::string mDirectory;
+    DiskProgramCache mCache;
+};
+
+// Binaries written in one session are found in the next one.
+TEST_F(DiskProgramCacheTest, PersistsAcrossSessions)
+{
+    ASSERT_TRUE(mCache.open(mDirectory, kMaxCacheSize));
+    put(1, 100);
+    put(2, 333);
+
+    // Binaries written in this session are only mapped on the next open.
+    EXPECT_FALSE(contains(1, 100));
+    EXPECT_EQ(2u, mCache.entryCount());
+
+    reopen();
+    EXPECT_TRUE(contains(1, 100));
+    EXPECT_TRUE(contains(2, 333));
+    EXPECT_FALSE(contains(3, 100));
+
+    // Appending to an existing pack keeps the older entries.
+    put(3, 50);
+    reopen();
+    EXPECT_TRUE(contains(1, 100));
+    EXPECT_TRUE(contains(2, 333));
+    EXPECT_TRUE(contains(3, 50));
+    EXPECT_EQ(3u, mCache.entryCount());
+}
+
+// A damaged index is rebuilt by scanning the pack.
+TEST_F(DiskProgramCacheTest, CorruptIndexIsRebuilt)
+{
+    ASSERT_TRUE(mCache.open(mDirectory, kMaxCacheSize));
+    put(1, 100);
+    put(2, 200);
+    mCache.close();
+
+    overwriteFile(indexPath(), 0, MakeBlob(16, 0xAB));
+
+    ASSERT_TRUE(mCache.open(mDirectory, kMaxCacheSize));
+    EXPECT_TRUE(contains(1, 100));
+    EXPECT_TRUE(contains(2, 200));
+}
+
+// A record torn by a crash is dropped along with everything after it.
+TEST_F(DiskProgramCacheTest, TornRecordIsDropped)
+{
+    ASSERT_TRUE(mCache.open(mDirectory, kMaxCacheSize));
+    put(1, 100);
+    put(2, 200);
+    mCache.close();
+
+    // Chop the tail of the second binary and lose the index.
+    long packSize = fileSize(packPath());
+    FILE *file    = fopen(packPath().c_str(), "r+b");
+    Blob contents(static_cast<size_t>(packSize));
+    fread(contents.data(), contents.size(), 1, file);
+    fclose(file);
+    contents.resize(contents.size() - 10);
+    file = fopen(packPath().c_str(), "wb");
+    fwrite(contents.data(), contents.size(), 1, file);
+    fclose(file);
+    remove(indexPath().c_str());
+
+    ASSERT_TRUE(mCache.open(mDirectory, kMaxCacheSize));
+    EXPECT_TRUE(contains(1, 100));
+    EXPECT_FALSE(contains(2, 200));
+
+    put(3, 64);
+    reopen();
+    EXPECT_TRUE(contains(1, 100));
+    EXPECT_TRUE(contains(3, 64));
+}
+
+// Corrupt binaries fail their checksum and are removed from the index.
+TEST_F(DiskProgramCacheTest, CorruptBinaryIsDiscarded)
+{
+    ASSERT_TRUE(mCache.open(mDirectory, kMaxCacheSize));
+    put(1, 100);
+    mCache.close();
+
+    long packSize = fileSize(packPath());
+    overwriteFile(packPath(), packSize - 1, {0xFF});
+
+    ASSERT_TRUE(mCache.open(mDirectory, kMaxCacheSize));
+    EXPECT_FALSE(contains(1, 100));
+
+    // The entry can be written again.
+    put(1, 100);
+    reopen();
+    EXPECT_TRUE(contains(1, 100));
+}
+
+// Removed entries do not come back in the next session.
+TEST_F(DiskProgramCacheTest, RemovedEntriesArePurged)
+{
+    ASSERT_TRUE(mCache.open(mDirectory, kMaxCacheSize));
+    put(1, 100);
+    put(2, 100);
+    reopen();
+
+    mCache.remove(MakeHash(1));
+    EXPECT_FALSE(contains(1, 100));
+
+    reopen();
+    EXPECT_FALSE(contains(1, 100));
+    EXPECT_TRUE(contains(2, 100));
+}
+
+// The pack never grows past the size limit.
+TEST_F(DiskProgramCacheTest, SizeLimit)
+{
+    ASSERT_TRUE(mCache.open(mDirectory, kMaxCacheSize));
+    put(1, kMaxCacheSize / 4);
+    put(2, kMaxCacheSize * 3 / 4);
+    EXPECT_EQ(1u, mCache.entryCount());
+    EXPECT_LE(mCache.size(), kMaxCacheSize);
+
+    reopen();
+    EXPECT_TRUE(contains(1, kMaxCacheSize / 4));
+    EXPECT_FALSE(contains(2, kMaxCacheSize * 3 / 4));
+
+    // A pack over a smaller limit is discarded.
+    mCache.close();
+    ASSERT_TRUE(mCache.open(mDirectory, kMaxCacheSize / 8));
+    EXPECT_FALSE(contains(1, kMaxCacheSize / 4));
+    EXPECT_EQ(0u, mCache.entryCount());
+}
+
+// A full pack is compacted on close, evicting the oldest entries, so it accepts new entries again.
+TEST_F(DiskProgramCacheTest, FullPackIsCompacted)
+{
+    ASSERT_TRUE(mCache.open(mDirectory, kMaxCacheSize));
+    put(1, kMaxCacheSize * 3 / 8);
+    put(2, kMaxCacheSize * 3 / 8);
+    put(3, kMaxCacheSize * 3 / 8);
+    EXPECT_EQ(2u, mCache.entryCount());
+
+    reopen();
+    EXPECT_FALSE(contains(1, kMaxCacheSize * 3 / 8));
+    EXPECT_TRUE(contains(2, kMaxCacheSize * 3 / 8));
+    EXPECT_LE(fileSize(packPath()), static_cast<long>(kMaxCacheSize / 2));
+
+    put(3, kMaxCacheSize * 3 / 8);
+    reopen();
+    EXPECT_TRUE(contains(2, kMaxCacheSize * 3 / 8));
+    EXPECT_TRUE(contains(3, kMaxCacheSize * 3 / 8));
+}
+
+// Entries used in the session that filled the pack are evicted after the unused ones.
+TEST_F(DiskProgramCacheTest, CompactionKeepsUsedEntries)
+{
+    ASSERT_TRUE(mCache.open(mDirectory, kMaxCacheSize));
+    put(1, kMaxCacheSize * 3 / 16);
+    put(2, kMaxCacheSize * 3 / 16);
+    put(3, kMaxCacheSize * 3 / 16);
+    reopen();
+
+    EXPECT_TRUE(contains(1, kMaxCacheSize * 3 / 16));
+    put(4, kMaxCacheSize / 2);
+    reopen();
+
+    EXPECT_TRUE(contains(1, kMaxCacheSize * 3 / 16));
+    EXPECT_FALSE(contains(2, kMaxCacheSize * 3 / 16));
+    EXPECT_TRUE(contains(3, kMaxCacheSize * 3 / 16));
+}
+
+// The records of removed entries are reclaimed.
+TEST_F(DiskProgramCacheTest, DeadRecordsAreReclaimed)
+{
+    ASSERT_TRUE(mCache.open(mDirectory, kMaxCacheSize));
+    put(1, kMaxCacheSize / 4);
+    put(2, 100);
+    reopen();
+    long fullSize = fileSize(packPath());
+
+    mCache.remove(MakeHash(1));
+    reopen();
+    EXPECT_LT(fileSize(packPath()), fullSize - static_cast<long>(kMaxCacheSize / 4));
+    EXPECT_FALSE(contains(1, kMaxCacheSize / 4));
+    EXPECT_TRUE(contains(2, 100));
+}
+
+// Caches sharing a directory, like separate processes do, keep each other's entries.
+TEST_F(DiskProgramCacheTest, SharedDirectory)
+{
+    DiskProgramCache otherCache;
+    ASSERT_TRUE(mCache.open(mDirectory, kMaxCacheSize));
+    ASSERT_TRUE(otherCache.open(mDirectory, kMaxCacheSize));
+
+    put(1, 100);
+    put(&otherCache, 2, 200);
+    otherCache.flush();
+    put(3, 300);
+
+    mCache.close();
+    put(&otherCache, 4, 400);
+    otherCache.close();
+
+    ASSERT_TRUE(mCache.open(mDirectory, kMaxCacheSize));
+    EXPECT_TRUE(contains(1, 100));
+    EXPECT_TRUE(contains(2, 200));
+    EXPECT_TRUE(contains(3, 300));
+    EXPECT_TRUE(contains(4, 400));
+}
+
+// A cache keeps writing to the pack after another cache sharing the directory compacted it, and
+// then finds both its own and the other cache's entries in the new pack.
+TEST_F(DiskProgramCacheTest, PackCompactedByOtherCache)
+{
+    ASSERT_TRUE(mCache.open(mDirectory, kMaxCacheSize));
+    put(1, kMaxCacheSize / 4);
+    put(2, 100);
+    reopen();
+
+    DiskProgramCache otherCache;
+    ASSERT_TRUE(otherCache.open(mDirectory, kMaxCacheSize));
+    put(3, 300);
+    mCache.flush();
+
+    // Removing the large entry makes the other cache compact the pack when it closes.
+    long fullSize = fileSize(packPath());
+    otherCache.remove(MakeHash(1));
+    otherCache.close();
+    EXPECT_LT(fileSize(packPath()), fullSize - static_cast<long>(kMaxCacheSize / 4));
+
+    put(4, 400);
+    mCache.flush();
+
+    // The new pack is mapped on the next lookup. It has the entry written before the compaction
+    // and the one written after it.
+    EXPECT_TRUE(contains(2, 100));
+    EXPECT_TRUE(contains(3, 300));
+    EXPECT_TRUE(contains(4, 400));
+    EXPECT_EQ(static_cast<size_t>(fileSize(packPath())), mCache.size());
+
+    put(5, 500);
+    reopen();
+    EXPECT_FALSE(contains(1, kMaxCacheSize / 4));
+    EXPECT_TRUE(contains(2, 100));
+    EXPECT_TRUE(contains(3, 300));
+    EXPECT_TRUE(contains(4, 400));
+    EXPECT_TRUE(contains(5, 500));
+}
+
+// Files from other builds or other formats are ignored.
+TEST_F(DiskProgramCacheTest, StalePackIsReset)
+{
+    ASSERT_TRUE(mCache.open(mDirectory, kMaxCacheSize));
+    put(1, 100);
+    mCache.close();
+
+    overwriteFile(packPath(), 0, {'X', 'X', 'X', 'X'});
+
+    ASSERT_TRUE(mCache.open(mDirectory, kMaxCacheSize));
+    EXPECT_FALSE(contains(1, 100));
+    EXPECT_EQ(0u, mCache.entryCount());
+}
+
+}  // anonymous namespace
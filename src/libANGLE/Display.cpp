@@ -18,10 +18,12 @@
 
 #include <platform/Platform.h>
 #include <EGL/eglext.h>
+#include <GLSLANG/ShaderLang.h>
 
 #include "common/debug.h"
 #include "common/mathutil.h"
 #include "common/platform.h"
+#include "common/system_utils.h"
 #include "common/utilities.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Device.h"
@@ -86,6 +88,13 @@ static WindowSurfaceMap *GetWindowSurfaces()
     return &windowSurfaces;
 }
 
+// Guards the window surface map, which is shared by every display.
+static std::mutex *GetWindowSurfacesMutex()
+{
+    static std::mutex windowSurfacesMutex;
+    return &windowSurfacesMutex;
+}
+
 typedef std::map<EGLNativeDisplayType, Display *> ANGLEPlatformDisplayMap;
 static ANGLEPlatformDisplayMap *GetANGLEPlatformDisplayMap()
 {
@@ -271,6 +280,27 @@ void ANGLESetDefaultDisplayPlatform(angle::EGLDisplayType display)
     platformMethods->logInfo    = Display_logInfo;
 }
 
+// Opens the disk caches of programs and translations, which reads their index from disk.
+class OpenDiskCachesTask final : public angle::Closure
+{
+  public:
+    OpenDiskCachesTask(gl::MemoryProgramCache *programCache, const std::string &directory)
+        : mProgramCache(programCache), mDirectory(directory)
+    {
+    }
+
+    void operator()() override
+    {
+        TRACE_EVENT0("gpu.angle", "egl::Display::initialize::OpenDiskCaches");
+        mProgramCache->openDiskCache(mDirectory, gl::kDefaultMaxProgramCacheDiskBytes);
+        sh::ConfigureTranslationCache(gl::kDefaultMaxTranslationCacheMemoryBytes, mDirectory);
+    }
+
+  private:
+    gl::MemoryProgramCache *mProgramCache;
+    std::string mDirectory;
+};
+
 }  // anonymous namespace
 
 DisplayState::DisplayState()
@@ -387,7 +417,9 @@ Display::Display(EGLenum platform, EGLNativeDisplayType displayId, Device *eglDe
       mTextureManager(nullptr),
       mMemoryProgramCache(gl::kDefaultMaxProgramCacheMemoryBytes),
       mGlobalTextureShareGroupUsers(0),
-      mProxyContext(this)
+      mWorkerThreadPool(1),
+      mProxyContext(this),
+      mProxyContextAvailable(false)
 {
 }
 
@@ -463,43 +495,93 @@ Error Display::initialize()
         return NoError();
     }
 
-    Error error = mImplementation->initialize(this);
+    // Reading the index of the disk caches doesn't depend on the implementation.
+    std::string programCacheDirectory = angle::GetEnvironmentVar(gl::kProgramCacheDirectoryEnvVar);
+    std::unique_ptr<OpenDiskCachesTask> openDiskCachesTask;
+    angle::WaitableEvent diskCachesOpened;
+    if (!programCacheDirectory.empty())
+    {
+        openDiskCachesTask.reset(
+            new OpenDiskCachesTask(&mMemoryProgramCache, programCacheDirectory));
+        diskCachesOpened = mWorkerThreadPool.postWorkerTask(openDiskCachesTask.get());
+    }
+
+    Error error = initializeImpl();
+
+    if (openDiskCachesTask)
+    {
+        TRACE_EVENT0("gpu.angle", "egl::Display::initialize::WaitForDiskCaches");
+        diskCachesOpened.wait();
+        if (error.isError())
+        {
+            mMemoryProgramCache.closeDiskCache();
+        }
+    }
+
     if (error.isError())
     {
-        // Log extended error message here
-        ERR() << "ANGLE Display::initialize error " << error.getID() << ": " << error.getMessage();
         return error;
     }
 
-    mCaps = mImplementation->getCaps();
+    {
+        std::lock_guard<std::mutex> lock(mProxyContextMutex);
+        mProxyContextAvailable = true;
+    }
+    mInitialized = true;
 
-    mConfigSet = mImplementation->generateConfigs();
-    if (mConfigSet.size() == 0)
+    return NoError();
+}
+
+Error Display::initializeImpl()
+{
     {
-        mImplementation->terminate();
-        return EglNotInitialized();
+        TRACE_EVENT0("gpu.angle", "egl::Display::initialize::Implementation");
+        Error error = mImplementation->initialize(this);
+        if (error.isError())
+        {
+            // Log extended error message here
+            ERR() << "ANGLE Display::initialize error " << error.getID() << ": "
+                  << error.getMessage();
+            return error;
+        }
     }
 
-    // OpenGL ES1 is implemented in the frontend, explicitly add ES1 support to all configs
-    for (auto &config : mConfigSet)
     {
-        // TODO(geofflang): Enable the conformant bit once we pass enough tests
-        // config.second.conformant |= EGL_OPENGL_ES_BIT;
+        TRACE_EVENT0("gpu.angle", "egl::Display::initialize::Configs");
+        mCaps = mImplementation->getCaps();
+
+        mConfigSet = mImplementation->generateConfigs();
+        if (mConfigSet.size() == 0)
+        {
+            mImplementation->terminate();
+            return EglNotInitialized();
+        }
+
+        // OpenGL ES1 is implemented in the frontend, explicitly add ES1 support to all configs
+        for (auto &config : mConfigSet)
+        {
+            // TODO(geofflang): Enable the conformant bit once we pass enough tests
+            // config.second.conformant |= EGL_OPENGL_ES_BIT;
 
-        config.second.renderableType |= EGL_OPENGL_ES_BIT;
+            config.second.renderableType |= EGL_OPENGL_ES_BIT;
+        }
     }
 
-    initDisplayExtensions();
-    initVendorString();
+    {
+        TRACE_EVENT0("gpu.angle", "egl::Display::initialize::Extensions");
+        initDisplayExtensions();
+        initVendorString();
+    }
 
     // Populate the Display's EGLDeviceEXT if the Display wasn't created using one
     if (mPlatform != EGL_PLATFORM_DEVICE_EXT)
     {
         if (mDisplayExtensions.deviceQuery)
         {
+            TRACE_EVENT0("gpu.angle", "egl::Display::initialize::Device");
             std::unique_ptr<rx::DeviceImpl> impl(mImplementation->createDevice());
             ASSERT(impl != nullptr);
-            error = impl->initialize();
+            Error error = impl->initialize();
             if (error.isError())
             {
                 ERR() << "Failed to initialize display because device creation failed: "
@@ -521,13 +603,6 @@ Error Display::initialize()
         ASSERT(mDevice != nullptr);
     }
 
-    mProxyContext.reset(nullptr);
-    gl::Context *proxyContext = new gl::Context(mImplementation, nullptr, nullptr, nullptr, nullptr,
-                                                egl::AttributeMap(), mDisplayExtensions);
-    mProxyContext.reset(proxyContext);
-
-    mInitialized = true;
-
     return NoError();
 }
 
@@ -536,6 +611,7 @@ Error Display::terminate()
     ANGLE_TRY(makeCurrent(nullptr, nullptr, nullptr));
 
     mMemoryProgramCache.clear();
+    mMemoryProgramCache.closeDiskCache();
 
     while (!mContextSet.empty())
     {
@@ -561,6 +637,10 @@ Error Display::terminate()
     }
 
     // Allow the EGL objects that are being deleted to use the proxy context.
+    {
+        std::lock_guard<std::mutex> lock(mProxyContextMutex);
+        mProxyContextAvailable = false;
+    }
     mProxyContext.reset(nullptr);
 
     mConfigSet.clear();
@@ -607,8 +687,11 @@ Error Display::createWindowSurface(const Config *configuration,
 
     ASSERT(outSurface != nullptr);
     *outSurface = surface.release();
+
+    std::lock_guard<std::mutex> lock(mMutex);
     mState.surfaceSet.insert(*outSurface);
 
+    std::lock_guard<std::mutex> windowSurfacesLock(*GetWindowSurfacesMutex());
     WindowSurfaceMap *windowSurfaces = GetWindowSurfaces();
     ASSERT(windowSurfaces && windowSurfaces->find(window) == windowSurfaces->end());
     windowSurfaces->insert(std::make_pair(window, *outSurface));
@@ -632,6 +715,8 @@ Error Display::createPbufferSurface(const Config *configuration,
 
     ASSERT(outSurface != nullptr);
     *outSurface = surface.release();
+
+    std::lock_guard<std::mutex> lock(mMutex);
     mState.surfaceSet.insert(*outSurface);
 
     return NoError();
@@ -656,6 +741,8 @@ Error Display::createPbufferFromClientBuffer(const Config *configuration,
 
     ASSERT(outSurface != nullptr);
     *outSurface = surface.release();
+
+    std::lock_guard<std::mutex> lock(mMutex);
     mState.surfaceSet.insert(*outSurface);
 
     return NoError();
@@ -679,6 +766,8 @@ Error Display::createPixmapSurface(const Config *configuration,
 
     ASSERT(outSurface != nullptr);
     *outSurface = surface.release();
+
+    std::lock_guard<std::mutex> lock(mMutex);
     mState.surfaceSet.insert(*outSurface);
 
     return NoError();
@@ -723,6 +812,8 @@ Error Display::createImage(const gl::Context *context,
 
     // Add this image to the list of all images and hold a ref to it.
     image->addRef();
+
+    std::lock_guard<std::mutex> lock(mMutex);
     mImageSet.insert(image);
 
     return NoError();
@@ -735,6 +826,8 @@ Error Display::createStream(const AttributeMap &attribs, Stream **outStream)
     Stream *stream = new Stream(this, attribs);
 
     ASSERT(stream != nullptr);
+
+    std::lock_guard<std::mutex> lock(mMutex);
     mStreamSet.insert(stream);
 
     ASSERT(outStream != nullptr);
@@ -762,6 +855,7 @@ Error Display::createContext(const Config *configuration,
 
     if (usingDisplayTextureShareGroup)
     {
+        std::lock_guard<std::mutex> lock(mMutex);
         ASSERT((mTextureManager == nullptr) == (mGlobalTextureShareGroupUsers == 0));
         if (mTextureManager == nullptr)
         {
@@ -780,8 +874,8 @@ Error Display::createContext(const Config *configuration,
         cachePointer = nullptr;
     }
 
-    // A program cache size of zero indicates it should be disabled.
-    if (mMemoryProgramCache.maxSize() == 0)
+    // A program cache size of zero indicates it should be disabled, unless it is backed by disk.
+    if (!mMemoryProgramCache.isEnabled())
     {
         cachePointer = nullptr;
     }
@@ -791,6 +885,16 @@ Error Display::createContext(const Config *configuration,
                         attribs, mDisplayExtensions);
 
     ASSERT(context != nullptr);
+
+    // Contexts drop the cache if their back-end can't save and load program binaries, which is the
+    // same for every context of the display. The disk tier would only hold binaries that can't be
+    // loaded then.
+    if (cachePointer != nullptr && context->getMemoryProgramCache() == nullptr)
+    {
+        mMemoryProgramCache.closeDiskCache();
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
     mContextSet.insert(context);
 
     ASSERT(outContext != nullptr);
@@ -815,12 +919,16 @@ Error Display::makeCurrent(egl::Surface *drawSurface,
 
 Error Display::restoreLostDevice()
 {
-    for (ContextSet::iterator ctx = mContextSet.begin(); ctx != mContextSet.end(); ctx++)
     {
-        if ((*ctx)->isResetNotificationEnabled())
+        std::lock_guard<std::mutex> lock(mMutex);
+        for (ContextSet::iterator ctx = mContextSet.begin(); ctx != mContextSet.end(); ctx++)
         {
-            // If reset notifications have been requested, application must delete all contexts first
-            return EglContextLost();
+            if ((*ctx)->isResetNotificationEnabled())
+            {
+                // If reset notifications have been requested, application must delete all
+                // contexts first
+                return EglContextLost();
+            }
         }
     }
 
@@ -829,41 +937,52 @@ Error Display::restoreLostDevice()
 
 Error Display::destroySurface(Surface *surface)
 {
-    if (surface->getType() == EGL_WINDOW_BIT)
     {
-        WindowSurfaceMap *windowSurfaces = GetWindowSurfaces();
-        ASSERT(windowSurfaces);
-
-        bool surfaceRemoved = false;
-        for (WindowSurfaceMap::iterator iter = windowSurfaces->begin(); iter != windowSurfaces->end(); iter++)
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (surface->getType() == EGL_WINDOW_BIT)
         {
-            if (iter->second == surface)
+            std::lock_guard<std::mutex> windowSurfacesLock(*GetWindowSurfacesMutex());
+            WindowSurfaceMap *windowSurfaces = GetWindowSurfaces();
+            ASSERT(windowSurfaces);
+
+            bool surfaceRemoved = false;
+            for (WindowSurfaceMap::iterator iter = windowSurfaces->begin();
+                 iter != windowSurfaces->end(); iter++)
             {
-                windowSurfaces->erase(iter);
-                surfaceRemoved = true;
-                break;
+                if (iter->second == surface)
+                {
+                    windowSurfaces->erase(iter);
+                    surfaceRemoved = true;
+                    break;
+                }
             }
+
+            ASSERT(surfaceRemoved);
         }
 
-        ASSERT(surfaceRemoved);
+        mState.surfaceSet.erase(surface);
     }
-
-    mState.surfaceSet.erase(surface);
     ANGLE_TRY(surface->onDestroy(this));
     return NoError();
 }
 
 void Display::destroyImage(egl::Image *image)
 {
-    auto iter = mImageSet.find(image);
-    ASSERT(iter != mImageSet.end());
-    (*iter)->release(mProxyContext.get());
-    mImageSet.erase(iter);
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        auto iter = mImageSet.find(image);
+        ASSERT(iter != mImageSet.end());
+        mImageSet.erase(iter);
+    }
+    image->release(getProxyContext());
 }
 
 void Display::destroyStream(egl::Stream *stream)
 {
-    mStreamSet.erase(stream);
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStreamSet.erase(stream);
+    }
     SafeDelete(stream);
 }
 
@@ -871,6 +990,7 @@ Error Display::destroyContext(gl::Context *context)
 {
     if (context->usingDisplayTextureShareGroup())
     {
+        std::lock_guard<std::mutex> lock(mMutex);
         ASSERT(mGlobalTextureShareGroupUsers >= 1 && mTextureManager != nullptr);
         if (mGlobalTextureShareGroupUsers == 1)
         {
@@ -883,7 +1003,10 @@ Error Display::destroyContext(gl::Context *context)
     }
 
     ANGLE_TRY(context->onDestroy(this));
-    mContextSet.erase(context);
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mContextSet.erase(context);
+    }
     SafeDelete(context);
     return NoError();
 }
@@ -913,6 +1036,7 @@ void Display::notifyDeviceLost()
         return;
     }
 
+    std::lock_guard<std::mutex> lock(mMutex);
     for (ContextSet::iterator context = mContextSet.begin(); context != mContextSet.end(); context++)
     {
         (*context)->markContextLost();
@@ -948,26 +1072,31 @@ bool Display::isValidConfig(const Config *config) const
 
 bool Display::isValidContext(const gl::Context *context) const
 {
+    std::lock_guard<std::mutex> lock(mMutex);
     return mContextSet.find(const_cast<gl::Context *>(context)) != mContextSet.end();
 }
 
 bool Display::isValidSurface(const Surface *surface) const
 {
+    std::lock_guard<std::mutex> lock(mMutex);
     return mState.surfaceSet.find(const_cast<Surface *>(surface)) != mState.surfaceSet.end();
 }
 
 bool Display::isValidImage(const Image *image) const
 {
+    std::lock_guard<std::mutex> lock(mMutex);
     return mImageSet.find(const_cast<Image *>(image)) != mImageSet.end();
 }
 
 bool Display::isValidStream(const Stream *stream) const
 {
+    std::lock_guard<std::mutex> lock(mMutex);
     return mStreamSet.find(const_cast<Stream *>(stream)) != mStreamSet.end();
 }
 
 bool Display::hasExistingWindowSurface(EGLNativeWindowType window)
 {
+    std::lock_guard<std::mutex> lock(*GetWindowSurfacesMutex());
     WindowSurfaceMap *windowSurfaces = GetWindowSurfaces();
     ASSERT(windowSurfaces);
 
@@ -1145,6 +1274,18 @@ Device *Display::getDevice() const
     return mDevice;
 }
 
+gl::Context *Display::getProxyContext() const
+{
+    std::lock_guard<std::mutex> lock(mProxyContextMutex);
+    if (mProxyContext.get() == nullptr && mProxyContextAvailable)
+    {
+        TRACE_EVENT0("gpu.angle", "egl::Display::createProxyContext");
+        mProxyContext.reset(new gl::Context(mImplementation, nullptr, nullptr, nullptr, nullptr,
+                                            egl::AttributeMap(), mDisplayExtensions));
+    }
+    return mProxyContext.get();
+}
+
 gl::Version Display::getMaxSupportedESVersion() const
 {
     return mImplementation->getMaxSupportedESVersion();
@@ -1174,9 +1315,8 @@ Error Display::programCacheQuery(EGLint index,
 {
     ASSERT(index >= 0 && index < static_cast<EGLint>(mMemoryProgramCache.entryCount()));
 
-    const angle::MemoryBuffer *programBinary = nullptr;
+    angle::MemoryBuffer programBinary;
     gl::ProgramHash programHash;
-    // TODO(jmadill): Make this thread-safe.
     bool result =
         mMemoryProgramCache.getAt(static_cast<size_t>(index), &programHash, &programBinary);
     if (!result)
@@ -1197,15 +1337,15 @@ Error Display::programCacheQuery(EGLint index,
         // Note: we check the size here instead of in the validation code, since we need to
         // access the cache as atomically as possible. It's possible that the cache contents
         // could change between the validation size check and the retrieval.
-        if (programBinary->size() > static_cast<size_t>(*binarysize))
+        if (programBinary.size() > static_cast<size_t>(*binarysize))
         {
             return EglBadAccess() << "Program binary too large or changed during access.";
         }
 
-        memcpy(binary, programBinary->data(), programBinary->size());
+        memcpy(binary, programBinary.data(), programBinary.size());
     }
 
-    *binarysize = static_cast<EGLint>(programBinary->size());
+    *binarysize = static_cast<EGLint>(programBinary.size());
     *keysize    = static_cast<EGLint>(gl::kProgramHashLength);
 
     return NoError();
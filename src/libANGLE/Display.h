@@ -11,6 +11,7 @@
 #ifndef LIBANGLE_DISPLAY_H_
 #define LIBANGLE_DISPLAY_H_
 
+#include <mutex>
 #include <set>
 #include <vector>
 
@@ -21,6 +22,7 @@
 #include "libANGLE/LoggingAnnotator.h"
 #include "libANGLE/MemoryProgramCache.h"
 #include "libANGLE/Version.h"
+#include "libANGLE/WorkerThread.h"
 
 namespace gl
 {
@@ -161,13 +163,15 @@ class Display final : angle::NonCopyable
 
     const DisplayState &getState() const { return mState; }
 
-    gl::Context *getProxyContext() const { return mProxyContext.get(); }
+    // Created on first use, since initializing a context queries the native caps.
+    gl::Context *getProxyContext() const;
 
   private:
     Display(EGLenum platform, EGLNativeDisplayType displayId, Device *eglDevice);
 
     void setAttributes(rx::DisplayImpl *impl, const AttributeMap &attribMap);
 
+    Error initializeImpl();
     Error restoreLostDevice();
 
     void initDisplayExtensions();
@@ -190,6 +194,10 @@ class Display final : angle::NonCopyable
     typedef std::set<Stream *> StreamSet;
     StreamSet mStreamSet;
 
+    // Guards the object sets and the display texture share group, which contexts on different
+    // threads can change at the same time.
+    mutable std::mutex mMutex;
+
     bool mInitialized;
     bool mDeviceLost;
 
@@ -208,9 +216,15 @@ class Display final : angle::NonCopyable
     gl::MemoryProgramCache mMemoryProgramCache;
     size_t mGlobalTextureShareGroupUsers;
 
+    // Runs the parts of initialization that don't depend on the implementation.
+    angle::WorkerThreadPool mWorkerThreadPool;
+
     // This gl::Context is a simple proxy to the Display for the GL back-end entry points
-    // that need access to implementation-specific data, like a Renderer object.
-    angle::UniqueObjectPointer<gl::Context, Display> mProxyContext;
+    // that need access to implementation-specific data, like a Renderer object. It can only be
+    // created between initialization and the destruction of the EGL objects on termination.
+    mutable std::mutex mProxyContextMutex;
+    mutable angle::UniqueObjectPointer<gl::Context, Display> mProxyContext;
+    bool mProxyContextAvailable;
 };
 
 }  // namespace egl
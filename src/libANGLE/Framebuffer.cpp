@@ -617,6 +617,7 @@ Framebuffer::Framebuffer(const Caps &caps, rx::GLImplFactory *factory, GLuint id
       mImpl(factory->createFramebuffer(mState)),
       mId(id),
       mCachedStatus(),
+      mCompletenessSerial(0),
       mDirtyDepthAttachmentBinding(this, DIRTY_BIT_DEPTH_ATTACHMENT),
       mDirtyStencilAttachmentBinding(this, DIRTY_BIT_STENCIL_ATTACHMENT)
 {
@@ -636,6 +637,7 @@ Framebuffer::Framebuffer(const egl::Display *display, egl::Surface *surface)
       mImpl(surface->getImplementation()->createDefaultFramebuffer(mState)),
       mId(0),
       mCachedStatus(GL_FRAMEBUFFER_COMPLETE),
+      mCompletenessSerial(0),
       mDirtyDepthAttachmentBinding(this, DIRTY_BIT_DEPTH_ATTACHMENT),
       mDirtyStencilAttachmentBinding(this, DIRTY_BIT_STENCIL_ATTACHMENT)
 {
@@ -675,6 +677,7 @@ Framebuffer::Framebuffer(rx::GLImplFactory *factory)
       mImpl(factory->createFramebuffer(mState)),
       mId(0),
       mCachedStatus(GL_FRAMEBUFFER_UNDEFINED_OES),
+      mCompletenessSerial(0),
       mDirtyDepthAttachmentBinding(this, DIRTY_BIT_DEPTH_ATTACHMENT),
       mDirtyStencilAttachmentBinding(this, DIRTY_BIT_STENCIL_ATTACHMENT)
 {
@@ -778,6 +781,7 @@ bool Framebuffer::detachMatchingAttachment(const Context *context,
         attachment->detach(context);
         mDirtyBits.set(dirtyBit);
         mState.mResourceNeedsInit.set(dirtyBit, false);
+        invalidateCompletenessCache();
         return true;
     }
 
@@ -865,6 +869,7 @@ void Framebuffer::setDrawBuffers(size_t count, const GLenum *buffers)
     std::copy(buffers, buffers + count, drawStates.begin());
     std::fill(drawStates.begin() + count, drawStates.end(), GL_NONE);
     mDirtyBits.set(DIRTY_BIT_DRAW_BUFFERS);
+    invalidateCompletenessCache();
 
     mState.mEnabledDrawBuffers.reset();
     mState.mDrawBufferTypeMask.reset();
@@ -940,6 +945,7 @@ void Framebuffer::setReadBuffer(GLenum buffer)
             (buffer - GL_COLOR_ATTACHMENT0) < mState.mColorAttachments.size()));
     mState.mReadBufferState = buffer;
     mDirtyBits.set(DIRTY_BIT_READ_BUFFER);
+    invalidateCompletenessCache();
 }
 
 size_t Framebuffer::getNumColorBuffers() const
@@ -972,6 +978,8 @@ bool Framebuffer::usingExtendedDrawBuffers() const
 
 void Framebuffer::invalidateCompletenessCache()
 {
+    mCompletenessSerial++;
+
     if (mId != 0)
     {
         mCachedStatus.reset();
@@ -1760,13 +1768,10 @@ void Framebuffer::onSubjectStateChange(const Context *context,
         return;
     }
 
-    // Only reset the cached status if this is not the default framebuffer.  The default framebuffer
-    // will still use this channel to mark itself dirty.
-    if (mId != 0)
-    {
-        // TOOD(jmadill): Make this only update individual attachments to do less work.
-        mCachedStatus.reset();
-    }
+    // Only resets the cached status if this is not the default framebuffer.  The default
+    // framebuffer will still use this channel to mark itself dirty.
+    // TOOD(jmadill): Make this only update individual attachments to do less work.
+    invalidateCompletenessCache();
 
     FramebufferAttachment *attachment = getAttachmentFromSubjectIndex(index);
 
@@ -1940,6 +1945,7 @@ void Framebuffer::setDefaultLayers(GLint defaultLayers)
 {
     mState.mDefaultLayers = defaultLayers;
     mDirtyBits.set(DIRTY_BIT_DEFAULT_LAYERS);
+    invalidateCompletenessCache();
 }
 
 GLsizei Framebuffer::getNumViews() const
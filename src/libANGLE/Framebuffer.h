@@ -232,6 +232,10 @@ class Framebuffer final : public angle::ObserverInterface, public LabeledObject
 
     void invalidateCompletenessCache();
 
+    // Incremented whenever the attachments or the parameters that affect completeness change.
+    // Draw validation uses it to know when its cached framebuffer checks are out of date.
+    unsigned int getCompletenessSerial() const { return mCompletenessSerial; }
+
     GLenum checkStatus(const Context *context);
 
     // For when we don't want to check completeness in getSamples().
@@ -389,6 +393,7 @@ class Framebuffer final : public angle::ObserverInterface, public LabeledObject
     GLuint mId;
 
     Optional<GLenum> mCachedStatus;
+    unsigned int mCompletenessSerial;
     std::vector<angle::ObserverBinding> mDirtyColorAttachmentBindings;
     angle::ObserverBinding mDirtyDepthAttachmentBinding;
     angle::ObserverBinding mDirtyStencilAttachmentBinding;
@@ -297,6 +297,7 @@ Error GLES1Renderer::linkProgram(Context *context,
     }
 
     ANGLE_TRY(programObject->link(context));
+    programObject->resolveLink(context);
 
     glState->onProgramExecutableChange(programObject);
 
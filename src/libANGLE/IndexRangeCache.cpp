@@ -11,77 +11,389 @@
 
 #include "common/debug.h"
 #include "libANGLE/formatutils.h"
+#include "libANGLE/renderer/BufferImpl.h"
 
 namespace gl
 {
 
-IndexRangeCache::IndexRangeCache()
+namespace
 {
+
+size_t GetBlockTreeIndex(GLenum type, bool primitiveRestartEnabled)
+{
+    size_t typeIndex = 0;
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            typeIndex = 0;
+            break;
+        case GL_UNSIGNED_SHORT:
+            typeIndex = 1;
+            break;
+        case GL_UNSIGNED_INT:
+            typeIndex = 2;
+            break;
+        default:
+            UNREACHABLE();
+            break;
+    }
+    return typeIndex * 2 + (primitiveRestartEnabled ? 1 : 0);
 }
 
-IndexRangeCache::~IndexRangeCache()
+// The range of the concatenation of two runs of indices. Runs of primitive restart indices only
+// have no range.
+IndexRange CombineRanges(const IndexRange &a, const IndexRange &b)
 {
+    if (a.vertexIndexCount == 0)
+    {
+        return b;
+    }
+    if (b.vertexIndexCount == 0)
+    {
+        return a;
+    }
+    return IndexRange(std::min(a.start, b.start), std::max(a.end, b.end),
+                      a.vertexIndexCount + b.vertexIndexCount);
 }
 
-void IndexRangeCache::addRange(GLenum type,
-                               size_t offset,
-                               size_t count,
-                               bool primitiveRestartEnabled,
-                               const IndexRange &range)
+}  // anonymous namespace
+
+// static
+constexpr size_t IndexRangeCache::kBlockSize;
+constexpr size_t IndexRangeCache::kBlockTreeCount;
+constexpr size_t IndexRangeCache::kMaxCachedRanges;
+
+IndexRangeCache::IndexRangeCache() : mDataVersion(0), mLeafCount(0)
+{
+}
+
+IndexRangeCache::~IndexRangeCache()
 {
-    mIndexRangeCache[IndexRangeKey(type, offset, count, primitiveRestartEnabled)] = range;
 }
 
-bool IndexRangeCache::findRange(GLenum type,
+Error IndexRangeCache::getRange(const Context *context,
+                                rx::BufferImpl *impl,
+                                GLenum type,
                                 size_t offset,
                                 size_t count,
                                 bool primitiveRestartEnabled,
-                                IndexRange *outRange) const
+                                IndexRange *outRange)
+{
+    IndexRangeKey key(type, offset, count, primitiveRestartEnabled);
+    if (findRange(key, outRange))
+    {
+        return NoError();
+    }
+
+    ANGLE_TRY(computeRange(context, impl, key, outRange));
+
+    if (mIndexRangeCache.size() >= kMaxCachedRanges)
+    {
+        pruneRanges();
+    }
+
+    CachedRange &cachedRange = mIndexRangeCache[key];
+    cachedRange.range        = *outRange;
+    cachedRange.dataVersion  = mDataVersion;
+
+    return NoError();
+}
+
+void IndexRangeCache::invalidateRange(size_t offset, size_t size)
 {
-    auto i = mIndexRangeCache.find(IndexRangeKey(type, offset, count, primitiveRestartEnabled));
-    if (i != mIndexRangeCache.end())
+    if (size == 0)
+    {
+        return;
+    }
+
+    // Cached ranges notice the write through the version of the blocks they cover, so they don't
+    // need to be looked at here.
+    mDataVersion++;
+
+    // Nothing was cached past the end of the trees.
+    size_t firstBlock = offset / kBlockSize;
+    if (firstBlock >= mLeafCount)
+    {
+        return;
+    }
+    size_t lastBlock = std::min((offset + size - 1) / kBlockSize, mLeafCount - 1);
+
+    // Mark the written blocks and their ancestors, level by level.
+    size_t first = mLeafCount + firstBlock;
+    size_t last  = mLeafCount + lastBlock;
+    while (first > 0)
     {
-        if (outRange)
+        for (size_t node = first; node <= last; ++node)
         {
-            *outRange = i->second;
+            mBlockVersions[node] = mDataVersion;
+            for (BlockTree &tree : mBlockTrees)
+            {
+                if (!tree.empty())
+                {
+                    tree[node].valid = false;
+                }
+            }
         }
-        return true;
+        first >>= 1;
+        last >>= 1;
     }
-    else
+}
+
+void IndexRangeCache::clear()
+{
+    mDataVersion++;
+    mIndexRangeCache.clear();
+    mLeafCount = 0;
+    mBlockVersions.clear();
+    for (BlockTree &tree : mBlockTrees)
     {
-        if (outRange)
+        tree.clear();
+    }
+}
+
+bool IndexRangeCache::findRange(const IndexRangeKey &key, IndexRange *outRange)
+{
+    auto iter = mIndexRangeCache.find(key);
+    if (iter == mIndexRangeCache.end())
+    {
+        return false;
+    }
+
+    CachedRange &cachedRange = iter->second;
+    if (isStale(key, cachedRange))
+    {
+        mIndexRangeCache.erase(iter);
+        return false;
+    }
+
+    cachedRange.dataVersion = mDataVersion;
+    *outRange               = cachedRange.range;
+    return true;
+}
+
+bool IndexRangeCache::isStale(const IndexRangeKey &key, const CachedRange &cachedRange) const
+{
+    if (cachedRange.dataVersion == mDataVersion || key.count == 0)
+    {
+        return false;
+    }
+
+    // The buffer was written since, check whether the write touched the indices.
+    size_t end = key.offset + key.count * GetTypeInfo(key.type).bytes;
+    return getMaxBlockVersion(key.offset / kBlockSize, (end - 1) / kBlockSize + 1) >
+           cachedRange.dataVersion;
+}
+
+void IndexRangeCache::pruneRanges()
+{
+    for (auto iter = mIndexRangeCache.begin(); iter != mIndexRangeCache.end();)
+    {
+        if (isStale(iter->first, iter->second))
         {
-            *outRange = IndexRange();
+            iter = mIndexRangeCache.erase(iter);
+        }
+        else
+        {
+            ++iter;
         }
-        return false;
+    }
+
+    // Every query is still valid, start over. The blocks they span stay cached.
+    if (mIndexRangeCache.size() >= kMaxCachedRanges)
+    {
+        mIndexRangeCache.clear();
     }
 }
 
-void IndexRangeCache::invalidateRange(size_t offset, size_t size)
+Error IndexRangeCache::computeRange(const Context *context,
+                                    rx::BufferImpl *impl,
+                                    const IndexRangeKey &key,
+                                    IndexRange *outRange)
 {
-    size_t invalidateStart = offset;
-    size_t invalidateEnd   = offset + size;
+    size_t typeBytes = GetTypeInfo(key.type).bytes;
+    size_t end       = key.offset + key.count * typeBytes;
+
+    // The version tree must cover every cached range.
+    reserveBlocks(rx::roundUp(end, kBlockSize) / kBlockSize);
 
-    auto i = mIndexRangeCache.begin();
-    while (i != mIndexRangeCache.end())
+    size_t firstBlock = rx::roundUp(key.offset, kBlockSize) / kBlockSize;
+    size_t lastBlock  = end / kBlockSize;
+    if (key.offset % typeBytes != 0 || firstBlock >= lastBlock)
     {
-        size_t rangeStart = i->first.offset;
-        size_t rangeEnd   = i->first.offset + (GetTypeInfo(i->first.type).bytes * i->first.count);
+        // Indices that don't fill a block, or aren't aligned to their type, are read directly.
+        return impl->getIndexRange(context, key.type, key.offset, key.count,
+                                   key.primitiveRestartEnabled, outRange);
+    }
+
+    IndexRange range;
 
-        if (invalidateEnd < rangeStart || invalidateStart > rangeEnd)
+    size_t headBytes = firstBlock * kBlockSize - key.offset;
+    if (headBytes > 0)
+    {
+        IndexRange headRange;
+        ANGLE_TRY(impl->getIndexRange(context, key.type, key.offset, headBytes / typeBytes,
+                                      key.primitiveRestartEnabled, &headRange));
+        range = CombineRanges(range, headRange);
+    }
+
+    IndexRange blocksRange;
+    ANGLE_TRY(getBlocksRange(context, impl, key, firstBlock, lastBlock, &blocksRange));
+    range = CombineRanges(range, blocksRange);
+
+    size_t tailBytes = end - lastBlock * kBlockSize;
+    if (tailBytes > 0)
+    {
+        IndexRange tailRange;
+        ANGLE_TRY(impl->getIndexRange(context, key.type, lastBlock * kBlockSize,
+                                      tailBytes / typeBytes, key.primitiveRestartEnabled,
+                                      &tailRange));
+        range = CombineRanges(range, tailRange);
+    }
+
+    *outRange = range;
+    return NoError();
+}
+
+Error IndexRangeCache::getBlocksRange(const Context *context,
+                                      rx::BufferImpl *impl,
+                                      const IndexRangeKey &key,
+                                      size_t firstBlock,
+                                      size_t lastBlock,
+                                      IndexRange *outRange)
+{
+    ASSERT(lastBlock <= mLeafCount);
+
+    BlockTree &tree = mBlockTrees[GetBlockTreeIndex(key.type, key.primitiveRestartEnabled)];
+    if (tree.empty())
+    {
+        BlockRange invalid = {IndexRange(), false};
+        tree.assign(mLeafCount * 2, invalid);
+    }
+
+    // Combine the nodes that exactly cover [firstBlock, lastBlock), from the leaves up. Combining
+    // ranges is commutative, so the order in which the nodes are visited doesn't matter.
+    IndexRange range;
+    size_t height = 0;
+    for (size_t first = mLeafCount + firstBlock, last = mLeafCount + lastBlock; first < last;
+         first >>= 1, last >>= 1, ++height)
+    {
+        if (first & 1)
         {
-            ++i;
+            ANGLE_TRY(resolveBlockRange(context, impl, key, &tree, first, height));
+            range = CombineRanges(range, tree[first].range);
+            ++first;
         }
-        else
+        if (last & 1)
         {
-            mIndexRangeCache.erase(i++);
+            --last;
+            ANGLE_TRY(resolveBlockRange(context, impl, key, &tree, last, height));
+            range = CombineRanges(range, tree[last].range);
         }
     }
+
+    *outRange = range;
+    return NoError();
 }
 
-void IndexRangeCache::clear()
+Error IndexRangeCache::resolveBlockRange(const Context *context,
+                                         rx::BufferImpl *impl,
+                                         const IndexRangeKey &key,
+                                         BlockTree *tree,
+                                         size_t node,
+                                         size_t height)
 {
-    mIndexRangeCache.clear();
+    BlockRange &blockRange = (*tree)[node];
+    if (blockRange.valid)
+    {
+        return NoError();
+    }
+
+    if (height == 0)
+    {
+        size_t block = node - mLeafCount;
+        ANGLE_TRY(impl->getIndexRange(context, key.type, block * kBlockSize,
+                                      kBlockSize / GetTypeInfo(key.type).bytes,
+                                      key.primitiveRestartEnabled, &blockRange.range));
+    }
+    else
+    {
+        ANGLE_TRY(resolveBlockRange(context, impl, key, tree, node * 2, height - 1));
+        ANGLE_TRY(resolveBlockRange(context, impl, key, tree, node * 2 + 1, height - 1));
+        blockRange.range = CombineRanges((*tree)[node * 2].range, (*tree)[node * 2 + 1].range);
+    }
+
+    blockRange.valid = true;
+    return NoError();
+}
+
+uint64_t IndexRangeCache::getMaxBlockVersion(size_t firstBlock, size_t lastBlock) const
+{
+    ASSERT(lastBlock <= mLeafCount);
+
+    uint64_t maxVersion = 0;
+    for (size_t first = mLeafCount + firstBlock, last = mLeafCount + lastBlock; first < last;
+         first >>= 1, last >>= 1)
+    {
+        if (first & 1)
+        {
+            maxVersion = std::max(maxVersion, mBlockVersions[first++]);
+        }
+        if (last & 1)
+        {
+            maxVersion = std::max(maxVersion, mBlockVersions[--last]);
+        }
+    }
+    return maxVersion;
+}
+
+void IndexRangeCache::reserveBlocks(size_t blockCount)
+{
+    if (blockCount <= mLeafCount)
+    {
+        return;
+    }
+
+    size_t leafCount = std::max<size_t>(mLeafCount, 1);
+    while (leafCount < blockCount)
+    {
+        leafCount *= 2;
+    }
+
+    // Move the leaves and rebuild the internal nodes. New blocks have never been written, and
+    // their ranges are computed when first needed.
+    std::vector<uint64_t> blockVersions(leafCount * 2, 0);
+    std::copy(mBlockVersions.begin() + mLeafCount, mBlockVersions.end(),
+              blockVersions.begin() + leafCount);
+    for (size_t node = leafCount - 1; node > 0; --node)
+    {
+        blockVersions[node] = std::max(blockVersions[node * 2], blockVersions[node * 2 + 1]);
+    }
+    mBlockVersions = std::move(blockVersions);
+
+    for (BlockTree &tree : mBlockTrees)
+    {
+        if (tree.empty())
+        {
+            continue;
+        }
+
+        BlockRange invalid = {IndexRange(), false};
+        BlockTree newTree(leafCount * 2, invalid);
+        std::copy(tree.begin() + mLeafCount, tree.end(), newTree.begin() + leafCount);
+        for (size_t node = leafCount - 1; node > 0; --node)
+        {
+            const BlockRange &left  = newTree[node * 2];
+            const BlockRange &right = newTree[node * 2 + 1];
+            if (left.valid && right.valid)
+            {
+                newTree[node].range = CombineRanges(left.range, right.range);
+                newTree[node].valid = true;
+            }
+        }
+        tree = std::move(newTree);
+    }
+
+    mLeafCount = leafCount;
 }
 
 IndexRangeCache::IndexRangeKey::IndexRangeKey()
@@ -118,4 +430,4 @@ bool IndexRangeCache::IndexRangeKey::operator<(const IndexRangeKey &rhs) const
     return false;
 }
 
-}
+}  // namespace gl
@@ -12,34 +12,63 @@
 
 #include "common/angleutils.h"
 #include "common/mathutil.h"
+#include "libANGLE/Error.h"
 
 #include "angle_gl.h"
 
+#include <array>
 #include <map>
+#include <vector>
+
+namespace rx
+{
+class BufferImpl;
+}  // namespace rx
 
 namespace gl
 {
+class Context;
 
-class IndexRangeCache
+// Ranges are cached at two levels. Exact queries are remembered with the data version they were
+// computed at, and stay valid until a write touches the bytes they cover. Below that, the buffer
+// is split in fixed-size blocks whose ranges are kept in segment trees, so that the range of any
+// query that spans whole blocks is composed from cached blocks, and a partial update only
+// recomputes the blocks it wrote to.
+class IndexRangeCache final : angle::NonCopyable
 {
   public:
     IndexRangeCache();
     ~IndexRangeCache();
 
-    void addRange(GLenum type,
-                  size_t offset,
-                  size_t count,
-                  bool primitiveRestartEnabled,
-                  const IndexRange &range);
-    bool findRange(GLenum type,
+    // Blocks are aligned in the buffer, so that they hold a whole number of indices of any type.
+    static constexpr size_t kBlockSize = 4096;
+
+    // Exact queries kept at most. Buffers that are streamed to see a new query for every draw,
+    // and the ranges of those are still composed from the blocks once they are dropped.
+    static constexpr size_t kMaxCachedRanges = 256;
+
+    // Returns the range of the count indices at offset. Whatever isn't cached is computed by the
+    // implementation.
+    Error getRange(const Context *context,
+                   rx::BufferImpl *impl,
+                   GLenum type,
                    size_t offset,
                    size_t count,
                    bool primitiveRestartEnabled,
-                   IndexRange *outRange) const;
+                   IndexRange *outRange);
 
+    // Called when size bytes at offset are written.
     void invalidateRange(size_t offset, size_t size);
+
+    // Called when the whole buffer is replaced.
     void clear();
 
+    // Incremented by every write to the buffer.
+    uint64_t getDataVersion() const { return mDataVersion; }
+
+    // Number of exact queries currently remembered.
+    size_t getCachedRangeCount() const { return mIndexRangeCache.size(); }
+
   private:
     struct IndexRangeKey
     {
@@ -54,10 +83,59 @@ class IndexRangeCache
         bool primitiveRestartEnabled;
     };
 
-    typedef std::map<IndexRangeKey, IndexRange> IndexRangeMap;
+    struct CachedRange
+    {
+        IndexRange range;
+        uint64_t dataVersion;
+    };
+
+    // A node of the segment tree of one type of index. Internal nodes hold the combined range of
+    // their children, and are only valid if both children are.
+    struct BlockRange
+    {
+        IndexRange range;
+        bool valid;
+    };
+    using BlockTree = std::vector<BlockRange>;
+
+    // One tree for each index type, with and without primitive restart.
+    static constexpr size_t kBlockTreeCount = 6;
+
+    bool findRange(const IndexRangeKey &key, IndexRange *outRange);
+    bool isStale(const IndexRangeKey &key, const CachedRange &cachedRange) const;
+    void pruneRanges();
+    Error computeRange(const Context *context,
+                       rx::BufferImpl *impl,
+                       const IndexRangeKey &key,
+                       IndexRange *outRange);
+    Error getBlocksRange(const Context *context,
+                         rx::BufferImpl *impl,
+                         const IndexRangeKey &key,
+                         size_t firstBlock,
+                         size_t lastBlock,
+                         IndexRange *outRange);
+    Error resolveBlockRange(const Context *context,
+                            rx::BufferImpl *impl,
+                            const IndexRangeKey &key,
+                            BlockTree *tree,
+                            size_t node,
+                            size_t height);
+
+    uint64_t getMaxBlockVersion(size_t firstBlock, size_t lastBlock) const;
+    void reserveBlocks(size_t blockCount);
+
+    typedef std::map<IndexRangeKey, CachedRange> IndexRangeMap;
     IndexRangeMap mIndexRangeCache;
+
+    uint64_t mDataVersion;
+
+    // Segment trees over the blocks, with the leaves at [mLeafCount, 2 * mLeafCount). The version
+    // tree holds the last version at which a block in the subtree was written.
+    size_t mLeafCount;
+    std::vector<uint64_t> mBlockVersions;
+    std::array<BlockTree, kBlockTreeCount> mBlockTrees;
 };
 
-}
+}  // namespace gl
 
-#endif // LIBANGLE_INDEXRANGECACHE_H_
+#endif  // LIBANGLE_INDEXRANGECACHE_H_
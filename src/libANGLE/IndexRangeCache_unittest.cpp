@@ -0,0 +1,182 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// IndexRangeCache_unittest.cpp: Unit tests for the cached ranges of the indices of a buffer.
+//
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "common/utilities.h"
+#include "libANGLE/IndexRangeCache.h"
+#include "libANGLE/renderer/BufferImpl_mock.h"
+
+using ::testing::_;
+using ::testing::Invoke;
+
+namespace
+{
+
+// Big enough for several levels of blocks.
+constexpr size_t kBlockCount   = 8;
+constexpr size_t kBlockIndices = gl::IndexRangeCache::kBlockSize / sizeof(GLushort);
+constexpr size_t kIndexCount   = kBlockCount * kBlockIndices;
+
+class IndexRangeCacheTest : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        mIndices.resize(kIndexCount);
+        for (size_t index = 0; index < kIndexCount; ++index)
+        {
+            mIndices[index] = static_cast<GLushort>((index * 7919) % 30000);
+        }
+
+        // The mock reads the indices the same way the implementations do.
+        ON_CALL(mImpl, getIndexRange(_, _, _, _, _, _))
+            .WillByDefault(Invoke(this, &IndexRangeCacheTest::computeRange));
+        EXPECT_CALL(mImpl, destructor());
+    }
+
+    gl::Error computeRange(const gl::Context *context,
+                           GLenum type,
+                           size_t offset,
+                           size_t count,
+                           bool primitiveRestartEnabled,
+                           gl::IndexRange *outRange)
+    {
+        const uint8_t *data = reinterpret_cast<const uint8_t *>(mIndices.data()) + offset;
+        *outRange           = gl::ComputeIndexRange(type, data, count, primitiveRestartEnabled);
+        return gl::NoError();
+    }
+
+    // Queries count indices, starting with firstIndex.
+    gl::IndexRange getRange(size_t firstIndex, size_t count, bool primitiveRestartEnabled)
+    {
+        gl::IndexRange range;
+        gl::Error error =
+            mCache.getRange(nullptr, &mImpl, GL_UNSIGNED_SHORT, firstIndex * sizeof(GLushort),
+                            count, primitiveRestartEnabled, &range);
+        EXPECT_FALSE(error.isError());
+        return range;
+    }
+
+    void expectRange(size_t firstIndex, size_t count, bool primitiveRestartEnabled)
+    {
+        gl::IndexRange expected = gl::ComputeIndexRange(GL_UNSIGNED_SHORT, &mIndices[firstIndex],
+                                                        count, primitiveRestartEnabled);
+        gl::IndexRange actual = getRange(firstIndex, count, primitiveRestartEnabled);
+        EXPECT_EQ(expected.start, actual.start) << firstIndex << " " << count;
+        EXPECT_EQ(expected.end, actual.end) << firstIndex << " " << count;
+        EXPECT_EQ(expected.vertexIndexCount, actual.vertexIndexCount)
+            << firstIndex << " " << count;
+    }
+
+    void writeIndex(size_t index, GLushort value)
+    {
+        mIndices[index] = value;
+        mCache.invalidateRange(index * sizeof(GLushort), sizeof(GLushort));
+    }
+
+    std::vector<GLushort> mIndices;
+    testing::NiceMock<rx::MockBufferImpl> mImpl;
+    gl::IndexRangeCache mCache;
+};
+
+// Ranges composed from blocks match the range of the indices read at once.
+TEST_F(IndexRangeCacheTest, ComposedRanges)
+{
+    for (bool primitiveRestartEnabled : {false, true})
+    {
+        mIndices[kBlockIndices * 3 + 5] = 0xFFFF;
+        mCache.clear();
+
+        expectRange(0, kIndexCount, primitiveRestartEnabled);
+        expectRange(2, kIndexCount - 1, primitiveRestartEnabled);
+        expectRange(kBlockIndices, kBlockIndices * 2, primitiveRestartEnabled);
+        expectRange(kBlockIndices - 3, kBlockIndices * 5 + 7, primitiveRestartEnabled);
+        expectRange(kBlockIndices * 2 + 1, 10, primitiveRestartEnabled);
+    }
+}
+
+// Blocks of restart indices only don't widen the range.
+TEST_F(IndexRangeCacheTest, RestartOnlyBlocks)
+{
+    std::fill(mIndices.begin(), mIndices.begin() + kBlockIndices * 2, 0xFFFF);
+
+    expectRange(0, kBlockIndices * 2, true);
+    expectRange(0, kBlockIndices * 4, true);
+}
+
+// Queries seen before don't read the buffer again.
+TEST_F(IndexRangeCacheTest, ExactHit)
+{
+    EXPECT_CALL(mImpl, getIndexRange(_, _, _, _, _, _)).Times(kBlockCount);
+    getRange(0, kIndexCount, false);
+    getRange(0, kIndexCount, false);
+}
+
+// A write only recomputes the block it touched.
+TEST_F(IndexRangeCacheTest, PartialUpdate)
+{
+    expectRange(0, kIndexCount, false);
+    uint64_t dataVersion = mCache.getDataVersion();
+
+    writeIndex(kBlockIndices * 5 + 1, 60000);
+    EXPECT_LT(dataVersion, mCache.getDataVersion());
+
+    EXPECT_CALL(mImpl, getIndexRange(_, _, _, _, _, _)).Times(1);
+    gl::IndexRange range = getRange(0, kIndexCount, false);
+    EXPECT_EQ(60000u, range.end);
+
+    // Another query over clean blocks reads nothing.
+    getRange(kBlockIndices, kBlockIndices * 3, false);
+}
+
+// Writes outside of a cached query don't invalidate it.
+TEST_F(IndexRangeCacheTest, UnrelatedWrite)
+{
+    expectRange(10, 20, false);
+    writeIndex(kIndexCount - 1, 1);
+
+    EXPECT_CALL(mImpl, getIndexRange(_, _, _, _, _, _)).Times(0);
+    getRange(10, 20, false);
+}
+
+// Writes to a cached query invalidate it, and the whole buffer can be dropped at once.
+TEST_F(IndexRangeCacheTest, Invalidation)
+{
+    expectRange(10, 20, false);
+    writeIndex(15, 65000);
+    expectRange(10, 20, false);
+
+    mIndices[12] = 65001;
+    mCache.clear();
+    expectRange(10, 20, false);
+}
+
+// Queries over a streamed buffer don't pile up.
+TEST_F(IndexRangeCacheTest, StreamedQueriesAreBounded)
+{
+    for (size_t draw = 0; draw < gl::IndexRangeCache::kMaxCachedRanges * 4; ++draw)
+    {
+        size_t firstIndex = (draw * 37) % (kIndexCount - 64);
+        writeIndex(firstIndex, static_cast<GLushort>(draw));
+        expectRange(firstIndex, 64, false);
+        EXPECT_LE(mCache.getCachedRangeCount(), gl::IndexRangeCache::kMaxCachedRanges);
+    }
+
+    // Queries that stay valid are dropped too once there are too many of them.
+    mCache.clear();
+    for (size_t firstIndex = 0; firstIndex < gl::IndexRangeCache::kMaxCachedRanges * 2;
+         ++firstIndex)
+    {
+        expectRange(firstIndex, 64, false);
+        EXPECT_LE(mCache.getCachedRangeCount(), gl::IndexRangeCache::kMaxCachedRanges);
+    }
+}
+
+}  // anonymous namespace
@@ -16,6 +16,7 @@
 #include "common/version.h"
 #include "libANGLE/BinaryStream.h"
 #include "libANGLE/Context.h"
+#include "libANGLE/DiskProgramCache.h"
 #include "libANGLE/Uniform.h"
 #include "libANGLE/histogram_macros.h"
 #include "libANGLE/renderer/ProgramImpl.h"
@@ -205,6 +206,7 @@ MemoryProgramCache::MemoryProgramCache(size_t maxCacheSizeBytes)
 
 MemoryProgramCache::~MemoryProgramCache()
 {
+    closeDiskCache();
 }
 
 // static
@@ -653,41 +655,82 @@ LinkResult MemoryProgramCache::getProgram(const Context *context,
                                           ProgramHash *hashOut)
 {
     ComputeHash(context, program, hashOut);
-    const angle::MemoryBuffer *binaryProgram = nullptr;
-    LinkResult result(false);
-    if (get(*hashOut, &binaryProgram))
-    {
-        InfoLog infoLog;
-        ANGLE_TRY_RESULT(Deserialize(context, program, state, binaryProgram->data(),
-                                     binaryProgram->size(), infoLog),
-                         result);
-        ANGLE_HISTOGRAM_BOOLEAN("GPU.ANGLE.ProgramCache.LoadBinarySuccess", result.getResult());
-        if (!result.getResult())
+
+    // Loading doesn't hold the lock, so other threads are free to evict the entry or close the
+    // disk tier in the meantime. The binary is deserialized in place, and shares ownership of the
+    // cache entry or of the disk tier's mapping to keep it alive until then.
+    std::shared_ptr<const uint8_t> binary;
+    size_t length = 0;
+    bool fromDisk = false;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        if (!get(*hashOut, &binary, &length))
         {
-            // Cache load failed, evict.
-            if (mIssuedWarnings++ < kWarningLimit)
+            if (!mDiskCache || !mDiskCache->get(*hashOut, &binary, &length))
             {
-                WARN() << "Failed to load binary from cache: " << infoLog.str();
+                ANGLE_HISTOGRAM_ENUMERATION("GPU.ANGLE.ProgramCache.CacheResult", kCacheMiss,
+                                            kCacheResultMax);
+                return LinkResult(false);
+            }
 
-                if (mIssuedWarnings == kWarningLimit)
-                {
-                    WARN() << "Reaching warning limit for cache load failures, silencing "
-                              "subsequent warnings.";
-                }
+            ANGLE_HISTOGRAM_ENUMERATION("GPU.ANGLE.ProgramCache.CacheResult", kCacheHitDisk,
+                                        kCacheResultMax);
+            fromDisk = true;
+        }
+    }
+
+    // A back-end that fails to load a cached binary, e.g. one written by an older driver, is
+    // treated like a miss so the program is linked from source instead.
+    InfoLog infoLog;
+    LinkResult result = Deserialize(context, program, state, binary.get(), length, infoLog);
+    if (result.isError())
+    {
+        infoLog << result.getError().getMessage();
+        result = LinkResult(false);
+    }
+
+    bool loaded = result.getResult();
+    ANGLE_HISTOGRAM_BOOLEAN("GPU.ANGLE.ProgramCache.LoadBinarySuccess", loaded);
+    if (!loaded)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        // Cache load failed, evict.
+        if (mIssuedWarnings++ < kWarningLimit)
+        {
+            WARN() << "Failed to load binary from cache: " << infoLog.str();
+
+            if (mIssuedWarnings == kWarningLimit)
+            {
+                WARN() << "Reaching warning limit for cache load failures, silencing "
+                          "subsequent warnings.";
             }
+        }
+
+        // Another thread may have evicted the entry or closed the disk tier while it was loading.
+        if (fromDisk)
+        {
+            if (mDiskCache)
+            {
+                mDiskCache->remove(*hashOut);
+            }
+        }
+        else
+        {
             remove(*hashOut);
         }
     }
-    return result;
+    return loaded;
 }
 
-bool MemoryProgramCache::get(const ProgramHash &programHash, const angle::MemoryBuffer **programOut)
+bool MemoryProgramCache::get(const ProgramHash &programHash,
+                             std::shared_ptr<const uint8_t> *binaryOut,
+                             size_t *lengthOut)
 {
     const CacheEntry *entry = nullptr;
     if (!mProgramBinaryCache.get(programHash, &entry))
     {
-        ANGLE_HISTOGRAM_ENUMERATION("GPU.ANGLE.ProgramCache.CacheResult", kCacheMiss,
-                                    kCacheResultMax);
         return false;
     }
 
@@ -702,28 +745,35 @@ bool MemoryProgramCache::get(const ProgramHash &programHash, const angle::Memory
                                     kCacheResultMax);
     }
 
-    *programOut = &entry->first;
+    *binaryOut = std::shared_ptr<const uint8_t>(entry->first, entry->first->data());
+    *lengthOut = entry->first->size();
     return true;
 }
 
 bool MemoryProgramCache::getAt(size_t index,
                                ProgramHash *hashOut,
-                               const angle::MemoryBuffer **programOut)
+                               angle::MemoryBuffer *programOut)
 {
+    std::lock_guard<std::mutex> lock(mMutex);
+
     const CacheEntry *entry = nullptr;
     if (!mProgramBinaryCache.getAt(index, hashOut, &entry))
     {
         return false;
     }
 
-    *programOut = &entry->first;
+    if (!programOut->resize(entry->first->size()))
+    {
+        return false;
+    }
+
+    memcpy(programOut->data(), entry->first->data(), entry->first->size());
     return true;
 }
 
 void MemoryProgramCache::remove(const ProgramHash &programHash)
 {
-    bool result = mProgramBinaryCache.eraseByKey(programHash);
-    ASSERT(result);
+    mProgramBinaryCache.eraseByKey(programHash);
 }
 
 void MemoryProgramCache::putProgram(const ProgramHash &programHash,
@@ -731,14 +781,28 @@ void MemoryProgramCache::putProgram(const ProgramHash &programHash,
                                     const Program *program)
 {
     CacheEntry newEntry;
-    Serialize(context, program, &newEntry.first);
+    newEntry.first = std::make_shared<angle::MemoryBuffer>();
+    Serialize(context, program, newEntry.first.get());
     newEntry.second = CacheSource::PutProgram;
 
+    size_t length = newEntry.first->size();
     ANGLE_HISTOGRAM_COUNTS("GPU.ANGLE.ProgramCache.ProgramBinarySizeBytes",
-                           static_cast<int>(newEntry.first.size()));
+                           static_cast<int>(length));
+
+    std::lock_guard<std::mutex> lock(mMutex);
 
-    const CacheEntry *result =
-        mProgramBinaryCache.put(programHash, std::move(newEntry), newEntry.first.size());
+    if (mDiskCache)
+    {
+        mDiskCache->put(programHash, newEntry.first->data(), length);
+
+        // The memory tier may be disabled when only the disk tier is in use.
+        if (mProgramBinaryCache.maxSize() == 0)
+        {
+            return;
+        }
+    }
+
+    const CacheEntry *result = mProgramBinaryCache.put(programHash, std::move(newEntry), length);
     if (!result)
     {
         ERR() << "Failed to store binary program in memory cache, program is too large.";
@@ -746,7 +810,8 @@ void MemoryProgramCache::putProgram(const ProgramHash &programHash,
     else
     {
         auto *platform = ANGLEPlatformCurrent();
-        platform->cacheProgram(platform, programHash, result->first.size(), result->first.data());
+        platform->cacheProgram(platform, programHash, result->first->size(),
+                               result->first->data());
     }
 }
 
@@ -763,11 +828,17 @@ void MemoryProgramCache::putBinary(const ProgramHash &programHash,
 {
     // Copy the binary.
     CacheEntry newEntry;
-    newEntry.first.resize(length);
-    memcpy(newEntry.first.data(), binary, length);
+    newEntry.first = std::make_shared<angle::MemoryBuffer>();
+    if (!newEntry.first->resize(length))
+    {
+        ERR() << "Failed to allocate memory for binary program.";
+        return;
+    }
+    memcpy(newEntry.first->data(), binary, length);
     newEntry.second = CacheSource::PutBinary;
 
     // Store the binary.
+    std::lock_guard<std::mutex> lock(mMutex);
     const CacheEntry *result = mProgramBinaryCache.put(programHash, std::move(newEntry), length);
     if (!result)
     {
@@ -777,33 +848,75 @@ void MemoryProgramCache::putBinary(const ProgramHash &programHash,
 
 void MemoryProgramCache::clear()
 {
+    std::lock_guard<std::mutex> lock(mMutex);
     mProgramBinaryCache.clear();
     mIssuedWarnings = 0;
 }
 
 void MemoryProgramCache::resize(size_t maxCacheSizeBytes)
 {
+    std::lock_guard<std::mutex> lock(mMutex);
     mProgramBinaryCache.resize(maxCacheSizeBytes);
 }
 
 size_t MemoryProgramCache::entryCount() const
 {
+    std::lock_guard<std::mutex> lock(mMutex);
     return mProgramBinaryCache.entryCount();
 }
 
 size_t MemoryProgramCache::trim(size_t limit)
 {
+    std::lock_guard<std::mutex> lock(mMutex);
     return mProgramBinaryCache.shrinkToSize(limit);
 }
 
 size_t MemoryProgramCache::size() const
 {
+    std::lock_guard<std::mutex> lock(mMutex);
     return mProgramBinaryCache.size();
 }
 
 size_t MemoryProgramCache::maxSize() const
 {
+    std::lock_guard<std::mutex> lock(mMutex);
     return mProgramBinaryCache.maxSize();
 }
 
+bool MemoryProgramCache::openDiskCache(const std::string &directory, size_t maxDiskCacheSizeBytes)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    if (mDiskCache)
+    {
+        mDiskCache->close();
+    }
+
+    mDiskCache.reset(new DiskProgramCache());
+    if (!mDiskCache->open(directory, maxDiskCacheSizeBytes))
+    {
+        WARN() << "Failed to open the program cache in " << directory << ".";
+        mDiskCache.reset();
+        return false;
+    }
+
+    return true;
+}
+
+void MemoryProgramCache::closeDiskCache()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (mDiskCache)
+    {
+        mDiskCache->close();
+        mDiskCache.reset();
+    }
+}
+
+bool MemoryProgramCache::isEnabled() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mProgramBinaryCache.maxSize() > 0 || mDiskCache != nullptr;
+}
+
 }  // namespace gl
@@ -11,6 +11,9 @@
 #define LIBANGLE_MEMORY_PROGRAM_CACHE_H_
 
 #include <array>
+#include <memory>
+#include <mutex>
+#include <string>
 
 #include "common/MemoryBuffer.h"
 #include "libANGLE/Error.h"
@@ -45,6 +48,7 @@ struct hash<gl::ProgramHash>
 namespace gl
 {
 class Context;
+class DiskProgramCache;
 class InfoLog;
 class Program;
 class ProgramState;
@@ -70,14 +74,9 @@ class MemoryProgramCache final : angle::NonCopyable
 
     static void ComputeHash(const Context *context, const Program *program, ProgramHash *hashOut);
 
-    // Check if the cache contains a binary matching the specified program.
-    bool get(const ProgramHash &programHash, const angle::MemoryBuffer **programOut);
-
-    // For querying the contents of the cache.
-    bool getAt(size_t index, ProgramHash *hashOut, const angle::MemoryBuffer **programOut);
-
-    // Evict a program from the binary cache.
-    void remove(const ProgramHash &programHash);
+    // For querying the contents of the cache. Copies the binary, since another thread may evict
+    // it as soon as this returns.
+    bool getAt(size_t index, ProgramHash *hashOut, angle::MemoryBuffer *programOut);
 
     // Helper method that serializes a program.
     void putProgram(const ProgramHash &programHash, const Context *context, const Program *program);
@@ -113,6 +112,16 @@ class MemoryProgramCache final : angle::NonCopyable
     // Returns the maximum cache size in bytes.
     size_t maxSize() const;
 
+    // Adds a persistent tier backed by files in |directory|. Programs missing from memory are
+    // looked up on disk, and newly linked programs are written there in the background.
+    bool openDiskCache(const std::string &directory, size_t maxDiskCacheSizeBytes);
+
+    // Finishes pending disk writes and closes the disk tier.
+    void closeDiskCache();
+
+    // Returns true if either the memory or the disk tier can hold programs.
+    bool isEnabled() const;
+
   private:
     enum class CacheSource
     {
@@ -120,8 +129,21 @@ class MemoryProgramCache final : angle::NonCopyable
         PutBinary,
     };
 
-    using CacheEntry = std::pair<angle::MemoryBuffer, CacheSource>;
+    // Check if the cache contains a binary matching the specified program. The binary shares
+    // ownership of the cache entry, so it stays valid if the entry is evicted.
+    bool get(const ProgramHash &programHash,
+             std::shared_ptr<const uint8_t> *binaryOut,
+             size_t *lengthOut);
+
+    // Evict a program from the binary cache, if it is still there.
+    void remove(const ProgramHash &programHash);
+
+    // The cache belongs to the Display, so contexts on any thread can use it at the same time.
+    mutable std::mutex mMutex;
+
+    using CacheEntry = std::pair<std::shared_ptr<angle::MemoryBuffer>, CacheSource>;
     angle::SizedMRUCache<ProgramHash, CacheEntry> mProgramBinaryCache;
+    std::unique_ptr<DiskProgramCache> mDiskCache;
     unsigned int mIssuedWarnings;
 };
 
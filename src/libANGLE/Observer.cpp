@@ -42,11 +42,13 @@ Subject::~Subject()
 
 bool Subject::hasObservers() const
 {
+    std::lock_guard<std::mutex> lock(mObserversMutex);
     return !mFastObservers.empty();
 }
 
 void Subject::addObserver(ObserverBinding *observer)
 {
+    std::lock_guard<std::mutex> lock(mObserversMutex);
     ASSERT(!IsInContainer(mFastObservers, observer) && !IsInContainer(mSlowObservers, observer));
 
     if (!mFastObservers.full())
@@ -61,6 +63,7 @@ void Subject::addObserver(ObserverBinding *observer)
 
 void Subject::removeObserver(ObserverBinding *observer)
 {
+    std::lock_guard<std::mutex> lock(mObserversMutex);
     auto iter = std::find(mFastObservers.begin(), mFastObservers.end(), observer);
     if (iter != mFastObservers.end())
     {
@@ -84,6 +87,7 @@ void Subject::removeObserver(ObserverBinding *observer)
 
 void Subject::onStateChange(const gl::Context *context, SubjectMessage message) const
 {
+    std::lock_guard<std::mutex> lock(mObserversMutex);
     if (mFastObservers.empty())
         return;
 
@@ -100,6 +104,7 @@ void Subject::onStateChange(const gl::Context *context, SubjectMessage message)
 
 void Subject::resetObservers()
 {
+    std::lock_guard<std::mutex> lock(mObserversMutex);
     for (angle::ObserverBinding *observer : mFastObservers)
     {
         observer->onSubjectReset();
@@ -13,6 +13,8 @@
 #ifndef LIBANGLE_OBSERVER_H_
 #define LIBANGLE_OBSERVER_H_
 
+#include <mutex>
+
 #include "common/FixedVector.h"
 #include "common/angleutils.h"
 
@@ -31,6 +33,7 @@ enum class SubjectMessage
     CONTENTS_CHANGED,
     STORAGE_CHANGED,
     BINDING_CHANGED,
+    MAPPING_CHANGED,
     DEPENDENT_DIRTY_BITS,
 };
 
@@ -68,6 +71,11 @@ class Subject : NonCopyable
     static constexpr size_t kMaxFixedObservers = 8;
     angle::FixedVector<ObserverBinding *, kMaxFixedObservers> mFastObservers;
     std::vector<ObserverBinding *> mSlowObservers;
+
+    // Objects in a share group can be bound by one context while another context changes them and
+    // notifies their observers, so the lists are locked. Observers must not bind or unbind this
+    // subject from their notification.
+    mutable std::mutex mObserversMutex;
 };
 
 // Keeps a binding between a Subject and Observer, with a specific subject index.
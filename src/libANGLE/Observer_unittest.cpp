@@ -6,6 +6,10 @@
 // Observer_unittest:
 //   Unit tests for Observers and related classes.
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "libANGLE/Observer.h"
@@ -40,4 +44,63 @@ TEST(ObserverTest, BasicUsage)
     ASSERT_TRUE(observer.wasNotified);
 }
 
+// Test that observers can be bound and unbound on one thread while another thread notifies them.
+TEST(ObserverTest, BindWhileNotifying)
+{
+    struct CountingObserver : public ObserverInterface
+    {
+        void onSubjectStateChange(const gl::Context *context,
+                                  SubjectIndex index,
+                                  SubjectMessage message) override
+        {
+            notifications++;
+        }
+        std::atomic<size_t> notifications{0};
+    };
+
+    constexpr size_t kThreadCount  = 4;
+    constexpr size_t kIterations   = 2000;
+    constexpr size_t kBindingCount = 12;
+
+    Subject subject;
+    CountingObserver observer;
+    std::atomic<bool> done(false);
+
+    std::thread notifier([&]() {
+        while (!done)
+        {
+            subject.onStateChange(nullptr, SubjectMessage::CONTENTS_CHANGED);
+        }
+    });
+
+    // Enough bindings per thread to use the spill-over list as well as the fixed one.
+    std::vector<std::thread> binders;
+    for (size_t thread = 0; thread < kThreadCount; ++thread)
+    {
+        binders.emplace_back([&]() {
+            std::vector<ObserverBinding> bindings(kBindingCount, ObserverBinding(&observer, 0u));
+            for (size_t iteration = 0; iteration < kIterations; ++iteration)
+            {
+                for (ObserverBinding &binding : bindings)
+                {
+                    binding.bind(&subject);
+                }
+                for (ObserverBinding &binding : bindings)
+                {
+                    binding.reset();
+                }
+            }
+        });
+    }
+
+    for (std::thread &binder : binders)
+    {
+        binder.join();
+    }
+    done = true;
+    notifier.join();
+
+    EXPECT_FALSE(subject.hasObservers());
+}
+
 }  // anonymous namespace
@@ -23,6 +23,7 @@
 #include "libANGLE/ResourceManager.h"
 #include "libANGLE/Uniform.h"
 #include "libANGLE/VaryingPacking.h"
+#include "libANGLE/WorkerThread.h"
 #include "libANGLE/features.h"
 #include "libANGLE/histogram_macros.h"
 #include "libANGLE/queryconversions.h"
@@ -879,11 +880,59 @@ bool ProgramState::hasAttachedShader() const
     return false;
 }
 
+// Runs the front-end part of the link, and the back-end part if the back-end allows it. Only
+// touches the program state and the attached shaders, which are pinned until the link is resolved.
+class Program::LinkTask : public angle::Closure
+{
+  public:
+    LinkTask(Program *program, const Context *context) : mProgram(program), mContext(context) {}
+
+    void operator()() override;
+
+  private:
+    Program *mProgram;
+    const Context *mContext;
+};
+
+struct Program::LinkingState
+{
+    LinkingState(Program *program, const Context *context)
+        : startTime(0.0),
+          frontendLinked(false),
+          backendLinkOnWorker(false),
+          backendLinkResult(false),
+          linkTask(program, context)
+    {
+    }
+
+    ProgramHash programHash;
+    double startTime;
+    std::unique_ptr<ProgramLinkedResources> resources;
+    ProgramMergedVaryings mergedVaryings;
+    bool frontendLinked;
+    bool backendLinkOnWorker;
+    LinkResult backendLinkResult;
+    LinkTask linkTask;
+    angle::WaitableEvent linkEvent;
+};
+
+void Program::LinkTask::operator()()
+{
+    LinkingState *linkingState   = mProgram->mLinkingState.get();
+    linkingState->frontendLinked = mProgram->linkFrontend(mContext, linkingState);
+
+    if (linkingState->frontendLinked && linkingState->backendLinkOnWorker)
+    {
+        linkingState->backendLinkResult =
+            mProgram->mProgram->link(mContext, *linkingState->resources, mProgram->mInfoLog);
+    }
+}
+
 Program::Program(rx::GLImplFactory *factory, ShaderProgramManager *manager, GLuint handle)
     : mProgram(factory->createProgram(mState)),
       mValidated(false),
       mLinked(false),
-      mDeleteStatus(false),
+      mLinkSerial(0),
       mRefCount(0),
       mResourceManager(manager),
       mHandle(handle)
@@ -896,10 +945,13 @@ Program::Program(rx::GLImplFactory *factory, ShaderProgramManager *manager, GLui
 Program::~Program()
 {
     ASSERT(!mProgram);
+    ASSERT(!mLinkingState);
 }
 
 void Program::onDestroy(const Context *context)
 {
+    cancelLink();
+
     for (ShaderType shaderType : AllShaderTypes())
     {
         if (mState.mAttachedShaders[shaderType])
@@ -1059,11 +1111,11 @@ void Program::pathFragmentInputGen(const Context *context,
 // The code gets compiled into binaries.
 Error Program::link(const gl::Context *context)
 {
-    const auto &data = context->getContextState();
-
     auto *platform   = ANGLEPlatformCurrent();
     double startTime = platform->currentTime(platform);
 
+    // The results of a previous link are about to be thrown away, no need to finish it.
+    cancelLink();
     unlink();
     mInfoLog.reset();
 
@@ -1079,6 +1131,7 @@ Error Program::link(const gl::Context *context)
     {
         ANGLE_TRY_RESULT(cache->getProgram(context, this, &mState, &programHash), mLinked);
         ANGLE_HISTOGRAM_BOOLEAN("GPU.ANGLE.ProgramCache.LoadBinarySuccess", mLinked);
+        mLinkSerial++;
     }
 
     if (mLinked)
@@ -1095,18 +1148,52 @@ Error Program::link(const gl::Context *context)
     // Re-link shaders after the unlink call.
     ASSERT(linkValidateShaders(context, mInfoLog));
 
+    mLinkingState.reset(new LinkingState(this, context));
+    mLinkingState->programHash = programHash;
+    mLinkingState->startTime   = startTime;
+
+    // The attached shaders are read by the worker thread, so they must not change until the link
+    // is resolved.
+    for (Shader *shader : mState.mAttachedShaders)
+    {
+        if (shader)
+        {
+            shader->addPendingLink(this);
+        }
+    }
+
+    // The front-end linking is independent of the GL state, so it can run on a worker thread. The
+    // link is resolved the next time the program is used or queried.
+    if (context->getMaxShaderCompilerThreads() > 0)
+    {
+        mLinkingState->backendLinkOnWorker = mProgram->prepareLinkOnWorkerThread(context);
+        mLinkingState->linkEvent =
+            context->getWorkerThreadPool()->postWorkerTask(&mLinkingState->linkTask);
+    }
+    else
+    {
+        mLinkingState->linkTask();
+    }
+
+    return NoError();
+}
+
+bool Program::linkFrontend(const Context *context, LinkingState *linkingState)
+{
+    const auto &data = context->getContextState();
+
     if (mState.mAttachedShaders[ShaderType::Compute])
     {
         GLuint combinedImageUniforms = 0u;
         if (!linkUniforms(context, mInfoLog, mUniformLocationBindings, &combinedImageUniforms))
         {
-            return NoError();
+            return false;
         }
 
         GLuint combinedShaderStorageBlocks = 0u;
         if (!linkInterfaceBlocks(context, mInfoLog, &combinedShaderStorageBlocks))
         {
-            return NoError();
+            return false;
         }
 
         // [OpenGL ES 3.1] Chapter 8.22 Page 203:
@@ -1122,59 +1209,54 @@ Error Program::link(const gl::Context *context)
                    "and active fragment shader outputs exceeds "
                    "MAX_COMBINED_SHADER_OUTPUT_RESOURCES ("
                 << context->getCaps().maxCombinedShaderOutputResources << ")";
-            return NoError();
+            return false;
         }
 
-        ProgramLinkedResources resources = {
+        linkingState->resources.reset(new ProgramLinkedResources{
             {0, PackMode::ANGLE_RELAXED},
             {&mState.mUniformBlocks, &mState.mUniforms},
             {&mState.mShaderStorageBlocks, &mState.mBufferVariables},
-            {&mState.mAtomicCounterBuffers}};
-
-        InitUniformBlockLinker(context, mState, &resources.uniformBlockLinker);
-        InitShaderStorageBlockLinker(context, mState, &resources.shaderStorageBlockLinker);
+            {&mState.mAtomicCounterBuffers}});
 
-        ANGLE_TRY_RESULT(mProgram->link(context, resources, mInfoLog), mLinked);
-        if (!mLinked)
-        {
-            return NoError();
-        }
+        ProgramLinkedResources *resources = linkingState->resources.get();
+        InitUniformBlockLinker(context, mState, &resources->uniformBlockLinker);
+        InitShaderStorageBlockLinker(context, mState, &resources->shaderStorageBlockLinker);
     }
     else
     {
         if (!linkAttributes(context, mInfoLog))
         {
-            return NoError();
+            return false;
         }
 
         if (!linkVaryings(context, mInfoLog))
         {
-            return NoError();
+            return false;
         }
 
         GLuint combinedImageUniforms = 0u;
         if (!linkUniforms(context, mInfoLog, mUniformLocationBindings, &combinedImageUniforms))
         {
-            return NoError();
+            return false;
         }
 
         GLuint combinedShaderStorageBlocks = 0u;
         if (!linkInterfaceBlocks(context, mInfoLog, &combinedShaderStorageBlocks))
         {
-            return NoError();
+            return false;
         }
 
         if (!linkValidateGlobalNames(context, mInfoLog))
         {
-            return NoError();
+            return false;
         }
 
         if (!linkOutputVariables(context, combinedImageUniforms, combinedShaderStorageBlocks))
         {
-            return NoError();
+            return false;
         }
 
-        const auto &mergedVaryings = getMergedVaryings(context);
+        linkingState->mergedVaryings = getMergedVaryings(context);
 
         ASSERT(mState.mAttachedShaders[ShaderType::Vertex]);
         mState.mNumViews = mState.mAttachedShaders[ShaderType::Vertex]->getNumViews(context);
@@ -1192,33 +1274,72 @@ Error Program::link(const gl::Context *context)
             packMode = PackMode::WEBGL_STRICT;
         }
 
-        ProgramLinkedResources resources = {
+        linkingState->resources.reset(new ProgramLinkedResources{
             {data.getCaps().maxVaryingVectors, packMode},
             {&mState.mUniformBlocks, &mState.mUniforms},
             {&mState.mShaderStorageBlocks, &mState.mBufferVariables},
-            {&mState.mAtomicCounterBuffers}};
+            {&mState.mAtomicCounterBuffers}});
 
-        InitUniformBlockLinker(context, mState, &resources.uniformBlockLinker);
-        InitShaderStorageBlockLinker(context, mState, &resources.shaderStorageBlockLinker);
+        ProgramLinkedResources *resources = linkingState->resources.get();
+        InitUniformBlockLinker(context, mState, &resources->uniformBlockLinker);
+        InitShaderStorageBlockLinker(context, mState, &resources->shaderStorageBlockLinker);
 
-        if (!linkValidateTransformFeedback(context, mInfoLog, mergedVaryings, context->getCaps()))
+        if (!linkValidateTransformFeedback(context, mInfoLog, linkingState->mergedVaryings,
+                                           context->getCaps()))
         {
-            return NoError();
+            return false;
         }
 
-        if (!resources.varyingPacking.collectAndPackUserVaryings(
-                mInfoLog, mergedVaryings, mState.getTransformFeedbackVaryingNames()))
+        if (!resources->varyingPacking.collectAndPackUserVaryings(
+                mInfoLog, linkingState->mergedVaryings,
+                mState.getTransformFeedbackVaryingNames()))
         {
-            return NoError();
+            return false;
         }
+    }
+
+    return true;
+}
+
+void Program::resolveLinkImpl(const Context *context)
+{
+    ASSERT(mLinkingState);
+
+    mLinkingState->linkEvent.wait();
 
-        ANGLE_TRY_RESULT(mProgram->link(context, resources, mInfoLog), mLinked);
-        if (!mLinked)
+    std::unique_ptr<LinkingState> linkingState = std::move(mLinkingState);
+    for (Shader *shader : mState.mAttachedShaders)
+    {
+        if (shader)
         {
-            return NoError();
+            shader->removePendingLink(this);
         }
+    }
+
+    if (!linkingState->frontendLinked)
+    {
+        return;
+    }
 
-        gatherTransformFeedbackVaryings(mergedVaryings);
+    // Back-ends that need their native context link on the calling thread.
+    LinkResult result = linkingState->backendLinkOnWorker
+                            ? std::move(linkingState->backendLinkResult)
+                            : mProgram->link(context, *linkingState->resources, mInfoLog);
+    if (result.isError())
+    {
+        context->handleError(result.getError());
+        return;
+    }
+
+    mLinked = result.getResult();
+    if (!mLinked)
+    {
+        return;
+    }
+
+    if (!mState.mAttachedShaders[ShaderType::Compute])
+    {
+        gatherTransformFeedbackVaryings(linkingState->mergedVaryings);
     }
 
     initInterfaceBlockBindings();
@@ -1234,21 +1355,46 @@ Error Program::link(const gl::Context *context)
     mProgram->markUnusedUniformLocations(&mState.mUniformLocations, &mState.mSamplerBindings);
 
     // Save to the program cache.
+    MemoryProgramCache *cache = context->getMemoryProgramCache();
     if (cache && (mState.mLinkedTransformFeedbackVaryings.empty() ||
                   !context->getWorkarounds().disableProgramCachingForTransformFeedback))
     {
-        cache->putProgram(programHash, context, this);
+        cache->putProgram(linkingState->programHash, context, this);
     }
 
-    double delta = platform->currentTime(platform) - startTime;
-    int us       = static_cast<int>(delta * 1000000.0);
+    auto *platform = ANGLEPlatformCurrent();
+    double delta   = platform->currentTime(platform) - linkingState->startTime;
+    int us         = static_cast<int>(delta * 1000000.0);
     ANGLE_HISTOGRAM_COUNTS("GPU.ANGLE.ProgramCache.ProgramCacheMissTimeUS", us);
+}
 
-    return NoError();
+void Program::cancelLink()
+{
+    if (!mLinkingState)
+    {
+        return;
+    }
+
+    mLinkingState->linkEvent.wait();
+    mLinkingState.reset();
+
+    for (Shader *shader : mState.mAttachedShaders)
+    {
+        if (shader)
+        {
+            shader->removePendingLink(this);
+        }
+    }
+}
+
+bool Program::isLinkCompleted() const
+{
+    return !mLinkingState || mLinkingState->linkEvent.isReady();
 }
 
 void Program::updateLinkedShaderStages()
 {
+    mLinkSerial++;
     mState.mLinkedShaderStages.reset();
 
     for (const Shader *shader : mState.mAttachedShaders)
@@ -1315,6 +1461,7 @@ void Program::unlink()
     mValidated = false;
 
     mLinked = false;
+    mLinkSerial++;
     mInfoLog.reset();
 }
 
@@ -1344,6 +1491,7 @@ Error Program::loadBinary(const Context *context,
     const uint8_t *bytes = reinterpret_cast<const uint8_t *>(binary);
     ANGLE_TRY_RESULT(
         MemoryProgramCache::Deserialize(context, this, &mState, bytes, length, mInfoLog), mLinked);
+    mLinkSerial++;
 
     // Currently we require the full shader text to compute the program hash.
     // TODO(jmadill): Store the binary in the internal program cache.
@@ -1441,9 +1589,7 @@ bool Program::isSeparable() const
 
 void Program::release(const Context *context)
 {
-    mRefCount--;
-
-    if (mRefCount == 0 && mDeleteStatus)
+    if (mRefCount.fetch_sub(1) == (kDeleteStatusBit | 1))
     {
         mResourceManager->deleteProgram(context, mHandle);
     }
@@ -1456,7 +1602,7 @@ void Program::addRef()
 
 unsigned int Program::getRefCount() const
 {
-    return mRefCount;
+    return mRefCount & ~kDeleteStatusBit;
 }
 
 int Program::getInfoLogLength() const
@@ -1968,14 +2114,14 @@ void Program::getUniformuiv(const Context *context, GLint location, GLuint *v) c
     }
 }
 
-void Program::flagForDeletion()
+bool Program::flagForDeletion()
 {
-    mDeleteStatus = true;
+    return (mRefCount.fetch_or(kDeleteStatusBit) & ~kDeleteStatusBit) == 0;
 }
 
 bool Program::isFlaggedForDeletion() const
 {
-    return mDeleteStatus;
+    return (mRefCount & kDeleteStatusBit) != 0;
 }
 
 void Program::validate(const Caps &caps)
@@ -14,7 +14,9 @@
 #include <GLSLANG/ShaderVars.h>
 
 #include <array>
+#include <atomic>
 #include <map>
+#include <memory>
 #include <set>
 #include <sstream>
 #include <string>
@@ -494,9 +496,30 @@ class Program final : angle::NonCopyable, public LabeledObject
                               GLint components,
                               const GLfloat *coeffs);
 
+    // Links the program. The front-end part of the link, and the back-end part when the back-end
+    // allows it, may run on a worker thread, in which case the link is finished by resolveLink()
+    // the next time the program is used or queried.
     Error link(const Context *context);
     bool isLinked() const { return mLinked; }
 
+    // Changes whenever the link state or the linked shader stages change, so contexts that cache
+    // draw validation results for the program can tell when a relink in another context made them
+    // stale.
+    unsigned int getLinkSerial() const { return mLinkSerial; }
+
+    // Blocks until a pending link has finished and completes it on the calling thread.
+    void resolveLink(const Context *context)
+    {
+        if (mLinkingState)
+        {
+            resolveLinkImpl(context);
+        }
+    }
+
+    // KHR_parallel_shader_compile. These never block on a pending link.
+    bool isLinking() const { return mLinkingState != nullptr; }
+    bool isLinkCompleted() const;
+
     bool hasLinkedShaderStage(ShaderType shaderType) const;
 
     Error loadBinary(const Context *context,
@@ -634,7 +657,8 @@ class Program final : angle::NonCopyable, public LabeledObject
     void addRef();
     void release(const Context *context);
     unsigned int getRefCount() const;
-    void flagForDeletion();
+    // Returns true if the program had no references left, in which case the caller deletes it.
+    bool flagForDeletion();
     bool isFlaggedForDeletion() const;
 
     void validate(const Caps &caps);
@@ -709,8 +733,15 @@ class Program final : angle::NonCopyable, public LabeledObject
   private:
     ~Program() override;
 
+    class LinkTask;
+    struct LinkingState;
+
     void unlink();
 
+    bool linkFrontend(const Context *context, LinkingState *linkingState);
+    void resolveLinkImpl(const Context *context);
+    void cancelLink();
+
     bool linkValidateShaders(const Context *context, InfoLog &infoLog);
     bool linkAttributes(const Context *context, InfoLog &infoLog);
     bool linkInterfaceBlocks(const Context *context,
@@ -806,9 +837,13 @@ class Program final : angle::NonCopyable, public LabeledObject
     ProgramBindings mFragmentInputBindings;
 
     bool mLinked;
-    bool mDeleteStatus;   // Flag to indicate that the program can be deleted when no longer in use
+    std::atomic<unsigned int> mLinkSerial;
 
-    unsigned int mRefCount;
+    // The reference count, plus kDeleteStatusBit once the program is flagged for deletion. Keeping
+    // both in one word lets a release and a deletion on different threads agree on which of them
+    // drops the program.
+    static constexpr unsigned int kDeleteStatusBit = 0x80000000u;
+    std::atomic<unsigned int> mRefCount;
 
     ShaderProgramManager *mResourceManager;
     const GLuint mHandle;
@@ -818,6 +853,9 @@ class Program final : angle::NonCopyable, public LabeledObject
     // Cache for sampler validation
     Optional<bool> mCachedValidateSamplersResult;
     std::vector<TextureType> mTextureUnitTypesCache;
+
+    // Set while a link is in progress.
+    std::unique_ptr<LinkingState> mLinkingState;
 };
 }  // namespace gl
 
@@ -16,6 +16,7 @@
 #include "common/debug.h"
 #include "libANGLE/Error.h"
 
+#include <atomic>
 #include <cstddef>
 
 namespace gl
@@ -58,7 +59,8 @@ class RefCountObjectNoID : angle::NonCopyable
 
     template <class ObjectType>
     friend class BindingPointer;
-    mutable std::size_t mRefCount;
+    // Atomic because contexts on different threads can bind the same shared object.
+    mutable std::atomic<std::size_t> mRefCount;
 };
 
 inline RefCountObjectNoID::~RefCountObjectNoID()
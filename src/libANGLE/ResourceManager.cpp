@@ -83,13 +83,16 @@ void TypedResourceManager<ResourceType, HandleAllocatorType, ImplT>::deleteObjec
     GLuint handle)
 {
     ResourceType *resource = nullptr;
-    if (!mObjectMap.erase(handle, &resource))
     {
-        return;
-    }
+        // Requires an explicit this-> because of C++ template rules.
+        typename TypedResourceManager::WriteLock lock(this->mMutex, this->isShared());
+        if (!mObjectMap.erase(handle, &resource))
+        {
+            return;
+        }
 
-    // Requires an explicit this-> because of C++ template rules.
-    this->mHandleAllocator.release(handle);
+        this->mHandleAllocator.release(handle);
+    }
 
     if (resource)
     {
@@ -125,6 +128,7 @@ void BufferManager::DeleteObject(const Context *context, Buffer *buffer)
 
 GLuint BufferManager::createBuffer()
 {
+    WriteLock lock(mMutex, isShared());
     return AllocateEmptyObject(&mHandleAllocator, &mObjectMap);
 }
 
@@ -164,6 +168,7 @@ GLuint ShaderProgramManager::createShader(rx::GLImplFactory *factory,
                                           ShaderType type)
 {
     ASSERT(type != ShaderType::InvalidEnum);
+    WriteLock lock(mMutex, isShared());
     GLuint handle    = mHandleAllocator.allocate();
     mShaders.assign(handle, new Shader(this, factory, rendererLimitations, type, handle));
     return handle;
@@ -181,6 +186,7 @@ Shader *ShaderProgramManager::getShader(GLuint handle) const
 
 GLuint ShaderProgramManager::createProgram(rx::GLImplFactory *factory)
 {
+    WriteLock lock(mMutex, isShared());
     GLuint handle = mHandleAllocator.allocate();
     mPrograms.assign(handle, new Program(factory, this, handle));
     return handle;
@@ -196,27 +202,57 @@ Program *ShaderProgramManager::getProgram(GLuint handle) const
     return mPrograms.query(handle);
 }
 
+void ShaderProgramManager::resolveShaderCompiles(const Context *context) const
+{
+    ReadLock lock(mMutex, isShared());
+    for (const auto &shader : mShaders)
+    {
+        if (shader.second)
+        {
+            shader.second->resolveCompile(context);
+        }
+    }
+}
+
+void ShaderProgramManager::resolveProgramLinks(const Context *context) const
+{
+    ReadLock lock(mMutex, isShared());
+    for (const auto &program : mPrograms)
+    {
+        if (program.second)
+        {
+            program.second->resolveLink(context);
+        }
+    }
+}
+
 template <typename ObjectType>
 void ShaderProgramManager::deleteObject(const Context *context,
                                         ResourceMap<ObjectType> *objectMap,
                                         GLuint id)
 {
-    ObjectType *object = objectMap->query(id);
-    if (!object)
+    ObjectType *object = nullptr;
     {
-        return;
-    }
+        WriteLock lock(mMutex, isShared());
+        object = objectMap->query(id);
+        if (!object)
+        {
+            return;
+        }
+
+        // Flagging reads the reference count in the same atomic operation, so a release racing
+        // with this either sees the flag and deletes the object itself, or leaves it to us.
+        if (!object->flagForDeletion())
+        {
+            return;
+        }
 
-    if (object->getRefCount() == 0)
-    {
         mHandleAllocator.release(id);
-        object->onDestroy(context);
         objectMap->erase(id, &object);
     }
-    else
-    {
-        object->flagForDeletion();
-    }
+
+    // Destroying a program releases its shaders, which can delete them through this manager.
+    object->onDestroy(context);
 }
 
 // TextureManager Implementation.
@@ -239,6 +275,7 @@ void TextureManager::DeleteObject(const Context *context, Texture *texture)
 
 GLuint TextureManager::createTexture()
 {
+    WriteLock lock(mMutex, isShared());
     return AllocateEmptyObject(&mHandleAllocator, &mObjectMap);
 }
 
@@ -250,6 +287,7 @@ Texture *TextureManager::getTexture(GLuint handle) const
 
 void TextureManager::signalAllTexturesDirty(const Context *context) const
 {
+    ReadLock lock(mMutex, isShared());
     for (const auto &texture : mObjectMap)
     {
         if (texture.second)
@@ -284,6 +322,7 @@ void RenderbufferManager::DeleteObject(const Context *context, Renderbuffer *ren
 
 GLuint RenderbufferManager::createRenderbuffer()
 {
+    WriteLock lock(mMutex, isShared());
     return AllocateEmptyObject(&mHandleAllocator, &mObjectMap);
 }
 
@@ -310,6 +349,7 @@ void SamplerManager::DeleteObject(const Context *context, Sampler *sampler)
 
 GLuint SamplerManager::createSampler()
 {
+    WriteLock lock(mMutex, isShared());
     return AllocateEmptyObject(&mHandleAllocator, &mObjectMap);
 }
 
@@ -333,6 +373,7 @@ void SyncManager::DeleteObject(const Context *context, Sync *sync)
 
 GLuint SyncManager::createSync(rx::GLImplFactory *factory)
 {
+    WriteLock lock(mMutex, isShared());
     GLuint handle = mHandleAllocator.allocate();
     Sync *sync    = new Sync(factory->createSync(), handle);
     sync->addRef();
@@ -353,6 +394,8 @@ PathManager::PathManager()
 
 ErrorOrResult<GLuint> PathManager::createPaths(rx::GLImplFactory *factory, GLsizei range)
 {
+    WriteLock lock(mMutex, isShared());
+
     // Allocate client side handles.
     const GLuint client = mHandleAllocator.allocateRange(static_cast<GLuint>(range));
     if (client == HandleRangeAllocator::kInvalidHandle)
@@ -376,6 +419,7 @@ ErrorOrResult<GLuint> PathManager::createPaths(rx::GLImplFactory *factory, GLsiz
 
 void PathManager::deletePaths(GLuint first, GLsizei range)
 {
+    WriteLock lock(mMutex, isShared());
     for (GLsizei i = 0; i < range; ++i)
     {
         const auto id = first + i;
@@ -394,6 +438,7 @@ Path *PathManager::getPath(GLuint handle) const
 
 bool PathManager::hasPath(GLuint handle) const
 {
+    ReadLock lock(mMutex, isShared());
     return mHandleAllocator.isUsed(handle);
 }
 
@@ -434,6 +479,7 @@ void FramebufferManager::DeleteObject(const Context *context, Framebuffer *frame
 
 GLuint FramebufferManager::createFramebuffer()
 {
+    WriteLock lock(mMutex, isShared());
     return AllocateEmptyObject(&mHandleAllocator, &mObjectMap);
 }
 
@@ -445,11 +491,13 @@ Framebuffer *FramebufferManager::getFramebuffer(GLuint handle) const
 void FramebufferManager::setDefaultFramebuffer(Framebuffer *framebuffer)
 {
     ASSERT(framebuffer == nullptr || framebuffer->id() == 0);
+    WriteLock lock(mMutex, isShared());
     mObjectMap.assign(0, framebuffer);
 }
 
 void FramebufferManager::invalidateFramebufferComplenessCache() const
 {
+    ReadLock lock(mMutex, isShared());
     for (const auto &framebuffer : mObjectMap)
     {
         if (framebuffer.second)
@@ -478,6 +526,7 @@ void ProgramPipelineManager::DeleteObject(const Context *context, ProgramPipelin
 
 GLuint ProgramPipelineManager::createProgramPipeline()
 {
+    WriteLock lock(mMutex, isShared());
     return AllocateEmptyObject(&mHandleAllocator, &mObjectMap);
 }
 
@@ -10,7 +10,10 @@
 #ifndef LIBANGLE_RESOURCEMANAGER_H_
 #define LIBANGLE_RESOURCEMANAGER_H_
 
+#include <atomic>
+
 #include "angle_gl.h"
+#include "common/SharedMutex.h"
 #include "common/angleutils.h"
 #include "libANGLE/Error.h"
 #include "libANGLE/HandleAllocator.h"
@@ -47,14 +50,24 @@ class ResourceManagerBase : angle::NonCopyable
     void addRef();
     void release(const Context *context);
 
+    // True when more than one context uses this manager. Only shared managers take their lock, so
+    // a context that doesn't share its objects never waits on one.
+    bool isShared() const { return mRefCount.load(std::memory_order_relaxed) > 1; }
+
   protected:
+    using ReadLock  = angle::ConditionalSharedLockGuard<angle::SharedMutex>;
+    using WriteLock = angle::ConditionalLockGuard<angle::SharedMutex>;
+
     virtual void reset(const Context *context) = 0;
     virtual ~ResourceManagerBase() {}
 
+    // Guards the handle allocator and changes to the object maps of derived classes. Looking up a
+    // single object doesn't need the lock, but iterating over a map does.
+    mutable angle::SharedMutex mMutex;
     HandleAllocatorType mHandleAllocator;
 
   private:
-    size_t mRefCount;
+    std::atomic<size_t> mRefCount;
 };
 
 template <typename ResourceType, typename HandleAllocatorType, typename ImplT>
@@ -88,6 +101,15 @@ class TypedResourceManager : public ResourceManagerBase<HandleAllocatorType>
             return nullptr;
         }
 
+        typename TypedResourceManager::WriteLock lock(this->mMutex, this->isShared());
+
+        // Another context may have allocated the object since the map was read.
+        value = mObjectMap.query(handle);
+        if (value)
+        {
+            return value;
+        }
+
         ResourceType *object = ImplT::AllocateNewObject(factory, handle, args...);
 
         if (!mObjectMap.contains(handle))
@@ -138,6 +160,12 @@ class ShaderProgramManager : public ResourceManagerBase<HandleAllocator>
     void deleteProgram(const Context *context, GLuint program);
     Program *getProgram(GLuint handle) const;
 
+    // Finishes the compiles still running on worker threads.
+    void resolveShaderCompiles(const Context *context) const;
+
+    // Finishes the links still running on worker threads.
+    void resolveProgramLinks(const Context *context) const;
+
   protected:
     ~ShaderProgramManager() override;
 
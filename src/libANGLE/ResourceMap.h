@@ -4,13 +4,20 @@
 // found in the LICENSE file.
 //
 // ResourceMap:
-//   An optimized resource map which packs the first set of allocated objects into a
-//   flat array, and then falls back to an unordered map for the higher handle values.
+//   An optimized resource map which stores objects in fixed size pages. The pages of the low
+//   handles, which most apps use, are indexed directly from the map. Higher handles find their
+//   page through a radix table indexed by the high bits of the handle. Lookups are constant time
+//   for any handle, and only the pages that hold handles and the table levels above them use
+//   memory. Lookups don't lock and can run while another thread changes the map.
 //
 
 #ifndef LIBANGLE_RESOURCE_MAP_H_
 #define LIBANGLE_RESOURCE_MAP_H_
 
+#include <atomic>
+#include <memory>
+#include <vector>
+
 #include "libANGLE/angletypes.h"
 
 namespace gl
@@ -23,21 +30,23 @@ class ResourceMap final : angle::NonCopyable
     ResourceMap();
     ~ResourceMap();
 
+    // Can be called while another thread assigns or erases handles.
     ResourceType *query(GLuint handle) const;
 
     // Returns true if the handle was reserved. Not necessarily if the resource is created.
     bool contains(GLuint handle) const;
 
+    // Only one thread at a time may change the map.
+
     // Returns the element that was at this location.
     bool erase(GLuint handle, ResourceType **resourceOut);
 
     void assign(GLuint handle, ResourceType *resource);
 
-    // Clears the map.
+    // Clears the map. Frees the pages, so nothing may query the map at the same time.
     void clear();
 
     using IndexAndResource = std::pair<GLuint, ResourceType *>;
-    using HashMap          = std::unordered_map<GLuint, ResourceType *>;
 
     class Iterator final
     {
@@ -50,18 +59,15 @@ class ResourceMap final : angle::NonCopyable
 
       private:
         friend class ResourceMap;
-        Iterator(const ResourceMap &origin,
-                 GLuint flatIndex,
-                 typename HashMap::const_iterator hashIndex);
+        Iterator(const ResourceMap &origin, uint64_t index);
         void updateValue();
 
         const ResourceMap &mOrigin;
-        GLuint mFlatIndex;
-        typename HashMap::const_iterator mHashIndex;
+        uint64_t mIndex;
         IndexAndResource mValue;
     };
 
-    // null values represent reserved handles.
+    // Iterates over the created resources in handle order. Reserved handles are skipped.
     Iterator begin() const;
     Iterator end() const;
     Iterator find(GLuint handle) const;
@@ -72,27 +78,102 @@ class ResourceMap final : angle::NonCopyable
   private:
     friend class Iterator;
 
-    GLuint nextNonNullResource(size_t flatIndex) const;
+    // A handle is split, from the top, into a root index, an inner directory index, a leaf
+    // directory index and a slot in the page. 1024 handles per page keeps a page small enough for
+    // the few handles most maps hold.
+    static constexpr unsigned int kPageBits  = 10;
+    static constexpr unsigned int kLeafBits  = 7;
+    static constexpr unsigned int kInnerBits = 7;
+    static constexpr unsigned int kRootBits  = 32 - kInnerBits - kLeafBits - kPageBits;
+
+    static constexpr unsigned int kLeafShift  = kPageBits;
+    static constexpr unsigned int kInnerShift = kLeafShift + kLeafBits;
+    static constexpr unsigned int kRootShift  = kInnerShift + kInnerBits;
+
+    static constexpr size_t kPageSize  = static_cast<size_t>(1) << kPageBits;
+    static constexpr size_t kLeafSize  = static_cast<size_t>(1) << kLeafBits;
+    static constexpr size_t kInnerSize = static_cast<size_t>(1) << kInnerBits;
+    static constexpr size_t kRootSize  = static_cast<size_t>(1) << kRootBits;
+
+    static constexpr GLuint kPageMask  = static_cast<GLuint>(kPageSize - 1);
+    static constexpr GLuint kLeafMask  = static_cast<GLuint>(kLeafSize - 1);
+    static constexpr GLuint kInnerMask = static_cast<GLuint>(kInnerSize - 1);
+
+    // Handles below this find their page with one indexed load, like the flat array the map used
+    // to keep for them. Only higher handles walk the radix table.
+    static constexpr size_t kLowPageCount   = 16;
+    static constexpr GLuint kLowHandleLimit = static_cast<GLuint>(kLowPageCount << kPageBits);
+
+    // Past the last handle, for end().
+    static constexpr uint64_t kEndIndex = static_cast<uint64_t>(1) << 32;
+
+    struct Page
+    {
+        Page();
+
+        std::atomic<ResourceType *> slots[kPageSize];
+    };
+
+    // Every level of the table has a fixed size, so a level is never copied or replaced once
+    // readers can see it. Levels are only freed by clear().
+    template <typename ChildType, size_t kSize>
+    struct Directory
+    {
+        Directory();
+
+        std::atomic<ChildType *> children[kSize];
+    };
+
+    using LeafDirectory  = Directory<Page, kLeafSize>;
+    using InnerDirectory = Directory<LeafDirectory, kInnerSize>;
+    using RootDirectory  = Directory<InnerDirectory, kRootSize>;
+    using LowDirectory   = Directory<Page, kLowPageCount>;
+
+    const Page *getPage(GLuint handle) const;
+    Page *getOrAllocatePage(GLuint handle);
+    void resetRoot();
+
+    template <typename ChildType, size_t kSize>
+    static ChildType *GetOrAllocateChild(Directory<ChildType, kSize> *directory,
+                                         size_t index,
+                                         std::vector<std::unique_ptr<ChildType>> *allocations);
+
+    uint64_t nextNonNullResource(uint64_t index) const;
 
     // constexpr methods cannot contain reinterpret_cast, so we need a static method.
     static ResourceType *InvalidPointer();
     static constexpr intptr_t kInvalidPointer = static_cast<intptr_t>(-1);
 
-    // Start with 32 maximum elements in the map, which can grow.
-    static constexpr size_t kInitialFlatResourcesSize = 0x20;
-
-    // Experimental testing suggests that 16k is a reasonable upper limit.
-    static constexpr size_t kFlatResourcesLimit = 0x4000;
+    // Readers walk the table without locking. The low pages and the root are part of the map, so an
+    // empty map doesn't allocate anything.
+    LowDirectory mLowPages;
+    RootDirectory mRoot;
+    std::vector<std::unique_ptr<InnerDirectory>> mInnerDirectories;
+    std::vector<std::unique_ptr<LeafDirectory>> mLeafDirectories;
+    std::vector<std::unique_ptr<Page>> mPages;
+};
 
-    std::vector<ResourceType *> mFlatResources;
+template <typename ResourceType>
+ResourceMap<ResourceType>::Page::Page()
+{
+    for (std::atomic<ResourceType *> &slot : slots)
+    {
+        slot.store(InvalidPointer(), std::memory_order_relaxed);
+    }
+}
 
-    // A map of GL objects indexed by object ID.
-    HashMap mHashedResources;
-};
+template <typename ResourceType>
+template <typename ChildType, size_t kSize>
+ResourceMap<ResourceType>::Directory<ChildType, kSize>::Directory()
+{
+    for (std::atomic<ChildType *> &child : children)
+    {
+        child.store(nullptr, std::memory_order_relaxed);
+    }
+}
 
 template <typename ResourceType>
 ResourceMap<ResourceType>::ResourceMap()
-    : mFlatResources(kInitialFlatResourcesSize, InvalidPointer()), mHashedResources()
 {
 }
 
@@ -103,102 +184,143 @@ ResourceMap<ResourceType>::~ResourceMap()
 }
 
 template <typename ResourceType>
-ResourceType *ResourceMap<ResourceType>::query(GLuint handle) const
+ANGLE_INLINE const typename ResourceMap<ResourceType>::Page *ResourceMap<ResourceType>::getPage(
+    GLuint handle) const
 {
-    if (handle < mFlatResources.size())
+    if (handle < kLowHandleLimit)
+    {
+        return mLowPages.children[handle >> kPageBits].load(std::memory_order_acquire);
+    }
+
+    const InnerDirectory *inner =
+        mRoot.children[handle >> kRootShift].load(std::memory_order_acquire);
+    if (!inner)
+    {
+        return nullptr;
+    }
+    const LeafDirectory *leaf =
+        inner->children[(handle >> kInnerShift) & kInnerMask].load(std::memory_order_acquire);
+    if (!leaf)
     {
-        auto value = mFlatResources[handle];
-        return (value == InvalidPointer() ? nullptr : value);
+        return nullptr;
     }
-    auto it = mHashedResources.find(handle);
-    return (it == mHashedResources.end() ? nullptr : it->second);
+    return leaf->children[(handle >> kLeafShift) & kLeafMask].load(std::memory_order_acquire);
 }
 
 template <typename ResourceType>
-bool ResourceMap<ResourceType>::contains(GLuint handle) const
+ANGLE_INLINE ResourceType *ResourceMap<ResourceType>::query(GLuint handle) const
 {
-    if (handle < mFlatResources.size())
+    const Page *page = getPage(handle);
+    if (!page)
     {
-        return (mFlatResources[handle] != InvalidPointer());
+        return nullptr;
     }
-    return (mHashedResources.find(handle) != mHashedResources.end());
+    ResourceType *value = page->slots[handle & kPageMask].load(std::memory_order_acquire);
+    return (value == InvalidPointer() ? nullptr : value);
+}
+
+template <typename ResourceType>
+bool ResourceMap<ResourceType>::contains(GLuint handle) const
+{
+    const Page *page = getPage(handle);
+    return page &&
+           page->slots[handle & kPageMask].load(std::memory_order_acquire) != InvalidPointer();
 }
 
 template <typename ResourceType>
 bool ResourceMap<ResourceType>::erase(GLuint handle, ResourceType **resourceOut)
 {
-    if (handle < mFlatResources.size())
+    // Pages aren't freed when they empty out, since a reader may be looking at them.
+    Page *page = const_cast<Page *>(getPage(handle));
+    if (!page)
     {
-        auto &value = mFlatResources[handle];
-        if (value == InvalidPointer())
-        {
-            return false;
-        }
-        *resourceOut = value;
-        value        = InvalidPointer();
+        return false;
     }
-    else
+
+    std::atomic<ResourceType *> &slot = page->slots[handle & kPageMask];
+    ResourceType *value               = slot.load(std::memory_order_relaxed);
+    if (value == InvalidPointer())
     {
-        auto it = mHashedResources.find(handle);
-        if (it == mHashedResources.end())
-        {
-            return false;
-        }
-        *resourceOut = it->second;
-        mHashedResources.erase(it);
+        return false;
     }
+
+    *resourceOut = value;
+    slot.store(InvalidPointer(), std::memory_order_release);
     return true;
 }
 
 template <typename ResourceType>
 void ResourceMap<ResourceType>::assign(GLuint handle, ResourceType *resource)
 {
-    if (handle < kFlatResourcesLimit)
+    Page *page = getOrAllocatePage(handle);
+    page->slots[handle & kPageMask].store(resource, std::memory_order_release);
+}
+
+template <typename ResourceType>
+template <typename ChildType, size_t kSize>
+// static
+ChildType *ResourceMap<ResourceType>::GetOrAllocateChild(
+    Directory<ChildType, kSize> *directory,
+    size_t index,
+    std::vector<std::unique_ptr<ChildType>> *allocations)
+{
+    ChildType *child = directory->children[index].load(std::memory_order_relaxed);
+    if (!child)
     {
-        if (handle >= mFlatResources.size())
-        {
-            // Use power-of-two.
-            size_t newSize = mFlatResources.size();
-            while (newSize <= handle)
-            {
-                newSize *= 2;
-            }
-            mFlatResources.resize(newSize, nullptr);
-        }
-        ASSERT(mFlatResources.size() > handle);
-        mFlatResources[handle] = resource;
+        child = new ChildType();
+        allocations->emplace_back(child);
+        directory->children[index].store(child, std::memory_order_release);
+    }
+    return child;
+}
+
+template <typename ResourceType>
+typename ResourceMap<ResourceType>::Page *ResourceMap<ResourceType>::getOrAllocatePage(
+    GLuint handle)
+{
+    if (handle < kLowHandleLimit)
+    {
+        return GetOrAllocateChild(&mLowPages, handle >> kPageBits, &mPages);
+    }
+
+    InnerDirectory *inner = GetOrAllocateChild(&mRoot, handle >> kRootShift, &mInnerDirectories);
+    LeafDirectory *leaf =
+        GetOrAllocateChild(inner, (handle >> kInnerShift) & kInnerMask, &mLeafDirectories);
+    return GetOrAllocateChild(leaf, (handle >> kLeafShift) & kLeafMask, &mPages);
+}
+
+template <typename ResourceType>
+void ResourceMap<ResourceType>::resetRoot()
+{
+    for (std::atomic<Page *> &page : mLowPages.children)
+    {
+        page.store(nullptr, std::memory_order_release);
     }
-    else
+    for (std::atomic<InnerDirectory *> &inner : mRoot.children)
     {
-        mHashedResources[handle] = resource;
+        inner.store(nullptr, std::memory_order_release);
     }
+    mInnerDirectories.clear();
+    mLeafDirectories.clear();
+    mPages.clear();
 }
 
 template <typename ResourceType>
 typename ResourceMap<ResourceType>::Iterator ResourceMap<ResourceType>::begin() const
 {
-    return Iterator(*this, nextNonNullResource(0), mHashedResources.begin());
+    return Iterator(*this, nextNonNullResource(0));
 }
 
 template <typename ResourceType>
 typename ResourceMap<ResourceType>::Iterator ResourceMap<ResourceType>::end() const
 {
-    return Iterator(*this, static_cast<GLuint>(mFlatResources.size()), mHashedResources.end());
+    return Iterator(*this, kEndIndex);
 }
 
 template <typename ResourceType>
 typename ResourceMap<ResourceType>::Iterator ResourceMap<ResourceType>::find(GLuint handle) const
 {
-    if (handle < mFlatResources.size())
-    {
-        return (mFlatResources[handle] != InvalidPointer()
-                    ? Iterator(handle, mHashedResources.begin())
-                    : end());
-    }
-    else
-    {
-        return mHashedResources.find(handle);
-    }
+    return (query(handle) != nullptr ? Iterator(*this, handle) : end());
 }
 
 template <typename ResourceType>
@@ -210,21 +332,58 @@ bool ResourceMap<ResourceType>::empty() const
 template <typename ResourceType>
 void ResourceMap<ResourceType>::clear()
 {
-    mFlatResources.assign(kInitialFlatResourcesSize, InvalidPointer());
-    mHashedResources.clear();
+    resetRoot();
 }
 
 template <typename ResourceType>
-GLuint ResourceMap<ResourceType>::nextNonNullResource(size_t flatIndex) const
+uint64_t ResourceMap<ResourceType>::nextNonNullResource(uint64_t index) const
 {
-    for (size_t index = flatIndex; index < mFlatResources.size(); index++)
+    // Missing directories skip all the handles below them at once.
+    while (index < kEndIndex)
     {
-        if (mFlatResources[index] != nullptr && mFlatResources[index] != InvalidPointer())
+        GLuint handle    = static_cast<GLuint>(index);
+        const Page *page = nullptr;
+
+        if (handle < kLowHandleLimit)
+        {
+            page = mLowPages.children[handle >> kPageBits].load(std::memory_order_acquire);
+        }
+        else
         {
-            return static_cast<GLuint>(index);
+            const InnerDirectory *inner =
+                mRoot.children[handle >> kRootShift].load(std::memory_order_acquire);
+            if (!inner)
+            {
+                index = ((index >> kRootShift) + 1) << kRootShift;
+                continue;
+            }
+
+            const LeafDirectory *leaf = inner->children[(handle >> kInnerShift) & kInnerMask].load(
+                std::memory_order_acquire);
+            if (!leaf)
+            {
+                index = ((index >> kInnerShift) + 1) << kInnerShift;
+                continue;
+            }
+
+            page = leaf->children[(handle >> kLeafShift) & kLeafMask].load(
+                std::memory_order_acquire);
         }
+
+        if (page)
+        {
+            for (size_t slotIndex = handle & kPageMask; slotIndex < kPageSize; ++slotIndex)
+            {
+                ResourceType *value = page->slots[slotIndex].load(std::memory_order_acquire);
+                if (value != nullptr && value != InvalidPointer())
+                {
+                    return (index & ~static_cast<uint64_t>(kPageMask)) + slotIndex;
+                }
+            }
+        }
+        index = ((index >> kPageBits) + 1) << kPageBits;
     }
-    return static_cast<GLuint>(mFlatResources.size());
+    return kEndIndex;
 }
 
 template <typename ResourceType>
@@ -235,11 +394,8 @@ ResourceType *ResourceMap<ResourceType>::InvalidPointer()
 }
 
 template <typename ResourceType>
-ResourceMap<ResourceType>::Iterator::Iterator(
-    const ResourceMap &origin,
-    GLuint flatIndex,
-    typename ResourceMap<ResourceType>::HashMap::const_iterator hashIndex)
-    : mOrigin(origin), mFlatIndex(flatIndex), mHashIndex(hashIndex), mValue()
+ResourceMap<ResourceType>::Iterator::Iterator(const ResourceMap &origin, uint64_t index)
+    : mOrigin(origin), mIndex(index), mValue()
 {
     updateValue();
 }
@@ -247,7 +403,7 @@ ResourceMap<ResourceType>::Iterator::Iterator(
 template <typename ResourceType>
 bool ResourceMap<ResourceType>::Iterator::operator==(const Iterator &other) const
 {
-    return (mFlatIndex == other.mFlatIndex && mHashIndex == other.mHashIndex);
+    return (mIndex == other.mIndex);
 }
 
 template <typename ResourceType>
@@ -259,14 +415,7 @@ bool ResourceMap<ResourceType>::Iterator::operator!=(const Iterator &other) cons
 template <typename ResourceType>
 typename ResourceMap<ResourceType>::Iterator &ResourceMap<ResourceType>::Iterator::operator++()
 {
-    if (mFlatIndex < static_cast<GLuint>(mOrigin.mFlatResources.size()))
-    {
-        mFlatIndex = mOrigin.nextNonNullResource(mFlatIndex + 1);
-    }
-    else
-    {
-        mHashIndex++;
-    }
+    mIndex = mOrigin.nextNonNullResource(mIndex + 1);
     updateValue();
     return *this;
 }
@@ -288,15 +437,10 @@ const typename ResourceMap<ResourceType>::IndexAndResource
 template <typename ResourceType>
 void ResourceMap<ResourceType>::Iterator::updateValue()
 {
-    if (mFlatIndex < static_cast<GLuint>(mOrigin.mFlatResources.size()))
-    {
-        mValue.first  = mFlatIndex;
-        mValue.second = mOrigin.mFlatResources[mFlatIndex];
-    }
-    else if (mHashIndex != mOrigin.mHashedResources.end())
+    if (mIndex < kEndIndex)
     {
-        mValue.first  = mHashIndex->first;
-        mValue.second = mHashIndex->second;
+        mValue.first  = static_cast<GLuint>(mIndex);
+        mValue.second = mOrigin.query(mValue.first);
     }
 }
 
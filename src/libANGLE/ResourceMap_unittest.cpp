@@ -0,0 +1,182 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ResourceMap_unittest:
+//   Unit tests for the ResourceMap template class.
+//
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <thread>
+#include <vector>
+
+#include "libANGLE/ResourceMap.h"
+
+using namespace gl;
+
+namespace
+{
+
+// Assigning, querying and erasing handles across the whole handle range.
+TEST(ResourceMapTest, AssignAndErase)
+{
+    std::array<size_t, 6> objects;
+    std::array<GLuint, 6> handles = {{1, 2, 1023, 1024, 0x80000000u, 0xFFFFFFFFu}};
+
+    ResourceMap<size_t> resourceMap;
+    for (size_t index = 0; index < handles.size(); ++index)
+    {
+        EXPECT_FALSE(resourceMap.contains(handles[index]));
+        resourceMap.assign(handles[index], &objects[index]);
+    }
+
+    for (size_t index = 0; index < handles.size(); ++index)
+    {
+        EXPECT_TRUE(resourceMap.contains(handles[index]));
+        EXPECT_EQ(&objects[index], resourceMap.query(handles[index]));
+    }
+
+    EXPECT_FALSE(resourceMap.contains(3));
+    EXPECT_FALSE(resourceMap.contains(0xFFFFFFFEu));
+    EXPECT_EQ(nullptr, resourceMap.query(0x80000001u));
+
+    for (size_t index = 0; index < handles.size(); ++index)
+    {
+        size_t *object = nullptr;
+        EXPECT_TRUE(resourceMap.erase(handles[index], &object));
+        EXPECT_EQ(&objects[index], object);
+        EXPECT_FALSE(resourceMap.erase(handles[index], &object));
+        EXPECT_FALSE(resourceMap.contains(handles[index]));
+    }
+
+    EXPECT_TRUE(resourceMap.empty());
+}
+
+// Reserved handles are contained in the map, but skipped by iteration.
+TEST(ResourceMapTest, ReservedHandles)
+{
+    size_t object = 0;
+
+    ResourceMap<size_t> resourceMap;
+    resourceMap.assign(5, nullptr);
+    EXPECT_TRUE(resourceMap.contains(5));
+    EXPECT_EQ(nullptr, resourceMap.query(5));
+    EXPECT_TRUE(resourceMap.empty());
+
+    resourceMap.assign(5, &object);
+    EXPECT_EQ(&object, resourceMap.query(5));
+    EXPECT_FALSE(resourceMap.empty());
+
+    resourceMap.clear();
+    EXPECT_FALSE(resourceMap.contains(5));
+}
+
+// Iteration visits sparse handles in order.
+TEST(ResourceMapTest, Iteration)
+{
+    std::array<size_t, 5> objects;
+    std::array<GLuint, 5> handles = {{7, 4096, 70000, 0x10000000u, 0xFFFFFFFFu}};
+
+    ResourceMap<size_t> resourceMap;
+    for (size_t index = handles.size(); index > 0; --index)
+    {
+        resourceMap.assign(handles[index - 1], &objects[index - 1]);
+    }
+    resourceMap.assign(8, nullptr);
+
+    size_t count = 0;
+    for (const auto &entry : resourceMap)
+    {
+        ASSERT_LT(count, handles.size());
+        EXPECT_EQ(handles[count], entry.first);
+        EXPECT_EQ(&objects[count], entry.second);
+        count++;
+    }
+    EXPECT_EQ(handles.size(), count);
+
+    EXPECT_EQ(70000u, resourceMap.find(70000)->first);
+    EXPECT_TRUE(resourceMap.find(8) == resourceMap.end());
+
+    resourceMap.clear();
+    EXPECT_TRUE(resourceMap.empty());
+}
+
+// Handles on either side of each table level's boundary, and of the directly indexed low pages,
+// land in separate slots, and iteration crosses the boundaries in order.
+TEST(ResourceMapTest, TableBoundaries)
+{
+    std::array<size_t, 10> objects;
+    std::array<GLuint, 10> handles = {{0x3FFu, 0x400u, 0x3FFFu, 0x4000u, 0x1FFFFu, 0x20000u,
+                                       0xFFFFFFu, 0x1000000u, 0xFFFFFBFFu, 0xFFFFFC00u}};
+
+    ResourceMap<size_t> resourceMap;
+    for (size_t index = 0; index < handles.size(); ++index)
+    {
+        resourceMap.assign(handles[index], &objects[index]);
+    }
+
+    size_t count = 0;
+    for (const auto &entry : resourceMap)
+    {
+        ASSERT_LT(count, handles.size());
+        EXPECT_EQ(handles[count], entry.first);
+        EXPECT_EQ(&objects[count], entry.second);
+        count++;
+    }
+    EXPECT_EQ(handles.size(), count);
+
+    for (size_t index = 0; index < handles.size(); ++index)
+    {
+        size_t *object = nullptr;
+        EXPECT_TRUE(resourceMap.erase(handles[index], &object));
+        EXPECT_EQ(&objects[index], object);
+    }
+    EXPECT_TRUE(resourceMap.empty());
+}
+
+// Lookups on one thread see either nothing or the assigned object while another thread grows the
+// map.
+TEST(ResourceMapTest, ConcurrentQueries)
+{
+    constexpr GLuint kHandleCount = 1 << 16;
+    constexpr GLuint kStride      = 7;
+
+    std::vector<size_t> objects(kHandleCount);
+    ResourceMap<size_t> resourceMap;
+    std::atomic<bool> done(false);
+    size_t mismatches = 0;
+
+    std::thread reader([&]() {
+        while (!done.load())
+        {
+            for (GLuint index = 0; index < kHandleCount; index += 97)
+            {
+                size_t *object = resourceMap.query(index * kStride);
+                if (object != nullptr && object != &objects[index])
+                {
+                    mismatches++;
+                }
+            }
+        }
+    });
+
+    for (GLuint index = 0; index < kHandleCount; ++index)
+    {
+        resourceMap.assign(index * kStride, &objects[index]);
+    }
+    done = true;
+    reader.join();
+
+    EXPECT_EQ(0u, mismatches);
+    for (GLuint index = 0; index < kHandleCount; ++index)
+    {
+        ASSERT_EQ(&objects[index], resourceMap.query(index * kStride));
+    }
+
+    resourceMap.clear();
+}
+
+}  // anonymous namespace
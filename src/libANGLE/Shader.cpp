@@ -10,6 +10,7 @@
 
 #include "libANGLE/Shader.h"
 
+#include <algorithm>
 #include <sstream>
 
 #include "common/utilities.h"
@@ -17,16 +18,22 @@
 #include "libANGLE/Caps.h"
 #include "libANGLE/Compiler.h"
 #include "libANGLE/Constants.h"
+#include "libANGLE/Program.h"
+#include "libANGLE/WorkerThread.h"
 #include "libANGLE/renderer/GLImplFactory.h"
 #include "libANGLE/renderer/ShaderImpl.h"
 #include "libANGLE/ResourceManager.h"
 #include "libANGLE/Context.h"
+#include "third_party/trace_event/trace_event.h"
 
 namespace gl
 {
 
 namespace
 {
+// Shaders with at least this much source are translated using large pool allocator pages.
+constexpr size_t kLargeShaderSourceLength = 64 * 1024;
+
 template <typename VarT>
 std::vector<VarT> GetActiveShaderVariables(const std::vector<VarT> *variableList)
 {
@@ -50,6 +57,28 @@ const std::vector<VarT> &GetShaderVariables(const std::vector<VarT> *variableLis
     return *variableList;
 }
 
+// The translator only collects compile statistics while they are traced.
+bool ShouldCollectCompileStatistics()
+{
+    return *TRACE_EVENT_API_GET_CATEGORY_ENABLED("gpu.angle") != 0;
+}
+
+// Adds an event for each phase of the last compile. The node and page counts are only available
+// through sh::GetCompileStatistics, since trace events take at most two arguments.
+void TraceCompileStatistics(ShHandle compilerHandle)
+{
+    const std::vector<sh::CompilePhaseStatistics> *phases =
+        sh::GetCompileStatistics(compilerHandle);
+    ASSERT(phases);
+    for (const sh::CompilePhaseStatistics &phase : *phases)
+    {
+        TRACE_EVENT_COPY_INSTANT2(
+            "gpu.angle", phase.name.c_str(), "microseconds",
+            static_cast<unsigned long long>(phase.wallTimeSeconds * 1000000.0), "pool_bytes",
+            static_cast<unsigned long long>(phase.poolBytes));
+    }
+}
+
 }  // anonymous namespace
 
 // true if varying x has a higher priority in packing than y
@@ -96,6 +125,49 @@ const char *GetShaderTypeString(ShaderType type)
     }
 }
 
+// Runs the translator. Only touches the compiler handle checked out for this compile and the
+// source strings, which stay untouched until the compile is resolved.
+class Shader::CompileTask : public angle::Closure
+{
+  public:
+    CompileTask(CompilingState *compilingState) : mCompilingState(compilingState) {}
+
+    void operator()() override;
+
+  private:
+    CompilingState *mCompilingState;
+};
+
+struct Shader::CompilingState
+{
+    CompilingState(ShHandle compilerHandleIn, ShCompileOptions compileOptionsIn)
+        : compilerHandle(compilerHandleIn),
+          compileOptions(compileOptionsIn),
+          translated(false),
+          compileTask(this)
+    {
+    }
+
+    ShHandle compilerHandle;
+    ShCompileOptions compileOptions;
+    std::vector<const char *> srcStrings;
+    bool translated;
+    CompileTask compileTask;
+    angle::WaitableEvent compileEvent;
+};
+
+void Shader::CompileTask::operator()()
+{
+    mCompilingState->translated =
+        sh::Compile(mCompilingState->compilerHandle, &mCompilingState->srcStrings[0],
+                    mCompilingState->srcStrings.size(), mCompilingState->compileOptions);
+
+    if (mCompilingState->compileOptions & SH_COLLECT_COMPILE_STATISTICS)
+    {
+        TraceCompileStatistics(mCompilingState->compilerHandle);
+    }
+}
+
 ShaderState::ShaderState(ShaderType shaderType)
     : mLabel(),
       mShaderType(shaderType),
@@ -122,7 +194,6 @@ Shader::Shader(ShaderProgramManager *manager,
       mHandle(handle),
       mType(type),
       mRefCount(0),
-      mDeleteStatus(false),
       mResourceManager(manager)
 {
     ASSERT(mImplementation);
@@ -130,6 +201,7 @@ Shader::Shader(ShaderProgramManager *manager,
 
 void Shader::onDestroy(const gl::Context *context)
 {
+    cancelCompile();
     mImplementation->destroy(context);
     mBoundCompiler.set(context, nullptr);
     mImplementation.reset(nullptr);
@@ -139,6 +211,7 @@ void Shader::onDestroy(const gl::Context *context)
 Shader::~Shader()
 {
     ASSERT(!mImplementation);
+    ASSERT(!mCompilingState);
 }
 
 void Shader::setLabel(const std::string &label)
@@ -289,6 +362,11 @@ void Shader::getTranslatedSourceWithDebugInfo(const Context *context,
 
 void Shader::compile(const Context *context)
 {
+    resolvePendingLinks(context);
+
+    // The results of a previous compile are about to be thrown away, no need to finish it.
+    cancelCompile();
+
     mState.mTranslatedSource.clear();
     mInfoLog.clear();
     mState.mShaderVersion = 100;
@@ -315,7 +393,7 @@ void Shader::compile(const Context *context)
 
     mLastCompileOptions = mImplementation->prepareSourceAndReturnOptions(context, &sourceStream,
                                                                          &mLastCompiledSourcePath);
-    mLastCompileOptions |= (SH_OBJECT_CODE | SH_VARIABLES);
+    mLastCompileOptions |= (SH_OBJECT_CODE | SH_VARIABLES | SH_CACHE_TRANSLATION);
     mLastCompiledSource = sourceStream.str();
 
     // Add default options to WebGL shaders to prevent unexpected behavior during compilation.
@@ -334,32 +412,76 @@ void Shader::compile(const Context *context)
     {
         mLastCompileOptions |= SH_VALIDATE_LOOP_INDEXING;
     }
+
+    if (mLastCompiledSource.size() >= kLargeShaderSourceLength)
+    {
+        mLastCompileOptions |= SH_LARGE_POOL_PAGES;
+    }
+
+    if (ShouldCollectCompileStatistics())
+    {
+        mLastCompileOptions |= SH_COLLECT_COMPILE_STATISTICS;
+    }
+
+    ShHandle compilerHandle = mBoundCompiler->acquireCompilerHandle(mState.mShaderType);
+    mCompilingState.reset(new CompilingState(compilerHandle, mLastCompileOptions));
+
+    if (!mLastCompiledSourcePath.empty())
+    {
+        mCompilingState->srcStrings.push_back(mLastCompiledSourcePath.c_str());
+    }
+
+    mCompilingState->srcStrings.push_back(mLastCompiledSource.c_str());
+
+    if (context->getMaxShaderCompilerThreads() > 0)
+    {
+        mCompilingState->compileEvent =
+            context->getWorkerThreadPool()->postWorkerTask(&mCompilingState->compileTask);
+    }
+    else
+    {
+        mCompilingState->compileTask();
+    }
 }
 
-void Shader::resolveCompile(const Context *context)
+void Shader::cancelCompile()
 {
-    if (!mState.compilePending())
+    if (!mCompilingState)
     {
         return;
     }
 
-    ASSERT(mBoundCompiler.get());
-    ShHandle compilerHandle = mBoundCompiler->getCompilerHandle(mState.mShaderType);
+    mCompilingState->compileEvent.wait();
+    mBoundCompiler->releaseCompilerHandle(mState.mShaderType, mCompilingState->compilerHandle);
+    mCompilingState.reset();
+}
 
-    std::vector<const char *> srcStrings;
+bool Shader::isCompileCompleted() const
+{
+    return !mCompilingState || mCompilingState->compileEvent.isReady();
+}
 
-    if (!mLastCompiledSourcePath.empty())
+void Shader::resolveCompile(const Context *context)
+{
+    if (!mState.compilePending())
     {
-        srcStrings.push_back(mLastCompiledSourcePath.c_str());
+        return;
     }
 
-    srcStrings.push_back(mLastCompiledSource.c_str());
+    ASSERT(mBoundCompiler.get());
+    ASSERT(mCompilingState);
+
+    mCompilingState->compileEvent.wait();
+
+    std::unique_ptr<CompilingState> compilingState = std::move(mCompilingState);
+    ShHandle compilerHandle                        = compilingState->compilerHandle;
 
-    if (!sh::Compile(compilerHandle, &srcStrings[0], srcStrings.size(), mLastCompileOptions))
+    if (!compilingState->translated)
     {
         mInfoLog = sh::GetInfoLog(compilerHandle);
         WARN() << std::endl << mInfoLog;
         mState.mCompileStatus = CompileStatus::NOT_COMPILED;
+        mBoundCompiler->releaseCompilerHandle(mState.mShaderType, compilerHandle);
         return;
     }
 
@@ -448,8 +570,11 @@ void Shader::resolveCompile(const Context *context)
 
     ASSERT(!mState.mTranslatedSource.empty());
 
-    bool success = mImplementation->postTranslateCompile(context, mBoundCompiler.get(), &mInfoLog);
+    bool success = mImplementation->postTranslateCompile(context, mBoundCompiler.get(),
+                                                         compilerHandle, &mInfoLog);
     mState.mCompileStatus = success ? CompileStatus::COMPILED : CompileStatus::NOT_COMPILED;
+
+    mBoundCompiler->releaseCompilerHandle(mState.mShaderType, compilerHandle);
 }
 
 void Shader::addRef()
@@ -459,9 +584,7 @@ void Shader::addRef()
 
 void Shader::release(const Context *context)
 {
-    mRefCount--;
-
-    if (mRefCount == 0 && mDeleteStatus)
+    if (mRefCount.fetch_sub(1) == (kDeleteStatusBit | 1))
     {
         mResourceManager->deleteShader(context, mHandle);
     }
@@ -469,17 +592,17 @@ void Shader::release(const Context *context)
 
 unsigned int Shader::getRefCount() const
 {
-    return mRefCount;
+    return mRefCount & ~kDeleteStatusBit;
 }
 
 bool Shader::isFlaggedForDeletion() const
 {
-    return mDeleteStatus;
+    return (mRefCount & kDeleteStatusBit) != 0;
 }
 
-void Shader::flagForDeletion()
+bool Shader::flagForDeletion()
 {
-    mDeleteStatus = true;
+    return (mRefCount.fetch_or(kDeleteStatusBit) & ~kDeleteStatusBit) == 0;
 }
 
 bool Shader::isCompiled(const Context *context)
@@ -618,6 +741,28 @@ Optional<GLint> Shader::getGeometryShaderMaxVertices(const Context *context)
     return mState.mGeometryShaderMaxVertices;
 }
 
+void Shader::addPendingLink(Program *program)
+{
+    ASSERT(std::find(mPendingLinks.begin(), mPendingLinks.end(), program) == mPendingLinks.end());
+    mPendingLinks.push_back(program);
+}
+
+void Shader::removePendingLink(Program *program)
+{
+    auto iter = std::find(mPendingLinks.begin(), mPendingLinks.end(), program);
+    ASSERT(iter != mPendingLinks.end());
+    mPendingLinks.erase(iter);
+}
+
+void Shader::resolvePendingLinks(const Context *context)
+{
+    // Resolving a link removes it from the list.
+    while (!mPendingLinks.empty())
+    {
+        mPendingLinks.back()->resolveLink(context);
+    }
+}
+
 const std::string &Shader::getCompilerResourcesString() const
 {
     ASSERT(mBoundCompiler.get());
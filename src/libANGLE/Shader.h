@@ -12,6 +12,7 @@
 #ifndef LIBANGLE_SHADER_H_
 #define LIBANGLE_SHADER_H_
 
+#include <atomic>
 #include <list>
 #include <memory>
 #include <string>
@@ -37,6 +38,7 @@ namespace gl
 class Compiler;
 class ContextState;
 struct Limitations;
+class Program;
 class ShaderProgramManager;
 class Context;
 
@@ -150,14 +152,20 @@ class Shader final : angle::NonCopyable, public LabeledObject
                                           GLsizei *length,
                                           char *buffer);
 
+    // Starts translating the shader on a worker thread. The results are gathered by the first
+    // call that needs them.
     void compile(const Context *context);
     bool isCompiled(const Context *context);
 
+    // KHR_parallel_shader_compile. Never blocks on a pending compile.
+    bool isCompileCompleted() const;
+
     void addRef();
     void release(const Context *context);
     unsigned int getRefCount() const;
     bool isFlaggedForDeletion() const;
-    void flagForDeletion();
+    // Returns true if the shader had no references left, in which case the caller deletes it.
+    bool flagForDeletion();
 
     int getShaderVersion(const Context *context);
 
@@ -187,6 +195,15 @@ class Shader final : angle::NonCopyable, public LabeledObject
 
     const std::string &getCompilerResourcesString() const;
 
+    // Programs reading this shader from a worker thread. The shader state must not change until
+    // their links are resolved.
+    void addPendingLink(Program *program);
+    void removePendingLink(Program *program);
+    void resolvePendingLinks(const Context *context);
+
+    // Blocks until a pending compile has finished and completes it on the calling thread.
+    void resolveCompile(const Context *context);
+
   private:
     ~Shader() override;
     static void GetSourceImpl(const std::string &source,
@@ -194,7 +211,10 @@ class Shader final : angle::NonCopyable, public LabeledObject
                               GLsizei *length,
                               char *buffer);
 
-    void resolveCompile(const Context *context);
+    class CompileTask;
+    struct CompilingState;
+
+    void cancelCompile();
 
     ShaderState mState;
     std::string mLastCompiledSource;
@@ -204,14 +224,21 @@ class Shader final : angle::NonCopyable, public LabeledObject
     const gl::Limitations &mRendererLimitations;
     const GLuint mHandle;
     const ShaderType mType;
-    unsigned int mRefCount;     // Number of program objects this shader is attached to
-    bool mDeleteStatus;         // Flag to indicate that the shader can be deleted when no longer in use
+    // The number of program objects this shader is attached to, plus kDeleteStatusBit once the
+    // shader is flagged for deletion. See Program::mRefCount.
+    static constexpr unsigned int kDeleteStatusBit = 0x80000000u;
+    std::atomic<unsigned int> mRefCount;
     std::string mInfoLog;
 
     // We keep a reference to the translator in order to defer compiles while preserving settings.
     BindingPointer<Compiler> mBoundCompiler;
 
     ShaderProgramManager *mResourceManager;
+
+    std::vector<Program *> mPendingLinks;
+
+    // Set while the translator runs on a worker thread.
+    std::unique_ptr<CompilingState> mCompilingState;
 };
 
 bool CompareShaderVar(const sh::ShaderVariable &x, const sh::ShaderVariable &y);
@@ -2529,20 +2529,7 @@ bool State::hasMappedBuffer(BufferBinding target) const
 {
     if (target == BufferBinding::Array)
     {
-        const VertexArray *vao     = getVertexArray();
-        const auto &vertexAttribs  = vao->getVertexAttributes();
-        const auto &vertexBindings = vao->getVertexBindings();
-        for (size_t attribIndex : vao->getEnabledAttributesMask())
-        {
-            const VertexAttribute &vertexAttrib = vertexAttribs[attribIndex];
-            auto *boundBuffer = vertexBindings[vertexAttrib.bindingIndex].getBuffer().get();
-            if (vertexAttrib.enabled && boundBuffer && boundBuffer->isMapped())
-            {
-                return true;
-            }
-        }
-
-        return false;
+        return getVertexArray()->hasMappedEnabledArrayBuffer();
     }
     else
     {
@@ -2827,6 +2814,13 @@ AttributesMask State::getAndResetDirtyCurrentValues() const
     return retVal;
 }
 
+State::DirtyBits State::getAndResetValidationDirtyBits()
+{
+    DirtyBits retVal = mDirtyBits | mUnvalidatedDirtyBits;
+    mUnvalidatedDirtyBits.reset();
+    return retVal;
+}
+
 bool State::isCurrentTransformFeedback(const TransformFeedback *tf) const
 {
     return tf == mTransformFeedback.get();
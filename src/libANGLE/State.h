@@ -434,10 +434,22 @@ class State : public angle::ObserverInterface, angle::NonCopyable
 
     using DirtyBits = angle::BitSet<DIRTY_BIT_MAX>;
     const DirtyBits &getDirtyBits() const { return mDirtyBits; }
-    void clearDirtyBits() { mDirtyBits.reset(); }
-    void clearDirtyBits(const DirtyBits &bitset) { mDirtyBits &= ~bitset; }
+    void clearDirtyBits()
+    {
+        mUnvalidatedDirtyBits |= mDirtyBits;
+        mDirtyBits.reset();
+    }
+    void clearDirtyBits(const DirtyBits &bitset)
+    {
+        mUnvalidatedDirtyBits |= (mDirtyBits & bitset);
+        mDirtyBits &= ~bitset;
+    }
     void setAllDirtyBits() { mDirtyBits.set(); }
 
+    // Draw validation caches results derived from the state. It needs all the bits that were set
+    // since it last asked, including the ones the back-end has synced and cleared since.
+    DirtyBits getAndResetValidationDirtyBits();
+
     using DirtyObjects = angle::BitSet<DIRTY_OBJECT_MAX>;
     void clearDirtyObjects() { mDirtyObjects.reset(); }
     void setAllDirtyObjects() { mDirtyObjects.set(); }
@@ -610,6 +622,7 @@ class State : public angle::ObserverInterface, angle::NonCopyable
     GLES1State mGLES1State;
 
     DirtyBits mDirtyBits;
+    DirtyBits mUnvalidatedDirtyBits;
     mutable DirtyObjects mDirtyObjects;
     mutable AttributesMask mDirtyCurrentValues;
 };
@@ -24,6 +24,12 @@ namespace gl
 
 namespace
 {
+// Textures in a shared TextureManager can be changed by contexts on several threads at once.
+bool IsShared(const Context *context)
+{
+    return context && context->getContextState().areTexturesShared();
+}
+
 bool IsPointSampled(const SamplerState &samplerState)
 {
     return (samplerState.magFilter == GL_NEAREST &&
@@ -938,6 +944,8 @@ Error Texture::setImage(const Context *context,
                         GLenum type,
                         const uint8_t *pixels)
 {
+    angle::ConditionalLockGuard<std::mutex> lock(mMutex, IsShared(context));
+
     ASSERT(TextureTargetToType(target) == mState.mType);
 
     // Release from previous calls to eglBindTexImage, to avoid calling the Impl after
@@ -965,6 +973,8 @@ Error Texture::setSubImage(const Context *context,
                            GLenum type,
                            const uint8_t *pixels)
 {
+    angle::ConditionalLockGuard<std::mutex> lock(mMutex, IsShared(context));
+
     ASSERT(TextureTargetToType(target) == mState.mType);
 
     ANGLE_TRY(ensureSubImageInitialized(context, target, level, area));
@@ -983,6 +993,8 @@ Error Texture::setCompressedImage(const Context *context,
                                   size_t imageSize,
                                   const uint8_t *pixels)
 {
+    angle::ConditionalLockGuard<std::mutex> lock(mMutex, IsShared(context));
+
     ASSERT(TextureTargetToType(target) == mState.mType);
 
     // Release from previous calls to eglBindTexImage, to avoid calling the Impl after
@@ -1010,6 +1022,8 @@ Error Texture::setCompressedSubImage(const Context *context,
                                      size_t imageSize,
                                      const uint8_t *pixels)
 {
+    angle::ConditionalLockGuard<std::mutex> lock(mMutex, IsShared(context));
+
     ASSERT(TextureTargetToType(target) == mState.mType);
 
     ANGLE_TRY(ensureSubImageInitialized(context, target, level, area));
@@ -1027,6 +1041,8 @@ Error Texture::copyImage(const Context *context,
                          GLenum internalFormat,
                          Framebuffer *source)
 {
+    angle::ConditionalLockGuard<std::mutex> lock(mMutex, IsShared(context));
+
     ASSERT(TextureTargetToType(target) == mState.mType);
 
     // Release from previous calls to eglBindTexImage, to avoid calling the Impl after
@@ -1064,6 +1080,8 @@ Error Texture::copySubImage(const Context *context,
                             const Rectangle &sourceArea,
                             Framebuffer *source)
 {
+    angle::ConditionalLockGuard<std::mutex> lock(mMutex, IsShared(context));
+
     ASSERT(TextureTargetToType(target) == mState.mType);
 
     // Ensure source FBO is initialized.
@@ -1088,6 +1106,8 @@ Error Texture::copyTexture(const Context *context,
                            bool unpackUnmultiplyAlpha,
                            Texture *source)
 {
+    angle::ConditionalLockGuard<std::mutex> lock(mMutex, IsShared(context));
+
     ASSERT(TextureTargetToType(target) == mState.mType);
     ASSERT(source->getType() != TextureType::CubeMap);
 
@@ -1127,6 +1147,8 @@ Error Texture::copySubTexture(const Context *context,
                               bool unpackUnmultiplyAlpha,
                               Texture *source)
 {
+    angle::ConditionalLockGuard<std::mutex> lock(mMutex, IsShared(context));
+
     ASSERT(TextureTargetToType(target) == mState.mType);
 
     // Ensure source is initialized.
@@ -1144,6 +1166,8 @@ Error Texture::copySubTexture(const Context *context,
 
 Error Texture::copyCompressedTexture(const Context *context, const Texture *source)
 {
+    angle::ConditionalLockGuard<std::mutex> lock(mMutex, IsShared(context));
+
     // Release from previous calls to eglBindTexImage, to avoid calling the Impl after
     ANGLE_TRY(releaseTexImageInternal(context));
     ANGLE_TRY(orphanImages(context));
@@ -1164,6 +1188,8 @@ Error Texture::setStorage(const Context *context,
                           GLenum internalFormat,
                           const Extents &size)
 {
+    angle::ConditionalLockGuard<std::mutex> lock(mMutex, IsShared(context));
+
     ASSERT(type == mState.mType);
 
     // Release from previous calls to eglBindTexImage, to avoid calling the Impl after
@@ -1197,6 +1223,8 @@ Error Texture::setStorageMultisample(const Context *context,
                                      const Extents &size,
                                      bool fixedSampleLocations)
 {
+    angle::ConditionalLockGuard<std::mutex> lock(mMutex, IsShared(context));
+
     ASSERT(type == mState.mType);
 
     // Release from previous calls to eglBindTexImage, to avoid calling the Impl after
@@ -1219,6 +1247,8 @@ Error Texture::setStorageMultisample(const Context *context,
 
 Error Texture::generateMipmap(const Context *context)
 {
+    angle::ConditionalLockGuard<std::mutex> lock(mMutex, IsShared(context));
+
     // Release from previous calls to eglBindTexImage, to avoid calling the Impl after
     ANGLE_TRY(releaseTexImageInternal(context));
 
@@ -10,10 +10,12 @@
 #define LIBANGLE_TEXTURE_H_
 
 #include <map>
+#include <mutex>
 #include <vector>
 
 #include "angle_gl.h"
 #include "common/Optional.h"
+#include "common/SharedMutex.h"
 #include "common/debug.h"
 #include "libANGLE/Caps.h"
 #include "libANGLE/Constants.h"
@@ -478,6 +480,9 @@ class Texture final : public egl::ImageSibling, public LabeledObject
     };
 
     mutable SamplerCompletenessCache mCompletenessCache;
+
+    // Serializes changes made by contexts on different threads. Unused if the texture isn't shared.
+    std::mutex mMutex;
 };
 
 inline bool operator==(const TextureState &a, const TextureState &b)
@@ -49,7 +49,9 @@ VertexArray::VertexArray(rx::GLImplFactory *factory,
     : mId(id),
       mState(maxAttribs, maxAttribBindings),
       mVertexArray(factory->createVertexArray(mState)),
-      mElementArrayBufferObserverBinding(this, maxAttribBindings)
+      mElementArrayBufferObserverBinding(this, maxAttribBindings),
+      mCachedNonInstancedElementLimit(0),
+      mCachedInstancedElementLimit(0)
 {
     for (size_t attribIndex = 0; attribIndex < maxAttribBindings; ++attribIndex)
     {
@@ -95,11 +97,15 @@ const std::string &VertexArray::getLabel() const
 void VertexArray::detachBuffer(const Context *context, GLuint bufferName)
 {
     bool isBound = context->isCurrentVertexArray(this);
-    for (auto &binding : mState.mVertexBindings)
+    for (size_t bindingIndex = 0; bindingIndex < mState.mVertexBindings.size(); ++bindingIndex)
     {
+        VertexBinding &binding = mState.mVertexBindings[bindingIndex];
         if (binding.getBuffer().id() == bufferName)
         {
             binding.setBuffer(context, nullptr, isBound);
+            updateCachedBufferBindingSize(bindingIndex);
+            updateCachedMappedArrayBuffers(bindingIndex);
+            mCachedElementLimitsAttribs.reset();
         }
     }
 
@@ -135,12 +141,14 @@ void VertexArray::setDirtyAttribBit(size_t attribIndex, DirtyAttribBitType dirty
 {
     mDirtyBits.set(DIRTY_BIT_ATTRIB_0 + attribIndex);
     mDirtyAttribBits[attribIndex].set(dirtyAttribBit);
+    mCachedElementLimitsAttribs.reset();
 }
 
 void VertexArray::setDirtyBindingBit(size_t bindingIndex, DirtyBindingBitType dirtyBindingBit)
 {
     mDirtyBits.set(DIRTY_BIT_BINDING_0 + bindingIndex);
     mDirtyBindingBits[bindingIndex].set(dirtyBindingBit);
+    mCachedElementLimitsAttribs.reset();
 }
 
 void VertexArray::bindVertexBufferImpl(const Context *context,
@@ -161,6 +169,7 @@ void VertexArray::bindVertexBufferImpl(const Context *context,
     updateObserverBinding(bindingIndex);
     updateCachedBufferBindingSize(bindingIndex);
     updateCachedTransformFeedbackBindingValidation(bindingIndex, boundBuffer);
+    updateCachedMappedArrayBuffers(bindingIndex);
 }
 
 void VertexArray::bindVertexBuffer(const Context *context,
@@ -358,6 +367,7 @@ void VertexArray::onSubjectStateChange(const gl::Context *context,
             if (index < mArrayBufferObserverBindings.size())
             {
                 updateCachedBufferBindingSize(index);
+                mCachedElementLimitsAttribs.reset();
             }
             break;
 
@@ -369,6 +379,13 @@ void VertexArray::onSubjectStateChange(const gl::Context *context,
             }
             break;
 
+        case angle::SubjectMessage::MAPPING_CHANGED:
+            if (index < mArrayBufferObserverBindings.size())
+            {
+                updateCachedMappedArrayBuffers(index);
+            }
+            break;
+
         default:
             UNREACHABLE();
             break;
@@ -430,4 +447,89 @@ bool VertexArray::hasTransformFeedbackBindingConflict(const AttributesMask &acti
     return false;
 }
 
+void VertexArray::updateCachedMappedArrayBuffers(size_t bindingIndex)
+{
+    const Buffer *buffer = mState.mVertexBindings[bindingIndex].getBuffer().get();
+    mCachedMappedArrayBuffers.set(bindingIndex, buffer && buffer->isMapped());
+}
+
+bool VertexArray::hasMappedEnabledArrayBuffer() const
+{
+    // Fast check first.
+    if (!mCachedMappedArrayBuffers.any())
+    {
+        return false;
+    }
+
+    // Slow check. We must ensure that the mapped buffers are used by enabled attributes.
+    for (size_t attribIndex : mState.mEnabledAttributesMask)
+    {
+        const VertexAttribute &attrib = mState.mVertexAttributes[attribIndex];
+        if (mCachedMappedArrayBuffers[attrib.bindingIndex])
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void VertexArray::getElementLimits(const AttributesMask &activeAttribs,
+                                   GLint64 *nonInstancedLimitOut,
+                                   GLint64 *instancedLimitOut) const
+{
+    if (!mCachedElementLimitsAttribs.valid() || mCachedElementLimitsAttribs.value() != activeAttribs)
+    {
+        updateCachedElementLimits(activeAttribs);
+    }
+
+    *nonInstancedLimitOut = mCachedNonInstancedElementLimit;
+    *instancedLimitOut    = mCachedInstancedElementLimit;
+}
+
+void VertexArray::updateCachedElementLimits(const AttributesMask &activeAttribs) const
+{
+    constexpr GLint64 kMaxLimit = std::numeric_limits<GLint64>::max();
+
+    GLint64 nonInstancedLimit = kMaxLimit;
+    GLint64 instancedLimit    = kMaxLimit;
+
+    for (size_t attribIndex : activeAttribs)
+    {
+        const VertexAttribute &attrib = mState.mVertexAttributes[attribIndex];
+        const VertexBinding &binding  = mState.mVertexBindings[attrib.bindingIndex];
+        ASSERT(ComputeVertexAttributeStride(attrib, binding) == binding.getStride());
+
+        // [OpenGL ES 3.0.2] section 2.9.4 page 40:
+        // We can return INVALID_OPERATION if our array buffer does not have enough backing data.
+        // Element N can be fetched if N * stride + size + relative offset fits in the buffer.
+        GLuint64 bufferSize = binding.getCachedBufferSizeMinusOffset();
+        GLuint64 stride     = static_cast<GLuint64>(binding.getStride());
+        GLint64 limit       = -1;
+        if (attrib.cachedSizePlusRelativeOffset <= bufferSize)
+        {
+            // The stride is a GLsizei, so the quotient always fits when it isn't zero.
+            GLuint64 remainingSize = bufferSize - attrib.cachedSizePlusRelativeOffset;
+            limit = stride == 0 ? kMaxLimit : static_cast<GLint64>(remainingSize / stride);
+        }
+
+        GLuint divisor = binding.getDivisor();
+        if (divisor == 0)
+        {
+            nonInstancedLimit = std::min(nonInstancedLimit, limit);
+        }
+        else
+        {
+            // Instance I fetches element I / divisor, so the last instance that can be drawn is
+            // the last one before element limit + 1.
+            GLint64 instances = limit >= (kMaxLimit / divisor) ? kMaxLimit : (limit + 1) * divisor;
+            instancedLimit    = std::min(instancedLimit, instances - 1);
+        }
+    }
+
+    mCachedElementLimitsAttribs     = activeAttribs;
+    mCachedNonInstancedElementLimit = nonInstancedLimit;
+    mCachedInstancedElementLimit    = instancedLimit;
+}
+
 }  // namespace gl
@@ -246,6 +246,15 @@ class VertexArray final : public angle::ObserverInterface, public LabeledObject
 
     void onBindingChanged(const Context *context, bool bound);
     bool hasTransformFeedbackBindingConflict(const AttributesMask &activeAttribues) const;
+    bool hasMappedEnabledArrayBuffer() const;
+
+    // Returns the largest vertex index that non-instanced attributes can fetch, and the largest
+    // instance index that instanced attributes can fetch, without reading past the end of their
+    // buffers. The limits are -1 if an attribute can't fetch anything, and are cached for the
+    // last set of active attributes until an attribute, binding or buffer size changes.
+    void getElementLimits(const AttributesMask &activeAttribs,
+                          GLint64 *nonInstancedLimitOut,
+                          GLint64 *instancedLimitOut) const;
 
   private:
     ~VertexArray() override;
@@ -263,6 +272,8 @@ class VertexArray final : public angle::ObserverInterface, public LabeledObject
     void updateCachedVertexAttributeSize(size_t attribIndex);
     void updateCachedBufferBindingSize(size_t bindingIndex);
     void updateCachedTransformFeedbackBindingValidation(size_t bindingIndex, const Buffer *buffer);
+    void updateCachedMappedArrayBuffers(size_t bindingIndex);
+    void updateCachedElementLimits(const AttributesMask &activeAttribs) const;
 
     GLuint mId;
 
@@ -278,6 +289,11 @@ class VertexArray final : public angle::ObserverInterface, public LabeledObject
     angle::ObserverBinding mElementArrayBufferObserverBinding;
 
     AttributesMask mCachedTransformFeedbackConflictedBindingsMask;
+    AttributesMask mCachedMappedArrayBuffers;
+
+    mutable Optional<AttributesMask> mCachedElementLimitsAttribs;
+    mutable GLint64 mCachedNonInstancedElementLimit;
+    mutable GLint64 mCachedInstancedElementLimit;
 };
 
 }  // namespace gl
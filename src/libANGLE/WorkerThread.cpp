@@ -10,6 +10,8 @@
 
 #include "libANGLE/WorkerThread.h"
 
+#include <algorithm>
+
 namespace angle
 {
 
@@ -17,7 +19,7 @@ namespace priv
 {
 // SingleThreadedWorkerPool implementation.
 SingleThreadedWorkerPool::SingleThreadedWorkerPool(size_t maxThreads)
-    : WorkerThreadPoolBase(maxThreads)
+    : WorkerThreadPoolBase(maxThreads), mMaxThreads(maxThreads)
 {
 }
 
@@ -31,6 +33,16 @@ SingleThreadedWaitableEvent SingleThreadedWorkerPool::postWorkerTaskImpl(Closure
     return SingleThreadedWaitableEvent(EventResetPolicy::Automatic, EventInitialState::Signaled);
 }
 
+void SingleThreadedWorkerPool::setMaxThreadsImpl(size_t maxThreads)
+{
+    mMaxThreads = maxThreads;
+}
+
+size_t SingleThreadedWorkerPool::getMaxThreadsImpl() const
+{
+    return mMaxThreads;
+}
+
 // SingleThreadedWaitableEvent implementation.
 SingleThreadedWaitableEvent::SingleThreadedWaitableEvent()
     : SingleThreadedWaitableEvent(EventResetPolicy::Automatic, EventInitialState::NonSignaled)
@@ -72,19 +84,45 @@ void SingleThreadedWaitableEvent::signalImpl()
     mSignaled = true;
 }
 
+bool SingleThreadedWaitableEvent::isReadyImpl()
+{
+    // Tasks run synchronously, so waiting never blocks.
+    return true;
+}
+
 #if (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
 // AsyncWorkerPool implementation.
-AsyncWorkerPool::AsyncWorkerPool(size_t maxThreads) : WorkerThreadPoolBase(maxThreads)
+AsyncWorkerPool::AsyncWorkerPool(size_t maxThreads)
+    : WorkerThreadPoolBase(maxThreads), mMaxThreads(maxThreads), mRunningTasks(0), mPendingTasks(0)
 {
 }
 
 AsyncWorkerPool::~AsyncWorkerPool()
 {
+    // The tasks still use the pool's lock, so they have to finish before it goes away.
+    std::unique_lock<std::mutex> lock(mMutex);
+    mCondition.wait(lock, [this] { return mPendingTasks == 0; });
 }
 
 AsyncWaitableEvent AsyncWorkerPool::postWorkerTaskImpl(Closure *task)
 {
-    auto future = std::async(std::launch::async, [task] { (*task)(); });
+    bool runInline = false;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        runInline = (mMaxThreads == 0);
+        if (!runInline)
+        {
+            ++mPendingTasks;
+        }
+    }
+
+    if (runInline)
+    {
+        (*task)();
+        return AsyncWaitableEvent(EventResetPolicy::Automatic, EventInitialState::Signaled);
+    }
+
+    auto future = std::async(std::launch::async, [this, task] { runTask(task); });
 
     AsyncWaitableEvent waitable(EventResetPolicy::Automatic, EventInitialState::NonSignaled);
 
@@ -93,6 +131,39 @@ AsyncWaitableEvent AsyncWorkerPool::postWorkerTaskImpl(Closure *task)
     return waitable;
 }
 
+void AsyncWorkerPool::setMaxThreadsImpl(size_t maxThreads)
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mMaxThreads = maxThreads;
+    }
+    mCondition.notify_all();
+}
+
+size_t AsyncWorkerPool::getMaxThreadsImpl() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mMaxThreads;
+}
+
+void AsyncWorkerPool::runTask(Closure *task)
+{
+    {
+        // A limit lowered to zero after the task was posted still lets it run, one at a time.
+        std::unique_lock<std::mutex> lock(mMutex);
+        mCondition.wait(lock, [this] { return mRunningTasks < std::max<size_t>(mMaxThreads, 1); });
+        ++mRunningTasks;
+    }
+
+    (*task)();
+
+    // Notify under the lock, since the pool may be destroyed as soon as the last task is done.
+    std::lock_guard<std::mutex> lock(mMutex);
+    --mRunningTasks;
+    --mPendingTasks;
+    mCondition.notify_all();
+}
+
 // AsyncWaitableEvent implementation.
 AsyncWaitableEvent::AsyncWaitableEvent()
     : AsyncWaitableEvent(EventResetPolicy::Automatic, EventInitialState::NonSignaled)
@@ -150,6 +221,16 @@ void AsyncWaitableEvent::signalImpl()
         reset();
     }
 }
+
+bool AsyncWaitableEvent::isReadyImpl()
+{
+    if (mSignaled || !mFuture.valid())
+    {
+        return true;
+    }
+
+    return mFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
 #endif  // (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
 
 }  // namespace priv
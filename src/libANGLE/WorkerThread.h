@@ -18,7 +18,9 @@
 #include "libANGLE/features.h"
 
 #if (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
+#include <condition_variable>
 #include <future>
+#include <mutex>
 #endif  // (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
 
 namespace angle
@@ -67,6 +69,9 @@ class WaitableEventBase : angle::NonCopyable
     // The event state is reset to non-signaled after a waiting thread has been released.
     void signal();
 
+    // Returns true if waiting on the event would not block.
+    bool isReady();
+
   protected:
     Impl &copyBase(Impl &&other);
 
@@ -108,6 +113,12 @@ void WaitableEventBase<Impl>::signal()
     static_cast<Impl *>(this)->signalImpl();
 }
 
+template <typename Impl>
+bool WaitableEventBase<Impl>::isReady()
+{
+    return static_cast<Impl *>(this)->isReadyImpl();
+}
+
 template <typename Impl>
 template <size_t Count>
 // static
@@ -144,6 +155,7 @@ class SingleThreadedWaitableEvent : public WaitableEventBase<SingleThreadedWaita
     void resetImpl();
     void waitImpl();
     void signalImpl();
+    bool isReadyImpl();
 
     // Wait, synchronously, on multiple events.
     // returns the index of a WaitableEvent which has been signaled.
@@ -173,6 +185,7 @@ class AsyncWaitableEvent : public WaitableEventBase<AsyncWaitableEvent>
     void resetImpl();
     void waitImpl();
     void signalImpl();
+    bool isReadyImpl();
 
     // Wait, synchronously, on multiple events.
     // returns the index of a WaitableEvent which has been signaled.
@@ -230,6 +243,12 @@ class WorkerThreadPoolBase : angle::NonCopyable
     // Returns an event to wait on for the task to finish.
     // If the pool fails to create the task, returns null.
     WaitableEventType postWorkerTask(Closure *task);
+
+    // Limits how many tasks run at the same time. Tasks posted beyond the limit wait for a running
+    // one to finish, and a limit of zero runs tasks on the posting thread. Tasks must not wait on
+    // other tasks of the same pool, or they can deadlock once the limit is reached.
+    void setMaxThreads(size_t maxThreads);
+    size_t getMaxThreads() const;
 };
 
 template <typename Impl>
@@ -249,6 +268,18 @@ typename WorkerThreadPoolBase<Impl>::WaitableEventType WorkerThreadPoolBase<Impl
     return static_cast<Impl *>(this)->postWorkerTaskImpl(task);
 }
 
+template <typename Impl>
+void WorkerThreadPoolBase<Impl>::setMaxThreads(size_t maxThreads)
+{
+    static_cast<Impl *>(this)->setMaxThreadsImpl(maxThreads);
+}
+
+template <typename Impl>
+size_t WorkerThreadPoolBase<Impl>::getMaxThreads() const
+{
+    return static_cast<const Impl *>(this)->getMaxThreadsImpl();
+}
+
 class SingleThreadedWorkerPool : public WorkerThreadPoolBase<SingleThreadedWorkerPool>
 {
   public:
@@ -256,6 +287,11 @@ class SingleThreadedWorkerPool : public WorkerThreadPoolBase<SingleThreadedWorke
     ~SingleThreadedWorkerPool();
 
     SingleThreadedWaitableEvent postWorkerTaskImpl(Closure *task);
+    void setMaxThreadsImpl(size_t maxThreads);
+    size_t getMaxThreadsImpl() const;
+
+  private:
+    size_t mMaxThreads;
 };
 
 #if (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
@@ -266,6 +302,18 @@ class AsyncWorkerPool : public WorkerThreadPoolBase<AsyncWorkerPool>
     ~AsyncWorkerPool();
 
     AsyncWaitableEvent postWorkerTaskImpl(Closure *task);
+    void setMaxThreadsImpl(size_t maxThreads);
+    size_t getMaxThreadsImpl() const;
+
+  private:
+    void runTask(Closure *task);
+
+    mutable std::mutex mMutex;
+    std::condition_variable mCondition;
+    size_t mMaxThreads;
+    size_t mRunningTasks;
+    // Tasks that have been posted and not finished, including the ones waiting for a thread.
+    size_t mPendingTasks;
 };
 #endif  // (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
 
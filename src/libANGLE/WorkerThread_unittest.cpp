@@ -7,6 +7,9 @@
 //   Simple tests for the worker thread class.
 
 #include <array>
+#include <atomic>
+#include <chrono>
+#include <thread>
 #include <gtest/gtest.h>
 
 #include "libANGLE/WorkerThread.h"
@@ -56,4 +59,94 @@ TYPED_TEST(WorkerPoolTest, SimpleTask)
     }
 }
 
+// Tests that an event is ready once its task has finished.
+TYPED_TEST(WorkerPoolTest, IsReady)
+{
+    class TestTask : public Closure
+    {
+      public:
+        void operator()() override { fired = true; }
+
+        bool fired = false;
+    };
+
+    TestTask task;
+    typename TypeParam::WaitableEventType waitable = this->workerPool.postWorkerTask(&task);
+
+    waitable.wait();
+    EXPECT_TRUE(task.fired);
+    EXPECT_TRUE(waitable.isReady());
+}
+
+// Tests that the pool never runs more tasks at once than its thread limit.
+TYPED_TEST(WorkerPoolTest, MaxThreadsLimitsConcurrency)
+{
+    class TestTask : public Closure
+    {
+      public:
+        void operator()() override
+        {
+            size_t running = ++(*runningTasks);
+            size_t peak    = peakTasks->load();
+            while (running > peak && !peakTasks->compare_exchange_weak(peak, running))
+            {
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            --(*runningTasks);
+            fired = true;
+        }
+
+        std::atomic<size_t> *runningTasks = nullptr;
+        std::atomic<size_t> *peakTasks    = nullptr;
+        bool fired                        = false;
+    };
+
+    for (size_t maxThreads : {1u, 2u})
+    {
+        this->workerPool.setMaxThreads(maxThreads);
+        EXPECT_EQ(maxThreads, this->workerPool.getMaxThreads());
+
+        std::atomic<size_t> runningTasks(0);
+        std::atomic<size_t> peakTasks(0);
+
+        std::array<TestTask, 8> tasks;
+        std::array<typename TypeParam::WaitableEventType, 8> waitables;
+        for (size_t index = 0; index < tasks.size(); ++index)
+        {
+            tasks[index].runningTasks = &runningTasks;
+            tasks[index].peakTasks    = &peakTasks;
+            waitables[index]          = this->workerPool.postWorkerTask(&tasks[index]);
+        }
+
+        TypeParam::WaitableEventType::WaitMany(&waitables);
+
+        EXPECT_LE(peakTasks.load(), maxThreads);
+        for (const auto &task : tasks)
+        {
+            EXPECT_TRUE(task.fired);
+        }
+    }
+}
+
+// Tests that a thread limit of zero runs tasks on the posting thread.
+TYPED_TEST(WorkerPoolTest, ZeroMaxThreadsRunsInline)
+{
+    class TestTask : public Closure
+    {
+      public:
+        void operator()() override { threadId = std::this_thread::get_id(); }
+
+        std::thread::id threadId;
+    };
+
+    this->workerPool.setMaxThreads(0);
+    EXPECT_EQ(0u, this->workerPool.getMaxThreads());
+
+    TestTask task;
+    typename TypeParam::WaitableEventType waitable = this->workerPool.postWorkerTask(&task);
+
+    EXPECT_TRUE(waitable.isReady());
+    EXPECT_EQ(std::this_thread::get_id(), task.threadId);
+}
+
 }  // anonymous namespace
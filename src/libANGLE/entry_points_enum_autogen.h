@@ -387,6 +387,7 @@ enum class EntryPoint
     MatrixLoadIdentityCHROMIUM,
     MatrixLoadfCHROMIUM,
     MatrixMode,
+    MaxShaderCompilerThreadsKHR,
     MemoryBarrier,
     MemoryBarrierByRegion,
     MultMatrixf,
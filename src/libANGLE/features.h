@@ -53,13 +53,9 @@
 #endif
 
 // Controls if our threading code uses std::async or falls back to single-threaded operations.
-// TODO(jmadill): Enable on Linux once STL chrono headers are updated.
+// Builds with an STL whose std::future::wait_for is broken can define this to ANGLE_DISABLED.
 #if !defined(ANGLE_STD_ASYNC_WORKERS)
-#if defined(ANGLE_PLATFORM_WINDOWS)
 #define ANGLE_STD_ASYNC_WORKERS ANGLE_ENABLED
-#else
-#define ANGLE_STD_ASYNC_WORKERS ANGLE_DISABLED
-#endif  // defined(ANGLE_PLATFORM_WINDOWS)
 #endif  // !defined(ANGLE_STD_ASYNC_WORKERS)
 
 #endif // LIBANGLE_FEATURES_H_
@@ -50,9 +50,36 @@ const Type &GetTypeInfo(GLenum type);
 // members.
 struct InternalFormat
 {
+    typedef bool (*SupportCheckFunction)(const Version &, const Extensions &);
+
     InternalFormat();
     InternalFormat(const InternalFormat &other);
 
+    // Used by the generated table of formats, see internal_format_table_autogen.h.
+    constexpr InternalFormat(GLenum internalFormat_,
+                             bool sized_,
+                             GLenum sizedInternalFormat_,
+                             GLuint redBits_,
+                             GLuint greenBits_,
+                             GLuint blueBits_,
+                             GLuint luminanceBits_,
+                             GLuint alphaBits_,
+                             GLuint sharedBits_,
+                             GLuint depthBits_,
+                             GLuint stencilBits_,
+                             GLuint pixelBytes_,
+                             GLuint componentCount_,
+                             bool compressed_,
+                             GLuint compressedBlockWidth_,
+                             GLuint compressedBlockHeight_,
+                             GLenum format_,
+                             GLenum type_,
+                             GLenum componentType_,
+                             GLenum colorEncoding_,
+                             SupportCheckFunction textureSupport_,
+                             SupportCheckFunction renderSupport_,
+                             SupportCheckFunction filterSupport_);
+
     GLuint computePixelBytes(GLenum formatType) const;
 
     ErrorOrResult<GLuint> computeRowPitch(GLenum formatType,
@@ -126,12 +153,60 @@ struct InternalFormat
     GLenum componentType;
     GLenum colorEncoding;
 
-    typedef bool (*SupportCheckFunction)(const Version &, const Extensions &);
     SupportCheckFunction textureSupport;
     SupportCheckFunction renderSupport;
     SupportCheckFunction filterSupport;
 };
 
+constexpr InternalFormat::InternalFormat(GLenum internalFormat_,
+                                         bool sized_,
+                                         GLenum sizedInternalFormat_,
+                                         GLuint redBits_,
+                                         GLuint greenBits_,
+                                         GLuint blueBits_,
+                                         GLuint luminanceBits_,
+                                         GLuint alphaBits_,
+                                         GLuint sharedBits_,
+                                         GLuint depthBits_,
+                                         GLuint stencilBits_,
+                                         GLuint pixelBytes_,
+                                         GLuint componentCount_,
+                                         bool compressed_,
+                                         GLuint compressedBlockWidth_,
+                                         GLuint compressedBlockHeight_,
+                                         GLenum format_,
+                                         GLenum type_,
+                                         GLenum componentType_,
+                                         GLenum colorEncoding_,
+                                         SupportCheckFunction textureSupport_,
+                                         SupportCheckFunction renderSupport_,
+                                         SupportCheckFunction filterSupport_)
+    : internalFormat(internalFormat_),
+      sized(sized_),
+      sizedInternalFormat(sizedInternalFormat_),
+      redBits(redBits_),
+      greenBits(greenBits_),
+      blueBits(blueBits_),
+      luminanceBits(luminanceBits_),
+      alphaBits(alphaBits_),
+      sharedBits(sharedBits_),
+      depthBits(depthBits_),
+      stencilBits(stencilBits_),
+      pixelBytes(pixelBytes_),
+      componentCount(componentCount_),
+      compressed(compressed_),
+      compressedBlockWidth(compressedBlockWidth_),
+      compressedBlockHeight(compressedBlockHeight_),
+      format(format_),
+      type(type_),
+      componentType(componentType_),
+      colorEncoding(colorEncoding_),
+      textureSupport(textureSupport_),
+      renderSupport(renderSupport_),
+      filterSupport(filterSupport_)
+{
+}
+
 // A "Format" wraps an InternalFormat struct, querying it from either a sized internal format or
 // unsized internal format and type.
 // TODO(geofflang): Remove this, it doesn't add any more information than the InternalFormat object.
@@ -0,0 +1,81 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// formatutils_unittest.cpp: Unit tests for the lookups in the generated table of internal formats.
+//
+
+#include "gtest/gtest.h"
+
+#include "libANGLE/formatutils.h"
+
+using namespace gl;
+
+namespace
+{
+
+// Every sized format is found by its internal format alone, whatever the type.
+TEST(InternalFormatTableTest, SizedFormats)
+{
+    const FormatSet &sizedFormats = GetAllSizedInternalFormats();
+    EXPECT_FALSE(sizedFormats.empty());
+
+    for (GLenum internalFormat : sizedFormats)
+    {
+        const InternalFormat &info = GetSizedInternalFormatInfo(internalFormat);
+        EXPECT_EQ(internalFormat, info.internalFormat);
+        EXPECT_TRUE(info.sized);
+        EXPECT_EQ(internalFormat, info.sizedInternalFormat);
+        EXPECT_TRUE(ValidES3InternalFormat(internalFormat));
+
+        EXPECT_EQ(&info, &GetInternalFormatInfo(internalFormat, info.type));
+        EXPECT_EQ(&info, &GetInternalFormatInfo(internalFormat, GL_NONE));
+        EXPECT_EQ(&info, &GetInternalFormatInfo(internalFormat, GL_FLOAT));
+    }
+}
+
+// Unsized formats are only found with one of their types, and point to their sized format.
+TEST(InternalFormatTableTest, UnsizedFormats)
+{
+    const InternalFormat &rgba = GetInternalFormatInfo(GL_RGBA, GL_UNSIGNED_BYTE);
+    EXPECT_EQ(static_cast<GLenum>(GL_RGBA), rgba.internalFormat);
+    EXPECT_FALSE(rgba.sized);
+    EXPECT_EQ(static_cast<GLenum>(GL_RGBA8), rgba.sizedInternalFormat);
+    EXPECT_EQ(static_cast<GLenum>(GL_UNSIGNED_BYTE), rgba.type);
+
+    const InternalFormat &rgbaHalfFloat = GetInternalFormatInfo(GL_RGBA, GL_HALF_FLOAT_OES);
+    EXPECT_EQ(static_cast<GLenum>(GL_HALF_FLOAT_OES), rgbaHalfFloat.type);
+    EXPECT_NE(&rgba, &rgbaHalfFloat);
+
+    // Aliased enums are matched by value.
+    EXPECT_EQ(static_cast<GLenum>(GL_SRGB8),
+              GetInternalFormatInfo(GL_SRGB_EXT, GL_UNSIGNED_BYTE).sizedInternalFormat);
+
+    EXPECT_EQ(static_cast<GLenum>(GL_NONE),
+              GetInternalFormatInfo(GL_RGBA, GL_UNSIGNED_INT_24_8).internalFormat);
+    EXPECT_EQ(static_cast<GLenum>(GL_NONE), GetSizedInternalFormatInfo(GL_RGBA).internalFormat);
+    EXPECT_TRUE(ValidES3InternalFormat(GL_RGBA));
+    EXPECT_TRUE(ValidES3InternalFormat(GL_LUMINANCE_ALPHA));
+}
+
+// Anything else is the invalid format.
+TEST(InternalFormatTableTest, InvalidFormats)
+{
+    // Includes keys that don't fit in the 16 bits used by the table.
+    const GLenum kInvalidFormats[] = {GL_NONE, GL_TEXTURE_2D, GL_UNSIGNED_BYTE, 0xFFFF, 0x10000,
+                                      0xFFFFFFFF};
+    for (GLenum internalFormat : kInvalidFormats)
+    {
+        const InternalFormat &sizedInfo = GetSizedInternalFormatInfo(internalFormat);
+        EXPECT_EQ(static_cast<GLenum>(GL_NONE), sizedInfo.internalFormat);
+        EXPECT_FALSE(sizedInfo.textureSupport(Version(3, 1), Extensions()));
+
+        const InternalFormat &info = GetInternalFormatInfo(internalFormat, GL_UNSIGNED_BYTE);
+        EXPECT_EQ(static_cast<GLenum>(GL_NONE), info.internalFormat);
+        EXPECT_EQ(static_cast<GLenum>(GL_NONE), info.colorEncoding);
+        EXPECT_FALSE(ValidES3InternalFormat(internalFormat));
+    }
+}
+
+}  // anonymous namespace
@@ -5,9 +5,12 @@
 #
 # gen_format_map.py:
 #  Code generation for GL format map. The format map matches between
-#  {format,type} and internal format.
+#  {format,type} and internal format. It also generates the table of the info of every internal
+#  format, indexed by perfect hashes.
 
 from datetime import date
+import random
+import re
 import sys
 
 sys.path.append('renderer')
@@ -184,3 +187,216 @@ with open('format_map_autogen.cpp', 'wt') as out_file:
         es3_type_cases = es3_type_cases,
         es3_combo_cases = es3_combo_cases)
     out_file.write(output_cpp)
+
+# The info of every internal format, in constexpr tables indexed by perfect hashes.
+
+template_internal_format_table_inl = """// GENERATED FILE - DO NOT EDIT.
+// Generated by {script_name} using data from {data_source_name}.
+// Sized formats of unsized internal formats from {format_map_source_name}.
+//
+// Copyright {copyright_year} The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// internal_format_table:
+//   The info of every internal format. Sized formats are found with a perfect hash of the internal
+//   format, and unsized formats with a perfect hash of the (internal format, type) pair. Included
+//   by formatutils.cpp, after the support functions the table refers to.
+
+namespace gl
+{{
+namespace
+{{
+
+// Entry 0 is the info of invalid formats. Empty hash slots point to it.
+constexpr InternalFormat kInternalFormatInfos[] = {{
+    // clang-format off
+{format_infos}
+    // clang-format on
+}};
+
+constexpr uint32_t HashInternalFormat(uint32_t key, uint32_t multiplier, uint32_t bits)
+{{
+    return (key * multiplier) >> (32u - bits);
+}}
+
+// Keyed by the internal format.
+constexpr uint32_t kSizedFormatHashMultiplier = {sized_multiplier}u;
+constexpr uint32_t kSizedFormatHashBits       = {sized_bits}u;
+constexpr {sized_slot_type} kSizedFormatSlots[{sized_slot_count}] = {{
+{sized_slots}
+}};
+
+// Keyed by (internal format << 16) | type.
+constexpr uint32_t kUnsizedFormatHashMultiplier = {unsized_multiplier}u;
+constexpr uint32_t kUnsizedFormatHashBits       = {unsized_bits}u;
+constexpr {unsized_slot_type} kUnsizedFormatSlots[{unsized_slot_count}] = {{
+{unsized_slots}
+}};
+
+}}  // anonymous namespace
+}}  // namespace gl
+"""
+
+template_internal_format_info = (
+    "    {{{internalFormat}, {sized}, {sizedInternalFormat}, {red}, {green}, {blue}, {luminance}, "
+    "{alpha}, {shared}, {depth}, {stencil}, {pixelBytes}, {componentCount}, {compressed}, "
+    "{blockWidth}, {blockHeight}, {format}, {type}, {componentType}, {colorEncoding}, "
+    "{textureSupport}, {renderSupport}, {filterSupport}}},")
+
+# The hash tables are indexed by GLenum values, which are read from the headers.
+gl_enum_headers = [
+    '../../include/GLES2/gl2.h',
+    '../../include/GLES2/gl2ext.h',
+    '../../include/GLES2/gl2ext_angle.h',
+    '../../include/GLES3/gl3.h',
+    '../../include/GLES3/gl31.h',
+    '../../include/GLES3/gl32.h',
+    '../common/angleutils.h',
+]
+
+def load_gl_enum_values():
+    values = {}
+    define_re = re.compile(r'^#define\s+(GL_\w+)\s+(0x[0-9a-fA-F]+|[0-9]+)\s*$')
+    for header in gl_enum_headers:
+        with open(header) as header_file:
+            for line in header_file:
+                match = define_re.match(line)
+                if match:
+                    values[match.group(1)] = int(match.group(2), 0)
+    return values
+
+def make_internal_format_info(kind, row):
+    info = {
+        'sized': False, 'sizedInternalFormat': 'GL_NONE', 'red': 0, 'green': 0, 'blue': 0,
+        'luminance': 0, 'alpha': 0, 'shared': 0, 'depth': 0, 'stencil': 0, 'compressed': False,
+        'blockWidth': 0, 'blockHeight': 0, 'srgb': False,
+    }
+    info.update(dict(zip(internal_format_data['columns'][kind], row)))
+
+    if kind == 'compressed':
+        info['sized'] = True
+        info['compressed'] = True
+        info['componentType'] = 'GL_UNSIGNED_NORMALIZED'
+        info['pixelBytes'] = info['blockSizeBits'] // 8
+    else:
+        bits = [info['red'], info['green'], info['blue'], info['luminance'], info['alpha'],
+                info['depth'], info['stencil']]
+        info['componentCount'] = len([bit for bit in bits if bit > 0])
+        info['pixelBytes'] = (sum(bits) + info['shared'] + info.get('unused', 0)) // 8
+
+    if info['sized']:
+        info['sizedInternalFormat'] = info['internalFormat']
+    else:
+        # Enum aliases such as GL_SRGB and GL_SRGB_EXT are matched by value.
+        key = (gl_enum_values[info['internalFormat']], gl_enum_values[info['type']])
+        info['sizedInternalFormat'] = sized_format_by_value.get(key, 'GL_NONE')
+
+    info['colorEncoding'] = 'GL_SRGB' if info['srgb'] else 'GL_LINEAR'
+    return info
+
+def format_bool(value):
+    return 'true' if value else 'false'
+
+# Finds a multiplier for which no two keys share a slot, with as few slots as possible.
+def find_perfect_hash(keys):
+    rng = random.Random(0)
+    for bits in range(6, 17):
+        if (1 << bits) < len(keys) * 4:
+            continue
+        for attempt in range(20000):
+            multiplier = rng.getrandbits(32) | 1
+            slots = set()
+            for key in keys:
+                slot = ((key * multiplier) & 0xFFFFFFFF) >> (32 - bits)
+                if slot in slots:
+                    break
+                slots.add(slot)
+            else:
+                return multiplier, bits
+    raise Exception('No perfect hash found')
+
+def format_slots(keys, indices, multiplier, bits):
+    slots = [0] * (1 << bits)
+    for key, index in zip(keys, indices):
+        slots[((key * multiplier) & 0xFFFFFFFF) >> (32 - bits)] = index
+    lines = []
+    for start in range(0, len(slots), 16):
+        lines.append('    ' + ' '.join('%d,' % slot for slot in slots[start:start + 16]))
+    return '\n'.join(lines)
+
+def slot_type(count):
+    return 'uint8_t' if count < 256 else 'uint16_t'
+
+internal_format_data_file = 'internal_format_data.json'
+internal_format_data = angle_format.load_json(internal_format_data_file)
+gl_enum_values = load_gl_enum_values()
+
+sized_format_by_value = {}
+for format, type_map in format_map.iteritems():
+    for type, sized_format in type_map.iteritems():
+        sized_format_by_value[(gl_enum_values[format], gl_enum_values[type])] = sized_format
+
+internal_format_infos = []
+for group in internal_format_data['groups']:
+    for row in group['formats']:
+        internal_format_infos.append(make_internal_format_info(group['kind'], row))
+
+invalid_info = make_internal_format_info('rgba', [
+    'GL_NONE', False, 0, 0, 0, 0, 0, 'GL_NONE', 'GL_NONE', 'GL_NONE', False, 'NeverSupported',
+    'NeverSupported', 'NeverSupported'])
+invalid_info['colorEncoding'] = 'GL_NONE'
+
+sized_keys = []
+sized_indices = []
+unsized_keys = []
+unsized_indices = []
+for index, info in enumerate(internal_format_infos, 1):
+    internal_format = gl_enum_values[info['internalFormat']]
+    type = gl_enum_values[info['type']]
+    if internal_format > 0xFFFF or type > 0xFFFF:
+        raise Exception('Enum too large for the hash key: ' + info['internalFormat'])
+    if info['sized']:
+        if internal_format in sized_keys:
+            raise Exception('Sized format listed twice: ' + info['internalFormat'])
+        sized_keys.append(internal_format)
+        sized_indices.append(index)
+    else:
+        unsized_key = (internal_format << 16) | type
+        if unsized_key in unsized_keys:
+            raise Exception('Unsized format listed twice: ' + info['internalFormat'])
+        unsized_keys.append(unsized_key)
+        unsized_indices.append(index)
+
+for key in unsized_keys:
+    if (key >> 16) in sized_keys:
+        raise Exception('Format is both sized and unsized: 0x%X' % (key >> 16))
+
+format_infos = '\n'.join(
+    template_internal_format_info.format(**dict(info, sized = format_bool(info['sized']),
+                                                compressed = format_bool(info['compressed'])))
+    for info in [invalid_info] + internal_format_infos)
+
+sized_multiplier, sized_bits = find_perfect_hash(sized_keys)
+unsized_multiplier, unsized_bits = find_perfect_hash(unsized_keys)
+format_count = len(internal_format_infos) + 1
+
+with open('internal_format_table_autogen.inl', 'wt') as out_file:
+    output_inl = template_internal_format_table_inl.format(
+        script_name = sys.argv[0],
+        data_source_name = internal_format_data_file,
+        format_map_source_name = input_script,
+        copyright_year = date.today().year,
+        format_infos = format_infos,
+        sized_multiplier = '0x%08X' % sized_multiplier,
+        sized_bits = sized_bits,
+        sized_slot_type = slot_type(format_count),
+        sized_slot_count = 1 << sized_bits,
+        sized_slots = format_slots(sized_keys, sized_indices, sized_multiplier, sized_bits),
+        unsized_multiplier = '0x%08X' % unsized_multiplier,
+        unsized_bits = unsized_bits,
+        unsized_slot_type = slot_type(format_count),
+        unsized_slot_count = 1 << unsized_bits,
+        unsized_slots = format_slots(unsized_keys, unsized_indices, unsized_multiplier,
+                                     unsized_bits))
+    out_file.write(output_inl)
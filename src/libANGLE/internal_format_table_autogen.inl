@@ -0,0 +1,345 @@
+// GENERATED FILE - DO NOT EDIT.
+// Generated by gen_format_map.py using data from internal_format_data.json.
+// Sized formats of unsized internal formats from format_map_data.json.
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// internal_format_table:
+//   The info of every internal format. Sized formats are found with a perfect hash of the internal
+//   format, and unsized formats with a perfect hash of the (internal format, type) pair. Included
+//   by formatutils.cpp, after the support functions the table refers to.
+
+namespace gl
+{
+namespace
+{
+
+// Entry 0 is the info of invalid formats. Empty hash slots point to it.
+constexpr InternalFormat kInternalFormatInfos[] = {
+    // clang-format off
+    {GL_NONE, false, GL_NONE, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, false, 0, 0, GL_NONE, GL_NONE, GL_NONE, GL_NONE, NeverSupported, NeverSupported, NeverSupported},
+    {GL_R8, true, GL_R8, 8, 0, 0, 0, 0, 0, 0, 0, 1, 1, false, 0, 0, GL_RED, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireESOrExt<3, 0, &Extensions::textureRG>, RequireESOrExt<3, 0, &Extensions::textureRG>, AlwaysSupported},
+    {GL_R8_SNORM, true, GL_R8_SNORM, 8, 0, 0, 0, 0, 0, 0, 0, 1, 1, false, 0, 0, GL_RED, GL_BYTE, GL_SIGNED_NORMALIZED, GL_LINEAR, RequireES<3, 0>, NeverSupported, AlwaysSupported},
+    {GL_RG8, true, GL_RG8, 8, 8, 0, 0, 0, 0, 0, 0, 2, 2, false, 0, 0, GL_RG, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireESOrExt<3, 0, &Extensions::textureRG>, RequireESOrExt<3, 0, &Extensions::textureRG>, AlwaysSupported},
+    {GL_RG8_SNORM, true, GL_RG8_SNORM, 8, 8, 0, 0, 0, 0, 0, 0, 2, 2, false, 0, 0, GL_RG, GL_BYTE, GL_SIGNED_NORMALIZED, GL_LINEAR, RequireES<3, 0>, NeverSupported, AlwaysSupported},
+    {GL_RGB8, true, GL_RGB8, 8, 8, 8, 0, 0, 0, 0, 0, 3, 3, false, 0, 0, GL_RGB, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireESOrExt<3, 0, &Extensions::rgb8rgba8>, RequireESOrExt<3, 0, &Extensions::rgb8rgba8>, AlwaysSupported},
+    {GL_RGB8_SNORM, true, GL_RGB8_SNORM, 8, 8, 8, 0, 0, 0, 0, 0, 3, 3, false, 0, 0, GL_RGB, GL_BYTE, GL_SIGNED_NORMALIZED, GL_LINEAR, RequireES<3, 0>, NeverSupported, AlwaysSupported},
+    {GL_RGB565, true, GL_RGB565, 5, 6, 5, 0, 0, 0, 0, 0, 2, 3, false, 0, 0, GL_RGB, GL_UNSIGNED_SHORT_5_6_5, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireES<1, 0>, RequireES<1, 0>, AlwaysSupported},
+    {GL_RGBA4, true, GL_RGBA4, 4, 4, 4, 0, 4, 0, 0, 0, 2, 4, false, 0, 0, GL_RGBA, GL_UNSIGNED_SHORT_4_4_4_4, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireES<1, 0>, RequireES<1, 0>, AlwaysSupported},
+    {GL_RGB5_A1, true, GL_RGB5_A1, 5, 5, 5, 0, 1, 0, 0, 0, 2, 4, false, 0, 0, GL_RGBA, GL_UNSIGNED_SHORT_5_5_5_1, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireES<1, 0>, RequireES<1, 0>, AlwaysSupported},
+    {GL_RGBA8, true, GL_RGBA8, 8, 8, 8, 0, 8, 0, 0, 0, 4, 4, false, 0, 0, GL_RGBA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireESOrExt<3, 0, &Extensions::rgb8rgba8>, RequireESOrExt<3, 0, &Extensions::rgb8rgba8>, AlwaysSupported},
+    {GL_RGBA8_SNORM, true, GL_RGBA8_SNORM, 8, 8, 8, 0, 8, 0, 0, 0, 4, 4, false, 0, 0, GL_RGBA, GL_BYTE, GL_SIGNED_NORMALIZED, GL_LINEAR, RequireES<3, 0>, NeverSupported, AlwaysSupported},
+    {GL_RGB10_A2, true, GL_RGB10_A2, 10, 10, 10, 0, 2, 0, 0, 0, 4, 4, false, 0, 0, GL_RGBA, GL_UNSIGNED_INT_2_10_10_10_REV, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireES<3, 0>, RequireES<3, 0>, AlwaysSupported},
+    {GL_RGB10_A2UI, true, GL_RGB10_A2UI, 10, 10, 10, 0, 2, 0, 0, 0, 4, 4, false, 0, 0, GL_RGBA_INTEGER, GL_UNSIGNED_INT_2_10_10_10_REV, GL_UNSIGNED_INT, GL_LINEAR, RequireES<3, 0>, RequireES<3, 0>, NeverSupported},
+    {GL_SRGB8, true, GL_SRGB8, 8, 8, 8, 0, 0, 0, 0, 0, 3, 3, false, 0, 0, GL_RGB, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_SRGB, RequireESOrExt<3, 0, &Extensions::sRGB>, NeverSupported, AlwaysSupported},
+    {GL_SRGB8_ALPHA8, true, GL_SRGB8_ALPHA8, 8, 8, 8, 0, 8, 0, 0, 0, 4, 4, false, 0, 0, GL_RGBA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_SRGB, RequireESOrExt<3, 0, &Extensions::sRGB>, RequireESOrExt<3, 0, &Extensions::sRGB>, AlwaysSupported},
+    {GL_RGB9_E5, true, GL_RGB9_E5, 9, 9, 9, 0, 0, 5, 0, 0, 4, 3, false, 0, 0, GL_RGB, GL_UNSIGNED_INT_5_9_9_9_REV, GL_FLOAT, GL_LINEAR, RequireES<3, 0>, NeverSupported, AlwaysSupported},
+    {GL_R8I, true, GL_R8I, 8, 0, 0, 0, 0, 0, 0, 0, 1, 1, false, 0, 0, GL_RED_INTEGER, GL_BYTE, GL_INT, GL_LINEAR, RequireES<3, 0>, RequireES<3, 0>, NeverSupported},
+    {GL_R8UI, true, GL_R8UI, 8, 0, 0, 0, 0, 0, 0, 0, 1, 1, false, 0, 0, GL_RED_INTEGER, GL_UNSIGNED_BYTE, GL_UNSIGNED_INT, GL_LINEAR, RequireES<3, 0>, RequireES<3, 0>, NeverSupported},
+    {GL_R16I, true, GL_R16I, 16, 0, 0, 0, 0, 0, 0, 0, 2, 1, false, 0, 0, GL_RED_INTEGER, GL_SHORT, GL_INT, GL_LINEAR, RequireES<3, 0>, RequireES<3, 0>, NeverSupported},
+    {GL_R16UI, true, GL_R16UI, 16, 0, 0, 0, 0, 0, 0, 0, 2, 1, false, 0, 0, GL_RED_INTEGER, GL_UNSIGNED_SHORT, GL_UNSIGNED_INT, GL_LINEAR, RequireES<3, 0>, RequireES<3, 0>, NeverSupported},
+    {GL_R32I, true, GL_R32I, 32, 0, 0, 0, 0, 0, 0, 0, 4, 1, false, 0, 0, GL_RED_INTEGER, GL_INT, GL_INT, GL_LINEAR, RequireES<3, 0>, RequireES<3, 0>, NeverSupported},
+    {GL_R32UI, true, GL_R32UI, 32, 0, 0, 0, 0, 0, 0, 0, 4, 1, false, 0, 0, GL_RED_INTEGER, GL_UNSIGNED_INT, GL_UNSIGNED_INT, GL_LINEAR, RequireES<3, 0>, RequireES<3, 0>, NeverSupported},
+    {GL_RG8I, true, GL_RG8I, 8, 8, 0, 0, 0, 0, 0, 0, 2, 2, false, 0, 0, GL_RG_INTEGER, GL_BYTE, GL_INT, GL_LINEAR, RequireES<3, 0>, RequireES<3, 0>, NeverSupported},
+    {GL_RG8UI, true, GL_RG8UI, 8, 8, 0, 0, 0, 0, 0, 0, 2, 2, false, 0, 0, GL_RG_INTEGER, GL_UNSIGNED_BYTE, GL_UNSIGNED_INT, GL_LINEAR, RequireES<3, 0>, RequireES<3, 0>, NeverSupported},
+    {GL_RG16I, true, GL_RG16I, 16, 16, 0, 0, 0, 0, 0, 0, 4, 2, false, 0, 0, GL_RG_INTEGER, GL_SHORT, GL_INT, GL_LINEAR, RequireES<3, 0>, RequireES<3, 0>, NeverSupported},
+    {GL_RG16UI, true, GL_RG16UI, 16, 16, 0, 0, 0, 0, 0, 0, 4, 2, false, 0, 0, GL_RG_INTEGER, GL_UNSIGNED_SHORT, GL_UNSIGNED_INT, GL_LINEAR, RequireES<3, 0>, RequireES<3, 0>, NeverSupported},
+    {GL_RG32I, true, GL_RG32I, 32, 32, 0, 0, 0, 0, 0, 0, 8, 2, false, 0, 0, GL_RG_INTEGER, GL_INT, GL_INT, GL_LINEAR, RequireES<3, 0>, RequireES<3, 0>, NeverSupported},
+    {GL_R11F_G11F_B10F, true, GL_R11F_G11F_B10F, 11, 11, 10, 0, 0, 0, 0, 0, 4, 3, false, 0, 0, GL_RGB, GL_UNSIGNED_INT_10F_11F_11F_REV, GL_FLOAT, GL_LINEAR, RequireES<3, 0>, RequireExt<&Extensions::colorBufferFloat>, AlwaysSupported},
+    {GL_RG32UI, true, GL_RG32UI, 32, 32, 0, 0, 0, 0, 0, 0, 8, 2, false, 0, 0, GL_RG_INTEGER, GL_UNSIGNED_INT, GL_UNSIGNED_INT, GL_LINEAR, RequireES<3, 0>, RequireES<3, 0>, NeverSupported},
+    {GL_RGB8I, true, GL_RGB8I, 8, 8, 8, 0, 0, 0, 0, 0, 3, 3, false, 0, 0, GL_RGB_INTEGER, GL_BYTE, GL_INT, GL_LINEAR, RequireES<3, 0>, NeverSupported, NeverSupported},
+    {GL_RGB8UI, true, GL_RGB8UI, 8, 8, 8, 0, 0, 0, 0, 0, 3, 3, false, 0, 0, GL_RGB_INTEGER, GL_UNSIGNED_BYTE, GL_UNSIGNED_INT, GL_LINEAR, RequireES<3, 0>, NeverSupported, NeverSupported},
+    {GL_RGB16I, true, GL_RGB16I, 16, 16, 16, 0, 0, 0, 0, 0, 6, 3, false, 0, 0, GL_RGB_INTEGER, GL_SHORT, GL_INT, GL_LINEAR, RequireES<3, 0>, NeverSupported, NeverSupported},
+    {GL_RGB16UI, true, GL_RGB16UI, 16, 16, 16, 0, 0, 0, 0, 0, 6, 3, false, 0, 0, GL_RGB_INTEGER, GL_UNSIGNED_SHORT, GL_UNSIGNED_INT, GL_LINEAR, RequireES<3, 0>, NeverSupported, NeverSupported},
+    {GL_RGB32I, true, GL_RGB32I, 32, 32, 32, 0, 0, 0, 0, 0, 12, 3, false, 0, 0, GL_RGB_INTEGER, GL_INT, GL_INT, GL_LINEAR, RequireES<3, 0>, NeverSupported, NeverSupported},
+    {GL_RGB32UI, true, GL_RGB32UI, 32, 32, 32, 0, 0, 0, 0, 0, 12, 3, false, 0, 0, GL_RGB_INTEGER, GL_UNSIGNED_INT, GL_UNSIGNED_INT, GL_LINEAR, RequireES<3, 0>, NeverSupported, NeverSupported},
+    {GL_RGBA8I, true, GL_RGBA8I, 8, 8, 8, 0, 8, 0, 0, 0, 4, 4, false, 0, 0, GL_RGBA_INTEGER, GL_BYTE, GL_INT, GL_LINEAR, RequireES<3, 0>, RequireES<3, 0>, NeverSupported},
+    {GL_RGBA8UI, true, GL_RGBA8UI, 8, 8, 8, 0, 8, 0, 0, 0, 4, 4, false, 0, 0, GL_RGBA_INTEGER, GL_UNSIGNED_BYTE, GL_UNSIGNED_INT, GL_LINEAR, RequireES<3, 0>, RequireES<3, 0>, NeverSupported},
+    {GL_RGBA16I, true, GL_RGBA16I, 16, 16, 16, 0, 16, 0, 0, 0, 8, 4, false, 0, 0, GL_RGBA_INTEGER, GL_SHORT, GL_INT, GL_LINEAR, RequireES<3, 0>, RequireES<3, 0>, NeverSupported},
+    {GL_RGBA16UI, true, GL_RGBA16UI, 16, 16, 16, 0, 16, 0, 0, 0, 8, 4, false, 0, 0, GL_RGBA_INTEGER, GL_UNSIGNED_SHORT, GL_UNSIGNED_INT, GL_LINEAR, RequireES<3, 0>, RequireES<3, 0>, NeverSupported},
+    {GL_RGBA32I, true, GL_RGBA32I, 32, 32, 32, 0, 32, 0, 0, 0, 16, 4, false, 0, 0, GL_RGBA_INTEGER, GL_INT, GL_INT, GL_LINEAR, RequireES<3, 0>, RequireES<3, 0>, NeverSupported},
+    {GL_RGBA32UI, true, GL_RGBA32UI, 32, 32, 32, 0, 32, 0, 0, 0, 16, 4, false, 0, 0, GL_RGBA_INTEGER, GL_UNSIGNED_INT, GL_UNSIGNED_INT, GL_LINEAR, RequireES<3, 0>, RequireES<3, 0>, NeverSupported},
+    {GL_BGRA8_EXT, true, GL_BGRA8_EXT, 8, 8, 8, 0, 8, 0, 0, 0, 4, 4, false, 0, 0, GL_BGRA_EXT, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::textureFormatBGRA8888>, RequireExt<&Extensions::textureFormatBGRA8888>, AlwaysSupported},
+    {GL_BGRA4_ANGLEX, true, GL_BGRA4_ANGLEX, 4, 4, 4, 0, 4, 0, 0, 0, 2, 4, false, 0, 0, GL_BGRA_EXT, GL_UNSIGNED_SHORT_4_4_4_4_REV_EXT, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::textureFormatBGRA8888>, RequireExt<&Extensions::textureFormatBGRA8888>, AlwaysSupported},
+    {GL_BGR5_A1_ANGLEX, true, GL_BGR5_A1_ANGLEX, 5, 5, 5, 0, 1, 0, 0, 0, 2, 4, false, 0, 0, GL_BGRA_EXT, GL_UNSIGNED_SHORT_1_5_5_5_REV_EXT, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::textureFormatBGRA8888>, RequireExt<&Extensions::textureFormatBGRA8888>, AlwaysSupported},
+    {GL_BGRA8_SRGB_ANGLEX, true, GL_BGRA8_SRGB_ANGLEX, 8, 8, 8, 0, 8, 0, 0, 0, 4, 4, false, 0, 0, GL_BGRA_EXT, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_SRGB, NeverSupported, AlwaysSupported, AlwaysSupported},
+    {GL_BGR565_ANGLEX, true, GL_BGR565_ANGLEX, 5, 6, 5, 0, 1, 0, 0, 0, 2, 4, false, 0, 0, GL_BGRA_EXT, GL_UNSIGNED_SHORT_5_6_5, GL_UNSIGNED_NORMALIZED, GL_LINEAR, NeverSupported, NeverSupported, NeverSupported},
+    {GL_R16F, true, GL_R16F, 16, 0, 0, 0, 0, 0, 0, 0, 2, 1, false, 0, 0, GL_RED, GL_HALF_FLOAT, GL_FLOAT, GL_LINEAR, HalfFloatRGSupport, HalfFloatRGRenderableSupport, RequireESOrExt<3, 0, &Extensions::textureHalfFloatLinear>},
+    {GL_RG16F, true, GL_RG16F, 16, 16, 0, 0, 0, 0, 0, 0, 4, 2, false, 0, 0, GL_RG, GL_HALF_FLOAT, GL_FLOAT, GL_LINEAR, HalfFloatRGSupport, HalfFloatRGRenderableSupport, RequireESOrExt<3, 0, &Extensions::textureHalfFloatLinear>},
+    {GL_RGB16F, true, GL_RGB16F, 16, 16, 16, 0, 0, 0, 0, 0, 6, 3, false, 0, 0, GL_RGB, GL_HALF_FLOAT, GL_FLOAT, GL_LINEAR, HalfFloatSupport, HalfFloatRGBRenderableSupport, RequireESOrExt<3, 0, &Extensions::textureHalfFloatLinear>},
+    {GL_RGBA16F, true, GL_RGBA16F, 16, 16, 16, 0, 16, 0, 0, 0, 8, 4, false, 0, 0, GL_RGBA, GL_HALF_FLOAT, GL_FLOAT, GL_LINEAR, HalfFloatSupport, HalfFloatRGBARenderableSupport, RequireESOrExt<3, 0, &Extensions::textureHalfFloatLinear>},
+    {GL_R32F, true, GL_R32F, 32, 0, 0, 0, 0, 0, 0, 0, 4, 1, false, 0, 0, GL_RED, GL_FLOAT, GL_FLOAT, GL_LINEAR, FloatRGSupport, FloatRGRenderableSupport, RequireExt<&Extensions::textureFloatLinear>},
+    {GL_RG32F, true, GL_RG32F, 32, 32, 0, 0, 0, 0, 0, 0, 8, 2, false, 0, 0, GL_RG, GL_FLOAT, GL_FLOAT, GL_LINEAR, FloatRGSupport, FloatRGRenderableSupport, RequireExt<&Extensions::textureFloatLinear>},
+    {GL_RGB32F, true, GL_RGB32F, 32, 32, 32, 0, 0, 0, 0, 0, 12, 3, false, 0, 0, GL_RGB, GL_FLOAT, GL_FLOAT, GL_LINEAR, FloatSupport, FloatRGBRenderableSupport, RequireExt<&Extensions::textureFloatLinear>},
+    {GL_RGBA32F, true, GL_RGBA32F, 32, 32, 32, 0, 32, 0, 0, 0, 16, 4, false, 0, 0, GL_RGBA, GL_FLOAT, GL_FLOAT, GL_LINEAR, FloatSupport, FloatRGBARenderableSupport, RequireExt<&Extensions::textureFloatLinear>},
+    {GL_DEPTH_COMPONENT16, true, GL_DEPTH_COMPONENT16, 0, 0, 0, 0, 0, 0, 16, 0, 2, 1, false, 0, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_SHORT, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireES<1, 0>, RequireES<1, 0>, RequireESOrExt<3, 0, &Extensions::depthTextures>},
+    {GL_DEPTH_COMPONENT24, true, GL_DEPTH_COMPONENT24, 0, 0, 0, 0, 0, 0, 24, 0, 3, 1, false, 0, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireES<3, 0>, RequireES<3, 0>, RequireESOrExt<3, 0, &Extensions::depthTextures>},
+    {GL_DEPTH_COMPONENT32F, true, GL_DEPTH_COMPONENT32F, 0, 0, 0, 0, 0, 0, 32, 0, 4, 1, false, 0, 0, GL_DEPTH_COMPONENT, GL_FLOAT, GL_FLOAT, GL_LINEAR, RequireES<3, 0>, RequireES<3, 0>, RequireESOrExt<3, 0, &Extensions::depthTextures>},
+    {GL_DEPTH_COMPONENT32_OES, true, GL_DEPTH_COMPONENT32_OES, 0, 0, 0, 0, 0, 0, 32, 0, 4, 1, false, 0, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExtOrExt<&Extensions::depthTextures, &Extensions::depth32>, RequireExtOrExt<&Extensions::depthTextures, &Extensions::depth32>, AlwaysSupported},
+    {GL_DEPTH24_STENCIL8, true, GL_DEPTH24_STENCIL8, 0, 0, 0, 0, 0, 0, 24, 8, 4, 2, false, 0, 0, GL_DEPTH_STENCIL, GL_UNSIGNED_INT_24_8, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireESOrExt<3, 0, &Extensions::depthTextures>, RequireESOrExtOrExt<3, 0, &Extensions::depthTextures, &Extensions::packedDepthStencil>, AlwaysSupported},
+    {GL_DEPTH32F_STENCIL8, true, GL_DEPTH32F_STENCIL8, 0, 0, 0, 0, 0, 0, 32, 8, 8, 2, false, 0, 0, GL_DEPTH_STENCIL, GL_FLOAT_32_UNSIGNED_INT_24_8_REV, GL_FLOAT, GL_LINEAR, RequireES<3, 0>, RequireES<3, 0>, AlwaysSupported},
+    {GL_ALPHA8_EXT, true, GL_ALPHA8_EXT, 0, 0, 0, 0, 8, 0, 0, 0, 1, 1, false, 0, 0, GL_ALPHA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::textureStorage>, NeverSupported, AlwaysSupported},
+    {GL_LUMINANCE8_EXT, true, GL_LUMINANCE8_EXT, 0, 0, 0, 8, 0, 0, 0, 0, 1, 1, false, 0, 0, GL_LUMINANCE, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::textureStorage>, NeverSupported, AlwaysSupported},
+    {GL_LUMINANCE8_ALPHA8_EXT, true, GL_LUMINANCE8_ALPHA8_EXT, 0, 0, 0, 8, 8, 0, 0, 0, 2, 2, false, 0, 0, GL_LUMINANCE_ALPHA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::textureStorage>, NeverSupported, AlwaysSupported},
+    {GL_ALPHA16F_EXT, true, GL_ALPHA16F_EXT, 0, 0, 0, 0, 16, 0, 0, 0, 2, 1, false, 0, 0, GL_ALPHA, GL_HALF_FLOAT_OES, GL_FLOAT, GL_LINEAR, RequireExtAndExt<&Extensions::textureStorage, &Extensions::textureHalfFloat>, NeverSupported, RequireESOrExt<3, 0, &Extensions::textureHalfFloatLinear>},
+    {GL_LUMINANCE16F_EXT, true, GL_LUMINANCE16F_EXT, 0, 0, 0, 16, 0, 0, 0, 0, 2, 1, false, 0, 0, GL_LUMINANCE, GL_HALF_FLOAT_OES, GL_FLOAT, GL_LINEAR, RequireExtAndExt<&Extensions::textureStorage, &Extensions::textureHalfFloat>, NeverSupported, RequireESOrExt<3, 0, &Extensions::textureHalfFloatLinear>},
+    {GL_LUMINANCE_ALPHA16F_EXT, true, GL_LUMINANCE_ALPHA16F_EXT, 0, 0, 0, 16, 16, 0, 0, 0, 4, 2, false, 0, 0, GL_LUMINANCE_ALPHA, GL_HALF_FLOAT_OES, GL_FLOAT, GL_LINEAR, RequireExtAndExt<&Extensions::textureStorage, &Extensions::textureHalfFloat>, NeverSupported, RequireESOrExt<3, 0, &Extensions::textureHalfFloatLinear>},
+    {GL_ALPHA32F_EXT, true, GL_ALPHA32F_EXT, 0, 0, 0, 0, 32, 0, 0, 0, 4, 1, false, 0, 0, GL_ALPHA, GL_FLOAT, GL_FLOAT, GL_LINEAR, RequireExtAndExt<&Extensions::textureStorage, &Extensions::textureFloat>, NeverSupported, RequireExt<&Extensions::textureFloatLinear>},
+    {GL_LUMINANCE32F_EXT, true, GL_LUMINANCE32F_EXT, 0, 0, 0, 32, 0, 0, 0, 0, 4, 1, false, 0, 0, GL_LUMINANCE, GL_FLOAT, GL_FLOAT, GL_LINEAR, RequireExtAndExt<&Extensions::textureStorage, &Extensions::textureFloat>, NeverSupported, RequireExt<&Extensions::textureFloatLinear>},
+    {GL_LUMINANCE_ALPHA32F_EXT, true, GL_LUMINANCE_ALPHA32F_EXT, 0, 0, 0, 32, 32, 0, 0, 0, 8, 2, false, 0, 0, GL_LUMINANCE_ALPHA, GL_FLOAT, GL_FLOAT, GL_LINEAR, RequireExtAndExt<&Extensions::textureStorage, &Extensions::textureFloat>, NeverSupported, RequireExt<&Extensions::textureFloatLinear>},
+    {GL_COMPRESSED_R11_EAC, true, GL_COMPRESSED_R11_EAC, 0, 0, 0, 0, 0, 0, 0, 0, 8, 1, true, 4, 4, GL_RED, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireESOrExt<3, 0, &Extensions::compressedEACR11UnsignedTexture>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_SIGNED_R11_EAC, true, GL_COMPRESSED_SIGNED_R11_EAC, 0, 0, 0, 0, 0, 0, 0, 0, 8, 1, true, 4, 4, GL_RED, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireESOrExt<3, 0, &Extensions::compressedEACR11SignedTexture>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_RG11_EAC, true, GL_COMPRESSED_RG11_EAC, 0, 0, 0, 0, 0, 0, 0, 0, 16, 2, true, 4, 4, GL_RG, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireESOrExt<3, 0, &Extensions::compressedEACRG11UnsignedTexture>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_SIGNED_RG11_EAC, true, GL_COMPRESSED_SIGNED_RG11_EAC, 0, 0, 0, 0, 0, 0, 0, 0, 16, 2, true, 4, 4, GL_RG, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireESOrExt<3, 0, &Extensions::compressedEACRG11SignedTexture>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_RGB8_ETC2, true, GL_COMPRESSED_RGB8_ETC2, 0, 0, 0, 0, 0, 0, 0, 0, 8, 3, true, 4, 4, GL_RGB, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireESOrExt<3, 0, &Extensions::compressedETC2RGB8Texture>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_SRGB8_ETC2, true, GL_COMPRESSED_SRGB8_ETC2, 0, 0, 0, 0, 0, 0, 0, 0, 8, 3, true, 4, 4, GL_RGB, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_SRGB, RequireESOrExt<3, 0, &Extensions::compressedETC2sRGB8Texture>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2, true, GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2, 0, 0, 0, 0, 0, 0, 0, 0, 8, 3, true, 4, 4, GL_RGB, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireESOrExt<3, 0, &Extensions::compressedETC2PunchthroughARGB8Texture>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2, true, GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2, 0, 0, 0, 0, 0, 0, 0, 0, 8, 3, true, 4, 4, GL_RGB, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_SRGB, RequireESOrExt<3, 0, &Extensions::compressedETC2PunchthroughAsRGB8AlphaTexture>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_RGBA8_ETC2_EAC, true, GL_COMPRESSED_RGBA8_ETC2_EAC, 0, 0, 0, 0, 0, 0, 0, 0, 16, 4, true, 4, 4, GL_RGBA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireESOrExt<3, 0, &Extensions::compressedETC2RGBA8Texture>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC, true, GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC, 0, 0, 0, 0, 0, 0, 0, 0, 16, 4, true, 4, 4, GL_RGBA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_SRGB, RequireESOrExt<3, 0, &Extensions::compressedETC2sRGB8Alpha8Texture>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_RGB_S3TC_DXT1_EXT, true, GL_COMPRESSED_RGB_S3TC_DXT1_EXT, 0, 0, 0, 0, 0, 0, 0, 0, 8, 3, true, 4, 4, GL_RGB, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::textureCompressionDXT1>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_RGBA_S3TC_DXT1_EXT, true, GL_COMPRESSED_RGBA_S3TC_DXT1_EXT, 0, 0, 0, 0, 0, 0, 0, 0, 8, 4, true, 4, 4, GL_RGBA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::textureCompressionDXT1>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_RGBA_S3TC_DXT3_ANGLE, true, GL_COMPRESSED_RGBA_S3TC_DXT3_ANGLE, 0, 0, 0, 0, 0, 0, 0, 0, 16, 4, true, 4, 4, GL_RGBA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::textureCompressionDXT3>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_RGBA_S3TC_DXT5_ANGLE, true, GL_COMPRESSED_RGBA_S3TC_DXT5_ANGLE, 0, 0, 0, 0, 0, 0, 0, 0, 16, 4, true, 4, 4, GL_RGBA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::textureCompressionDXT5>, NeverSupported, AlwaysSupported},
+    {GL_ETC1_RGB8_OES, true, GL_ETC1_RGB8_OES, 0, 0, 0, 0, 0, 0, 0, 0, 8, 3, true, 4, 4, GL_RGB, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::compressedETC1RGB8Texture>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_SRGB_S3TC_DXT1_EXT, true, GL_COMPRESSED_SRGB_S3TC_DXT1_EXT, 0, 0, 0, 0, 0, 0, 0, 0, 8, 3, true, 4, 4, GL_RGB, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_SRGB, RequireExt<&Extensions::textureCompressionS3TCsRGB>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT, true, GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT, 0, 0, 0, 0, 0, 0, 0, 0, 8, 4, true, 4, 4, GL_RGBA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_SRGB, RequireExt<&Extensions::textureCompressionS3TCsRGB>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT, true, GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT, 0, 0, 0, 0, 0, 0, 0, 0, 16, 4, true, 4, 4, GL_RGBA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_SRGB, RequireExt<&Extensions::textureCompressionS3TCsRGB>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT, true, GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT, 0, 0, 0, 0, 0, 0, 0, 0, 16, 4, true, 4, 4, GL_RGBA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_SRGB, RequireExt<&Extensions::textureCompressionS3TCsRGB>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_RGBA_ASTC_4x4_KHR, true, GL_COMPRESSED_RGBA_ASTC_4x4_KHR, 0, 0, 0, 0, 0, 0, 0, 0, 16, 4, true, 4, 4, GL_RGBA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExtOrExt<&Extensions::textureCompressionASTCHDR, &Extensions::textureCompressionASTCLDR>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_RGBA_ASTC_5x4_KHR, true, GL_COMPRESSED_RGBA_ASTC_5x4_KHR, 0, 0, 0, 0, 0, 0, 0, 0, 16, 4, true, 5, 4, GL_RGBA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExtOrExt<&Extensions::textureCompressionASTCHDR, &Extensions::textureCompressionASTCLDR>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_RGBA_ASTC_5x5_KHR, true, GL_COMPRESSED_RGBA_ASTC_5x5_KHR, 0, 0, 0, 0, 0, 0, 0, 0, 16, 4, true, 5, 5, GL_RGBA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExtOrExt<&Extensions::textureCompressionASTCHDR, &Extensions::textureCompressionASTCLDR>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_RGBA_ASTC_6x5_KHR, true, GL_COMPRESSED_RGBA_ASTC_6x5_KHR, 0, 0, 0, 0, 0, 0, 0, 0, 16, 4, true, 6, 5, GL_RGBA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExtOrExt<&Extensions::textureCompressionASTCHDR, &Extensions::textureCompressionASTCLDR>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_RGBA_ASTC_6x6_KHR, true, GL_COMPRESSED_RGBA_ASTC_6x6_KHR, 0, 0, 0, 0, 0, 0, 0, 0, 16, 4, true, 6, 6, GL_RGBA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExtOrExt<&Extensions::textureCompressionASTCHDR, &Extensions::textureCompressionASTCLDR>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_RGBA_ASTC_8x5_KHR, true, GL_COMPRESSED_RGBA_ASTC_8x5_KHR, 0, 0, 0, 0, 0, 0, 0, 0, 16, 4, true, 8, 5, GL_RGBA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExtOrExt<&Extensions::textureCompressionASTCHDR, &Extensions::textureCompressionASTCLDR>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_RGBA_ASTC_8x6_KHR, true, GL_COMPRESSED_RGBA_ASTC_8x6_KHR, 0, 0, 0, 0, 0, 0, 0, 0, 16, 4, true, 8, 6, GL_RGBA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExtOrExt<&Extensions::textureCompressionASTCHDR, &Extensions::textureCompressionASTCLDR>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_RGBA_ASTC_8x8_KHR, true, GL_COMPRESSED_RGBA_ASTC_8x8_KHR, 0, 0, 0, 0, 0, 0, 0, 0, 16, 4, true, 8, 8, GL_RGBA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExtOrExt<&Extensions::textureCompressionASTCHDR, &Extensions::textureCompressionASTCLDR>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_RGBA_ASTC_10x5_KHR, true, GL_COMPRESSED_RGBA_ASTC_10x5_KHR, 0, 0, 0, 0, 0, 0, 0, 0, 16, 4, true, 10, 5, GL_RGBA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExtOrExt<&Extensions::textureCompressionASTCHDR, &Extensions::textureCompressionASTCLDR>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_RGBA_ASTC_10x6_KHR, true, GL_COMPRESSED_RGBA_ASTC_10x6_KHR, 0, 0, 0, 0, 0, 0, 0, 0, 16, 4, true, 10, 6, GL_RGBA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExtOrExt<&Extensions::textureCompressionASTCHDR, &Extensions::textureCompressionASTCLDR>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_RGBA_ASTC_10x8_KHR, true, GL_COMPRESSED_RGBA_ASTC_10x8_KHR, 0, 0, 0, 0, 0, 0, 0, 0, 16, 4, true, 10, 8, GL_RGBA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExtOrExt<&Extensions::textureCompressionASTCHDR, &Extensions::textureCompressionASTCLDR>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_RGBA_ASTC_10x10_KHR, true, GL_COMPRESSED_RGBA_ASTC_10x10_KHR, 0, 0, 0, 0, 0, 0, 0, 0, 16, 4, true, 10, 10, GL_RGBA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExtOrExt<&Extensions::textureCompressionASTCHDR, &Extensions::textureCompressionASTCLDR>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_RGBA_ASTC_12x10_KHR, true, GL_COMPRESSED_RGBA_ASTC_12x10_KHR, 0, 0, 0, 0, 0, 0, 0, 0, 16, 4, true, 12, 10, GL_RGBA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExtOrExt<&Extensions::textureCompressionASTCHDR, &Extensions::textureCompressionASTCLDR>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_RGBA_ASTC_12x12_KHR, true, GL_COMPRESSED_RGBA_ASTC_12x12_KHR, 0, 0, 0, 0, 0, 0, 0, 0, 16, 4, true, 12, 12, GL_RGBA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExtOrExt<&Extensions::textureCompressionASTCHDR, &Extensions::textureCompressionASTCLDR>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_SRGB8_ALPHA8_ASTC_4x4_KHR, true, GL_COMPRESSED_SRGB8_ALPHA8_ASTC_4x4_KHR, 0, 0, 0, 0, 0, 0, 0, 0, 16, 4, true, 4, 4, GL_RGBA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_SRGB, RequireExtOrExt<&Extensions::textureCompressionASTCHDR, &Extensions::textureCompressionASTCLDR>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_SRGB8_ALPHA8_ASTC_5x4_KHR, true, GL_COMPRESSED_SRGB8_ALPHA8_ASTC_5x4_KHR, 0, 0, 0, 0, 0, 0, 0, 0, 16, 4, true, 5, 4, GL_RGBA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_SRGB, RequireExtOrExt<&Extensions::textureCompressionASTCHDR, &Extensions::textureCompressionASTCLDR>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_SRGB8_ALPHA8_ASTC_5x5_KHR, true, GL_COMPRESSED_SRGB8_ALPHA8_ASTC_5x5_KHR, 0, 0, 0, 0, 0, 0, 0, 0, 16, 4, true, 5, 5, GL_RGBA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_SRGB, RequireExtOrExt<&Extensions::textureCompressionASTCHDR, &Extensions::textureCompressionASTCLDR>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_SRGB8_ALPHA8_ASTC_6x5_KHR, true, GL_COMPRESSED_SRGB8_ALPHA8_ASTC_6x5_KHR, 0, 0, 0, 0, 0, 0, 0, 0, 16, 4, true, 6, 5, GL_RGBA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_SRGB, RequireExtOrExt<&Extensions::textureCompressionASTCHDR, &Extensions::textureCompressionASTCLDR>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_SRGB8_ALPHA8_ASTC_6x6_KHR, true, GL_COMPRESSED_SRGB8_ALPHA8_ASTC_6x6_KHR, 0, 0, 0, 0, 0, 0, 0, 0, 16, 4, true, 6, 6, GL_RGBA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_SRGB, RequireExtOrExt<&Extensions::textureCompressionASTCHDR, &Extensions::textureCompressionASTCLDR>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x5_KHR, true, GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x5_KHR, 0, 0, 0, 0, 0, 0, 0, 0, 16, 4, true, 8, 5, GL_RGBA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_SRGB, RequireExtOrExt<&Extensions::textureCompressionASTCHDR, &Extensions::textureCompressionASTCLDR>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x6_KHR, true, GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x6_KHR, 0, 0, 0, 0, 0, 0, 0, 0, 16, 4, true, 8, 6, GL_RGBA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_SRGB, RequireExtOrExt<&Extensions::textureCompressionASTCHDR, &Extensions::textureCompressionASTCLDR>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x8_KHR, true, GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x8_KHR, 0, 0, 0, 0, 0, 0, 0, 0, 16, 4, true, 8, 8, GL_RGBA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_SRGB, RequireExtOrExt<&Extensions::textureCompressionASTCHDR, &Extensions::textureCompressionASTCLDR>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x5_KHR, true, GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x5_KHR, 0, 0, 0, 0, 0, 0, 0, 0, 16, 4, true, 10, 5, GL_RGBA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_SRGB, RequireExtOrExt<&Extensions::textureCompressionASTCHDR, &Extensions::textureCompressionASTCLDR>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x6_KHR, true, GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x6_KHR, 0, 0, 0, 0, 0, 0, 0, 0, 16, 4, true, 10, 6, GL_RGBA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_SRGB, RequireExtOrExt<&Extensions::textureCompressionASTCHDR, &Extensions::textureCompressionASTCLDR>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x8_KHR, true, GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x8_KHR, 0, 0, 0, 0, 0, 0, 0, 0, 16, 4, true, 10, 8, GL_RGBA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_SRGB, RequireExtOrExt<&Extensions::textureCompressionASTCHDR, &Extensions::textureCompressionASTCLDR>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x10_KHR, true, GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x10_KHR, 0, 0, 0, 0, 0, 0, 0, 0, 16, 4, true, 10, 10, GL_RGBA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_SRGB, RequireExtOrExt<&Extensions::textureCompressionASTCHDR, &Extensions::textureCompressionASTCLDR>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_SRGB8_ALPHA8_ASTC_12x10_KHR, true, GL_COMPRESSED_SRGB8_ALPHA8_ASTC_12x10_KHR, 0, 0, 0, 0, 0, 0, 0, 0, 16, 4, true, 12, 10, GL_RGBA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_SRGB, RequireExtOrExt<&Extensions::textureCompressionASTCHDR, &Extensions::textureCompressionASTCLDR>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_SRGB8_ALPHA8_ASTC_12x12_KHR, true, GL_COMPRESSED_SRGB8_ALPHA8_ASTC_12x12_KHR, 0, 0, 0, 0, 0, 0, 0, 0, 16, 4, true, 12, 12, GL_RGBA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_SRGB, RequireExtOrExt<&Extensions::textureCompressionASTCHDR, &Extensions::textureCompressionASTCLDR>, NeverSupported, AlwaysSupported},
+    {GL_STENCIL_INDEX8, true, GL_STENCIL_INDEX8, 0, 0, 0, 0, 0, 0, 0, 8, 1, 1, false, 0, 0, GL_STENCIL, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireES<1, 0>, RequireES<1, 0>, NeverSupported},
+    {GL_ETC1_RGB8_LOSSY_DECODE_ANGLE, true, GL_ETC1_RGB8_LOSSY_DECODE_ANGLE, 0, 0, 0, 0, 0, 0, 0, 0, 8, 3, true, 4, 4, GL_RGB, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::lossyETCDecode>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_RGB8_LOSSY_DECODE_ETC2_ANGLE, true, GL_COMPRESSED_RGB8_LOSSY_DECODE_ETC2_ANGLE, 0, 0, 0, 0, 0, 0, 0, 0, 8, 3, true, 4, 4, GL_RGB, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::lossyETCDecode>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_SRGB8_LOSSY_DECODE_ETC2_ANGLE, true, GL_COMPRESSED_SRGB8_LOSSY_DECODE_ETC2_ANGLE, 0, 0, 0, 0, 0, 0, 0, 0, 8, 3, true, 4, 4, GL_RGB, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_SRGB, RequireExt<&Extensions::lossyETCDecode>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE, true, GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE, 0, 0, 0, 0, 0, 0, 0, 0, 8, 3, true, 4, 4, GL_RGBA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::lossyETCDecode>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE, true, GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE, 0, 0, 0, 0, 0, 0, 0, 0, 8, 3, true, 4, 4, GL_RGBA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_SRGB, RequireExt<&Extensions::lossyETCDecode>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_R11_LOSSY_DECODE_EAC_ANGLE, true, GL_COMPRESSED_R11_LOSSY_DECODE_EAC_ANGLE, 0, 0, 0, 0, 0, 0, 0, 0, 8, 1, true, 4, 4, GL_RED, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::lossyETCDecode>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_SIGNED_R11_LOSSY_DECODE_EAC_ANGLE, true, GL_COMPRESSED_SIGNED_R11_LOSSY_DECODE_EAC_ANGLE, 0, 0, 0, 0, 0, 0, 0, 0, 8, 1, true, 4, 4, GL_RED, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::lossyETCDecode>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_RG11_LOSSY_DECODE_EAC_ANGLE, true, GL_COMPRESSED_RG11_LOSSY_DECODE_EAC_ANGLE, 0, 0, 0, 0, 0, 0, 0, 0, 16, 2, true, 4, 4, GL_RG, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::lossyETCDecode>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_SIGNED_RG11_LOSSY_DECODE_EAC_ANGLE, true, GL_COMPRESSED_SIGNED_RG11_LOSSY_DECODE_EAC_ANGLE, 0, 0, 0, 0, 0, 0, 0, 0, 16, 2, true, 4, 4, GL_RG, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::lossyETCDecode>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_RGBA8_LOSSY_DECODE_ETC2_EAC_ANGLE, true, GL_COMPRESSED_RGBA8_LOSSY_DECODE_ETC2_EAC_ANGLE, 0, 0, 0, 0, 0, 0, 0, 0, 16, 4, true, 4, 4, GL_RGBA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::lossyETCDecode>, NeverSupported, AlwaysSupported},
+    {GL_COMPRESSED_SRGB8_ALPHA8_LOSSY_DECODE_ETC2_EAC_ANGLE, true, GL_COMPRESSED_SRGB8_ALPHA8_LOSSY_DECODE_ETC2_EAC_ANGLE, 0, 0, 0, 0, 0, 0, 0, 0, 16, 4, true, 4, 4, GL_RGBA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_SRGB, RequireExt<&Extensions::lossyETCDecode>, NeverSupported, AlwaysSupported},
+    {GL_R16_EXT, true, GL_R16_EXT, 16, 0, 0, 0, 0, 0, 0, 0, 2, 1, false, 0, 0, GL_RED, GL_UNSIGNED_SHORT, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::textureNorm16>, RequireExt<&Extensions::textureNorm16>, AlwaysSupported},
+    {GL_R16_SNORM_EXT, true, GL_R16_SNORM_EXT, 16, 0, 0, 0, 0, 0, 0, 0, 2, 1, false, 0, 0, GL_RED, GL_SHORT, GL_SIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::textureNorm16>, NeverSupported, AlwaysSupported},
+    {GL_RG16_EXT, true, GL_RG16_EXT, 16, 16, 0, 0, 0, 0, 0, 0, 4, 2, false, 0, 0, GL_RG, GL_UNSIGNED_SHORT, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::textureNorm16>, RequireExt<&Extensions::textureNorm16>, AlwaysSupported},
+    {GL_RG16_SNORM_EXT, true, GL_RG16_SNORM_EXT, 16, 16, 0, 0, 0, 0, 0, 0, 4, 2, false, 0, 0, GL_RG, GL_SHORT, GL_SIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::textureNorm16>, NeverSupported, AlwaysSupported},
+    {GL_RGB16_EXT, true, GL_RGB16_EXT, 16, 16, 16, 0, 0, 0, 0, 0, 6, 3, false, 0, 0, GL_RGB, GL_UNSIGNED_SHORT, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::textureNorm16>, NeverSupported, AlwaysSupported},
+    {GL_RGB16_SNORM_EXT, true, GL_RGB16_SNORM_EXT, 16, 16, 16, 0, 0, 0, 0, 0, 6, 3, false, 0, 0, GL_RGB, GL_SHORT, GL_SIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::textureNorm16>, NeverSupported, AlwaysSupported},
+    {GL_RGBA16_EXT, true, GL_RGBA16_EXT, 16, 16, 16, 0, 16, 0, 0, 0, 8, 4, false, 0, 0, GL_RGBA, GL_UNSIGNED_SHORT, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::textureNorm16>, RequireExt<&Extensions::textureNorm16>, AlwaysSupported},
+    {GL_RGBA16_SNORM_EXT, true, GL_RGBA16_SNORM_EXT, 16, 16, 16, 0, 16, 0, 0, 0, 8, 4, false, 0, 0, GL_RGBA, GL_SHORT, GL_SIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::textureNorm16>, NeverSupported, AlwaysSupported},
+    {GL_RED, false, GL_R8, 8, 0, 0, 0, 0, 0, 0, 0, 1, 1, false, 0, 0, GL_RED, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::textureRG>, AlwaysSupported, AlwaysSupported},
+    {GL_RED, false, GL_R8_SNORM, 8, 0, 0, 0, 0, 0, 0, 0, 1, 1, false, 0, 0, GL_RED, GL_BYTE, GL_SIGNED_NORMALIZED, GL_LINEAR, NeverSupported, NeverSupported, NeverSupported},
+    {GL_RG, false, GL_RG8, 8, 8, 0, 0, 0, 0, 0, 0, 2, 2, false, 0, 0, GL_RG, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::textureRG>, AlwaysSupported, AlwaysSupported},
+    {GL_RG, false, GL_RG8_SNORM, 8, 8, 0, 0, 0, 0, 0, 0, 2, 2, false, 0, 0, GL_RG, GL_BYTE, GL_SIGNED_NORMALIZED, GL_LINEAR, NeverSupported, NeverSupported, NeverSupported},
+    {GL_RGB, false, GL_RGB8, 8, 8, 8, 0, 0, 0, 0, 0, 3, 3, false, 0, 0, GL_RGB, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireES<1, 0>, AlwaysSupported, AlwaysSupported},
+    {GL_RGB, false, GL_RGB565, 5, 6, 5, 0, 0, 0, 0, 0, 2, 3, false, 0, 0, GL_RGB, GL_UNSIGNED_SHORT_5_6_5, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireES<1, 0>, RequireES<1, 0>, AlwaysSupported},
+    {GL_RGB, false, GL_RGB8_SNORM, 8, 8, 8, 0, 0, 0, 0, 0, 3, 3, false, 0, 0, GL_RGB, GL_BYTE, GL_SIGNED_NORMALIZED, GL_LINEAR, NeverSupported, NeverSupported, NeverSupported},
+    {GL_RGBA, false, GL_RGBA4, 4, 4, 4, 0, 4, 0, 0, 0, 2, 4, false, 0, 0, GL_RGBA, GL_UNSIGNED_SHORT_4_4_4_4, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireES<1, 0>, RequireES<1, 0>, AlwaysSupported},
+    {GL_RGBA, false, GL_RGB5_A1, 5, 5, 5, 0, 1, 0, 0, 0, 2, 4, false, 0, 0, GL_RGBA, GL_UNSIGNED_SHORT_5_5_5_1, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireES<1, 0>, RequireES<1, 0>, AlwaysSupported},
+    {GL_RGBA, false, GL_RGBA8, 8, 8, 8, 0, 8, 0, 0, 0, 4, 4, false, 0, 0, GL_RGBA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireES<1, 0>, RequireES<1, 0>, AlwaysSupported},
+    {GL_RGBA, false, GL_RGB10_A2, 10, 10, 10, 0, 2, 0, 0, 0, 4, 4, false, 0, 0, GL_RGBA, GL_UNSIGNED_INT_2_10_10_10_REV, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireES<1, 0>, RequireES<1, 0>, AlwaysSupported},
+    {GL_RGBA, false, GL_RGBA8_SNORM, 8, 8, 8, 0, 8, 0, 0, 0, 4, 4, false, 0, 0, GL_RGBA, GL_BYTE, GL_SIGNED_NORMALIZED, GL_LINEAR, NeverSupported, NeverSupported, NeverSupported},
+    {GL_SRGB, false, GL_SRGB8, 8, 8, 8, 0, 0, 0, 0, 0, 3, 3, false, 0, 0, GL_SRGB, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_SRGB, RequireExt<&Extensions::sRGB>, NeverSupported, AlwaysSupported},
+    {GL_SRGB_ALPHA_EXT, false, GL_SRGB8_ALPHA8, 8, 8, 8, 0, 8, 0, 0, 0, 4, 4, false, 0, 0, GL_SRGB_ALPHA_EXT, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_SRGB, RequireExt<&Extensions::sRGB>, RequireExt<&Extensions::sRGB>, AlwaysSupported},
+    {GL_BGRA_EXT, false, GL_BGRA8_EXT, 8, 8, 8, 0, 8, 0, 0, 0, 4, 4, false, 0, 0, GL_BGRA_EXT, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireExt<&Extensions::textureFormatBGRA8888>, RequireExt<&Extensions::textureFormatBGRA8888>, AlwaysSupported},
+    {GL_RED_INTEGER, false, GL_R8I, 8, 0, 0, 0, 0, 0, 0, 0, 1, 1, false, 0, 0, GL_RED_INTEGER, GL_BYTE, GL_INT, GL_LINEAR, RequireES<3, 0>, NeverSupported, NeverSupported},
+    {GL_RED_INTEGER, false, GL_R8UI, 8, 0, 0, 0, 0, 0, 0, 0, 1, 1, false, 0, 0, GL_RED_INTEGER, GL_UNSIGNED_BYTE, GL_UNSIGNED_INT, GL_LINEAR, RequireES<3, 0>, NeverSupported, NeverSupported},
+    {GL_RED_INTEGER, false, GL_R16I, 16, 0, 0, 0, 0, 0, 0, 0, 2, 1, false, 0, 0, GL_RED_INTEGER, GL_SHORT, GL_INT, GL_LINEAR, RequireES<3, 0>, NeverSupported, NeverSupported},
+    {GL_RED_INTEGER, false, GL_R16UI, 16, 0, 0, 0, 0, 0, 0, 0, 2, 1, false, 0, 0, GL_RED_INTEGER, GL_UNSIGNED_SHORT, GL_UNSIGNED_INT, GL_LINEAR, RequireES<3, 0>, NeverSupported, NeverSupported},
+    {GL_RED_INTEGER, false, GL_R32I, 32, 0, 0, 0, 0, 0, 0, 0, 4, 1, false, 0, 0, GL_RED_INTEGER, GL_INT, GL_INT, GL_LINEAR, RequireES<3, 0>, NeverSupported, NeverSupported},
+    {GL_RED_INTEGER, false, GL_R32UI, 32, 0, 0, 0, 0, 0, 0, 0, 4, 1, false, 0, 0, GL_RED_INTEGER, GL_UNSIGNED_INT, GL_UNSIGNED_INT, GL_LINEAR, RequireES<3, 0>, NeverSupported, NeverSupported},
+    {GL_RG_INTEGER, false, GL_RG8I, 8, 8, 0, 0, 0, 0, 0, 0, 2, 2, false, 0, 0, GL_RG_INTEGER, GL_BYTE, GL_INT, GL_LINEAR, RequireES<3, 0>, NeverSupported, NeverSupported},
+    {GL_RG_INTEGER, false, GL_RG8UI, 8, 8, 0, 0, 0, 0, 0, 0, 2, 2, false, 0, 0, GL_RG_INTEGER, GL_UNSIGNED_BYTE, GL_UNSIGNED_INT, GL_LINEAR, RequireES<3, 0>, NeverSupported, NeverSupported},
+    {GL_RG_INTEGER, false, GL_RG16I, 16, 16, 0, 0, 0, 0, 0, 0, 4, 2, false, 0, 0, GL_RG_INTEGER, GL_SHORT, GL_INT, GL_LINEAR, RequireES<3, 0>, NeverSupported, NeverSupported},
+    {GL_RG_INTEGER, false, GL_RG16UI, 16, 16, 0, 0, 0, 0, 0, 0, 4, 2, false, 0, 0, GL_RG_INTEGER, GL_UNSIGNED_SHORT, GL_UNSIGNED_INT, GL_LINEAR, RequireES<3, 0>, NeverSupported, NeverSupported},
+    {GL_RG_INTEGER, false, GL_RG32I, 32, 32, 0, 0, 0, 0, 0, 0, 8, 2, false, 0, 0, GL_RG_INTEGER, GL_INT, GL_INT, GL_LINEAR, RequireES<3, 0>, NeverSupported, NeverSupported},
+    {GL_RG_INTEGER, false, GL_RG32UI, 32, 32, 0, 0, 0, 0, 0, 0, 8, 2, false, 0, 0, GL_RG_INTEGER, GL_UNSIGNED_INT, GL_UNSIGNED_INT, GL_LINEAR, RequireES<3, 0>, NeverSupported, NeverSupported},
+    {GL_RGB_INTEGER, false, GL_RGB8I, 8, 8, 8, 0, 0, 0, 0, 0, 3, 3, false, 0, 0, GL_RGB_INTEGER, GL_BYTE, GL_INT, GL_LINEAR, RequireES<3, 0>, NeverSupported, NeverSupported},
+    {GL_RGB_INTEGER, false, GL_RGB8UI, 8, 8, 8, 0, 0, 0, 0, 0, 3, 3, false, 0, 0, GL_RGB_INTEGER, GL_UNSIGNED_BYTE, GL_UNSIGNED_INT, GL_LINEAR, RequireES<3, 0>, NeverSupported, NeverSupported},
+    {GL_RGB_INTEGER, false, GL_RGB16I, 16, 16, 16, 0, 0, 0, 0, 0, 6, 3, false, 0, 0, GL_RGB_INTEGER, GL_SHORT, GL_INT, GL_LINEAR, RequireES<3, 0>, NeverSupported, NeverSupported},
+    {GL_RGB_INTEGER, false, GL_RGB16UI, 16, 16, 16, 0, 0, 0, 0, 0, 6, 3, false, 0, 0, GL_RGB_INTEGER, GL_UNSIGNED_SHORT, GL_UNSIGNED_INT, GL_LINEAR, RequireES<3, 0>, NeverSupported, NeverSupported},
+    {GL_RGB_INTEGER, false, GL_RGB32I, 32, 32, 32, 0, 0, 0, 0, 0, 12, 3, false, 0, 0, GL_RGB_INTEGER, GL_INT, GL_INT, GL_LINEAR, RequireES<3, 0>, NeverSupported, NeverSupported},
+    {GL_RGB_INTEGER, false, GL_RGB32UI, 32, 32, 32, 0, 0, 0, 0, 0, 12, 3, false, 0, 0, GL_RGB_INTEGER, GL_UNSIGNED_INT, GL_UNSIGNED_INT, GL_LINEAR, RequireES<3, 0>, NeverSupported, NeverSupported},
+    {GL_RGBA_INTEGER, false, GL_RGBA8I, 8, 8, 8, 0, 8, 0, 0, 0, 4, 4, false, 0, 0, GL_RGBA_INTEGER, GL_BYTE, GL_INT, GL_LINEAR, RequireES<3, 0>, NeverSupported, NeverSupported},
+    {GL_RGBA_INTEGER, false, GL_RGBA8UI, 8, 8, 8, 0, 8, 0, 0, 0, 4, 4, false, 0, 0, GL_RGBA_INTEGER, GL_UNSIGNED_BYTE, GL_UNSIGNED_INT, GL_LINEAR, RequireES<3, 0>, NeverSupported, NeverSupported},
+    {GL_RGBA_INTEGER, false, GL_RGBA16I, 16, 16, 16, 0, 16, 0, 0, 0, 8, 4, false, 0, 0, GL_RGBA_INTEGER, GL_SHORT, GL_INT, GL_LINEAR, RequireES<3, 0>, NeverSupported, NeverSupported},
+    {GL_RGBA_INTEGER, false, GL_RGBA16UI, 16, 16, 16, 0, 16, 0, 0, 0, 8, 4, false, 0, 0, GL_RGBA_INTEGER, GL_UNSIGNED_SHORT, GL_UNSIGNED_INT, GL_LINEAR, RequireES<3, 0>, NeverSupported, NeverSupported},
+    {GL_RGBA_INTEGER, false, GL_RGBA32I, 32, 32, 32, 0, 32, 0, 0, 0, 16, 4, false, 0, 0, GL_RGBA_INTEGER, GL_INT, GL_INT, GL_LINEAR, RequireES<3, 0>, NeverSupported, NeverSupported},
+    {GL_RGBA_INTEGER, false, GL_RGBA32UI, 32, 32, 32, 0, 32, 0, 0, 0, 16, 4, false, 0, 0, GL_RGBA_INTEGER, GL_UNSIGNED_INT, GL_UNSIGNED_INT, GL_LINEAR, RequireES<3, 0>, NeverSupported, NeverSupported},
+    {GL_RGBA_INTEGER, false, GL_RGB10_A2UI, 10, 10, 10, 0, 2, 0, 0, 0, 4, 4, false, 0, 0, GL_RGBA_INTEGER, GL_UNSIGNED_INT_2_10_10_10_REV, GL_UNSIGNED_INT, GL_LINEAR, RequireES<3, 0>, NeverSupported, NeverSupported},
+    {GL_RED, false, GL_R16F, 16, 0, 0, 0, 0, 0, 0, 0, 2, 1, false, 0, 0, GL_RED, GL_HALF_FLOAT, GL_FLOAT, GL_LINEAR, NeverSupported, NeverSupported, NeverSupported},
+    {GL_RG, false, GL_RG16F, 16, 16, 0, 0, 0, 0, 0, 0, 4, 2, false, 0, 0, GL_RG, GL_HALF_FLOAT, GL_FLOAT, GL_LINEAR, NeverSupported, NeverSupported, NeverSupported},
+    {GL_RGB, false, GL_RGB16F, 16, 16, 16, 0, 0, 0, 0, 0, 6, 3, false, 0, 0, GL_RGB, GL_HALF_FLOAT, GL_FLOAT, GL_LINEAR, NeverSupported, NeverSupported, NeverSupported},
+    {GL_RGBA, false, GL_RGBA16F, 16, 16, 16, 0, 16, 0, 0, 0, 8, 4, false, 0, 0, GL_RGBA, GL_HALF_FLOAT, GL_FLOAT, GL_LINEAR, NeverSupported, NeverSupported, NeverSupported},
+    {GL_RED, false, GL_R16F, 16, 0, 0, 0, 0, 0, 0, 0, 2, 1, false, 0, 0, GL_RED, GL_HALF_FLOAT_OES, GL_FLOAT, GL_LINEAR, UnsizedHalfFloatOESRGSupport, UnsizedHalfFloatOESRGRenderableSupport, RequireESOrExt<3, 0, &Extensions::textureHalfFloatLinear>},
+    {GL_RG, false, GL_RG16F, 16, 16, 0, 0, 0, 0, 0, 0, 4, 2, false, 0, 0, GL_RG, GL_HALF_FLOAT_OES, GL_FLOAT, GL_LINEAR, UnsizedHalfFloatOESRGSupport, UnsizedHalfFloatOESRGRenderableSupport, RequireESOrExt<3, 0, &Extensions::textureHalfFloatLinear>},
+    {GL_RGB, false, GL_RGB16F, 16, 16, 16, 0, 0, 0, 0, 0, 6, 3, false, 0, 0, GL_RGB, GL_HALF_FLOAT_OES, GL_FLOAT, GL_LINEAR, UnsizedHalfFloatOESSupport, UnsizedHalfFloatOESRenderableSupport, RequireESOrExt<3, 0, &Extensions::textureHalfFloatLinear>},
+    {GL_RGBA, false, GL_RGBA16F, 16, 16, 16, 0, 16, 0, 0, 0, 8, 4, false, 0, 0, GL_RGBA, GL_HALF_FLOAT_OES, GL_FLOAT, GL_LINEAR, UnsizedHalfFloatOESSupport, UnsizedHalfFloatOESRenderableSupport, RequireESOrExt<3, 0, &Extensions::textureHalfFloatLinear>},
+    {GL_RED, false, GL_R32F, 32, 0, 0, 0, 0, 0, 0, 0, 4, 1, false, 0, 0, GL_RED, GL_FLOAT, GL_FLOAT, GL_LINEAR, UnsizedFloatRGSupport, UnsizedFloatRGRenderableSupport, RequireExt<&Extensions::textureFloatLinear>},
+    {GL_RG, false, GL_RG32F, 32, 32, 0, 0, 0, 0, 0, 0, 8, 2, false, 0, 0, GL_RG, GL_FLOAT, GL_FLOAT, GL_LINEAR, UnsizedFloatRGSupport, UnsizedFloatRGRenderableSupport, RequireExt<&Extensions::textureFloatLinear>},
+    {GL_RGB, false, GL_RGB32F, 32, 32, 32, 0, 0, 0, 0, 0, 12, 3, false, 0, 0, GL_RGB, GL_FLOAT, GL_FLOAT, GL_LINEAR, UnsizedFloatSupport, UnsizedFloatRGBRenderableSupport, RequireExt<&Extensions::textureFloatLinear>},
+    {GL_RGB, false, GL_RGB9_E5, 9, 9, 9, 0, 0, 5, 0, 0, 4, 3, false, 0, 0, GL_RGB, GL_UNSIGNED_INT_5_9_9_9_REV, GL_FLOAT, GL_LINEAR, NeverSupported, NeverSupported, NeverSupported},
+    {GL_RGB, false, GL_R11F_G11F_B10F, 11, 11, 10, 0, 0, 0, 0, 0, 4, 3, false, 0, 0, GL_RGB, GL_UNSIGNED_INT_10F_11F_11F_REV, GL_FLOAT, GL_LINEAR, NeverSupported, NeverSupported, NeverSupported},
+    {GL_RGBA, false, GL_RGBA32F, 32, 32, 32, 0, 32, 0, 0, 0, 16, 4, false, 0, 0, GL_RGBA, GL_FLOAT, GL_FLOAT, GL_LINEAR, UnsizedFloatSupport, UnsizedFloatRGBARenderableSupport, RequireExt<&Extensions::textureFloatLinear>},
+    {GL_ALPHA, false, GL_ALPHA8_EXT, 0, 0, 0, 0, 8, 0, 0, 0, 1, 1, false, 0, 0, GL_ALPHA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireES<1, 0>, NeverSupported, AlwaysSupported},
+    {GL_LUMINANCE, false, GL_LUMINANCE8_EXT, 0, 0, 0, 8, 0, 0, 0, 0, 1, 1, false, 0, 0, GL_LUMINANCE, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireES<1, 0>, NeverSupported, AlwaysSupported},
+    {GL_LUMINANCE_ALPHA, false, GL_LUMINANCE8_ALPHA8_EXT, 0, 0, 0, 8, 8, 0, 0, 0, 2, 2, false, 0, 0, GL_LUMINANCE_ALPHA, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireES<1, 0>, NeverSupported, AlwaysSupported},
+    {GL_ALPHA, false, GL_ALPHA16F_EXT, 0, 0, 0, 0, 16, 0, 0, 0, 2, 1, false, 0, 0, GL_ALPHA, GL_HALF_FLOAT_OES, GL_FLOAT, GL_LINEAR, RequireExt<&Extensions::textureHalfFloat>, NeverSupported, RequireExt<&Extensions::textureHalfFloatLinear>},
+    {GL_LUMINANCE, false, GL_LUMINANCE16F_EXT, 0, 0, 0, 16, 0, 0, 0, 0, 2, 1, false, 0, 0, GL_LUMINANCE, GL_HALF_FLOAT_OES, GL_FLOAT, GL_LINEAR, RequireExt<&Extensions::textureHalfFloat>, NeverSupported, RequireExt<&Extensions::textureHalfFloatLinear>},
+    {GL_LUMINANCE_ALPHA, false, GL_LUMINANCE_ALPHA16F_EXT, 0, 0, 0, 16, 16, 0, 0, 0, 4, 2, false, 0, 0, GL_LUMINANCE_ALPHA, GL_HALF_FLOAT_OES, GL_FLOAT, GL_LINEAR, RequireExt<&Extensions::textureHalfFloat>, NeverSupported, RequireExt<&Extensions::textureHalfFloatLinear>},
+    {GL_ALPHA, false, GL_ALPHA32F_EXT, 0, 0, 0, 0, 32, 0, 0, 0, 4, 1, false, 0, 0, GL_ALPHA, GL_FLOAT, GL_FLOAT, GL_LINEAR, RequireExt<&Extensions::textureFloat>, NeverSupported, RequireExt<&Extensions::textureFloatLinear>},
+    {GL_LUMINANCE, false, GL_LUMINANCE32F_EXT, 0, 0, 0, 32, 0, 0, 0, 0, 4, 1, false, 0, 0, GL_LUMINANCE, GL_FLOAT, GL_FLOAT, GL_LINEAR, RequireExt<&Extensions::textureFloat>, NeverSupported, RequireExt<&Extensions::textureFloatLinear>},
+    {GL_LUMINANCE_ALPHA, false, GL_LUMINANCE_ALPHA32F_EXT, 0, 0, 0, 32, 32, 0, 0, 0, 8, 2, false, 0, 0, GL_LUMINANCE_ALPHA, GL_FLOAT, GL_FLOAT, GL_LINEAR, RequireExt<&Extensions::textureFloat>, NeverSupported, RequireExt<&Extensions::textureFloatLinear>},
+    {GL_DEPTH_COMPONENT, false, GL_DEPTH_COMPONENT16, 0, 0, 0, 0, 0, 0, 16, 0, 2, 1, false, 0, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_SHORT, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireES<1, 0>, RequireES<1, 0>, AlwaysSupported},
+    {GL_DEPTH_COMPONENT, false, GL_DEPTH_COMPONENT32_OES, 0, 0, 0, 0, 0, 0, 24, 0, 3, 1, false, 0, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireES<1, 0>, RequireES<1, 0>, AlwaysSupported},
+    {GL_DEPTH_COMPONENT, false, GL_DEPTH_COMPONENT32F, 0, 0, 0, 0, 0, 0, 32, 0, 4, 1, false, 0, 0, GL_DEPTH_COMPONENT, GL_FLOAT, GL_FLOAT, GL_LINEAR, RequireES<1, 0>, RequireES<1, 0>, AlwaysSupported},
+    {GL_DEPTH_STENCIL, false, GL_DEPTH24_STENCIL8, 0, 0, 0, 0, 0, 0, 24, 8, 4, 2, false, 0, 0, GL_DEPTH_STENCIL, GL_UNSIGNED_INT_24_8, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireESOrExt<3, 0, &Extensions::packedDepthStencil>, RequireESOrExt<3, 0, &Extensions::packedDepthStencil>, AlwaysSupported},
+    {GL_DEPTH_STENCIL, false, GL_DEPTH32F_STENCIL8, 0, 0, 0, 0, 0, 0, 32, 8, 8, 2, false, 0, 0, GL_DEPTH_STENCIL, GL_FLOAT_32_UNSIGNED_INT_24_8_REV, GL_FLOAT, GL_LINEAR, RequireESOrExt<3, 0, &Extensions::packedDepthStencil>, RequireESOrExt<3, 0, &Extensions::packedDepthStencil>, AlwaysSupported},
+    {GL_STENCIL, false, GL_STENCIL_INDEX8, 0, 0, 0, 0, 0, 0, 0, 8, 1, 1, false, 0, 0, GL_STENCIL, GL_UNSIGNED_BYTE, GL_UNSIGNED_NORMALIZED, GL_LINEAR, RequireES<1, 0>, RequireES<1, 0>, NeverSupported},
+    // clang-format on
+};
+
+constexpr uint32_t HashInternalFormat(uint32_t key, uint32_t multiplier, uint32_t bits)
+{
+    return (key * multiplier) >> (32u - bits);
+}
+
+// Keyed by the internal format.
+constexpr uint32_t kSizedFormatHashMultiplier = 0x247A8333u;
+constexpr uint32_t kSizedFormatHashBits       = 10u;
+constexpr uint8_t kSizedFormatSlots[1024] = {
+    0, 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    119, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 81, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 23, 0, 0, 52, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 0, 53, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 63, 0, 0, 0, 0, 0,
+    130, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 79, 0, 87, 72, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 111, 0, 0, 104, 0, 0, 0, 0, 0, 0, 0, 101, 0, 94,
+    0, 0, 0, 34, 0, 0, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 120, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 82, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 24, 0, 0, 17, 0, 129, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    67, 0, 0, 0, 135, 0, 0, 133, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 132, 0, 0, 0, 0, 0, 0, 0, 0, 0, 55, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 88, 73, 0, 0, 0, 14, 0, 0, 28, 0,
+    0, 0, 0, 0, 112, 0, 0, 105, 0, 0, 0, 0, 0, 0, 0, 102,
+    0, 95, 59, 0, 0, 0, 0, 0, 31, 42, 39, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 121, 0, 0, 118, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 83, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 25, 0, 0, 18, 0, 3, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    65, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46,
+    62, 0, 0, 134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 74, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 113, 0, 0, 106, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 96, 0, 0, 89, 0, 0, 0, 0, 0, 33, 0, 0, 41,
+    0, 0, 0, 0, 7, 0, 122, 0, 0, 123, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 19, 0, 131, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 66, 0, 68, 0, 0, 0, 57, 0, 0, 8, 0, 0, 0, 0,
+    0, 43, 0, 0, 0, 136, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0,
+    58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 75, 0, 0, 0, 15,
+    0, 0, 0, 0, 0, 0, 0, 0, 114, 0, 0, 107, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 97, 0, 0, 90, 0, 0, 0, 0, 0, 0, 0,
+    0, 35, 0, 0, 0, 0, 0, 0, 127, 0, 124, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 0, 0, 20, 0,
+    47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 69, 0, 0, 0, 60, 0, 9, 0, 0, 0,
+    0, 0, 0, 44, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 76, 0, 0,
+    0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 115, 0, 0, 108, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 98, 36, 0, 91, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 84, 0, 128, 13, 125, 0, 0, 0,
+    0, 0, 117, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 29, 0, 21,
+    0, 0, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 0, 10, 0,
+    0, 5, 0, 0, 0, 0, 0, 0, 0, 61, 0, 0, 6, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 77,
+    85, 70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 116, 0, 109, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 99, 30, 0, 92, 38, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 126, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 80,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 22, 0, 0, 48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 0, 0, 54, 0, 0,
+    12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 78, 86, 71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    110, 0, 0, 103, 0, 0, 0, 0, 0, 0, 0, 100, 0, 93, 0, 32,
+};
+
+// Keyed by (internal format << 16) | type.
+constexpr uint32_t kUnsizedFormatHashMultiplier = 0x37EBDCD9u;
+constexpr uint32_t kUnsizedFormatHashBits       = 9u;
+constexpr uint8_t kUnsizedFormatSlots[512] = {
+    0, 162, 0, 0, 0, 0, 191, 0, 0, 0, 0, 0, 0, 0, 0, 175,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 195, 0, 0, 179, 154,
+    0, 0, 0, 0, 0, 0, 164, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 197, 189, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 158, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 171,
+    0, 0, 0, 0, 144, 169, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 184, 0, 0, 0, 0, 0, 0, 0, 138, 0, 0, 0, 0, 0, 0,
+    0, 163, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 151,
+    0, 0, 150, 0, 0, 0, 0, 0, 140, 0, 0, 0, 0, 0, 155, 0,
+    0, 0, 0, 0, 0, 0, 165, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 183, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 159, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 172,
+    0, 0, 0, 0, 145, 0, 0, 0, 0, 0, 0, 0, 204, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 137, 0, 0, 0, 0, 0, 201,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 193, 194, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 139, 0, 0, 0, 0, 0, 156, 0,
+    0, 0, 0, 147, 0, 166, 0, 0, 185, 0, 148, 0, 0, 0, 149, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 142, 0, 199, 0, 0, 0,
+    0, 0, 160, 0, 0, 0, 0, 186, 0, 0, 0, 0, 0, 0, 0, 173,
+    0, 0, 0, 192, 0, 0, 0, 177, 0, 0, 0, 0, 0, 0, 0, 152,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 202, 0,
+    143, 0, 0, 0, 0, 0, 178, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 198, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 205, 157, 0,
+    0, 0, 0, 0, 0, 167, 0, 0, 0, 146, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 188, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 161, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 174,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 190, 0, 0, 0, 0, 0, 153,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    141, 181, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 196, 0, 0, 0, 180, 176, 203, 0, 0, 0, 0, 170,
+    182, 0, 0, 0, 0, 168, 0, 0, 0, 0, 0, 0, 0, 0, 0, 187,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 200,
+};
+
+}  // anonymous namespace
+}  // namespace gl
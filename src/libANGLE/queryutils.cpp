@@ -960,6 +960,9 @@ void QueryProgramiv(const Context *context, const Program *program, GLenum pname
 
     switch (pname)
     {
+        case GL_COMPLETION_STATUS_KHR:
+            *params = program->isLinkCompleted() ? GL_TRUE : GL_FALSE;
+            return;
         case GL_DELETE_STATUS:
             *params = program->isFlaggedForDeletion();
             return;
@@ -1118,6 +1121,9 @@ void QueryShaderiv(const Context *context, Shader *shader, GLenum pname, GLint *
         case GL_TRANSLATED_SHADER_SOURCE_LENGTH_ANGLE:
             *params = shader->getTranslatedSourceWithDebugInfoLength(context);
             return;
+        case GL_COMPLETION_STATUS_KHR:
+            *params = shader->isCompileCompleted() ? GL_TRUE : GL_FALSE;
+            return;
         default:
             UNREACHABLE();
             break;
@@ -61,6 +61,10 @@ enum class Format::ID
     BC2_RGBA_UNORM_SRGB_BLOCK,
     BC3_RGBA_UNORM_BLOCK,
     BC3_RGBA_UNORM_SRGB_BLOCK,
+    BC4_RED_SNORM_BLOCK,
+    BC4_RED_UNORM_BLOCK,
+    BC5_RG_SNORM_BLOCK,
+    BC5_RG_UNORM_BLOCK,
     D16_UNORM,
     D24_UNORM,
     D24_UNORM_S8_UINT,
@@ -147,6 +151,6 @@ enum class Format::ID
     S8_UINT
 };
 
-constexpr uint32_t kNumANGLEFormats = 133;
+constexpr uint32_t kNumANGLEFormats = 137;
 
 }  // namespace angle
@@ -73,6 +73,10 @@ constexpr Format g_formatInfoTable[] = {
     { Format::ID::BC2_RGBA_UNORM_SRGB_BLOCK, GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT, GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT, nullptr, NoCopyFunctions, nullptr, nullptr, GL_UNSIGNED_NORMALIZED, 0, 0, 0, 0, 0, 0, 0, true },
     { Format::ID::BC3_RGBA_UNORM_BLOCK, GL_COMPRESSED_RGBA_S3TC_DXT5_ANGLE, GL_COMPRESSED_RGBA_S3TC_DXT5_ANGLE, nullptr, NoCopyFunctions, nullptr, nullptr, GL_UNSIGNED_NORMALIZED, 0, 0, 0, 0, 0, 0, 0, true },
     { Format::ID::BC3_RGBA_UNORM_SRGB_BLOCK, GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT, GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT, nullptr, NoCopyFunctions, nullptr, nullptr, GL_UNSIGNED_NORMALIZED, 0, 0, 0, 0, 0, 0, 0, true },
+    { Format::ID::BC4_RED_SNORM_BLOCK, GL_COMPRESSED_SIGNED_R11_LOSSY_DECODE_EAC_ANGLE, GL_COMPRESSED_SIGNED_R11_LOSSY_DECODE_EAC_ANGLE, nullptr, NoCopyFunctions, nullptr, nullptr, GL_SIGNED_NORMALIZED, 0, 0, 0, 0, 0, 0, 0, true },
+    { Format::ID::BC4_RED_UNORM_BLOCK, GL_COMPRESSED_R11_LOSSY_DECODE_EAC_ANGLE, GL_COMPRESSED_R11_LOSSY_DECODE_EAC_ANGLE, nullptr, NoCopyFunctions, nullptr, nullptr, GL_UNSIGNED_NORMALIZED, 0, 0, 0, 0, 0, 0, 0, true },
+    { Format::ID::BC5_RG_SNORM_BLOCK, GL_COMPRESSED_SIGNED_RG11_LOSSY_DECODE_EAC_ANGLE, GL_COMPRESSED_SIGNED_RG11_LOSSY_DECODE_EAC_ANGLE, nullptr, NoCopyFunctions, nullptr, nullptr, GL_SIGNED_NORMALIZED, 0, 0, 0, 0, 0, 0, 0, true },
+    { Format::ID::BC5_RG_UNORM_BLOCK, GL_COMPRESSED_RG11_LOSSY_DECODE_EAC_ANGLE, GL_COMPRESSED_RG11_LOSSY_DECODE_EAC_ANGLE, nullptr, NoCopyFunctions, nullptr, nullptr, GL_UNSIGNED_NORMALIZED, 0, 0, 0, 0, 0, 0, 0, true },
     { Format::ID::D16_UNORM, GL_DEPTH_COMPONENT16, GL_DEPTH_COMPONENT16, nullptr, NoCopyFunctions, nullptr, nullptr, GL_UNSIGNED_NORMALIZED, 0, 0, 0, 0, 16, 0, 2, false },
     { Format::ID::D24_UNORM, GL_DEPTH_COMPONENT24, GL_DEPTH_COMPONENT24, nullptr, NoCopyFunctions, nullptr, nullptr, GL_UNSIGNED_NORMALIZED, 0, 0, 0, 0, 24, 0, 3, false },
     { Format::ID::D24_UNORM_S8_UINT, GL_DEPTH24_STENCIL8, GL_DEPTH24_STENCIL8, nullptr, NoCopyFunctions, nullptr, nullptr, GL_UNSIGNED_NORMALIZED, 0, 0, 0, 0, 24, 8, 4, false },
@@ -191,8 +195,12 @@ Format::ID Format::InternalFormatToID(GLenum internalFormat)
             return Format::ID::B8G8R8X8_UNORM;
         case GL_COMPRESSED_R11_EAC:
             return Format::ID::EAC_R11_UNORM_BLOCK;
+        case GL_COMPRESSED_R11_LOSSY_DECODE_EAC_ANGLE:
+            return Format::ID::BC4_RED_UNORM_BLOCK;
         case GL_COMPRESSED_RG11_EAC:
             return Format::ID::EAC_R11G11_UNORM_BLOCK;
+        case GL_COMPRESSED_RG11_LOSSY_DECODE_EAC_ANGLE:
+            return Format::ID::BC5_RG_UNORM_BLOCK;
         case GL_COMPRESSED_RGB8_ETC2:
             return Format::ID::ETC2_R8G8B8_UNORM_BLOCK;
         case GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2:
@@ -237,8 +245,12 @@ Format::ID Format::InternalFormatToID(GLenum internalFormat)
             return Format::ID::BC1_RGB_UNORM_BLOCK;
         case GL_COMPRESSED_SIGNED_R11_EAC:
             return Format::ID::EAC_R11_SNORM_BLOCK;
+        case GL_COMPRESSED_SIGNED_R11_LOSSY_DECODE_EAC_ANGLE:
+            return Format::ID::BC4_RED_SNORM_BLOCK;
         case GL_COMPRESSED_SIGNED_RG11_EAC:
             return Format::ID::EAC_R11G11_SNORM_BLOCK;
+        case GL_COMPRESSED_SIGNED_RG11_LOSSY_DECODE_EAC_ANGLE:
+            return Format::ID::BC5_RG_SNORM_BLOCK;
         case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x10_KHR:
             return Format::ID::ASTC_10x10_SRGB_BLOCK;
         case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x5_KHR:
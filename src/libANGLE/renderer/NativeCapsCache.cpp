@@ -0,0 +1,85 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// NativeCapsCache.cpp: Implements the rx::NativeCapsCache class.
+//
+
+#include "libANGLE/renderer/NativeCapsCache.h"
+
+#include "third_party/trace_event/trace_event.h"
+
+namespace rx
+{
+
+NativeCapsCache::NativeCapsCache() : mHitCount(0), mMissCount(0)
+{
+}
+
+NativeCapsCache::~NativeCapsCache()
+{
+}
+
+// static
+NativeCapsCache *NativeCapsCache::GetInstance()
+{
+    // Intentionally leaked, so that renderers destroyed during shutdown can still use it.
+    static NativeCapsCache *instance = new NativeCapsCache();
+    return instance;
+}
+
+std::shared_ptr<const NativeCaps> NativeCapsCache::getOrGenerate(const std::string &deviceKey,
+                                                                 const GenerateFunction &generate)
+{
+    if (!deviceKey.empty())
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        auto iter = mCaps.find(deviceKey);
+        if (iter != mCaps.end())
+        {
+            ++mHitCount;
+            return iter->second;
+        }
+        ++mMissCount;
+    }
+
+    // Generate without holding the lock, so that renderers of other devices are not blocked.
+    std::shared_ptr<NativeCaps> caps(new NativeCaps());
+    {
+        TRACE_EVENT0("gpu.angle", "NativeCapsCache::generate");
+        generate(caps.get());
+    }
+
+    if (deviceKey.empty())
+    {
+        return caps;
+    }
+
+    // Another renderer may have generated the caps of the same device concurrently.
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto insertion = mCaps.insert(std::make_pair(deviceKey, std::move(caps)));
+    return insertion.first->second;
+}
+
+void NativeCapsCache::clear()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mCaps.clear();
+    mHitCount  = 0;
+    mMissCount = 0;
+}
+
+size_t NativeCapsCache::getHitCount() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mHitCount;
+}
+
+size_t NativeCapsCache::getMissCount() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mMissCount;
+}
+
+}  // namespace rx
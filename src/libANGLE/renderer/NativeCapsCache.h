@@ -0,0 +1,67 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// NativeCapsCache.h: Defines the rx::NativeCapsCache class, which shares the native caps of a
+// device between the renderers created for it in the process.
+//
+
+#ifndef LIBANGLE_RENDERER_NATIVECAPSCACHE_H_
+#define LIBANGLE_RENDERER_NATIVECAPSCACHE_H_
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "common/angleutils.h"
+#include "libANGLE/Caps.h"
+
+namespace rx
+{
+
+struct NativeCaps
+{
+    gl::Caps caps;
+    gl::TextureCapsMap textureCaps;
+    gl::Extensions extensions;
+    gl::Limitations limitations;
+};
+
+// Generating the native caps probes the support of every format, which dominates the
+// initialization of some back-ends. The caps of a device don't change while the process runs, so
+// displays that are initialized again, or that are created for the same device, reuse the caps of
+// the first renderer that generated them.
+class NativeCapsCache final : angle::NonCopyable
+{
+  public:
+    using GenerateFunction = std::function<void(NativeCaps *)>;
+
+    NativeCapsCache();
+    ~NativeCapsCache();
+
+    static NativeCapsCache *GetInstance();
+
+    // Returns the caps of the device identified by deviceKey, calling generate on the calling
+    // thread if they weren't generated before. An empty key is never memoized.
+    std::shared_ptr<const NativeCaps> getOrGenerate(const std::string &deviceKey,
+                                                    const GenerateFunction &generate);
+
+    void clear();
+
+    size_t getHitCount() const;
+    size_t getMissCount() const;
+
+  private:
+    mutable std::mutex mMutex;
+    std::unordered_map<std::string, std::shared_ptr<const NativeCaps>> mCaps;
+
+    size_t mHitCount;
+    size_t mMissCount;
+};
+
+}  // namespace rx
+
+#endif  // LIBANGLE_RENDERER_NATIVECAPSCACHE_H_
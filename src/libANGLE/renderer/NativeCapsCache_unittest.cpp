@@ -0,0 +1,68 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// NativeCapsCache_unittest.cpp: Unit tests for the native caps shared between the renderers of a
+// device.
+//
+
+#include "gtest/gtest.h"
+
+#include "libANGLE/renderer/NativeCapsCache.h"
+
+using namespace rx;
+
+namespace
+{
+
+class NativeCapsCacheTest : public testing::Test
+{
+  protected:
+    NativeCapsCache::GenerateFunction makeGenerate(GLuint maxTextureSize)
+    {
+        return [this, maxTextureSize](NativeCaps *caps) {
+            ++mGenerateCount;
+            caps->caps.max2DTextureSize = maxTextureSize;
+        };
+    }
+
+    NativeCapsCache mCache;
+    size_t mGenerateCount = 0;
+};
+
+// Caps are only generated once per device.
+TEST_F(NativeCapsCacheTest, SharedByDevice)
+{
+    std::shared_ptr<const NativeCaps> caps = mCache.getOrGenerate("device0", makeGenerate(1024));
+    ASSERT_NE(nullptr, caps);
+    EXPECT_EQ(1024u, caps->caps.max2DTextureSize);
+
+    EXPECT_EQ(caps, mCache.getOrGenerate("device0", makeGenerate(2048)));
+    EXPECT_EQ(1u, mGenerateCount);
+    EXPECT_EQ(1u, mCache.getHitCount());
+    EXPECT_EQ(1u, mCache.getMissCount());
+
+    std::shared_ptr<const NativeCaps> otherCaps =
+        mCache.getOrGenerate("device1", makeGenerate(2048));
+    EXPECT_EQ(2048u, otherCaps->caps.max2DTextureSize);
+    EXPECT_EQ(2u, mGenerateCount);
+
+    // Caps handed out stay valid after the cache is cleared.
+    mCache.clear();
+    EXPECT_EQ(1024u, caps->caps.max2DTextureSize);
+    mCache.getOrGenerate("device0", makeGenerate(1024));
+    EXPECT_EQ(3u, mGenerateCount);
+}
+
+// Devices without a key always generate their caps.
+TEST_F(NativeCapsCacheTest, EmptyKey)
+{
+    mCache.getOrGenerate("", makeGenerate(1024));
+    mCache.getOrGenerate("", makeGenerate(1024));
+    EXPECT_EQ(2u, mGenerateCount);
+    EXPECT_EQ(0u, mCache.getHitCount());
+    EXPECT_EQ(0u, mCache.getMissCount());
+}
+
+}  // anonymous namespace
@@ -47,6 +47,11 @@ class ProgramImpl : angle::NonCopyable
     virtual gl::LinkResult link(const gl::Context *context,
                                 const gl::ProgramLinkedResources &resources,
                                 gl::InfoLog &infoLog)                      = 0;
+
+    // Called on the GL thread before a link is handed to a worker thread. Back-ends that return
+    // true run link() on the worker thread, so it may only read the program state and immutable
+    // context state such as the caps. The others link on the GL thread when the link is resolved.
+    virtual bool prepareLinkOnWorkerThread(const gl::Context *context) { return false; }
     virtual GLboolean validate(const gl::Caps &caps, gl::InfoLog *infoLog) = 0;
 
     virtual void setUniform1fv(GLint location, GLsizei count, const GLfloat *v) = 0;
@@ -27,9 +27,11 @@ class ShaderImpl : angle::NonCopyable
     virtual ShCompileOptions prepareSourceAndReturnOptions(const gl::Context *context,
                                                            std::stringstream *sourceStream,
                                                            std::string *sourcePath) = 0;
-    // Returns success for compiling on the driver. Returns success.
+    // Returns success for compiling on the driver. Returns success. |compilerHandle| holds the
+    // results of the translation.
     virtual bool postTranslateCompile(const gl::Context *context,
                                       gl::Compiler *compiler,
+                                      ShHandle compilerHandle,
                                       std::string *infoLog) = 0;
 
     virtual std::string getDebugInfo(const gl::Context *context) const = 0;
@@ -23,65 +23,6 @@ namespace rx
 namespace
 {
 
-template <typename InputT, typename DestT>
-void ConvertIndexArray(const void *input,
-                       GLenum sourceType,
-                       void *output,
-                       GLenum destinationType,
-                       GLsizei count,
-                       bool usePrimitiveRestartFixedIndex)
-{
-    const InputT *in = static_cast<const InputT *>(input);
-    DestT *out       = static_cast<DestT *>(output);
-
-    if (usePrimitiveRestartFixedIndex)
-    {
-        InputT srcRestartIndex = static_cast<InputT>(gl::GetPrimitiveRestartIndex(sourceType));
-        DestT destRestartIndex = static_cast<DestT>(gl::GetPrimitiveRestartIndex(destinationType));
-        for (GLsizei i = 0; i < count; i++)
-        {
-            out[i] = (in[i] == srcRestartIndex ? destRestartIndex : static_cast<DestT>(in[i]));
-        }
-    }
-    else
-    {
-        for (GLsizei i = 0; i < count; i++)
-        {
-            out[i] = static_cast<DestT>(in[i]);
-        }
-    }
-}
-
-void ConvertIndices(GLenum sourceType,
-                    GLenum destinationType,
-                    const void *input,
-                    GLsizei count,
-                    void *output,
-                    bool usePrimitiveRestartFixedIndex)
-{
-    if (sourceType == destinationType)
-    {
-        const gl::Type &typeInfo = gl::GetTypeInfo(destinationType);
-        memcpy(output, input, count * typeInfo.bytes);
-        return;
-    }
-
-    if (sourceType == GL_UNSIGNED_BYTE)
-    {
-        ASSERT(destinationType == GL_UNSIGNED_SHORT);
-        ConvertIndexArray<GLubyte, GLushort>(input, sourceType, output, destinationType, count,
-                                             usePrimitiveRestartFixedIndex);
-    }
-    else if (sourceType == GL_UNSIGNED_SHORT)
-    {
-        ASSERT(destinationType == GL_UNSIGNED_INT);
-        ConvertIndexArray<GLushort, GLuint>(input, sourceType, output, destinationType, count,
-                                            usePrimitiveRestartFixedIndex);
-    }
-    else
-        UNREACHABLE();
-}
-
 gl::Error StreamInIndexBuffer(IndexBufferInterface *buffer,
                               const void *data,
                               unsigned int count,
@@ -104,7 +45,7 @@ gl::Error StreamInIndexBuffer(IndexBufferInterface *buffer,
     void *output = nullptr;
     ANGLE_TRY(buffer->mapBuffer(bufferSizeRequired, &output, offset));
 
-    ConvertIndices(srcType, dstType, data, count, output, usePrimitiveRestartFixedIndex);
+    gl::ConvertIndices(srcType, data, count, usePrimitiveRestartFixedIndex, dstType, output);
 
     ANGLE_TRY(buffer->unmapBuffer());
     return gl::NoError();
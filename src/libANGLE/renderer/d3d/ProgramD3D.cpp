@@ -1721,6 +1721,14 @@ gl::LinkResult ProgramD3D::link(const gl::Context *context,
     return true;
 }
 
+bool ProgramD3D::prepareLinkOnWorkerThread(const gl::Context *context)
+{
+    // The link generates HLSL and compiles it through the device, which is created free-threaded.
+    // Only the lazy loading of the HLSL compiler is unsafe, so it is done here. If loading fails,
+    // the link runs on the GL thread and reports the error there.
+    return !mRenderer->ensureHLSLCompilerInitialized().isError();
+}
+
 GLboolean ProgramD3D::validate(const gl::Caps & /*caps*/, gl::InfoLog * /*infoLog*/)
 {
     // TODO(jmadill): Do something useful here?
@@ -198,6 +198,7 @@ class ProgramD3D : public ProgramImpl
     gl::LinkResult link(const gl::Context *context,
                         const gl::ProgramLinkedResources &resources,
                         gl::InfoLog &infoLog) override;
+    bool prepareLinkOnWorkerThread(const gl::Context *context) override;
     GLboolean validate(const gl::Caps &caps, gl::InfoLog *infoLog) override;
 
     void setPathFragmentInputGen(const std::string &inputName,
@@ -8,6 +8,8 @@
 
 #include "libANGLE/renderer/d3d/RendererD3D.h"
 
+#include <sstream>
+
 #include "common/MemoryBuffer.h"
 #include "common/debug.h"
 #include "common/utilities.h"
@@ -29,14 +31,44 @@
 #include "libANGLE/renderer/d3d/ProgramD3D.h"
 #include "libANGLE/renderer/d3d/SamplerD3D.h"
 #include "libANGLE/renderer/d3d/TextureD3D.h"
+#include "third_party/trace_event/trace_event.h"
 
 namespace rx
 {
 
+// Generates the native caps of a renderer, or finds them in the NativeCapsCache, on a worker
+// thread.
+class RendererD3D::GenerateCapsTask final : public angle::Closure
+{
+  public:
+    GenerateCapsTask(const RendererD3D *renderer, std::string &&deviceKey)
+        : mRenderer(renderer), mDeviceKey(std::move(deviceKey))
+    {
+    }
+
+    void operator()() override { mNativeCaps = mRenderer->getOrGenerateCaps(mDeviceKey); }
+
+    void setWaitableEvent(angle::WaitableEvent &&waitableEvent)
+    {
+        mWaitableEvent = std::move(waitableEvent);
+    }
+
+    std::shared_ptr<const NativeCaps> wait()
+    {
+        mWaitableEvent.wait();
+        return mNativeCaps;
+    }
+
+  private:
+    const RendererD3D *mRenderer;
+    std::string mDeviceKey;
+    std::shared_ptr<const NativeCaps> mNativeCaps;
+    angle::WaitableEvent mWaitableEvent;
+};
+
 RendererD3D::RendererD3D(egl::Display *display)
     : mDisplay(display),
       mPresentPathFastEnabled(false),
-      mCapsInitialized(false),
       mWorkaroundsInitialized(false),
       mDisjoint(false),
       mDeviceLost(false),
@@ -51,6 +83,13 @@ RendererD3D::~RendererD3D()
 
 void RendererD3D::cleanup()
 {
+    // The back-ends release their device after this, which the task may still be using.
+    if (mGenerateCapsTask)
+    {
+        mNativeCaps = mGenerateCapsTask->wait();
+        mGenerateCapsTask.reset();
+    }
+
     mIncompleteTextures.onDestroy(mDisplay->getProxyContext());
 }
 
@@ -151,37 +190,106 @@ GLint64 RendererD3D::getTimestamp()
     return 0;
 }
 
+void RendererD3D::startGeneratingCaps()
+{
+    if (mNativeCaps || mGenerateCapsTask)
+    {
+        return;
+    }
+
+    // The workarounds are generated lazily, which the worker thread must not race with.
+    getWorkarounds();
+
+    mGenerateCapsTask.reset(new GenerateCapsTask(this, getNativeCapsKey()));
+    mGenerateCapsTask->setWaitableEvent(mWorkerThreadPool.postWorkerTask(mGenerateCapsTask.get()));
+}
+
+std::shared_ptr<const NativeCaps> RendererD3D::getOrGenerateCaps(const std::string &deviceKey) const
+{
+    return NativeCapsCache::GetInstance()->getOrGenerate(deviceKey, [this](NativeCaps *caps) {
+        generateCaps(&caps->caps, &caps->textureCaps, &caps->extensions, &caps->limitations);
+    });
+}
+
 void RendererD3D::ensureCapsInitialized() const
 {
-    if (!mCapsInitialized)
+    if (mNativeCaps)
+    {
+        return;
+    }
+
+    if (mGenerateCapsTask)
     {
-        generateCaps(&mNativeCaps, &mNativeTextureCaps, &mNativeExtensions, &mNativeLimitations);
-        mCapsInitialized = true;
+        TRACE_EVENT0("gpu.angle", "RendererD3D::waitForCaps");
+        mNativeCaps = mGenerateCapsTask->wait();
+        mGenerateCapsTask.reset();
+    }
+    else
+    {
+        mNativeCaps = getOrGenerateCaps(getNativeCapsKey());
     }
 }
 
+std::string RendererD3D::getNativeCapsKey() const
+{
+    // Renderers on adapters that can't be identified don't share their caps.
+    LUID adapterLuid = {};
+    if (!getLUID(&adapterLuid))
+    {
+        return std::string();
+    }
+
+    // The caps depend on the adapter, its feature level, and on the workarounds, which the
+    // platform can override.
+    DeviceIdentifier adapterIdentifier = getAdapterIdentifier();
+    std::ostringstream key;
+    key << static_cast<int>(getRendererClass()) << ":" << adapterLuid.HighPart << ":"
+        << adapterLuid.LowPart << ":" << adapterIdentifier.VendorId << ":"
+        << adapterIdentifier.DeviceId << ":" << adapterIdentifier.SubSysId << ":"
+        << adapterIdentifier.Revision << ":" << adapterIdentifier.FeatureLevel << ":";
+
+    const angle::WorkaroundsD3D &workarounds = getWorkarounds();
+    const uint8_t *workaroundBytes = reinterpret_cast<const uint8_t *>(&workarounds);
+    for (size_t byteIndex = 0; byteIndex < sizeof(workarounds); ++byteIndex)
+    {
+        key << static_cast<int>(workaroundBytes[byteIndex]);
+    }
+
+    return key.str();
+}
+
 const gl::Caps &RendererD3D::getNativeCaps() const
 {
     ensureCapsInitialized();
-    return mNativeCaps;
+    return mNativeCaps->caps;
 }
 
 const gl::TextureCapsMap &RendererD3D::getNativeTextureCaps() const
 {
     ensureCapsInitialized();
-    return mNativeTextureCaps;
+    return mNativeCaps->textureCaps;
 }
 
 const gl::Extensions &RendererD3D::getNativeExtensions() const
 {
     ensureCapsInitialized();
-    return mNativeExtensions;
+    return mNativeCaps->extensions;
 }
 
 const gl::Limitations &RendererD3D::getNativeLimitations() const
 {
     ensureCapsInitialized();
-    return mNativeLimitations;
+    return mNativeCaps->limitations;
+}
+
+gl::Error RendererD3D::generateMipmapChain(const gl::Context *context,
+                                           const std::vector<ImageD3D *> &levels)
+{
+    for (size_t level = 1; level < levels.size(); ++level)
+    {
+        ANGLE_TRY(generateMipmap(context, levels[level], levels[level - 1]));
+    }
+    return gl::NoError();
 }
 
 angle::WorkerThreadPool *RendererD3D::getWorkerThreadPool()
@@ -20,6 +20,7 @@
 #include "libANGLE/WorkerThread.h"
 #include "libANGLE/angletypes.h"
 #include "libANGLE/formatutils.h"
+#include "libANGLE/renderer/NativeCapsCache.h"
 #include "libANGLE/renderer/d3d/VertexDataManager.h"
 #include "libANGLE/renderer/d3d/formatutilsD3D.h"
 #include "libANGLE/renderer/renderer_utils.h"
@@ -224,6 +225,9 @@ class RendererD3D : public BufferFactoryD3D, public MultisampleTextureInitialize
     virtual gl::Error generateMipmap(const gl::Context *context,
                                      ImageD3D *dest,
                                      ImageD3D *source) = 0;
+    // Generates every image of |levels| from the one before it.
+    virtual gl::Error generateMipmapChain(const gl::Context *context,
+                                          const std::vector<ImageD3D *> &levels);
     virtual gl::Error generateMipmapUsingD3D(const gl::Context *context,
                                              TextureStorage *storage,
                                              const gl::TextureState &textureState) = 0;
@@ -328,6 +332,11 @@ class RendererD3D : public BufferFactoryD3D, public MultisampleTextureInitialize
 
     void cleanup();
 
+    // Starts generating the native caps on the worker pool. Back-ends whose device can be used
+    // from other threads call this once the device is created, and the first query of the caps
+    // waits for them. Otherwise the caps are generated when they are first queried.
+    void startGeneratingCaps();
+
     bool skipDraw(const gl::State &glState, GLenum drawMode);
 
     egl::Display *mDisplay;
@@ -335,15 +344,17 @@ class RendererD3D : public BufferFactoryD3D, public MultisampleTextureInitialize
     bool mPresentPathFastEnabled;
 
   private:
+    class GenerateCapsTask;
+
     void ensureCapsInitialized() const;
+    std::string getNativeCapsKey() const;
+    std::shared_ptr<const NativeCaps> getOrGenerateCaps(const std::string &deviceKey) const;
 
     virtual angle::WorkaroundsD3D generateWorkarounds() const = 0;
 
-    mutable bool mCapsInitialized;
-    mutable gl::Caps mNativeCaps;
-    mutable gl::TextureCapsMap mNativeTextureCaps;
-    mutable gl::Extensions mNativeExtensions;
-    mutable gl::Limitations mNativeLimitations;
+    // Shared with the other renderers of the same adapter, see NativeCapsCache.
+    mutable std::shared_ptr<const NativeCaps> mNativeCaps;
+    mutable std::unique_ptr<GenerateCapsTask> mGenerateCapsTask;
 
     IncompleteTextureSet mIncompleteTextures;
 
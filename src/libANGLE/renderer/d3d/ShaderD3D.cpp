@@ -176,6 +176,7 @@ const std::map<std::string, unsigned int> &GetUniformRegisterMap(
 
 bool ShaderD3D::postTranslateCompile(const gl::Context *context,
                                      gl::Compiler *compiler,
+                                     ShHandle compilerHandle,
                                      std::string *infoLog)
 {
     // TODO(jmadill): We shouldn't need to cache this.
@@ -201,8 +202,6 @@ bool ShaderD3D::postTranslateCompile(const gl::Context *context,
     mRequiresIEEEStrictCompiling =
         translatedSource.find("ANGLE_REQUIRES_IEEE_STRICT_COMPILING") != std::string::npos;
 
-    ShHandle compilerHandle = compiler->getCompilerHandle(mData.getShaderType());
-
     mUniformRegisterMap = GetUniformRegisterMap(sh::GetUniformRegisterMap(compilerHandle));
 
     for (const sh::InterfaceBlock &interfaceBlock : mData.getUniformBlocks())
@@ -44,6 +44,7 @@ class ShaderD3D : public ShaderImpl
                                                    std::string *sourcePath) override;
     bool postTranslateCompile(const gl::Context *context,
                               gl::Compiler *compiler,
+                              ShHandle compilerHandle,
                               std::string *infoLog) override;
     std::string getDebugInfo(const gl::Context *context) const override;
 
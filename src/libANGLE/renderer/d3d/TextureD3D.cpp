@@ -493,24 +493,29 @@ gl::Error TextureD3D::generateMipmapUsingImages(const gl::Context *context, cons
 
     for (GLint layer = 0; layer < layerCount; ++layer)
     {
-        for (GLuint mip = mBaseLevel + 1; mip <= maxLevel; ++mip)
+        if (renderableStorage)
         {
-            ASSERT(getLayerCount(mip) == layerCount);
-
-            gl::ImageIndex sourceIndex = getImageIndex(mip - 1, layer);
-            gl::ImageIndex destIndex = getImageIndex(mip, layer);
-
-            if (renderableStorage)
+            // GPU-side mipmapping
+            for (GLuint mip = mBaseLevel + 1; mip <= maxLevel; ++mip)
             {
-                // GPU-side mipmapping
+                ASSERT(getLayerCount(mip) == layerCount);
+
+                gl::ImageIndex sourceIndex = getImageIndex(mip - 1, layer);
+                gl::ImageIndex destIndex   = getImageIndex(mip, layer);
                 ANGLE_TRY(mTexStorage->generateMipmap(context, sourceIndex, destIndex));
             }
-            else
+        }
+        else
+        {
+            // CPU-side mipmapping, the whole chain of the layer at once so the renderer can
+            // generate several levels per pass over the base level.
+            std::vector<ImageD3D *> levels;
+            for (GLuint mip = mBaseLevel; mip <= maxLevel; ++mip)
             {
-                // CPU-side mipmapping
-                ANGLE_TRY(
-                    mRenderer->generateMipmap(context, getImage(destIndex), getImage(sourceIndex)));
+                ASSERT(getLayerCount(mip) == layerCount);
+                levels.push_back(getImage(getImageIndex(mip, layer)));
             }
+            ANGLE_TRY(mRenderer->generateMipmapChain(context, levels));
         }
     }
 
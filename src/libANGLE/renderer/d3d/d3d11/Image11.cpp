@@ -45,7 +45,8 @@ Image11::~Image11()
 gl::Error Image11::GenerateMipmap(const gl::Context *context,
                                   Image11 *dest,
                                   Image11 *src,
-                                  const Renderer11DeviceCaps &rendererCaps)
+                                  const Renderer11DeviceCaps &rendererCaps,
+                                  angle::WorkerThreadPool *workerPool)
 {
     ASSERT(src->getDXGIFormat() == dest->getDXGIFormat());
     ASSERT(src->getWidth() == 1 || src->getWidth() / 2 == dest->getWidth());
@@ -67,9 +68,9 @@ gl::Error Image11::GenerateMipmap(const gl::Context *context,
 
     auto mipGenerationFunction =
         d3d11::Format::Get(src->getInternalFormat(), rendererCaps).format().mipGenerationFunction;
-    mipGenerationFunction(src->getWidth(), src->getHeight(), src->getDepth(), sourceData,
-                          srcMapped.RowPitch, srcMapped.DepthPitch, destData, destMapped.RowPitch,
-                          destMapped.DepthPitch);
+    ParallelGenerateMip(workerPool, mipGenerationFunction, src->getWidth(), src->getHeight(),
+                        src->getDepth(), sourceData, srcMapped.RowPitch, srcMapped.DepthPitch,
+                        destData, destMapped.RowPitch, destMapped.DepthPitch);
 
     dest->unmap();
     src->unmap();
@@ -79,6 +80,80 @@ gl::Error Image11::GenerateMipmap(const gl::Context *context,
     return gl::NoError();
 }
 
+// static
+gl::Error Image11::GenerateMipmapChain(const gl::Context *context,
+                                       const std::vector<Image11 *> &levels,
+                                       const Renderer11DeviceCaps &rendererCaps,
+                                       angle::WorkerThreadPool *workerPool)
+{
+    ASSERT(!levels.empty());
+
+    bool is2D = true;
+    for (Image11 *level : levels)
+    {
+        is2D = is2D && level->getDepth() == 1;
+    }
+
+    if (!is2D)
+    {
+        for (size_t level = 1; level < levels.size(); ++level)
+        {
+            ANGLE_TRY(GenerateMipmap(context, levels[level], levels[level - 1], rendererCaps,
+                                     workerPool));
+        }
+        return gl::NoError();
+    }
+
+    // The levels in between are written, then read to generate the next ones.
+    std::vector<MipChainLevel> mappedLevels(levels.size());
+    for (size_t level = 0; level < levels.size(); ++level)
+    {
+        D3D11_MAP mapType = D3D11_MAP_READ_WRITE;
+        if (level == 0)
+        {
+            mapType = D3D11_MAP_READ;
+        }
+        else if (level + 1 == levels.size())
+        {
+            mapType = D3D11_MAP_WRITE;
+        }
+
+        D3D11_MAPPED_SUBRESOURCE mapped;
+        gl::Error error = levels[level]->map(context, mapType, &mapped);
+        if (error.isError())
+        {
+            for (size_t mappedLevel = 0; mappedLevel < level; ++mappedLevel)
+            {
+                levels[mappedLevel]->unmap();
+            }
+            return error;
+        }
+
+        mappedLevels[level].data       = reinterpret_cast<uint8_t *>(mapped.pData);
+        mappedLevels[level].rowPitch   = mapped.RowPitch;
+        mappedLevels[level].depthPitch = mapped.DepthPitch;
+    }
+
+    Image11 *baseLevel = levels[0];
+    auto mipGenerationFunction =
+        d3d11::Format::Get(baseLevel->getInternalFormat(), rendererCaps)
+            .format()
+            .mipGenerationFunction;
+    GenerateMipChain(workerPool, mipGenerationFunction, baseLevel->getWidth(),
+                     baseLevel->getHeight(), 1, mappedLevels.data(), mappedLevels.size());
+
+    for (size_t level = 0; level < levels.size(); ++level)
+    {
+        levels[level]->unmap();
+        if (level > 0)
+        {
+            levels[level]->markDirty();
+        }
+    }
+
+    return gl::NoError();
+}
+
 // static
 gl::Error Image11::CopyImage(const gl::Context *context,
                              Image11 *dest,
@@ -307,9 +382,10 @@ gl::Error Image11::loadData(const gl::Context *context,
     uint8_t *offsetMappedData = (reinterpret_cast<uint8_t *>(mappedImage.pData) +
                                  (area.y * mappedImage.RowPitch + area.x * outputPixelSize +
                                   area.z * mappedImage.DepthPitch));
-    loadFunction(area.width, area.height, area.depth,
-                 reinterpret_cast<const uint8_t *>(input) + inputSkipBytes, inputRowPitch,
-                 inputDepthPitch, offsetMappedData, mappedImage.RowPitch, mappedImage.DepthPitch);
+    ParallelLoadImage(mRenderer->getWorkerThreadPool(), loadFunction, area.width, area.height,
+                      area.depth, reinterpret_cast<const uint8_t *>(input) + inputSkipBytes,
+                      inputRowPitch, inputDepthPitch, offsetMappedData, mappedImage.RowPitch,
+                      mappedImage.DepthPitch);
 
     unmap();
 
@@ -347,9 +423,11 @@ gl::Error Image11::loadCompressedData(const gl::Context *context,
         ((area.y / outputBlockHeight) * mappedImage.RowPitch +
          (area.x / outputBlockWidth) * outputPixelSize + area.z * mappedImage.DepthPitch);
 
-    loadFunction(area.width, area.height, area.depth, reinterpret_cast<const uint8_t *>(input),
-                 inputRowPitch, inputDepthPitch, offsetMappedData, mappedImage.RowPitch,
-                 mappedImage.DepthPitch);
+    ParallelLoadBlockImage(mRenderer->getWorkerThreadPool(), loadFunction,
+                           formatInfo.compressedBlockHeight, outputBlockHeight, area.width,
+                           area.height, area.depth, reinterpret_cast<const uint8_t *>(input),
+                           inputRowPitch, inputDepthPitch, offsetMappedData, mappedImage.RowPitch,
+                           mappedImage.DepthPitch);
 
     unmap();
 
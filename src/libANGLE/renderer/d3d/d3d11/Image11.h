@@ -15,6 +15,11 @@
 #include "libANGLE/renderer/d3d/ImageD3D.h"
 #include "libANGLE/renderer/d3d/d3d11/renderer11_utils.h"
 
+namespace angle
+{
+class WorkerThreadPool;
+}
+
 namespace gl
 {
 class Framebuffer;
@@ -36,7 +41,14 @@ class Image11 : public ImageD3D
     static gl::Error GenerateMipmap(const gl::Context *context,
                                     Image11 *dest,
                                     Image11 *src,
-                                    const Renderer11DeviceCaps &rendererCaps);
+                                    const Renderer11DeviceCaps &rendererCaps,
+                                    angle::WorkerThreadPool *workerPool);
+    // Generates every image of |levels| from the one before it. 2D images are all mapped at once
+    // and generated together.
+    static gl::Error GenerateMipmapChain(const gl::Context *context,
+                                         const std::vector<Image11 *> &levels,
+                                         const Renderer11DeviceCaps &rendererCaps,
+                                         angle::WorkerThreadPool *workerPool);
     static gl::Error CopyImage(const gl::Context *context,
                                Image11 *dest,
                                Image11 *source,
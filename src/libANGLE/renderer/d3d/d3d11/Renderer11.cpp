@@ -843,6 +843,14 @@ egl::Error Renderer11::initializeDevice()
 
     populateRenderer11DeviceCaps();
 
+    // The formats are probed while the rest of the device initializes. Devices passed in through
+    // EGL_ANGLE_device_d3d may have been created single-threaded, in which case the caps are
+    // generated on this thread when they are first queried.
+    if ((mDevice->GetCreationFlags() & D3D11_CREATE_DEVICE_SINGLETHREADED) == 0)
+    {
+        startGeneratingCaps();
+    }
+
     mStateCache.clear();
 
     ASSERT(!mBlit);
@@ -2895,7 +2903,21 @@ gl::Error Renderer11::generateMipmap(const gl::Context *context, ImageD3D *dest,
 {
     Image11 *dest11 = GetAs<Image11>(dest);
     Image11 *src11  = GetAs<Image11>(src);
-    return Image11::GenerateMipmap(context, dest11, src11, mRenderer11DeviceCaps);
+    return Image11::GenerateMipmap(context, dest11, src11, mRenderer11DeviceCaps,
+                                   getWorkerThreadPool());
+}
+
+gl::Error Renderer11::generateMipmapChain(const gl::Context *context,
+                                          const std::vector<ImageD3D *> &levels)
+{
+    std::vector<Image11 *> levels11;
+    levels11.reserve(levels.size());
+    for (ImageD3D *level : levels)
+    {
+        levels11.push_back(GetAs<Image11>(level));
+    }
+    return Image11::GenerateMipmapChain(context, levels11, mRenderer11DeviceCaps,
+                                        getWorkerThreadPool());
 }
 
 gl::Error Renderer11::generateMipmapUsingD3D(const gl::Context *context,
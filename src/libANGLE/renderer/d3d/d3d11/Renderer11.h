@@ -244,6 +244,8 @@ class Renderer11 : public RendererD3D
     // Image operations
     ImageD3D *createImage() override;
     gl::Error generateMipmap(const gl::Context *context, ImageD3D *dest, ImageD3D *source) override;
+    gl::Error generateMipmapChain(const gl::Context *context,
+                                  const std::vector<ImageD3D *> &levels) override;
     gl::Error generateMipmapUsingD3D(const gl::Context *context,
                                      TextureStorage *storage,
                                      const gl::TextureState &textureState) override;
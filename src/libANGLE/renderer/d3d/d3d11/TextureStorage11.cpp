@@ -764,9 +764,9 @@ gl::Error TextureStorage11::setData(const gl::Context *context,
     if (loadFunctionInfo.requiresConversion)
     {
         ANGLE_TRY(mRenderer->getScratchMemoryBuffer(neededSize, &conversionBuffer));
-        loadFunctionInfo.loadFunction(width, height, depth, pixelData + srcSkipBytes, srcRowPitch,
-                                      srcDepthPitch, conversionBuffer->data(), bufferRowPitch,
-                                      bufferDepthPitch);
+        ParallelLoadImage(mRenderer->getWorkerThreadPool(), loadFunctionInfo.loadFunction, width,
+                          height, depth, pixelData + srcSkipBytes, srcRowPitch, srcDepthPitch,
+                          conversionBuffer->data(), bufferRowPitch, bufferDepthPitch);
         data = conversionBuffer->data();
     }
     else
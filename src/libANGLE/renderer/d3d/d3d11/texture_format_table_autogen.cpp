@@ -193,6 +193,20 @@ const Format &Format::Get(GLenum internalFormat, const Renderer11DeviceCaps &dev
                                          nullptr);
             return info;
         }
+        case GL_COMPRESSED_R11_LOSSY_DECODE_EAC_ANGLE:
+        {
+            static constexpr Format info(GL_COMPRESSED_R11_LOSSY_DECODE_EAC_ANGLE,
+                                         angle::Format::ID::BC4_RED_UNORM_BLOCK,
+                                         DXGI_FORMAT_BC4_UNORM,
+                                         DXGI_FORMAT_BC4_UNORM,
+                                         DXGI_FORMAT_UNKNOWN,
+                                         DXGI_FORMAT_UNKNOWN,
+                                         DXGI_FORMAT_UNKNOWN,
+                                         DXGI_FORMAT_BC4_UNORM,
+                                         GL_RGBA8,
+                                         nullptr);
+            return info;
+        }
         case GL_COMPRESSED_RG11_EAC:
         {
             static constexpr Format info(GL_COMPRESSED_RG11_EAC,
@@ -207,6 +221,20 @@ const Format &Format::Get(GLenum internalFormat, const Renderer11DeviceCaps &dev
                                          nullptr);
             return info;
         }
+        case GL_COMPRESSED_RG11_LOSSY_DECODE_EAC_ANGLE:
+        {
+            static constexpr Format info(GL_COMPRESSED_RG11_LOSSY_DECODE_EAC_ANGLE,
+                                         angle::Format::ID::BC5_RG_UNORM_BLOCK,
+                                         DXGI_FORMAT_BC5_UNORM,
+                                         DXGI_FORMAT_BC5_UNORM,
+                                         DXGI_FORMAT_UNKNOWN,
+                                         DXGI_FORMAT_UNKNOWN,
+                                         DXGI_FORMAT_UNKNOWN,
+                                         DXGI_FORMAT_BC5_UNORM,
+                                         GL_RGBA8,
+                                         nullptr);
+            return info;
+        }
         case GL_COMPRESSED_RGB8_ETC2:
         {
             static constexpr Format info(GL_COMPRESSED_RGB8_ETC2,
@@ -277,6 +305,20 @@ const Format &Format::Get(GLenum internalFormat, const Renderer11DeviceCaps &dev
                                          nullptr);
             return info;
         }
+        case GL_COMPRESSED_RGBA8_LOSSY_DECODE_ETC2_EAC_ANGLE:
+        {
+            static constexpr Format info(GL_COMPRESSED_RGBA8_LOSSY_DECODE_ETC2_EAC_ANGLE,
+                                         angle::Format::ID::BC3_RGBA_UNORM_BLOCK,
+                                         DXGI_FORMAT_BC3_UNORM,
+                                         DXGI_FORMAT_BC3_UNORM,
+                                         DXGI_FORMAT_UNKNOWN,
+                                         DXGI_FORMAT_UNKNOWN,
+                                         DXGI_FORMAT_UNKNOWN,
+                                         DXGI_FORMAT_BC3_UNORM,
+                                         GL_RGBA8,
+                                         nullptr);
+            return info;
+        }
         case GL_COMPRESSED_RGBA_ASTC_10x10_KHR:
         {
             static constexpr Format info(GL_COMPRESSED_RGBA_ASTC_10x10_KHR,
@@ -543,6 +585,20 @@ const Format &Format::Get(GLenum internalFormat, const Renderer11DeviceCaps &dev
                                          nullptr);
             return info;
         }
+        case GL_COMPRESSED_SIGNED_R11_LOSSY_DECODE_EAC_ANGLE:
+        {
+            static constexpr Format info(GL_COMPRESSED_SIGNED_R11_LOSSY_DECODE_EAC_ANGLE,
+                                         angle::Format::ID::BC4_RED_SNORM_BLOCK,
+                                         DXGI_FORMAT_BC4_SNORM,
+                                         DXGI_FORMAT_BC4_SNORM,
+                                         DXGI_FORMAT_UNKNOWN,
+                                         DXGI_FORMAT_UNKNOWN,
+                                         DXGI_FORMAT_UNKNOWN,
+                                         DXGI_FORMAT_BC4_SNORM,
+                                         GL_RGBA8_SNORM,
+                                         nullptr);
+            return info;
+        }
         case GL_COMPRESSED_SIGNED_RG11_EAC:
         {
             static constexpr Format info(GL_COMPRESSED_SIGNED_RG11_EAC,
@@ -557,6 +613,20 @@ const Format &Format::Get(GLenum internalFormat, const Renderer11DeviceCaps &dev
                                          nullptr);
             return info;
         }
+        case GL_COMPRESSED_SIGNED_RG11_LOSSY_DECODE_EAC_ANGLE:
+        {
+            static constexpr Format info(GL_COMPRESSED_SIGNED_RG11_LOSSY_DECODE_EAC_ANGLE,
+                                         angle::Format::ID::BC5_RG_SNORM_BLOCK,
+                                         DXGI_FORMAT_BC5_SNORM,
+                                         DXGI_FORMAT_BC5_SNORM,
+                                         DXGI_FORMAT_UNKNOWN,
+                                         DXGI_FORMAT_UNKNOWN,
+                                         DXGI_FORMAT_UNKNOWN,
+                                         DXGI_FORMAT_BC5_SNORM,
+                                         GL_RGBA8_SNORM,
+                                         nullptr);
+            return info;
+        }
         case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x10_KHR:
         {
             static constexpr Format info(GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x10_KHR,
@@ -767,6 +837,20 @@ const Format &Format::Get(GLenum internalFormat, const Renderer11DeviceCaps &dev
                                          nullptr);
             return info;
         }
+        case GL_COMPRESSED_SRGB8_ALPHA8_LOSSY_DECODE_ETC2_EAC_ANGLE:
+        {
+            static constexpr Format info(GL_COMPRESSED_SRGB8_ALPHA8_LOSSY_DECODE_ETC2_EAC_ANGLE,
+                                         angle::Format::ID::BC3_RGBA_UNORM_SRGB_BLOCK,
+                                         DXGI_FORMAT_BC3_UNORM_SRGB,
+                                         DXGI_FORMAT_BC3_UNORM_SRGB,
+                                         DXGI_FORMAT_UNKNOWN,
+                                         DXGI_FORMAT_UNKNOWN,
+                                         DXGI_FORMAT_UNKNOWN,
+                                         DXGI_FORMAT_BC3_UNORM_SRGB,
+                                         GL_RGBA8,
+                                         nullptr);
+            return info;
+        }
         case GL_COMPRESSED_SRGB8_ETC2:
         {
             static constexpr Format info(GL_COMPRESSED_SRGB8_ETC2,
@@ -143,6 +143,7 @@ ShCompileOptions ShaderGL::prepareSourceAndReturnOptions(const gl::Context *cont
 
 bool ShaderGL::postTranslateCompile(const gl::Context *context,
                                     gl::Compiler *compiler,
+                                    ShHandle compilerHandle,
                                     std::string *infoLog)
 {
     // Translate the ESSL into GLSL
@@ -33,6 +33,7 @@ class ShaderGL : public ShaderImpl
                                                    std::string *sourcePath) override;
     bool postTranslateCompile(const gl::Context *context,
                               gl::Compiler *compiler,
+                              ShHandle compilerHandle,
                               std::string *infoLog) override;
     std::string getDebugInfo(const gl::Context *context) const override;
 
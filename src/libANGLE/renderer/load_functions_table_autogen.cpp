@@ -238,6 +238,18 @@ LoadImageFunctionInfo COMPRESSED_R11_EAC_to_R16_UNORM(GLenum type)
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_R11_LOSSY_DECODE_EAC_ANGLE_to_BC4_RED_UNORM_BLOCK(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadEACR11ToBC4, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_RG11_EAC_to_R16G16_UNORM(GLenum type)
 {
     switch (type)
@@ -250,6 +262,18 @@ LoadImageFunctionInfo COMPRESSED_RG11_EAC_to_R16G16_UNORM(GLenum type)
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_RG11_LOSSY_DECODE_EAC_ANGLE_to_BC5_RG_UNORM_BLOCK(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadEACRG11ToBC5, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_RGB8_ETC2_to_R8G8B8A8_UNORM(GLenum type)
 {
     switch (type)
@@ -311,6 +335,19 @@ LoadImageFunctionInfo COMPRESSED_RGBA8_ETC2_EAC_to_R8G8B8A8_UNORM(GLenum type)
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_RGBA8_LOSSY_DECODE_ETC2_EAC_ANGLE_to_BC3_RGBA_UNORM_BLOCK(
+    GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadETC2RGBA8ToBC3, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_RGBA_S3TC_DXT1_EXT_to_default(GLenum type)
 {
     switch (type)
@@ -371,6 +408,19 @@ LoadImageFunctionInfo COMPRESSED_SIGNED_R11_EAC_to_R16_SNORM(GLenum type)
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_SIGNED_R11_LOSSY_DECODE_EAC_ANGLE_to_BC4_RED_SNORM_BLOCK(
+    GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadEACR11SToBC4, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_SIGNED_RG11_EAC_to_R16G16_SNORM(GLenum type)
 {
     switch (type)
@@ -383,6 +433,19 @@ LoadImageFunctionInfo COMPRESSED_SIGNED_RG11_EAC_to_R16G16_SNORM(GLenum type)
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_SIGNED_RG11_LOSSY_DECODE_EAC_ANGLE_to_BC5_RG_SNORM_BLOCK(
+    GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadEACRG11SToBC5, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ETC2_EAC_to_R8G8B8A8_UNORM_SRGB(GLenum type)
 {
     switch (type)
@@ -395,6 +458,19 @@ LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ETC2_EAC_to_R8G8B8A8_UNORM_SRGB(GL
     }
 }
 
+LoadImageFunctionInfo
+COMPRESSED_SRGB8_ALPHA8_LOSSY_DECODE_ETC2_EAC_ANGLE_to_BC3_RGBA_UNORM_SRGB_BLOCK(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadETC2SRGBA8ToBC3, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_SRGB8_ETC2_to_R8G8B8A8_UNORM_SRGB(GLenum type)
 {
     switch (type)
@@ -1674,6 +1750,17 @@ LoadFunctionMap GetLoadFunctionsMap(GLenum internalFormat, Format::ID angleForma
             }
             break;
         }
+        case GL_COMPRESSED_R11_LOSSY_DECODE_EAC_ANGLE:
+        {
+            switch (angleFormat)
+            {
+                case Format::ID::BC4_RED_UNORM_BLOCK:
+                    return COMPRESSED_R11_LOSSY_DECODE_EAC_ANGLE_to_BC4_RED_UNORM_BLOCK;
+                default:
+                    break;
+            }
+            break;
+        }
         case GL_COMPRESSED_RG11_EAC:
         {
             switch (angleFormat)
@@ -1685,6 +1772,17 @@ LoadFunctionMap GetLoadFunctionsMap(GLenum internalFormat, Format::ID angleForma
             }
             break;
         }
+        case GL_COMPRESSED_RG11_LOSSY_DECODE_EAC_ANGLE:
+        {
+            switch (angleFormat)
+            {
+                case Format::ID::BC5_RG_UNORM_BLOCK:
+                    return COMPRESSED_RG11_LOSSY_DECODE_EAC_ANGLE_to_BC5_RG_UNORM_BLOCK;
+                default:
+                    break;
+            }
+            break;
+        }
         case GL_COMPRESSED_RGB8_ETC2:
         {
             switch (angleFormat)
@@ -1740,6 +1838,17 @@ LoadFunctionMap GetLoadFunctionsMap(GLenum internalFormat, Format::ID angleForma
             }
             break;
         }
+        case GL_COMPRESSED_RGBA8_LOSSY_DECODE_ETC2_EAC_ANGLE:
+        {
+            switch (angleFormat)
+            {
+                case Format::ID::BC3_RGBA_UNORM_BLOCK:
+                    return COMPRESSED_RGBA8_LOSSY_DECODE_ETC2_EAC_ANGLE_to_BC3_RGBA_UNORM_BLOCK;
+                default:
+                    break;
+            }
+            break;
+        }
         case GL_COMPRESSED_RGBA_S3TC_DXT1_EXT:
             return COMPRESSED_RGBA_S3TC_DXT1_EXT_to_default;
         case GL_COMPRESSED_RGBA_S3TC_DXT3_ANGLE:
@@ -1759,6 +1868,17 @@ LoadFunctionMap GetLoadFunctionsMap(GLenum internalFormat, Format::ID angleForma
             }
             break;
         }
+        case GL_COMPRESSED_SIGNED_R11_LOSSY_DECODE_EAC_ANGLE:
+        {
+            switch (angleFormat)
+            {
+                case Format::ID::BC4_RED_SNORM_BLOCK:
+                    return COMPRESSED_SIGNED_R11_LOSSY_DECODE_EAC_ANGLE_to_BC4_RED_SNORM_BLOCK;
+                default:
+                    break;
+            }
+            break;
+        }
         case GL_COMPRESSED_SIGNED_RG11_EAC:
         {
             switch (angleFormat)
@@ -1770,6 +1890,17 @@ LoadFunctionMap GetLoadFunctionsMap(GLenum internalFormat, Format::ID angleForma
             }
             break;
         }
+        case GL_COMPRESSED_SIGNED_RG11_LOSSY_DECODE_EAC_ANGLE:
+        {
+            switch (angleFormat)
+            {
+                case Format::ID::BC5_RG_SNORM_BLOCK:
+                    return COMPRESSED_SIGNED_RG11_LOSSY_DECODE_EAC_ANGLE_to_BC5_RG_SNORM_BLOCK;
+                default:
+                    break;
+            }
+            break;
+        }
         case GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC:
         {
             switch (angleFormat)
@@ -1781,6 +1912,17 @@ LoadFunctionMap GetLoadFunctionsMap(GLenum internalFormat, Format::ID angleForma
             }
             break;
         }
+        case GL_COMPRESSED_SRGB8_ALPHA8_LOSSY_DECODE_ETC2_EAC_ANGLE:
+        {
+            switch (angleFormat)
+            {
+                case Format::ID::BC3_RGBA_UNORM_SRGB_BLOCK:
+                    return COMPRESSED_SRGB8_ALPHA8_LOSSY_DECODE_ETC2_EAC_ANGLE_to_BC3_RGBA_UNORM_SRGB_BLOCK;
+                default:
+                    break;
+            }
+            break;
+        }
         case GL_COMPRESSED_SRGB8_ETC2:
         {
             switch (angleFormat)
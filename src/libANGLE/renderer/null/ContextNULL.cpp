@@ -45,17 +45,21 @@ AllocationTrackerNULL::~AllocationTrackerNULL()
 
 bool AllocationTrackerNULL::updateMemoryAllocation(size_t oldSize, size_t newSize)
 {
-    ASSERT(mAllocatedBytes >= oldSize);
-
-    size_t sizeAfterRelease    = mAllocatedBytes - oldSize;
-    size_t sizeAfterReallocate = sizeAfterRelease + newSize;
-    if (sizeAfterReallocate < sizeAfterRelease || sizeAfterReallocate > mMaxBytes)
+    size_t allocatedBytes = mAllocatedBytes.load();
+    size_t sizeAfterReallocate;
+    do
     {
-        // Overflow or allocation would be too large
-        return false;
-    }
+        ASSERT(allocatedBytes >= oldSize);
+
+        size_t sizeAfterRelease = allocatedBytes - oldSize;
+        sizeAfterReallocate     = sizeAfterRelease + newSize;
+        if (sizeAfterReallocate < sizeAfterRelease || sizeAfterReallocate > mMaxBytes)
+        {
+            // Overflow or allocation would be too large
+            return false;
+        }
+    } while (!mAllocatedBytes.compare_exchange_weak(allocatedBytes, sizeAfterReallocate));
 
-    mAllocatedBytes = sizeAfterReallocate;
     return true;
 }
 
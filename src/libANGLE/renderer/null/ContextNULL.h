@@ -10,6 +10,8 @@
 #ifndef LIBANGLE_RENDERER_NULL_CONTEXTNULL_H_
 #define LIBANGLE_RENDERER_NULL_CONTEXTNULL_H_
 
+#include <atomic>
+
 #include "libANGLE/renderer/ContextImpl.h"
 
 namespace rx
@@ -26,7 +28,8 @@ class AllocationTrackerNULL : angle::NonCopyable
     bool updateMemoryAllocation(size_t oldSize, size_t newSize);
 
   private:
-    size_t mAllocatedBytes;
+    // Shared by every context on the display, which can run on different threads.
+    std::atomic<size_t> mAllocatedBytes;
     const size_t mMaxBytes;
 };
 
@@ -203,6 +203,7 @@ void DisplayNULL::generateExtensions(egl::DisplayExtensions *outExtensions) cons
     outExtensions->createContextClientArrays          = true;
     outExtensions->programCacheControl                = true;
     outExtensions->robustResourceInitialization       = true;
+    outExtensions->deferredCommandStream              = true;
 }
 
 void DisplayNULL::generateCaps(egl::Caps *outCaps) const
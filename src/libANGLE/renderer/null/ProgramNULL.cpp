@@ -48,6 +48,11 @@ gl::LinkResult ProgramNULL::link(const gl::Context *contextImpl,
     return true;
 }
 
+bool ProgramNULL::prepareLinkOnWorkerThread(const gl::Context *context)
+{
+    return true;
+}
+
 GLboolean ProgramNULL::validate(const gl::Caps &caps, gl::InfoLog *infoLog)
 {
     return GL_TRUE;
@@ -31,6 +31,7 @@ class ProgramNULL : public ProgramImpl
     gl::LinkResult link(const gl::Context *context,
                         const gl::ProgramLinkedResources &resources,
                         gl::InfoLog &infoLog) override;
+    bool prepareLinkOnWorkerThread(const gl::Context *context) override;
     GLboolean validate(const gl::Caps &caps, gl::InfoLog *infoLog) override;
 
     void setUniform1fv(GLint location, GLsizei count, const GLfloat *v) override;
@@ -32,6 +32,7 @@ ShCompileOptions ShaderNULL::prepareSourceAndReturnOptions(const gl::Context *co
 
 bool ShaderNULL::postTranslateCompile(const gl::Context *context,
                                       gl::Compiler *compiler,
+                                      ShHandle compilerHandle,
                                       std::string *infoLog)
 {
     return true;
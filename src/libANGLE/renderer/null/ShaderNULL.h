@@ -28,6 +28,7 @@ class ShaderNULL : public ShaderImpl
     // Returns success for compiling on the driver. Returns success.
     bool postTranslateCompile(const gl::Context *context,
                               gl::Compiler *compiler,
+                              ShHandle compilerHandle,
                               std::string *infoLog) override;
 
     std::string getDebugInfo(const gl::Context *context) const override;
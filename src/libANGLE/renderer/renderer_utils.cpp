@@ -19,6 +19,8 @@
 #include "libANGLE/renderer/Format.h"
 
 #include <string.h>
+#include <algorithm>
+#include <thread>
 
 namespace rx
 {
@@ -151,6 +153,149 @@ static FormatWriteFunctionMap BuildFormatWriteFunctionMap()
     return map;
 }
 
+// Images are only split when the output is at least this large, and each band gets at least
+// kParallelLoadMinBytesPerTask of it, so that starting the tasks stays cheap next to the
+// conversion.
+constexpr size_t kParallelLoadMinBytes        = 1024 * 1024;
+constexpr size_t kParallelLoadMinBytesPerTask = 256 * 1024;
+constexpr size_t kParallelLoadMaxTasks        = 8;
+
+// Bands of a mip chain start with about this many bytes of the level they are generated from, so
+// that the band and the levels generated from it stay in the cache. Every level halves the rows of
+// the next one, so bands that go through many levels would need to be too tall.
+constexpr size_t kMipChainBandBytes      = 128 * 1024;
+constexpr size_t kMipChainMaxFusedLevels = 4;
+
+// Runs a load or mip generation function, which have the same signature, over a band of an image.
+class ImageFunctionTask final : public angle::Closure
+{
+  public:
+    ImageFunctionTask()
+        : function(nullptr),
+          width(0),
+          height(0),
+          depth(0),
+          input(nullptr),
+          inputRowPitch(0),
+          inputDepthPitch(0),
+          output(nullptr),
+          outputRowPitch(0),
+          outputDepthPitch(0)
+    {
+    }
+
+    void operator()() override
+    {
+        function(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
+                 outputRowPitch, outputDepthPitch);
+    }
+
+    LoadImageFunction function;
+    size_t width;
+    size_t height;
+    size_t depth;
+    const uint8_t *input;
+    size_t inputRowPitch;
+    size_t inputDepthPitch;
+    uint8_t *output;
+    size_t outputRowPitch;
+    size_t outputDepthPitch;
+};
+
+// One step of a mip chain: the levels after |baseLevel| that are generated together, band by band.
+struct MipChainStep
+{
+    MipGenerationFunction mipFunction;
+    const MipChainLevel *levels;
+    size_t width;
+    size_t height;
+    size_t baseLevel;
+    size_t fusedLevelCount;
+    size_t bandRows;
+    size_t bandsPerLayer;
+};
+
+size_t GetMipSize(size_t size, size_t level)
+{
+    return std::max<size_t>(1, size >> level);
+}
+
+void GenerateMipChainBands(const MipChainStep &step, size_t firstBand, size_t lastBand)
+{
+    for (size_t band = firstBand; band < lastBand; ++band)
+    {
+        size_t layer        = band / step.bandsPerLayer;
+        size_t baseRowBegin = (band % step.bandsPerLayer) * step.bandRows;
+        size_t baseRowEnd   = baseRowBegin + step.bandRows;
+
+        // Each level of the band is generated from the rows of the band that were just written to
+        // the level above. Bands are a multiple of 2^fusedLevelCount rows, so they line up.
+        for (size_t fused = 1; fused <= step.fusedLevelCount; ++fused)
+        {
+            size_t sourceLevel = step.baseLevel + fused - 1;
+            size_t rowBegin    = baseRowBegin >> fused;
+            size_t rowEnd = std::min(GetMipSize(step.height, sourceLevel + 1), baseRowEnd >> fused);
+            if (rowBegin >= rowEnd)
+            {
+                break;
+            }
+
+            const MipChainLevel &source = step.levels[sourceLevel];
+            const MipChainLevel &dest   = step.levels[sourceLevel + 1];
+            step.mipFunction(GetMipSize(step.width, sourceLevel), 2 * (rowEnd - rowBegin), 1,
+                             source.data + layer * source.depthPitch + 2 * rowBegin * source.rowPitch,
+                             source.rowPitch, source.depthPitch,
+                             dest.data + layer * dest.depthPitch + rowBegin * dest.rowPitch,
+                             dest.rowPitch, dest.depthPitch);
+        }
+    }
+}
+
+class MipChainTask final : public angle::Closure
+{
+  public:
+    MipChainTask() : step(nullptr), firstBand(0), lastBand(0) {}
+
+    void operator()() override { GenerateMipChainBands(*step, firstBand, lastBand); }
+
+    const MipChainStep *step;
+    size_t firstBand;
+    size_t lastBand;
+};
+
+// The number of tasks to split |outputSize| bytes of output into, or 1 if it isn't worth it.
+size_t GetParallelTaskCount(angle::WorkerThreadPool *workerPool, size_t outputSize)
+{
+    if (workerPool == nullptr || outputSize < kParallelLoadMinBytes)
+    {
+        return 1;
+    }
+    size_t maxTasks = std::min<size_t>(kParallelLoadMaxTasks,
+                                       std::max(1u, std::thread::hardware_concurrency()));
+    // The calling thread runs one of the tasks, so the pool's limit caps the others.
+    maxTasks = std::min(maxTasks - 1, workerPool->getMaxThreads()) + 1;
+    return std::max<size_t>(1, std::min(outputSize / kParallelLoadMinBytesPerTask, maxTasks));
+}
+
+// The calling thread runs the first task while the workers run the others.
+template <typename TaskT>
+void RunTasks(angle::WorkerThreadPool *workerPool, std::vector<TaskT> *tasks)
+{
+    std::vector<angle::WaitableEvent> waitEvents;
+    waitEvents.reserve(tasks->size() - 1);
+    for (size_t taskIndex = 1; taskIndex < tasks->size(); ++taskIndex)
+    {
+        waitEvents.push_back(workerPool->postWorkerTask(&(*tasks)[taskIndex]));
+    }
+
+    (*tasks)[0]();
+
+    for (angle::WaitableEvent &waitEvent : waitEvents)
+    {
+        waitEvent.wait();
+    }
+}
+
 void CopyColor(gl::ColorF *color)
 {
     // No-op
@@ -369,6 +514,227 @@ ColorCopyFunction FastCopyFunctionMap::get(const gl::FormatType &formatType) con
     return nullptr;
 }
 
+void ParallelLoadImage(angle::WorkerThreadPool *workerPool,
+                       LoadImageFunction loadFunction,
+                       size_t width,
+                       size_t height,
+                       size_t depth,
+                       const uint8_t *input,
+                       size_t inputRowPitch,
+                       size_t inputDepthPitch,
+                       uint8_t *output,
+                       size_t outputRowPitch,
+                       size_t outputDepthPitch)
+{
+    ParallelLoadBlockImage(workerPool, loadFunction, 1, 1, width, height, depth, input,
+                           inputRowPitch, inputDepthPitch, output, outputRowPitch,
+                           outputDepthPitch);
+}
+
+void ParallelLoadBlockImage(angle::WorkerThreadPool *workerPool,
+                            LoadImageFunction loadFunction,
+                            size_t inputBlockHeight,
+                            size_t outputBlockHeight,
+                            size_t width,
+                            size_t height,
+                            size_t depth,
+                            const uint8_t *input,
+                            size_t inputRowPitch,
+                            size_t inputDepthPitch,
+                            uint8_t *output,
+                            size_t outputRowPitch,
+                            size_t outputDepthPitch)
+{
+    ASSERT(inputBlockHeight % outputBlockHeight == 0);
+
+    size_t blockRows       = (height + inputBlockHeight - 1) / inputBlockHeight;
+    size_t outputBlockRows = (height + outputBlockHeight - 1) / outputBlockHeight;
+    size_t outputSize      = outputRowPitch * outputBlockRows * depth;
+    size_t taskCount       = GetParallelTaskCount(workerPool, outputSize);
+
+    // Slices are split when there are enough of them to keep every task busy, rows otherwise.
+    bool splitSlices = depth >= taskCount;
+    size_t bandUnits = splitSlices ? depth : blockRows;
+    taskCount        = std::min(taskCount, bandUnits);
+
+    if (taskCount < 2)
+    {
+        loadFunction(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
+                     outputRowPitch, outputDepthPitch);
+        return;
+    }
+
+    // Each row of input blocks is loaded into this many rows of output blocks.
+    size_t outputRowsPerBlockRow = inputBlockHeight / outputBlockHeight;
+
+    std::vector<ImageFunctionTask> tasks(taskCount);
+    for (size_t taskIndex = 0; taskIndex < taskCount; ++taskIndex)
+    {
+        size_t bandBegin = bandUnits * taskIndex / taskCount;
+        size_t bandEnd   = bandUnits * (taskIndex + 1) / taskCount;
+
+        ImageFunctionTask &task = tasks[taskIndex];
+        task.function           = loadFunction;
+        task.width              = width;
+        task.height             = height;
+        task.depth              = depth;
+        task.inputRowPitch      = inputRowPitch;
+        task.inputDepthPitch    = inputDepthPitch;
+        task.outputRowPitch     = outputRowPitch;
+        task.outputDepthPitch   = outputDepthPitch;
+        if (splitSlices)
+        {
+            task.depth = bandEnd - bandBegin;
+        }
+        else
+        {
+            // The last band ends with the partial block row, if there is one.
+            task.height =
+                std::min(bandEnd * inputBlockHeight, height) - bandBegin * inputBlockHeight;
+        }
+
+        size_t inputPitch  = splitSlices ? inputDepthPitch : inputRowPitch;
+        size_t outputPitch =
+            splitSlices ? outputDepthPitch : outputRowPitch * outputRowsPerBlockRow;
+        task.input         = input + bandBegin * inputPitch;
+        task.output        = output + bandBegin * outputPitch;
+    }
+
+    RunTasks(workerPool, &tasks);
+}
+
+void ParallelGenerateMip(angle::WorkerThreadPool *workerPool,
+                         MipGenerationFunction mipFunction,
+                         size_t sourceWidth,
+                         size_t sourceHeight,
+                         size_t sourceDepth,
+                         const uint8_t *sourceData,
+                         size_t sourceRowPitch,
+                         size_t sourceDepthPitch,
+                         uint8_t *destData,
+                         size_t destRowPitch,
+                         size_t destDepthPitch)
+{
+    size_t destHeight = GetMipSize(sourceHeight, 1);
+    size_t destDepth  = GetMipSize(sourceDepth, 1);
+    size_t taskCount  = GetParallelTaskCount(workerPool, destRowPitch * destHeight * destDepth);
+
+    // A band of destination rows or slices is generated from twice as many source rows or slices,
+    // so a dimension can only be split if the source has more than one of them.
+    bool splitSlices = sourceDepth > 1 && (destDepth >= taskCount || sourceHeight == 1);
+    size_t bandUnits = splitSlices ? destDepth : destHeight;
+    taskCount        = std::min(taskCount, bandUnits);
+
+    if (taskCount < 2 || (!splitSlices && sourceHeight == 1))
+    {
+        mipFunction(sourceWidth, sourceHeight, sourceDepth, sourceData, sourceRowPitch,
+                    sourceDepthPitch, destData, destRowPitch, destDepthPitch);
+        return;
+    }
+
+    std::vector<ImageFunctionTask> tasks(taskCount);
+    for (size_t taskIndex = 0; taskIndex < taskCount; ++taskIndex)
+    {
+        size_t bandBegin = bandUnits * taskIndex / taskCount;
+        size_t bandEnd   = bandUnits * (taskIndex + 1) / taskCount;
+
+        ImageFunctionTask &task = tasks[taskIndex];
+        task.function           = mipFunction;
+        task.width              = sourceWidth;
+        task.height             = splitSlices ? sourceHeight : 2 * (bandEnd - bandBegin);
+        task.depth              = splitSlices ? 2 * (bandEnd - bandBegin) : sourceDepth;
+        task.inputRowPitch      = sourceRowPitch;
+        task.inputDepthPitch    = sourceDepthPitch;
+        task.outputRowPitch     = destRowPitch;
+        task.outputDepthPitch   = destDepthPitch;
+
+        size_t inputPitch  = splitSlices ? sourceDepthPitch : sourceRowPitch;
+        size_t outputPitch = splitSlices ? destDepthPitch : destRowPitch;
+        task.input         = sourceData + 2 * bandBegin * inputPitch;
+        task.output        = destData + bandBegin * outputPitch;
+    }
+
+    RunTasks(workerPool, &tasks);
+}
+
+void GenerateMipChain(angle::WorkerThreadPool *workerPool,
+                      MipGenerationFunction mipFunction,
+                      size_t width,
+                      size_t height,
+                      size_t layerCount,
+                      const MipChainLevel *levels,
+                      size_t levelCount)
+{
+    size_t baseLevel = 0;
+    while (baseLevel + 1 < levelCount)
+    {
+        size_t baseWidth  = GetMipSize(width, baseLevel);
+        size_t baseHeight = GetMipSize(height, baseLevel);
+        if (baseHeight == 1)
+        {
+            // Levels with a single row can't be split, and are small enough to generate one after
+            // the other.
+            const MipChainLevel &source = levels[baseLevel];
+            const MipChainLevel &dest   = levels[baseLevel + 1];
+            for (size_t layer = 0; layer < layerCount; ++layer)
+            {
+                mipFunction(baseWidth, 1, 1, source.data + layer * source.depthPitch,
+                            source.rowPitch, source.depthPitch,
+                            dest.data + layer * dest.depthPitch, dest.rowPitch, dest.depthPitch);
+            }
+            ++baseLevel;
+            continue;
+        }
+
+        // A level can be generated from bands of the level above as long as that has more than
+        // one row.
+        size_t fusedLevelCount = 1;
+        while (fusedLevelCount < kMipChainMaxFusedLevels &&
+               baseLevel + fusedLevelCount + 1 < levelCount &&
+               GetMipSize(height, baseLevel + fusedLevelCount) > 1)
+        {
+            ++fusedLevelCount;
+        }
+
+        size_t alignment = size_t(1) << fusedLevelCount;
+        size_t bandRows  = kMipChainBandBytes / levels[baseLevel].rowPitch / alignment * alignment;
+
+        MipChainStep step;
+        step.mipFunction     = mipFunction;
+        step.levels          = levels;
+        step.width           = width;
+        step.height          = height;
+        step.baseLevel       = baseLevel;
+        step.fusedLevelCount = fusedLevelCount;
+        step.bandRows        = std::max(bandRows, alignment);
+        step.bandsPerLayer   = (baseHeight + step.bandRows - 1) / step.bandRows;
+
+        size_t bandCount = step.bandsPerLayer * layerCount;
+        size_t taskCount = std::min(
+            bandCount,
+            GetParallelTaskCount(workerPool, levels[baseLevel].rowPitch * baseHeight * layerCount));
+
+        if (taskCount < 2)
+        {
+            GenerateMipChainBands(step, 0, bandCount);
+        }
+        else
+        {
+            std::vector<MipChainTask> tasks(taskCount);
+            for (size_t taskIndex = 0; taskIndex < taskCount; ++taskIndex)
+            {
+                MipChainTask &task = tasks[taskIndex];
+                task.step          = &step;
+                task.firstBand     = bandCount * taskIndex / taskCount;
+                task.lastBand      = bandCount * (taskIndex + 1) / taskCount;
+            }
+            RunTasks(workerPool, &tasks);
+        }
+
+        baseLevel += fusedLevelCount;
+    }
+}
+
 bool ShouldUseDebugLayers(const egl::AttributeMap &attribs)
 {
     EGLAttrib debugSetting =
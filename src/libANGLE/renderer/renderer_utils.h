@@ -16,6 +16,7 @@
 #include <map>
 
 #include "common/angleutils.h"
+#include "libANGLE/WorkerThread.h"
 #include "libANGLE/angletypes.h"
 
 namespace angle
@@ -208,6 +209,75 @@ struct LoadImageFunctionInfo
 
 using LoadFunctionMap = LoadImageFunctionInfo (*)(GLenum);
 
+// Runs |loadFunction| over the image. Large images are split into bands of rows, or of slices for
+// 3D images with enough of them, which are converted in parallel on |workerPool| and on the
+// calling thread. Returns once all of the output has been written. Block compressed data must be
+// loaded with ParallelLoadBlockImage.
+void ParallelLoadImage(angle::WorkerThreadPool *workerPool,
+                       LoadImageFunction loadFunction,
+                       size_t width,
+                       size_t height,
+                       size_t depth,
+                       const uint8_t *input,
+                       size_t inputRowPitch,
+                       size_t inputDepthPitch,
+                       uint8_t *output,
+                       size_t outputRowPitch,
+                       size_t outputDepthPitch);
+
+// Like ParallelLoadImage, for input made of blocks of |inputBlockHeight| rows, which is loaded into
+// output blocks of |outputBlockHeight| rows. The input block height must be a multiple of the
+// output one. Bands start on input block rows, and |inputRowPitch| is the pitch of a row of
+// blocks; |outputRowPitch| is the pitch of a row of output blocks.
+void ParallelLoadBlockImage(angle::WorkerThreadPool *workerPool,
+                            LoadImageFunction loadFunction,
+                            size_t inputBlockHeight,
+                            size_t outputBlockHeight,
+                            size_t width,
+                            size_t height,
+                            size_t depth,
+                            const uint8_t *input,
+                            size_t inputRowPitch,
+                            size_t inputDepthPitch,
+                            uint8_t *output,
+                            size_t outputRowPitch,
+                            size_t outputDepthPitch);
+
+// Runs |mipFunction| to generate the mip of the source image, splitting large images into bands
+// of destination rows or slices like ParallelLoadImage.
+void ParallelGenerateMip(angle::WorkerThreadPool *workerPool,
+                         MipGenerationFunction mipFunction,
+                         size_t sourceWidth,
+                         size_t sourceHeight,
+                         size_t sourceDepth,
+                         const uint8_t *sourceData,
+                         size_t sourceRowPitch,
+                         size_t sourceDepthPitch,
+                         uint8_t *destData,
+                         size_t destRowPitch,
+                         size_t destDepthPitch);
+
+struct MipChainLevel
+{
+    uint8_t *data;
+    size_t rowPitch;
+    // Distance between the layers of a 2D array.
+    size_t depthPitch;
+};
+
+// Generates levels 1 to |levelCount| - 1 of each layer of a 2D image or 2D array from level 0.
+// Instead of filtering whole levels one after the other, which reads every level back from memory,
+// the chain is generated in bands of rows that go through several levels while they are still in
+// the cache. The bands are generated in parallel on |workerPool|. The results are the same as
+// running |mipFunction| on each level.
+void GenerateMipChain(angle::WorkerThreadPool *workerPool,
+                      MipGenerationFunction mipFunction,
+                      size_t width,
+                      size_t height,
+                      size_t layerCount,
+                      const MipChainLevel *levels,
+                      size_t levelCount);
+
 bool ShouldUseDebugLayers(const egl::AttributeMap &attribs);
 
 void CopyImageCHROMIUM(const uint8_t *sourceData,
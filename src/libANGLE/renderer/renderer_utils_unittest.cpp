@@ -0,0 +1,245 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// renderer_utils_unittest:
+//   Tests for the helpers shared by the back-ends.
+//
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "image_util/generatemip.h"
+#include "image_util/imageformats.h"
+#include "image_util/loadimage.h"
+#include "libANGLE/renderer/renderer_utils.h"
+
+using namespace rx;
+
+namespace
+{
+
+struct LoadImageCase
+{
+    size_t width;
+    size_t height;
+    size_t depth;
+};
+
+// Images split into bands of rows or slices are identical to images loaded in one go, and nothing
+// outside of the image is written.
+TEST(ParallelLoadImageTest, MatchesSerialLoad)
+{
+    angle::WorkerThreadPool workerPool(4);
+
+    // Small enough to load serially, tall 2D images split by rows, 3D images split by slices and
+    // 3D images with too few slices to split.
+    const LoadImageCase kCases[] = {
+        {16, 16, 1}, {1023, 1031, 1}, {129, 67, 40}, {517, 517, 3},
+    };
+
+    for (const LoadImageCase &loadCase : kCases)
+    {
+        const size_t inputRowPitch    = loadCase.width * 3 + 1;
+        const size_t inputDepthPitch  = inputRowPitch * loadCase.height + 7;
+        const size_t outputRowPitch   = loadCase.width * 4 + 12;
+        const size_t outputDepthPitch = outputRowPitch * loadCase.height + 4;
+
+        std::vector<uint8_t> input(inputDepthPitch * loadCase.depth);
+        for (size_t index = 0; index < input.size(); ++index)
+        {
+            input[index] = static_cast<uint8_t>(index * 7 + index / 251);
+        }
+
+        std::vector<uint8_t> expected(outputDepthPitch * loadCase.depth, 0xCD);
+        std::vector<uint8_t> actual(expected);
+
+        angle::LoadToNative3To4<uint8_t, 0xFF>(
+            loadCase.width, loadCase.height, loadCase.depth, input.data(), inputRowPitch,
+            inputDepthPitch, expected.data(), outputRowPitch, outputDepthPitch);
+        ParallelLoadImage(&workerPool, angle::LoadToNative3To4<uint8_t, 0xFF>, loadCase.width,
+                          loadCase.height, loadCase.depth, input.data(), inputRowPitch,
+                          inputDepthPitch, actual.data(), outputRowPitch, outputDepthPitch);
+
+        EXPECT_EQ(expected, actual) << loadCase.width << "x" << loadCase.height << "x"
+                                    << loadCase.depth;
+    }
+}
+
+// Block compressed images split into bands of block rows are identical to images loaded in one go,
+// when decoded to pixels and when transcoded to other blocks, including the partial block row at
+// the bottom.
+TEST(ParallelLoadImageTest, MatchesSerialBlockLoad)
+{
+    angle::WorkerThreadPool workerPool(4);
+
+    const LoadImageCase kCases[] = {
+        {16, 16, 1}, {1021, 1030, 1}, {130, 63, 40}, {517, 513, 3},
+    };
+
+    for (const LoadImageCase &loadCase : kCases)
+    {
+        const size_t blocksWide      = (loadCase.width + 3) / 4;
+        const size_t blocksHigh      = (loadCase.height + 3) / 4;
+        const size_t inputRowPitch   = blocksWide * 8;
+        const size_t inputDepthPitch = inputRowPitch * blocksHigh;
+
+        std::vector<uint8_t> input(inputDepthPitch * loadCase.depth);
+        for (size_t index = 0; index < input.size(); ++index)
+        {
+            input[index] = static_cast<uint8_t>(index * 7 + index / 251);
+        }
+
+        // Decoded to RGBA8, with the output block height of 1.
+        const size_t pixelRowPitch   = loadCase.width * 4 + 12;
+        const size_t pixelDepthPitch = pixelRowPitch * loadCase.height + 4;
+        std::vector<uint8_t> expected(pixelDepthPitch * loadCase.depth, 0xCD);
+        std::vector<uint8_t> actual(expected);
+        angle::LoadETC2RGB8ToRGBA8(loadCase.width, loadCase.height, loadCase.depth, input.data(),
+                                   inputRowPitch, inputDepthPitch, expected.data(), pixelRowPitch,
+                                   pixelDepthPitch);
+        ParallelLoadBlockImage(&workerPool, angle::LoadETC2RGB8ToRGBA8, 4, 1, loadCase.width,
+                               loadCase.height, loadCase.depth, input.data(), inputRowPitch,
+                               inputDepthPitch, actual.data(), pixelRowPitch, pixelDepthPitch);
+        EXPECT_EQ(expected, actual) << loadCase.width << "x" << loadCase.height << "x"
+                                    << loadCase.depth;
+
+        // Transcoded to BC1, with the same block height.
+        const size_t blockRowPitch   = inputRowPitch + 16;
+        const size_t blockDepthPitch = blockRowPitch * blocksHigh + 8;
+        expected.assign(blockDepthPitch * loadCase.depth, 0xCD);
+        actual = expected;
+        angle::LoadETC2RGB8ToBC1(loadCase.width, loadCase.height, loadCase.depth, input.data(),
+                                 inputRowPitch, inputDepthPitch, expected.data(), blockRowPitch,
+                                 blockDepthPitch);
+        ParallelLoadBlockImage(&workerPool, angle::LoadETC2RGB8ToBC1, 4, 4, loadCase.width,
+                               loadCase.height, loadCase.depth, input.data(), inputRowPitch,
+                               inputDepthPitch, actual.data(), blockRowPitch, blockDepthPitch);
+        EXPECT_EQ(expected, actual) << loadCase.width << "x" << loadCase.height << "x"
+                                    << loadCase.depth;
+    }
+}
+
+struct MipCase
+{
+    size_t width;
+    size_t height;
+    size_t depth;
+};
+
+// Mips split into bands of rows or slices are identical to mips generated in one go.
+TEST(ParallelGenerateMipTest, MatchesSerialMip)
+{
+    angle::WorkerThreadPool workerPool(4);
+
+    // Small enough to generate serially, 2D images split by rows, a single row, 3D images split by
+    // slices and by rows, and 3D images with single rows.
+    const MipCase kCases[] = {
+        {16, 16, 1}, {1025, 2049, 1}, {4096, 1, 1}, {258, 131, 80}, {1031, 1029, 3}, {512, 1, 4096},
+    };
+
+    for (const MipCase &mipCase : kCases)
+    {
+        const size_t sourceRowPitch   = mipCase.width * 4 + 8;
+        const size_t sourceDepthPitch = sourceRowPitch * mipCase.height + 4;
+        const size_t destRowPitch     = std::max<size_t>(1, mipCase.width / 2) * 4 + 12;
+        const size_t destDepthPitch   = destRowPitch * std::max<size_t>(1, mipCase.height / 2) + 4;
+        const size_t destDepth        = std::max<size_t>(1, mipCase.depth / 2);
+
+        std::vector<uint8_t> source(sourceDepthPitch * mipCase.depth);
+        for (size_t index = 0; index < source.size(); ++index)
+        {
+            source[index] = static_cast<uint8_t>(index * 7 + index / 251);
+        }
+
+        std::vector<uint8_t> expected(destDepthPitch * destDepth, 0xCD);
+        std::vector<uint8_t> actual(expected);
+
+        angle::GenerateMip<angle::R8G8B8A8>(mipCase.width, mipCase.height, mipCase.depth,
+                                            source.data(), sourceRowPitch, sourceDepthPitch,
+                                            expected.data(), destRowPitch, destDepthPitch);
+        ParallelGenerateMip(&workerPool, angle::GenerateMip<angle::R8G8B8A8>, mipCase.width,
+                            mipCase.height, mipCase.depth, source.data(), sourceRowPitch,
+                            sourceDepthPitch, actual.data(), destRowPitch, destDepthPitch);
+
+        EXPECT_EQ(expected, actual) << mipCase.width << "x" << mipCase.height << "x"
+                                    << mipCase.depth;
+    }
+}
+
+// Chains generated in bands, with and without workers, are identical to chains generated level by
+// level.
+TEST(GenerateMipChainTest, MatchesLevelByLevel)
+{
+    angle::WorkerThreadPool workerPool(4);
+
+    // Square, wide and tall images with odd sizes, and arrays. The depth is the layer count.
+    const MipCase kCases[] = {
+        {256, 256, 1}, {1024, 1024, 1}, {2047, 1023, 1}, {13, 3001, 1}, {3001, 13, 1}, {300, 200, 6},
+    };
+
+    for (const MipCase &mipCase : kCases)
+    {
+        size_t levelCount = 1;
+        while ((mipCase.width >> levelCount) > 0 || (mipCase.height >> levelCount) > 0)
+        {
+            ++levelCount;
+        }
+
+        std::vector<std::vector<uint8_t>> expected(levelCount);
+        std::vector<std::vector<uint8_t>> actual(levelCount);
+        std::vector<MipChainLevel> levels(levelCount);
+        for (size_t level = 0; level < levelCount; ++level)
+        {
+            size_t width  = std::max<size_t>(1, mipCase.width >> level);
+            size_t height = std::max<size_t>(1, mipCase.height >> level);
+
+            MipChainLevel &chainLevel = levels[level];
+            chainLevel.rowPitch       = width * 4 + 4;
+            chainLevel.depthPitch     = chainLevel.rowPitch * height + 8;
+            expected[level].resize(chainLevel.depthPitch * mipCase.depth, 0xCD);
+        }
+        for (size_t index = 0; index < expected[0].size(); ++index)
+        {
+            expected[0][index] = static_cast<uint8_t>(index * 13 + index / 241);
+        }
+
+        for (size_t layer = 0; layer < mipCase.depth; ++layer)
+        {
+            for (size_t level = 1; level < levelCount; ++level)
+            {
+                const MipChainLevel &source = levels[level - 1];
+                const MipChainLevel &dest   = levels[level];
+                angle::GenerateMip<angle::R8G8B8A8>(
+                    std::max<size_t>(1, mipCase.width >> (level - 1)),
+                    std::max<size_t>(1, mipCase.height >> (level - 1)), 1,
+                    expected[level - 1].data() + layer * source.depthPitch, source.rowPitch, 0,
+                    expected[level].data() + layer * dest.depthPitch, dest.rowPitch, 0);
+            }
+        }
+
+        for (angle::WorkerThreadPool *pool : {static_cast<angle::WorkerThreadPool *>(nullptr),
+                                              &workerPool})
+        {
+            actual[0] = expected[0];
+            for (size_t level = 1; level < levelCount; ++level)
+            {
+                actual[level].assign(expected[level].size(), 0xCD);
+            }
+            for (size_t level = 0; level < levelCount; ++level)
+            {
+                levels[level].data = actual[level].data();
+            }
+
+            GenerateMipChain(pool, angle::GenerateMip<angle::R8G8B8A8>, mipCase.width,
+                             mipCase.height, mipCase.depth, levels.data(), levelCount);
+
+            EXPECT_EQ(expected, actual) << mipCase.width << "x" << mipCase.height << "x"
+                                        << mipCase.depth;
+        }
+    }
+}
+
+}  // anonymous namespace
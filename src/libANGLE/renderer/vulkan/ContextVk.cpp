@@ -53,6 +53,7 @@ constexpr VkColorComponentFlags kAllColorChannelsMask =
 ContextVk::ContextVk(const gl::ContextState &state, RendererVk *renderer)
     : ContextImpl(state),
       mRenderer(renderer),
+      mCurrentPipelineEvictionCount(0),
       mCurrentDrawMode(GL_NONE),
       mDynamicDescriptorPool(),
       mTexturesDirty(false),
@@ -133,6 +134,7 @@ gl::Error ContextVk::initPipeline()
     // TODO(jmadill): Validate with ASSERT against physical device limits/caps?
     ANGLE_TRY(mRenderer->getAppPipeline(programVk, *mPipelineDesc, activeAttribLocationsMask,
                                         &mCurrentPipeline));
+    mCurrentPipelineEvictionCount = mRenderer->getPipelineCacheStats().evictionCount;
 
     return gl::NoError();
 }
@@ -148,6 +150,12 @@ gl::Error ContextVk::setupDraw(const gl::Context *context,
         mCurrentDrawMode = drawCallParams.mode();
     }
 
+    // The current pipeline may have been evicted from the cache since it was queried.
+    if (mCurrentPipelineEvictionCount != mRenderer->getPipelineCacheStats().evictionCount)
+    {
+        invalidateCurrentPipeline();
+    }
+
     if (!mCurrentPipeline)
     {
         ANGLE_TRY(initPipeline());
@@ -175,6 +175,7 @@ class ContextVk : public ContextImpl
 
     RendererVk *mRenderer;
     vk::PipelineAndSerial *mCurrentPipeline;
+    size_t mCurrentPipelineEvictionCount;
     GLenum mCurrentDrawMode;
 
     // Keep a cached pipeline description structure that can be used to query the pipeline cache.
@@ -155,6 +155,7 @@ gl::Version DisplayVk::getMaxSupportedESVersion() const
 
 void DisplayVk::generateExtensions(egl::DisplayExtensions *outExtensions) const
 {
+    outExtensions->deferredCommandStream = true;
 }
 
 void DisplayVk::generateCaps(egl::Caps *outCaps) const
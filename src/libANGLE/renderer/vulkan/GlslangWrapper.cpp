@@ -21,6 +21,7 @@
 #include "common/string_utils.h"
 #include "common/utilities.h"
 #include "libANGLE/ProgramLinkedResources.h"
+#include "libANGLE/renderer/vulkan/SpirvCache.h"
 
 namespace rx
 {
@@ -61,6 +62,65 @@ void InsertQualifierSpecifierString(std::string *shaderString,
     angle::ReplaceSubstring(shaderString, searchString, replacementString);
 }
 
+// Parses, links and generates the SPIR-V of a single stage. The Vulkan GLSL of each stage declares
+// all of its interface locations explicitly, so the stages don't need to be linked together.
+class CompileStageTask final : public angle::Closure
+{
+  public:
+    CompileStageTask(EShLanguage language, const std::string &source, const char *stageName)
+        : mLanguage(language), mSource(source), mStageName(stageName), mError(gl::NoError())
+    {
+    }
+
+    void operator()() override { mError = run(); }
+
+    const std::string &getSource() const { return mSource; }
+    const gl::Error &getError() const { return mError; }
+    std::vector<uint32_t> releaseCode() { return std::move(mCode); }
+
+  private:
+    gl::Error run()
+    {
+        const char *string = mSource.c_str();
+        int length         = static_cast<int>(mSource.length());
+
+        // Enable SPIR-V and Vulkan rules when parsing GLSL
+        EShMessages messages = static_cast<EShMessages>(EShMsgSpvRules | EShMsgVulkanRules);
+
+        glslang::TShader shader(mLanguage);
+        shader.setStringsWithLengths(&string, &length, 1);
+        shader.setEntryPoint("main");
+        bool parseResult = shader.parse(&glslang::DefaultTBuiltInResource, 450, ECoreProfile,
+                                        false, false, messages);
+        if (!parseResult)
+        {
+            return gl::InternalError() << "Internal error parsing Vulkan " << mStageName
+                                       << " shader:\n"
+                                       << shader.getInfoLog() << "\n"
+                                       << shader.getInfoDebugLog() << "\n";
+        }
+
+        glslang::TProgram program;
+        program.addShader(&shader);
+        bool linkResult = program.link(messages);
+        if (!linkResult)
+        {
+            return gl::InternalError() << "Internal error linking Vulkan " << mStageName
+                                       << " shader:\n"
+                                       << program.getInfoLog() << "\n";
+        }
+
+        glslang::GlslangToSpv(*program.getIntermediate(mLanguage), mCode);
+        return gl::NoError();
+    }
+
+    EShLanguage mLanguage;
+    std::string mSource;
+    const char *mStageName;
+    gl::Error mError;
+    std::vector<uint32_t> mCode;
+};
+
 }  // anonymous namespace
 
 // static
@@ -215,53 +275,66 @@ gl::LinkResult GlslangWrapper::linkProgram(const gl::Context *glContext,
         textureCount += samplerUniform.getBasicTypeElementCount();
     }
 
-    std::array<const char *, 2> strings = {{vertexSource.c_str(), fragmentSource.c_str()}};
-    std::array<int, 2> lengths = {
-        {static_cast<int>(vertexSource.length()), static_cast<int>(fragmentSource.length())}};
+    ANGLE_TRY(compileToSpirv(glContext->getWorkerThreadPool(), vertexSource, fragmentSource,
+                             vertexCodeOut, fragmentCodeOut));
+    return true;
+}
+
+gl::Error GlslangWrapper::compileToSpirv(angle::WorkerThreadPool *workerPool,
+                                         const std::string &vertexSource,
+                                         const std::string &fragmentSource,
+                                         std::vector<uint32_t> *vertexCodeOut,
+                                         std::vector<uint32_t> *fragmentCodeOut)
+{
+    SpirvCache *cache = SpirvCache::GetInstance();
 
-    // Enable SPIR-V and Vulkan rules when parsing GLSL
-    EShMessages messages = static_cast<EShMessages>(EShMsgSpvRules | EShMsgVulkanRules);
+    CompileStageTask vertexTask(EShLangVertex, vertexSource, "vertex");
+    CompileStageTask fragmentTask(EShLangFragment, fragmentSource, "fragment");
 
-    glslang::TShader vertexShader(EShLangVertex);
-    vertexShader.setStringsWithLengths(&strings[0], &lengths[0], 1);
-    vertexShader.setEntryPoint("main");
-    bool vertexResult = vertexShader.parse(&glslang::DefaultTBuiltInResource, 450, ECoreProfile,
-                                           false, false, messages);
-    if (!vertexResult)
+    std::array<CompileStageTask *, 2> tasks = {{&vertexTask, &fragmentTask}};
+    std::array<gl::ShaderType, 2> shaderTypes = {{gl::ShaderType::Vertex, gl::ShaderType::Fragment}};
+    std::array<std::vector<uint32_t> *, 2> codeOut = {{vertexCodeOut, fragmentCodeOut}};
+
+    // Look the stages up first, and only compile the ones that missed. The stages are
+    // independent, so they compile in parallel.
+    std::array<SpirvKey, 2> keys;
+    std::array<std::shared_ptr<const SpirvCode>, 2> cachedCode;
+    std::array<angle::WaitableEvent, 2> waitableEvents;
+    for (size_t stage = 0; stage < tasks.size(); ++stage)
     {
-        return gl::InternalError() << "Internal error parsing Vulkan vertex shader:\n"
-                                   << vertexShader.getInfoLog() << "\n"
-                                   << vertexShader.getInfoDebugLog() << "\n";
+        keys[stage]       = SpirvCache::ComputeKey(shaderTypes[stage], tasks[stage]->getSource());
+        cachedCode[stage] = cache->get(keys[stage]);
+        if (!cachedCode[stage])
+        {
+            waitableEvents[stage] = workerPool->postWorkerTask(tasks[stage]);
+        }
     }
 
-    glslang::TShader fragmentShader(EShLangFragment);
-    fragmentShader.setStringsWithLengths(&strings[1], &lengths[1], 1);
-    fragmentShader.setEntryPoint("main");
-    bool fragmentResult = fragmentShader.parse(&glslang::DefaultTBuiltInResource, 450, ECoreProfile,
-                                               false, false, messages);
-    if (!fragmentResult)
+    for (size_t stage = 0; stage < tasks.size(); ++stage)
     {
-        return gl::InternalError() << "Internal error parsing Vulkan fragment shader:\n"
-                                   << fragmentShader.getInfoLog() << "\n"
-                                   << fragmentShader.getInfoDebugLog() << "\n";
+        if (!cachedCode[stage])
+        {
+            waitableEvents[stage].wait();
+        }
     }
 
-    glslang::TProgram program;
-    program.addShader(&vertexShader);
-    program.addShader(&fragmentShader);
-    bool linkResult = program.link(messages);
-    if (!linkResult)
+    for (size_t stage = 0; stage < tasks.size(); ++stage)
     {
-        return gl::InternalError() << "Internal error linking Vulkan shaders:\n"
-                                   << program.getInfoLog() << "\n";
-    }
+        if (cachedCode[stage])
+        {
+            *codeOut[stage] = *cachedCode[stage];
+            continue;
+        }
 
-    glslang::TIntermediate *vertexStage   = program.getIntermediate(EShLangVertex);
-    glslang::TIntermediate *fragmentStage = program.getIntermediate(EShLangFragment);
-    glslang::GlslangToSpv(*vertexStage, *vertexCodeOut);
-    glslang::GlslangToSpv(*fragmentStage, *fragmentCodeOut);
+        ANGLE_TRY(tasks[stage]->getError());
 
-    return true;
+        // Failed compiles are not cached, so that they keep reporting their info log.
+        std::shared_ptr<SpirvCode> code(new SpirvCode(tasks[stage]->releaseCode()));
+        *codeOut[stage] = *code;
+        cache->put(keys[stage], std::move(code));
+    }
+
+    return gl::NoError();
 }
 
 }  // namespace rx
@@ -10,6 +10,7 @@
 #define LIBANGLE_RENDERER_VULKAN_GLSLANG_WRAPPER_H_
 
 #include "libANGLE/RefCountObject.h"
+#include "libANGLE/WorkerThread.h"
 #include "libANGLE/renderer/ProgramImpl.h"
 
 namespace rx
@@ -29,6 +30,14 @@ class GlslangWrapper : public gl::RefCountObjectNoID
                                std::vector<uint32_t> *vertexCodeOut,
                                std::vector<uint32_t> *fragmentCodeOut);
 
+    // Generates the SPIR-V of both stages from their Vulkan GLSL. Stages found in the SpirvCache
+    // skip glslang, and the others are compiled in parallel on the worker pool.
+    gl::Error compileToSpirv(angle::WorkerThreadPool *workerPool,
+                             const std::string &vertexSource,
+                             const std::string &fragmentSource,
+                             std::vector<uint32_t> *vertexCodeOut,
+                             std::vector<uint32_t> *fragmentCodeOut);
+
   private:
     GlslangWrapper();
     ~GlslangWrapper() override;
@@ -151,6 +151,7 @@ ProgramVk::ProgramVk(const gl::ProgramState &state)
       mUsedDescriptorSetRange(),
       mDirtyTextures(true)
 {
+    mShaderKey.fill(0);
     mUniformBlocksOffsets.fill(0);
     mUsedDescriptorSetRange.invalidate();
 }
@@ -260,6 +261,11 @@ gl::LinkResult ProgramVk::link(const gl::Context *glContext,
         mFragmentModuleSerial = renderer->issueShaderSerial();
     }
 
+    // Pipelines this program created in previous runs are built again before the first draw.
+    mShaderKey = vk::ComputeShaderKey(vertexCode, fragmentCode);
+    renderer->prebuildPipelines(mShaderKey, mVertexModuleSerial, mFragmentModuleSerial,
+                                std::move(vertexCode), std::move(fragmentCode));
+
     ANGLE_TRY(initDefaultUniformBlocks(glContext));
 
     if (!mState.getSamplerUniformRange().empty())
@@ -104,6 +104,9 @@ class ProgramVk : public ProgramImpl
     const vk::ShaderModule &getLinkedFragmentModule() const;
     Serial getFragmentModuleSerial() const;
 
+    // Identifies the linked SPIR-V across runs, for the persisted pipeline cache.
+    const vk::ShaderKey &getShaderKey() const { return mShaderKey; }
+
     vk::Error updateUniforms(ContextVk *contextVk);
 
     const std::vector<VkDescriptorSet> &getDescriptorSets() const;
@@ -140,6 +143,7 @@ class ProgramVk : public ProgramImpl
     Serial mVertexModuleSerial;
     vk::ShaderModule mLinkedFragmentModule;
     Serial mFragmentModuleSerial;
+    vk::ShaderKey mShaderKey;
 
     // State for the default uniform blocks.
     struct DefaultUniformBlock final : private angle::NonCopyable
@@ -13,15 +13,18 @@
 #include "libANGLE/renderer/vulkan/vk_utils.h"
 
 #include <EGL/eglext.h>
+#include <stdio.h>
 
 #include "common/debug.h"
 #include "common/system_utils.h"
+#include "libANGLE/Constants.h"
 #include "libANGLE/renderer/driver_utils.h"
 #include "libANGLE/renderer/vulkan/CommandGraph.h"
 #include "libANGLE/renderer/vulkan/CompilerVk.h"
 #include "libANGLE/renderer/vulkan/FramebufferVk.h"
 #include "libANGLE/renderer/vulkan/GlslangWrapper.h"
 #include "libANGLE/renderer/vulkan/ProgramVk.h"
+#include "libANGLE/renderer/vulkan/SpirvCache.h"
 #include "libANGLE/renderer/vulkan/TextureVk.h"
 #include "libANGLE/renderer/vulkan/VertexArrayVk.h"
 #include "libANGLE/renderer/vulkan/vk_caps_utils.h"
@@ -45,6 +48,66 @@ namespace
 // one for the vertex shader.
 constexpr size_t kUniformBufferDescriptorsPerDescriptorSet = 2;
 
+// The persisted pipeline cache is looked up with the platform's blob cache first, and otherwise
+// read from the program cache directory.
+constexpr char kPipelineCacheBlobKey[]  = "ANGLE Vulkan pipeline cache";
+constexpr char kPipelineCacheFileName[] = "vk_pipeline_cache.bin";
+
+// Recording stops once this many pipelines have been recorded.
+constexpr size_t kMaxPipelineDescRecords = 1024;
+
+std::string GetPipelineCacheFilePath()
+{
+    std::string directory = angle::GetEnvironmentVar(gl::kProgramCacheDirectoryEnvVar);
+    if (directory.empty())
+    {
+        return std::string();
+    }
+    return directory + "/" + kPipelineCacheFileName;
+}
+
+bool ReadPipelineCacheFile(const std::string &path, std::vector<uint8_t> *dataOut)
+{
+    FILE *file = fopen(path.c_str(), "rb");
+    if (!file)
+    {
+        return false;
+    }
+
+    bool success = false;
+    if (fseek(file, 0, SEEK_END) == 0)
+    {
+        long size = ftell(file);
+        if (size > 0 && fseek(file, 0, SEEK_SET) == 0)
+        {
+            dataOut->resize(static_cast<size_t>(size));
+            success = fread(dataOut->data(), 1, dataOut->size(), file) == dataOut->size();
+        }
+    }
+
+    fclose(file);
+    return success;
+}
+
+void WritePipelineCacheFile(const std::string &path, const std::vector<uint8_t> &data)
+{
+    // Written next to the file and renamed over it, so a crash can't leave a torn file behind.
+    std::string tempPath = path + ".tmp";
+    FILE *file           = fopen(tempPath.c_str(), "wb");
+    if (!file)
+    {
+        return;
+    }
+
+    bool success = fwrite(data.data(), 1, data.size(), file) == data.size();
+    success      = (fclose(file) == 0) && success;
+    if (!success || rename(tempPath.c_str(), path.c_str()) != 0)
+    {
+        WARN() << "Failed to write the Vulkan pipeline cache to " << path << ".";
+        remove(tempPath.c_str());
+    }
+}
+
 VkResult VerifyExtensionsPresent(const std::vector<VkExtensionProperties> &extensionProps,
                                  const std::vector<const char *> &enabledExtensionNames)
 {
@@ -163,6 +226,109 @@ class ScopedVkLoaderEnvironment : angle::NonCopyable
 
 }  // anonymous namespace
 
+// Builds the pipelines recorded for a program's shaders. Runs on a worker thread, so it makes its
+// own shader modules and RenderPasses rather than sharing the ones owned by the main thread.
+class RendererVk::PrebuildPipelinesTask final : public angle::Closure
+{
+  public:
+    PrebuildPipelinesTask(VkDevice device,
+                          const vk::PipelineCache &pipelineCacheVk,
+                          const vk::PipelineLayout &pipelineLayout,
+                          std::vector<uint32_t> &&vertexCode,
+                          std::vector<uint32_t> &&fragmentCode,
+                          std::vector<vk::PipelineDescRecord> &&records)
+        : mDevice(device),
+          mPipelineCacheVk(pipelineCacheVk),
+          mPipelineLayout(pipelineLayout),
+          mVertexCode(std::move(vertexCode)),
+          mFragmentCode(std::move(fragmentCode)),
+          mRecords(std::move(records)),
+          mPipelines(mRecords.size()),
+          mError(vk::NoError())
+    {
+    }
+
+    void operator()() override
+    {
+        vk::ShaderModule vertexModule;
+        vk::ShaderModule fragmentModule;
+        mError = buildPipelines(&vertexModule, &fragmentModule);
+        vertexModule.destroy(mDevice);
+        fragmentModule.destroy(mDevice);
+    }
+
+    void setWaitableEvent(angle::WaitableEvent &&waitableEvent)
+    {
+        mWaitableEvent = std::move(waitableEvent);
+    }
+    angle::WaitableEvent &getWaitableEvent() { return mWaitableEvent; }
+
+    // Moves the pipelines into the cache. Pipelines the cache already has are destroyed.
+    void collect(PipelineCache *pipelineCache)
+    {
+        if (mError.isError())
+        {
+            WARN() << "Error prebuilding Vulkan pipelines: " << mError;
+        }
+
+        for (size_t index = 0; index < mRecords.size(); ++index)
+        {
+            if (mPipelines[index].valid())
+            {
+                pipelineCache->populate(mRecords[index].desc, std::move(mPipelines[index]));
+                mPipelines[index].destroy(mDevice);
+            }
+        }
+    }
+
+  private:
+    vk::Error initShaderModule(const std::vector<uint32_t> &code, vk::ShaderModule *shaderModule)
+    {
+        VkShaderModuleCreateInfo createInfo;
+        createInfo.sType    = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+        createInfo.pNext    = nullptr;
+        createInfo.flags    = 0;
+        createInfo.codeSize = code.size() * sizeof(uint32_t);
+        createInfo.pCode    = code.data();
+
+        return shaderModule->init(mDevice, createInfo);
+    }
+
+    vk::Error buildPipelines(vk::ShaderModule *vertexModule, vk::ShaderModule *fragmentModule)
+    {
+        ANGLE_TRY(initShaderModule(mVertexCode, vertexModule));
+        ANGLE_TRY(initShaderModule(mFragmentCode, fragmentModule));
+
+        for (size_t index = 0; index < mRecords.size(); ++index)
+        {
+            const vk::PipelineDescRecord &record = mRecords[index];
+
+            vk::RenderPass compatibleRenderPass;
+            ANGLE_TRY(vk::InitializeCompatibleRenderPass(
+                mDevice, record.desc.getRenderPassDesc(), &compatibleRenderPass));
+
+            vk::Error error = record.desc.initializePipeline(
+                mDevice, mPipelineCacheVk, compatibleRenderPass, mPipelineLayout,
+                record.activeAttribLocationsMask, *vertexModule, *fragmentModule,
+                &mPipelines[index]);
+            compatibleRenderPass.destroy(mDevice);
+            ANGLE_TRY(error);
+        }
+
+        return vk::NoError();
+    }
+
+    VkDevice mDevice;
+    const vk::PipelineCache &mPipelineCacheVk;
+    const vk::PipelineLayout &mPipelineLayout;
+    std::vector<uint32_t> mVertexCode;
+    std::vector<uint32_t> mFragmentCode;
+    std::vector<vk::PipelineDescRecord> mRecords;
+    std::vector<vk::Pipeline> mPipelines;
+    vk::Error mError;
+    angle::WaitableEvent mWaitableEvent;
+};
+
 // CommandBatch implementation.
 RendererVk::CommandBatch::CommandBatch()
 {
@@ -198,7 +364,8 @@ RendererVk::RendererVk()
       mGlslangWrapper(nullptr),
       mLastCompletedQueueSerial(mQueueSerialFactory.generate()),
       mCurrentQueueSerial(mQueueSerialFactory.generate()),
-      mInFlightCommands()
+      mInFlightCommands(),
+      mWorkerThreadPool(1)
 {
 }
 
@@ -214,6 +381,14 @@ RendererVk::~RendererVk()
         }
     }
 
+    // Prebuilds still running use the pipeline layout.
+    collectPrebuiltPipelines(true);
+    if (mPipelineCacheVk.valid())
+    {
+        savePipelineCacheVk();
+        mPipelineCacheVk.destroy(mDevice);
+    }
+
     for (auto &descriptorSetLayout : mGraphicsDescriptorSetLayouts)
     {
         descriptorSetLayout.destroy(mDevice);
@@ -446,6 +621,9 @@ vk::Error RendererVk::initialize(const egl::AttributeMap &attribs, const char *w
     mMemoryProperties.init(mPhysicalDevice);
 
     mGlslangWrapper = GlslangWrapper::GetReference();
+    SpirvCache::GetInstance()->configure(
+        gl::kDefaultMaxSpirvCacheMemoryBytes,
+        angle::GetEnvironmentVar(gl::kProgramCacheDirectoryEnvVar));
 
     // Initialize the format table.
     mFormatTable.initialize(mPhysicalDevice, &mNativeTextureCaps,
@@ -534,9 +712,158 @@ vk::Error RendererVk::initializeDevice(uint32_t queueFamilyIndex)
 
     ANGLE_TRY(mCommandPool.init(mDevice, commandPoolInfo));
 
+    ANGLE_TRY(initPipelineCacheVk());
+
     return vk::NoError();
 }
 
+vk::Error RendererVk::initPipelineCacheVk()
+{
+    std::vector<uint8_t> packedData;
+
+    angle::PlatformMethods *platform = ANGLEPlatformCurrent();
+    size_t blobSize = platform->getBlob(platform, kPipelineCacheBlobKey,
+                                        sizeof(kPipelineCacheBlobKey), nullptr, 0);
+    if (blobSize > 0)
+    {
+        packedData.resize(blobSize);
+        if (platform->getBlob(platform, kPipelineCacheBlobKey, sizeof(kPipelineCacheBlobKey),
+                              packedData.data(), packedData.size()) != blobSize)
+        {
+            packedData.clear();
+        }
+    }
+    else
+    {
+        std::string path = GetPipelineCacheFilePath();
+        if (!path.empty() && !ReadPipelineCacheFile(path, &packedData))
+        {
+            packedData.clear();
+        }
+    }
+
+    // Data left behind by another device or driver is dropped.
+    std::vector<uint8_t> cacheData;
+    if (!packedData.empty() &&
+        !vk::UnpackPipelineCacheData(mPhysicalDeviceProperties, packedData.data(),
+                                     packedData.size(), &cacheData, &mPipelineDescRecords))
+    {
+        cacheData.clear();
+        mPipelineDescRecords.clear();
+    }
+
+    VkPipelineCacheCreateInfo createInfo;
+    createInfo.sType           = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    createInfo.pNext           = nullptr;
+    createInfo.flags           = 0;
+    createInfo.initialDataSize = cacheData.size();
+    createInfo.pInitialData    = cacheData.empty() ? nullptr : cacheData.data();
+
+    ANGLE_TRY(mPipelineCacheVk.init(mDevice, createInfo));
+    return vk::NoError();
+}
+
+void RendererVk::savePipelineCacheVk()
+{
+    std::vector<uint8_t> cacheData;
+    vk::Error error = mPipelineCacheVk.getCacheData(mDevice, &cacheData);
+    if (error.isError())
+    {
+        WARN() << "Error reading the Vulkan pipeline cache: " << error;
+        return;
+    }
+
+    std::vector<uint8_t> packedData;
+    vk::PackPipelineCacheData(mPhysicalDeviceProperties, cacheData, mPipelineDescRecords,
+                              &packedData);
+
+    angle::PlatformMethods *platform = ANGLEPlatformCurrent();
+    platform->setBlob(platform, kPipelineCacheBlobKey, sizeof(kPipelineCacheBlobKey),
+                      packedData.data(), packedData.size());
+
+    std::string path = GetPipelineCacheFilePath();
+    if (!path.empty())
+    {
+        WritePipelineCacheFile(path, packedData);
+    }
+}
+
+void RendererVk::recordPipelineDesc(const vk::ShaderKey &shaderKey,
+                                    const vk::PipelineDesc &desc,
+                                    const gl::AttributesMask &activeAttribLocationsMask)
+{
+    if (mPipelineDescRecords.size() >= kMaxPipelineDescRecords)
+    {
+        return;
+    }
+
+    vk::PipelineDescRecord record;
+    record.shaderKey = shaderKey;
+    record.desc      = desc;
+    record.desc.updateShaders(Serial(), Serial());
+    record.activeAttribLocationsMask = activeAttribLocationsMask;
+
+    // Records loaded from a previous run are not in the pipeline cache until prebuilt.
+    for (const vk::PipelineDescRecord &existing : mPipelineDescRecords)
+    {
+        if (existing.shaderKey == record.shaderKey && existing.desc == record.desc &&
+            existing.activeAttribLocationsMask == record.activeAttribLocationsMask)
+        {
+            return;
+        }
+    }
+
+    mPipelineDescRecords.push_back(record);
+}
+
+void RendererVk::prebuildPipelines(const vk::ShaderKey &shaderKey,
+                                   Serial vertexModuleSerial,
+                                   Serial fragmentModuleSerial,
+                                   std::vector<uint32_t> &&vertexCode,
+                                   std::vector<uint32_t> &&fragmentCode)
+{
+    std::vector<vk::PipelineDescRecord> records;
+    for (const vk::PipelineDescRecord &record : mPipelineDescRecords)
+    {
+        if (record.shaderKey == shaderKey)
+        {
+            records.push_back(record);
+            records.back().desc.updateShaders(vertexModuleSerial, fragmentModuleSerial);
+        }
+    }
+
+    if (records.empty() || !mPipelineCacheVk.valid())
+    {
+        return;
+    }
+
+    std::unique_ptr<PrebuildPipelinesTask> task(new PrebuildPipelinesTask(
+        mDevice, mPipelineCacheVk, mGraphicsPipelineLayout, std::move(vertexCode),
+        std::move(fragmentCode), std::move(records)));
+    task->setWaitableEvent(mWorkerThreadPool.postWorkerTask(task.get()));
+    mPrebuildTasks.push_back(std::move(task));
+}
+
+void RendererVk::collectPrebuiltPipelines(bool waitForAll)
+{
+    size_t keepCount = 0;
+    for (size_t index = 0; index < mPrebuildTasks.size(); ++index)
+    {
+        std::unique_ptr<PrebuildPipelinesTask> &task = mPrebuildTasks[index];
+        if (waitForAll || task->getWaitableEvent().isReady())
+        {
+            task->getWaitableEvent().wait();
+            task->collect(&mPipelineCache);
+            task.reset();
+        }
+        else
+        {
+            std::swap(mPrebuildTasks[keepCount++], task);
+        }
+    }
+    mPrebuildTasks.resize(keepCount);
+}
+
 vk::ErrorOrResult<uint32_t> RendererVk::selectPresentQueueForSurface(VkSurfaceKHR surface)
 {
     // We've already initialized a device, and can't re-create it unless it's never been used.
@@ -739,6 +1066,10 @@ vk::Error RendererVk::checkInFlightCommands()
         mGarbage.erase(mGarbage.begin(), mGarbage.begin() + freeIndex);
     }
 
+    // Evict cached objects over the cache limits that the GPU is done with.
+    mPipelineCache.trim(mDevice, mLastCompletedQueueSerial);
+    mRenderPassCache.trim(mDevice, mLastCompletedQueueSerial);
+
     return vk::NoError();
 }
 
@@ -995,12 +1326,23 @@ vk::Error RendererVk::getAppPipeline(const ProgramVk *programVk,
     ASSERT(programVk->getFragmentModuleSerial() ==
            desc.getShaderStageInfo()[vk::ShaderType::FragmentShader].moduleSerial);
 
+    if (!mPrebuildTasks.empty())
+    {
+        collectPrebuiltPipelines(false);
+    }
+
+    if (!mPipelineCache.contains(desc))
+    {
+        recordPipelineDesc(programVk->getShaderKey(), desc, activeAttribLocationsMask);
+    }
+
     // Pull in a compatible RenderPass.
     vk::RenderPass *compatibleRenderPass = nullptr;
     ANGLE_TRY(getCompatibleRenderPass(desc.getRenderPassDesc(), &compatibleRenderPass));
 
-    return mPipelineCache.getPipeline(mDevice, *compatibleRenderPass, mGraphicsPipelineLayout,
-                                      activeAttribLocationsMask, programVk->getLinkedVertexModule(),
+    return mPipelineCache.getPipeline(mDevice, mPipelineCacheVk, *compatibleRenderPass,
+                                      mGraphicsPipelineLayout, activeAttribLocationsMask,
+                                      programVk->getLinkedVertexModule(),
                                       programVk->getLinkedFragmentModule(), desc, pipelineOut);
 }
 
@@ -1020,8 +1362,8 @@ vk::Error RendererVk::getInternalPipeline(const vk::ShaderAndSerial &vertexShade
     vk::RenderPass *compatibleRenderPass = nullptr;
     ANGLE_TRY(getCompatibleRenderPass(pipelineDesc.getRenderPassDesc(), &compatibleRenderPass));
 
-    return mPipelineCache.getPipeline(mDevice, *compatibleRenderPass, pipelineLayout,
-                                      activeAttribLocationsMask, vertexShader.get(),
+    return mPipelineCache.getPipeline(mDevice, mPipelineCacheVk, *compatibleRenderPass,
+                                      pipelineLayout, activeAttribLocationsMask, vertexShader.get(),
                                       fragmentShader.get(), pipelineDesc, pipelineOut);
 }
 
@@ -15,6 +15,7 @@
 
 #include "common/angleutils.h"
 #include "libANGLE/Caps.h"
+#include "libANGLE/WorkerThread.h"
 #include "libANGLE/renderer/vulkan/CommandGraph.h"
 #include "libANGLE/renderer/vulkan/vk_format_utils.h"
 #include "libANGLE/renderer/vulkan/vk_internal_shaders.h"
@@ -127,6 +128,10 @@ class RendererVk : angle::NonCopyable
                                   const gl::AttributesMask &activeAttribLocationsMask,
                                   vk::PipelineAndSerial **pipelineOut);
 
+    // Pipelines are evicted from the cache after a submit. Anything holding on to a pipeline
+    // across submits checks the eviction count.
+    const vk::CacheStats &getPipelineCacheStats() const { return mPipelineCache.getStats(); }
+
     // This should only be called from ResourceVk.
     // TODO(jmadill): Keep in ContextVk to enable threaded rendering.
     vk::CommandGraphNode *allocateCommandNode();
@@ -140,6 +145,14 @@ class RendererVk : angle::NonCopyable
     // Issues a new serial for linked shader modules. Used in the pipeline cache.
     Serial issueShaderSerial();
 
+    // Starts building the pipelines recorded for these shaders in previous runs on a worker
+    // thread. They are added to the pipeline cache once built. Called when a program is linked.
+    void prebuildPipelines(const vk::ShaderKey &shaderKey,
+                           Serial vertexModuleSerial,
+                           Serial fragmentModuleSerial,
+                           std::vector<uint32_t> &&vertexCode,
+                           std::vector<uint32_t> &&fragmentCode);
+
     vk::ShaderLibrary *getShaderLibrary();
 
   private:
@@ -150,6 +163,12 @@ class RendererVk : angle::NonCopyable
     void freeAllInFlightResources();
     vk::Error flushCommandGraph(const gl::Context *context, vk::CommandBuffer *commandBatch);
     vk::Error initGraphicsPipelineLayout();
+    vk::Error initPipelineCacheVk();
+    void savePipelineCacheVk();
+    void recordPipelineDesc(const vk::ShaderKey &shaderKey,
+                            const vk::PipelineDesc &desc,
+                            const gl::AttributesMask &activeAttribLocationsMask);
+    void collectPrebuiltPipelines(bool waitForAll);
 
     mutable bool mCapsInitialized;
     mutable gl::Caps mNativeCaps;
@@ -193,6 +212,15 @@ class RendererVk : angle::NonCopyable
     RenderPassCache mRenderPassCache;
     PipelineCache mPipelineCache;
 
+    // The driver's pipeline cache, persisted between runs together with the descriptions of the
+    // pipelines the application created. The pipelines are built again on a worker thread when a
+    // program with the same shaders is linked.
+    vk::PipelineCache mPipelineCacheVk;
+    std::vector<vk::PipelineDescRecord> mPipelineDescRecords;
+    angle::WorkerThreadPool mWorkerThreadPool;
+    class PrebuildPipelinesTask;
+    std::vector<std::unique_ptr<PrebuildPipelinesTask>> mPrebuildTasks;
+
     // See CommandGraph.h for a desription of the Command Graph.
     vk::CommandGraph mCommandGraph;
 
@@ -32,6 +32,7 @@ ShCompileOptions ShaderVk::prepareSourceAndReturnOptions(const gl::Context *cont
 
 bool ShaderVk::postTranslateCompile(const gl::Context *context,
                                     gl::Compiler *compiler,
+                                    ShHandle compilerHandle,
                                     std::string *infoLog)
 {
     // No work to do here.
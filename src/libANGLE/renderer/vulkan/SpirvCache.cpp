@@ -0,0 +1,298 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// SpirvCache.cpp: Implements the process-wide cache of SPIR-V generated by glslang.
+//
+
+#include "libANGLE/renderer/vulkan/SpirvCache.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <thread>
+
+#include "common/debug.h"
+#include "common/third_party/base/anglebase/sha1.h"
+#include "common/third_party/smhasher/src/PMurHash.h"
+#include "common/version.h"
+
+namespace rx
+{
+
+namespace
+{
+// A cache file is a FileHeader followed by the SPIR-V words. Values are stored in host byte order.
+// Files written by other versions of ANGLE are never looked up, since the commit hash is part of
+// the key.
+constexpr uint32_t kFileMagic     = 0x56534E41;  // "ANSV"
+constexpr uint32_t kFormatVersion = 1;
+constexpr char kFileSuffix[]      = ".anglespv";
+
+constexpr size_t kDefaultMaxMemorySize = 4 * 1024 * 1024;
+
+struct FileHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint8_t key[std::tuple_size<SpirvKey>::value];
+    uint32_t wordCount;
+    uint32_t checksum;
+};
+
+uint32_t ComputeChecksum(const SpirvCode &code)
+{
+    return angle::PMurHash32(0, code.data(), static_cast<int>(code.size() * sizeof(uint32_t)));
+}
+
+size_t GetCodeSize(const SpirvCode &code)
+{
+    return code.size() * sizeof(uint32_t);
+}
+
+}  // anonymous namespace
+
+size_t SpirvKeyHash::operator()(const SpirvKey &key) const
+{
+    // The key is already a hash.
+    size_t value = 0;
+    memcpy(&value, key.data(), sizeof(value));
+    return value;
+}
+
+SpirvCache::SpirvCache()
+    : mMaxMemorySize(kDefaultMaxMemorySize), mMemorySize(0), mHitCount(0), mMissCount(0)
+{
+}
+
+SpirvCache::~SpirvCache()
+{
+}
+
+// static
+SpirvCache *SpirvCache::GetInstance()
+{
+    // Intentionally leaked, so that programs linked during shutdown can still use it.
+    static SpirvCache *instance = new SpirvCache();
+    return instance;
+}
+
+// static
+SpirvKey SpirvCache::ComputeKey(gl::ShaderType shaderType, const std::string &source)
+{
+    std::string keyData = ANGLE_COMMIT_HASH;
+    keyData += '\0';
+    keyData += static_cast<char>(shaderType);
+    keyData += source;
+
+    SpirvKey key;
+    angle::base::SHA1HashBytes(reinterpret_cast<const unsigned char *>(keyData.data()),
+                               keyData.size(), key.data());
+    return key;
+}
+
+void SpirvCache::configure(size_t maxMemorySizeBytes, const std::string &directory)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mMaxMemorySize = maxMemorySizeBytes;
+    mDirectory     = directory;
+    evictToSize(mMaxMemorySize);
+}
+
+std::shared_ptr<const SpirvCode> SpirvCache::get(const SpirvKey &key)
+{
+    std::string path;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        auto iter = mEntryMap.find(key);
+        if (iter != mEntryMap.end())
+        {
+            mEntries.splice(mEntries.begin(), mEntries, iter->second);
+            ++mHitCount;
+            return iter->second->code;
+        }
+        if (!mDirectory.empty())
+        {
+            path = getFilePath(key);
+        }
+    }
+
+    // Read the backing file without holding the lock, so that other links are not blocked on the
+    // file system.
+    std::shared_ptr<const SpirvCode> code;
+    if (!path.empty())
+    {
+        code = loadFile(key, path);
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (code)
+    {
+        ++mHitCount;
+    }
+    else
+    {
+        ++mMissCount;
+    }
+    return code;
+}
+
+void SpirvCache::put(const SpirvKey &key, std::shared_ptr<const SpirvCode> code)
+{
+    std::string path;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        insert(key, code);
+        if (!mDirectory.empty())
+        {
+            path = getFilePath(key);
+        }
+    }
+
+    if (!path.empty())
+    {
+        storeFile(key, path, *code);
+    }
+}
+
+void SpirvCache::clear()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mEntries.clear();
+    mEntryMap.clear();
+    mMemorySize = 0;
+    mHitCount   = 0;
+    mMissCount  = 0;
+}
+
+size_t SpirvCache::getHitCount() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mHitCount;
+}
+
+size_t SpirvCache::getMissCount() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mMissCount;
+}
+
+size_t SpirvCache::getMemorySize() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mMemorySize;
+}
+
+void SpirvCache::insert(const SpirvKey &key, std::shared_ptr<const SpirvCode> code)
+{
+    size_t size = GetCodeSize(*code);
+    if (size > mMaxMemorySize)
+    {
+        return;
+    }
+
+    auto iter = mEntryMap.find(key);
+    if (iter != mEntryMap.end())
+    {
+        // Another link compiled the same shader concurrently.
+        mEntries.splice(mEntries.begin(), mEntries, iter->second);
+        return;
+    }
+
+    evictToSize(mMaxMemorySize - size);
+
+    Entry entry = {key, std::move(code), size};
+    mEntries.push_front(std::move(entry));
+    mEntryMap[key] = mEntries.begin();
+    mMemorySize += size;
+}
+
+void SpirvCache::evictToSize(size_t maxSize)
+{
+    while (mMemorySize > maxSize)
+    {
+        ASSERT(!mEntries.empty());
+        const Entry &entry = mEntries.back();
+        mMemorySize -= entry.size;
+        mEntryMap.erase(entry.key);
+        mEntries.pop_back();
+    }
+}
+
+std::string SpirvCache::getFilePath(const SpirvKey &key) const
+{
+    static const char kHexDigits[] = "0123456789abcdef";
+
+    std::string path = mDirectory + "/";
+    for (uint8_t byte : key)
+    {
+        path += kHexDigits[byte >> 4];
+        path += kHexDigits[byte & 0xF];
+    }
+    return path + kFileSuffix;
+}
+
+std::shared_ptr<const SpirvCode> SpirvCache::loadFile(const SpirvKey &key, const std::string &path)
+{
+    FILE *file = fopen(path.c_str(), "rb");
+    if (!file)
+    {
+        return nullptr;
+    }
+
+    FileHeader header;
+    std::shared_ptr<SpirvCode> code(new SpirvCode());
+    bool valid = fread(&header, sizeof(header), 1, file) == 1 && header.magic == kFileMagic &&
+                 header.version == kFormatVersion &&
+                 memcmp(header.key, key.data(), key.size()) == 0;
+    if (valid)
+    {
+        code->resize(header.wordCount);
+        valid = fread(code->data(), sizeof(uint32_t), code->size(), file) == code->size() &&
+                fgetc(file) == EOF && !code->empty() && ComputeChecksum(*code) == header.checksum;
+    }
+    fclose(file);
+
+    if (!valid)
+    {
+        // Torn or corrupt file, most likely from a process that crashed while writing it.
+        remove(path.c_str());
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    insert(key, code);
+    return code;
+}
+
+void SpirvCache::storeFile(const SpirvKey &key, const std::string &path, const SpirvCode &code)
+{
+    // Write to a file private to this thread first so that readers never see a partial file.
+    std::string tempPath =
+        path + ".tmp" + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id()));
+
+    FILE *file = fopen(tempPath.c_str(), "wb");
+    if (!file)
+    {
+        return;
+    }
+
+    FileHeader header;
+    header.magic   = kFileMagic;
+    header.version = kFormatVersion;
+    memcpy(header.key, key.data(), key.size());
+    header.wordCount = static_cast<uint32_t>(code.size());
+    header.checksum  = ComputeChecksum(code);
+
+    bool written = fwrite(&header, sizeof(header), 1, file) == 1 &&
+                   fwrite(code.data(), sizeof(uint32_t), code.size(), file) == code.size();
+    written      = fclose(file) == 0 && written;
+
+    if (!written || rename(tempPath.c_str(), path.c_str()) != 0)
+    {
+        remove(tempPath.c_str());
+    }
+}
+
+}  // namespace rx
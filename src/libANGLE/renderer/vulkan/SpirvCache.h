@@ -0,0 +1,97 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// SpirvCache.h: Process-wide cache of the SPIR-V that glslang generates for the Vulkan GLSL of a
+// shader stage. Entries are keyed by a hash of the GLSL text after the link-time rewrites, so
+// relinking a program whose shaders were already compiled skips glslang entirely. The cache can
+// be backed by a directory, in which case the SPIR-V is also found by later processes.
+//
+
+#ifndef LIBANGLE_RENDERER_VULKAN_SPIRVCACHE_H_
+#define LIBANGLE_RENDERER_VULKAN_SPIRVCACHE_H_
+
+#include <array>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/angleutils.h"
+#include "libANGLE/PackedEnums.h"
+
+namespace rx
+{
+
+using SpirvKey  = std::array<uint8_t, 20>;
+using SpirvCode = std::vector<uint32_t>;
+
+struct SpirvKeyHash
+{
+    size_t operator()(const SpirvKey &key) const;
+};
+
+class SpirvCache : angle::NonCopyable
+{
+  public:
+    SpirvCache();
+    ~SpirvCache();
+
+    // The cache shared by all renderers of the process.
+    static SpirvCache *GetInstance();
+
+    // Hashes the GLSL of a stage with the stage and the ANGLE version.
+    static SpirvKey ComputeKey(gl::ShaderType shaderType, const std::string &source);
+
+    // Sets the memory budget and the backing directory. An empty directory keeps the cache in
+    // memory only. Entries over the new budget are evicted.
+    void configure(size_t maxMemorySizeBytes, const std::string &directory);
+
+    // Returns nullptr on a miss. Entries missing from memory are looked up in the backing
+    // directory.
+    std::shared_ptr<const SpirvCode> get(const SpirvKey &key);
+
+    // Stores the SPIR-V of a stage, in memory and in the backing directory.
+    void put(const SpirvKey &key, std::shared_ptr<const SpirvCode> code);
+
+    // Drops the entries kept in memory. Files in the backing directory are left alone.
+    void clear();
+
+    size_t getHitCount() const;
+    size_t getMissCount() const;
+    size_t getMemorySize() const;
+
+  private:
+    struct Entry
+    {
+        SpirvKey key;
+        std::shared_ptr<const SpirvCode> code;
+        size_t size;
+    };
+    using EntryList = std::list<Entry>;
+
+    void insert(const SpirvKey &key, std::shared_ptr<const SpirvCode> code);
+    void evictToSize(size_t maxSize);
+    std::string getFilePath(const SpirvKey &key) const;
+    std::shared_ptr<const SpirvCode> loadFile(const SpirvKey &key, const std::string &path);
+    void storeFile(const SpirvKey &key, const std::string &path, const SpirvCode &code);
+
+    mutable std::mutex mMutex;
+    size_t mMaxMemorySize;
+    size_t mMemorySize;
+    std::string mDirectory;
+
+    // Most recently used entries first.
+    EntryList mEntries;
+    std::unordered_map<SpirvKey, EntryList::iterator, SpirvKeyHash> mEntryMap;
+
+    size_t mHitCount;
+    size_t mMissCount;
+};
+
+}  // namespace rx
+
+#endif  // LIBANGLE_RENDERER_VULKAN_SPIRVCACHE_H_
@@ -0,0 +1,204 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// SpirvCache_unittest:
+//   Tests for the cache of the SPIR-V generated by glslang, and for the compiles that fill it.
+//   No device is needed.
+
+#include <gtest/gtest.h>
+
+#include <stdio.h>
+
+#include "common/system_utils.h"
+#include "libANGLE/renderer/vulkan/GlslangWrapper.h"
+#include "libANGLE/renderer/vulkan/SpirvCache.h"
+
+using namespace rx;
+
+namespace
+{
+
+constexpr uint32_t kSpirvMagicNumber = 0x07230203;
+
+const char kVertexSource[] = R"(#version 450 core
+layout(location = 0) in vec4 position;
+layout(location = 0) out vec4 color;
+void main()
+{
+    gl_Position = position;
+    color = position * 0.5;
+})";
+
+const char kFragmentSource[] = R"(#version 450 core
+layout(location = 0) in vec4 color;
+layout(location = 0) out vec4 fragColor;
+void main()
+{
+    fragColor = color;
+})";
+
+std::shared_ptr<const SpirvCode> MakeCode(size_t wordCount, uint32_t value)
+{
+    return std::shared_ptr<const SpirvCode>(new SpirvCode(wordCount, value));
+}
+
+class SpirvCacheTest : public testing::Test
+{
+  protected:
+    void SetUp() override { mCache.configure(1024 * 1024, ""); }
+
+    SpirvCache mCache;
+};
+
+// Keys depend on both the source and the stage.
+TEST_F(SpirvCacheTest, Keys)
+{
+    SpirvKey vertexKey = SpirvCache::ComputeKey(gl::ShaderType::Vertex, kVertexSource);
+    EXPECT_EQ(vertexKey, SpirvCache::ComputeKey(gl::ShaderType::Vertex, kVertexSource));
+    EXPECT_NE(vertexKey, SpirvCache::ComputeKey(gl::ShaderType::Fragment, kVertexSource));
+    EXPECT_NE(vertexKey, SpirvCache::ComputeKey(gl::ShaderType::Vertex, kFragmentSource));
+}
+
+// Entries that were put are found again, and lookups are counted.
+TEST_F(SpirvCacheTest, HitAndMiss)
+{
+    SpirvKey key = SpirvCache::ComputeKey(gl::ShaderType::Vertex, kVertexSource);
+    EXPECT_EQ(nullptr, mCache.get(key));
+
+    mCache.put(key, MakeCode(16, 1));
+    std::shared_ptr<const SpirvCode> code = mCache.get(key);
+    ASSERT_NE(nullptr, code);
+    EXPECT_EQ(SpirvCode(16, 1), *code);
+
+    EXPECT_EQ(1u, mCache.getHitCount());
+    EXPECT_EQ(1u, mCache.getMissCount());
+    EXPECT_EQ(16u * sizeof(uint32_t), mCache.getMemorySize());
+
+    mCache.clear();
+    EXPECT_EQ(nullptr, mCache.get(key));
+    EXPECT_EQ(0u, mCache.getMemorySize());
+}
+
+// The least recently used entries are evicted once the cache is over budget.
+TEST_F(SpirvCacheTest, Eviction)
+{
+    constexpr size_t kWordCount = 16;
+    mCache.configure(2 * kWordCount * sizeof(uint32_t), "");
+
+    SpirvKey key0 = SpirvCache::ComputeKey(gl::ShaderType::Vertex, "0");
+    SpirvKey key1 = SpirvCache::ComputeKey(gl::ShaderType::Vertex, "1");
+    SpirvKey key2 = SpirvCache::ComputeKey(gl::ShaderType::Vertex, "2");
+
+    mCache.put(key0, MakeCode(kWordCount, 0));
+    mCache.put(key1, MakeCode(kWordCount, 1));
+
+    // Using key0 makes key1 the least recently used entry.
+    EXPECT_NE(nullptr, mCache.get(key0));
+    mCache.put(key2, MakeCode(kWordCount, 2));
+
+    EXPECT_NE(nullptr, mCache.get(key0));
+    EXPECT_EQ(nullptr, mCache.get(key1));
+    EXPECT_NE(nullptr, mCache.get(key2));
+    EXPECT_EQ(2 * kWordCount * sizeof(uint32_t), mCache.getMemorySize());
+}
+
+// Entries are found in the backing directory by another cache, and corrupt files are ignored.
+TEST_F(SpirvCacheTest, BackingDirectory)
+{
+    std::string directory = angle::GetExecutableDirectory();
+    ASSERT_FALSE(directory.empty());
+    mCache.configure(1024 * 1024, directory);
+
+    SpirvKey key = SpirvCache::ComputeKey(gl::ShaderType::Fragment, kFragmentSource);
+    mCache.put(key, MakeCode(32, 7));
+
+    SpirvCache otherCache;
+    otherCache.configure(1024 * 1024, directory);
+    std::shared_ptr<const SpirvCode> code = otherCache.get(key);
+    ASSERT_NE(nullptr, code);
+    EXPECT_EQ(SpirvCode(32, 7), *code);
+    EXPECT_EQ(1u, otherCache.getHitCount());
+
+    // Flip the last byte of the file, which the checksum catches.
+    static const char kHexDigits[] = "0123456789abcdef";
+    std::string path               = directory + "/";
+    for (uint8_t byte : key)
+    {
+        path += kHexDigits[byte >> 4];
+        path += kHexDigits[byte & 0xF];
+    }
+    path += ".anglespv";
+
+    FILE *file = fopen(path.c_str(), "r+b");
+    ASSERT_NE(nullptr, file);
+    ASSERT_EQ(0, fseek(file, -1, SEEK_END));
+    int lastByte = fgetc(file);
+    ASSERT_EQ(0, fseek(file, -1, SEEK_END));
+    fputc(lastByte ^ 0xFF, file);
+    fclose(file);
+
+    SpirvCache corruptCache;
+    corruptCache.configure(1024 * 1024, directory);
+    EXPECT_EQ(nullptr, corruptCache.get(key));
+    EXPECT_EQ(1u, corruptCache.getMissCount());
+
+    // The corrupt file was removed.
+    file = fopen(path.c_str(), "rb");
+    EXPECT_EQ(nullptr, file);
+    if (file)
+    {
+        fclose(file);
+    }
+}
+
+// Both stages are compiled with glslang on the worker pool, and relinking them hits the cache.
+TEST(SpirvCompileTest, CompileAndCache)
+{
+    SpirvCache *cache = SpirvCache::GetInstance();
+    cache->configure(1024 * 1024, "");
+    cache->clear();
+
+    GlslangWrapper *glslangWrapper = GlslangWrapper::GetReference();
+    angle::WorkerThreadPool workerPool(2);
+
+    std::vector<uint32_t> vertexCode;
+    std::vector<uint32_t> fragmentCode;
+    gl::Error error = glslangWrapper->compileToSpirv(&workerPool, kVertexSource, kFragmentSource,
+                                                     &vertexCode, &fragmentCode);
+    EXPECT_FALSE(error.isError());
+    ASSERT_FALSE(vertexCode.empty());
+    ASSERT_FALSE(fragmentCode.empty());
+    EXPECT_EQ(kSpirvMagicNumber, vertexCode[0]);
+    EXPECT_EQ(kSpirvMagicNumber, fragmentCode[0]);
+    EXPECT_EQ(0u, cache->getHitCount());
+    EXPECT_EQ(2u, cache->getMissCount());
+
+    std::vector<uint32_t> cachedVertexCode;
+    std::vector<uint32_t> cachedFragmentCode;
+    error = glslangWrapper->compileToSpirv(&workerPool, kVertexSource, kFragmentSource,
+                                           &cachedVertexCode, &cachedFragmentCode);
+    EXPECT_FALSE(error.isError());
+    EXPECT_EQ(vertexCode, cachedVertexCode);
+    EXPECT_EQ(fragmentCode, cachedFragmentCode);
+    EXPECT_EQ(2u, cache->getHitCount());
+
+    // Failed compiles report the stage and are not cached.
+    error = glslangWrapper->compileToSpirv(&workerPool, kVertexSource, "not glsl", &vertexCode,
+                                           &fragmentCode);
+    EXPECT_TRUE(error.isError());
+    EXPECT_NE(std::string::npos, error.getMessage().find("fragment"));
+    EXPECT_EQ(3u, cache->getHitCount());
+    EXPECT_EQ(3u, cache->getMissCount());
+
+    error = glslangWrapper->compileToSpirv(&workerPool, kVertexSource, "not glsl", &vertexCode,
+                                           &fragmentCode);
+    EXPECT_TRUE(error.isError());
+    EXPECT_EQ(4u, cache->getMissCount());
+
+    GlslangWrapper::ReleaseReference();
+    cache->clear();
+}
+
+}  // anonymous namespace
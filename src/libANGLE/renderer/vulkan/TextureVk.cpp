@@ -79,7 +79,7 @@ void PixelBuffer::release(RendererVk *renderer)
     mStagingBuffer.release(renderer);
 }
 
-gl::Error PixelBuffer::stageSubresourceUpdate(ContextVk *contextVk,
+gl::Error PixelBuffer::stageSubresourceUpdate(const gl::Context *context,
                                               const gl::ImageIndex &index,
                                               const gl::Extents &extents,
                                               const gl::Offset &offset,
@@ -88,6 +88,8 @@ gl::Error PixelBuffer::stageSubresourceUpdate(ContextVk *contextVk,
                                               GLenum type,
                                               const uint8_t *pixels)
 {
+    ContextVk *contextVk = vk::GetImpl(context);
+
     GLuint inputRowPitch = 0;
     ANGLE_TRY_RESULT(
         formatInfo.computeRowPitch(type, extents.width, unpack.alignment, unpack.rowLength),
@@ -127,8 +129,9 @@ gl::Error PixelBuffer::stageSubresourceUpdate(ContextVk *contextVk,
 
     LoadImageFunctionInfo loadFunction = vkFormat.loadFunctions(type);
 
-    loadFunction.loadFunction(extents.width, extents.height, extents.depth, source, inputRowPitch,
-                              inputDepthPitch, stagingPointer, outputRowPitch, outputDepthPitch);
+    ParallelLoadImage(context->getWorkerThreadPool(), loadFunction.loadFunction, extents.width,
+                      extents.height, extents.depth, source, inputRowPitch, inputDepthPitch,
+                      stagingPointer, outputRowPitch, outputDepthPitch);
 
     VkBufferImageCopy copy;
 
@@ -350,7 +353,7 @@ gl::Error TextureVk::setImage(const gl::Context *context,
     // Handle initial data.
     if (pixels)
     {
-        ANGLE_TRY(mPixelBuffer.stageSubresourceUpdate(contextVk, index, size, gl::Offset(),
+        ANGLE_TRY(mPixelBuffer.stageSubresourceUpdate(context, index, size, gl::Offset(),
                                                       formatInfo, unpack, type, pixels));
     }
 
@@ -368,7 +371,7 @@ gl::Error TextureVk::setSubImage(const gl::Context *context,
     ContextVk *contextVk                 = vk::GetImpl(context);
     const gl::InternalFormat &formatInfo = gl::GetInternalFormatInfo(format, type);
     ANGLE_TRY(mPixelBuffer.stageSubresourceUpdate(
-        contextVk, index, gl::Extents(area.width, area.height, area.depth),
+        context, index, gl::Extents(area.width, area.height, area.depth),
         gl::Offset(area.x, area.y, area.z), formatInfo, unpack, type, pixels));
 
     // Create a new graph node to store image initialization commands.
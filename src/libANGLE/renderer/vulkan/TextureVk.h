@@ -26,7 +26,7 @@ class PixelBuffer final : angle::NonCopyable
 
     void release(RendererVk *renderer);
 
-    gl::Error stageSubresourceUpdate(ContextVk *contextVk,
+    gl::Error stageSubresourceUpdate(const gl::Context *context,
                                      const gl::ImageIndex &index,
                                      const gl::Extents &extents,
                                      const gl::Offset &offset,
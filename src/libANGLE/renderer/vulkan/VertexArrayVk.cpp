@@ -10,6 +10,7 @@
 #include "libANGLE/renderer/vulkan/VertexArrayVk.h"
 
 #include "common/debug.h"
+#include "common/utilities.h"
 
 #include "libANGLE/Context.h"
 #include "libANGLE/renderer/vulkan/BufferVk.h"
@@ -119,21 +120,18 @@ gl::Error VertexArrayVk::streamIndexData(RendererVk *renderer,
 
     uint32_t offset = 0;
 
-    const GLsizei amount = sizeof(GLushort) * drawCallParams.indexCount();
+    // Unsigned bytes don't have direct support in Vulkan so we have to expand them to GLushort.
+    const GLenum dstType = (drawCallParams.type() == GL_UNSIGNED_BYTE) ? GL_UNSIGNED_SHORT
+                                                                       : drawCallParams.type();
+    const GLsizei amount = gl::GetTypeInfo(dstType).bytes * drawCallParams.indexCount();
     GLubyte *dst         = nullptr;
 
     ANGLE_TRY(mDynamicIndexData.allocate(renderer, amount, &dst, &mCurrentElementArrayBufferHandle,
                                          &offset, nullptr));
-    if (drawCallParams.type() == GL_UNSIGNED_BYTE)
+    if (dstType != drawCallParams.type())
     {
-        // Unsigned bytes don't have direct support in Vulkan so we have to expand the
-        // memory to a GLushort.
-        const GLubyte *in     = static_cast<const GLubyte *>(drawCallParams.indices());
-        GLushort *expandedDst = reinterpret_cast<GLushort *>(dst);
-        for (GLsizei index = 0; index < drawCallParams.indexCount(); index++)
-        {
-            expandedDst[index] = static_cast<GLushort>(in[index]);
-        }
+        gl::ConvertIndices(drawCallParams.type(), drawCallParams.indices(),
+                           drawCallParams.indexCount(), false, dstType, dst);
     }
     else
     {
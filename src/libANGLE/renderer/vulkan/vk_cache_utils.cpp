@@ -11,6 +11,8 @@
 #include "libANGLE/renderer/vulkan/vk_cache_utils.h"
 
 #include "common/aligned_memory.h"
+#include "common/third_party/base/anglebase/sha1.h"
+#include "common/third_party/smhasher/src/PMurHash.h"
 #include "libANGLE/SizedMRUCache.h"
 #include "libANGLE/VertexAttribute.h"
 #include "libANGLE/renderer/vulkan/ProgramVk.h"
@@ -241,8 +243,193 @@ Error InitializeRenderPassFromDesc(VkDevice device,
     return vk::NoError();
 }
 
+// Attachment ops don't affect RenderPass compatibility, so any will do.
+void InitializeDummyAttachmentOps(const RenderPassDesc &desc, AttachmentOpsArray *opsOut)
+{
+    for (uint32_t colorIndex = 0; colorIndex < desc.colorAttachmentCount(); ++colorIndex)
+    {
+        opsOut->initDummyOp(colorIndex, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+                            VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+    }
+
+    if (desc.depthStencilAttachmentCount() > 0)
+    {
+        opsOut->initDummyOp(desc.colorAttachmentCount(),
+                            VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
+                            VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL);
+    }
+}
+
+constexpr uint32_t kPipelineCacheDataMagic   = 0x41504343;  // "APCC"
+constexpr uint32_t kPipelineCacheDataVersion = 1;
+
+// Every field is a multiple of four bytes, so the header has no padding.
+struct PipelineCacheDataHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t pipelineDescSize;
+    uint32_t vendorID;
+    uint32_t deviceID;
+    uint32_t driverVersion;
+    uint8_t pipelineCacheUUID[VK_UUID_SIZE];
+    uint32_t cacheDataSize;
+    uint32_t recordCount;
+    uint32_t checksum;
+};
+
+// A record is stored as its shader key, its attribute mask and the raw bytes of the description.
+constexpr size_t kPipelineDescRecordSize =
+    sizeof(ShaderKey) + sizeof(uint32_t) + sizeof(PipelineDesc);
+
+uint32_t ComputePipelineCacheChecksum(const uint8_t *data, size_t length)
+{
+    static const uint32_t seed = 0x414E474C;
+    return angle::PMurHash32(seed, data, static_cast<int>(length));
+}
+
+void InitPipelineCacheDataHeader(const VkPhysicalDeviceProperties &physicalDeviceProperties,
+                                 PipelineCacheDataHeader *headerOut)
+{
+    memset(headerOut, 0, sizeof(PipelineCacheDataHeader));
+    headerOut->magic            = kPipelineCacheDataMagic;
+    headerOut->version          = kPipelineCacheDataVersion;
+    headerOut->pipelineDescSize = static_cast<uint32_t>(sizeof(PipelineDesc));
+    headerOut->vendorID         = physicalDeviceProperties.vendorID;
+    headerOut->deviceID         = physicalDeviceProperties.deviceID;
+    headerOut->driverVersion    = physicalDeviceProperties.driverVersion;
+    memcpy(headerOut->pipelineCacheUUID, physicalDeviceProperties.pipelineCacheUUID,
+           VK_UUID_SIZE);
+}
 }  // anonymous namespace
 
+ShaderKey ComputeShaderKey(const std::vector<uint32_t> &vertexCode,
+                           const std::vector<uint32_t> &fragmentCode)
+{
+    // The vertex code size is included so the boundary between the shaders can't move.
+    std::vector<uint8_t> keyData(sizeof(uint32_t) +
+                                 (vertexCode.size() + fragmentCode.size()) * sizeof(uint32_t));
+    uint32_t vertexCodeSize = static_cast<uint32_t>(vertexCode.size());
+    uint8_t *keyBytes       = keyData.data();
+    memcpy(keyBytes, &vertexCodeSize, sizeof(uint32_t));
+    keyBytes += sizeof(uint32_t);
+    if (!vertexCode.empty())
+    {
+        memcpy(keyBytes, vertexCode.data(), vertexCode.size() * sizeof(uint32_t));
+        keyBytes += vertexCode.size() * sizeof(uint32_t);
+    }
+    if (!fragmentCode.empty())
+    {
+        memcpy(keyBytes, fragmentCode.data(), fragmentCode.size() * sizeof(uint32_t));
+    }
+
+    ShaderKey key;
+    angle::base::SHA1HashBytes(keyData.data(), keyData.size(), key.data());
+    return key;
+}
+
+void PackPipelineCacheData(const VkPhysicalDeviceProperties &physicalDeviceProperties,
+                           const std::vector<uint8_t> &cacheData,
+                           const std::vector<PipelineDescRecord> &records,
+                           std::vector<uint8_t> *packedOut)
+{
+    PipelineCacheDataHeader header;
+    InitPipelineCacheDataHeader(physicalDeviceProperties, &header);
+    header.cacheDataSize = static_cast<uint32_t>(cacheData.size());
+    header.recordCount   = static_cast<uint32_t>(records.size());
+
+    packedOut->resize(sizeof(PipelineCacheDataHeader) + cacheData.size() +
+                      records.size() * kPipelineDescRecordSize);
+    uint8_t *payload = packedOut->data() + sizeof(PipelineCacheDataHeader);
+
+    uint8_t *output = payload;
+    if (!cacheData.empty())
+    {
+        memcpy(output, cacheData.data(), cacheData.size());
+        output += cacheData.size();
+    }
+
+    for (const PipelineDescRecord &record : records)
+    {
+        uint32_t attribMask = static_cast<uint32_t>(record.activeAttribLocationsMask.bits());
+        memcpy(output, record.shaderKey.data(), sizeof(ShaderKey));
+        output += sizeof(ShaderKey);
+        memcpy(output, &attribMask, sizeof(uint32_t));
+        output += sizeof(uint32_t);
+        memcpy(output, &record.desc, sizeof(PipelineDesc));
+        output += sizeof(PipelineDesc);
+    }
+
+    header.checksum =
+        ComputePipelineCacheChecksum(payload, packedOut->size() - sizeof(PipelineCacheDataHeader));
+    memcpy(packedOut->data(), &header, sizeof(PipelineCacheDataHeader));
+}
+
+bool UnpackPipelineCacheData(const VkPhysicalDeviceProperties &physicalDeviceProperties,
+                             const uint8_t *packed,
+                             size_t packedSize,
+                             std::vector<uint8_t> *cacheDataOut,
+                             std::vector<PipelineDescRecord> *recordsOut)
+{
+    if (packedSize < sizeof(PipelineCacheDataHeader))
+    {
+        return false;
+    }
+
+    PipelineCacheDataHeader header;
+    memcpy(&header, packed, sizeof(PipelineCacheDataHeader));
+
+    // Everything up to the sizes must match what this device and driver would write.
+    PipelineCacheDataHeader expected;
+    InitPipelineCacheDataHeader(physicalDeviceProperties, &expected);
+    if (memcmp(&header, &expected, offsetof(PipelineCacheDataHeader, cacheDataSize)) != 0)
+    {
+        return false;
+    }
+
+    const uint8_t *payload = packed + sizeof(PipelineCacheDataHeader);
+    size_t payloadSize     = packedSize - sizeof(PipelineCacheDataHeader);
+    if (header.cacheDataSize > payloadSize ||
+        (payloadSize - header.cacheDataSize) / kPipelineDescRecordSize != header.recordCount ||
+        (payloadSize - header.cacheDataSize) % kPipelineDescRecordSize != 0)
+    {
+        return false;
+    }
+
+    if (ComputePipelineCacheChecksum(payload, payloadSize) != header.checksum)
+    {
+        return false;
+    }
+
+    cacheDataOut->assign(payload, payload + header.cacheDataSize);
+
+    const uint8_t *input = payload + header.cacheDataSize;
+    recordsOut->resize(header.recordCount);
+    for (PipelineDescRecord &record : *recordsOut)
+    {
+        uint32_t attribMask = 0;
+        memcpy(record.shaderKey.data(), input, sizeof(ShaderKey));
+        input += sizeof(ShaderKey);
+        memcpy(&attribMask, input, sizeof(uint32_t));
+        input += sizeof(uint32_t);
+        memcpy(&record.desc, input, sizeof(PipelineDesc));
+        input += sizeof(PipelineDesc);
+
+        record.activeAttribLocationsMask = gl::AttributesMask(attribMask);
+    }
+
+    return true;
+}
+
+Error InitializeCompatibleRenderPass(VkDevice device,
+                                     const RenderPassDesc &desc,
+                                     RenderPass *renderPass)
+{
+    AttachmentOpsArray ops;
+    InitializeDummyAttachmentOps(desc, &ops);
+    return InitializeRenderPassFromDesc(device, desc, ops, renderPass);
+}
+
 // RenderPassDesc implementation.
 RenderPassDesc::RenderPassDesc()
 {
@@ -337,6 +524,7 @@ void PipelineDesc::operator delete(void *ptr)
 PipelineDesc::PipelineDesc()
 {
     memset(this, 0, sizeof(PipelineDesc));
+    rehash();
 }
 
 PipelineDesc::~PipelineDesc()
@@ -354,9 +542,55 @@ PipelineDesc &PipelineDesc::operator=(const PipelineDesc &other)
     return *this;
 }
 
-size_t PipelineDesc::hash() const
+// Rehashes a field of the description while it is updated. Fields can't be nested.
+class PipelineDesc::ScopedHashUpdate final : angle::NonCopyable
 {
-    return angle::ComputeGenericHash(*this);
+  public:
+    template <typename T>
+    ScopedHashUpdate(PipelineDesc *desc, const T *field)
+        : mDesc(desc), mField(field), mSize(sizeof(T))
+    {
+        mDesc->mHash -= mDesc->hashWords(mField, mSize);
+    }
+
+    ~ScopedHashUpdate() { mDesc->mHash += mDesc->hashWords(mField, mSize); }
+
+  private:
+    PipelineDesc *mDesc;
+    const void *mField;
+    size_t mSize;
+};
+
+// The hash is a sum of the hashes of each 32-bit word mixed with its position, so a setter only
+// needs to rehash the words it changes.
+uint64_t PipelineDesc::hashWords(const void *begin, size_t size) const
+{
+    const uint8_t *bytes = reinterpret_cast<const uint8_t *>(begin);
+    size_t offset        = bytes - reinterpret_cast<const uint8_t *>(this);
+    ASSERT(offset % 4 == 0 && size % 4 == 0);
+
+    uint64_t hash = 0;
+    for (size_t byteIndex = 0; byteIndex < size; byteIndex += 4)
+    {
+        uint32_t word;
+        memcpy(&word, bytes + byteIndex, sizeof(word));
+
+        // MurmurHash3 64-bit finalizer.
+        uint64_t value = (static_cast<uint64_t>(offset + byteIndex) << 32) | word;
+        value ^= value >> 33;
+        value *= 0xFF51AFD7ED558CCDull;
+        value ^= value >> 33;
+        value *= 0xC4CEB9FE1A85EC53ull;
+        value ^= value >> 33;
+        hash += value;
+    }
+    return hash;
+}
+
+void PipelineDesc::rehash()
+{
+    mHash = hashWords(this, reinterpret_cast<const uint8_t *>(&mHash) -
+                                reinterpret_cast<const uint8_t *>(this));
 }
 
 bool PipelineDesc::operator==(const PipelineDesc &other) const
@@ -436,9 +670,12 @@ void PipelineDesc::initDefaults()
     std::fill(&mColorBlendStateInfo.attachments[0],
               &mColorBlendStateInfo.attachments[gl::IMPLEMENTATION_MAX_DRAW_BUFFERS],
               blendAttachmentState);
+
+    rehash();
 }
 
 Error PipelineDesc::initializePipeline(VkDevice device,
+                                       const PipelineCache &pipelineCacheVk,
                                        const RenderPass &compatibleRenderPass,
                                        const PipelineLayout &pipelineLayout,
                                        const gl::AttributesMask &activeAttribLocationsMask,
@@ -621,7 +858,7 @@ Error PipelineDesc::initializePipeline(VkDevice device,
     createInfo.basePipelineHandle  = VK_NULL_HANDLE;
     createInfo.basePipelineIndex   = 0;
 
-    ANGLE_TRY(pipelineOut->initGraphics(device, createInfo));
+    ANGLE_TRY(pipelineOut->initGraphics(device, pipelineCacheVk, createInfo));
 
     return NoError();
 }
@@ -633,6 +870,8 @@ const ShaderStageInfo &PipelineDesc::getShaderStageInfo() const
 
 void PipelineDesc::updateShaders(Serial vertexSerial, Serial fragmentSerial)
 {
+    ScopedHashUpdate hashUpdate(this, &mShaderStageInfo);
+
     ASSERT(vertexSerial < std::numeric_limits<uint32_t>::max());
     mShaderStageInfo[ShaderType::VertexShader].moduleSerial =
         static_cast<uint32_t>(vertexSerial.getValue());
@@ -643,15 +882,21 @@ void PipelineDesc::updateShaders(Serial vertexSerial, Serial fragmentSerial)
 
 void PipelineDesc::updateViewport(const gl::Rectangle &viewport, float nearPlane, float farPlane)
 {
-    mViewport.x        = static_cast<float>(viewport.x);
-    mViewport.y        = static_cast<float>(viewport.y);
-    mViewport.width    = static_cast<float>(viewport.width);
-    mViewport.height   = static_cast<float>(viewport.height);
+    {
+        ScopedHashUpdate hashUpdate(this, &mViewport);
+
+        mViewport.x      = static_cast<float>(viewport.x);
+        mViewport.y      = static_cast<float>(viewport.y);
+        mViewport.width  = static_cast<float>(viewport.width);
+        mViewport.height = static_cast<float>(viewport.height);
+    }
     updateDepthRange(nearPlane, farPlane);
 }
 
 void PipelineDesc::updateDepthRange(float nearPlane, float farPlane)
 {
+    ScopedHashUpdate hashUpdate(this, &mViewport);
+
     // GLES2.0 Section 2.12.1: Each of n and f are clamped to lie within [0, 1], as are all
     // arguments of type clampf.
     mViewport.minDepth = gl::clamp01(nearPlane);
@@ -661,28 +906,39 @@ void PipelineDesc::updateDepthRange(float nearPlane, float farPlane)
 void PipelineDesc::updateVertexInputInfo(const VertexInputBindings &bindings,
                                          const VertexInputAttributes &attribs)
 {
+    ScopedHashUpdate bindingsUpdate(this, &mVertexInputBindings);
+    ScopedHashUpdate attribsUpdate(this, &mVertexInputAttribs);
+
     mVertexInputBindings = bindings;
     mVertexInputAttribs  = attribs;
 }
 
 void PipelineDesc::updateTopology(GLenum drawMode)
 {
+    ScopedHashUpdate hashUpdate(this, &mInputAssemblyInfo);
+
     mInputAssemblyInfo.topology = static_cast<uint32_t>(gl_vk::GetPrimitiveTopology(drawMode));
 }
 
 void PipelineDesc::updateCullMode(const gl::RasterizerState &rasterState)
 {
+    ScopedHashUpdate hashUpdate(this, &mRasterizationStateInfo);
+
     mRasterizationStateInfo.cullMode = static_cast<uint16_t>(gl_vk::GetCullMode(rasterState));
 }
 
 void PipelineDesc::updateFrontFace(const gl::RasterizerState &rasterState)
 {
+    ScopedHashUpdate hashUpdate(this, &mRasterizationStateInfo);
+
     mRasterizationStateInfo.frontFace =
         static_cast<uint16_t>(gl_vk::GetFrontFace(rasterState.frontFace));
 }
 
 void PipelineDesc::updateLineWidth(float lineWidth)
 {
+    ScopedHashUpdate hashUpdate(this, &mRasterizationStateInfo);
+
     mRasterizationStateInfo.lineWidth = lineWidth;
 }
 
@@ -693,6 +949,8 @@ const RenderPassDesc &PipelineDesc::getRenderPassDesc() const
 
 void PipelineDesc::updateBlendColor(const gl::ColorF &color)
 {
+    ScopedHashUpdate hashUpdate(this, &mColorBlendStateInfo);
+
     mColorBlendStateInfo.blendConstants[0] = color.red;
     mColorBlendStateInfo.blendConstants[1] = color.green;
     mColorBlendStateInfo.blendConstants[2] = color.blue;
@@ -701,6 +959,8 @@ void PipelineDesc::updateBlendColor(const gl::ColorF &color)
 
 void PipelineDesc::updateBlendEnabled(bool isBlendEnabled)
 {
+    ScopedHashUpdate hashUpdate(this, &mColorBlendStateInfo);
+
     for (auto &blendAttachmentState : mColorBlendStateInfo.attachments)
     {
         blendAttachmentState.blendEnable = isBlendEnabled;
@@ -709,6 +969,8 @@ void PipelineDesc::updateBlendEnabled(bool isBlendEnabled)
 
 void PipelineDesc::updateBlendEquations(const gl::BlendState &blendState)
 {
+    ScopedHashUpdate hashUpdate(this, &mColorBlendStateInfo);
+
     for (auto &blendAttachmentState : mColorBlendStateInfo.attachments)
     {
         blendAttachmentState.colorBlendOp = PackGLBlendOp(blendState.blendEquationRGB);
@@ -718,6 +980,8 @@ void PipelineDesc::updateBlendEquations(const gl::BlendState &blendState)
 
 void PipelineDesc::updateBlendFuncs(const gl::BlendState &blendState)
 {
+    ScopedHashUpdate hashUpdate(this, &mColorBlendStateInfo);
+
     for (auto &blendAttachmentState : mColorBlendStateInfo.attachments)
     {
         blendAttachmentState.srcColorBlendFactor = PackGLBlendFactor(blendState.sourceBlendRGB);
@@ -729,6 +993,8 @@ void PipelineDesc::updateBlendFuncs(const gl::BlendState &blendState)
 
 void PipelineDesc::updateColorWriteMask(VkColorComponentFlags colorComponentFlags)
 {
+    ScopedHashUpdate hashUpdate(this, &mColorBlendStateInfo);
+
     uint8_t colorMask = static_cast<uint8_t>(colorComponentFlags);
 
     for (PackedColorBlendAttachmentState &blendAttachmentState : mColorBlendStateInfo.attachments)
@@ -739,27 +1005,37 @@ void PipelineDesc::updateColorWriteMask(VkColorComponentFlags colorComponentFlag
 
 void PipelineDesc::updateDepthTestEnabled(const gl::DepthStencilState &depthStencilState)
 {
+    ScopedHashUpdate hashUpdate(this, &mDepthStencilStateInfo);
+
     mDepthStencilStateInfo.depthTestEnable = static_cast<uint8_t>(depthStencilState.depthTest);
 }
 
 void PipelineDesc::updateDepthFunc(const gl::DepthStencilState &depthStencilState)
 {
+    ScopedHashUpdate hashUpdate(this, &mDepthStencilStateInfo);
+
     mDepthStencilStateInfo.depthCompareOp = PackGLCompareFunc(depthStencilState.depthFunc);
 }
 
 void PipelineDesc::updateDepthWriteEnabled(const gl::DepthStencilState &depthStencilState)
 {
+    ScopedHashUpdate hashUpdate(this, &mDepthStencilStateInfo);
+
     mDepthStencilStateInfo.depthWriteEnable = (depthStencilState.depthMask == GL_FALSE ? 0 : 1);
 }
 
 void PipelineDesc::updateStencilTestEnabled(const gl::DepthStencilState &depthStencilState)
 {
+    ScopedHashUpdate hashUpdate(this, &mDepthStencilStateInfo);
+
     mDepthStencilStateInfo.stencilTestEnable = static_cast<uint8_t>(depthStencilState.stencilTest);
 }
 
 void PipelineDesc::updateStencilFrontFuncs(GLint ref,
                                            const gl::DepthStencilState &depthStencilState)
 {
+    ScopedHashUpdate hashUpdate(this, &mDepthStencilStateInfo.front);
+
     mDepthStencilStateInfo.front.reference   = ref;
     mDepthStencilStateInfo.front.compareOp   = PackGLCompareFunc(depthStencilState.stencilFunc);
     mDepthStencilStateInfo.front.compareMask = static_cast<uint32_t>(depthStencilState.stencilMask);
@@ -767,6 +1043,8 @@ void PipelineDesc::updateStencilFrontFuncs(GLint ref,
 
 void PipelineDesc::updateStencilBackFuncs(GLint ref, const gl::DepthStencilState &depthStencilState)
 {
+    ScopedHashUpdate hashUpdate(this, &mDepthStencilStateInfo.back);
+
     mDepthStencilStateInfo.back.reference = ref;
     mDepthStencilStateInfo.back.compareOp = PackGLCompareFunc(depthStencilState.stencilBackFunc);
     mDepthStencilStateInfo.back.compareMask =
@@ -775,6 +1053,8 @@ void PipelineDesc::updateStencilBackFuncs(GLint ref, const gl::DepthStencilState
 
 void PipelineDesc::updateStencilFrontOps(const gl::DepthStencilState &depthStencilState)
 {
+    ScopedHashUpdate hashUpdate(this, &mDepthStencilStateInfo.front);
+
     mDepthStencilStateInfo.front.passOp = PackGLStencilOp(depthStencilState.stencilPassDepthPass);
     mDepthStencilStateInfo.front.failOp = PackGLStencilOp(depthStencilState.stencilFail);
     mDepthStencilStateInfo.front.depthFailOp =
@@ -783,6 +1063,8 @@ void PipelineDesc::updateStencilFrontOps(const gl::DepthStencilState &depthStenc
 
 void PipelineDesc::updateStencilBackOps(const gl::DepthStencilState &depthStencilState)
 {
+    ScopedHashUpdate hashUpdate(this, &mDepthStencilStateInfo.back);
+
     mDepthStencilStateInfo.back.passOp =
         PackGLStencilOp(depthStencilState.stencilBackPassDepthPass);
     mDepthStencilStateInfo.back.failOp = PackGLStencilOp(depthStencilState.stencilBackFail);
@@ -792,23 +1074,31 @@ void PipelineDesc::updateStencilBackOps(const gl::DepthStencilState &depthStenci
 
 void PipelineDesc::updateStencilFrontWriteMask(const gl::DepthStencilState &depthStencilState)
 {
+    ScopedHashUpdate hashUpdate(this, &mDepthStencilStateInfo.front);
+
     mDepthStencilStateInfo.front.writeMask =
         static_cast<uint32_t>(depthStencilState.stencilWritemask);
 }
 
 void PipelineDesc::updateStencilBackWriteMask(const gl::DepthStencilState &depthStencilState)
 {
+    ScopedHashUpdate hashUpdate(this, &mDepthStencilStateInfo.back);
+
     mDepthStencilStateInfo.back.writeMask =
         static_cast<uint32_t>(depthStencilState.stencilBackWritemask);
 }
 
 void PipelineDesc::updateRenderPassDesc(const RenderPassDesc &renderPassDesc)
 {
+    ScopedHashUpdate hashUpdate(this, &mRenderPassDesc);
+
     mRenderPassDesc = renderPassDesc;
 }
 
 void PipelineDesc::updateScissor(const gl::Rectangle &rect)
 {
+    ScopedHashUpdate hashUpdate(this, &mScissor);
+
     mScissor = gl_vk::GetRect(rect);
 }
 
@@ -869,25 +1159,17 @@ bool operator==(const AttachmentOpsArray &lhs, const AttachmentOpsArray &rhs)
 }  // namespace vk
 
 // RenderPassCache implementation.
-RenderPassCache::RenderPassCache()
+RenderPassCache::RenderPassCache() : mPayload(kDefaultRenderPassCacheLimits)
 {
 }
 
 RenderPassCache::~RenderPassCache()
 {
-    ASSERT(mPayload.empty());
 }
 
 void RenderPassCache::destroy(VkDevice device)
 {
-    for (auto &outerIt : mPayload)
-    {
-        for (auto &innerIt : outerIt.second)
-        {
-            innerIt.second.get().destroy(device);
-        }
-    }
-    mPayload.clear();
+    mPayload.clear([device](vk::RenderPass &renderPass) { renderPass.destroy(device); });
 }
 
 vk::Error RenderPassCache::getCompatibleRenderPass(VkDevice device,
@@ -895,33 +1177,10 @@ vk::Error RenderPassCache::getCompatibleRenderPass(VkDevice device,
                                                    const vk::RenderPassDesc &desc,
                                                    vk::RenderPass **renderPassOut)
 {
-    auto outerIt = mPayload.find(desc);
-    if (outerIt != mPayload.end())
-    {
-        InnerCache &innerCache = outerIt->second;
-        ASSERT(!innerCache.empty());
-
-        // Find the first element and return it.
-        innerCache.begin()->second.updateSerial(serial);
-        *renderPassOut = &innerCache.begin()->second.get();
-        return vk::NoError();
-    }
-
     // Insert some dummy attachment ops.
     // TODO(jmadill): Pre-populate the cache in the Renderer so we rarely miss here.
     vk::AttachmentOpsArray ops;
-    for (uint32_t colorIndex = 0; colorIndex < desc.colorAttachmentCount(); ++colorIndex)
-    {
-        ops.initDummyOp(colorIndex, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
-                        VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
-    }
-
-    if (desc.depthStencilAttachmentCount() > 0)
-    {
-        ops.initDummyOp(desc.colorAttachmentCount(),
-                        VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
-                        VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL);
-    }
+    vk::InitializeDummyAttachmentOps(desc, &ops);
 
     return getRenderPassWithOps(device, serial, desc, ops, renderPassOut);
 }
@@ -932,61 +1191,85 @@ vk::Error RenderPassCache::getRenderPassWithOps(VkDevice device,
                                                 const vk::AttachmentOpsArray &attachmentOps,
                                                 vk::RenderPass **renderPassOut)
 {
-    auto outerIt = mPayload.find(desc);
-    if (outerIt != mPayload.end())
-    {
-        InnerCache &innerCache = outerIt->second;
-
-        auto innerIt = innerCache.find(attachmentOps);
-        if (innerIt != innerCache.end())
-        {
-            // Update the serial before we return.
-            // TODO(jmadill): Could possibly use an MRU cache here.
-            innerIt->second.updateSerial(serial);
-            *renderPassOut = &innerIt->second.get();
-            return vk::NoError();
-        }
-    }
-    else
+    Key key = {desc, attachmentOps};
+
+    vk::RenderPassAndSerial *item = mPayload.find(key);
+    if (item)
     {
-        auto emplaceResult = mPayload.emplace(desc, InnerCache());
-        outerIt            = emplaceResult.first;
+        // Update the serial before we return.
+        item->updateSerial(serial);
+        *renderPassOut = &item->get();
+        return vk::NoError();
     }
 
     vk::RenderPass newRenderPass;
-    ANGLE_TRY(vk::InitializeRenderPassFromDesc(device, desc, attachmentOps, &newRenderPass));
 
-    vk::RenderPassAndSerial withSerial(std::move(newRenderPass), serial);
+    // This "if" is left here for the benefit of the cache unit tests.
+    if (device != VK_NULL_HANDLE)
+    {
+        ANGLE_TRY(vk::InitializeRenderPassFromDesc(device, desc, attachmentOps, &newRenderPass));
+    }
 
-    InnerCache &innerCache = outerIt->second;
-    auto insertPos         = innerCache.emplace(attachmentOps, std::move(withSerial));
-    *renderPassOut         = &insertPos.first->second.get();
+    item = mPayload.insert(key, vk::RenderPassAndSerial(std::move(newRenderPass), serial),
+                           kEstimatedRenderPassSize);
+    *renderPassOut = &item->get();
 
-    // TODO(jmadill): Trim cache, and pre-populate with the most common RPs on startup.
+    // TODO(jmadill): Pre-populate with the most common RPs on startup.
     return vk::NoError();
 }
 
+void RenderPassCache::trim(VkDevice device, Serial lastCompletedSerial)
+{
+    mPayload.trim(lastCompletedSerial,
+                  [device](vk::RenderPass &renderPass) { renderPass.destroy(device); });
+}
+
+void RenderPassCache::setLimits(const vk::CacheLimits &limits)
+{
+    mPayload.setLimits(limits);
+}
+
+const vk::CacheStats &RenderPassCache::getStats() const
+{
+    return mPayload.getStats();
+}
+
+size_t RenderPassCache::getEntryCount() const
+{
+    return mPayload.getEntryCount();
+}
+
+size_t RenderPassCache::KeyHash::operator()(const Key &key) const
+{
+    return key.desc.hash() ^ (key.ops.hash() * 31);
+}
+
+bool operator==(const RenderPassCache::Key &lhs, const RenderPassCache::Key &rhs)
+{
+    return lhs.desc == rhs.desc && lhs.ops == rhs.ops;
+}
+
 // PipelineCache implementation.
-PipelineCache::PipelineCache()
+PipelineCache::PipelineCache() : mPayload(kDefaultPipelineCacheLimits)
 {
 }
 
 PipelineCache::~PipelineCache()
 {
-    ASSERT(mPayload.empty());
 }
 
 void PipelineCache::destroy(VkDevice device)
 {
-    for (auto &item : mPayload)
-    {
-        item.second.get().destroy(device);
-    }
+    mPayload.clear([device](vk::Pipeline &pipeline) { pipeline.destroy(device); });
+}
 
-    mPayload.clear();
+bool PipelineCache::contains(const vk::PipelineDesc &desc) const
+{
+    return mPayload.contains(desc);
 }
 
 vk::Error PipelineCache::getPipeline(VkDevice device,
+                                     const vk::PipelineCache &pipelineCacheVk,
                                      const vk::RenderPass &compatibleRenderPass,
                                      const vk::PipelineLayout &pipelineLayout,
                                      const gl::AttributesMask &activeAttribLocationsMask,
@@ -995,10 +1278,10 @@ vk::Error PipelineCache::getPipeline(VkDevice device,
                                      const vk::PipelineDesc &desc,
                                      vk::PipelineAndSerial **pipelineOut)
 {
-    auto item = mPayload.find(desc);
-    if (item != mPayload.end())
+    vk::PipelineAndSerial *item = mPayload.find(desc);
+    if (item)
     {
-        *pipelineOut = &item->second;
+        *pipelineOut = item;
         return vk::NoError();
     }
 
@@ -1007,28 +1290,48 @@ vk::Error PipelineCache::getPipeline(VkDevice device,
     // This "if" is left here for the benefit of VulkanPipelineCachePerfTest.
     if (device != VK_NULL_HANDLE)
     {
-        ANGLE_TRY(desc.initializePipeline(device, compatibleRenderPass, pipelineLayout,
-                                          activeAttribLocationsMask, vertexModule, fragmentModule,
-                                          &newPipeline));
+        ANGLE_TRY(desc.initializePipeline(device, pipelineCacheVk, compatibleRenderPass,
+                                          pipelineLayout, activeAttribLocationsMask, vertexModule,
+                                          fragmentModule, &newPipeline));
     }
 
     // The Serial will be updated outside of this query.
-    auto insertedItem =
-        mPayload.emplace(desc, vk::PipelineAndSerial(std::move(newPipeline), Serial()));
-    *pipelineOut = &insertedItem.first->second;
+    *pipelineOut = mPayload.insert(desc, vk::PipelineAndSerial(std::move(newPipeline), Serial()),
+                                   kEstimatedPipelineSize);
 
     return vk::NoError();
 }
 
 void PipelineCache::populate(const vk::PipelineDesc &desc, vk::Pipeline &&pipeline)
 {
-    auto item = mPayload.find(desc);
-    if (item != mPayload.end())
+    if (mPayload.contains(desc))
     {
         return;
     }
 
-    mPayload.emplace(desc, vk::PipelineAndSerial(std::move(pipeline), Serial()));
+    mPayload.insert(desc, vk::PipelineAndSerial(std::move(pipeline), Serial()),
+                    kEstimatedPipelineSize);
+}
+
+void PipelineCache::trim(VkDevice device, Serial lastCompletedSerial)
+{
+    mPayload.trim(lastCompletedSerial,
+                  [device](vk::Pipeline &pipeline) { pipeline.destroy(device); });
+}
+
+void PipelineCache::setLimits(const vk::CacheLimits &limits)
+{
+    mPayload.setLimits(limits);
+}
+
+const vk::CacheStats &PipelineCache::getStats() const
+{
+    return mPayload.getStats();
+}
+
+size_t PipelineCache::getEntryCount() const
+{
+    return mPayload.getEntryCount();
 }
 
 }  // namespace rx
@@ -11,6 +11,9 @@
 #ifndef LIBANGLE_RENDERER_VULKAN_VK_CACHE_UTILS_H_
 #define LIBANGLE_RENDERER_VULKAN_VK_CACHE_UTILS_H_
 
+#include <array>
+#include <vector>
+
 #include "common/Color.h"
 #include "libANGLE/renderer/vulkan/vk_utils.h"
 
@@ -255,12 +258,14 @@ class PipelineDesc final
     PipelineDesc(const PipelineDesc &other);
     PipelineDesc &operator=(const PipelineDesc &other);
 
-    size_t hash() const;
+    // The hash is kept up to date as the description is updated, so this is free.
+    size_t hash() const { return static_cast<size_t>(mHash); }
     bool operator==(const PipelineDesc &other) const;
 
     void initDefaults();
 
     Error initializePipeline(VkDevice device,
+                             const PipelineCache &pipelineCacheVk,
                              const RenderPass &compatibleRenderPass,
                              const PipelineLayout &pipelineLayout,
                              const gl::AttributesMask &activeAttribLocationsMask,
@@ -315,6 +320,11 @@ class PipelineDesc final
     void updateStencilBackWriteMask(const gl::DepthStencilState &depthStencilState);
 
   private:
+    class ScopedHashUpdate;
+
+    uint64_t hashWords(const void *begin, size_t size) const;
+    void rehash();
+
     // TODO(jmadill): Use gl::ShaderMap when we can pack into fewer bits. http://anglebug.com/2522
     ShaderStageInfo mShaderStageInfo;
     VertexInputBindings mVertexInputBindings;
@@ -330,6 +340,10 @@ class PipelineDesc final
     // TODO(jmadill): Dynamic state.
     // TODO(jmadill): Pipeline layout
     RenderPassDesc mRenderPassDesc;
+
+    // Hash of the state above. Padded so the struct has no gaps.
+    uint64_t mHash;
+    uint64_t mHashPadding[3];
 };
 
 // Verify the packed pipeline description has no gaps in the packing.
@@ -341,12 +355,300 @@ constexpr size_t PipelineDescSumOfSizes =
     sizeof(PackedInputAssemblyInfo) + sizeof(VkViewport) + sizeof(VkRect2D) +
     sizeof(PackedRasterizationStateInfo) + sizeof(PackedMultisampleStateInfo) +
     sizeof(PackedDepthStencilStateInfo) + sizeof(PackedColorBlendStateInfo) +
-    sizeof(RenderPassDesc);
+    sizeof(RenderPassDesc) + sizeof(uint64_t) * 4;
 
 static_assert(sizeof(PipelineDesc) == PipelineDescSumOfSizes, "Size mismatch");
 
 using RenderPassAndSerial = ObjectAndSerial<RenderPass>;
 using PipelineAndSerial   = ObjectAndSerial<Pipeline>;
+
+// Identifies the SPIR-V of a linked program across runs. A SHA-1 hash of the shader code.
+using ShaderKey = std::array<uint8_t, 20>;
+ShaderKey ComputeShaderKey(const std::vector<uint32_t> &vertexCode,
+                           const std::vector<uint32_t> &fragmentCode);
+
+// A pipeline created by a program, recorded so it can be built again as soon as a program with the
+// same shaders is linked in a later run. The shader serials in the description are cleared, since
+// they are only meaningful within a run.
+struct PipelineDescRecord final
+{
+    ShaderKey shaderKey;
+    PipelineDesc desc;
+    gl::AttributesMask activeAttribLocationsMask;
+};
+
+// The driver's pipeline cache data and the recorded pipelines are persisted together, behind a
+// header naming the device and driver they came from. Data from any other device or driver, or
+// from another version of the format, is rejected by UnpackPipelineCacheData.
+void PackPipelineCacheData(const VkPhysicalDeviceProperties &physicalDeviceProperties,
+                           const std::vector<uint8_t> &cacheData,
+                           const std::vector<PipelineDescRecord> &records,
+                           std::vector<uint8_t> *packedOut);
+bool UnpackPipelineCacheData(const VkPhysicalDeviceProperties &physicalDeviceProperties,
+                             const uint8_t *packed,
+                             size_t packedSize,
+                             std::vector<uint8_t> *cacheDataOut,
+                             std::vector<PipelineDescRecord> *recordsOut);
+
+// Creates a RenderPass compatible with any RenderPass created from the same description.
+Error InitializeCompatibleRenderPass(VkDevice device,
+                                     const RenderPassDesc &desc,
+                                     RenderPass *renderPass);
+
+// Caps on the number of objects in a cache and on their estimated size. Zero means no cap.
+struct CacheLimits final
+{
+    size_t maxEntryCount;
+    size_t maxSizeBytes;
+};
+
+struct CacheStats final
+{
+    size_t hitCount;
+    size_t missCount;
+    size_t evictionCount;
+};
+
+// A hash map of objects with least recently used ordering. Objects over the cache limits are
+// only released once their serial is retired, i.e. when the GPU can no longer be using them.
+// The release itself is left to a callback so the bookkeeping does not need a device.
+// Pointers to cached objects stay valid until the object is released.
+//
+// Entries are found through an open-addressing table with linear probing. Each slot holds the
+// hash of its entry next to the entry pointer, so probing stays within a few cache lines and
+// most mismatches are rejected without touching the entry.
+template <typename Key, typename ObjT, typename Hash = std::hash<Key>>
+class LRUObjectCache final : angle::NonCopyable
+{
+  public:
+    using Value = ObjectAndSerial<ObjT>;
+
+    explicit LRUObjectCache(const CacheLimits &limits)
+        : mLimits(limits), mSizeBytes(0), mEntryCount(0), mStats{0, 0, 0}, mSlots(kMinSlotCount)
+    {
+        mHead.prev = &mHead;
+        mHead.next = &mHead;
+    }
+    ~LRUObjectCache() { ASSERT(mEntryCount == 0); }
+
+    // Returns nullptr on a miss.
+    Value *find(const Key &key)
+    {
+        Entry *entry = mSlots[findSlot(key, mHash(key))].entry;
+        if (!entry)
+        {
+            mStats.missCount++;
+            return nullptr;
+        }
+
+        mStats.hitCount++;
+        unlink(entry);
+        linkFront(entry);
+        return &entry->value;
+    }
+
+    bool contains(const Key &key) const
+    {
+        return mSlots[findSlot(key, mHash(key))].entry != nullptr;
+    }
+
+    Value *insert(const Key &key, Value &&value, size_t sizeBytes)
+    {
+        // Keep the load factor at or below one half so probe sequences stay short.
+        if ((mEntryCount + 1) * 2 > mSlots.size())
+        {
+            resize(mSlots.size() * 2);
+        }
+
+        size_t hash = mHash(key);
+        Slot &slot  = mSlots[findSlot(key, hash)];
+        ASSERT(!slot.entry);
+
+        slot.hash  = hash;
+        slot.entry = new Entry(key, std::move(value), sizeBytes, hash);
+        linkFront(slot.entry);
+        mEntryCount++;
+        mSizeBytes += sizeBytes;
+        return &slot.entry->value;
+    }
+
+    // Releases the least recently used objects until the cache is within its limits. Objects
+    // still in use by the GPU are skipped.
+    template <typename ReleaseFunc>
+    void trim(Serial lastCompletedSerial, ReleaseFunc &&release)
+    {
+        Link *link = mHead.prev;
+        while (isOverLimits() && link != &mHead)
+        {
+            Entry *entry = static_cast<Entry *>(link);
+            link         = link->prev;
+            if (entry->value.queueSerial() > lastCompletedSerial)
+            {
+                continue;
+            }
+
+            release(entry->value.get());
+            eraseSlot(findSlot(entry));
+            unlink(entry);
+            mEntryCount--;
+            mSizeBytes -= entry->sizeBytes;
+            mStats.evictionCount++;
+            delete entry;
+        }
+    }
+
+    // Releases all objects. The caller is responsible for waiting for the GPU.
+    template <typename ReleaseFunc>
+    void clear(ReleaseFunc &&release)
+    {
+        Link *link = mHead.next;
+        while (link != &mHead)
+        {
+            Entry *entry = static_cast<Entry *>(link);
+            link         = link->next;
+            release(entry->value.get());
+            delete entry;
+        }
+        mHead.prev = &mHead;
+        mHead.next = &mHead;
+        mSlots.assign(kMinSlotCount, Slot());
+        mEntryCount = 0;
+        mSizeBytes  = 0;
+    }
+
+    void setLimits(const CacheLimits &limits) { mLimits = limits; }
+    const CacheLimits &getLimits() const { return mLimits; }
+    const CacheStats &getStats() const { return mStats; }
+
+    size_t getEntryCount() const { return mEntryCount; }
+    size_t getSizeBytes() const { return mSizeBytes; }
+
+  private:
+    static constexpr size_t kMinSlotCount = 16;
+
+    struct Link
+    {
+        Link *prev;
+        Link *next;
+    };
+
+    struct Entry : Link
+    {
+        Entry(const Key &key, Value &&value, size_t sizeBytes, size_t hash)
+            : Link{nullptr, nullptr},
+              key(key),
+              value(std::move(value)),
+              sizeBytes(sizeBytes),
+              hash(hash)
+        {
+        }
+
+        Key key;
+        Value value;
+        size_t sizeBytes;
+        size_t hash;
+    };
+
+    struct Slot
+    {
+        size_t hash  = 0;
+        Entry *entry = nullptr;
+    };
+
+    bool isOverLimits() const
+    {
+        return (mLimits.maxEntryCount > 0 && mEntryCount > mLimits.maxEntryCount) ||
+               (mLimits.maxSizeBytes > 0 && mSizeBytes > mLimits.maxSizeBytes);
+    }
+
+    // Returns the slot holding |key|, or the empty slot where it would be inserted.
+    size_t findSlot(const Key &key, size_t hash) const
+    {
+        size_t mask = mSlots.size() - 1;
+        for (size_t index = hash & mask;; index = (index + 1) & mask)
+        {
+            const Slot &slot = mSlots[index];
+            if (!slot.entry || (slot.hash == hash && slot.entry->key == key))
+            {
+                return index;
+            }
+        }
+    }
+
+    size_t findSlot(const Entry *entry) const
+    {
+        size_t mask = mSlots.size() - 1;
+        for (size_t index = entry->hash & mask;; index = (index + 1) & mask)
+        {
+            if (mSlots[index].entry == entry)
+            {
+                return index;
+            }
+            ASSERT(mSlots[index].entry);
+        }
+    }
+
+    // Shifts the following slots of the probe sequence back so no tombstones are needed.
+    void eraseSlot(size_t index)
+    {
+        size_t mask = mSlots.size() - 1;
+        for (size_t next = (index + 1) & mask; mSlots[next].entry; next = (next + 1) & mask)
+        {
+            // A slot can only move back if |index| is still on its probe sequence.
+            size_t home = mSlots[next].hash & mask;
+            if (((next - home) & mask) >= ((next - index) & mask))
+            {
+                mSlots[index] = mSlots[next];
+                index         = next;
+            }
+        }
+        mSlots[index] = Slot();
+    }
+
+    void resize(size_t slotCount)
+    {
+        std::vector<Slot> oldSlots(slotCount);
+        mSlots.swap(oldSlots);
+
+        size_t mask = slotCount - 1;
+        for (const Slot &slot : oldSlots)
+        {
+            if (slot.entry)
+            {
+                size_t index = slot.hash & mask;
+                while (mSlots[index].entry)
+                {
+                    index = (index + 1) & mask;
+                }
+                mSlots[index] = slot;
+            }
+        }
+    }
+
+    void linkFront(Link *link)
+    {
+        link->prev       = &mHead;
+        link->next       = mHead.next;
+        mHead.next->prev = link;
+        mHead.next       = link;
+    }
+
+    static void unlink(Link *link)
+    {
+        link->prev->next = link->next;
+        link->next->prev = link->prev;
+    }
+
+    Hash mHash;
+    CacheLimits mLimits;
+    size_t mSizeBytes;
+    size_t mEntryCount;
+    CacheStats mStats;
+
+    // Circular list of the entries, most recently used first.
+    Link mHead;
+    std::vector<Slot> mSlots;
+};
 }  // namespace vk
 }  // namespace rx
 
@@ -375,7 +677,14 @@ struct hash<rx::vk::PipelineDesc>
 
 namespace rx
 {
-// TODO(jmadill): Add cache trimming/eviction.
+// Vulkan does not report the memory used by these objects, so the caches charge each object an
+// estimated size.
+constexpr size_t kEstimatedRenderPassSize = 1024;
+constexpr size_t kEstimatedPipelineSize   = 16 * 1024;
+
+constexpr vk::CacheLimits kDefaultRenderPassCacheLimits = {256, 0};
+constexpr vk::CacheLimits kDefaultPipelineCacheLimits   = {2048, 16 * 1024 * 1024};
+
 class RenderPassCache final : angle::NonCopyable
 {
   public:
@@ -394,16 +703,30 @@ class RenderPassCache final : angle::NonCopyable
                                    const vk::AttachmentOpsArray &attachmentOps,
                                    vk::RenderPass **renderPassOut);
 
-  private:
-    // Use a two-layer caching scheme. The top level matches the "compatible" RenderPass elements.
-    // The second layer caches the attachment load/store ops and initial/final layout.
-    using InnerCache = std::unordered_map<vk::AttachmentOpsArray, vk::RenderPassAndSerial>;
-    using OuterCache = std::unordered_map<vk::RenderPassDesc, InnerCache>;
+    // Destroys the least recently used RenderPasses over the limits that are no longer in use.
+    void trim(VkDevice device, Serial lastCompletedSerial);
+
+    void setLimits(const vk::CacheLimits &limits);
+    const vk::CacheStats &getStats() const;
+    size_t getEntryCount() const;
 
-    OuterCache mPayload;
+  private:
+    // RenderPasses are matched on the "compatible" RenderPass elements as well as the attachment
+    // load/store ops and initial/final layout.
+    struct Key
+    {
+        vk::RenderPassDesc desc;
+        vk::AttachmentOpsArray ops;
+    };
+    struct KeyHash
+    {
+        size_t operator()(const Key &key) const;
+    };
+    friend bool operator==(const Key &lhs, const Key &rhs);
+
+    vk::LRUObjectCache<Key, vk::RenderPass, KeyHash> mPayload;
 };
 
-// TODO(jmadill): Add cache trimming/eviction.
 class PipelineCache final : angle::NonCopyable
 {
   public:
@@ -412,8 +735,10 @@ class PipelineCache final : angle::NonCopyable
 
     void destroy(VkDevice device);
 
+    bool contains(const vk::PipelineDesc &desc) const;
     void populate(const vk::PipelineDesc &desc, vk::Pipeline &&pipeline);
     vk::Error getPipeline(VkDevice device,
+                          const vk::PipelineCache &pipelineCacheVk,
                           const vk::RenderPass &compatibleRenderPass,
                           const vk::PipelineLayout &pipelineLayout,
                           const gl::AttributesMask &activeAttribLocationsMask,
@@ -422,8 +747,16 @@ class PipelineCache final : angle::NonCopyable
                           const vk::PipelineDesc &desc,
                           vk::PipelineAndSerial **pipelineOut);
 
+    // Destroys the least recently used Pipelines over the limits that are no longer in use.
+    // Pipelines returned by getPipeline must be queried again once the eviction count changes.
+    void trim(VkDevice device, Serial lastCompletedSerial);
+
+    void setLimits(const vk::CacheLimits &limits);
+    const vk::CacheStats &getStats() const;
+    size_t getEntryCount() const;
+
   private:
-    std::unordered_map<vk::PipelineDesc, vk::PipelineAndSerial> mPayload;
+    vk::LRUObjectCache<vk::PipelineDesc, vk::Pipeline> mPayload;
 };
 
 }  // namespace rx
@@ -0,0 +1,438 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// vk_cache_utils_unittest:
+//   Tests for the eviction of the Vulkan object caches and for the persisted pipeline cache data.
+//   No device is needed.
+
+#include <gtest/gtest.h>
+
+#include <set>
+
+#include "libANGLE/renderer/vulkan/vk_cache_utils.h"
+
+using namespace rx;
+
+namespace
+{
+
+class FakeObject final : angle::NonCopyable
+{
+  public:
+    FakeObject() : mId(0) {}
+    explicit FakeObject(int id) : mId(id) {}
+    FakeObject(FakeObject &&other) : mId(other.mId) { other.mId = 0; }
+    FakeObject &operator=(FakeObject &&other)
+    {
+        std::swap(mId, other.mId);
+        return *this;
+    }
+
+    bool valid() const { return mId != 0; }
+    int id() const { return mId; }
+
+  private:
+    int mId;
+};
+
+using FakeCache = vk::LRUObjectCache<int, FakeObject>;
+
+class VulkanObjectCacheTest : public ::testing::Test
+{
+  protected:
+    void TearDown() override
+    {
+        mCache.clear([](FakeObject &) {});
+    }
+
+    void insert(int id, Serial serial, size_t size = 1)
+    {
+        mCache.insert(id, FakeCache::Value(FakeObject(id), serial), size);
+    }
+
+    void trim(Serial lastCompletedSerial)
+    {
+        mCache.trim(lastCompletedSerial,
+                    [this](FakeObject &object) { mReleased.push_back(object.id()); });
+    }
+
+    FakeCache mCache{{0, 0}};
+    SerialFactory mSerialFactory;
+    std::vector<int> mReleased;
+};
+
+// Lookups are counted as hits or misses.
+TEST_F(VulkanObjectCacheTest, HitsAndMisses)
+{
+    Serial serial = mSerialFactory.generate();
+    EXPECT_EQ(nullptr, mCache.find(1));
+    insert(1, serial);
+
+    FakeCache::Value *value = mCache.find(1);
+    ASSERT_NE(nullptr, value);
+    EXPECT_EQ(1, value->get().id());
+    EXPECT_EQ(serial, value->queueSerial());
+
+    EXPECT_EQ(1u, mCache.getStats().hitCount);
+    EXPECT_EQ(1u, mCache.getStats().missCount);
+    EXPECT_EQ(0u, mCache.getStats().evictionCount);
+
+    // Checking for an entry does not count.
+    EXPECT_TRUE(mCache.contains(1));
+    EXPECT_EQ(1u, mCache.getStats().hitCount);
+}
+
+// The least recently used objects are released first.
+TEST_F(VulkanObjectCacheTest, EvictsLeastRecentlyUsed)
+{
+    Serial serial = mSerialFactory.generate();
+    mCache.setLimits({2, 0});
+    insert(1, serial);
+    insert(2, serial);
+    insert(3, serial);
+    ASSERT_NE(nullptr, mCache.find(1));
+
+    trim(serial);
+    EXPECT_EQ(std::vector<int>({2}), mReleased);
+    EXPECT_EQ(2u, mCache.getEntryCount());
+    EXPECT_EQ(1u, mCache.getStats().evictionCount);
+    EXPECT_TRUE(mCache.contains(1));
+    EXPECT_TRUE(mCache.contains(3));
+
+    // Trimming a cache within its limits does nothing.
+    trim(serial);
+    EXPECT_EQ(1u, mReleased.size());
+}
+
+// Objects the GPU may still be using are skipped.
+TEST_F(VulkanObjectCacheTest, KeepsObjectsInUse)
+{
+    Serial completedSerial = mSerialFactory.generate();
+    Serial pendingSerial   = mSerialFactory.generate();
+    mCache.setLimits({1, 0});
+    insert(1, pendingSerial);
+    insert(2, completedSerial);
+    insert(3, pendingSerial);
+
+    trim(completedSerial);
+    EXPECT_EQ(std::vector<int>({2}), mReleased);
+    EXPECT_EQ(2u, mCache.getEntryCount());
+
+    // The remaining objects are released once their work completes.
+    trim(pendingSerial);
+    EXPECT_EQ(std::vector<int>({2, 1}), mReleased);
+    EXPECT_EQ(1u, mCache.getEntryCount());
+
+    // Objects that were never used by the GPU can always be released.
+    insert(4, Serial());
+    trim(completedSerial);
+    EXPECT_EQ(std::vector<int>({2, 1, 4}), mReleased);
+}
+
+// The size cap is applied on top of the entry cap.
+TEST_F(VulkanObjectCacheTest, SizeLimit)
+{
+    Serial serial = mSerialFactory.generate();
+    mCache.setLimits({0, 100});
+    insert(1, serial, 60);
+    insert(2, serial, 30);
+    trim(serial);
+    EXPECT_TRUE(mReleased.empty());
+    EXPECT_EQ(90u, mCache.getSizeBytes());
+
+    insert(3, serial, 20);
+    trim(serial);
+    EXPECT_EQ(std::vector<int>({1}), mReleased);
+    EXPECT_EQ(50u, mCache.getSizeBytes());
+
+    mCache.setLimits({1, 100});
+    trim(serial);
+    EXPECT_EQ(std::vector<int>({1, 2}), mReleased);
+    EXPECT_EQ(20u, mCache.getSizeBytes());
+}
+
+// Pointers to cached objects stay valid while other objects are added and released.
+TEST_F(VulkanObjectCacheTest, StablePointers)
+{
+    Serial serial = mSerialFactory.generate();
+    mCache.setLimits({8, 0});
+    insert(0, serial);
+    FakeCache::Value *first = mCache.find(0);
+
+    for (int id = 1; id < 64; ++id)
+    {
+        insert(id, serial);
+        ASSERT_EQ(first, mCache.find(0));
+        trim(serial);
+    }
+    EXPECT_EQ(0, first->get().id());
+}
+
+// Lookups stay correct with colliding hashes while entries are added and evicted.
+TEST(VulkanObjectCacheCollisionTest, CollidingHashes)
+{
+    struct CollidingHash
+    {
+        size_t operator()(int key) const { return static_cast<size_t>(key % 7); }
+    };
+    vk::LRUObjectCache<int, FakeObject, CollidingHash> cache({32, 0});
+
+    SerialFactory serialFactory;
+    Serial serial = serialFactory.generate();
+
+    std::set<int> expected;
+    for (int id = 1; id <= 500; ++id)
+    {
+        cache.insert(id, vk::ObjectAndSerial<FakeObject>(FakeObject(id), serial), 1);
+        expected.insert(id);
+        cache.trim(serial, [&expected](FakeObject &object) { expected.erase(object.id()); });
+        ASSERT_EQ(expected.size(), cache.getEntryCount());
+
+        for (int other = 1; other <= id; ++other)
+        {
+            ASSERT_EQ(expected.count(other) > 0, cache.contains(other)) << other;
+        }
+    }
+
+    cache.clear([](FakeObject &) {});
+}
+
+// The hash of a PipelineDesc follows its state however the state was reached.
+TEST(VulkanPipelineDescTest, IncrementalHash)
+{
+    vk::PipelineDesc desc;
+    desc.initDefaults();
+    size_t defaultHash = desc.hash();
+
+    desc.updateScissor(gl::Rectangle(1, 2, 3, 4));
+    desc.updateViewport(gl::Rectangle(0, 0, 16, 16), 0.25f, 0.75f);
+    EXPECT_NE(defaultHash, desc.hash());
+
+    vk::PipelineDesc other;
+    other.initDefaults();
+    other.updateViewport(gl::Rectangle(8, 8, 32, 32), 0.0f, 1.0f);
+    other.updateScissor(gl::Rectangle(1, 2, 3, 4));
+    other.updateViewport(gl::Rectangle(0, 0, 16, 16), 0.25f, 0.75f);
+    EXPECT_TRUE(desc == other);
+    EXPECT_EQ(desc.hash(), other.hash());
+
+    vk::PipelineDesc copy(desc);
+    EXPECT_EQ(desc.hash(), copy.hash());
+
+    // Reverting the state reverts the hash.
+    desc.updateScissor(gl::Rectangle(0, 0, 0, 0));
+    desc.updateViewport(gl::Rectangle(0, 0, 0, 0), 0.0f, 0.0f);
+    EXPECT_EQ(defaultHash, desc.hash());
+}
+
+// The PipelineCache evicts through the same logic. Without a device no pipelines are created.
+TEST(VulkanPipelineCacheTest, Trim)
+{
+    PipelineCache cache;
+    cache.setLimits({4, 0});
+
+    SerialFactory serialFactory;
+    Serial serial = serialFactory.generate();
+
+    vk::PipelineCache pipelineCacheVk;
+    vk::RenderPass renderPass;
+    vk::PipelineLayout pipelineLayout;
+    vk::ShaderModule shaderModule;
+    gl::AttributesMask attribMask;
+
+    vk::PipelineDesc desc;
+    desc.initDefaults();
+    for (uint32_t index = 0; index < 8; ++index)
+    {
+        desc.updateScissor(gl::Rectangle(0, 0, index + 1, index + 1));
+
+        vk::PipelineAndSerial *pipeline = nullptr;
+        ASSERT_FALSE(cache
+                         .getPipeline(VK_NULL_HANDLE, pipelineCacheVk, renderPass,
+                                      pipelineLayout, attribMask, shaderModule, shaderModule,
+                                      desc, &pipeline)
+                         .isError());
+        pipeline->updateSerial(serial);
+    }
+
+    EXPECT_EQ(8u, cache.getEntryCount());
+    EXPECT_EQ(8u, cache.getStats().missCount);
+
+    cache.trim(VK_NULL_HANDLE, serial);
+    EXPECT_EQ(4u, cache.getEntryCount());
+    EXPECT_EQ(4u, cache.getStats().evictionCount);
+
+    // The most recently used pipeline is still there.
+    vk::PipelineAndSerial *pipeline = nullptr;
+    ASSERT_FALSE(cache
+                     .getPipeline(VK_NULL_HANDLE, pipelineCacheVk, renderPass, pipelineLayout,
+                                  attribMask, shaderModule, shaderModule, desc, &pipeline)
+                     .isError());
+    EXPECT_EQ(1u, cache.getStats().hitCount);
+
+    cache.destroy(VK_NULL_HANDLE);
+}
+
+// RenderPasses are evicted the same way.
+TEST(VulkanRenderPassCacheTest, Trim)
+{
+    RenderPassCache cache;
+    cache.setLimits({1, 0});
+
+    SerialFactory serialFactory;
+    Serial completedSerial = serialFactory.generate();
+    Serial pendingSerial   = serialFactory.generate();
+
+    vk::RenderPassDesc desc;
+    vk::RenderPass *renderPass = nullptr;
+    ASSERT_FALSE(
+        cache.getCompatibleRenderPass(VK_NULL_HANDLE, completedSerial, desc, &renderPass)
+            .isError());
+
+    vk::AttachmentOpsArray ops;
+    ops.initDummyOp(0, VK_IMAGE_LAYOUT_GENERAL, VK_IMAGE_LAYOUT_GENERAL);
+    ASSERT_FALSE(
+        cache.getRenderPassWithOps(VK_NULL_HANDLE, pendingSerial, desc, ops, &renderPass)
+            .isError());
+    ASSERT_FALSE(
+        cache.getCompatibleRenderPass(VK_NULL_HANDLE, completedSerial, desc, &renderPass)
+            .isError());
+    EXPECT_EQ(1u, cache.getStats().hitCount);
+    EXPECT_EQ(2u, cache.getEntryCount());
+
+    cache.trim(VK_NULL_HANDLE, completedSerial);
+    EXPECT_EQ(1u, cache.getEntryCount());
+    EXPECT_EQ(1u, cache.getStats().evictionCount);
+
+    cache.destroy(VK_NULL_HANDLE);
+}
+
+VkPhysicalDeviceProperties MakePhysicalDeviceProperties()
+{
+    VkPhysicalDeviceProperties properties;
+    memset(&properties, 0, sizeof(properties));
+    properties.vendorID      = 0x10DE;
+    properties.deviceID      = 0x1234;
+    properties.driverVersion = 42;
+    for (uint8_t index = 0; index < VK_UUID_SIZE; ++index)
+    {
+        properties.pipelineCacheUUID[index] = index;
+    }
+    return properties;
+}
+
+std::vector<vk::PipelineDescRecord> MakePipelineDescRecords()
+{
+    std::vector<vk::PipelineDescRecord> records(2);
+    for (size_t index = 0; index < records.size(); ++index)
+    {
+        vk::PipelineDescRecord &record = records[index];
+        record.shaderKey.fill(static_cast<uint8_t>(index + 1));
+        record.desc.initDefaults();
+        record.desc.updateScissor(gl::Rectangle(0, 0, 16, static_cast<int>(index + 1)));
+        record.activeAttribLocationsMask.set(index);
+    }
+    return records;
+}
+
+// The driver's cache data and the recorded pipelines come back as they were stored.
+TEST(VulkanPipelineCacheDataTest, RoundTrip)
+{
+    VkPhysicalDeviceProperties properties       = MakePhysicalDeviceProperties();
+    std::vector<uint8_t> cacheData              = {1, 2, 3, 4, 5};
+    std::vector<vk::PipelineDescRecord> records = MakePipelineDescRecords();
+
+    std::vector<uint8_t> packed;
+    vk::PackPipelineCacheData(properties, cacheData, records, &packed);
+
+    std::vector<uint8_t> unpackedCacheData;
+    std::vector<vk::PipelineDescRecord> unpackedRecords;
+    ASSERT_TRUE(vk::UnpackPipelineCacheData(properties, packed.data(), packed.size(),
+                                            &unpackedCacheData, &unpackedRecords));
+    EXPECT_EQ(cacheData, unpackedCacheData);
+    ASSERT_EQ(records.size(), unpackedRecords.size());
+    for (size_t index = 0; index < records.size(); ++index)
+    {
+        EXPECT_EQ(records[index].shaderKey, unpackedRecords[index].shaderKey);
+        EXPECT_TRUE(records[index].desc == unpackedRecords[index].desc);
+        EXPECT_EQ(records[index].desc.hash(), unpackedRecords[index].desc.hash());
+        EXPECT_EQ(records[index].activeAttribLocationsMask,
+                  unpackedRecords[index].activeAttribLocationsMask);
+    }
+
+    // Either part can be empty.
+    vk::PackPipelineCacheData(properties, std::vector<uint8_t>(), {}, &packed);
+    ASSERT_TRUE(vk::UnpackPipelineCacheData(properties, packed.data(), packed.size(),
+                                            &unpackedCacheData, &unpackedRecords));
+    EXPECT_TRUE(unpackedCacheData.empty());
+    EXPECT_TRUE(unpackedRecords.empty());
+}
+
+// Data written by another device or driver is rejected.
+TEST(VulkanPipelineCacheDataTest, RejectsOtherDevice)
+{
+    VkPhysicalDeviceProperties properties = MakePhysicalDeviceProperties();
+    std::vector<uint8_t> packed;
+    vk::PackPipelineCacheData(properties, {1, 2, 3}, MakePipelineDescRecords(), &packed);
+
+    std::vector<uint8_t> cacheData;
+    std::vector<vk::PipelineDescRecord> records;
+
+    VkPhysicalDeviceProperties otherDriver = properties;
+    otherDriver.driverVersion++;
+    EXPECT_FALSE(vk::UnpackPipelineCacheData(otherDriver, packed.data(), packed.size(),
+                                             &cacheData, &records));
+
+    VkPhysicalDeviceProperties otherUUID = properties;
+    otherUUID.pipelineCacheUUID[VK_UUID_SIZE - 1]++;
+    EXPECT_FALSE(vk::UnpackPipelineCacheData(otherUUID, packed.data(), packed.size(), &cacheData,
+                                             &records));
+
+    VkPhysicalDeviceProperties otherDevice = properties;
+    otherDevice.deviceID++;
+    EXPECT_FALSE(vk::UnpackPipelineCacheData(otherDevice, packed.data(), packed.size(),
+                                             &cacheData, &records));
+
+    EXPECT_TRUE(vk::UnpackPipelineCacheData(properties, packed.data(), packed.size(), &cacheData,
+                                            &records));
+}
+
+// Truncated or corrupt data is rejected.
+TEST(VulkanPipelineCacheDataTest, RejectsCorruptData)
+{
+    VkPhysicalDeviceProperties properties = MakePhysicalDeviceProperties();
+    std::vector<uint8_t> packed;
+    vk::PackPipelineCacheData(properties, {1, 2, 3}, MakePipelineDescRecords(), &packed);
+
+    std::vector<uint8_t> cacheData;
+    std::vector<vk::PipelineDescRecord> records;
+    EXPECT_FALSE(vk::UnpackPipelineCacheData(properties, packed.data(), 0, &cacheData, &records));
+    EXPECT_FALSE(vk::UnpackPipelineCacheData(properties, packed.data(), packed.size() - 1,
+                                             &cacheData, &records));
+
+    std::vector<uint8_t> corrupt = packed;
+    corrupt.back() ^= 0xFF;
+    EXPECT_FALSE(vk::UnpackPipelineCacheData(properties, corrupt.data(), corrupt.size(),
+                                             &cacheData, &records));
+}
+
+// The shader key depends on the code of both shaders and on where one ends.
+TEST(VulkanPipelineCacheDataTest, ShaderKey)
+{
+    std::vector<uint32_t> vertexCode   = {0x07230203, 1, 2};
+    std::vector<uint32_t> fragmentCode = {0x07230203, 3};
+
+    vk::ShaderKey key = vk::ComputeShaderKey(vertexCode, fragmentCode);
+    EXPECT_EQ(key, vk::ComputeShaderKey(vertexCode, fragmentCode));
+
+    std::vector<uint32_t> otherFragmentCode = {0x07230203, 4};
+    EXPECT_NE(key, vk::ComputeShaderKey(vertexCode, otherFragmentCode));
+
+    std::vector<uint32_t> shorterVertexCode  = {0x07230203, 1};
+    std::vector<uint32_t> longerFragmentCode = {2, 0x07230203, 3};
+    EXPECT_NE(key, vk::ComputeShaderKey(shorterVertexCode, longerFragmentCode));
+}
+
+}  // anonymous namespace
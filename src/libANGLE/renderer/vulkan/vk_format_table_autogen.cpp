@@ -463,6 +463,22 @@ void Format::initialize(VkPhysicalDevice physicalDevice, const angle::Format &an
             // This format is not implemented in Vulkan.
             break;
 
+        case angle::Format::ID::BC4_RED_SNORM_BLOCK:
+            // This format is not implemented in Vulkan.
+            break;
+
+        case angle::Format::ID::BC4_RED_UNORM_BLOCK:
+            // This format is not implemented in Vulkan.
+            break;
+
+        case angle::Format::ID::BC5_RG_SNORM_BLOCK:
+            // This format is not implemented in Vulkan.
+            break;
+
+        case angle::Format::ID::BC5_RG_UNORM_BLOCK:
+            // This format is not implemented in Vulkan.
+            break;
+
         case angle::Format::ID::D16_UNORM:
         {
             internalFormat          = GL_DEPTH_COMPONENT16;
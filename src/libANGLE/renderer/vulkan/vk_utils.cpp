@@ -853,6 +853,42 @@ Error ShaderModule::init(VkDevice device, const VkShaderModuleCreateInfo &create
     return NoError();
 }
 
+// PipelineCache implementation.
+PipelineCache::PipelineCache()
+{
+}
+
+void PipelineCache::destroy(VkDevice device)
+{
+    if (valid())
+    {
+        vkDestroyPipelineCache(device, mHandle, nullptr);
+        mHandle = VK_NULL_HANDLE;
+    }
+}
+
+Error PipelineCache::init(VkDevice device, const VkPipelineCacheCreateInfo &createInfo)
+{
+    ASSERT(!valid());
+    ANGLE_VK_TRY(vkCreatePipelineCache(device, &createInfo, nullptr, &mHandle));
+    return NoError();
+}
+
+Error PipelineCache::getCacheData(VkDevice device, std::vector<uint8_t> *cacheDataOut) const
+{
+    ASSERT(valid());
+    size_t cacheSize = 0;
+    ANGLE_VK_TRY(vkGetPipelineCacheData(device, mHandle, &cacheSize, nullptr));
+
+    cacheDataOut->resize(cacheSize);
+    if (cacheSize > 0)
+    {
+        ANGLE_VK_TRY(vkGetPipelineCacheData(device, mHandle, &cacheSize, cacheDataOut->data()));
+        cacheDataOut->resize(cacheSize);
+    }
+    return NoError();
+}
+
 // Pipeline implementation.
 Pipeline::Pipeline()
 {
@@ -867,11 +903,13 @@ void Pipeline::destroy(VkDevice device)
     }
 }
 
-Error Pipeline::initGraphics(VkDevice device, const VkGraphicsPipelineCreateInfo &createInfo)
+Error Pipeline::initGraphics(VkDevice device,
+                             const PipelineCache &pipelineCache,
+                             const VkGraphicsPipelineCreateInfo &createInfo)
 {
     ASSERT(!valid());
-    ANGLE_VK_TRY(
-        vkCreateGraphicsPipelines(device, VK_NULL_HANDLE, 1, &createInfo, nullptr, &mHandle));
+    ANGLE_VK_TRY(vkCreateGraphicsPipelines(device, pipelineCache.getHandle(), 1, &createInfo,
+                                           nullptr, &mHandle));
     return NoError();
 }
 
@@ -1162,6 +1200,9 @@ void GarbageObject::destroy(VkDevice device)
         case HandleType::RenderPass:
             vkDestroyRenderPass(device, reinterpret_cast<VkRenderPass>(mHandle), nullptr);
             break;
+        case HandleType::PipelineCache:
+            vkDestroyPipelineCache(device, reinterpret_cast<VkPipelineCache>(mHandle), nullptr);
+            break;
         case HandleType::Pipeline:
             vkDestroyPipeline(device, reinterpret_cast<VkPipeline>(mHandle), nullptr);
             break;
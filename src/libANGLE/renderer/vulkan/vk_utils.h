@@ -11,6 +11,7 @@
 #define LIBANGLE_RENDERER_VULKAN_VK_UTILS_H_
 
 #include <limits>
+#include <vector>
 
 #include <vulkan/vulkan.h>
 
@@ -164,7 +165,6 @@ inline Error NoError()
 // QueryPool
 // BufferView
 // DescriptorSet
-// PipelineCache
 
 #define ANGLE_HANDLE_TYPES_X(FUNC) \
     FUNC(Semaphore)                \
@@ -177,6 +177,7 @@ inline Error NoError()
     FUNC(ShaderModule)             \
     FUNC(PipelineLayout)           \
     FUNC(RenderPass)               \
+    FUNC(PipelineCache)            \
     FUNC(Pipeline)                 \
     FUNC(DescriptorSetLayout)      \
     FUNC(Sampler)                  \
@@ -519,13 +520,26 @@ class ShaderModule final : public WrappedObject<ShaderModule, VkShaderModule>
     Error init(VkDevice device, const VkShaderModuleCreateInfo &createInfo);
 };
 
+class PipelineCache final : public WrappedObject<PipelineCache, VkPipelineCache>
+{
+  public:
+    PipelineCache();
+    void destroy(VkDevice device);
+
+    Error init(VkDevice device, const VkPipelineCacheCreateInfo &createInfo);
+    Error getCacheData(VkDevice device, std::vector<uint8_t> *cacheDataOut) const;
+};
+
 class Pipeline final : public WrappedObject<Pipeline, VkPipeline>
 {
   public:
     Pipeline();
     void destroy(VkDevice device);
 
-    Error initGraphics(VkDevice device, const VkGraphicsPipelineCreateInfo &createInfo);
+    // The pipeline cache may be invalid, in which case no cache is used.
+    Error initGraphics(VkDevice device,
+                       const PipelineCache &pipelineCache,
+                       const VkGraphicsPipelineCreateInfo &createInfo);
 };
 
 class PipelineLayout final : public WrappedObject<PipelineLayout, VkPipelineLayout>
@@ -752,11 +752,40 @@ Error ValidateCreateContext(Display *display, Config *configuration, gl::Context
               }
               break;
 
+          case EGL_CONTEXT_DEFERRED_COMMAND_STREAM_ANGLE:
+              if (!display->getExtensions().deferredCommandStream)
+              {
+                  return EglBadAttribute() << "Attribute EGL_CONTEXT_DEFERRED_COMMAND_STREAM_ANGLE "
+                                              "requires EGL_ANGLE_deferred_command_stream.";
+              }
+              if (value != EGL_TRUE && value != EGL_FALSE)
+              {
+                  return EglBadAttribute() << "EGL_CONTEXT_DEFERRED_COMMAND_STREAM_ANGLE must be "
+                                              "either EGL_TRUE or EGL_FALSE.";
+              }
+              break;
+
           default:
               return EglBadAttribute() << "Unknown attribute.";
         }
     }
 
+    // Deferred calls may run after client memory was changed or freed, so client arrays can't be
+    // used. ES 1 contexts rely on them.
+    if (attributes.get(EGL_CONTEXT_DEFERRED_COMMAND_STREAM_ANGLE, EGL_FALSE) == EGL_TRUE)
+    {
+        if (attributes.get(EGL_CONTEXT_CLIENT_ARRAYS_ENABLED_ANGLE, EGL_FALSE) == EGL_TRUE)
+        {
+            return EglBadAttribute() << "EGL_CONTEXT_DEFERRED_COMMAND_STREAM_ANGLE can't be used "
+                                        "with EGL_CONTEXT_CLIENT_ARRAYS_ENABLED_ANGLE.";
+        }
+        if (clientMajorVersion == 1)
+        {
+            return EglBadAttribute() << "EGL_CONTEXT_DEFERRED_COMMAND_STREAM_ANGLE requires an "
+                                        "OpenGL ES 2.0 or later context.";
+        }
+    }
+
     switch (clientMajorVersion)
     {
         case 1:
@@ -53,6 +53,10 @@ bool CompressedTextureFormatRequiresExactSize(GLenum internalFormat)
         case GL_COMPRESSED_SRGB8_LOSSY_DECODE_ETC2_ANGLE:
         case GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE:
         case GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE:
+        case GL_COMPRESSED_R11_LOSSY_DECODE_EAC_ANGLE:
+        case GL_COMPRESSED_SIGNED_R11_LOSSY_DECODE_EAC_ANGLE:
+        case GL_COMPRESSED_RG11_LOSSY_DECODE_EAC_ANGLE:
+        case GL_COMPRESSED_SIGNED_RG11_LOSSY_DECODE_EAC_ANGLE:
         case GL_COMPRESSED_RGBA8_LOSSY_DECODE_ETC2_EAC_ANGLE:
         case GL_COMPRESSED_SRGB8_ALPHA8_LOSSY_DECODE_ETC2_EAC_ANGLE:
             return true;
@@ -114,65 +118,24 @@ bool ValidateDrawAttribs(Context *context, GLint primcount, GLint maxVertex, GLi
         return true;
     }
 
-    const auto &vertexAttribs  = vao->getVertexAttributes();
-    const auto &vertexBindings = vao->getVertexBindings();
-
     bool isGLES1 = context->getClientVersion() < Version(2, 0);
 
     const AttributesMask &activeAttribs = ((isGLES1 ? context->getVertexArraysAttributeMask()
                                                     : program->getActiveAttribLocationsMask()) &
                                            vao->getEnabledAttributesMask() & ~clientAttribs);
 
-    for (size_t attributeIndex : activeAttribs)
+    // [OpenGL ES 3.0.2] section 2.9.4 page 40:
+    // We can return INVALID_OPERATION if our array buffer does not have enough backing data.
+    // The vertex array caches the last vertex and instance each attribute can fetch, so only
+    // the draw parameters need to be compared here.
+    GLint64 nonInstancedLimit = 0;
+    GLint64 instancedLimit    = 0;
+    vao->getElementLimits(activeAttribs, &nonInstancedLimit, &instancedLimit);
+    if (static_cast<GLint64>(maxVertex) > nonInstancedLimit ||
+        static_cast<GLint64>(primcount) - 1 > instancedLimit)
     {
-        const VertexAttribute &attrib = vertexAttribs[attributeIndex];
-        ASSERT(attrib.enabled);
-
-        const VertexBinding &binding = vertexBindings[attrib.bindingIndex];
-        ASSERT(isGLES1 || program->isAttribLocationActive(attributeIndex));
-
-        GLint maxVertexElement = maxVertex;
-        GLuint divisor         = binding.getDivisor();
-        if (divisor != 0)
-        {
-            maxVertexElement = (primcount - 1) / divisor;
-        }
-
-        // We do manual overflow checks here instead of using safe_math.h because it was
-        // a bottleneck. Thanks to some properties of GL we know inequalities that can
-        // help us make the overflow checks faster.
-
-        // The max possible attribSize is 16 for a vector of 4 32 bit values.
-        constexpr uint64_t kMaxAttribSize = 16;
-        constexpr uint64_t kIntMax        = std::numeric_limits<int>::max();
-        constexpr uint64_t kUint64Max     = std::numeric_limits<uint64_t>::max();
-
-        // We know attribStride is given as a GLsizei which is typedefed to int.
-        // We also know an upper bound for attribSize.
-        static_assert(std::is_same<int, GLsizei>::value, "Unexpected type");
-        ASSERT(ComputeVertexAttributeStride(attrib, binding) == binding.getStride());
-        uint64_t attribStride = binding.getStride();
-        ASSERT(attribStride <= kIntMax && ComputeVertexAttributeTypeSize(attrib) <= kMaxAttribSize);
-
-        // Computing the product of two 32-bit ints will fit in 64 bits without overflow.
-        static_assert(kIntMax * kIntMax < kUint64Max, "Unexpected overflow");
-        uint64_t attribDataSizeMinusAttribSize = maxVertexElement * attribStride;
-
-        // An overflow can happen when adding the offset, check for it.
-        if (attribDataSizeMinusAttribSize > kUint64Max - attrib.cachedSizePlusRelativeOffset)
-        {
-            ANGLE_VALIDATION_ERR(context, InvalidOperation(), IntegerOverflow);
-            return false;
-        }
-
-        // [OpenGL ES 3.0.2] section 2.9.4 page 40:
-        // We can return INVALID_OPERATION if our array buffer does not have enough backing data.
-        if (attribDataSizeMinusAttribSize + attrib.cachedSizePlusRelativeOffset >
-            binding.getCachedBufferSizeMinusOffset())
-        {
-            ANGLE_VALIDATION_ERR(context, InvalidOperation(), InsufficientVertexBufferSize);
-            return false;
-        }
+        ANGLE_VALIDATION_ERR(context, InvalidOperation(), InsufficientVertexBufferSize);
+        return false;
     }
 
     if (webglCompatibility && vao->hasTransformFeedbackBindingConflict(activeAttribs))
@@ -518,6 +481,80 @@ bool IsCompatibleDrawModeWithGeometryShader(GLenum drawMode,
     }
 }
 
+// Checks the draw state that only changes with the stencil state, the draw framebuffer and the
+// program. The results are cached by the context until one of those changes.
+bool ValidateBasicDrawStates(Context *context, Framebuffer *framebuffer)
+{
+    const Extensions &extensions = context->getExtensions();
+    const State &state           = context->getGLState();
+
+    // Note: these separate values are not supported in WebGL, due to D3D's limitations. See
+    // Section 6.10 of the WebGL 1.0 spec.
+    if (context->getLimitations().noSeparateStencilRefsAndMasks || extensions.webglCompatibility)
+    {
+        ASSERT(framebuffer);
+        const FramebufferAttachment *dsAttachment =
+            framebuffer->getStencilOrDepthStencilAttachment();
+        const GLuint stencilBits = dsAttachment ? dsAttachment->getStencilSize() : 0;
+        ASSERT(stencilBits <= 8);
+
+        const DepthStencilState &depthStencilState = state.getDepthStencilState();
+        if (depthStencilState.stencilTest && stencilBits > 0)
+        {
+            GLuint maxStencilValue = (1 << stencilBits) - 1;
+
+            bool differentRefs =
+                clamp(state.getStencilRef(), 0, static_cast<GLint>(maxStencilValue)) !=
+                clamp(state.getStencilBackRef(), 0, static_cast<GLint>(maxStencilValue));
+            bool differentWritemasks = (depthStencilState.stencilWritemask & maxStencilValue) !=
+                                       (depthStencilState.stencilBackWritemask & maxStencilValue);
+            bool differentMasks = (depthStencilState.stencilMask & maxStencilValue) !=
+                                  (depthStencilState.stencilBackMask & maxStencilValue);
+
+            if (differentRefs || differentWritemasks || differentMasks)
+            {
+                if (!extensions.webglCompatibility)
+                {
+                    ERR() << "This ANGLE implementation does not support separate front/back "
+                             "stencil writemasks, reference values, or stencil mask values.";
+                }
+                ANGLE_VALIDATION_ERR(context, InvalidOperation(), StencilReferenceMaskOrMismatch);
+                return false;
+            }
+        }
+    }
+
+    if (!ValidateFramebufferComplete(context, framebuffer))
+    {
+        return false;
+    }
+
+    // If we are running GLES1, there is no current program.
+    if (context->getClientVersion() >= Version(2, 0))
+    {
+        const Program *program = state.getProgram();
+        if (!program)
+        {
+            ANGLE_VALIDATION_ERR(context, InvalidOperation(), ProgramNotBound);
+            return false;
+        }
+
+        // In OpenGL ES spec for UseProgram at section 7.3, trying to render without
+        // vertex shader stage or fragment shader stage is a undefined behaviour.
+        // But ANGLE should clearly generate an INVALID_OPERATION error instead of
+        // produce undefined result.
+        if (!program->hasLinkedShaderStage(ShaderType::Vertex) ||
+            !program->hasLinkedShaderStage(ShaderType::Fragment))
+        {
+            context->handleError(InvalidOperation()
+                                 << "It is a undefined behaviour to render without "
+                                    "vertex shader stage or fragment shader stage.");
+            return false;
+        }
+    }
+
+    return true;
+}
 }  // anonymous namespace
 
 void SetRobustLengthParam(GLsizei *length, GLsizei value)
@@ -1066,14 +1103,14 @@ bool ValidateWebGLVertexAttribPointer(Context *context,
     return true;
 }
 
-Program *GetValidProgram(Context *context, GLuint id)
+Program *GetValidProgramNoResolveLink(Context *context, GLuint id)
 {
     // ES3 spec (section 2.11.1) -- "Commands that accept shader or program object names will
     // generate the error INVALID_VALUE if the provided name is not the name of either a shader
     // or program object and INVALID_OPERATION if the provided name identifies an object
     // that is not the expected type."
 
-    Program *validProgram = context->getProgram(id);
+    Program *validProgram = context->getProgramNoResolveLink(id);
 
     if (!validProgram)
     {
@@ -1090,6 +1127,16 @@ Program *GetValidProgram(Context *context, GLuint id)
     return validProgram;
 }
 
+Program *GetValidProgram(Context *context, GLuint id)
+{
+    Program *program = GetValidProgramNoResolveLink(context, id);
+    if (program)
+    {
+        program->resolveLink(context);
+    }
+    return program;
+}
+
 Shader *GetValidShader(Context *context, GLuint id)
 {
     // See ValidProgram for spec details.
@@ -1098,7 +1145,7 @@ Shader *GetValidShader(Context *context, GLuint id)
 
     if (!validShader)
     {
-        if (context->getProgram(id))
+        if (context->getProgramNoResolveLink(id))
         {
             ANGLE_VALIDATION_ERR(context, InvalidOperation(), ExpectedShaderName);
         }
@@ -2660,7 +2707,6 @@ bool ValidateDrawBase(Context *context, GLenum mode, GLsizei count)
     if (!extensions.webglCompatibility)
     {
         // Check for mapped buffers
-        // TODO(jmadill): Optimize this check for non - WebGL contexts.
         if (state.hasMappedBuffer(BufferBinding::Array))
         {
             context->handleError(InvalidOperation());
@@ -2668,71 +2714,21 @@ bool ValidateDrawBase(Context *context, GLenum mode, GLsizei count)
         }
     }
 
-    // Note: these separate values are not supported in WebGL, due to D3D's limitations. See
-    // Section 6.10 of the WebGL 1.0 spec.
     Framebuffer *framebuffer = state.getDrawFramebuffer();
-    if (context->getLimitations().noSeparateStencilRefsAndMasks || extensions.webglCompatibility)
+    if (!context->areBasicDrawStatesValid())
     {
-        ASSERT(framebuffer);
-        const FramebufferAttachment *dsAttachment =
-            framebuffer->getStencilOrDepthStencilAttachment();
-        const GLuint stencilBits = dsAttachment ? dsAttachment->getStencilSize() : 0;
-        ASSERT(stencilBits <= 8);
-
-        const DepthStencilState &depthStencilState = state.getDepthStencilState();
-        if (depthStencilState.stencilTest && stencilBits > 0)
+        if (!ValidateBasicDrawStates(context, framebuffer))
         {
-            GLuint maxStencilValue = (1 << stencilBits) - 1;
-
-            bool differentRefs =
-                clamp(state.getStencilRef(), 0, static_cast<GLint>(maxStencilValue)) !=
-                clamp(state.getStencilBackRef(), 0, static_cast<GLint>(maxStencilValue));
-            bool differentWritemasks = (depthStencilState.stencilWritemask & maxStencilValue) !=
-                                       (depthStencilState.stencilBackWritemask & maxStencilValue);
-            bool differentMasks = (depthStencilState.stencilMask & maxStencilValue) !=
-                                  (depthStencilState.stencilBackMask & maxStencilValue);
-
-            if (differentRefs || differentWritemasks || differentMasks)
-            {
-                if (!extensions.webglCompatibility)
-                {
-                    ERR() << "This ANGLE implementation does not support separate front/back "
-                             "stencil writemasks, reference values, or stencil mask values.";
-                }
-                ANGLE_VALIDATION_ERR(context, InvalidOperation(), StencilReferenceMaskOrMismatch);
-                return false;
-            }
+            return false;
         }
-    }
-
-    if (!ValidateFramebufferComplete(context, framebuffer))
-    {
-        return false;
+        context->onBasicDrawStatesValidated();
     }
 
     // If we are running GLES1, there is no current program.
     if (context->getClientVersion() >= Version(2, 0))
     {
-
         gl::Program *program = state.getProgram();
-        if (!program)
-        {
-            ANGLE_VALIDATION_ERR(context, InvalidOperation(), ProgramNotBound);
-            return false;
-        }
-
-        // In OpenGL ES spec for UseProgram at section 7.3, trying to render without
-        // vertex shader stage or fragment shader stage is a undefined behaviour.
-        // But ANGLE should clearly generate an INVALID_OPERATION error instead of
-        // produce undefined result.
-        if (!program->hasLinkedShaderStage(ShaderType::Vertex) ||
-            !program->hasLinkedShaderStage(ShaderType::Fragment))
-        {
-            context->handleError(InvalidOperation()
-                                 << "It is a undefined behaviour to render without "
-                                    "vertex shader stage or fragment shader stage.");
-            return false;
-        }
+        ASSERT(program);
 
         if (!program->validateSamplers(nullptr, context->getCaps()))
         {
@@ -3012,7 +3008,6 @@ bool ValidateDrawElementsCommon(Context *context,
     if (!context->getExtensions().webglCompatibility)
     {
         // Check for mapped buffers
-        // TODO(jmadill): Optimize this check for non - WebGL contexts.
         if (state.hasMappedBuffer(gl::BufferBinding::ElementArray))
         {
             context->handleError(InvalidOperation() << "Index buffer is mapped.");
@@ -4423,14 +4418,28 @@ bool ValidateGetProgramivBase(Context *context, GLuint program, GLenum pname, GL
         *numParams = 1;
     }
 
-    Program *programObject = GetValidProgram(context, program);
+    // GL_COMPLETION_STATUS_KHR must not block on a pending link.
+    Program *programObject = GetValidProgramNoResolveLink(context, program);
     if (!programObject)
     {
         return false;
     }
 
+    if (pname != GL_COMPLETION_STATUS_KHR)
+    {
+        programObject->resolveLink(context);
+    }
+
     switch (pname)
     {
+        case GL_COMPLETION_STATUS_KHR:
+            if (!context->getExtensions().parallelShaderCompile)
+            {
+                ANGLE_VALIDATION_ERR(context, InvalidEnum(), ExtensionNotEnabled);
+                return false;
+            }
+            break;
+
         case GL_DELETE_STATUS:
         case GL_LINK_STATUS:
         case GL_VALIDATE_STATUS:
@@ -5387,6 +5396,14 @@ bool ValidateGetShaderivBase(Context *context, GLuint shader, GLenum pname, GLsi
             }
             break;
 
+        case GL_COMPLETION_STATUS_KHR:
+            if (!context->getExtensions().parallelShaderCompile)
+            {
+                ANGLE_VALIDATION_ERR(context, InvalidEnum(), ExtensionNotEnabled);
+                return false;
+            }
+            break;
+
         default:
             ANGLE_VALIDATION_ERR(context, InvalidEnum(), EnumNotSupported);
             return false;
@@ -86,6 +86,7 @@ bool ValidateWebGLVertexAttribPointer(Context *context,
 // Returns valid program if id is a valid program name
 // Errors INVALID_OPERATION if valid shader is given and returns NULL
 // Errors INVALID_VALUE otherwise and returns NULL
+Program *GetValidProgramNoResolveLink(Context *context, GLuint id);
 Program *GetValidProgram(Context *context, GLuint id);
 
 // Returns valid shader if id is a valid shader name
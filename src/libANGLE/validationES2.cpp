@@ -33,6 +33,22 @@ namespace gl
 namespace
 {
 
+// The lossy EAC formats are stored as BC4 or BC5 blocks, which not every device can sample.
+bool IsLossyEACFormat(GLenum internalFormat)
+{
+    switch (internalFormat)
+    {
+        case GL_COMPRESSED_R11_LOSSY_DECODE_EAC_ANGLE:
+        case GL_COMPRESSED_SIGNED_R11_LOSSY_DECODE_EAC_ANGLE:
+        case GL_COMPRESSED_RG11_LOSSY_DECODE_EAC_ANGLE:
+        case GL_COMPRESSED_SIGNED_RG11_LOSSY_DECODE_EAC_ANGLE:
+            return true;
+
+        default:
+            return false;
+    }
+}
+
 bool IsPartialBlit(gl::Context *context,
                    const FramebufferAttachment *readBuffer,
                    const FramebufferAttachment *writeBuffer,
@@ -575,6 +591,12 @@ bool ValidateES2CopyTexImageParameters(Context *context,
             case GL_COMPRESSED_SRGB8_LOSSY_DECODE_ETC2_ANGLE:
             case GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE:
             case GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE:
+            case GL_COMPRESSED_R11_LOSSY_DECODE_EAC_ANGLE:
+            case GL_COMPRESSED_SIGNED_R11_LOSSY_DECODE_EAC_ANGLE:
+            case GL_COMPRESSED_RG11_LOSSY_DECODE_EAC_ANGLE:
+            case GL_COMPRESSED_SIGNED_RG11_LOSSY_DECODE_EAC_ANGLE:
+            case GL_COMPRESSED_RGBA8_LOSSY_DECODE_ETC2_EAC_ANGLE:
+            case GL_COMPRESSED_SRGB8_ALPHA8_LOSSY_DECODE_ETC2_EAC_ANGLE:
                 ANGLE_VALIDATION_ERR(context, InvalidOperation(), InvalidFormat);
                 return false;
             case GL_DEPTH_COMPONENT:
@@ -711,6 +733,12 @@ bool ValidateES2CopyTexImageParameters(Context *context,
             case GL_COMPRESSED_SRGB8_LOSSY_DECODE_ETC2_ANGLE:
             case GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE:
             case GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE:
+            case GL_COMPRESSED_R11_LOSSY_DECODE_EAC_ANGLE:
+            case GL_COMPRESSED_SIGNED_R11_LOSSY_DECODE_EAC_ANGLE:
+            case GL_COMPRESSED_RG11_LOSSY_DECODE_EAC_ANGLE:
+            case GL_COMPRESSED_SIGNED_RG11_LOSSY_DECODE_EAC_ANGLE:
+            case GL_COMPRESSED_RGBA8_LOSSY_DECODE_ETC2_EAC_ANGLE:
+            case GL_COMPRESSED_SRGB8_ALPHA8_LOSSY_DECODE_ETC2_EAC_ANGLE:
                 if (context->getExtensions().lossyETCDecode)
                 {
                     context->handleError(InvalidOperation()
@@ -1208,6 +1236,13 @@ bool ValidateES2TexImageParameters(Context *context,
             return false;
         }
 
+        if (IsLossyEACFormat(actualInternalFormat) &&
+            !context->getTextureCaps().get(actualInternalFormat).texturable)
+        {
+            ANGLE_VALIDATION_ERR(context, InvalidEnum(), InvalidInternalFormat);
+            return false;
+        }
+
         if (isSubImage)
         {
             // From the OES_compressed_ETC1_RGB8_texture spec:
@@ -1452,6 +1487,12 @@ bool ValidateES2TexImageParameters(Context *context,
             case GL_COMPRESSED_SRGB8_LOSSY_DECODE_ETC2_ANGLE:
             case GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE:
             case GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE:
+            case GL_COMPRESSED_R11_LOSSY_DECODE_EAC_ANGLE:
+            case GL_COMPRESSED_SIGNED_R11_LOSSY_DECODE_EAC_ANGLE:
+            case GL_COMPRESSED_RG11_LOSSY_DECODE_EAC_ANGLE:
+            case GL_COMPRESSED_SIGNED_RG11_LOSSY_DECODE_EAC_ANGLE:
+            case GL_COMPRESSED_RGBA8_LOSSY_DECODE_ETC2_EAC_ANGLE:
+            case GL_COMPRESSED_SRGB8_ALPHA8_LOSSY_DECODE_ETC2_EAC_ANGLE:
                 if (context->getExtensions().lossyETCDecode)
                 {
                     context->handleError(InvalidOperation()
@@ -1694,12 +1735,24 @@ bool ValidateES2TexStorageParameters(Context *context,
         case GL_COMPRESSED_SRGB8_LOSSY_DECODE_ETC2_ANGLE:
         case GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE:
         case GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_LOSSY_DECODE_ETC2_ANGLE:
+        case GL_COMPRESSED_R11_LOSSY_DECODE_EAC_ANGLE:
+        case GL_COMPRESSED_SIGNED_R11_LOSSY_DECODE_EAC_ANGLE:
+        case GL_COMPRESSED_RG11_LOSSY_DECODE_EAC_ANGLE:
+        case GL_COMPRESSED_SIGNED_RG11_LOSSY_DECODE_EAC_ANGLE:
+        case GL_COMPRESSED_RGBA8_LOSSY_DECODE_ETC2_EAC_ANGLE:
+        case GL_COMPRESSED_SRGB8_ALPHA8_LOSSY_DECODE_ETC2_EAC_ANGLE:
             if (!context->getExtensions().lossyETCDecode)
             {
                 context->handleError(InvalidEnum()
                                      << "ANGLE_lossy_etc_decode extension is not supported.");
                 return false;
             }
+            if (IsLossyEACFormat(internalformat) &&
+                !context->getTextureCaps().get(internalformat).texturable)
+            {
+                ANGLE_VALIDATION_ERR(context, InvalidEnum(), InvalidInternalFormat);
+                return false;
+            }
             break;
         case GL_RGBA32F_EXT:
         case GL_RGB32F_EXT:
@@ -2143,6 +2196,17 @@ bool ValidatePopDebugGroupKHR(Context *context)
     return true;
 }
 
+bool ValidateMaxShaderCompilerThreadsKHR(Context *context, GLuint count)
+{
+    if (!context->getExtensions().parallelShaderCompile)
+    {
+        ANGLE_VALIDATION_ERR(context, InvalidOperation(), ExtensionNotEnabled);
+        return false;
+    }
+
+    return true;
+}
+
 static bool ValidateObjectIdentifierAndName(Context *context, GLenum identifier, GLuint name)
 {
     switch (identifier)
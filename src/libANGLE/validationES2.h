@@ -82,6 +82,7 @@ bool ValidatePushDebugGroupKHR(Context *context,
                                GLsizei length,
                                const GLchar *message);
 bool ValidatePopDebugGroupKHR(Context *context);
+bool ValidateMaxShaderCompilerThreadsKHR(Context *context, GLuint count);
 bool ValidateObjectLabelKHR(Context *context,
                             GLenum identifier,
                             GLuint name,
@@ -0,0 +1,84 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// entry_points_deferred.h:
+//   Records entry point calls into the command stream of a context created with
+//   EGL_CONTEXT_DEFERRED_COMMAND_STREAM_ANGLE. The stream's thread replays a call by making the
+//   context current and calling the entry point again, which then runs as usual.
+
+#ifndef LIBGLESV2_ENTRY_POINTS_DEFERRED_H_
+#define LIBGLESV2_ENTRY_POINTS_DEFERRED_H_
+
+#include <tuple>
+
+#include "angle_gl.h"
+#include "libANGLE/Context.h"
+#include "libANGLE/Thread.h"
+#include "libGLESv2/global_state.h"
+
+namespace gl
+{
+
+namespace priv
+{
+
+template <size_t... Indices>
+struct IndexSequence
+{
+};
+
+template <size_t Count, size_t... Indices>
+struct MakeIndexSequence : MakeIndexSequence<Count - 1, Count - 1, Indices...>
+{
+};
+
+template <size_t... Indices>
+struct MakeIndexSequence<0, Indices...>
+{
+    using Type = IndexSequence<Indices...>;
+};
+
+template <typename... ParamsT>
+struct DeferredEntryPoint
+{
+    void(GL_APIENTRY *entryPoint)(ParamsT...);
+    std::tuple<ParamsT...> params;
+};
+
+template <typename... ParamsT, size_t... Indices>
+void CallDeferredEntryPoint(const DeferredEntryPoint<ParamsT...> &call,
+                            IndexSequence<Indices...>)
+{
+    call.entryPoint(std::get<Indices>(call.params)...);
+}
+
+template <typename... ParamsT>
+void ReplayDeferredEntryPoint(Context *context, const void *payload)
+{
+    egl::Thread *thread = egl::GetCurrentThread();
+    if (thread->getContext() != context)
+    {
+        thread->setCurrent(context);
+    }
+
+    CallDeferredEntryPoint(*static_cast<const DeferredEntryPoint<ParamsT...> *>(payload),
+                           typename MakeIndexSequence<sizeof...(ParamsT)>::Type());
+}
+
+}  // namespace priv
+
+// Only used for entry points without pointer parameters or return values.
+template <typename... ParamsT, typename... ArgsT>
+ANGLE_INLINE void DeferEntryPoint(Context *context,
+                                  void(GL_APIENTRY *entryPoint)(ParamsT...),
+                                  ArgsT... args)
+{
+    priv::DeferredEntryPoint<ParamsT...> call = {entryPoint, std::tuple<ParamsT...>(args...)};
+    context->getCommandStream()->enqueue(&priv::ReplayDeferredEntryPoint<ParamsT...>, call);
+}
+
+}  // namespace gl
+
+#endif  // LIBGLESV2_ENTRY_POINTS_DEFERRED_H_
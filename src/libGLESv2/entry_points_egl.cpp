@@ -353,6 +353,7 @@ EGLBoolean EGLAPIENTRY DestroySurface(EGLDisplay dpy, EGLSurface surface)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLSurface surface = 0x%0.8p)", dpy, surface);
     Thread *thread = GetCurrentThread();
+    FinishDeferredCommands(thread);
 
     Display *display    = static_cast<Display *>(dpy);
     Surface *eglSurface = static_cast<Surface *>(surface);
@@ -448,6 +449,7 @@ EGLBoolean EGLAPIENTRY DestroyContext(EGLDisplay dpy, EGLContext ctx)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLContext ctx = 0x%0.8p)", dpy, ctx);
     Thread *thread = GetCurrentThread();
+    FinishDeferredCommands(thread);
 
     Display *display     = static_cast<Display *>(dpy);
     gl::Context *context = static_cast<gl::Context *>(ctx);
@@ -488,6 +490,7 @@ EGLBoolean EGLAPIENTRY MakeCurrent(EGLDisplay dpy, EGLSurface draw, EGLSurface r
         "EGLContext ctx = 0x%0.8p)",
         dpy, draw, read, ctx);
     Thread *thread = GetCurrentThread();
+    FinishDeferredCommands(thread);
 
     Display *display     = static_cast<Display *>(dpy);
     Surface *drawSurface = static_cast<Surface *>(draw);
@@ -584,6 +587,7 @@ EGLBoolean EGLAPIENTRY WaitGL(void)
 {
     EVENT("()");
     Thread *thread = GetCurrentThread();
+    FinishDeferredCommands(thread);
 
     Display *display = thread->getCurrentDisplay();
 
@@ -641,6 +645,7 @@ EGLBoolean EGLAPIENTRY SwapBuffers(EGLDisplay dpy, EGLSurface surface)
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLSurface surface = 0x%0.8p)", dpy, surface);
     Thread *thread = GetCurrentThread();
+    FinishDeferredCommands(thread);
 
     Display *display    = static_cast<Display *>(dpy);
     Surface *eglSurface = (Surface *)surface;
@@ -688,6 +693,7 @@ EGLBoolean EGLAPIENTRY CopyBuffers(EGLDisplay dpy, EGLSurface surface, EGLNative
         "0x%0.8p)",
         dpy, surface, target);
     Thread *thread = GetCurrentThread();
+    FinishDeferredCommands(thread);
 
     Display *display    = static_cast<Display *>(dpy);
     Surface *eglSurface = static_cast<Surface *>(surface);
@@ -717,6 +723,7 @@ EGLBoolean EGLAPIENTRY BindTexImage(EGLDisplay dpy, EGLSurface surface, EGLint b
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLSurface surface = 0x%0.8p, EGLint buffer = %d)", dpy,
           surface, buffer);
     Thread *thread = GetCurrentThread();
+    FinishDeferredCommands(thread);
 
     Display *display    = static_cast<Display *>(dpy);
     Surface *eglSurface = static_cast<Surface *>(surface);
@@ -810,6 +817,7 @@ EGLBoolean EGLAPIENTRY ReleaseTexImage(EGLDisplay dpy, EGLSurface surface, EGLin
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLSurface surface = 0x%0.8p, EGLint buffer = %d)", dpy,
           surface, buffer);
     Thread *thread = GetCurrentThread();
+    FinishDeferredCommands(thread);
 
     Display *display    = static_cast<Display *>(dpy);
     Surface *eglSurface = static_cast<Surface *>(surface);
@@ -963,6 +971,7 @@ EGLBoolean EGLAPIENTRY ReleaseThread(void)
 {
     EVENT("()");
     Thread *thread = GetCurrentThread();
+    FinishDeferredCommands(thread);
 
     MakeCurrent(EGL_NO_DISPLAY, EGL_NO_CONTEXT, EGL_NO_SURFACE, EGL_NO_SURFACE);
 
@@ -974,6 +983,7 @@ EGLBoolean EGLAPIENTRY WaitClient(void)
 {
     EVENT("()");
     Thread *thread = GetCurrentThread();
+    FinishDeferredCommands(thread);
 
     Display *display = thread->getCurrentDisplay();
 
@@ -1069,6 +1079,7 @@ EGLImage EGLAPIENTRY CreateImage(EGLDisplay dpy,
         "EGLClientBuffer buffer = 0x%0.8p, const EGLAttrib *attrib_list = 0x%0.8p)",
         dpy, ctx, target, buffer, attrib_list);
     Thread *thread = GetCurrentThread();
+    FinishDeferredCommands(thread);
 
     UNIMPLEMENTED();
     thread->setError(EglBadDisplay() << "eglCreateImage unimplemented.");
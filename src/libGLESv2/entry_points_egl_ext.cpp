@@ -84,6 +84,7 @@ EGLBoolean EGLAPIENTRY PostSubBufferNV(EGLDisplay dpy, EGLSurface surface, EGLin
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLSurface surface = 0x%0.8p, EGLint x = %d, EGLint y = %d, EGLint width = %d, EGLint height = %d)", dpy, surface, x, y, width, height);
     Thread *thread = GetCurrentThread();
+    FinishDeferredCommands(thread);
 
     if (x < 0 || y < 0 || width < 0 || height < 0)
     {
@@ -290,6 +291,7 @@ ANGLE_EXPORT EGLImageKHR EGLAPIENTRY CreateImageKHR(EGLDisplay dpy,
         "EGLClientBuffer buffer = 0x%0.8p, const EGLAttrib *attrib_list = 0x%0.8p)",
         dpy, ctx, target, buffer, attrib_list);
     Thread *thread = GetCurrentThread();
+    FinishDeferredCommands(thread);
 
     Display *display     = static_cast<Display *>(dpy);
     gl::Context *context = static_cast<gl::Context *>(ctx);
@@ -547,6 +549,7 @@ EGLBoolean EGLAPIENTRY StreamConsumerGLTextureExternalKHR(EGLDisplay dpy, EGLStr
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLStreamKHR = 0x%0.8p)", dpy, stream);
     Thread *thread = GetCurrentThread();
+    FinishDeferredCommands(thread);
 
     Display *display     = static_cast<Display *>(dpy);
     Stream *streamObject = static_cast<Stream *>(stream);
@@ -574,6 +577,7 @@ EGLBoolean EGLAPIENTRY StreamConsumerAcquireKHR(EGLDisplay dpy, EGLStreamKHR str
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLStreamKHR = 0x%0.8p)", dpy, stream);
     Thread *thread = GetCurrentThread();
+    FinishDeferredCommands(thread);
 
     Display *display     = static_cast<Display *>(dpy);
     Stream *streamObject = static_cast<Stream *>(stream);
@@ -601,6 +605,7 @@ EGLBoolean EGLAPIENTRY StreamConsumerReleaseKHR(EGLDisplay dpy, EGLStreamKHR str
 {
     EVENT("(EGLDisplay dpy = 0x%0.8p, EGLStreamKHR = 0x%0.8p)", dpy, stream);
     Thread *thread = GetCurrentThread();
+    FinishDeferredCommands(thread);
 
     Display *display     = static_cast<Display *>(dpy);
     Stream *streamObject = static_cast<Stream *>(stream);
@@ -632,6 +637,7 @@ EGLBoolean EGLAPIENTRY StreamConsumerGLTextureExternalAttribsNV(EGLDisplay dpy,
         "(EGLDisplay dpy = 0x%0.8p, EGLStreamKHR stream = 0x%0.8p, EGLAttrib attrib_list = 0x%0.8p",
         dpy, stream, attrib_list);
     Thread *thread = GetCurrentThread();
+    FinishDeferredCommands(thread);
 
     Display *display        = static_cast<Display *>(dpy);
     Stream *streamObject    = static_cast<Stream *>(stream);
@@ -764,6 +770,7 @@ ANGLE_EXPORT EGLBoolean SwapBuffersWithDamageEXT(EGLDisplay dpy,
         "n_rects = %d)",
         dpy, surface, rects, n_rects);
     Thread *thread = GetCurrentThread();
+    FinishDeferredCommands(thread);
 
     Display *display    = static_cast<Display *>(dpy);
     Surface *eglSurface = static_cast<Surface *>(surface);
@@ -12,6 +12,7 @@
 
 #include "libANGLE/Context.h"
 #include "libANGLE/validationES1.h"
+#include "libGLESv2/entry_points_deferred.h"
 #include "libGLESv2/global_state.h"
 
 namespace gl
@@ -20,9 +21,15 @@ void GL_APIENTRY AlphaFunc(GLenum func, GLfloat ref)
 {
     EVENT("(GLenum func = 0x%X, GLfloat ref = %f)", func, ref);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, AlphaFunc, func, ref);
+            return;
+        }
+
         AlphaTestFunc funcPacked = FromGLenum<AlphaTestFunc>(func);
         context->gatherParams<EntryPoint::AlphaFunc>(funcPacked, ref);
 
@@ -37,9 +44,15 @@ void GL_APIENTRY AlphaFuncx(GLenum func, GLfixed ref)
 {
     EVENT("(GLenum func = 0x%X, GLfixed ref = 0x%X)", func, ref);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, AlphaFuncx, func, ref);
+            return;
+        }
+
         AlphaTestFunc funcPacked = FromGLenum<AlphaTestFunc>(func);
         context->gatherParams<EntryPoint::AlphaFuncx>(funcPacked, ref);
 
@@ -55,9 +68,15 @@ void GL_APIENTRY ClearColorx(GLfixed red, GLfixed green, GLfixed blue, GLfixed a
     EVENT("(GLfixed red = 0x%X, GLfixed green = 0x%X, GLfixed blue = 0x%X, GLfixed alpha = 0x%X)",
           red, green, blue, alpha);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, ClearColorx, red, green, blue, alpha);
+            return;
+        }
+
         context->gatherParams<EntryPoint::ClearColorx>(red, green, blue, alpha);
 
         if (context->skipValidation() || ValidateClearColorx(context, red, green, blue, alpha))
@@ -71,9 +90,15 @@ void GL_APIENTRY ClearDepthx(GLfixed depth)
 {
     EVENT("(GLfixed depth = 0x%X)", depth);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, ClearDepthx, depth);
+            return;
+        }
+
         context->gatherParams<EntryPoint::ClearDepthx>(depth);
 
         if (context->skipValidation() || ValidateClearDepthx(context, depth))
@@ -87,9 +112,15 @@ void GL_APIENTRY ClientActiveTexture(GLenum texture)
 {
     EVENT("(GLenum texture = 0x%X)", texture);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, ClientActiveTexture, texture);
+            return;
+        }
+
         context->gatherParams<EntryPoint::ClientActiveTexture>(texture);
 
         if (context->skipValidation() || ValidateClientActiveTexture(context, texture))
@@ -136,9 +167,15 @@ void GL_APIENTRY Color4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha
     EVENT("(GLfloat red = %f, GLfloat green = %f, GLfloat blue = %f, GLfloat alpha = %f)", red,
           green, blue, alpha);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, Color4f, red, green, blue, alpha);
+            return;
+        }
+
         context->gatherParams<EntryPoint::Color4f>(red, green, blue, alpha);
 
         if (context->skipValidation() || ValidateColor4f(context, red, green, blue, alpha))
@@ -153,9 +190,15 @@ void GL_APIENTRY Color4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte alph
     EVENT("(GLubyte red = %d, GLubyte green = %d, GLubyte blue = %d, GLubyte alpha = %d)", red,
           green, blue, alpha);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, Color4ub, red, green, blue, alpha);
+            return;
+        }
+
         context->gatherParams<EntryPoint::Color4ub>(red, green, blue, alpha);
 
         if (context->skipValidation() || ValidateColor4ub(context, red, green, blue, alpha))
@@ -170,9 +213,15 @@ void GL_APIENTRY Color4x(GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha
     EVENT("(GLfixed red = 0x%X, GLfixed green = 0x%X, GLfixed blue = 0x%X, GLfixed alpha = 0x%X)",
           red, green, blue, alpha);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, Color4x, red, green, blue, alpha);
+            return;
+        }
+
         context->gatherParams<EntryPoint::Color4x>(red, green, blue, alpha);
 
         if (context->skipValidation() || ValidateColor4x(context, red, green, blue, alpha))
@@ -204,9 +253,15 @@ void GL_APIENTRY DepthRangex(GLfixed n, GLfixed f)
 {
     EVENT("(GLfixed n = 0x%X, GLfixed f = 0x%X)", n, f);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, DepthRangex, n, f);
+            return;
+        }
+
         context->gatherParams<EntryPoint::DepthRangex>(n, f);
 
         if (context->skipValidation() || ValidateDepthRangex(context, n, f))
@@ -220,9 +275,15 @@ void GL_APIENTRY DisableClientState(GLenum array)
 {
     EVENT("(GLenum array = 0x%X)", array);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, DisableClientState, array);
+            return;
+        }
+
         ClientVertexArrayType arrayPacked = FromGLenum<ClientVertexArrayType>(array);
         context->gatherParams<EntryPoint::DisableClientState>(arrayPacked);
 
@@ -237,9 +298,15 @@ void GL_APIENTRY EnableClientState(GLenum array)
 {
     EVENT("(GLenum array = 0x%X)", array);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, EnableClientState, array);
+            return;
+        }
+
         ClientVertexArrayType arrayPacked = FromGLenum<ClientVertexArrayType>(array);
         context->gatherParams<EntryPoint::EnableClientState>(arrayPacked);
 
@@ -254,9 +321,15 @@ void GL_APIENTRY Fogf(GLenum pname, GLfloat param)
 {
     EVENT("(GLenum pname = 0x%X, GLfloat param = %f)", pname, param);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, Fogf, pname, param);
+            return;
+        }
+
         context->gatherParams<EntryPoint::Fogf>(pname, param);
 
         if (context->skipValidation() || ValidateFogf(context, pname, param))
@@ -286,9 +359,15 @@ void GL_APIENTRY Fogx(GLenum pname, GLfixed param)
 {
     EVENT("(GLenum pname = 0x%X, GLfixed param = 0x%X)", pname, param);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, Fogx, pname, param);
+            return;
+        }
+
         context->gatherParams<EntryPoint::Fogx>(pname, param);
 
         if (context->skipValidation() || ValidateFogx(context, pname, param))
@@ -321,9 +400,15 @@ void GL_APIENTRY Frustumf(GLfloat l, GLfloat r, GLfloat b, GLfloat t, GLfloat n,
         "f = %f)",
         l, r, b, t, n, f);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, Frustumf, l, r, b, t, n, f);
+            return;
+        }
+
         context->gatherParams<EntryPoint::Frustumf>(l, r, b, t, n, f);
 
         if (context->skipValidation() || ValidateFrustumf(context, l, r, b, t, n, f))
@@ -340,9 +425,15 @@ void GL_APIENTRY Frustumx(GLfixed l, GLfixed r, GLfixed b, GLfixed t, GLfixed n,
         "0x%X, GLfixed f = 0x%X)",
         l, r, b, t, n, f);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, Frustumx, l, r, b, t, n, f);
+            return;
+        }
+
         context->gatherParams<EntryPoint::Frustumx>(l, r, b, t, n, f);
 
         if (context->skipValidation() || ValidateFrustumx(context, l, r, b, t, n, f))
@@ -558,9 +649,15 @@ void GL_APIENTRY LightModelf(GLenum pname, GLfloat param)
 {
     EVENT("(GLenum pname = 0x%X, GLfloat param = %f)", pname, param);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, LightModelf, pname, param);
+            return;
+        }
+
         context->gatherParams<EntryPoint::LightModelf>(pname, param);
 
         if (context->skipValidation() || ValidateLightModelf(context, pname, param))
@@ -590,9 +687,15 @@ void GL_APIENTRY LightModelx(GLenum pname, GLfixed param)
 {
     EVENT("(GLenum pname = 0x%X, GLfixed param = 0x%X)", pname, param);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, LightModelx, pname, param);
+            return;
+        }
+
         context->gatherParams<EntryPoint::LightModelx>(pname, param);
 
         if (context->skipValidation() || ValidateLightModelx(context, pname, param))
@@ -622,9 +725,15 @@ void GL_APIENTRY Lightf(GLenum light, GLenum pname, GLfloat param)
 {
     EVENT("(GLenum light = 0x%X, GLenum pname = 0x%X, GLfloat param = %f)", light, pname, param);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, Lightf, light, pname, param);
+            return;
+        }
+
         context->gatherParams<EntryPoint::Lightf>(light, pname, param);
 
         if (context->skipValidation() || ValidateLightf(context, light, pname, param))
@@ -655,9 +764,15 @@ void GL_APIENTRY Lightx(GLenum light, GLenum pname, GLfixed param)
 {
     EVENT("(GLenum light = 0x%X, GLenum pname = 0x%X, GLfixed param = 0x%X)", light, pname, param);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, Lightx, light, pname, param);
+            return;
+        }
+
         context->gatherParams<EntryPoint::Lightx>(light, pname, param);
 
         if (context->skipValidation() || ValidateLightx(context, light, pname, param))
@@ -688,9 +803,15 @@ void GL_APIENTRY LineWidthx(GLfixed width)
 {
     EVENT("(GLfixed width = 0x%X)", width);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, LineWidthx, width);
+            return;
+        }
+
         context->gatherParams<EntryPoint::LineWidthx>(width);
 
         if (context->skipValidation() || ValidateLineWidthx(context, width))
@@ -704,9 +825,15 @@ void GL_APIENTRY LoadIdentity()
 {
     EVENT("()");
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, LoadIdentity);
+            return;
+        }
+
         context->gatherParams<EntryPoint::LoadIdentity>();
 
         if (context->skipValidation() || ValidateLoadIdentity(context))
@@ -752,9 +879,15 @@ void GL_APIENTRY LogicOp(GLenum opcode)
 {
     EVENT("(GLenum opcode = 0x%X)", opcode);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, LogicOp, opcode);
+            return;
+        }
+
         context->gatherParams<EntryPoint::LogicOp>(opcode);
 
         if (context->skipValidation() || ValidateLogicOp(context, opcode))
@@ -768,9 +901,15 @@ void GL_APIENTRY Materialf(GLenum face, GLenum pname, GLfloat param)
 {
     EVENT("(GLenum face = 0x%X, GLenum pname = 0x%X, GLfloat param = %f)", face, pname, param);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, Materialf, face, pname, param);
+            return;
+        }
+
         context->gatherParams<EntryPoint::Materialf>(face, pname, param);
 
         if (context->skipValidation() || ValidateMaterialf(context, face, pname, param))
@@ -801,9 +940,15 @@ void GL_APIENTRY Materialx(GLenum face, GLenum pname, GLfixed param)
 {
     EVENT("(GLenum face = 0x%X, GLenum pname = 0x%X, GLfixed param = 0x%X)", face, pname, param);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, Materialx, face, pname, param);
+            return;
+        }
+
         context->gatherParams<EntryPoint::Materialx>(face, pname, param);
 
         if (context->skipValidation() || ValidateMaterialx(context, face, pname, param))
@@ -834,9 +979,15 @@ void GL_APIENTRY MatrixMode(GLenum mode)
 {
     EVENT("(GLenum mode = 0x%X)", mode);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, MatrixMode, mode);
+            return;
+        }
+
         MatrixType modePacked = FromGLenum<MatrixType>(mode);
         context->gatherParams<EntryPoint::MatrixMode>(modePacked);
 
@@ -884,9 +1035,15 @@ void GL_APIENTRY MultiTexCoord4f(GLenum target, GLfloat s, GLfloat t, GLfloat r,
     EVENT("(GLenum target = 0x%X, GLfloat s = %f, GLfloat t = %f, GLfloat r = %f, GLfloat q = %f)",
           target, s, t, r, q);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, MultiTexCoord4f, target, s, t, r, q);
+            return;
+        }
+
         context->gatherParams<EntryPoint::MultiTexCoord4f>(target, s, t, r, q);
 
         if (context->skipValidation() || ValidateMultiTexCoord4f(context, target, s, t, r, q))
@@ -903,9 +1060,15 @@ void GL_APIENTRY MultiTexCoord4x(GLenum texture, GLfixed s, GLfixed t, GLfixed r
         "0x%X)",
         texture, s, t, r, q);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, MultiTexCoord4x, texture, s, t, r, q);
+            return;
+        }
+
         context->gatherParams<EntryPoint::MultiTexCoord4x>(texture, s, t, r, q);
 
         if (context->skipValidation() || ValidateMultiTexCoord4x(context, texture, s, t, r, q))
@@ -919,9 +1082,15 @@ void GL_APIENTRY Normal3f(GLfloat nx, GLfloat ny, GLfloat nz)
 {
     EVENT("(GLfloat nx = %f, GLfloat ny = %f, GLfloat nz = %f)", nx, ny, nz);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, Normal3f, nx, ny, nz);
+            return;
+        }
+
         context->gatherParams<EntryPoint::Normal3f>(nx, ny, nz);
 
         if (context->skipValidation() || ValidateNormal3f(context, nx, ny, nz))
@@ -935,9 +1104,15 @@ void GL_APIENTRY Normal3x(GLfixed nx, GLfixed ny, GLfixed nz)
 {
     EVENT("(GLfixed nx = 0x%X, GLfixed ny = 0x%X, GLfixed nz = 0x%X)", nx, ny, nz);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, Normal3x, nx, ny, nz);
+            return;
+        }
+
         context->gatherParams<EntryPoint::Normal3x>(nx, ny, nz);
 
         if (context->skipValidation() || ValidateNormal3x(context, nx, ny, nz))
@@ -971,9 +1146,15 @@ void GL_APIENTRY Orthof(GLfloat l, GLfloat r, GLfloat b, GLfloat t, GLfloat n, G
         "f = %f)",
         l, r, b, t, n, f);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, Orthof, l, r, b, t, n, f);
+            return;
+        }
+
         context->gatherParams<EntryPoint::Orthof>(l, r, b, t, n, f);
 
         if (context->skipValidation() || ValidateOrthof(context, l, r, b, t, n, f))
@@ -990,9 +1171,15 @@ void GL_APIENTRY Orthox(GLfixed l, GLfixed r, GLfixed b, GLfixed t, GLfixed n, G
         "0x%X, GLfixed f = 0x%X)",
         l, r, b, t, n, f);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, Orthox, l, r, b, t, n, f);
+            return;
+        }
+
         context->gatherParams<EntryPoint::Orthox>(l, r, b, t, n, f);
 
         if (context->skipValidation() || ValidateOrthox(context, l, r, b, t, n, f))
@@ -1006,9 +1193,15 @@ void GL_APIENTRY PointParameterf(GLenum pname, GLfloat param)
 {
     EVENT("(GLenum pname = 0x%X, GLfloat param = %f)", pname, param);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, PointParameterf, pname, param);
+            return;
+        }
+
         context->gatherParams<EntryPoint::PointParameterf>(pname, param);
 
         if (context->skipValidation() || ValidatePointParameterf(context, pname, param))
@@ -1038,9 +1231,15 @@ void GL_APIENTRY PointParameterx(GLenum pname, GLfixed param)
 {
     EVENT("(GLenum pname = 0x%X, GLfixed param = 0x%X)", pname, param);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, PointParameterx, pname, param);
+            return;
+        }
+
         context->gatherParams<EntryPoint::PointParameterx>(pname, param);
 
         if (context->skipValidation() || ValidatePointParameterx(context, pname, param))
@@ -1070,9 +1269,15 @@ void GL_APIENTRY PointSize(GLfloat size)
 {
     EVENT("(GLfloat size = %f)", size);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, PointSize, size);
+            return;
+        }
+
         context->gatherParams<EntryPoint::PointSize>(size);
 
         if (context->skipValidation() || ValidatePointSize(context, size))
@@ -1086,9 +1291,15 @@ void GL_APIENTRY PointSizex(GLfixed size)
 {
     EVENT("(GLfixed size = 0x%X)", size);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, PointSizex, size);
+            return;
+        }
+
         context->gatherParams<EntryPoint::PointSizex>(size);
 
         if (context->skipValidation() || ValidatePointSizex(context, size))
@@ -1102,9 +1313,15 @@ void GL_APIENTRY PolygonOffsetx(GLfixed factor, GLfixed units)
 {
     EVENT("(GLfixed factor = 0x%X, GLfixed units = 0x%X)", factor, units);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, PolygonOffsetx, factor, units);
+            return;
+        }
+
         context->gatherParams<EntryPoint::PolygonOffsetx>(factor, units);
 
         if (context->skipValidation() || ValidatePolygonOffsetx(context, factor, units))
@@ -1118,9 +1335,15 @@ void GL_APIENTRY PopMatrix()
 {
     EVENT("()");
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, PopMatrix);
+            return;
+        }
+
         context->gatherParams<EntryPoint::PopMatrix>();
 
         if (context->skipValidation() || ValidatePopMatrix(context))
@@ -1134,9 +1357,15 @@ void GL_APIENTRY PushMatrix()
 {
     EVENT("()");
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, PushMatrix);
+            return;
+        }
+
         context->gatherParams<EntryPoint::PushMatrix>();
 
         if (context->skipValidation() || ValidatePushMatrix(context))
@@ -1150,9 +1379,15 @@ void GL_APIENTRY Rotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z)
 {
     EVENT("(GLfloat angle = %f, GLfloat x = %f, GLfloat y = %f, GLfloat z = %f)", angle, x, y, z);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, Rotatef, angle, x, y, z);
+            return;
+        }
+
         context->gatherParams<EntryPoint::Rotatef>(angle, x, y, z);
 
         if (context->skipValidation() || ValidateRotatef(context, angle, x, y, z))
@@ -1167,9 +1402,15 @@ void GL_APIENTRY Rotatex(GLfixed angle, GLfixed x, GLfixed y, GLfixed z)
     EVENT("(GLfixed angle = 0x%X, GLfixed x = 0x%X, GLfixed y = 0x%X, GLfixed z = 0x%X)", angle, x,
           y, z);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, Rotatex, angle, x, y, z);
+            return;
+        }
+
         context->gatherParams<EntryPoint::Rotatex>(angle, x, y, z);
 
         if (context->skipValidation() || ValidateRotatex(context, angle, x, y, z))
@@ -1183,9 +1424,15 @@ void GL_APIENTRY SampleCoveragex(GLclampx value, GLboolean invert)
 {
     EVENT("(GLclampx value = 0x%X, GLboolean invert = %u)", value, invert);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, SampleCoveragex, value, invert);
+            return;
+        }
+
         context->gatherParams<EntryPoint::SampleCoveragex>(value, invert);
 
         if (context->skipValidation() || ValidateSampleCoveragex(context, value, invert))
@@ -1199,9 +1446,15 @@ void GL_APIENTRY Scalef(GLfloat x, GLfloat y, GLfloat z)
 {
     EVENT("(GLfloat x = %f, GLfloat y = %f, GLfloat z = %f)", x, y, z);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, Scalef, x, y, z);
+            return;
+        }
+
         context->gatherParams<EntryPoint::Scalef>(x, y, z);
 
         if (context->skipValidation() || ValidateScalef(context, x, y, z))
@@ -1215,9 +1468,15 @@ void GL_APIENTRY Scalex(GLfixed x, GLfixed y, GLfixed z)
 {
     EVENT("(GLfixed x = 0x%X, GLfixed y = 0x%X, GLfixed z = 0x%X)", x, y, z);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, Scalex, x, y, z);
+            return;
+        }
+
         context->gatherParams<EntryPoint::Scalex>(x, y, z);
 
         if (context->skipValidation() || ValidateScalex(context, x, y, z))
@@ -1231,9 +1490,15 @@ void GL_APIENTRY ShadeModel(GLenum mode)
 {
     EVENT("(GLenum mode = 0x%X)", mode);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, ShadeModel, mode);
+            return;
+        }
+
         context->gatherParams<EntryPoint::ShadeModel>(mode);
 
         if (context->skipValidation() || ValidateShadeModel(context, mode))
@@ -1266,9 +1531,15 @@ void GL_APIENTRY TexEnvf(GLenum target, GLenum pname, GLfloat param)
 {
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, GLfloat param = %f)", target, pname, param);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, TexEnvf, target, pname, param);
+            return;
+        }
+
         context->gatherParams<EntryPoint::TexEnvf>(target, pname, param);
 
         if (context->skipValidation() || ValidateTexEnvf(context, target, pname, param))
@@ -1299,9 +1570,15 @@ void GL_APIENTRY TexEnvi(GLenum target, GLenum pname, GLint param)
 {
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, GLint param = %d)", target, pname, param);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, TexEnvi, target, pname, param);
+            return;
+        }
+
         context->gatherParams<EntryPoint::TexEnvi>(target, pname, param);
 
         if (context->skipValidation() || ValidateTexEnvi(context, target, pname, param))
@@ -1333,9 +1610,15 @@ void GL_APIENTRY TexEnvx(GLenum target, GLenum pname, GLfixed param)
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, GLfixed param = 0x%X)", target, pname,
           param);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, TexEnvx, target, pname, param);
+            return;
+        }
+
         context->gatherParams<EntryPoint::TexEnvx>(target, pname, param);
 
         if (context->skipValidation() || ValidateTexEnvx(context, target, pname, param))
@@ -1367,9 +1650,15 @@ void GL_APIENTRY TexParameterx(GLenum target, GLenum pname, GLfixed param)
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, GLfixed param = 0x%X)", target, pname,
           param);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, TexParameterx, target, pname, param);
+            return;
+        }
+
         TextureType targetPacked = FromGLenum<TextureType>(target);
         context->gatherParams<EntryPoint::TexParameterx>(targetPacked, pname, param);
 
@@ -1403,9 +1692,15 @@ void GL_APIENTRY Translatef(GLfloat x, GLfloat y, GLfloat z)
 {
     EVENT("(GLfloat x = %f, GLfloat y = %f, GLfloat z = %f)", x, y, z);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, Translatef, x, y, z);
+            return;
+        }
+
         context->gatherParams<EntryPoint::Translatef>(x, y, z);
 
         if (context->skipValidation() || ValidateTranslatef(context, x, y, z))
@@ -1419,9 +1714,15 @@ void GL_APIENTRY Translatex(GLfixed x, GLfixed y, GLfixed z)
 {
     EVENT("(GLfixed x = 0x%X, GLfixed y = 0x%X, GLfixed z = 0x%X)", x, y, z);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, Translatex, x, y, z);
+            return;
+        }
+
         context->gatherParams<EntryPoint::Translatex>(x, y, z);
 
         if (context->skipValidation() || ValidateTranslatex(context, x, y, z))
@@ -12,6 +12,7 @@
 
 #include "libANGLE/Context.h"
 #include "libANGLE/validationES2.h"
+#include "libGLESv2/entry_points_deferred.h"
 #include "libGLESv2/global_state.h"
 
 namespace gl
@@ -20,9 +21,15 @@ void GL_APIENTRY ActiveTexture(GLenum texture)
 {
     EVENT("(GLenum texture = 0x%X)", texture);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, ActiveTexture, texture);
+            return;
+        }
+
         context->gatherParams<EntryPoint::ActiveTexture>(texture);
 
         if (context->skipValidation() || ValidateActiveTexture(context, texture))
@@ -36,9 +43,15 @@ void GL_APIENTRY AttachShader(GLuint program, GLuint shader)
 {
     EVENT("(GLuint program = %u, GLuint shader = %u)", program, shader);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, AttachShader, program, shader);
+            return;
+        }
+
         context->gatherParams<EntryPoint::AttachShader>(program, shader);
 
         if (context->skipValidation() || ValidateAttachShader(context, program, shader))
@@ -69,9 +82,15 @@ void GL_APIENTRY BindBuffer(GLenum target, GLuint buffer)
 {
     EVENT("(GLenum target = 0x%X, GLuint buffer = %u)", target, buffer);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, BindBuffer, target, buffer);
+            return;
+        }
+
         BufferBinding targetPacked = FromGLenum<BufferBinding>(target);
         context->gatherParams<EntryPoint::BindBuffer>(targetPacked, buffer);
 
@@ -86,9 +105,15 @@ void GL_APIENTRY BindFramebuffer(GLenum target, GLuint framebuffer)
 {
     EVENT("(GLenum target = 0x%X, GLuint framebuffer = %u)", target, framebuffer);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, BindFramebuffer, target, framebuffer);
+            return;
+        }
+
         context->gatherParams<EntryPoint::BindFramebuffer>(target, framebuffer);
 
         if (context->skipValidation() || ValidateBindFramebuffer(context, target, framebuffer))
@@ -102,9 +127,15 @@ void GL_APIENTRY BindRenderbuffer(GLenum target, GLuint renderbuffer)
 {
     EVENT("(GLenum target = 0x%X, GLuint renderbuffer = %u)", target, renderbuffer);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, BindRenderbuffer, target, renderbuffer);
+            return;
+        }
+
         context->gatherParams<EntryPoint::BindRenderbuffer>(target, renderbuffer);
 
         if (context->skipValidation() || ValidateBindRenderbuffer(context, target, renderbuffer))
@@ -118,9 +149,15 @@ void GL_APIENTRY BindTexture(GLenum target, GLuint texture)
 {
     EVENT("(GLenum target = 0x%X, GLuint texture = %u)", target, texture);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, BindTexture, target, texture);
+            return;
+        }
+
         TextureType targetPacked = FromGLenum<TextureType>(target);
         context->gatherParams<EntryPoint::BindTexture>(targetPacked, texture);
 
@@ -136,9 +173,15 @@ void GL_APIENTRY BlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat al
     EVENT("(GLfloat red = %f, GLfloat green = %f, GLfloat blue = %f, GLfloat alpha = %f)", red,
           green, blue, alpha);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, BlendColor, red, green, blue, alpha);
+            return;
+        }
+
         context->gatherParams<EntryPoint::BlendColor>(red, green, blue, alpha);
 
         if (context->skipValidation() || ValidateBlendColor(context, red, green, blue, alpha))
@@ -152,9 +195,15 @@ void GL_APIENTRY BlendEquation(GLenum mode)
 {
     EVENT("(GLenum mode = 0x%X)", mode);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, BlendEquation, mode);
+            return;
+        }
+
         context->gatherParams<EntryPoint::BlendEquation>(mode);
 
         if (context->skipValidation() || ValidateBlendEquation(context, mode))
@@ -168,9 +217,15 @@ void GL_APIENTRY BlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha)
 {
     EVENT("(GLenum modeRGB = 0x%X, GLenum modeAlpha = 0x%X)", modeRGB, modeAlpha);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, BlendEquationSeparate, modeRGB, modeAlpha);
+            return;
+        }
+
         context->gatherParams<EntryPoint::BlendEquationSeparate>(modeRGB, modeAlpha);
 
         if (context->skipValidation() || ValidateBlendEquationSeparate(context, modeRGB, modeAlpha))
@@ -184,9 +239,15 @@ void GL_APIENTRY BlendFunc(GLenum sfactor, GLenum dfactor)
 {
     EVENT("(GLenum sfactor = 0x%X, GLenum dfactor = 0x%X)", sfactor, dfactor);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, BlendFunc, sfactor, dfactor);
+            return;
+        }
+
         context->gatherParams<EntryPoint::BlendFunc>(sfactor, dfactor);
 
         if (context->skipValidation() || ValidateBlendFunc(context, sfactor, dfactor))
@@ -206,9 +267,16 @@ void GL_APIENTRY BlendFuncSeparate(GLenum sfactorRGB,
         "dfactorAlpha = 0x%X)",
         sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(
+                context, BlendFuncSeparate, sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+            return;
+        }
+
         context->gatherParams<EntryPoint::BlendFuncSeparate>(sfactorRGB, dfactorRGB, sfactorAlpha,
                                                              dfactorAlpha);
 
@@ -285,9 +353,15 @@ void GL_APIENTRY Clear(GLbitfield mask)
 {
     EVENT("(GLbitfield mask = 0x%X)", mask);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, Clear, mask);
+            return;
+        }
+
         context->gatherParams<EntryPoint::Clear>(mask);
 
         if (context->skipValidation() || ValidateClear(context, mask))
@@ -302,9 +376,15 @@ void GL_APIENTRY ClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat al
     EVENT("(GLfloat red = %f, GLfloat green = %f, GLfloat blue = %f, GLfloat alpha = %f)", red,
           green, blue, alpha);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, ClearColor, red, green, blue, alpha);
+            return;
+        }
+
         context->gatherParams<EntryPoint::ClearColor>(red, green, blue, alpha);
 
         if (context->skipValidation() || ValidateClearColor(context, red, green, blue, alpha))
@@ -318,9 +398,15 @@ void GL_APIENTRY ClearDepthf(GLfloat d)
 {
     EVENT("(GLfloat d = %f)", d);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, ClearDepthf, d);
+            return;
+        }
+
         context->gatherParams<EntryPoint::ClearDepthf>(d);
 
         if (context->skipValidation() || ValidateClearDepthf(context, d))
@@ -334,9 +420,15 @@ void GL_APIENTRY ClearStencil(GLint s)
 {
     EVENT("(GLint s = %d)", s);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, ClearStencil, s);
+            return;
+        }
+
         context->gatherParams<EntryPoint::ClearStencil>(s);
 
         if (context->skipValidation() || ValidateClearStencil(context, s))
@@ -351,9 +443,15 @@ void GL_APIENTRY ColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboo
     EVENT("(GLboolean red = %u, GLboolean green = %u, GLboolean blue = %u, GLboolean alpha = %u)",
           red, green, blue, alpha);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, ColorMask, red, green, blue, alpha);
+            return;
+        }
+
         context->gatherParams<EntryPoint::ColorMask>(red, green, blue, alpha);
 
         if (context->skipValidation() || ValidateColorMask(context, red, green, blue, alpha))
@@ -367,9 +465,15 @@ void GL_APIENTRY CompileShader(GLuint shader)
 {
     EVENT("(GLuint shader = %u)", shader);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, CompileShader, shader);
+            return;
+        }
+
         context->gatherParams<EntryPoint::CompileShader>(shader);
 
         if (context->skipValidation() || ValidateCompileShader(context, shader))
@@ -458,9 +562,16 @@ void GL_APIENTRY CopyTexImage2D(GLenum target,
         "GLint y = %d, GLsizei width = %d, GLsizei height = %d, GLint border = %d)",
         target, level, internalformat, x, y, width, height, border);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, CopyTexImage2D, target, level, internalformat, x, y, width,
+                            height, border);
+            return;
+        }
+
         TextureTarget targetPacked = FromGLenum<TextureTarget>(target);
         context->gatherParams<EntryPoint::CopyTexImage2D>(targetPacked, level, internalformat, x, y,
                                                           width, height, border);
@@ -489,9 +600,16 @@ void GL_APIENTRY CopyTexSubImage2D(GLenum target,
         "= %d, GLint y = %d, GLsizei width = %d, GLsizei height = %d)",
         target, level, xoffset, yoffset, x, y, width, height);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(
+                context, CopyTexSubImage2D, target, level, xoffset, yoffset, x, y, width, height);
+            return;
+        }
+
         TextureTarget targetPacked = FromGLenum<TextureTarget>(target);
         context->gatherParams<EntryPoint::CopyTexSubImage2D>(targetPacked, level, xoffset, yoffset,
                                                              x, y, width, height);
@@ -546,9 +664,15 @@ void GL_APIENTRY CullFace(GLenum mode)
 {
     EVENT("(GLenum mode = 0x%X)", mode);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, CullFace, mode);
+            return;
+        }
+
         CullFaceMode modePacked = FromGLenum<CullFaceMode>(mode);
         context->gatherParams<EntryPoint::CullFace>(modePacked);
 
@@ -595,9 +719,15 @@ void GL_APIENTRY DeleteProgram(GLuint program)
 {
     EVENT("(GLuint program = %u)", program);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, DeleteProgram, program);
+            return;
+        }
+
         context->gatherParams<EntryPoint::DeleteProgram>(program);
 
         if (context->skipValidation() || ValidateDeleteProgram(context, program))
@@ -627,9 +757,15 @@ void GL_APIENTRY DeleteShader(GLuint shader)
 {
     EVENT("(GLuint shader = %u)", shader);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, DeleteShader, shader);
+            return;
+        }
+
         context->gatherParams<EntryPoint::DeleteShader>(shader);
 
         if (context->skipValidation() || ValidateDeleteShader(context, shader))
@@ -659,9 +795,15 @@ void GL_APIENTRY DepthFunc(GLenum func)
 {
     EVENT("(GLenum func = 0x%X)", func);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, DepthFunc, func);
+            return;
+        }
+
         context->gatherParams<EntryPoint::DepthFunc>(func);
 
         if (context->skipValidation() || ValidateDepthFunc(context, func))
@@ -675,9 +817,15 @@ void GL_APIENTRY DepthMask(GLboolean flag)
 {
     EVENT("(GLboolean flag = %u)", flag);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, DepthMask, flag);
+            return;
+        }
+
         context->gatherParams<EntryPoint::DepthMask>(flag);
 
         if (context->skipValidation() || ValidateDepthMask(context, flag))
@@ -691,9 +839,15 @@ void GL_APIENTRY DepthRangef(GLfloat n, GLfloat f)
 {
     EVENT("(GLfloat n = %f, GLfloat f = %f)", n, f);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, DepthRangef, n, f);
+            return;
+        }
+
         context->gatherParams<EntryPoint::DepthRangef>(n, f);
 
         if (context->skipValidation() || ValidateDepthRangef(context, n, f))
@@ -707,9 +861,15 @@ void GL_APIENTRY DetachShader(GLuint program, GLuint shader)
 {
     EVENT("(GLuint program = %u, GLuint shader = %u)", program, shader);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, DetachShader, program, shader);
+            return;
+        }
+
         context->gatherParams<EntryPoint::DetachShader>(program, shader);
 
         if (context->skipValidation() || ValidateDetachShader(context, program, shader))
@@ -723,9 +883,15 @@ void GL_APIENTRY Disable(GLenum cap)
 {
     EVENT("(GLenum cap = 0x%X)", cap);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, Disable, cap);
+            return;
+        }
+
         context->gatherParams<EntryPoint::Disable>(cap);
 
         if (context->skipValidation() || ValidateDisable(context, cap))
@@ -739,9 +905,15 @@ void GL_APIENTRY DisableVertexAttribArray(GLuint index)
 {
     EVENT("(GLuint index = %u)", index);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, DisableVertexAttribArray, index);
+            return;
+        }
+
         context->gatherParams<EntryPoint::DisableVertexAttribArray>(index);
 
         if (context->skipValidation() || ValidateDisableVertexAttribArray(context, index))
@@ -755,9 +927,15 @@ void GL_APIENTRY DrawArrays(GLenum mode, GLint first, GLsizei count)
 {
     EVENT("(GLenum mode = 0x%X, GLint first = %d, GLsizei count = %d)", mode, first, count);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, DrawArrays, mode, first, count);
+            return;
+        }
+
         context->gatherParams<EntryPoint::DrawArrays>(mode, first, count);
 
         if (context->skipValidation() || ValidateDrawArrays(context, mode, first, count))
@@ -790,9 +968,15 @@ void GL_APIENTRY Enable(GLenum cap)
 {
     EVENT("(GLenum cap = 0x%X)", cap);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, Enable, cap);
+            return;
+        }
+
         context->gatherParams<EntryPoint::Enable>(cap);
 
         if (context->skipValidation() || ValidateEnable(context, cap))
@@ -806,9 +990,15 @@ void GL_APIENTRY EnableVertexAttribArray(GLuint index)
 {
     EVENT("(GLuint index = %u)", index);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, EnableVertexAttribArray, index);
+            return;
+        }
+
         context->gatherParams<EntryPoint::EnableVertexAttribArray>(index);
 
         if (context->skipValidation() || ValidateEnableVertexAttribArray(context, index))
@@ -838,9 +1028,15 @@ void GL_APIENTRY Flush()
 {
     EVENT("()");
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, Flush);
+            return;
+        }
+
         context->gatherParams<EntryPoint::Flush>();
 
         if (context->skipValidation() || ValidateFlush(context))
@@ -860,9 +1056,16 @@ void GL_APIENTRY FramebufferRenderbuffer(GLenum target,
         "renderbuffer = %u)",
         target, attachment, renderbuffertarget, renderbuffer);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, FramebufferRenderbuffer, target, attachment,
+                            renderbuffertarget, renderbuffer);
+            return;
+        }
+
         context->gatherParams<EntryPoint::FramebufferRenderbuffer>(
             target, attachment, renderbuffertarget, renderbuffer);
 
@@ -886,9 +1089,16 @@ void GL_APIENTRY FramebufferTexture2D(GLenum target,
         "= %u, GLint level = %d)",
         target, attachment, textarget, texture, level);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(
+                context, FramebufferTexture2D, target, attachment, textarget, texture, level);
+            return;
+        }
+
         TextureTarget textargetPacked = FromGLenum<TextureTarget>(textarget);
         context->gatherParams<EntryPoint::FramebufferTexture2D>(target, attachment, textargetPacked,
                                                                 texture, level);
@@ -906,9 +1116,15 @@ void GL_APIENTRY FrontFace(GLenum mode)
 {
     EVENT("(GLenum mode = 0x%X)", mode);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, FrontFace, mode);
+            return;
+        }
+
         context->gatherParams<EntryPoint::FrontFace>(mode);
 
         if (context->skipValidation() || ValidateFrontFace(context, mode))
@@ -986,9 +1202,15 @@ void GL_APIENTRY GenerateMipmap(GLenum target)
 {
     EVENT("(GLenum target = 0x%X)", target);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, GenerateMipmap, target);
+            return;
+        }
+
         TextureType targetPacked = FromGLenum<TextureType>(target);
         context->gatherParams<EntryPoint::GenerateMipmap>(targetPacked);
 
@@ -1506,9 +1728,15 @@ void GL_APIENTRY Hint(GLenum target, GLenum mode)
 {
     EVENT("(GLenum target = 0x%X, GLenum mode = 0x%X)", target, mode);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, Hint, target, mode);
+            return;
+        }
+
         context->gatherParams<EntryPoint::Hint>(target, mode);
 
         if (context->skipValidation() || ValidateHint(context, target, mode))
@@ -1648,9 +1876,15 @@ void GL_APIENTRY LineWidth(GLfloat width)
 {
     EVENT("(GLfloat width = %f)", width);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, LineWidth, width);
+            return;
+        }
+
         context->gatherParams<EntryPoint::LineWidth>(width);
 
         if (context->skipValidation() || ValidateLineWidth(context, width))
@@ -1664,9 +1898,15 @@ void GL_APIENTRY LinkProgram(GLuint program)
 {
     EVENT("(GLuint program = %u)", program);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, LinkProgram, program);
+            return;
+        }
+
         context->gatherParams<EntryPoint::LinkProgram>(program);
 
         if (context->skipValidation() || ValidateLinkProgram(context, program))
@@ -1680,9 +1920,15 @@ void GL_APIENTRY PixelStorei(GLenum pname, GLint param)
 {
     EVENT("(GLenum pname = 0x%X, GLint param = %d)", pname, param);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, PixelStorei, pname, param);
+            return;
+        }
+
         context->gatherParams<EntryPoint::PixelStorei>(pname, param);
 
         if (context->skipValidation() || ValidatePixelStorei(context, pname, param))
@@ -1696,9 +1942,15 @@ void GL_APIENTRY PolygonOffset(GLfloat factor, GLfloat units)
 {
     EVENT("(GLfloat factor = %f, GLfloat units = %f)", factor, units);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, PolygonOffset, factor, units);
+            return;
+        }
+
         context->gatherParams<EntryPoint::PolygonOffset>(factor, units);
 
         if (context->skipValidation() || ValidatePolygonOffset(context, factor, units))
@@ -1738,9 +1990,15 @@ void GL_APIENTRY ReleaseShaderCompiler()
 {
     EVENT("()");
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, ReleaseShaderCompiler);
+            return;
+        }
+
         context->gatherParams<EntryPoint::ReleaseShaderCompiler>();
 
         if (context->skipValidation() || ValidateReleaseShaderCompiler(context))
@@ -1760,9 +2018,15 @@ void GL_APIENTRY RenderbufferStorage(GLenum target,
         "%d)",
         target, internalformat, width, height);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, RenderbufferStorage, target, internalformat, width, height);
+            return;
+        }
+
         context->gatherParams<EntryPoint::RenderbufferStorage>(target, internalformat, width,
                                                                height);
 
@@ -1778,9 +2042,15 @@ void GL_APIENTRY SampleCoverage(GLfloat value, GLboolean invert)
 {
     EVENT("(GLfloat value = %f, GLboolean invert = %u)", value, invert);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, SampleCoverage, value, invert);
+            return;
+        }
+
         context->gatherParams<EntryPoint::SampleCoverage>(value, invert);
 
         if (context->skipValidation() || ValidateSampleCoverage(context, value, invert))
@@ -1795,9 +2065,15 @@ void GL_APIENTRY Scissor(GLint x, GLint y, GLsizei width, GLsizei height)
     EVENT("(GLint x = %d, GLint y = %d, GLsizei width = %d, GLsizei height = %d)", x, y, width,
           height);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, Scissor, x, y, width, height);
+            return;
+        }
+
         context->gatherParams<EntryPoint::Scissor>(x, y, width, height);
 
         if (context->skipValidation() || ValidateScissor(context, x, y, width, height))
@@ -1859,9 +2135,15 @@ void GL_APIENTRY StencilFunc(GLenum func, GLint ref, GLuint mask)
 {
     EVENT("(GLenum func = 0x%X, GLint ref = %d, GLuint mask = %u)", func, ref, mask);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, StencilFunc, func, ref, mask);
+            return;
+        }
+
         context->gatherParams<EntryPoint::StencilFunc>(func, ref, mask);
 
         if (context->skipValidation() || ValidateStencilFunc(context, func, ref, mask))
@@ -1876,9 +2158,15 @@ void GL_APIENTRY StencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint
     EVENT("(GLenum face = 0x%X, GLenum func = 0x%X, GLint ref = %d, GLuint mask = %u)", face, func,
           ref, mask);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, StencilFuncSeparate, face, func, ref, mask);
+            return;
+        }
+
         context->gatherParams<EntryPoint::StencilFuncSeparate>(face, func, ref, mask);
 
         if (context->skipValidation() ||
@@ -1893,9 +2181,15 @@ void GL_APIENTRY StencilMask(GLuint mask)
 {
     EVENT("(GLuint mask = %u)", mask);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, StencilMask, mask);
+            return;
+        }
+
         context->gatherParams<EntryPoint::StencilMask>(mask);
 
         if (context->skipValidation() || ValidateStencilMask(context, mask))
@@ -1909,9 +2203,15 @@ void GL_APIENTRY StencilMaskSeparate(GLenum face, GLuint mask)
 {
     EVENT("(GLenum face = 0x%X, GLuint mask = %u)", face, mask);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, StencilMaskSeparate, face, mask);
+            return;
+        }
+
         context->gatherParams<EntryPoint::StencilMaskSeparate>(face, mask);
 
         if (context->skipValidation() || ValidateStencilMaskSeparate(context, face, mask))
@@ -1925,9 +2225,15 @@ void GL_APIENTRY StencilOp(GLenum fail, GLenum zfail, GLenum zpass)
 {
     EVENT("(GLenum fail = 0x%X, GLenum zfail = 0x%X, GLenum zpass = 0x%X)", fail, zfail, zpass);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, StencilOp, fail, zfail, zpass);
+            return;
+        }
+
         context->gatherParams<EntryPoint::StencilOp>(fail, zfail, zpass);
 
         if (context->skipValidation() || ValidateStencilOp(context, fail, zfail, zpass))
@@ -1942,9 +2248,15 @@ void GL_APIENTRY StencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLe
     EVENT("(GLenum face = 0x%X, GLenum sfail = 0x%X, GLenum dpfail = 0x%X, GLenum dppass = 0x%X)",
           face, sfail, dpfail, dppass);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, StencilOpSeparate, face, sfail, dpfail, dppass);
+            return;
+        }
+
         context->gatherParams<EntryPoint::StencilOpSeparate>(face, sfail, dpfail, dppass);
 
         if (context->skipValidation() ||
@@ -1992,9 +2304,15 @@ void GL_APIENTRY TexParameterf(GLenum target, GLenum pname, GLfloat param)
 {
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, GLfloat param = %f)", target, pname, param);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, TexParameterf, target, pname, param);
+            return;
+        }
+
         TextureType targetPacked = FromGLenum<TextureType>(target);
         context->gatherParams<EntryPoint::TexParameterf>(targetPacked, pname, param);
 
@@ -2028,9 +2346,15 @@ void GL_APIENTRY TexParameteri(GLenum target, GLenum pname, GLint param)
 {
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, GLint param = %d)", target, pname, param);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, TexParameteri, target, pname, param);
+            return;
+        }
+
         TextureType targetPacked = FromGLenum<TextureType>(target);
         context->gatherParams<EntryPoint::TexParameteri>(targetPacked, pname, param);
 
@@ -2097,9 +2421,15 @@ void GL_APIENTRY Uniform1f(GLint location, GLfloat v0)
 {
     EVENT("(GLint location = %d, GLfloat v0 = %f)", location, v0);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, Uniform1f, location, v0);
+            return;
+        }
+
         context->gatherParams<EntryPoint::Uniform1f>(location, v0);
 
         if (context->skipValidation() || ValidateUniform1f(context, location, v0))
@@ -2130,9 +2460,15 @@ void GL_APIENTRY Uniform1i(GLint location, GLint v0)
 {
     EVENT("(GLint location = %d, GLint v0 = %d)", location, v0);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, Uniform1i, location, v0);
+            return;
+        }
+
         context->gatherParams<EntryPoint::Uniform1i>(location, v0);
 
         if (context->skipValidation() || ValidateUniform1i(context, location, v0))
@@ -2163,9 +2499,15 @@ void GL_APIENTRY Uniform2f(GLint location, GLfloat v0, GLfloat v1)
 {
     EVENT("(GLint location = %d, GLfloat v0 = %f, GLfloat v1 = %f)", location, v0, v1);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, Uniform2f, location, v0, v1);
+            return;
+        }
+
         context->gatherParams<EntryPoint::Uniform2f>(location, v0, v1);
 
         if (context->skipValidation() || ValidateUniform2f(context, location, v0, v1))
@@ -2196,9 +2538,15 @@ void GL_APIENTRY Uniform2i(GLint location, GLint v0, GLint v1)
 {
     EVENT("(GLint location = %d, GLint v0 = %d, GLint v1 = %d)", location, v0, v1);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, Uniform2i, location, v0, v1);
+            return;
+        }
+
         context->gatherParams<EntryPoint::Uniform2i>(location, v0, v1);
 
         if (context->skipValidation() || ValidateUniform2i(context, location, v0, v1))
@@ -2230,9 +2578,15 @@ void GL_APIENTRY Uniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
     EVENT("(GLint location = %d, GLfloat v0 = %f, GLfloat v1 = %f, GLfloat v2 = %f)", location, v0,
           v1, v2);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, Uniform3f, location, v0, v1, v2);
+            return;
+        }
+
         context->gatherParams<EntryPoint::Uniform3f>(location, v0, v1, v2);
 
         if (context->skipValidation() || ValidateUniform3f(context, location, v0, v1, v2))
@@ -2264,9 +2618,15 @@ void GL_APIENTRY Uniform3i(GLint location, GLint v0, GLint v1, GLint v2)
     EVENT("(GLint location = %d, GLint v0 = %d, GLint v1 = %d, GLint v2 = %d)", location, v0, v1,
           v2);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, Uniform3i, location, v0, v1, v2);
+            return;
+        }
+
         context->gatherParams<EntryPoint::Uniform3i>(location, v0, v1, v2);
 
         if (context->skipValidation() || ValidateUniform3i(context, location, v0, v1, v2))
@@ -2299,9 +2659,15 @@ void GL_APIENTRY Uniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, G
         "(GLint location = %d, GLfloat v0 = %f, GLfloat v1 = %f, GLfloat v2 = %f, GLfloat v3 = %f)",
         location, v0, v1, v2, v3);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, Uniform4f, location, v0, v1, v2, v3);
+            return;
+        }
+
         context->gatherParams<EntryPoint::Uniform4f>(location, v0, v1, v2, v3);
 
         if (context->skipValidation() || ValidateUniform4f(context, location, v0, v1, v2, v3))
@@ -2333,9 +2699,15 @@ void GL_APIENTRY Uniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v
     EVENT("(GLint location = %d, GLint v0 = %d, GLint v1 = %d, GLint v2 = %d, GLint v3 = %d)",
           location, v0, v1, v2, v3);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, Uniform4i, location, v0, v1, v2, v3);
+            return;
+        }
+
         context->gatherParams<EntryPoint::Uniform4i>(location, v0, v1, v2, v3);
 
         if (context->skipValidation() || ValidateUniform4i(context, location, v0, v1, v2, v3))
@@ -2435,9 +2807,15 @@ void GL_APIENTRY UseProgram(GLuint program)
 {
     EVENT("(GLuint program = %u)", program);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, UseProgram, program);
+            return;
+        }
+
         context->gatherParams<EntryPoint::UseProgram>(program);
 
         if (context->skipValidation() || ValidateUseProgram(context, program))
@@ -2451,9 +2829,15 @@ void GL_APIENTRY ValidateProgram(GLuint program)
 {
     EVENT("(GLuint program = %u)", program);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, ValidateProgram, program);
+            return;
+        }
+
         context->gatherParams<EntryPoint::ValidateProgram>(program);
 
         if (context->skipValidation() || ValidateValidateProgram(context, program))
@@ -2467,9 +2851,15 @@ void GL_APIENTRY VertexAttrib1f(GLuint index, GLfloat x)
 {
     EVENT("(GLuint index = %u, GLfloat x = %f)", index, x);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, VertexAttrib1f, index, x);
+            return;
+        }
+
         context->gatherParams<EntryPoint::VertexAttrib1f>(index, x);
 
         if (context->skipValidation() || ValidateVertexAttrib1f(context, index, x))
@@ -2499,9 +2889,15 @@ void GL_APIENTRY VertexAttrib2f(GLuint index, GLfloat x, GLfloat y)
 {
     EVENT("(GLuint index = %u, GLfloat x = %f, GLfloat y = %f)", index, x, y);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, VertexAttrib2f, index, x, y);
+            return;
+        }
+
         context->gatherParams<EntryPoint::VertexAttrib2f>(index, x, y);
 
         if (context->skipValidation() || ValidateVertexAttrib2f(context, index, x, y))
@@ -2531,9 +2927,15 @@ void GL_APIENTRY VertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z)
 {
     EVENT("(GLuint index = %u, GLfloat x = %f, GLfloat y = %f, GLfloat z = %f)", index, x, y, z);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, VertexAttrib3f, index, x, y, z);
+            return;
+        }
+
         context->gatherParams<EntryPoint::VertexAttrib3f>(index, x, y, z);
 
         if (context->skipValidation() || ValidateVertexAttrib3f(context, index, x, y, z))
@@ -2564,9 +2966,15 @@ void GL_APIENTRY VertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, G
     EVENT("(GLuint index = %u, GLfloat x = %f, GLfloat y = %f, GLfloat z = %f, GLfloat w = %f)",
           index, x, y, z, w);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, VertexAttrib4f, index, x, y, z, w);
+            return;
+        }
+
         context->gatherParams<EntryPoint::VertexAttrib4f>(index, x, y, z, w);
 
         if (context->skipValidation() || ValidateVertexAttrib4f(context, index, x, y, z, w))
@@ -2623,9 +3031,15 @@ void GL_APIENTRY Viewport(GLint x, GLint y, GLsizei width, GLsizei height)
     EVENT("(GLint x = %d, GLint y = %d, GLsizei width = %d, GLsizei height = %d)", x, y, width,
           height);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, Viewport, x, y, width, height);
+            return;
+        }
+
         context->gatherParams<EntryPoint::Viewport>(x, y, width, height);
 
         if (context->skipValidation() || ValidateViewport(context, x, y, width, height))
@@ -12,6 +12,7 @@
 
 #include "libANGLE/Context.h"
 #include "libANGLE/validationES3.h"
+#include "libGLESv2/entry_points_deferred.h"
 #include "libGLESv2/global_state.h"
 
 namespace gl
@@ -20,9 +21,15 @@ void GL_APIENTRY BeginQuery(GLenum target, GLuint id)
 {
     EVENT("(GLenum target = 0x%X, GLuint id = %u)", target, id);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, BeginQuery, target, id);
+            return;
+        }
+
         QueryType targetPacked = FromGLenum<QueryType>(target);
         context->gatherParams<EntryPoint::BeginQuery>(targetPacked, id);
 
@@ -37,9 +44,15 @@ void GL_APIENTRY BeginTransformFeedback(GLenum primitiveMode)
 {
     EVENT("(GLenum primitiveMode = 0x%X)", primitiveMode);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, BeginTransformFeedback, primitiveMode);
+            return;
+        }
+
         context->gatherParams<EntryPoint::BeginTransformFeedback>(primitiveMode);
 
         if (context->skipValidation() || ValidateBeginTransformFeedback(context, primitiveMode))
@@ -53,9 +66,15 @@ void GL_APIENTRY BindBufferBase(GLenum target, GLuint index, GLuint buffer)
 {
     EVENT("(GLenum target = 0x%X, GLuint index = %u, GLuint buffer = %u)", target, index, buffer);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, BindBufferBase, target, index, buffer);
+            return;
+        }
+
         BufferBinding targetPacked = FromGLenum<BufferBinding>(target);
         context->gatherParams<EntryPoint::BindBufferBase>(targetPacked, index, buffer);
 
@@ -75,9 +94,15 @@ BindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLs
         "GLsizeiptr size = %d)",
         target, index, buffer, offset, size);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, BindBufferRange, target, index, buffer, offset, size);
+            return;
+        }
+
         BufferBinding targetPacked = FromGLenum<BufferBinding>(target);
         context->gatherParams<EntryPoint::BindBufferRange>(targetPacked, index, buffer, offset,
                                                            size);
@@ -94,9 +119,15 @@ void GL_APIENTRY BindSampler(GLuint unit, GLuint sampler)
 {
     EVENT("(GLuint unit = %u, GLuint sampler = %u)", unit, sampler);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, BindSampler, unit, sampler);
+            return;
+        }
+
         context->gatherParams<EntryPoint::BindSampler>(unit, sampler);
 
         if (context->skipValidation() || ValidateBindSampler(context, unit, sampler))
@@ -110,9 +141,15 @@ void GL_APIENTRY BindTransformFeedback(GLenum target, GLuint id)
 {
     EVENT("(GLenum target = 0x%X, GLuint id = %u)", target, id);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, BindTransformFeedback, target, id);
+            return;
+        }
+
         context->gatherParams<EntryPoint::BindTransformFeedback>(target, id);
 
         if (context->skipValidation() || ValidateBindTransformFeedback(context, target, id))
@@ -126,9 +163,15 @@ void GL_APIENTRY BindVertexArray(GLuint array)
 {
     EVENT("(GLuint array = %u)", array);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, BindVertexArray, array);
+            return;
+        }
+
         context->gatherParams<EntryPoint::BindVertexArray>(array);
 
         if (context->skipValidation() || ValidateBindVertexArray(context, array))
@@ -155,9 +198,16 @@ void GL_APIENTRY BlitFramebuffer(GLint srcX0,
         "filter = 0x%X)",
         srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, BlitFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0,
+                            dstX1, dstY1, mask, filter);
+            return;
+        }
+
         context->gatherParams<EntryPoint::BlitFramebuffer>(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0,
                                                            dstX1, dstY1, mask, filter);
 
@@ -176,9 +226,15 @@ void GL_APIENTRY ClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, G
     EVENT("(GLenum buffer = 0x%X, GLint drawbuffer = %d, GLfloat depth = %f, GLint stencil = %d)",
           buffer, drawbuffer, depth, stencil);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, ClearBufferfi, buffer, drawbuffer, depth, stencil);
+            return;
+        }
+
         context->gatherParams<EntryPoint::ClearBufferfi>(buffer, drawbuffer, depth, stencil);
 
         if (context->skipValidation() ||
@@ -339,9 +395,16 @@ void GL_APIENTRY CopyBufferSubData(GLenum readTarget,
         "writeOffset = %d, GLsizeiptr size = %d)",
         readTarget, writeTarget, readOffset, writeOffset, size);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(
+                context, CopyBufferSubData, readTarget, writeTarget, readOffset, writeOffset, size);
+            return;
+        }
+
         BufferBinding readTargetPacked  = FromGLenum<BufferBinding>(readTarget);
         BufferBinding writeTargetPacked = FromGLenum<BufferBinding>(writeTarget);
         context->gatherParams<EntryPoint::CopyBufferSubData>(readTargetPacked, writeTargetPacked,
@@ -372,9 +435,16 @@ void GL_APIENTRY CopyTexSubImage3D(GLenum target,
         "zoffset = %d, GLint x = %d, GLint y = %d, GLsizei width = %d, GLsizei height = %d)",
         target, level, xoffset, yoffset, zoffset, x, y, width, height);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, CopyTexSubImage3D, target, level, xoffset, yoffset, zoffset, x,
+                            y, width, height);
+            return;
+        }
+
         TextureType targetPacked = FromGLenum<TextureType>(target);
         context->gatherParams<EntryPoint::CopyTexSubImage3D>(targetPacked, level, xoffset, yoffset,
                                                              zoffset, x, y, width, height);
@@ -474,9 +544,15 @@ void GL_APIENTRY DrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GL
     EVENT("(GLenum mode = 0x%X, GLint first = %d, GLsizei count = %d, GLsizei instancecount = %d)",
           mode, first, count, instancecount);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, DrawArraysInstanced, mode, first, count, instancecount);
+            return;
+        }
+
         context->gatherParams<EntryPoint::DrawArraysInstanced>(mode, first, count, instancecount);
 
         if (context->skipValidation() ||
@@ -558,9 +634,15 @@ void GL_APIENTRY EndQuery(GLenum target)
 {
     EVENT("(GLenum target = 0x%X)", target);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, EndQuery, target);
+            return;
+        }
+
         QueryType targetPacked = FromGLenum<QueryType>(target);
         context->gatherParams<EntryPoint::EndQuery>(targetPacked);
 
@@ -575,9 +657,15 @@ void GL_APIENTRY EndTransformFeedback()
 {
     EVENT("()");
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, EndTransformFeedback);
+            return;
+        }
+
         context->gatherParams<EntryPoint::EndTransformFeedback>();
 
         if (context->skipValidation() || ValidateEndTransformFeedback(context))
@@ -610,9 +698,15 @@ void GL_APIENTRY FlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeip
     EVENT("(GLenum target = 0x%X, GLintptr offset = %d, GLsizeiptr length = %d)", target, offset,
           length);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, FlushMappedBufferRange, target, offset, length);
+            return;
+        }
+
         BufferBinding targetPacked = FromGLenum<BufferBinding>(target);
         context->gatherParams<EntryPoint::FlushMappedBufferRange>(targetPacked, offset, length);
 
@@ -632,9 +726,16 @@ FramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint
         "GLint layer = %d)",
         target, attachment, texture, level, layer);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(
+                context, FramebufferTextureLayer, target, attachment, texture, level, layer);
+            return;
+        }
+
         context->gatherParams<EntryPoint::FramebufferTextureLayer>(target, attachment, texture,
                                                                    level, layer);
 
@@ -1344,9 +1445,15 @@ void GL_APIENTRY PauseTransformFeedback()
 {
     EVENT("()");
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, PauseTransformFeedback);
+            return;
+        }
+
         context->gatherParams<EntryPoint::PauseTransformFeedback>();
 
         if (context->skipValidation() || ValidatePauseTransformFeedback(context))
@@ -1383,9 +1490,15 @@ void GL_APIENTRY ProgramParameteri(GLuint program, GLenum pname, GLint value)
 {
     EVENT("(GLuint program = %u, GLenum pname = 0x%X, GLint value = %d)", program, pname, value);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, ProgramParameteri, program, pname, value);
+            return;
+        }
+
         context->gatherParams<EntryPoint::ProgramParameteri>(program, pname, value);
 
         if (context->skipValidation() || ValidateProgramParameteri(context, program, pname, value))
@@ -1399,9 +1512,15 @@ void GL_APIENTRY ReadBuffer(GLenum src)
 {
     EVENT("(GLenum src = 0x%X)", src);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, ReadBuffer, src);
+            return;
+        }
+
         context->gatherParams<EntryPoint::ReadBuffer>(src);
 
         if (context->skipValidation() || ValidateReadBuffer(context, src))
@@ -1422,9 +1541,16 @@ void GL_APIENTRY RenderbufferStorageMultisample(GLenum target,
         "= %d, GLsizei height = %d)",
         target, samples, internalformat, width, height);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, RenderbufferStorageMultisample, target, samples,
+                            internalformat, width, height);
+            return;
+        }
+
         context->gatherParams<EntryPoint::RenderbufferStorageMultisample>(
             target, samples, internalformat, width, height);
 
@@ -1441,9 +1567,15 @@ void GL_APIENTRY ResumeTransformFeedback()
 {
     EVENT("()");
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, ResumeTransformFeedback);
+            return;
+        }
+
         context->gatherParams<EntryPoint::ResumeTransformFeedback>();
 
         if (context->skipValidation() || ValidateResumeTransformFeedback(context))
@@ -1457,9 +1589,15 @@ void GL_APIENTRY SamplerParameterf(GLuint sampler, GLenum pname, GLfloat param)
 {
     EVENT("(GLuint sampler = %u, GLenum pname = 0x%X, GLfloat param = %f)", sampler, pname, param);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, SamplerParameterf, sampler, pname, param);
+            return;
+        }
+
         context->gatherParams<EntryPoint::SamplerParameterf>(sampler, pname, param);
 
         if (context->skipValidation() || ValidateSamplerParameterf(context, sampler, pname, param))
@@ -1490,9 +1628,15 @@ void GL_APIENTRY SamplerParameteri(GLuint sampler, GLenum pname, GLint param)
 {
     EVENT("(GLuint sampler = %u, GLenum pname = 0x%X, GLint param = %d)", sampler, pname, param);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, SamplerParameteri, sampler, pname, param);
+            return;
+        }
+
         context->gatherParams<EntryPoint::SamplerParameteri>(sampler, pname, param);
 
         if (context->skipValidation() || ValidateSamplerParameteri(context, sampler, pname, param))
@@ -1561,9 +1705,15 @@ TexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width
         "%d, GLsizei height = %d)",
         target, levels, internalformat, width, height);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, TexStorage2D, target, levels, internalformat, width, height);
+            return;
+        }
+
         TextureType targetPacked = FromGLenum<TextureType>(target);
         context->gatherParams<EntryPoint::TexStorage2D>(targetPacked, levels, internalformat, width,
                                                         height);
@@ -1588,9 +1738,16 @@ void GL_APIENTRY TexStorage3D(GLenum target,
         "%d, GLsizei height = %d, GLsizei depth = %d)",
         target, levels, internalformat, width, height, depth);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(
+                context, TexStorage3D, target, levels, internalformat, width, height, depth);
+            return;
+        }
+
         TextureType targetPacked = FromGLenum<TextureType>(target);
         context->gatherParams<EntryPoint::TexStorage3D>(targetPacked, levels, internalformat, width,
                                                         height, depth);
@@ -1667,9 +1824,15 @@ void GL_APIENTRY Uniform1ui(GLint location, GLuint v0)
 {
     EVENT("(GLint location = %d, GLuint v0 = %u)", location, v0);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, Uniform1ui, location, v0);
+            return;
+        }
+
         context->gatherParams<EntryPoint::Uniform1ui>(location, v0);
 
         if (context->skipValidation() || ValidateUniform1ui(context, location, v0))
@@ -1700,9 +1863,15 @@ void GL_APIENTRY Uniform2ui(GLint location, GLuint v0, GLuint v1)
 {
     EVENT("(GLint location = %d, GLuint v0 = %u, GLuint v1 = %u)", location, v0, v1);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, Uniform2ui, location, v0, v1);
+            return;
+        }
+
         context->gatherParams<EntryPoint::Uniform2ui>(location, v0, v1);
 
         if (context->skipValidation() || ValidateUniform2ui(context, location, v0, v1))
@@ -1734,9 +1903,15 @@ void GL_APIENTRY Uniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2)
     EVENT("(GLint location = %d, GLuint v0 = %u, GLuint v1 = %u, GLuint v2 = %u)", location, v0, v1,
           v2);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, Uniform3ui, location, v0, v1, v2);
+            return;
+        }
+
         context->gatherParams<EntryPoint::Uniform3ui>(location, v0, v1, v2);
 
         if (context->skipValidation() || ValidateUniform3ui(context, location, v0, v1, v2))
@@ -1768,9 +1943,15 @@ void GL_APIENTRY Uniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLu
     EVENT("(GLint location = %d, GLuint v0 = %u, GLuint v1 = %u, GLuint v2 = %u, GLuint v3 = %u)",
           location, v0, v1, v2, v3);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, Uniform4ui, location, v0, v1, v2, v3);
+            return;
+        }
+
         context->gatherParams<EntryPoint::Uniform4ui>(location, v0, v1, v2, v3);
 
         if (context->skipValidation() || ValidateUniform4ui(context, location, v0, v1, v2, v3))
@@ -1804,9 +1985,16 @@ void GL_APIENTRY UniformBlockBinding(GLuint program,
     EVENT("(GLuint program = %u, GLuint uniformBlockIndex = %u, GLuint uniformBlockBinding = %u)",
           program, uniformBlockIndex, uniformBlockBinding);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(
+                context, UniformBlockBinding, program, uniformBlockIndex, uniformBlockBinding);
+            return;
+        }
+
         context->gatherParams<EntryPoint::UniformBlockBinding>(program, uniformBlockIndex,
                                                                uniformBlockBinding);
 
@@ -1979,9 +2167,15 @@ void GL_APIENTRY VertexAttribDivisor(GLuint index, GLuint divisor)
 {
     EVENT("(GLuint index = %u, GLuint divisor = %u)", index, divisor);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, VertexAttribDivisor, index, divisor);
+            return;
+        }
+
         context->gatherParams<EntryPoint::VertexAttribDivisor>(index, divisor);
 
         if (context->skipValidation() || ValidateVertexAttribDivisor(context, index, divisor))
@@ -1996,9 +2190,15 @@ void GL_APIENTRY VertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint
     EVENT("(GLuint index = %u, GLint x = %d, GLint y = %d, GLint z = %d, GLint w = %d)", index, x,
           y, z, w);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, VertexAttribI4i, index, x, y, z, w);
+            return;
+        }
+
         context->gatherParams<EntryPoint::VertexAttribI4i>(index, x, y, z, w);
 
         if (context->skipValidation() || ValidateVertexAttribI4i(context, index, x, y, z, w))
@@ -2029,9 +2229,15 @@ void GL_APIENTRY VertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GL
     EVENT("(GLuint index = %u, GLuint x = %u, GLuint y = %u, GLuint z = %u, GLuint w = %u)", index,
           x, y, z, w);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, VertexAttribI4ui, index, x, y, z, w);
+            return;
+        }
+
         context->gatherParams<EntryPoint::VertexAttribI4ui>(index, x, y, z, w);
 
         if (context->skipValidation() || ValidateVertexAttribI4ui(context, index, x, y, z, w))
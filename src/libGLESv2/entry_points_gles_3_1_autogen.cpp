@@ -12,6 +12,7 @@
 
 #include "libANGLE/Context.h"
 #include "libANGLE/validationES31.h"
+#include "libGLESv2/entry_points_deferred.h"
 #include "libGLESv2/global_state.h"
 
 namespace gl
@@ -20,9 +21,15 @@ void GL_APIENTRY ActiveShaderProgram(GLuint pipeline, GLuint program)
 {
     EVENT("(GLuint pipeline = %u, GLuint program = %u)", pipeline, program);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, ActiveShaderProgram, pipeline, program);
+            return;
+        }
+
         context->gatherParams<EntryPoint::ActiveShaderProgram>(pipeline, program);
 
         if (context->skipValidation() || ValidateActiveShaderProgram(context, pipeline, program))
@@ -45,9 +52,16 @@ void GL_APIENTRY BindImageTexture(GLuint unit,
         "layer = %d, GLenum access = 0x%X, GLenum format = 0x%X)",
         unit, texture, level, layered, layer, access, format);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(
+                context, BindImageTexture, unit, texture, level, layered, layer, access, format);
+            return;
+        }
+
         context->gatherParams<EntryPoint::BindImageTexture>(unit, texture, level, layered, layer,
                                                             access, format);
 
@@ -63,9 +77,15 @@ void GL_APIENTRY BindProgramPipeline(GLuint pipeline)
 {
     EVENT("(GLuint pipeline = %u)", pipeline);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, BindProgramPipeline, pipeline);
+            return;
+        }
+
         context->gatherParams<EntryPoint::BindProgramPipeline>(pipeline);
 
         if (context->skipValidation() || ValidateBindProgramPipeline(context, pipeline))
@@ -84,9 +104,15 @@ void GL_APIENTRY BindVertexBuffer(GLuint bindingindex,
         "(GLuint bindingindex = %u, GLuint buffer = %u, GLintptr offset = %d, GLsizei stride = %d)",
         bindingindex, buffer, offset, stride);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, BindVertexBuffer, bindingindex, buffer, offset, stride);
+            return;
+        }
+
         context->gatherParams<EntryPoint::BindVertexBuffer>(bindingindex, buffer, offset, stride);
 
         if (context->skipValidation() ||
@@ -139,9 +165,15 @@ void GL_APIENTRY DispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuin
     EVENT("(GLuint num_groups_x = %u, GLuint num_groups_y = %u, GLuint num_groups_z = %u)",
           num_groups_x, num_groups_y, num_groups_z);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, DispatchCompute, num_groups_x, num_groups_y, num_groups_z);
+            return;
+        }
+
         context->gatherParams<EntryPoint::DispatchCompute>(num_groups_x, num_groups_y,
                                                            num_groups_z);
 
@@ -157,9 +189,15 @@ void GL_APIENTRY DispatchComputeIndirect(GLintptr indirect)
 {
     EVENT("(GLintptr indirect = %d)", indirect);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, DispatchComputeIndirect, indirect);
+            return;
+        }
+
         context->gatherParams<EntryPoint::DispatchComputeIndirect>(indirect);
 
         if (context->skipValidation() || ValidateDispatchComputeIndirect(context, indirect))
@@ -207,9 +245,15 @@ void GL_APIENTRY FramebufferParameteri(GLenum target, GLenum pname, GLint param)
 {
     EVENT("(GLenum target = 0x%X, GLenum pname = 0x%X, GLint param = %d)", target, pname, param);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, FramebufferParameteri, target, pname, param);
+            return;
+        }
+
         context->gatherParams<EntryPoint::FramebufferParameteri>(target, pname, param);
 
         if (context->skipValidation() ||
@@ -520,9 +564,15 @@ void GL_APIENTRY MemoryBarrier(GLbitfield barriers)
 {
     EVENT("(GLbitfield barriers = 0x%X)", barriers);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, MemoryBarrier, barriers);
+            return;
+        }
+
         context->gatherParams<EntryPoint::MemoryBarrier>(barriers);
 
         if (context->skipValidation() || ValidateMemoryBarrier(context, barriers))
@@ -536,9 +586,15 @@ void GL_APIENTRY MemoryBarrierByRegion(GLbitfield barriers)
 {
     EVENT("(GLbitfield barriers = 0x%X)", barriers);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, MemoryBarrierByRegion, barriers);
+            return;
+        }
+
         context->gatherParams<EntryPoint::MemoryBarrierByRegion>(barriers);
 
         if (context->skipValidation() || ValidateMemoryBarrierByRegion(context, barriers))
@@ -552,9 +608,15 @@ void GL_APIENTRY ProgramUniform1f(GLuint program, GLint location, GLfloat v0)
 {
     EVENT("(GLuint program = %u, GLint location = %d, GLfloat v0 = %f)", program, location, v0);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, ProgramUniform1f, program, location, v0);
+            return;
+        }
+
         context->gatherParams<EntryPoint::ProgramUniform1f>(program, location, v0);
 
         if (context->skipValidation() || ValidateProgramUniform1f(context, program, location, v0))
@@ -591,9 +653,15 @@ void GL_APIENTRY ProgramUniform1i(GLuint program, GLint location, GLint v0)
 {
     EVENT("(GLuint program = %u, GLint location = %d, GLint v0 = %d)", program, location, v0);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, ProgramUniform1i, program, location, v0);
+            return;
+        }
+
         context->gatherParams<EntryPoint::ProgramUniform1i>(program, location, v0);
 
         if (context->skipValidation() || ValidateProgramUniform1i(context, program, location, v0))
@@ -630,9 +698,15 @@ void GL_APIENTRY ProgramUniform1ui(GLuint program, GLint location, GLuint v0)
 {
     EVENT("(GLuint program = %u, GLint location = %d, GLuint v0 = %u)", program, location, v0);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, ProgramUniform1ui, program, location, v0);
+            return;
+        }
+
         context->gatherParams<EntryPoint::ProgramUniform1ui>(program, location, v0);
 
         if (context->skipValidation() || ValidateProgramUniform1ui(context, program, location, v0))
@@ -670,9 +744,15 @@ void GL_APIENTRY ProgramUniform2f(GLuint program, GLint location, GLfloat v0, GL
     EVENT("(GLuint program = %u, GLint location = %d, GLfloat v0 = %f, GLfloat v1 = %f)", program,
           location, v0, v1);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, ProgramUniform2f, program, location, v0, v1);
+            return;
+        }
+
         context->gatherParams<EntryPoint::ProgramUniform2f>(program, location, v0, v1);
 
         if (context->skipValidation() ||
@@ -711,9 +791,15 @@ void GL_APIENTRY ProgramUniform2i(GLuint program, GLint location, GLint v0, GLin
     EVENT("(GLuint program = %u, GLint location = %d, GLint v0 = %d, GLint v1 = %d)", program,
           location, v0, v1);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, ProgramUniform2i, program, location, v0, v1);
+            return;
+        }
+
         context->gatherParams<EntryPoint::ProgramUniform2i>(program, location, v0, v1);
 
         if (context->skipValidation() ||
@@ -752,9 +838,15 @@ void GL_APIENTRY ProgramUniform2ui(GLuint program, GLint location, GLuint v0, GL
     EVENT("(GLuint program = %u, GLint location = %d, GLuint v0 = %u, GLuint v1 = %u)", program,
           location, v0, v1);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, ProgramUniform2ui, program, location, v0, v1);
+            return;
+        }
+
         context->gatherParams<EntryPoint::ProgramUniform2ui>(program, location, v0, v1);
 
         if (context->skipValidation() ||
@@ -796,9 +888,15 @@ ProgramUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat
         "%f)",
         program, location, v0, v1, v2);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, ProgramUniform3f, program, location, v0, v1, v2);
+            return;
+        }
+
         context->gatherParams<EntryPoint::ProgramUniform3f>(program, location, v0, v1, v2);
 
         if (context->skipValidation() ||
@@ -837,9 +935,15 @@ void GL_APIENTRY ProgramUniform3i(GLuint program, GLint location, GLint v0, GLin
     EVENT("(GLuint program = %u, GLint location = %d, GLint v0 = %d, GLint v1 = %d, GLint v2 = %d)",
           program, location, v0, v1, v2);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, ProgramUniform3i, program, location, v0, v1, v2);
+            return;
+        }
+
         context->gatherParams<EntryPoint::ProgramUniform3i>(program, location, v0, v1, v2);
 
         if (context->skipValidation() ||
@@ -880,9 +984,15 @@ void GL_APIENTRY ProgramUniform3ui(GLuint program, GLint location, GLuint v0, GL
         "%u)",
         program, location, v0, v1, v2);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, ProgramUniform3ui, program, location, v0, v1, v2);
+            return;
+        }
+
         context->gatherParams<EntryPoint::ProgramUniform3ui>(program, location, v0, v1, v2);
 
         if (context->skipValidation() ||
@@ -924,9 +1034,15 @@ ProgramUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat
         "%f, GLfloat v3 = %f)",
         program, location, v0, v1, v2, v3);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, ProgramUniform4f, program, location, v0, v1, v2, v3);
+            return;
+        }
+
         context->gatherParams<EntryPoint::ProgramUniform4f>(program, location, v0, v1, v2, v3);
 
         if (context->skipValidation() ||
@@ -968,9 +1084,15 @@ ProgramUniform4i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, G
         "GLint v3 = %d)",
         program, location, v0, v1, v2, v3);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, ProgramUniform4i, program, location, v0, v1, v2, v3);
+            return;
+        }
+
         context->gatherParams<EntryPoint::ProgramUniform4i>(program, location, v0, v1, v2, v3);
 
         if (context->skipValidation() ||
@@ -1012,9 +1134,15 @@ ProgramUniform4ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v
         "%u, GLuint v3 = %u)",
         program, location, v0, v1, v2, v3);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, ProgramUniform4ui, program, location, v0, v1, v2, v3);
+            return;
+        }
+
         context->gatherParams<EntryPoint::ProgramUniform4ui>(program, location, v0, v1, v2, v3);
 
         if (context->skipValidation() ||
@@ -1277,9 +1405,15 @@ void GL_APIENTRY SampleMaski(GLuint maskNumber, GLbitfield mask)
 {
     EVENT("(GLuint maskNumber = %u, GLbitfield mask = 0x%X)", maskNumber, mask);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, SampleMaski, maskNumber, mask);
+            return;
+        }
+
         context->gatherParams<EntryPoint::SampleMaski>(maskNumber, mask);
 
         if (context->skipValidation() || ValidateSampleMaski(context, maskNumber, mask))
@@ -1301,9 +1435,16 @@ void GL_APIENTRY TexStorage2DMultisample(GLenum target,
         "= %d, GLsizei height = %d, GLboolean fixedsamplelocations = %u)",
         target, samples, internalformat, width, height, fixedsamplelocations);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, TexStorage2DMultisample, target, samples, internalformat,
+                            width, height, fixedsamplelocations);
+            return;
+        }
+
         TextureType targetPacked = FromGLenum<TextureType>(target);
         context->gatherParams<EntryPoint::TexStorage2DMultisample>(
             targetPacked, samples, internalformat, width, height, fixedsamplelocations);
@@ -1323,9 +1464,15 @@ void GL_APIENTRY UseProgramStages(GLuint pipeline, GLbitfield stages, GLuint pro
     EVENT("(GLuint pipeline = %u, GLbitfield stages = 0x%X, GLuint program = %u)", pipeline, stages,
           program);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, UseProgramStages, pipeline, stages, program);
+            return;
+        }
+
         context->gatherParams<EntryPoint::UseProgramStages>(pipeline, stages, program);
 
         if (context->skipValidation() ||
@@ -1340,9 +1487,15 @@ void GL_APIENTRY ValidateProgramPipeline(GLuint pipeline)
 {
     EVENT("(GLuint pipeline = %u)", pipeline);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, ValidateProgramPipeline, pipeline);
+            return;
+        }
+
         context->gatherParams<EntryPoint::ValidateProgramPipeline>(pipeline);
 
         if (context->skipValidation() || ValidateValidateProgramPipeline(context, pipeline))
@@ -1356,9 +1509,15 @@ void GL_APIENTRY VertexAttribBinding(GLuint attribindex, GLuint bindingindex)
 {
     EVENT("(GLuint attribindex = %u, GLuint bindingindex = %u)", attribindex, bindingindex);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, VertexAttribBinding, attribindex, bindingindex);
+            return;
+        }
+
         context->gatherParams<EntryPoint::VertexAttribBinding>(attribindex, bindingindex);
 
         if (context->skipValidation() ||
@@ -1380,9 +1539,16 @@ void GL_APIENTRY VertexAttribFormat(GLuint attribindex,
         "GLuint relativeoffset = %u)",
         attribindex, size, type, normalized, relativeoffset);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(
+                context, VertexAttribFormat, attribindex, size, type, normalized, relativeoffset);
+            return;
+        }
+
         context->gatherParams<EntryPoint::VertexAttribFormat>(attribindex, size, type, normalized,
                                                               relativeoffset);
 
@@ -1405,9 +1571,15 @@ void GL_APIENTRY VertexAttribIFormat(GLuint attribindex,
         "%u)",
         attribindex, size, type, relativeoffset);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, VertexAttribIFormat, attribindex, size, type, relativeoffset);
+            return;
+        }
+
         context->gatherParams<EntryPoint::VertexAttribIFormat>(attribindex, size, type,
                                                                relativeoffset);
 
@@ -1423,9 +1595,15 @@ void GL_APIENTRY VertexBindingDivisor(GLuint bindingindex, GLuint divisor)
 {
     EVENT("(GLuint bindingindex = %u, GLuint divisor = %u)", bindingindex, divisor);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, VertexBindingDivisor, bindingindex, divisor);
+            return;
+        }
+
         context->gatherParams<EntryPoint::VertexBindingDivisor>(bindingindex, divisor);
 
         if (context->skipValidation() ||
@@ -12,6 +12,7 @@
 
 #include "libANGLE/Context.h"
 #include "libANGLE/validationES.h"
+#include "libGLESv2/entry_points_deferred.h"
 #include "libGLESv2/global_state.h"
 
 #include "libANGLE/validationES.h"
@@ -40,9 +41,16 @@ void GL_APIENTRY BlitFramebufferANGLE(GLint srcX0,
         "filter = 0x%X)",
         srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, BlitFramebufferANGLE, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0,
+                            dstX1, dstY1, mask, filter);
+            return;
+        }
+
         context->gatherParams<EntryPoint::BlitFramebufferANGLE>(srcX0, srcY0, srcX1, srcY1, dstX0,
                                                                 dstY0, dstX1, dstY1, mask, filter);
 
@@ -68,9 +76,16 @@ void GL_APIENTRY RenderbufferStorageMultisampleANGLE(GLenum target,
         "= %d, GLsizei height = %d)",
         target, samples, internalformat, width, height);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, RenderbufferStorageMultisampleANGLE, target, samples,
+                            internalformat, width, height);
+            return;
+        }
+
         context->gatherParams<EntryPoint::RenderbufferStorageMultisampleANGLE>(
             target, samples, internalformat, width, height);
 
@@ -92,9 +107,15 @@ void GL_APIENTRY DrawArraysInstancedANGLE(GLenum mode,
     EVENT("(GLenum mode = 0x%X, GLint first = %d, GLsizei count = %d, GLsizei primcount = %d)",
           mode, first, count, primcount);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, DrawArraysInstancedANGLE, mode, first, count, primcount);
+            return;
+        }
+
         context->gatherParams<EntryPoint::DrawArraysInstancedANGLE>(mode, first, count, primcount);
 
         if (context->skipValidation() ||
@@ -134,9 +155,15 @@ void GL_APIENTRY VertexAttribDivisorANGLE(GLuint index, GLuint divisor)
 {
     EVENT("(GLuint index = %u, GLuint divisor = %u)", index, divisor);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, VertexAttribDivisorANGLE, index, divisor);
+            return;
+        }
+
         context->gatherParams<EntryPoint::VertexAttribDivisorANGLE>(index, divisor);
 
         if (context->skipValidation() || ValidateVertexAttribDivisorANGLE(context, index, divisor))
@@ -159,9 +186,16 @@ void GL_APIENTRY FramebufferTextureMultiviewLayeredANGLE(GLenum target,
         "GLint baseViewIndex = %d, GLsizei numViews = %d)",
         target, attachment, texture, level, baseViewIndex, numViews);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, FramebufferTextureMultiviewLayeredANGLE, target, attachment,
+                            texture, level, baseViewIndex, numViews);
+            return;
+        }
+
         context->gatherParams<EntryPoint::FramebufferTextureMultiviewLayeredANGLE>(
             target, attachment, texture, level, baseViewIndex, numViews);
 
@@ -1978,9 +2012,15 @@ void GL_APIENTRY CompressedCopyTextureCHROMIUM(GLuint sourceId, GLuint destId)
 {
     EVENT("(GLuint sourceId = %u, GLuint destId = %u)", sourceId, destId);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, CompressedCopyTextureCHROMIUM, sourceId, destId);
+            return;
+        }
+
         context->gatherParams<EntryPoint::CompressedCopyTextureCHROMIUM>(sourceId, destId);
 
         if (context->skipValidation() ||
@@ -2011,9 +2051,17 @@ void GL_APIENTRY CopyTextureCHROMIUM(GLuint sourceId,
         sourceId, sourceLevel, destTarget, destId, destLevel, internalFormat, destType, unpackFlipY,
         unpackPremultiplyAlpha, unpackUnmultiplyAlpha);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, CopyTextureCHROMIUM, sourceId, sourceLevel, destTarget, destId,
+                            destLevel, internalFormat, destType, unpackFlipY,
+                            unpackPremultiplyAlpha, unpackUnmultiplyAlpha);
+            return;
+        }
+
         TextureTarget destTargetPacked = FromGLenum<TextureTarget>(destTarget);
         context->gatherParams<EntryPoint::CopyTextureCHROMIUM>(
             sourceId, sourceLevel, destTargetPacked, destId, destLevel, internalFormat, destType,
@@ -2054,9 +2102,17 @@ void GL_APIENTRY CopySubTextureCHROMIUM(GLuint sourceId,
         sourceId, sourceLevel, destTarget, destId, destLevel, xoffset, yoffset, x, y, width, height,
         unpackFlipY, unpackPremultiplyAlpha, unpackUnmultiplyAlpha);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, CopySubTextureCHROMIUM, sourceId, sourceLevel, destTarget,
+                            destId, destLevel, xoffset, yoffset, x, y, width, height, unpackFlipY,
+                            unpackPremultiplyAlpha, unpackUnmultiplyAlpha);
+            return;
+        }
+
         TextureTarget destTargetPacked = FromGLenum<TextureTarget>(destTarget);
         context->gatherParams<EntryPoint::CopySubTextureCHROMIUM>(
             sourceId, sourceLevel, destTargetPacked, destId, destLevel, xoffset, yoffset, x, y,
@@ -2080,9 +2136,15 @@ void GL_APIENTRY CoverageModulationCHROMIUM(GLenum components)
 {
     EVENT("(GLenum components = 0x%X)", components);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, CoverageModulationCHROMIUM, components);
+            return;
+        }
+
         context->gatherParams<EntryPoint::CoverageModulationCHROMIUM>(components);
 
         if (context->skipValidation() || ValidateCoverageModulationCHROMIUM(context, components))
@@ -2112,9 +2174,15 @@ void GL_APIENTRY MatrixLoadIdentityCHROMIUM(GLenum matrixMode)
 {
     EVENT("(GLenum matrixMode = 0x%X)", matrixMode);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, MatrixLoadIdentityCHROMIUM, matrixMode);
+            return;
+        }
+
         context->gatherParams<EntryPoint::MatrixLoadIdentityCHROMIUM>(matrixMode);
 
         if (context->skipValidation() || ValidateMatrixLoadIdentityCHROMIUM(context, matrixMode))
@@ -2147,9 +2215,15 @@ void GL_APIENTRY DeletePathsCHROMIUM(GLuint first, GLsizei range)
 {
     EVENT("(GLuint first = %u, GLsizei range = %d)", first, range);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, DeletePathsCHROMIUM, first, range);
+            return;
+        }
+
         context->gatherParams<EntryPoint::DeletePathsCHROMIUM>(first, range);
 
         if (context->skipValidation() || ValidateDeletePathsCHROMIUM(context, first, range))
@@ -2208,9 +2282,15 @@ void GL_APIENTRY PathParameterfCHROMIUM(GLuint path, GLenum pname, GLfloat value
 {
     EVENT("(GLuint path = %u, GLenum pname = 0x%X, GLfloat value = %f)", path, pname, value);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, PathParameterfCHROMIUM, path, pname, value);
+            return;
+        }
+
         context->gatherParams<EntryPoint::PathParameterfCHROMIUM>(path, pname, value);
 
         if (context->skipValidation() ||
@@ -2225,9 +2305,15 @@ void GL_APIENTRY PathParameteriCHROMIUM(GLuint path, GLenum pname, GLint value)
 {
     EVENT("(GLuint path = %u, GLenum pname = 0x%X, GLint value = %d)", path, pname, value);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, PathParameteriCHROMIUM, path, pname, value);
+            return;
+        }
+
         context->gatherParams<EntryPoint::PathParameteriCHROMIUM>(path, pname, value);
 
         if (context->skipValidation() ||
@@ -2276,9 +2362,15 @@ void GL_APIENTRY PathStencilFuncCHROMIUM(GLenum func, GLint ref, GLuint mask)
 {
     EVENT("(GLenum func = 0x%X, GLint ref = %d, GLuint mask = %u)", func, ref, mask);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, PathStencilFuncCHROMIUM, func, ref, mask);
+            return;
+        }
+
         context->gatherParams<EntryPoint::PathStencilFuncCHROMIUM>(func, ref, mask);
 
         if (context->skipValidation() || ValidatePathStencilFuncCHROMIUM(context, func, ref, mask))
@@ -2292,9 +2384,15 @@ void GL_APIENTRY StencilFillPathCHROMIUM(GLuint path, GLenum fillMode, GLuint ma
 {
     EVENT("(GLuint path = %u, GLenum fillMode = 0x%X, GLuint mask = %u)", path, fillMode, mask);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, StencilFillPathCHROMIUM, path, fillMode, mask);
+            return;
+        }
+
         context->gatherParams<EntryPoint::StencilFillPathCHROMIUM>(path, fillMode, mask);
 
         if (context->skipValidation() ||
@@ -2309,9 +2407,15 @@ void GL_APIENTRY StencilStrokePathCHROMIUM(GLuint path, GLint reference, GLuint
 {
     EVENT("(GLuint path = %u, GLint reference = %d, GLuint mask = %u)", path, reference, mask);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, StencilStrokePathCHROMIUM, path, reference, mask);
+            return;
+        }
+
         context->gatherParams<EntryPoint::StencilStrokePathCHROMIUM>(path, reference, mask);
 
         if (context->skipValidation() ||
@@ -2326,9 +2430,15 @@ void GL_APIENTRY CoverFillPathCHROMIUM(GLuint path, GLenum coverMode)
 {
     EVENT("(GLuint path = %u, GLenum coverMode = 0x%X)", path, coverMode);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, CoverFillPathCHROMIUM, path, coverMode);
+            return;
+        }
+
         context->gatherParams<EntryPoint::CoverFillPathCHROMIUM>(path, coverMode);
 
         if (context->skipValidation() || ValidateCoverFillPathCHROMIUM(context, path, coverMode))
@@ -2342,9 +2452,15 @@ void GL_APIENTRY CoverStrokePathCHROMIUM(GLuint path, GLenum coverMode)
 {
     EVENT("(GLuint path = %u, GLenum coverMode = 0x%X)", path, coverMode);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, CoverStrokePathCHROMIUM, path, coverMode);
+            return;
+        }
+
         context->gatherParams<EntryPoint::CoverStrokePathCHROMIUM>(path, coverMode);
 
         if (context->skipValidation() || ValidateCoverStrokePathCHROMIUM(context, path, coverMode))
@@ -2362,9 +2478,16 @@ void GL_APIENTRY StencilThenCoverFillPathCHROMIUM(GLuint path,
     EVENT("(GLuint path = %u, GLenum fillMode = 0x%X, GLuint mask = %u, GLenum coverMode = 0x%X)",
           path, fillMode, mask, coverMode);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(
+                context, StencilThenCoverFillPathCHROMIUM, path, fillMode, mask, coverMode);
+            return;
+        }
+
         context->gatherParams<EntryPoint::StencilThenCoverFillPathCHROMIUM>(path, fillMode, mask,
                                                                             coverMode);
 
@@ -2384,9 +2507,16 @@ void GL_APIENTRY StencilThenCoverStrokePathCHROMIUM(GLuint path,
     EVENT("(GLuint path = %u, GLint reference = %d, GLuint mask = %u, GLenum coverMode = 0x%X)",
           path, reference, mask, coverMode);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(
+                context, StencilThenCoverStrokePathCHROMIUM, path, reference, mask, coverMode);
+            return;
+        }
+
         context->gatherParams<EntryPoint::StencilThenCoverStrokePathCHROMIUM>(path, reference, mask,
                                                                               coverMode);
 
@@ -2666,9 +2796,15 @@ void GL_APIENTRY PopGroupMarkerEXT()
     // It can interfere with the debug events being set by the caller.
     // EVENT("()");
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, PopGroupMarkerEXT);
+            return;
+        }
+
         context->gatherParams<EntryPoint::PopGroupMarkerEXT>();
 
         if (context->skipValidation() || ValidatePopGroupMarkerEXT(context))
@@ -2724,9 +2860,15 @@ void GL_APIENTRY BeginQueryEXT(GLenum target, GLuint id)
 {
     EVENT("(GLenum target = 0x%X, GLuint id = %u)", target, id);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, BeginQueryEXT, target, id);
+            return;
+        }
+
         QueryType targetPacked = FromGLenum<QueryType>(target);
         context->gatherParams<EntryPoint::BeginQueryEXT>(targetPacked, id);
 
@@ -2757,9 +2899,15 @@ void GL_APIENTRY EndQueryEXT(GLenum target)
 {
     EVENT("(GLenum target = 0x%X)", target);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, EndQueryEXT, target);
+            return;
+        }
+
         QueryType targetPacked = FromGLenum<QueryType>(target);
         context->gatherParams<EntryPoint::EndQueryEXT>(targetPacked);
 
@@ -2891,9 +3039,15 @@ void GL_APIENTRY QueryCounterEXT(GLuint id, GLenum target)
 {
     EVENT("(GLuint id = %u, GLenum target = 0x%X)", id, target);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, QueryCounterEXT, id, target);
+            return;
+        }
+
         QueryType targetPacked = FromGLenum<QueryType>(target);
         context->gatherParams<EntryPoint::QueryCounterEXT>(id, targetPacked);
 
@@ -2927,9 +3081,15 @@ void GL_APIENTRY FlushMappedBufferRangeEXT(GLenum target, GLintptr offset, GLsiz
     EVENT("(GLenum target = 0x%X, GLintptr offset = %d, GLsizeiptr length = %d)", target, offset,
           length);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, FlushMappedBufferRangeEXT, target, offset, length);
+            return;
+        }
+
         BufferBinding targetPacked = FromGLenum<BufferBinding>(target);
         context->gatherParams<EntryPoint::FlushMappedBufferRangeEXT>(targetPacked, offset, length);
 
@@ -3079,9 +3239,15 @@ void GL_APIENTRY TexStorage1DEXT(GLenum target,
         "%d)",
         target, levels, internalformat, width);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, TexStorage1DEXT, target, levels, internalformat, width);
+            return;
+        }
+
         context->gatherParams<EntryPoint::TexStorage1DEXT>(target, levels, internalformat, width);
 
         if (context->skipValidation() ||
@@ -3100,9 +3266,16 @@ TexStorage2DEXT(GLenum target, GLsizei levels, GLenum internalformat, GLsizei wi
         "%d, GLsizei height = %d)",
         target, levels, internalformat, width, height);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(
+                context, TexStorage2DEXT, target, levels, internalformat, width, height);
+            return;
+        }
+
         TextureType targetPacked = FromGLenum<TextureType>(target);
         context->gatherParams<EntryPoint::TexStorage2DEXT>(targetPacked, levels, internalformat,
                                                            width, height);
@@ -3127,9 +3300,16 @@ void GL_APIENTRY TexStorage3DEXT(GLenum target,
         "%d, GLsizei height = %d, GLsizei depth = %d)",
         target, levels, internalformat, width, height, depth);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(
+                context, TexStorage3DEXT, target, levels, internalformat, width, height, depth);
+            return;
+        }
+
         TextureType targetPacked = FromGLenum<TextureType>(target);
         context->gatherParams<EntryPoint::TexStorage3DEXT>(targetPacked, levels, internalformat,
                                                            width, height, depth);
@@ -3349,9 +3529,15 @@ void GL_APIENTRY PopDebugGroupKHR()
 {
     EVENT("()");
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, PopDebugGroupKHR);
+            return;
+        }
+
         context->gatherParams<EntryPoint::PopDebugGroupKHR>();
 
         if (context->skipValidation() || ValidatePopDebugGroupKHR(context))
@@ -3381,6 +3567,23 @@ void GL_APIENTRY PushDebugGroupKHR(GLenum source, GLuint id, GLsizei length, con
     }
 }
 
+// GL_KHR_parallel_shader_compile
+void GL_APIENTRY MaxShaderCompilerThreadsKHR(GLuint count)
+{
+    EVENT("(GLuint count = %u)", count);
+
+    Context *context = GetValidGlobalContext();
+    if (context)
+    {
+        context->gatherParams<EntryPoint::MaxShaderCompilerThreadsKHR>(count);
+
+        if (context->skipValidation() || ValidateMaxShaderCompilerThreadsKHR(context, count))
+        {
+            context->maxShaderCompilerThreads(count);
+        }
+    }
+}
+
 // GL_NV_fence
 void GL_APIENTRY DeleteFencesNV(GLsizei n, const GLuint *fences)
 {
@@ -3402,9 +3605,15 @@ void GL_APIENTRY FinishFenceNV(GLuint fence)
 {
     EVENT("(GLuint fence = %u)", fence);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, FinishFenceNV, fence);
+            return;
+        }
+
         context->gatherParams<EntryPoint::FinishFenceNV>(fence);
 
         if (context->skipValidation() || ValidateFinishFenceNV(context, fence))
@@ -3469,9 +3678,15 @@ void GL_APIENTRY SetFenceNV(GLuint fence, GLenum condition)
 {
     EVENT("(GLuint fence = %u, GLenum condition = 0x%X)", fence, condition);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, SetFenceNV, fence, condition);
+            return;
+        }
+
         context->gatherParams<EntryPoint::SetFenceNV>(fence, condition);
 
         if (context->skipValidation() || ValidateSetFenceNV(context, fence, condition))
@@ -3542,9 +3757,15 @@ void GL_APIENTRY DrawTexfOES(GLfloat x, GLfloat y, GLfloat z, GLfloat width, GLf
         "(GLfloat x = %f, GLfloat y = %f, GLfloat z = %f, GLfloat width = %f, GLfloat height = %f)",
         x, y, z, width, height);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, DrawTexfOES, x, y, z, width, height);
+            return;
+        }
+
         context->gatherParams<EntryPoint::DrawTexfOES>(x, y, z, width, height);
 
         if (context->skipValidation() || ValidateDrawTexfOES(context, x, y, z, width, height))
@@ -3575,9 +3796,15 @@ void GL_APIENTRY DrawTexiOES(GLint x, GLint y, GLint z, GLint width, GLint heigh
     EVENT("(GLint x = %d, GLint y = %d, GLint z = %d, GLint width = %d, GLint height = %d)", x, y,
           z, width, height);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, DrawTexiOES, x, y, z, width, height);
+            return;
+        }
+
         context->gatherParams<EntryPoint::DrawTexiOES>(x, y, z, width, height);
 
         if (context->skipValidation() || ValidateDrawTexiOES(context, x, y, z, width, height))
@@ -3609,9 +3836,15 @@ void GL_APIENTRY DrawTexsOES(GLshort x, GLshort y, GLshort z, GLshort width, GLs
         "(GLshort x = %d, GLshort y = %d, GLshort z = %d, GLshort width = %d, GLshort height = %d)",
         x, y, z, width, height);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, DrawTexsOES, x, y, z, width, height);
+            return;
+        }
+
         context->gatherParams<EntryPoint::DrawTexsOES>(x, y, z, width, height);
 
         if (context->skipValidation() || ValidateDrawTexsOES(context, x, y, z, width, height))
@@ -3644,9 +3877,15 @@ void GL_APIENTRY DrawTexxOES(GLfixed x, GLfixed y, GLfixed z, GLfixed width, GLf
         "height = 0x%X)",
         x, y, z, width, height);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, DrawTexxOES, x, y, z, width, height);
+            return;
+        }
+
         context->gatherParams<EntryPoint::DrawTexxOES>(x, y, z, width, height);
 
         if (context->skipValidation() || ValidateDrawTexxOES(context, x, y, z, width, height))
@@ -3677,9 +3916,15 @@ void GL_APIENTRY BindFramebufferOES(GLenum target, GLuint framebuffer)
 {
     EVENT("(GLenum target = 0x%X, GLuint framebuffer = %u)", target, framebuffer);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, BindFramebufferOES, target, framebuffer);
+            return;
+        }
+
         context->gatherParams<EntryPoint::BindFramebufferOES>(target, framebuffer);
 
         if (context->skipValidation() || ValidateBindFramebufferOES(context, target, framebuffer))
@@ -3693,9 +3938,15 @@ void GL_APIENTRY BindRenderbufferOES(GLenum target, GLuint renderbuffer)
 {
     EVENT("(GLenum target = 0x%X, GLuint renderbuffer = %u)", target, renderbuffer);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, BindRenderbufferOES, target, renderbuffer);
+            return;
+        }
+
         context->gatherParams<EntryPoint::BindRenderbufferOES>(target, renderbuffer);
 
         if (context->skipValidation() || ValidateBindRenderbufferOES(context, target, renderbuffer))
@@ -3765,9 +4016,16 @@ void GL_APIENTRY FramebufferRenderbufferOES(GLenum target,
         "renderbuffer = %u)",
         target, attachment, renderbuffertarget, renderbuffer);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, FramebufferRenderbufferOES, target, attachment,
+                            renderbuffertarget, renderbuffer);
+            return;
+        }
+
         context->gatherParams<EntryPoint::FramebufferRenderbufferOES>(
             target, attachment, renderbuffertarget, renderbuffer);
 
@@ -3791,9 +4049,16 @@ void GL_APIENTRY FramebufferTexture2DOES(GLenum target,
         "= %u, GLint level = %d)",
         target, attachment, textarget, texture, level);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(
+                context, FramebufferTexture2DOES, target, attachment, textarget, texture, level);
+            return;
+        }
+
         TextureTarget textargetPacked = FromGLenum<TextureTarget>(textarget);
         context->gatherParams<EntryPoint::FramebufferTexture2DOES>(target, attachment,
                                                                    textargetPacked, texture, level);
@@ -3843,9 +4108,15 @@ void GL_APIENTRY GenerateMipmapOES(GLenum target)
 {
     EVENT("(GLenum target = 0x%X)", target);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, GenerateMipmapOES, target);
+            return;
+        }
+
         TextureType targetPacked = FromGLenum<TextureType>(target);
         context->gatherParams<EntryPoint::GenerateMipmapOES>(targetPacked);
 
@@ -3944,9 +4215,15 @@ void GL_APIENTRY RenderbufferStorageOES(GLenum target,
         "%d)",
         target, internalformat, width, height);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, RenderbufferStorageOES, target, internalformat, width, height);
+            return;
+        }
+
         context->gatherParams<EntryPoint::RenderbufferStorageOES>(target, internalformat, width,
                                                                   height);
 
@@ -4070,9 +4347,15 @@ void GL_APIENTRY CurrentPaletteMatrixOES(GLuint matrixpaletteindex)
 {
     EVENT("(GLuint matrixpaletteindex = %u)", matrixpaletteindex);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, CurrentPaletteMatrixOES, matrixpaletteindex);
+            return;
+        }
+
         context->gatherParams<EntryPoint::CurrentPaletteMatrixOES>(matrixpaletteindex);
 
         if (context->skipValidation() ||
@@ -4087,9 +4370,15 @@ void GL_APIENTRY LoadPaletteFromModelViewMatrixOES()
 {
     EVENT("()");
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, LoadPaletteFromModelViewMatrixOES);
+            return;
+        }
+
         context->gatherParams<EntryPoint::LoadPaletteFromModelViewMatrixOES>();
 
         if (context->skipValidation() || ValidateLoadPaletteFromModelViewMatrixOES(context))
@@ -4231,9 +4520,15 @@ void GL_APIENTRY TexGenfOES(GLenum coord, GLenum pname, GLfloat param)
 {
     EVENT("(GLenum coord = 0x%X, GLenum pname = 0x%X, GLfloat param = %f)", coord, pname, param);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, TexGenfOES, coord, pname, param);
+            return;
+        }
+
         context->gatherParams<EntryPoint::TexGenfOES>(coord, pname, param);
 
         if (context->skipValidation() || ValidateTexGenfOES(context, coord, pname, param))
@@ -4264,9 +4559,15 @@ void GL_APIENTRY TexGeniOES(GLenum coord, GLenum pname, GLint param)
 {
     EVENT("(GLenum coord = 0x%X, GLenum pname = 0x%X, GLint param = %d)", coord, pname, param);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, TexGeniOES, coord, pname, param);
+            return;
+        }
+
         context->gatherParams<EntryPoint::TexGeniOES>(coord, pname, param);
 
         if (context->skipValidation() || ValidateTexGeniOES(context, coord, pname, param))
@@ -4297,9 +4598,15 @@ void GL_APIENTRY TexGenxOES(GLenum coord, GLenum pname, GLfixed param)
 {
     EVENT("(GLenum coord = 0x%X, GLenum pname = 0x%X, GLfixed param = 0x%X)", coord, pname, param);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, TexGenxOES, coord, pname, param);
+            return;
+        }
+
         context->gatherParams<EntryPoint::TexGenxOES>(coord, pname, param);
 
         if (context->skipValidation() || ValidateTexGenxOES(context, coord, pname, param))
@@ -4331,9 +4638,15 @@ void GL_APIENTRY BindVertexArrayOES(GLuint array)
 {
     EVENT("(GLuint array = %u)", array);
 
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextDeferrable();
     if (context)
     {
+        if (context->isDeferringCommands())
+        {
+            DeferEntryPoint(context, BindVertexArrayOES, array);
+            return;
+        }
+
         context->gatherParams<EntryPoint::BindVertexArrayOES>(array);
 
         if (context->skipValidation() || ValidateBindVertexArrayOES(context, array))
@@ -12,6 +12,7 @@
 #include "common/platform.h"
 #include "common/tls.h"
 
+#include "libANGLE/Context.h"
 #include "libANGLE/Thread.h"
 
 namespace gl
@@ -20,12 +21,40 @@ namespace gl
 Context *GetGlobalContext()
 {
     egl::Thread *thread = egl::GetCurrentThread();
-    return thread->getContext();
+    Context *context    = thread->getContext();
+    if (context)
+    {
+        context->finishDeferredCommands();
+    }
+    return context;
 }
 
 Context *GetValidGlobalContext()
 {
     egl::Thread *thread = egl::GetCurrentThread();
+    Context *context    = thread->getContext();
+    if (context)
+    {
+        context->finishDeferredCommands();
+    }
+    return thread->getValidContext();
+}
+
+Context *GetValidGlobalContextDeferrable()
+{
+    egl::Thread *thread = egl::GetCurrentThread();
+    Context *context    = thread->getContext();
+    if (context && context->isDeferringCommands())
+    {
+        // Calls recorded before the context was lost check for it again when they are replayed.
+        // Once it is lost, calls are rejected right away like on the synchronous path, which
+        // records the error on this thread, so the consumer thread must be idle.
+        if (!context->isContextLost())
+        {
+            return context;
+        }
+        context->finishDeferredCommands();
+    }
     return thread->getValidContext();
 }
 
@@ -74,6 +103,15 @@ Thread *GetCurrentThread()
     return (current ? current : AllocateCurrentThread());
 }
 
+void FinishDeferredCommands(Thread *thread)
+{
+    gl::Context *context = thread->getContext();
+    if (context)
+    {
+        context->finishDeferredCommands();
+    }
+}
+
 }  // namespace egl
 
 #ifdef ANGLE_PLATFORM_WINDOWS
@@ -16,6 +16,10 @@ class Context;
 Context *GetGlobalContext();
 Context *GetValidGlobalContext();
 
+// Doesn't wait for the calls recorded by a context with a deferred command stream, so only entry
+// points that can be deferred use it.
+Context *GetValidGlobalContextDeferrable();
+
 }  // namespace gl
 
 namespace egl
@@ -24,6 +28,10 @@ class Thread;
 
 Thread *GetCurrentThread();
 
+// Waits for the calls recorded by the current context, if it defers them, before EGL uses the
+// context or its surfaces.
+void FinishDeferredCommands(Thread *thread);
+
 }  // namespace egl
 
 #endif // LIBGLESV2_GLOBALSTATE_H_
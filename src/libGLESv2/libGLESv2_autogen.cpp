@@ -3638,6 +3638,12 @@ void GL_APIENTRY glPushDebugGroupKHR(GLenum source,
     return gl::PushDebugGroupKHR(source, id, length, message);
 }
 
+// GL_KHR_parallel_shader_compile
+void GL_APIENTRY glMaxShaderCompilerThreadsKHR(GLuint count)
+{
+    return gl::MaxShaderCompilerThreadsKHR(count);
+}
+
 // GL_NV_fence
 void GL_APIENTRY glDeleteFencesNV(GLsizei n, const GLuint *fences)
 {
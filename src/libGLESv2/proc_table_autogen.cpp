@@ -442,6 +442,7 @@ ProcEntry g_procTable[] = {
     {"glMaterialxv", P(gl::Materialxv)},
     {"glMatrixIndexPointerOES", P(gl::MatrixIndexPointerOES)},
     {"glMatrixMode", P(gl::MatrixMode)},
+    {"glMaxShaderCompilerThreadsKHR", P(gl::MaxShaderCompilerThreadsKHR)},
     {"glMemoryBarrier", P(gl::MemoryBarrier)},
     {"glMemoryBarrierByRegion", P(gl::MemoryBarrierByRegion)},
     {"glMultMatrixf", P(gl::MultMatrixf)},
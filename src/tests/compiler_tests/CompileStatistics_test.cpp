@@ -0,0 +1,165 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CompileStatistics_test.cpp:
+//   Tests for the per-phase statistics recorded by compiles with SH_COLLECT_COMPILE_STATISTICS.
+//
+
+#include "GLSLANG/ShaderLang.h"
+#include "angle_gl.h"
+#include "gtest/gtest.h"
+
+namespace
+{
+
+const char kFragmentShader[] = R"(#version 300 es
+precision mediump float;
+uniform vec4 uColor;
+uniform float uExponent;
+out vec4 fragColor;
+void main()
+{
+    float x = pow(uColor.x, 2.0);
+    fragColor = uColor * x;
+})";
+
+constexpr ShCompileOptions kCompileOptions =
+    SH_OBJECT_CODE | SH_VARIABLES | SH_COLLECT_COMPILE_STATISTICS;
+
+class CompileStatisticsTest : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        sh::InitBuiltInResources(&mResources);
+        mCompiler = sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES3_SPEC,
+                                          SH_GLSL_COMPATIBILITY_OUTPUT, &mResources);
+        ASSERT_NE(nullptr, mCompiler);
+    }
+
+    void TearDown() override { sh::Destruct(mCompiler); }
+
+    bool compile(const char *shader, ShCompileOptions compileOptions)
+    {
+        const char *shaderStrings[] = {shader};
+        return sh::Compile(mCompiler, shaderStrings, 1, compileOptions);
+    }
+
+    const std::vector<sh::CompilePhaseStatistics> &getPhases() const
+    {
+        const std::vector<sh::CompilePhaseStatistics> *phases =
+            sh::GetCompileStatistics(mCompiler);
+        EXPECT_NE(nullptr, phases);
+        return *phases;
+    }
+
+    const sh::CompilePhaseStatistics *findPhase(const std::string &name) const
+    {
+        for (const sh::CompilePhaseStatistics &phase : getPhases())
+        {
+            if (phase.name == name)
+            {
+                return &phase;
+            }
+        }
+        return nullptr;
+    }
+
+    ShBuiltInResources mResources;
+    ShHandle mCompiler;
+};
+
+// Statistics are only collected when asked for.
+TEST_F(CompileStatisticsTest, NotCollectedByDefault)
+{
+    ASSERT_TRUE(compile(kFragmentShader, kCompileOptions));
+    EXPECT_FALSE(getPhases().empty());
+
+    ASSERT_TRUE(compile(kFragmentShader, SH_OBJECT_CODE | SH_VARIABLES));
+    EXPECT_TRUE(getPhases().empty());
+}
+
+// The phases are listed in the order they ran, from parsing to output.
+TEST_F(CompileStatisticsTest, PhaseOrder)
+{
+    ASSERT_TRUE(compile(kFragmentShader, kCompileOptions));
+
+    const std::vector<sh::CompilePhaseStatistics> &phases = getPhases();
+    ASSERT_LE(4u, phases.size());
+    EXPECT_EQ("Parse", phases.front().name);
+    EXPECT_EQ("Validate", phases[1].name);
+    EXPECT_EQ("Output", phases.back().name);
+    EXPECT_NE(nullptr, findPhase("CollectVariables"));
+
+    for (const sh::CompilePhaseStatistics &phase : phases)
+    {
+        EXPECT_LE(0.0, phase.wallTimeSeconds) << phase.name;
+    }
+}
+
+// Parsing builds the tree in pool memory, and the later phases walk it.
+TEST_F(CompileStatisticsTest, NodesAndPoolMemory)
+{
+    ASSERT_TRUE(compile(kFragmentShader, kCompileOptions));
+
+    const sh::CompilePhaseStatistics *parse = findPhase("Parse");
+    ASSERT_NE(nullptr, parse);
+    EXPECT_LT(0u, parse->poolBytes);
+
+    const sh::CompilePhaseStatistics *collectVariables = findPhase("CollectVariables");
+    ASSERT_NE(nullptr, collectVariables);
+    EXPECT_LT(0u, collectVariables->nodesVisited);
+
+    const sh::CompilePhaseStatistics *output = findPhase("Output");
+    ASSERT_NE(nullptr, output);
+    EXPECT_LT(0u, output->nodesVisited);
+}
+
+// Workarounds get their own phase only when they are enabled.
+TEST_F(CompileStatisticsTest, WorkaroundPhases)
+{
+    ASSERT_TRUE(compile(kFragmentShader, kCompileOptions));
+    EXPECT_EQ(nullptr, findPhase("RemovePow"));
+
+    ASSERT_TRUE(compile(kFragmentShader, kCompileOptions | SH_REMOVE_POW_WITH_CONSTANT_EXPONENT));
+    const sh::CompilePhaseStatistics *removePow = findPhase("RemovePow");
+    ASSERT_NE(nullptr, removePow);
+    EXPECT_LT(0u, removePow->nodesVisited);
+}
+
+// A compile that fails ends with the phase that failed.
+TEST_F(CompileStatisticsTest, FailedCompile)
+{
+    const char kInvalidShader[] = R"(#version 300 es
+precision mediump float;
+out vec4 fragColor;
+void main()
+{
+    fragColor = undeclared;
+})";
+    ASSERT_FALSE(compile(kInvalidShader, kCompileOptions));
+
+    const std::vector<sh::CompilePhaseStatistics> &phases = getPhases();
+    ASSERT_EQ(1u, phases.size());
+    EXPECT_EQ("Parse", phases[0].name);
+}
+
+// A compile restored from the translation cache only looks the translation up.
+TEST_F(CompileStatisticsTest, TranslationCacheHit)
+{
+    sh::ClearTranslationCache();
+
+    ASSERT_TRUE(compile(kFragmentShader, kCompileOptions | SH_CACHE_TRANSLATION));
+    EXPECT_EQ("TranslationCache", getPhases().front().name);
+    EXPECT_LT(1u, getPhases().size());
+
+    ASSERT_TRUE(compile(kFragmentShader, kCompileOptions | SH_CACHE_TRANSLATION));
+    ASSERT_EQ(1u, getPhases().size());
+    EXPECT_EQ("TranslationCache", getPhases().front().name);
+
+    sh::ClearTranslationCache();
+}
+
+}  // anonymous namespace
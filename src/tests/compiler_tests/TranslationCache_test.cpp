@@ -0,0 +1,262 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// TranslationCache_test.cpp:
+//   Tests for the cache of translation results used by compiles with SH_CACHE_TRANSLATION.
+//
+
+#include <stdio.h>
+
+#include "GLSLANG/ShaderLang.h"
+#include "angle_gl.h"
+#include "common/system_utils.h"
+#include "compiler/translator/TranslationCache.h"
+#include "gtest/gtest.h"
+
+namespace sh
+{
+
+namespace
+{
+
+const char kFragmentShader[] = R"(#version 300 es
+precision mediump float;
+struct S
+{
+    vec4 color;
+    float scale[2];
+};
+uniform S uS;
+uniform Block
+{
+    vec4 blockColor;
+};
+in vec2 vTexCoord;
+out vec4 fragColor;
+void main()
+{
+    fragColor = uS.color * uS.scale[1] + blockColor + vec4(vTexCoord, 0.0, 0.0);
+})";
+
+constexpr ShCompileOptions kCompileOptions = SH_OBJECT_CODE | SH_VARIABLES | SH_CACHE_TRANSLATION;
+
+class TranslationCacheTest : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        sh::InitBuiltInResources(&mResources);
+        ConfigureTranslationCache(1024 * 1024, "");
+        ClearTranslationCache();
+    }
+
+    void TearDown() override
+    {
+        for (ShHandle compiler : mCompilers)
+        {
+            sh::Destruct(compiler);
+        }
+        ClearTranslationCache();
+    }
+
+    ShHandle constructCompiler()
+    {
+        ShHandle compiler =
+            sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES3_SPEC, SH_ESSL_OUTPUT, &mResources);
+        EXPECT_NE(nullptr, compiler);
+        mCompilers.push_back(compiler);
+        return compiler;
+    }
+
+    bool compile(ShHandle compiler, const char *source, ShCompileOptions compileOptions)
+    {
+        const char *shaderStrings[] = {source};
+        return sh::Compile(compiler, shaderStrings, 1, compileOptions);
+    }
+
+    TranslationCache *cache() { return TranslationCache::GetInstance(); }
+
+    ShBuiltInResources mResources;
+    std::vector<ShHandle> mCompilers;
+};
+
+void ExpectSameVariables(const std::vector<Uniform> &expected, const std::vector<Uniform> &actual)
+{
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t index = 0; index < expected.size(); ++index)
+    {
+        EXPECT_EQ(expected[index], actual[index]);
+        EXPECT_EQ(expected[index].mappedName, actual[index].mappedName);
+    }
+}
+
+// A second compile of the same shader is served from the cache and reports the same results.
+TEST_F(TranslationCacheTest, HitRestoresResults)
+{
+    ShHandle first = constructCompiler();
+    ASSERT_TRUE(compile(first, kFragmentShader, kCompileOptions)) << sh::GetInfoLog(first);
+    EXPECT_EQ(0u, cache()->getHitCount());
+    EXPECT_EQ(1u, cache()->getMissCount());
+
+    ShHandle second = constructCompiler();
+    ASSERT_TRUE(compile(second, kFragmentShader, kCompileOptions));
+    EXPECT_EQ(1u, cache()->getHitCount());
+
+    EXPECT_EQ(sh::GetObjectCode(first), sh::GetObjectCode(second));
+    EXPECT_EQ(sh::GetShaderVersion(first), sh::GetShaderVersion(second));
+    ExpectSameVariables(*sh::GetUniforms(first), *sh::GetUniforms(second));
+    EXPECT_EQ(*sh::GetInputVaryings(first), *sh::GetInputVaryings(second));
+    EXPECT_EQ(*sh::GetOutputVariables(first), *sh::GetOutputVariables(second));
+    ASSERT_EQ(1u, sh::GetUniformBlocks(second)->size());
+    EXPECT_TRUE((*sh::GetUniformBlocks(first))[0].isSameInterfaceBlockAtLinkTime(
+        (*sh::GetUniformBlocks(second))[0]));
+}
+
+// Anything that changes the translation changes the key.
+TEST_F(TranslationCacheTest, KeyCoversOptionsAndResources)
+{
+    ShHandle compiler = constructCompiler();
+    ASSERT_TRUE(compile(compiler, kFragmentShader, kCompileOptions));
+    ASSERT_TRUE(compile(compiler, kFragmentShader, kCompileOptions | SH_INIT_OUTPUT_VARIABLES));
+    EXPECT_EQ(0u, cache()->getHitCount());
+
+    mResources.MaxDrawBuffers = 2;
+    ShHandle otherResources   = constructCompiler();
+    ASSERT_TRUE(compile(otherResources, kFragmentShader, kCompileOptions));
+    EXPECT_EQ(0u, cache()->getHitCount());
+
+    // Options that don't affect the output share the entry.
+    ASSERT_TRUE(compile(compiler, kFragmentShader, kCompileOptions | SH_LARGE_POOL_PAGES));
+    EXPECT_EQ(1u, cache()->getHitCount());
+}
+
+// Failed compiles are not cached and still report their errors.
+TEST_F(TranslationCacheTest, FailuresAreNotCached)
+{
+    const char kBadShader[] = "void main() { undefined(); }";
+
+    ShHandle compiler = constructCompiler();
+    EXPECT_FALSE(compile(compiler, kBadShader, kCompileOptions));
+    EXPECT_FALSE(compile(compiler, kBadShader, kCompileOptions));
+    EXPECT_EQ(0u, cache()->getHitCount());
+    EXPECT_NE(std::string::npos, sh::GetInfoLog(compiler).find("undefined"));
+}
+
+// The cache stays within its memory budget, evicting the least recently used entries.
+TEST_F(TranslationCacheTest, EvictsLeastRecentlyUsed)
+{
+    ShHandle compiler = constructCompiler();
+    ASSERT_TRUE(compile(compiler, kFragmentShader, kCompileOptions));
+    size_t entrySize = cache()->getMemorySize();
+    ASSERT_GT(entrySize, 0u);
+
+    // Only room for one entry of this size.
+    ConfigureTranslationCache(entrySize, "");
+    const char kOtherShader[] = "void main() { gl_FragColor = vec4(1.0); }";
+    ASSERT_TRUE(compile(compiler, kOtherShader, kCompileOptions));
+    EXPECT_LE(cache()->getMemorySize(), entrySize);
+
+    // The first shader was evicted, the second one is still there.
+    ASSERT_TRUE(compile(compiler, kOtherShader, kCompileOptions));
+    EXPECT_EQ(1u, cache()->getHitCount());
+    ASSERT_TRUE(compile(compiler, kFragmentShader, kCompileOptions));
+    EXPECT_EQ(1u, cache()->getHitCount());
+}
+
+// Results survive serialization, and truncated blobs are rejected.
+TEST_F(TranslationCacheTest, SerializationRoundTrip)
+{
+    ShHandle compiler = constructCompiler();
+    ASSERT_TRUE(compile(compiler, kFragmentShader, SH_OBJECT_CODE | SH_VARIABLES));
+
+    TranslationResult result;
+    result.objectCode               = sh::GetObjectCode(compiler);
+    result.shaderVersion            = 300;
+    result.uniforms                 = *sh::GetUniforms(compiler);
+    result.uniformBlocks            = *sh::GetUniformBlocks(compiler);
+    result.outputVariables          = *sh::GetOutputVariables(compiler);
+    result.nameMap["a"]             = "b";
+    result.uniformRegisterMap["uS"] = 3;
+
+    result.pragma.debug                                  = true;
+    result.pragma.stdgl.invariantAll                     = true;
+    result.extensionBehavior[TExtension::EXT_frag_depth] = EBhEnable;
+    result.glPositionInitialized                         = true;
+
+    std::vector<uint8_t> blob;
+    TranslationCache::Serialize(result, &blob);
+
+    TranslationResult restored;
+    ASSERT_TRUE(TranslationCache::Deserialize(blob.data(), blob.size(), &restored));
+    EXPECT_EQ(result.objectCode, restored.objectCode);
+    EXPECT_EQ(300, restored.shaderVersion);
+    ExpectSameVariables(result.uniforms, restored.uniforms);
+    EXPECT_EQ(result.outputVariables, restored.outputVariables);
+    ASSERT_EQ(1u, restored.uniformBlocks.size());
+    EXPECT_TRUE(result.uniformBlocks[0].isSameInterfaceBlockAtLinkTime(restored.uniformBlocks[0]));
+    EXPECT_EQ(result.nameMap, restored.nameMap);
+    EXPECT_EQ(result.uniformRegisterMap, restored.uniformRegisterMap);
+    EXPECT_TRUE(restored.pragma.debug);
+    EXPECT_TRUE(restored.pragma.stdgl.invariantAll);
+    EXPECT_EQ(result.extensionBehavior, restored.extensionBehavior);
+    EXPECT_TRUE(restored.glPositionInitialized);
+
+    for (size_t size : {size_t(0), blob.size() / 2, blob.size() - 1})
+    {
+        TranslationResult truncated;
+        EXPECT_FALSE(TranslationCache::Deserialize(blob.data(), size, &truncated));
+    }
+}
+
+// Translations written to the backing directory are found after the memory cache is dropped, as
+// they would be by another process.
+TEST_F(TranslationCacheTest, BackingDirectory)
+{
+    std::string directory = angle::GetExecutableDirectory();
+    ConfigureTranslationCache(1024 * 1024, directory);
+
+    const char *shaderStrings[] = {kFragmentShader};
+    TranslationKey key          = TranslationCache::ComputeKey(shaderStrings, 1, "test");
+    std::shared_ptr<TranslationResult> result(new TranslationResult());
+    result->objectCode = "translated";
+    cache()->put(key, result, true);
+
+    ClearTranslationCache();
+    std::shared_ptr<const TranslationResult> loaded = cache()->get(key);
+    ASSERT_NE(nullptr, loaded);
+    EXPECT_EQ("translated", loaded->objectCode);
+    EXPECT_EQ(1u, cache()->getHitCount());
+
+    // Results marked as not persistent stay in memory.
+    TranslationKey otherKey = TranslationCache::ComputeKey(shaderStrings, 1, "other");
+    cache()->put(otherKey, result, false);
+    ClearTranslationCache();
+    EXPECT_EQ(nullptr, cache()->get(otherKey));
+
+    // A damaged file is discarded.
+    ClearTranslationCache();
+    std::string path = directory + "/";
+    for (uint8_t byte : key)
+    {
+        char hex[3];
+        snprintf(hex, sizeof(hex), "%02x", byte);
+        path += hex;
+    }
+    path += ".angletr";
+    FILE *file = fopen(path.c_str(), "r+b");
+    ASSERT_NE(nullptr, file);
+    fseek(file, -1, SEEK_END);
+    fputc('X', file);
+    fclose(file);
+
+    EXPECT_EQ(nullptr, cache()->get(key));
+    EXPECT_EQ(nullptr, fopen(path.c_str(), "rb"));
+
+    ConfigureTranslationCache(1024 * 1024, "");
+}
+
+}  // anonymous namespace
+
+}  // namespace sh
@@ -0,0 +1,127 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// TreePassManager_test.cpp:
+//   Tests that AST passes sharing a walk over the tree give the same results as running them one
+//   after the other.
+//
+
+#include "GLSLANG/ShaderLang.h"
+#include "angle_gl.h"
+#include "compiler/translator/Compiler.h"
+#include "gtest/gtest.h"
+#include "tests/test_utils/compiler_test.h"
+
+using namespace sh;
+
+namespace
+{
+
+constexpr ShCompileOptions kLoopWorkarounds =
+    SH_REWRITE_DO_WHILE_LOOPS | SH_ADD_AND_TRUE_TO_LOOP_CONDITION | SH_UNFOLD_SHORT_CIRCUIT;
+
+class TreePassManagerTest : public MatchOutputCodeTest
+{
+  public:
+    TreePassManagerTest()
+        : MatchOutputCodeTest(GL_FRAGMENT_SHADER, kLoopWorkarounds, SH_GLSL_330_CORE_OUTPUT)
+    {
+    }
+};
+
+// The loop that replaces the do-while gets "&& true" added to its condition, and both that and the
+// short circuit in the do-while condition are unfolded.
+TEST_F(TreePassManagerTest, DoWhileWithShortCircuitCondition)
+{
+    const std::string &shaderString =
+        R"(#version 300 es
+        precision highp float;
+
+        out vec4 color;
+        uniform bool b;
+        uniform bool b2;
+
+        void main()
+        {
+            color = vec4(0, 0, 0, 1);
+            do
+            {
+                color.x += 0.1;
+            } while (b && b2);
+        })";
+    compile(shaderString);
+    ASSERT_TRUE(notFoundInCode("do"));
+    ASSERT_TRUE(notFoundInCode("&&"));
+    ASSERT_TRUE(foundInCode("while (((true) ? (true) : (false)))"));
+    ASSERT_TRUE(foundInCode("(_ub) ? (_ub2) : (false)"));
+}
+
+// Short circuits nested in a loop condition are all unfolded, including the one added to the
+// condition in the same walk.
+TEST_F(TreePassManagerTest, NestedShortCircuitInLoopCondition)
+{
+    const std::string &shaderString =
+        R"(#version 300 es
+        precision highp float;
+
+        out vec4 color;
+        uniform bool b;
+        uniform bool b2;
+        uniform bool b3;
+
+        void main()
+        {
+            color = vec4(0, 0, 0, 1);
+            while (b || (b2 && b3))
+            {
+                color.x += 0.1;
+            }
+        })";
+    compile(shaderString);
+    ASSERT_TRUE(notFoundInCode("&&"));
+    ASSERT_TRUE(notFoundInCode("||"));
+    ASSERT_TRUE(
+        foundInCode("(((_ub) ? (true) : (((_ub2) ? (_ub3) : (false))))) ? (true) : (false)"));
+}
+
+// The workaround passes share one walk, as do marking built-ins for emulation and collecting
+// variables.
+TEST(TreePassManagerCountTest, WorkaroundsShareWalk)
+{
+    ShBuiltInResources resources;
+    sh::InitBuiltInResources(&resources);
+
+    ShHandle handle =
+        sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES3_SPEC, SH_ESSL_OUTPUT, &resources);
+    ASSERT_NE(nullptr, handle);
+    TCompiler *compiler = static_cast<TShHandleBase *>(handle)->getAsCompiler();
+
+    const char *shaderStrings[] = {
+        R"(#version 300 es
+        precision highp float;
+        out vec4 color;
+        uniform bool b;
+        void main()
+        {
+            color = vec4(0);
+            do
+            {
+                color.x += 0.1;
+            } while (b && color.x < 0.5);
+        })"};
+
+    ASSERT_TRUE(sh::Compile(handle, shaderStrings, 1, SH_OBJECT_CODE | SH_VARIABLES));
+    size_t passCount = compiler->getTreePassCount();
+    size_t walkCount = compiler->getTreeWalkCount();
+
+    ASSERT_TRUE(
+        sh::Compile(handle, shaderStrings, 1, SH_OBJECT_CODE | SH_VARIABLES | kLoopWorkarounds));
+    EXPECT_EQ(passCount + 3u, compiler->getTreePassCount());
+    EXPECT_EQ(walkCount + 1u, compiler->getTreeWalkCount());
+
+    sh::Destruct(handle);
+}
+
+}  // anonymous namespace
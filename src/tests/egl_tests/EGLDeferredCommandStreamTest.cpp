@@ -0,0 +1,266 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// EGLDeferredCommandStreamTest:
+//   Tests of contexts created with EGL_ANGLE_deferred_command_stream, whose calls are recorded
+//   and replayed on a thread owned by the context.
+
+#include <algorithm>
+#include <atomic>
+
+#include "test_utils/ANGLETest.h"
+#include "test_utils/gl_raii.h"
+
+using namespace angle;
+
+namespace
+{
+constexpr char kEGLExtName[] = "EGL_ANGLE_deferred_command_stream";
+
+void GL_APIENTRY CountMessages(GLenum source,
+                               GLenum type,
+                               GLuint id,
+                               GLenum severity,
+                               GLsizei length,
+                               const GLchar *message,
+                               const void *userParam)
+{
+    // Deferred calls report their errors from the context's thread.
+    if (type == GL_DEBUG_TYPE_ERROR)
+    {
+        std::atomic<int> *count = static_cast<std::atomic<int> *>(const_cast<void *>(userParam));
+        ++(*count);
+    }
+}
+}  // anonymous namespace
+
+class EGLDeferredCommandStreamTest : public ANGLETest
+{
+  protected:
+    EGLDeferredCommandStreamTest() { setDeferContextInit(true); }
+
+    void SetUp() override
+    {
+        ANGLETestBase::ANGLETestSetUp();
+
+        if (extensionAvailable())
+        {
+            setDeferredCommandStreamEnabled(true);
+        }
+
+        ASSERT_TRUE(getEGLWindow()->initializeContext());
+    }
+
+    void TearDown() override { ANGLETestBase::ANGLETestTearDown(); }
+
+    bool extensionAvailable()
+    {
+        EGLDisplay display = getEGLWindow()->getDisplay();
+        return eglDisplayExtensionEnabled(display, kEGLExtName);
+    }
+
+    // Counts the errors reported through debug output. The count is only stable once the stream
+    // is drained.
+    void countDebugMessages()
+    {
+        glDebugMessageCallbackKHR(CountMessages, &mMessageCount);
+        glEnable(GL_DEBUG_OUTPUT);
+        ASSERT_GL_NO_ERROR();
+        mMessageCount = 0;
+    }
+
+    std::atomic<int> mMessageCount{0};
+};
+
+// Tests that glGetError reports the error of a deferred invalid call.
+TEST_P(EGLDeferredCommandStreamTest, GetErrorAfterDeferredInvalidCall)
+{
+    ANGLE_SKIP_TEST_IF(!extensionAvailable());
+
+    glEnable(GL_TEXTURE_2D);
+    EXPECT_GL_ERROR(GL_INVALID_ENUM);
+
+    // The error is only reported once, and later deferred calls don't report it again.
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_ONE, GL_ONE);
+    EXPECT_GL_NO_ERROR();
+    EXPECT_TRUE(glIsEnabled(GL_BLEND));
+
+    // Errors of several queued calls are all reported.
+    glEnable(GL_TEXTURE_2D);
+    glBlendEquation(GL_ZERO);
+    glLineWidth(-1.0f);
+    GLenum errors[3] = {glGetError(), glGetError(), glGetError()};
+    std::sort(std::begin(errors), std::end(errors));
+    EXPECT_GLENUM_EQ(GL_NO_ERROR, errors[0]);
+    EXPECT_GLENUM_EQ(GL_INVALID_ENUM, errors[1]);
+    EXPECT_GLENUM_EQ(GL_INVALID_VALUE, errors[2]);
+}
+
+// Tests that a call taking a pointer sees the bindings made by the deferred calls before it.
+TEST_P(EGLDeferredCommandStreamTest, DeferredBindThenPointerCall)
+{
+    ANGLE_SKIP_TEST_IF(!extensionAvailable());
+
+    GLBuffer buffer;
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+
+    constexpr GLfloat kData[] = {0.0f, 1.0f, 2.0f, 3.0f};
+    glBufferData(GL_ARRAY_BUFFER, sizeof(kData), kData, GL_STATIC_DRAW);
+    ASSERT_GL_NO_ERROR();
+
+    GLint size = 0;
+    glGetBufferParameteriv(GL_ARRAY_BUFFER, GL_BUFFER_SIZE, &size);
+    EXPECT_EQ(static_cast<GLint>(sizeof(kData)), size);
+
+    // Buffer offsets are recorded as pointers, and must use the buffer bound just before.
+    GLBuffer otherBuffer;
+    glBindBuffer(GL_ARRAY_BUFFER, otherBuffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(kData), nullptr, GL_STATIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, 0, reinterpret_cast<const void *>(4));
+    ASSERT_GL_NO_ERROR();
+
+    GLint binding = 0;
+    glGetVertexAttribiv(0, GL_VERTEX_ATTRIB_ARRAY_BUFFER_BINDING, &binding);
+    EXPECT_EQ(static_cast<GLint>(buffer.get()), binding);
+
+    // Same for textures.
+    GLTexture texture;
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, &GLColor::red);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    ASSERT_GL_NO_ERROR();
+
+    GLint minFilter = 0;
+    glGetTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, &minFilter);
+    EXPECT_EQ(GL_NEAREST, minFilter);
+}
+
+// Tests that a context lost by a deferred call rejects the calls queued after it, and later calls.
+TEST_P(EGLDeferredCommandStreamTest, ContextLossWithQueuedCalls)
+{
+    ANGLE_SKIP_TEST_IF(!extensionAvailable());
+
+    // ANGLE_framebuffer_multisample reports GL_OUT_OF_MEMORY for a sample count the format
+    // doesn't support in ES 3 contexts, which loses contexts that lose on reset. That is the only
+    // way to lose a context from a deferred call without a device reset.
+    ANGLE_SKIP_TEST_IF(getClientMajorVersion() < 3);
+    ANGLE_SKIP_TEST_IF(!extensionEnabled("GL_ANGLE_framebuffer_multisample"));
+
+    EGLWindow *window  = getEGLWindow();
+    EGLDisplay display = window->getDisplay();
+    ANGLE_SKIP_TEST_IF(!eglDisplayExtensionEnabled(display, "EGL_EXT_create_context_robustness"));
+
+    GLint maxSamples = 0;
+    glGetIntegerv(GL_MAX_SAMPLES, &maxSamples);
+
+    GLenum unsupportedFormat = GL_NONE;
+    for (GLenum format : {GL_RGBA8UI, GL_RGBA16UI, GL_RGBA32UI, GL_RGBA32I})
+    {
+        GLint numSampleCounts = 0;
+        glGetInternalformativ(GL_RENDERBUFFER, format, GL_NUM_SAMPLE_COUNTS, 1, &numSampleCounts);
+        GLint formatMaxSamples = 0;
+        if (numSampleCounts > 0)
+        {
+            glGetInternalformativ(GL_RENDERBUFFER, format, GL_SAMPLES, 1, &formatMaxSamples);
+        }
+        if (formatMaxSamples < maxSamples)
+        {
+            unsupportedFormat = format;
+            break;
+        }
+    }
+    ANGLE_SKIP_TEST_IF(unsupportedFormat == GL_NONE);
+
+    const EGLint contextAttributes[] = {
+        EGL_CONTEXT_MAJOR_VERSION_KHR,
+        getClientMajorVersion(),
+        EGL_CONTEXT_OPENGL_RESET_NOTIFICATION_STRATEGY_EXT,
+        EGL_LOSE_CONTEXT_ON_RESET_EXT,
+        EGL_CONTEXT_DEFERRED_COMMAND_STREAM_ANGLE,
+        EGL_TRUE,
+        EGL_NONE,
+    };
+    EGLContext context =
+        eglCreateContext(display, window->getConfig(), EGL_NO_CONTEXT, contextAttributes);
+    ASSERT_NE(EGL_NO_CONTEXT, context);
+    ASSERT_EGL_TRUE(eglMakeCurrent(display, window->getSurface(), window->getSurface(), context));
+
+    GLuint renderbuffer = 0;
+    glGenRenderbuffers(1, &renderbuffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, renderbuffer);
+    glRenderbufferStorageMultisampleANGLE(GL_RENDERBUFFER, maxSamples, unsupportedFormat, 1, 1);
+
+    // Queued behind the call that loses the context.
+    for (int iteration = 0; iteration < 100; ++iteration)
+    {
+        glClearColor(1.0f, 0.0f, 0.0f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        glEnable(GL_BLEND);
+    }
+
+    EXPECT_GL_ERROR(GL_OUT_OF_MEMORY);
+    EXPECT_GL_NO_ERROR();
+
+    // Calls made once the context is lost are rejected right away.
+    glEnable(GL_BLEND);
+    EXPECT_GL_ERROR(GL_OUT_OF_MEMORY);
+    EXPECT_GL_FALSE(glIsEnabled(GL_BLEND));
+    EXPECT_GL_ERROR(GL_OUT_OF_MEMORY);
+
+    EXPECT_EGL_TRUE(
+        eglMakeCurrent(display, window->getSurface(), window->getSurface(), window->getContext()));
+    EXPECT_EGL_TRUE(eglDestroyContext(display, context));
+    EXPECT_EGL_SUCCESS();
+}
+
+// Tests that eglMakeCurrent and eglSwapBuffers return once the calls recorded before them ran.
+TEST_P(EGLDeferredCommandStreamTest, MakeCurrentAndSwapBuffersDrainStream)
+{
+    ANGLE_SKIP_TEST_IF(!extensionAvailable());
+    ANGLE_SKIP_TEST_IF(!extensionEnabled("GL_KHR_debug"));
+
+    EGLWindow *window  = getEGLWindow();
+    EGLDisplay display = window->getDisplay();
+    EGLSurface surface = window->getSurface();
+    EGLContext context = window->getContext();
+
+    countDebugMessages();
+
+    glEnable(GL_TEXTURE_2D);
+    EXPECT_EGL_TRUE(eglSwapBuffers(display, surface));
+    EXPECT_EQ(1, mMessageCount.load());
+
+    glEnable(GL_TEXTURE_2D);
+    EXPECT_EGL_TRUE(eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT));
+    EXPECT_EQ(2, mMessageCount.load());
+
+    // Calls recorded before switching contexts don't run on the new one.
+    EXPECT_EGL_TRUE(eglMakeCurrent(display, surface, surface, context));
+    glClearColor(0.0f, 1.0f, 0.0f, 1.0f);
+
+    const EGLint contextAttributes[] = {
+        EGL_CONTEXT_MAJOR_VERSION_KHR, getClientMajorVersion(), EGL_NONE,
+    };
+    EGLContext otherContext =
+        eglCreateContext(display, window->getConfig(), EGL_NO_CONTEXT, contextAttributes);
+    ASSERT_NE(EGL_NO_CONTEXT, otherContext);
+    EXPECT_EGL_TRUE(eglMakeCurrent(display, surface, surface, otherContext));
+
+    GLfloat clearColor[4] = {};
+    glGetFloatv(GL_COLOR_CLEAR_VALUE, clearColor);
+    EXPECT_EQ(0.0f, clearColor[1]);
+
+    EXPECT_EGL_TRUE(eglMakeCurrent(display, surface, surface, context));
+    glGetFloatv(GL_COLOR_CLEAR_VALUE, clearColor);
+    EXPECT_EQ(1.0f, clearColor[1]);
+
+    EXPECT_EGL_TRUE(eglDestroyContext(display, otherContext));
+    EXPECT_GL_NO_ERROR();
+    EXPECT_EQ(2, mMessageCount.load());
+}
+
+ANGLE_INSTANTIATE_TEST(EGLDeferredCommandStreamTest, ES2_NULL(), ES3_NULL(), ES2_VULKAN());
@@ -7,6 +7,9 @@
 //   Tests for ETC lossy decode formats.
 //
 
+#include <algorithm>
+#include <vector>
+
 #include "test_utils/ANGLETest.h"
 
 using namespace angle;
@@ -42,6 +45,17 @@ class ETCTextureTest : public ANGLETest
         ANGLETest::TearDown();
     }
 
+    // The lossy EAC formats are only listed where the device can sample their BC4 and BC5 form.
+    bool isCompressedFormatListed(GLenum format)
+    {
+        GLint numFormats = 0;
+        glGetIntegerv(GL_NUM_COMPRESSED_TEXTURE_FORMATS, &numFormats);
+        std::vector<GLint> formats(numFormats);
+        glGetIntegerv(GL_COMPRESSED_TEXTURE_FORMATS, formats.data());
+        return std::find(formats.begin(), formats.end(), static_cast<GLint>(format)) !=
+               formats.end();
+    }
+
     GLuint mTexture;
 };
 
@@ -260,6 +274,138 @@ TEST_P(ETCTextureTest, ETC2SRGB8A1Validation)
     }
 }
 
+// Tests a texture with EAC R11 lossy decode format
+TEST_P(ETCTextureTest, EACR11Validation)
+{
+    bool supported = extensionEnabled("GL_ANGLE_lossy_etc_decode") &&
+                     isCompressedFormatListed(GL_COMPRESSED_R11_LOSSY_DECODE_EAC_ANGLE);
+
+    glBindTexture(GL_TEXTURE_2D, mTexture);
+
+    GLubyte pixel[] = {
+        0x80, 0x98, 0x59, 0x02, 0x6e, 0xe7, 0x44, 0x47,  // Multiplier 9, table 8
+        0xeb, 0x05, 0x68, 0x30, 0x77, 0x73, 0x44, 0x44,  // Multiplier 0
+        0x00, 0x1f, 0xab, 0x92, 0xf8, 0x8c, 0x07, 0x73,  // Base codeword 0
+        0xff, 0xf0, 0x15, 0xba, 0x8a, 0x8c, 0xd5, 0x5f   // Base codeword 255
+    };
+    glCompressedTexImage2D(GL_TEXTURE_2D, 0, GL_COMPRESSED_R11_LOSSY_DECODE_EAC_ANGLE, 8, 8, 0,
+                           sizeof(pixel), pixel);
+    if (supported)
+    {
+        EXPECT_GL_NO_ERROR();
+
+        glCompressedTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 8, 8,
+                                  GL_COMPRESSED_R11_LOSSY_DECODE_EAC_ANGLE, sizeof(pixel), pixel);
+        EXPECT_GL_NO_ERROR();
+
+        const GLsizei imageSize = 8;
+
+        glCompressedTexImage2D(GL_TEXTURE_2D, 1, GL_COMPRESSED_R11_LOSSY_DECODE_EAC_ANGLE, 4, 4, 0,
+                               imageSize, pixel);
+        EXPECT_GL_NO_ERROR();
+
+        glCompressedTexImage2D(GL_TEXTURE_2D, 2, GL_COMPRESSED_R11_LOSSY_DECODE_EAC_ANGLE, 2, 2, 0,
+                               imageSize, pixel);
+        EXPECT_GL_NO_ERROR();
+
+        glCompressedTexImage2D(GL_TEXTURE_2D, 3, GL_COMPRESSED_R11_LOSSY_DECODE_EAC_ANGLE, 1, 1, 0,
+                               imageSize, pixel);
+        EXPECT_GL_NO_ERROR();
+    }
+    else
+    {
+        EXPECT_GL_ERROR(GL_INVALID_ENUM);
+    }
+}
+
+// Tests a texture with EAC RG11 lossy decode format
+TEST_P(ETCTextureTest, EACRG11Validation)
+{
+    bool supported = extensionEnabled("GL_ANGLE_lossy_etc_decode") &&
+                     isCompressedFormatListed(GL_COMPRESSED_RG11_LOSSY_DECODE_EAC_ANGLE);
+
+    glBindTexture(GL_TEXTURE_2D, mTexture);
+
+    GLubyte pixel[] = {
+        0x80, 0x98, 0x59, 0x02, 0x6e, 0xe7, 0x44, 0x47,  // R, multiplier 9, table 8
+        0xeb, 0x05, 0x68, 0x30, 0x77, 0x73, 0x44, 0x44,  // G, multiplier 0
+        0x00, 0x1f, 0xab, 0x92, 0xf8, 0x8c, 0x07, 0x73,  // R, base codeword 0
+        0xff, 0xf0, 0x15, 0xba, 0x8a, 0x8c, 0xd5, 0x5f   // G, base codeword 255
+    };
+    glCompressedTexImage2D(GL_TEXTURE_2D, 0, GL_COMPRESSED_RG11_LOSSY_DECODE_EAC_ANGLE, 4, 8, 0,
+                           sizeof(pixel), pixel);
+    if (supported)
+    {
+        EXPECT_GL_NO_ERROR();
+
+        glCompressedTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 4, 8,
+                                  GL_COMPRESSED_RG11_LOSSY_DECODE_EAC_ANGLE, sizeof(pixel), pixel);
+        EXPECT_GL_NO_ERROR();
+
+        const GLsizei imageSize = 16;
+
+        glCompressedTexImage2D(GL_TEXTURE_2D, 1, GL_COMPRESSED_RG11_LOSSY_DECODE_EAC_ANGLE, 2, 4, 0,
+                               imageSize, pixel);
+        EXPECT_GL_NO_ERROR();
+
+        glCompressedTexImage2D(GL_TEXTURE_2D, 2, GL_COMPRESSED_RG11_LOSSY_DECODE_EAC_ANGLE, 1, 2, 0,
+                               imageSize, pixel);
+        EXPECT_GL_NO_ERROR();
+
+        glCompressedTexImage2D(GL_TEXTURE_2D, 3, GL_COMPRESSED_RG11_LOSSY_DECODE_EAC_ANGLE, 1, 1, 0,
+                               imageSize, pixel);
+        EXPECT_GL_NO_ERROR();
+    }
+    else
+    {
+        EXPECT_GL_ERROR(GL_INVALID_ENUM);
+    }
+}
+
+// Tests a texture with ETC2 RGBA8 lossy decode format
+TEST_P(ETCTextureTest, ETC2RGBA8Validation)
+{
+    bool supported = extensionEnabled("GL_ANGLE_lossy_etc_decode");
+
+    glBindTexture(GL_TEXTURE_2D, mTexture);
+
+    GLubyte pixel[] = {
+        0x80, 0x98, 0x59, 0x02, 0x6e, 0xe7, 0x44, 0x47,  // EAC alpha block
+        0x00, 0x00, 0xf8, 0x02, 0x43, 0xff, 0x04, 0x12,  // Individual/differential block
+        0xeb, 0x05, 0x68, 0x30, 0x77, 0x73, 0x44, 0x44,  // EAC alpha block
+        0x71, 0x88, 0xfb, 0xee, 0x87, 0x07, 0x11, 0x1f   // Planar block
+    };
+    glCompressedTexImage2D(GL_TEXTURE_2D, 0, GL_COMPRESSED_RGBA8_LOSSY_DECODE_ETC2_EAC_ANGLE, 4, 8,
+                           0, sizeof(pixel), pixel);
+    if (supported)
+    {
+        EXPECT_GL_NO_ERROR();
+
+        glCompressedTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 4, 8,
+                                  GL_COMPRESSED_RGBA8_LOSSY_DECODE_ETC2_EAC_ANGLE, sizeof(pixel),
+                                  pixel);
+        EXPECT_GL_NO_ERROR();
+
+        const GLsizei imageSize = 16;
+
+        glCompressedTexImage2D(GL_TEXTURE_2D, 1, GL_COMPRESSED_RGBA8_LOSSY_DECODE_ETC2_EAC_ANGLE, 2,
+                               4, 0, imageSize, pixel);
+        EXPECT_GL_NO_ERROR();
+
+        glCompressedTexImage2D(GL_TEXTURE_2D, 2, GL_COMPRESSED_RGBA8_LOSSY_DECODE_ETC2_EAC_ANGLE, 1,
+                               2, 0, imageSize, pixel);
+        EXPECT_GL_NO_ERROR();
+
+        glCompressedTexImage2D(GL_TEXTURE_2D, 3, GL_COMPRESSED_RGBA8_LOSSY_DECODE_ETC2_EAC_ANGLE, 1,
+                               1, 0, imageSize, pixel);
+        EXPECT_GL_NO_ERROR();
+    }
+    else
+    {
+        EXPECT_GL_ERROR(GL_INVALID_ENUM);
+    }
+}
+
 ANGLE_INSTANTIATE_TEST(ETCTextureTest,
                        ES2_D3D9(),
                        ES2_D3D11(),
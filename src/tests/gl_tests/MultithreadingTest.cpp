@@ -9,8 +9,10 @@
 
 #include "test_utils/gl_raii.h"
 
+#include <array>
 #include <mutex>
 #include <thread>
+#include <vector>
 
 namespace angle
 {
@@ -154,12 +156,133 @@ TEST_P(MultithreadingTest, MakeCurrentMultiContext)
     }
 }
 
-// TODO(geofflang): Test sharing a program between multiple shared contexts on multiple threads
+// Test that contexts in one share group can create, upload to and draw with shared objects from
+// many threads at once, without the application serializing its calls
+TEST_P(MultithreadingTest, SharedContextUploadAndDraw)
+{
+    // Only the null back-end is safe to call from several threads at once.
+    ANGLE_SKIP_TEST_IF(!IsNULL());
+
+    constexpr char kVS[] =
+        "attribute vec2 a_position;\n"
+        "varying vec2 v_texCoord;\n"
+        "void main()\n"
+        "{\n"
+        "    gl_Position = vec4(a_position, 0.0, 1.0);\n"
+        "    v_texCoord = a_position * 0.5 + 0.5;\n"
+        "}\n";
+
+    constexpr char kFS[] =
+        "precision mediump float;\n"
+        "uniform sampler2D u_texture;\n"
+        "varying vec2 v_texCoord;\n"
+        "void main()\n"
+        "{\n"
+        "    gl_FragColor = texture2D(u_texture, v_texCoord);\n"
+        "}\n";
+
+    constexpr size_t kThreadCount         = 8;
+    constexpr size_t kIterationsPerThread = 64;
+    constexpr GLsizei kTextureSize        = 16;
+    constexpr EGLint kPBufferSize         = 64;
+
+    EGLWindow *window  = getEGLWindow();
+    EGLDisplay dpy     = window->getDisplay();
+    EGLConfig config   = window->getConfig();
+    EGLContext mainCtx = window->getContext();
+
+    // The program and one texture are shared by every thread. Each thread also creates and deletes
+    // its own objects in the shared managers.
+    ANGLE_GL_PROGRAM(program, kVS, kFS);
+    GLint positionLocation = glGetAttribLocation(program, "a_position");
+    ASSERT_NE(-1, positionLocation);
+
+    GLTexture sharedTexture;
+    glBindTexture(GL_TEXTURE_2D, sharedTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, kTextureSize, kTextureSize, 0, GL_RGBA,
+                 GL_UNSIGNED_BYTE, nullptr);
+    ASSERT_GL_NO_ERROR();
+
+    // Make sure the shared objects are visible to the other contexts.
+    glFinish();
+
+    std::array<std::thread, kThreadCount> threads;
+    for (size_t thread = 0; thread < kThreadCount; thread++)
+    {
+        threads[thread] = std::thread([&, thread]() {
+            EGLint pbufferAttributes[] = {EGL_WIDTH, kPBufferSize, EGL_HEIGHT, kPBufferSize,
+                                          EGL_NONE};
+            EGLSurface pbuffer = eglCreatePbufferSurface(dpy, config, pbufferAttributes);
+            EXPECT_EGL_SUCCESS();
+
+            EGLContext ctx = window->createContext(mainCtx);
+            EXPECT_NE(EGL_NO_CONTEXT, ctx);
+
+            EXPECT_EGL_TRUE(eglMakeCurrent(dpy, pbuffer, pbuffer, ctx));
+            EXPECT_EGL_SUCCESS();
+
+            const GLColor color(static_cast<GLubyte>(thread), 0, 0, 255);
+            std::vector<GLColor> pixels(kTextureSize * kTextureSize, color);
+            const GLfloat vertices[] = {-1.0f, -1.0f, 1.0f, -1.0f, 0.0f, 1.0f};
+
+            glUseProgram(program);
+            glViewport(0, 0, kPBufferSize, kPBufferSize);
+
+            for (size_t iteration = 0; iteration < kIterationsPerThread; iteration++)
+            {
+                // Every thread writes to the shared texture.
+                glBindTexture(GL_TEXTURE_2D, sharedTexture);
+                glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, kTextureSize, kTextureSize, GL_RGBA,
+                                GL_UNSIGNED_BYTE, pixels.data());
+
+                GLuint texture = 0;
+                glGenTextures(1, &texture);
+                glBindTexture(GL_TEXTURE_2D, texture);
+                glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, kTextureSize, kTextureSize, 0, GL_RGBA,
+                             GL_UNSIGNED_BYTE, pixels.data());
+                glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+
+                GLuint buffer = 0;
+                glGenBuffers(1, &buffer);
+                glBindBuffer(GL_ARRAY_BUFFER, buffer);
+                glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+                glVertexAttribPointer(positionLocation, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+                glEnableVertexAttribArray(positionLocation);
+
+                glDrawArrays(GL_TRIANGLES, 0, 3);
+
+                glDeleteBuffers(1, &buffer);
+                glDeleteTextures(1, &texture);
+                EXPECT_GL_NO_ERROR();
+            }
+
+            glFinish();
+            EXPECT_GL_NO_ERROR();
+
+            EXPECT_EGL_TRUE(eglMakeCurrent(dpy, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT));
+            EXPECT_EGL_SUCCESS();
+
+            eglDestroySurface(dpy, pbuffer);
+            eglDestroyContext(dpy, ctx);
+        });
+    }
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    // The shared objects outlive the contexts that used them.
+    EXPECT_GL_TRUE(glIsProgram(program));
+    EXPECT_GL_TRUE(glIsTexture(sharedTexture));
+    EXPECT_GL_NO_ERROR();
+}
 
 ANGLE_INSTANTIATE_TEST(MultithreadingTest,
                        ES2_OPENGL(),
                        ES3_OPENGL(),
                        ES2_OPENGLES(),
-                       ES3_OPENGLES());
+                       ES3_OPENGLES(),
+                       ES2_NULL());
 
 }  // namespace angle
@@ -0,0 +1,180 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ParallelShaderCompileTest:
+//   Tests for GL_KHR_parallel_shader_compile.
+//
+
+#include "test_utils/ANGLETest.h"
+
+#include "test_utils/gl_raii.h"
+
+using namespace angle;
+
+namespace
+{
+
+class ParallelShaderCompileTest : public ANGLETest
+{
+  protected:
+    ParallelShaderCompileTest()
+    {
+        setWindowWidth(128);
+        setWindowHeight(128);
+        setConfigRedBits(8);
+        setConfigGreenBits(8);
+        setConfigBlueBits(8);
+        setConfigAlphaBits(8);
+    }
+
+    // Links the program and polls the completion status before touching anything else.
+    GLuint linkAndWait(GLuint vs, GLuint fs)
+    {
+        GLuint program = glCreateProgram();
+        glAttachShader(program, vs);
+        glAttachShader(program, fs);
+        glLinkProgram(program);
+
+        GLint completed = GL_FALSE;
+        while (completed == GL_FALSE)
+        {
+            glGetProgramiv(program, GL_COMPLETION_STATUS_KHR, &completed);
+        }
+        return program;
+    }
+};
+
+// Test the thread count query.
+TEST_P(ParallelShaderCompileTest, MaxShaderCompilerThreads)
+{
+    ANGLE_SKIP_TEST_IF(!extensionEnabled("GL_KHR_parallel_shader_compile"));
+
+    GLint threads = 0;
+    glMaxShaderCompilerThreadsKHR(4);
+    glGetIntegerv(GL_MAX_SHADER_COMPILER_THREADS_KHR, &threads);
+    EXPECT_GL_NO_ERROR();
+    EXPECT_EQ(4, threads);
+
+    glMaxShaderCompilerThreadsKHR(0);
+    glGetIntegerv(GL_MAX_SHADER_COMPILER_THREADS_KHR, &threads);
+    EXPECT_GL_NO_ERROR();
+    EXPECT_EQ(0, threads);
+}
+
+// Test that a program linked in the background can be used once it completes.
+TEST_P(ParallelShaderCompileTest, LinkAndDraw)
+{
+    ANGLE_SKIP_TEST_IF(!extensionEnabled("GL_KHR_parallel_shader_compile"));
+
+    GLuint vs = CompileShader(GL_VERTEX_SHADER, essl1_shaders::vs::Simple());
+    GLuint fs = CompileShader(GL_FRAGMENT_SHADER, essl1_shaders::fs::Red());
+    ASSERT_NE(0u, vs);
+    ASSERT_NE(0u, fs);
+
+    GLuint program = linkAndWait(vs, fs);
+    glDeleteShader(vs);
+    glDeleteShader(fs);
+
+    GLint linked = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &linked);
+    EXPECT_GL_TRUE(linked);
+
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(getWindowWidth() / 2, getWindowHeight() / 2, GLColor::red);
+
+    glDeleteProgram(program);
+    EXPECT_GL_NO_ERROR();
+}
+
+// Test that several shaders compiled in the background all complete.
+TEST_P(ParallelShaderCompileTest, CompileShaders)
+{
+    ANGLE_SKIP_TEST_IF(!extensionEnabled("GL_KHR_parallel_shader_compile"));
+
+    constexpr size_t kShaderCount = 8;
+    std::vector<GLuint> shaders;
+    for (size_t index = 0; index < kShaderCount; ++index)
+    {
+        const char *source = essl1_shaders::fs::Red();
+        GLuint shader      = glCreateShader(GL_FRAGMENT_SHADER);
+        glShaderSource(shader, 1, &source, nullptr);
+        glCompileShader(shader);
+        shaders.push_back(shader);
+    }
+
+    for (GLuint shader : shaders)
+    {
+        GLint completed = GL_FALSE;
+        while (completed == GL_FALSE)
+        {
+            glGetShaderiv(shader, GL_COMPLETION_STATUS_KHR, &completed);
+        }
+
+        GLint compiled = GL_FALSE;
+        glGetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+        EXPECT_GL_TRUE(compiled);
+        glDeleteShader(shader);
+    }
+    EXPECT_GL_NO_ERROR();
+}
+
+// Test that changing a shader after starting a link does not affect the link.
+TEST_P(ParallelShaderCompileTest, RecompileShaderDuringLink)
+{
+    ANGLE_SKIP_TEST_IF(!extensionEnabled("GL_KHR_parallel_shader_compile"));
+
+    GLuint vs = CompileShader(GL_VERTEX_SHADER, essl1_shaders::vs::Simple());
+    GLuint fs = CompileShader(GL_FRAGMENT_SHADER, essl1_shaders::fs::Red());
+    ASSERT_NE(0u, vs);
+    ASSERT_NE(0u, fs);
+
+    GLuint program = glCreateProgram();
+    glAttachShader(program, vs);
+    glAttachShader(program, fs);
+    glLinkProgram(program);
+
+    const char *badSource = "invalid";
+    glShaderSource(fs, 1, &badSource, nullptr);
+    glCompileShader(fs);
+
+    GLint linked = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &linked);
+    EXPECT_GL_TRUE(linked);
+
+    glDeleteShader(vs);
+    glDeleteShader(fs);
+    glDeleteProgram(program);
+    EXPECT_GL_NO_ERROR();
+}
+
+// Test that deleting a program with a pending link is safe.
+TEST_P(ParallelShaderCompileTest, DeleteDuringLink)
+{
+    ANGLE_SKIP_TEST_IF(!extensionEnabled("GL_KHR_parallel_shader_compile"));
+
+    GLuint vs = CompileShader(GL_VERTEX_SHADER, essl1_shaders::vs::Simple());
+    GLuint fs = CompileShader(GL_FRAGMENT_SHADER, essl1_shaders::fs::Red());
+    ASSERT_NE(0u, vs);
+    ASSERT_NE(0u, fs);
+
+    GLuint program = glCreateProgram();
+    glAttachShader(program, vs);
+    glAttachShader(program, fs);
+    glLinkProgram(program);
+    glDeleteProgram(program);
+
+    glDeleteShader(vs);
+    glDeleteShader(fs);
+    EXPECT_GL_NO_ERROR();
+}
+
+ANGLE_INSTANTIATE_TEST(ParallelShaderCompileTest,
+                       ES2_D3D9(),
+                       ES2_D3D11(),
+                       ES2_OPENGL(),
+                       ES2_OPENGLES(),
+                       ES2_VULKAN());
+
+}  // namespace
@@ -2039,6 +2039,199 @@ TEST_P(SimpleStateChangeTest, ReleaseShaderInUseThatReadsFromUniforms)
     EXPECT_PIXEL_COLOR_EQ(getWindowWidth() / 2, 0, GLColor::red);
 }
 
+// Tests that the cached draw validation results are updated by the state changes they depend on.
+class ValidationStateChangeTest : public ANGLETest
+{
+  protected:
+    ValidationStateChangeTest()
+    {
+        setWindowWidth(64);
+        setWindowHeight(64);
+        setConfigRedBits(8);
+        setConfigGreenBits(8);
+        setConfigBlueBits(8);
+        setConfigAlphaBits(8);
+    }
+
+    void SetUp() override
+    {
+        ANGLETest::SetUp();
+
+        mProgram = CompileProgram(essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+        ASSERT_NE(0u, mProgram);
+        glUseProgram(mProgram);
+
+        mPositionLocation = glGetAttribLocation(mProgram, essl1_shaders::PositionAttrib());
+        ASSERT_NE(-1, mPositionLocation);
+
+        const std::vector<Vector3> vertices = {{-1.0f, -1.0f, 0.0f}, {1.0f, 1.0f, 0.0f},
+                                               {1.0f, -1.0f, 0.0f},  {-1.0f, -1.0f, 0.0f},
+                                               {1.0f, 1.0f, 0.0f},   {-1.0, 1.0f, 0.0f}};
+        glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(vertices[0]) * vertices.size(), vertices.data(),
+                     GL_STATIC_DRAW);
+        glVertexAttribPointer(mPositionLocation, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
+        glEnableVertexAttribArray(mPositionLocation);
+
+        ASSERT_GL_NO_ERROR();
+    }
+
+    void TearDown() override
+    {
+        glDeleteProgram(mProgram);
+        ANGLETest::TearDown();
+    }
+
+    GLuint mProgram         = 0;
+    GLint mPositionLocation = -1;
+    GLBuffer mVertexBuffer;
+};
+
+// Tests that mapping a vertex buffer after a successful draw makes the next draw fail.
+TEST_P(ValidationStateChangeTest, MapBufferAfterDraw)
+{
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    EXPECT_GL_NO_ERROR();
+
+    glMapBufferRange(GL_ARRAY_BUFFER, 0, 4, GL_MAP_READ_BIT);
+    EXPECT_GL_NO_ERROR();
+
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    glUnmapBuffer(GL_ARRAY_BUFFER);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    EXPECT_GL_NO_ERROR();
+}
+
+// Tests that shrinking a vertex buffer after a successful draw makes the next draw fail.
+TEST_P(ValidationStateChangeTest, ShrinkBufferAfterDraw)
+{
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    EXPECT_GL_NO_ERROR();
+
+    const Vector3 vertices[3] = {};
+    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    EXPECT_GL_NO_ERROR();
+}
+
+// Tests that changing a divisor after a successful draw updates the instance count limit.
+TEST_P(ValidationStateChangeTest, ChangeDivisorAfterDraw)
+{
+    glVertexAttribDivisor(mPositionLocation, 2);
+    glDrawArraysInstanced(GL_TRIANGLES, 0, 3, 12);
+    EXPECT_GL_NO_ERROR();
+
+    glDrawArraysInstanced(GL_TRIANGLES, 0, 3, 13);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    glVertexAttribDivisor(mPositionLocation, 3);
+    glDrawArraysInstanced(GL_TRIANGLES, 0, 3, 13);
+    EXPECT_GL_NO_ERROR();
+}
+
+// Tests that making the framebuffer incomplete after a successful draw makes the next draw fail.
+TEST_P(ValidationStateChangeTest, IncompleteFramebufferAfterDraw)
+{
+    GLTexture texture;
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 16, 16, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+
+    GLFramebuffer framebuffer;
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture, 0);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    EXPECT_GL_NO_ERROR();
+
+    // Redefine the texture with a format that can't be rendered to.
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB9_E5, 16, 16, 0, GL_RGB, GL_FLOAT, nullptr);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    EXPECT_GL_ERROR(GL_INVALID_FRAMEBUFFER_OPERATION);
+
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, 0, 0);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    EXPECT_GL_ERROR(GL_INVALID_FRAMEBUFFER_OPERATION);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    EXPECT_GL_NO_ERROR();
+}
+
+// Tests that unbinding the program after a successful draw makes the next draw fail.
+TEST_P(ValidationStateChangeTest, UnbindProgramAfterDraw)
+{
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    EXPECT_GL_NO_ERROR();
+
+    glUseProgram(0);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    glUseProgram(mProgram);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    EXPECT_GL_NO_ERROR();
+}
+
+class ValidationStateChangeTestES31 : public ValidationStateChangeTest
+{
+};
+
+// Tests that relinking the program into a compute program in a shared context makes the next draw
+// fail, even though nothing changed in the drawing context's own state.
+TEST_P(ValidationStateChangeTestES31, RelinkProgramInSharedContextAfterDraw)
+{
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    EXPECT_GL_NO_ERROR();
+
+    EGLWindow *window      = getEGLWindow();
+    EGLDisplay display     = window->getDisplay();
+    EGLSurface surface     = window->getSurface();
+    EGLContext context     = window->getContext();
+    const EGLint attribs[] = {EGL_CONTEXT_MAJOR_VERSION_KHR, window->getClientMajorVersion(),
+                              EGL_CONTEXT_MINOR_VERSION_KHR, window->getClientMinorVersion(),
+                              EGL_NONE};
+    EGLContext sharedContext = eglCreateContext(display, window->getConfig(), context, attribs);
+    ASSERT_NE(EGL_NO_CONTEXT, sharedContext);
+
+    eglMakeCurrent(display, surface, surface, sharedContext);
+    {
+        const std::string csSource =
+            "#version 310 es\n"
+            "layout(local_size_x=1) in;\n"
+            "void main()\n"
+            "{\n"
+            "}\n";
+
+        GLuint attachedShaders[2] = {};
+        GLsizei attachedCount     = 0;
+        glGetAttachedShaders(mProgram, 2, &attachedCount, attachedShaders);
+        for (GLsizei index = 0; index < attachedCount; ++index)
+        {
+            glDetachShader(mProgram, attachedShaders[index]);
+        }
+
+        GLuint computeShader = CompileShader(GL_COMPUTE_SHADER, csSource);
+        ASSERT_NE(0u, computeShader);
+        glAttachShader(mProgram, computeShader);
+        glLinkProgram(mProgram);
+        glDeleteShader(computeShader);
+
+        GLint linkStatus = GL_FALSE;
+        glGetProgramiv(mProgram, GL_LINK_STATUS, &linkStatus);
+        EXPECT_GL_TRUE(linkStatus);
+    }
+    eglMakeCurrent(display, surface, surface, context);
+    eglDestroyContext(display, sharedContext);
+
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+}
+
 }  // anonymous namespace
 
 ANGLE_INSTANTIATE_TEST(StateChangeTest, ES2_D3D9(), ES2_D3D11(), ES2_OPENGL());
@@ -2054,3 +2247,5 @@ ANGLE_INSTANTIATE_TEST(StateChangeRenderTest,
                        ES2_D3D11_FL9_3());
 ANGLE_INSTANTIATE_TEST(StateChangeTestES3, ES3_D3D11(), ES3_OPENGL());
 ANGLE_INSTANTIATE_TEST(SimpleStateChangeTest, ES2_VULKAN(), ES2_OPENGL());
+ANGLE_INSTANTIATE_TEST(ValidationStateChangeTest, ES3_D3D11(), ES3_OPENGL(), ES3_OPENGLES());
+ANGLE_INSTANTIATE_TEST(ValidationStateChangeTestES31, ES31_D3D11(), ES31_OPENGL(), ES31_OPENGLES());
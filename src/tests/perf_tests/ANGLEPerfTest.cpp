@@ -114,6 +114,8 @@ std::string RenderTestParams::suffix() const
             return "_default";
         case EGL_PLATFORM_ANGLE_TYPE_VULKAN_ANGLE:
             return "_vulkan";
+        case EGL_PLATFORM_ANGLE_TYPE_NULL_ANGLE:
+            return "_null_backend";
         default:
             assert(0);
             return "_unk";
@@ -269,6 +271,14 @@ void ANGLERenderTest::setRobustResourceInit(bool enabled)
     mEGLWindow->setRobustResourceInit(enabled);
 }
 
+void ANGLERenderTest::setDeferredCommandStreamEnabled(bool enabled)
+{
+    mEGLWindow->setDeferredCommandStreamEnabled(enabled);
+
+    // Deferred contexts can't use client arrays.
+    mEGLWindow->setClientArraysEnabled(!enabled);
+}
+
 // static
 EGLWindow *ANGLERenderTest::createEGLWindow(const RenderTestParams &testParams)
 {
@@ -107,6 +107,7 @@ class ANGLERenderTest : public ANGLEPerfTest
 
     void setWebGLCompatibilityEnabled(bool webglCompatibility);
     void setRobustResourceInit(bool enabled);
+    void setDeferredCommandStreamEnabled(bool enabled);
 
   private:
     void SetUp() override;
@@ -9,7 +9,9 @@
 
 #include "ANGLEPerfTest.h"
 
+#include <algorithm>
 #include <iostream>
+#include <limits>
 #include <random>
 #include <sstream>
 
@@ -37,12 +39,17 @@ struct BindingsParams final : public RenderTestParams
 
         numObjects      = 100;
         allocationStyle = EVERY_ITERATION;
+        randomHandles   = false;
     }
 
     std::string suffix() const override;
     size_t numObjects;
     AllocationStyle allocationStyle;
 
+    // Creates the objects by binding random names from the whole handle range instead of
+    // generating them, and binds them in random order.
+    bool randomHandles;
+
     // static parameters
     size_t iterations;
 };
@@ -72,6 +79,11 @@ std::string BindingsParams::suffix() const
             UNREACHABLE();
     }
 
+    if (randomHandles)
+    {
+        strstr << "_random_handles";
+    }
+
     return strstr.str();
 }
 
@@ -101,7 +113,26 @@ void BindingsBenchmark::initializeBenchmark()
     ASSERT_GT(params.iterations, 0u);
 
     mBuffers.resize(params.numObjects, 0);
-    if (params.allocationStyle == AT_INITIALIZATION)
+    if (params.randomHandles)
+    {
+        ASSERT_EQ(AT_INITIALIZATION, params.allocationStyle);
+
+        // Binding a name that was never generated creates the buffer.
+        std::mt19937 generator(0x5EED);
+        std::uniform_int_distribution<GLuint> distribution(1, std::numeric_limits<GLuint>::max());
+        std::generate(mBuffers.begin(), mBuffers.end(),
+                      [&generator, &distribution]() { return distribution(generator); });
+        std::sort(mBuffers.begin(), mBuffers.end());
+        mBuffers.erase(std::unique(mBuffers.begin(), mBuffers.end()), mBuffers.end());
+        std::shuffle(mBuffers.begin(), mBuffers.end(), generator);
+
+        for (GLuint buffer : mBuffers)
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, buffer);
+        }
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+    else if (params.allocationStyle == AT_INITIALIZATION)
     {
         glGenBuffers(static_cast<GLsizei>(mBuffers.size()), mBuffers.data());
         for (size_t bufferIdx = 0; bufferIdx < mBuffers.size(); bufferIdx++)
@@ -192,6 +223,29 @@ BindingsParams OpenGLOrGLESParams(AllocationStyle allocationStyle)
     return params;
 }
 
+// Measures the cost of finding objects among many, without any back-end work.
+BindingsParams ManyObjectsNullParams(bool randomHandles)
+{
+    BindingsParams params;
+    params.eglParameters   = EGLPlatformParameters(EGL_PLATFORM_ANGLE_TYPE_NULL_ANGLE);
+    params.allocationStyle = AT_INITIALIZATION;
+    params.numObjects      = 100000;
+    params.iterations      = 4;
+    params.randomHandles   = randomHandles;
+    return params;
+}
+
+// Measures the cost of finding objects with the small handles most apps use, without any back-end
+// work.
+BindingsParams SmallHandlesNullParams()
+{
+    BindingsParams params;
+    params.eglParameters   = EGLPlatformParameters(EGL_PLATFORM_ANGLE_TYPE_NULL_ANGLE);
+    params.allocationStyle = AT_INITIALIZATION;
+    params.numObjects      = 1000;
+    return params;
+}
+
 TEST_P(BindingsBenchmark, Run)
 {
     run();
@@ -203,6 +257,9 @@ ANGLE_INSTANTIATE_TEST(BindingsBenchmark,
                        D3D9Params(EVERY_ITERATION),
                        D3D9Params(AT_INITIALIZATION),
                        OpenGLOrGLESParams(EVERY_ITERATION),
-                       OpenGLOrGLESParams(AT_INITIALIZATION));
+                       OpenGLOrGLESParams(AT_INITIALIZATION),
+                       SmallHandlesNullParams(),
+                       ManyObjectsNullParams(false),
+                       ManyObjectsNullParams(true));
 
 }  // namespace angle
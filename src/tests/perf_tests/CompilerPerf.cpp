@@ -6,15 +6,23 @@
 // CompilerPerfTest:
 //   Performance test for the shader translator. The test initializes the compiler once and then
 //   compiles the same shader repeatedly. There are different variations of the tests using
-//   different shaders.
+//   different shaders, some with the driver workaround options that rewrite the AST. Each test
+//   also reports how many AST passes a compile ran and how many walks over the tree they took.
+//   CompilerThreadingPerfTest compiles on several threads at once, each with its
+//   own compiler, to measure how translation scales with the number of threads.
+//   CompilerTranslationCachePerfTest measures compiles served from the translation cache, and the
+//   overhead the cache adds to compiles which miss it.
 //
 
 #include "ANGLEPerfTest.h"
 
+#include <thread>
+
 #include "GLSLANG/ShaderLang.h"
 #include "compiler/translator/Compiler.h"
 #include "compiler/translator/InitializeGlobals.h"
 #include "compiler/translator/PoolAlloc.h"
+#include "compiler/translator/TranslationCache.h"
 
 namespace
 {
@@ -162,22 +170,92 @@ void main()
 
 const char *kTrickyESSL300Id = "TrickyESSL300";
 
+// Generated shaders often configure themselves with many #defines and build their code out of
+// nested function-like macros. Most of the time compiling this shader is spent in the preprocessor.
+const char *kMacroHeavyESSL300FragSource = R"(#version 300 es
+precision highp float;
+#define LIGHT_COUNT 4
+#define USE_FOG 1
+#define USE_SPECULAR 1
+#define USE_NORMAL_MAP 0
+#define USE_SHADOWS 0
+#define FOG_DENSITY 0.05
+#define SPECULAR_POWER 32.0
+#define AMBIENT vec3(0.1, 0.1, 0.1)
+#define SATURATE(x) clamp(x, 0.0, 1.0)
+#define SQUARE(x) ((x) * (x))
+#define MAD(a, b, c) ((a) * (b) + (c))
+#define LERP(a, b, t) MAD(t, (b) - (a), a)
+#define LUMA(c) dot(c, vec3(0.299, 0.587, 0.114))
+#define DIFFUSE(n, l) SATURATE(dot(n, l))
+#define HALF_VECTOR(l, v) normalize((l) + (v))
+#define SPECULAR(n, l, v) pow(SATURATE(dot(n, HALF_VECTOR(l, v))), SPECULAR_POWER)
+#define ATTENUATION(d, r) SQUARE(SATURATE(1.0 - SQUARE((d) / (r))))
+#define LIGHT_DIR(i) normalize(uLightPos[i] - vPosition)
+#define LIGHT_DIST(i) length(uLightPos[i] - vPosition)
+#define LIGHT_TERM(i) (uLightColor[i] * ATTENUATION(LIGHT_DIST(i), uLightRadius[i]) * \
+    (DIFFUSE(N, LIGHT_DIR(i)) + float(USE_SPECULAR) * SPECULAR(N, LIGHT_DIR(i), V)))
+#define FOG_FACTOR(d) SATURATE(exp(-SQUARE(FOG_DENSITY * (d))))
+#define APPLY_FOG(c, d) LERP(uFogColor, c, FOG_FACTOR(d))
+#define TONEMAP(c) ((c) / (1.0 + LUMA(c)))
+#define GAMMA(c) pow(c, vec3(1.0 / 2.2))
+in vec3 vPosition;
+in vec3 vNormal;
+uniform vec3 uEyePos;
+uniform vec3 uLightPos[LIGHT_COUNT];
+uniform vec3 uLightColor[LIGHT_COUNT];
+uniform float uLightRadius[LIGHT_COUNT];
+uniform vec3 uFogColor;
+uniform vec3 uAlbedo;
+out vec4 outColor;
+void main()
+{
+    vec3 N = normalize(vNormal);
+    vec3 V = normalize(uEyePos - vPosition);
+    vec3 light = AMBIENT;
+    light += LIGHT_TERM(0);
+    light += LIGHT_TERM(1);
+    light += LIGHT_TERM(2);
+    light += LIGHT_TERM(3);
+    vec3 color = uAlbedo * light;
+#if USE_FOG
+    color = APPLY_FOG(color, length(uEyePos - vPosition));
+#endif
+#if USE_SHADOWS || USE_NORMAL_MAP
+    color = vec3(0.0);
+#endif
+    outColor = vec4(GAMMA(TONEMAP(color)), 1.0);
+})";
+
+const char *kMacroHeavyESSL300Id = "MacroHeavyESSL300";
+
 struct CompilerPerfParameters final : public angle::CompilerParameters
 {
     CompilerPerfParameters(ShShaderOutput output,
                            const char *shaderSource,
-                           const char *shaderSourceId)
-        : angle::CompilerParameters(output), shaderSource(shaderSource)
+                           const char *shaderSourceId,
+                           ShCompileOptions extraCompileOptions = 0,
+                           const char *optionsId = "")
+        : angle::CompilerParameters(output),
+          shaderSource(shaderSource),
+          extraCompileOptions(extraCompileOptions)
     {
         testId = shaderSourceId;
         testId += "_";
         testId += angle::CompilerParameters::str();
+        testId += optionsId;
     }
 
     const char *shaderSource;
+    ShCompileOptions extraCompileOptions;
     std::string testId;
 };
 
+// The driver workarounds that each rewrite the AST in a pass of their own.
+constexpr ShCompileOptions kWorkaroundCompileOptions =
+    SH_REWRITE_DO_WHILE_LOOPS | SH_ADD_AND_TRUE_TO_LOOP_CONDITION | SH_UNFOLD_SHORT_CIRCUIT |
+    SH_REMOVE_POW_WITH_CONSTANT_EXPONENT;
+
 std::ostream &operator<<(std::ostream &stream, const CompilerPerfParameters &p)
 {
     stream << p.testId;
@@ -233,6 +311,13 @@ void CompilerPerfTest::SetUp()
 
 void CompilerPerfTest::TearDown()
 {
+    if (mTranslator)
+    {
+        // The counts are from the last compile, and are the same for every compile of the shader.
+        printResult("tree_passes", mTranslator->getTreePassCount(), "passes", false);
+        printResult("tree_walks", mTranslator->getTreeWalkCount(), "walks", false);
+    }
+
     SafeDelete(mTranslator);
 
     SetGlobalPoolAllocator(nullptr);
@@ -248,7 +333,8 @@ void CompilerPerfTest::step()
     const char *shaderStrings[] = {mTestShader};
 
     ShCompileOptions compileOptions = SH_OBJECT_CODE | SH_VARIABLES |
-                                      SH_INITIALIZE_UNINITIALIZED_LOCALS | SH_INIT_OUTPUT_VARIABLES;
+                                      SH_INITIALIZE_UNINITIALIZED_LOCALS | SH_INIT_OUTPUT_VARIABLES |
+                                      GetParam().extraCompileOptions;
 
     const int kNumIterationsPerStep = 10;
 
@@ -272,21 +358,295 @@ TEST_P(CompilerPerfTest, Run)
     run();
 }
 
+struct CompilerThreadingPerfParameters final : public angle::CompilerParameters
+{
+    CompilerThreadingPerfParameters(ShShaderOutput output,
+                                    unsigned int threadCount,
+                                    ShCompileOptions extraCompileOptions,
+                                    const char *optionsId)
+        : angle::CompilerParameters(output),
+          threadCount(threadCount),
+          extraCompileOptions(extraCompileOptions)
+    {
+        testId = kRealWorldESSL100Id;
+        testId += "_";
+        testId += angle::CompilerParameters::str();
+        testId += "_" + std::to_string(threadCount) + "_threads";
+        testId += optionsId;
+    }
+
+    unsigned int threadCount;
+    ShCompileOptions extraCompileOptions;
+    std::string testId;
+};
+
+std::ostream &operator<<(std::ostream &stream, const CompilerThreadingPerfParameters &p)
+{
+    stream << p.testId;
+    return stream;
+}
+
+class CompilerThreadingPerfTest
+    : public ANGLEPerfTest,
+      public ::testing::WithParamInterface<CompilerThreadingPerfParameters>
+{
+  public:
+    CompilerThreadingPerfTest();
+
+    void step() override;
+
+    void SetUp() override;
+    void TearDown() override;
+
+  private:
+    void compileOnThread(sh::TCompiler *translator);
+
+    ShBuiltInResources mResources;
+    std::vector<sh::TCompiler *> mTranslators;
+};
+
+CompilerThreadingPerfTest::CompilerThreadingPerfTest()
+    : ANGLEPerfTest("CompilerThreadingPerf", GetParam().testId)
+{
+}
+
+void CompilerThreadingPerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    InitializePoolIndex();
+
+    const auto &params = GetParam();
+
+    sh::InitBuiltInResources(&mResources);
+    mResources.FragmentPrecisionHigh = true;
+
+    // Every thread gets its own compiler. Compilers own their pool allocator, so the threads only
+    // share the pages recycled between allocators.
+    for (unsigned int threadIndex = 0; threadIndex < params.threadCount; ++threadIndex)
+    {
+        sh::TCompiler *translator =
+            sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_WEBGL2_SPEC, params.output);
+        if (!translator->Init(mResources))
+        {
+            SafeDelete(translator);
+            abortTest();
+            return;
+        }
+        mTranslators.push_back(translator);
+    }
+}
+
+void CompilerThreadingPerfTest::TearDown()
+{
+    for (sh::TCompiler *translator : mTranslators)
+    {
+        SafeDelete(translator);
+    }
+    mTranslators.clear();
+
+    SetGlobalPoolAllocator(nullptr);
+    FreePoolIndex();
+
+    ANGLEPerfTest::TearDown();
+}
+
+void CompilerThreadingPerfTest::compileOnThread(sh::TCompiler *translator)
+{
+    const char *shaderStrings[] = {kRealWorldESSL100FragSource};
+
+    ShCompileOptions compileOptions = SH_OBJECT_CODE | SH_VARIABLES |
+                                      SH_INITIALIZE_UNINITIALIZED_LOCALS | SH_INIT_OUTPUT_VARIABLES |
+                                      GetParam().extraCompileOptions;
+
+    const int kNumIterationsPerStep = 10;
+
+    for (unsigned int iteration = 0; iteration < kNumIterationsPerStep; ++iteration)
+    {
+        translator->compile(shaderStrings, 1, compileOptions);
+    }
+}
+
+void CompilerThreadingPerfTest::step()
+{
+    // Each step does the same amount of work per thread, so with perfect scaling the time per step
+    // does not depend on the number of threads.
+    std::vector<std::thread> threads;
+    for (sh::TCompiler *translator : mTranslators)
+    {
+        threads.emplace_back(&CompilerThreadingPerfTest::compileOnThread, this, translator);
+    }
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+}
+
+TEST_P(CompilerThreadingPerfTest, Run)
+{
+    run();
+}
+
+enum class TranslationCacheResult
+{
+    Hit,
+    Miss,
+};
+
+struct CompilerTranslationCachePerfParameters final : public angle::CompilerParameters
+{
+    CompilerTranslationCachePerfParameters(ShShaderOutput output, TranslationCacheResult result)
+        : angle::CompilerParameters(output), result(result)
+    {
+        testId = kRealWorldESSL100Id;
+        testId += "_";
+        testId += angle::CompilerParameters::str();
+        testId += (result == TranslationCacheResult::Hit ? "_hit" : "_miss");
+    }
+
+    TranslationCacheResult result;
+    std::string testId;
+};
+
+std::ostream &operator<<(std::ostream &stream, const CompilerTranslationCachePerfParameters &p)
+{
+    stream << p.testId;
+    return stream;
+}
+
+class CompilerTranslationCachePerfTest
+    : public ANGLEPerfTest,
+      public ::testing::WithParamInterface<CompilerTranslationCachePerfParameters>
+{
+  public:
+    CompilerTranslationCachePerfTest();
+
+    void step() override;
+
+    void SetUp() override;
+    void TearDown() override;
+
+  private:
+    ShBuiltInResources mResources;
+    TPoolAllocator mAllocator;
+    sh::TCompiler *mTranslator;
+};
+
+CompilerTranslationCachePerfTest::CompilerTranslationCachePerfTest()
+    : ANGLEPerfTest("CompilerTranslationCachePerf", GetParam().testId)
+{
+}
+
+void CompilerTranslationCachePerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    InitializePoolIndex();
+    mAllocator.push();
+    SetGlobalPoolAllocator(&mAllocator);
+
+    mTranslator = sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_WEBGL2_SPEC, GetParam().output);
+    sh::InitBuiltInResources(&mResources);
+    mResources.FragmentPrecisionHigh = true;
+    if (!mTranslator->Init(mResources))
+    {
+        SafeDelete(mTranslator);
+    }
+
+    sh::TranslationCache::GetInstance()->clear();
+}
+
+void CompilerTranslationCachePerfTest::TearDown()
+{
+    SafeDelete(mTranslator);
+    sh::TranslationCache::GetInstance()->clear();
+
+    SetGlobalPoolAllocator(nullptr);
+    mAllocator.pop();
+
+    FreePoolIndex();
+
+    ANGLEPerfTest::TearDown();
+}
+
+void CompilerTranslationCachePerfTest::step()
+{
+    const char *shaderStrings[] = {kRealWorldESSL100FragSource};
+
+    ShCompileOptions compileOptions = SH_OBJECT_CODE | SH_VARIABLES |
+                                      SH_INITIALIZE_UNINITIALIZED_LOCALS |
+                                      SH_INIT_OUTPUT_VARIABLES | SH_CACHE_TRANSLATION;
+
+    const int kNumIterationsPerStep = 10;
+
+    for (unsigned int iteration = 0; iteration < kNumIterationsPerStep; ++iteration)
+    {
+        // Dropping the cache makes every compile translate the shader and store the result.
+        if (GetParam().result == TranslationCacheResult::Miss)
+        {
+            sh::TranslationCache::GetInstance()->clear();
+        }
+        mTranslator->compile(shaderStrings, 1, compileOptions);
+    }
+}
+
+TEST_P(CompilerTranslationCachePerfTest, Run)
+{
+    run();
+}
+
 ANGLE_INSTANTIATE_TEST(
     CompilerPerfTest,
     CompilerPerfParameters(SH_HLSL_4_1_OUTPUT, kSimpleESSL100FragSource, kSimpleESSL100Id),
     CompilerPerfParameters(SH_HLSL_4_1_OUTPUT, kSimpleESSL300FragSource, kSimpleESSL300Id),
     CompilerPerfParameters(SH_HLSL_4_1_OUTPUT, kRealWorldESSL100FragSource, kRealWorldESSL100Id),
     CompilerPerfParameters(SH_HLSL_4_1_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id),
+    CompilerPerfParameters(SH_HLSL_4_1_OUTPUT, kMacroHeavyESSL300FragSource, kMacroHeavyESSL300Id),
     CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT, kSimpleESSL100FragSource, kSimpleESSL100Id),
     CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT, kSimpleESSL300FragSource, kSimpleESSL300Id),
     CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT,
                            kRealWorldESSL100FragSource,
                            kRealWorldESSL100Id),
     CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id),
+    CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT,
+                           kMacroHeavyESSL300FragSource,
+                           kMacroHeavyESSL300Id),
+    CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT,
+                           kRealWorldESSL100FragSource,
+                           kRealWorldESSL100Id,
+                           kWorkaroundCompileOptions,
+                           "_workarounds"),
+    CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT,
+                           kTrickyESSL300FragSource,
+                           kTrickyESSL300Id,
+                           kWorkaroundCompileOptions,
+                           "_workarounds"),
     CompilerPerfParameters(SH_ESSL_OUTPUT, kSimpleESSL100FragSource, kSimpleESSL100Id),
     CompilerPerfParameters(SH_ESSL_OUTPUT, kSimpleESSL300FragSource, kSimpleESSL300Id),
     CompilerPerfParameters(SH_ESSL_OUTPUT, kRealWorldESSL100FragSource, kRealWorldESSL100Id),
-    CompilerPerfParameters(SH_ESSL_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id));
+    CompilerPerfParameters(SH_ESSL_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id),
+    CompilerPerfParameters(SH_ESSL_OUTPUT, kMacroHeavyESSL300FragSource, kMacroHeavyESSL300Id));
+
+ANGLE_INSTANTIATE_TEST(
+    CompilerTranslationCachePerfTest,
+    CompilerTranslationCachePerfParameters(SH_HLSL_4_1_OUTPUT, TranslationCacheResult::Hit),
+    CompilerTranslationCachePerfParameters(SH_HLSL_4_1_OUTPUT, TranslationCacheResult::Miss),
+    CompilerTranslationCachePerfParameters(SH_GLSL_450_CORE_OUTPUT, TranslationCacheResult::Hit),
+    CompilerTranslationCachePerfParameters(SH_GLSL_450_CORE_OUTPUT, TranslationCacheResult::Miss),
+    CompilerTranslationCachePerfParameters(SH_ESSL_OUTPUT, TranslationCacheResult::Hit),
+    CompilerTranslationCachePerfParameters(SH_ESSL_OUTPUT, TranslationCacheResult::Miss));
+
+ANGLE_INSTANTIATE_TEST(CompilerThreadingPerfTest,
+                       CompilerThreadingPerfParameters(SH_ESSL_OUTPUT, 1, 0, ""),
+                       CompilerThreadingPerfParameters(SH_ESSL_OUTPUT, 2, 0, ""),
+                       CompilerThreadingPerfParameters(SH_ESSL_OUTPUT, 4, 0, ""),
+                       CompilerThreadingPerfParameters(SH_ESSL_OUTPUT, 8, 0, ""),
+                       CompilerThreadingPerfParameters(SH_ESSL_OUTPUT,
+                                                       8,
+                                                       SH_LARGE_POOL_PAGES,
+                                                       "_large_pages"),
+                       CompilerThreadingPerfParameters(SH_GLSL_450_CORE_OUTPUT, 1, 0, ""),
+                       CompilerThreadingPerfParameters(SH_GLSL_450_CORE_OUTPUT, 8, 0, ""));
 
 }  // anonymous namespace
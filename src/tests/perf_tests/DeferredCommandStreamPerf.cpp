@@ -0,0 +1,133 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// DeferredCommandStreamPerf:
+//   Performance test for recording and replaying calls with EGL_ANGLE_deferred_command_stream.
+//   Each step records a stream of uniform updates and draws, then waits for them to be replayed.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+
+#include "test_utils/draw_call_perf_utils.h"
+
+namespace
+{
+
+struct DeferredCommandStreamParams final : public RenderTestParams
+{
+    DeferredCommandStreamParams()
+    {
+        majorVersion  = 2;
+        minorVersion  = 0;
+        windowWidth   = 256;
+        windowHeight  = 256;
+        eglParameters = EGLPlatformParameters(EGL_PLATFORM_ANGLE_TYPE_NULL_ANGLE);
+    }
+
+    std::string suffix() const override;
+
+    bool deferred           = false;
+    unsigned int iterations = 1000;
+};
+
+std::string DeferredCommandStreamParams::suffix() const
+{
+    std::stringstream strstr;
+
+    strstr << RenderTestParams::suffix();
+
+    if (deferred)
+    {
+        strstr << "_deferred";
+    }
+
+    return strstr.str();
+}
+
+std::ostream &operator<<(std::ostream &os, const DeferredCommandStreamParams &params)
+{
+    os << params.suffix().substr(1);
+    return os;
+}
+
+class DeferredCommandStreamBenchmark
+    : public ANGLERenderTest,
+      public ::testing::WithParamInterface<DeferredCommandStreamParams>
+{
+  public:
+    DeferredCommandStreamBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    GLuint mProgram       = 0;
+    GLuint mBuffer        = 0;
+    GLint mOffsetLocation = -1;
+};
+
+DeferredCommandStreamBenchmark::DeferredCommandStreamBenchmark()
+    : ANGLERenderTest("DeferredCommandStream", GetParam())
+{
+    setDeferredCommandStreamEnabled(GetParam().deferred);
+}
+
+void DeferredCommandStreamBenchmark::initializeBenchmark()
+{
+    ASSERT_LT(0u, GetParam().iterations);
+
+    mProgram = SetupSimpleScaleAndOffsetProgram();
+    ASSERT_NE(0u, mProgram);
+
+    mOffsetLocation = glGetUniformLocation(mProgram, "uOffset");
+    ASSERT_NE(-1, mOffsetLocation);
+
+    mBuffer = Create2DTriangleBuffer(1, GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
+    glEnableVertexAttribArray(0);
+
+    glViewport(0, 0, getWindow()->getWidth(), getWindow()->getHeight());
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void DeferredCommandStreamBenchmark::destroyBenchmark()
+{
+    glDeleteProgram(mProgram);
+    glDeleteBuffers(1, &mBuffer);
+}
+
+void DeferredCommandStreamBenchmark::drawBenchmark()
+{
+    const auto &params = GetParam();
+
+    for (unsigned int it = 0; it < params.iterations; it++)
+    {
+        glUniform1f(mOffsetLocation, (it % 2) ? -0.5f : -0.25f);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+    }
+
+    // glGetError waits for the recorded calls to be replayed.
+    ASSERT_GL_NO_ERROR();
+}
+
+DeferredCommandStreamParams NullBackend(bool deferred)
+{
+    DeferredCommandStreamParams params;
+    params.deferred = deferred;
+    return params;
+}
+
+TEST_P(DeferredCommandStreamBenchmark, Run)
+{
+    run();
+}
+
+ANGLE_INSTANTIATE_TEST(DeferredCommandStreamBenchmark, NullBackend(false), NullBackend(true));
+
+}  // anonymous namespace
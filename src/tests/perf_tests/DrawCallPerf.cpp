@@ -193,6 +193,8 @@ ANGLE_INSTANTIATE_TEST(DrawCallPerfBenchmark,
                        DrawArrays(DrawCallPerfVulkanParams(true, false), true),
                        DrawArrays(DrawCallPerfVulkanParams(true, false), false),
                        DrawArrays(DrawCallPerfVulkanParams(false, false), false),
-                       DrawArrays(DrawCallPerfVulkanParams(false, false), true));
+                       DrawArrays(DrawCallPerfVulkanParams(false, false), true),
+                       DrawArrays(DrawCallPerfNullBackendParams(), false),
+                       DrawArrays(DrawCallPerfNullBackendParams(), true));
 
 } // namespace
@@ -78,3 +78,10 @@ DrawCallPerfParams DrawCallPerfVulkanParams(bool useNullDevice, bool renderToTex
     params.useFBO        = renderToTexture;
     return params;
 }
+
+DrawCallPerfParams DrawCallPerfNullBackendParams()
+{
+    DrawCallPerfParams params;
+    params.eglParameters = EGLPlatformParameters(EGL_PLATFORM_ANGLE_TYPE_NULL_ANGLE);
+    return params;
+}
@@ -40,4 +40,7 @@ DrawCallPerfParams DrawCallPerfOpenGLOrGLESParams(bool useNullDevice, bool rende
 DrawCallPerfParams DrawCallPerfValidationOnly();
 DrawCallPerfParams DrawCallPerfVulkanParams(bool useNullDevice, bool renderToTexture);
 
+// The null back-end does no work of its own, so these measure the front-end and validation.
+DrawCallPerfParams DrawCallPerfNullBackendParams();
+
 #endif  // TESTS_PERF_TESTS_DRAW_CALL_PERF_PARAMS_H_
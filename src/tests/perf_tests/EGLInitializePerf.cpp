@@ -57,6 +57,19 @@ void CapturePlatform_histogramCustomCounts(angle::PlatformMethods *platformMetho
     }
 }
 
+std::string GetSuffix(const angle::PlatformParameters &platform)
+{
+    // The D3D11 results keep their original name.
+    if (platform.eglParameters.renderer == EGL_PLATFORM_ANGLE_TYPE_D3D11_ANGLE)
+    {
+        return "_run";
+    }
+
+    RenderTestParams params;
+    params.eglParameters = platform.eglParameters;
+    return "_run" + params.suffix();
+}
+
 class EGLInitializePerfTest : public ANGLEPerfTest,
                               public WithParamInterface<angle::PlatformParameters>
 {
@@ -75,7 +88,7 @@ class EGLInitializePerfTest : public ANGLEPerfTest,
 };
 
 EGLInitializePerfTest::EGLInitializePerfTest()
-    : ANGLEPerfTest("EGLInitialize", "_run"),
+    : ANGLEPerfTest("EGLInitialize", GetSuffix(GetParam())),
       mOSWindow(nullptr),
       mDisplay(EGL_NO_DISPLAY)
 {
@@ -142,9 +155,12 @@ void EGLInitializePerfTest::step()
 void EGLInitializePerfTest::TearDown()
 {
     ANGLEPerfTest::TearDown();
-    printResult("LoadDLLs", normalizedTime(mCaptures.loadDLLsMS), "ms", true);
-    printResult("D3D11CreateDevice", normalizedTime(mCaptures.createDeviceMS), "ms", true);
-    printResult("InitResources", normalizedTime(mCaptures.initResourcesMS), "ms", true);
+    if (GetParam().eglParameters.renderer == EGL_PLATFORM_ANGLE_TYPE_D3D11_ANGLE)
+    {
+        printResult("LoadDLLs", normalizedTime(mCaptures.loadDLLsMS), "ms", true);
+        printResult("D3D11CreateDevice", normalizedTime(mCaptures.createDeviceMS), "ms", true);
+        printResult("InitResources", normalizedTime(mCaptures.initResourcesMS), "ms", true);
+    }
 
     ANGLEResetDisplayPlatform(mDisplay);
 }
@@ -154,6 +170,12 @@ TEST_P(EGLInitializePerfTest, Run)
     run();
 }
 
-ANGLE_INSTANTIATE_TEST(EGLInitializePerfTest, angle::ES2_D3D11());
+// Caps generation, which queries the info of every internal format, is part of every back-end's
+// initialization.
+ANGLE_INSTANTIATE_TEST(EGLInitializePerfTest,
+                       angle::ES2_D3D11(),
+                       angle::ES2_OPENGL(),
+                       angle::ES2_OPENGLES(),
+                       angle::ES2_VULKAN());
 
 } // namespace
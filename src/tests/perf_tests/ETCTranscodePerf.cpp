@@ -0,0 +1,147 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ETCTranscodePerf:
+//   Performance tests for loading ETC1, ETC2 and EAC images, decoded to pixels or transcoded to BC
+//   blocks, on one thread and split into bands of block rows on a worker pool.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+
+#include "image_util/loadimage.h"
+#include "libANGLE/WorkerThread.h"
+#include "libANGLE/renderer/renderer_utils.h"
+#include "random_utils.h"
+
+using namespace angle;
+
+namespace
+{
+
+struct ETCTranscodeParams
+{
+    std::string suffix() const
+    {
+        std::stringstream strstr;
+        strstr << "_" << name << (parallel ? "_parallel" : "_serial") << "_" << size;
+        return strstr.str();
+    }
+
+    const char *name;
+    rx::LoadImageFunction loadFunction;
+    size_t inputBlockBytes;
+    // Bytes of output for each input block, and the height of the output blocks.
+    size_t outputBlockBytes;
+    size_t outputBlockHeight;
+    bool parallel;
+    size_t size;
+};
+
+std::ostream &operator<<(std::ostream &stream, const ETCTranscodeParams &param)
+{
+    stream << param.suffix().substr(1);
+    return stream;
+}
+
+class ETCTranscodePerfTest : public ANGLEPerfTest,
+                             public ::testing::WithParamInterface<ETCTranscodeParams>
+{
+  public:
+    ETCTranscodePerfTest();
+
+    void SetUp() override;
+    void step() override;
+
+  private:
+    WorkerThreadPool mWorkerPool;
+    std::vector<uint8_t> mInput;
+    std::vector<uint8_t> mOutput;
+};
+
+ETCTranscodePerfTest::ETCTranscodePerfTest()
+    : ANGLEPerfTest("ETCTranscodePerf", GetParam().suffix()), mWorkerPool(4)
+{
+}
+
+void ETCTranscodePerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    const ETCTranscodeParams &params = GetParam();
+    size_t blockCount                = (params.size / 4) * (params.size / 4);
+
+    // Random bits are valid blocks of every mode.
+    RNG rng(1);
+    mInput.resize(blockCount * params.inputBlockBytes);
+    for (uint8_t &byte : mInput)
+    {
+        byte = static_cast<uint8_t>(rng.randomIntBetween(0, 255));
+    }
+    mOutput.resize(blockCount * params.outputBlockBytes);
+}
+
+void ETCTranscodePerfTest::step()
+{
+    const ETCTranscodeParams &params = GetParam();
+    size_t blocksWide                = params.size / 4;
+    size_t inputRowPitch             = blocksWide * params.inputBlockBytes;
+    size_t outputRowPitch = blocksWide * params.outputBlockBytes * params.outputBlockHeight / 4;
+    rx::ParallelLoadBlockImage(params.parallel ? &mWorkerPool : nullptr, params.loadFunction, 4,
+                               params.outputBlockHeight, params.size, params.size, 1,
+                               mInput.data(), inputRowPitch, mInput.size(), mOutput.data(),
+                               outputRowPitch, mOutput.size());
+}
+
+struct TranscodeFunctionInfo
+{
+    const char *name;
+    rx::LoadImageFunction loadFunction;
+    size_t inputBlockBytes;
+    size_t outputBlockBytes;
+    size_t outputBlockHeight;
+};
+
+std::vector<ETCTranscodeParams> AllETCTranscodeParams()
+{
+    // Decoders to pixels next to the transcoders of the same formats.
+    const TranscodeFunctionInfo kFunctions[] = {
+        {"ETC1RGB8ToRGBA8", LoadETC1RGB8ToRGBA8, 8, 64, 1},
+        {"ETC1RGB8ToBC1", LoadETC1RGB8ToBC1, 8, 8, 4},
+        {"ETC2RGB8ToRGBA8", LoadETC2RGB8ToRGBA8, 8, 64, 1},
+        {"ETC2RGB8ToBC1", LoadETC2RGB8ToBC1, 8, 8, 4},
+        {"ETC2RGB8A1ToRGBA8", LoadETC2RGB8A1ToRGBA8, 8, 64, 1},
+        {"ETC2RGB8A1ToBC1", LoadETC2RGB8A1ToBC1, 8, 8, 4},
+        {"ETC2RGBA8ToRGBA8", LoadETC2RGBA8ToRGBA8, 16, 64, 1},
+        {"ETC2RGBA8ToBC3", LoadETC2RGBA8ToBC3, 16, 16, 4},
+        {"EACR11ToR8", LoadEACR11ToR8, 8, 16, 1},
+        {"EACR11ToR16", LoadEACR11ToR16, 8, 32, 1},
+        {"EACR11ToBC4", LoadEACR11ToBC4, 8, 8, 4},
+        {"EACRG11ToRG16", LoadEACRG11ToRG16, 16, 64, 1},
+        {"EACRG11ToBC5", LoadEACRG11ToBC5, 16, 16, 4},
+    };
+
+    std::vector<ETCTranscodeParams> params;
+    for (const TranscodeFunctionInfo &function : kFunctions)
+    {
+        for (bool parallel : {false, true})
+        {
+            params.push_back({function.name, function.loadFunction, function.inputBlockBytes,
+                              function.outputBlockBytes, function.outputBlockHeight, parallel,
+                              2048});
+        }
+    }
+    return params;
+}
+
+TEST_P(ETCTranscodePerfTest, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_CASE_P(, ETCTranscodePerfTest, ::testing::ValuesIn(AllETCTranscodeParams()));
+
+}  // anonymous namespace
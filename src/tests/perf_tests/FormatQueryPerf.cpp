@@ -0,0 +1,113 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// FormatQueryPerf:
+//   Performance tests for looking up the info of internal formats, which validation and the
+//   back-ends do for most texture and renderbuffer calls.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include "libANGLE/formatutils.h"
+
+namespace
+{
+
+constexpr size_t kQueriesPerStep = 10000;
+
+struct FormatQueryParams
+{
+    std::string suffix() const { return sized ? "_sized" : "_unsized"; }
+
+    // Sized formats are looked up by internal format, unsized ones by internal format and type.
+    bool sized;
+};
+
+std::ostream &operator<<(std::ostream &stream, const FormatQueryParams &param)
+{
+    stream << param.suffix().substr(1);
+    return stream;
+}
+
+class FormatQueryPerfTest : public ANGLEPerfTest,
+                            public ::testing::WithParamInterface<FormatQueryParams>
+{
+  public:
+    FormatQueryPerfTest();
+
+    void SetUp() override;
+    void step() override;
+
+  private:
+    std::vector<gl::FormatType> mQueries;
+    GLuint mPixelBytes;
+};
+
+FormatQueryPerfTest::FormatQueryPerfTest()
+    : ANGLEPerfTest("FormatQueryPerf", GetParam().suffix()), mPixelBytes(0)
+{
+}
+
+void FormatQueryPerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    if (GetParam().sized)
+    {
+        for (GLenum internalFormat : gl::GetAllSizedInternalFormats())
+        {
+            mQueries.emplace_back(internalFormat, GL_NONE);
+        }
+    }
+    else
+    {
+        // The formats of glTexImage2D calls in ES2 applications.
+        mQueries = {
+            {GL_RGBA, GL_UNSIGNED_BYTE},
+            {GL_RGB, GL_UNSIGNED_BYTE},
+            {GL_RGBA, GL_UNSIGNED_SHORT_4_4_4_4},
+            {GL_RGB, GL_UNSIGNED_SHORT_5_6_5},
+            {GL_LUMINANCE, GL_UNSIGNED_BYTE},
+            {GL_ALPHA, GL_UNSIGNED_BYTE},
+            {GL_LUMINANCE_ALPHA, GL_UNSIGNED_BYTE},
+            {GL_RGBA, GL_HALF_FLOAT_OES},
+            {GL_DEPTH_COMPONENT, GL_UNSIGNED_SHORT},
+            {GL_BGRA_EXT, GL_UNSIGNED_BYTE},
+        };
+    }
+}
+
+void FormatQueryPerfTest::step()
+{
+    const bool sized = GetParam().sized;
+
+    GLuint pixelBytes = 0;
+    for (size_t query = 0; query < kQueriesPerStep; ++query)
+    {
+        const gl::FormatType &formatType = mQueries[query % mQueries.size()];
+        if (sized)
+        {
+            pixelBytes += gl::GetSizedInternalFormatInfo(formatType.format).pixelBytes;
+        }
+        else
+        {
+            pixelBytes += gl::GetInternalFormatInfo(formatType.format, formatType.type).pixelBytes;
+        }
+    }
+
+    // Keeps the lookups from being optimized out.
+    mPixelBytes += pixelBytes;
+}
+
+TEST_P(FormatQueryPerfTest, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_CASE_P(,
+                        FormatQueryPerfTest,
+                        ::testing::Values(FormatQueryParams{true}, FormatQueryParams{false}));
+
+}  // anonymous namespace
@@ -0,0 +1,224 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// GenerateMipPerf:
+//   Performance tests for generating full mip chains on the CPU, level by level on one thread,
+//   level by level on a worker pool, and with the fused chain, for 2D, array and 3D images.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+
+#include "image_util/generatemip.h"
+#include "libANGLE/WorkerThread.h"
+#include "libANGLE/renderer/renderer_utils.h"
+#include "random_utils.h"
+
+using namespace angle;
+
+namespace
+{
+
+enum class MipMode
+{
+    Serial,
+    Parallel,
+    Chain,
+};
+
+enum class ImageType
+{
+    Texture2D,
+    Array,
+    Texture3D,
+};
+
+struct GenerateMipParams
+{
+    std::string suffix() const
+    {
+        std::stringstream strstr;
+        strstr << "_" << name;
+        switch (type)
+        {
+            case ImageType::Texture2D:
+                strstr << "_2d";
+                break;
+            case ImageType::Array:
+                strstr << "_array";
+                break;
+            case ImageType::Texture3D:
+                strstr << "_3d";
+                break;
+        }
+        switch (mode)
+        {
+            case MipMode::Serial:
+                strstr << "_serial";
+                break;
+            case MipMode::Parallel:
+                strstr << "_parallel";
+                break;
+            case MipMode::Chain:
+                strstr << "_chain";
+                break;
+        }
+        strstr << "_" << size;
+        return strstr.str();
+    }
+
+    const char *name;
+    rx::MipGenerationFunction mipFunction;
+    size_t pixelBytes;
+    ImageType type;
+    MipMode mode;
+    size_t size;
+    // Layers of an array, or slices of a 3D image.
+    size_t depth;
+};
+
+std::ostream &operator<<(std::ostream &stream, const GenerateMipParams &param)
+{
+    stream << param.suffix().substr(1);
+    return stream;
+}
+
+class GenerateMipPerfTest : public ANGLEPerfTest,
+                            public ::testing::WithParamInterface<GenerateMipParams>
+{
+  public:
+    GenerateMipPerfTest();
+
+    void SetUp() override;
+    void step() override;
+
+  private:
+    size_t getLevelDepth(size_t level) const;
+
+    WorkerThreadPool mWorkerPool;
+    std::vector<std::vector<uint8_t>> mLevelData;
+    std::vector<rx::MipChainLevel> mLevels;
+};
+
+GenerateMipPerfTest::GenerateMipPerfTest()
+    : ANGLEPerfTest("GenerateMipPerf", GetParam().suffix()), mWorkerPool(4)
+{
+}
+
+size_t GenerateMipPerfTest::getLevelDepth(size_t level) const
+{
+    const GenerateMipParams &params = GetParam();
+    return params.type == ImageType::Texture3D ? std::max<size_t>(1, params.depth >> level)
+                                               : params.depth;
+}
+
+void GenerateMipPerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    const GenerateMipParams &params = GetParam();
+
+    // Random floats are mostly in the normal range, like real image data.
+    RNG rng(1);
+    for (size_t level = 0; (params.size >> level) > 0; level++)
+    {
+        size_t size       = params.size >> level;
+        size_t rowPitch   = size * params.pixelBytes;
+        size_t depthPitch = rowPitch * size;
+        mLevelData.emplace_back(depthPitch * getLevelDepth(level));
+        mLevels.push_back({nullptr, rowPitch, depthPitch});
+    }
+    for (size_t level = 0; level < mLevels.size(); level++)
+    {
+        mLevels[level].data = mLevelData[level].data();
+    }
+
+    std::vector<uint8_t> &base = mLevelData[0];
+    for (size_t index = 0; index + sizeof(float) <= base.size(); index += sizeof(float))
+    {
+        float value = rng.randomNegativeOneToOne();
+        memcpy(&base[index], &value, sizeof(float));
+    }
+}
+
+void GenerateMipPerfTest::step()
+{
+    const GenerateMipParams &params = GetParam();
+
+    if (params.mode == MipMode::Chain)
+    {
+        rx::GenerateMipChain(&mWorkerPool, params.mipFunction, params.size, params.size,
+                             params.depth, mLevels.data(), mLevels.size());
+        return;
+    }
+
+    WorkerThreadPool *workerPool = params.mode == MipMode::Parallel ? &mWorkerPool : nullptr;
+    for (size_t level = 1; level < mLevels.size(); level++)
+    {
+        const rx::MipChainLevel &source = mLevels[level - 1];
+        const rx::MipChainLevel &dest   = mLevels[level];
+        size_t size                     = params.size >> (level - 1);
+        if (params.type == ImageType::Texture3D)
+        {
+            rx::ParallelGenerateMip(workerPool, params.mipFunction, size, size,
+                                    getLevelDepth(level - 1), source.data, source.rowPitch,
+                                    source.depthPitch, dest.data, dest.rowPitch, dest.depthPitch);
+            continue;
+        }
+
+        for (size_t layer = 0; layer < params.depth; layer++)
+        {
+            rx::ParallelGenerateMip(workerPool, params.mipFunction, size, size, 1,
+                                    source.data + layer * source.depthPitch, source.rowPitch,
+                                    source.depthPitch, dest.data + layer * dest.depthPitch,
+                                    dest.rowPitch, dest.depthPitch);
+        }
+    }
+}
+
+struct MipFunctionInfo
+{
+    const char *name;
+    rx::MipGenerationFunction mipFunction;
+    size_t pixelBytes;
+};
+
+std::vector<GenerateMipParams> AllGenerateMipParams()
+{
+    const MipFunctionInfo kFunctions[] = {
+        {"RGBA8", GenerateMip<R8G8B8A8>, 4},
+        {"RGBA16F", GenerateMip<R16G16B16A16F>, 8},
+        {"RGBA32F", GenerateMip<R32G32B32A32F>, 16},
+    };
+
+    std::vector<GenerateMipParams> params;
+    for (const MipFunctionInfo &function : kFunctions)
+    {
+        for (MipMode mode : {MipMode::Serial, MipMode::Parallel, MipMode::Chain})
+        {
+            params.push_back({function.name, function.mipFunction, function.pixelBytes,
+                              ImageType::Texture2D, mode, 2048, 1});
+            params.push_back({function.name, function.mipFunction, function.pixelBytes,
+                              ImageType::Array, mode, 512, 16});
+            if (mode != MipMode::Chain)
+            {
+                // The chain only fuses 2D levels.
+                params.push_back({function.name, function.mipFunction, function.pixelBytes,
+                                  ImageType::Texture3D, mode, 256, 256});
+            }
+        }
+    }
+    return params;
+}
+
+TEST_P(GenerateMipPerfTest, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_CASE_P(, GenerateMipPerfTest, ::testing::ValuesIn(AllGenerateMipParams()));
+
+}  // anonymous namespace
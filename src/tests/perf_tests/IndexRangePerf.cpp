@@ -0,0 +1,140 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// IndexRangePerf:
+//   Performance tests for finding the range of client index data, alone and fused with the
+//   conversion to a wider index type done when streaming indices.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+
+#include "common/utilities.h"
+#include "libANGLE/formatutils.h"
+#include "random_utils.h"
+
+namespace
+{
+
+struct IndexRangeParams
+{
+    std::string suffix() const
+    {
+        std::stringstream strstr;
+        strstr << "_" << gl::GetTypeInfo(indexType).bytes * 8;
+        if (destinationType != GL_NONE)
+        {
+            strstr << "_to_" << gl::GetTypeInfo(destinationType).bytes * 8;
+        }
+        if (primitiveRestartEnabled)
+        {
+            strstr << "_restart";
+        }
+        strstr << "_" << count;
+        return strstr.str();
+    }
+
+    GLenum indexType;
+    // GL_NONE to only compute the range.
+    GLenum destinationType;
+    bool primitiveRestartEnabled;
+    size_t count;
+};
+
+std::ostream &operator<<(std::ostream &stream, const IndexRangeParams &param)
+{
+    stream << param.suffix().substr(1);
+    return stream;
+}
+
+class IndexRangePerfTest : public ANGLEPerfTest,
+                           public ::testing::WithParamInterface<IndexRangeParams>
+{
+  public:
+    IndexRangePerfTest();
+
+    void SetUp() override;
+    void step() override;
+
+  private:
+    std::vector<uint8_t> mIndices;
+    std::vector<uint8_t> mOutput;
+};
+
+IndexRangePerfTest::IndexRangePerfTest() : ANGLEPerfTest("IndexRangePerf", GetParam().suffix())
+{
+}
+
+void IndexRangePerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    const IndexRangeParams &params = GetParam();
+    const gl::Type &typeInfo       = gl::GetTypeInfo(params.indexType);
+
+    // Small meshes with a primitive restart index every few strips.
+    angle::RNG rng(1);
+    mIndices.resize(params.count * typeInfo.bytes);
+    for (size_t index = 0; index < params.count; index++)
+    {
+        uint32_t value =
+            (index % 64 == 63) ? 0xFFFFFFFFu : static_cast<uint32_t>(rng.randomIntBetween(0, 200));
+        memcpy(&mIndices[index * typeInfo.bytes], &value, typeInfo.bytes);
+    }
+
+    if (params.destinationType != GL_NONE)
+    {
+        mOutput.resize(params.count * gl::GetTypeInfo(params.destinationType).bytes);
+    }
+}
+
+void IndexRangePerfTest::step()
+{
+    const IndexRangeParams &params = GetParam();
+
+    if (params.destinationType == GL_NONE)
+    {
+        gl::ComputeIndexRange(params.indexType, mIndices.data(), params.count,
+                              params.primitiveRestartEnabled);
+    }
+    else
+    {
+        gl::ComputeIndexRangeAndConvert(params.indexType, mIndices.data(), params.count,
+                                        params.primitiveRestartEnabled, params.destinationType,
+                                        mOutput.data());
+    }
+}
+
+std::vector<IndexRangeParams> AllIndexRangeParams()
+{
+    const std::pair<GLenum, GLenum> kTypes[] = {
+        {GL_UNSIGNED_BYTE, GL_NONE},          {GL_UNSIGNED_SHORT, GL_NONE},
+        {GL_UNSIGNED_INT, GL_NONE},           {GL_UNSIGNED_BYTE, GL_UNSIGNED_SHORT},
+        {GL_UNSIGNED_SHORT, GL_UNSIGNED_INT},
+    };
+
+    std::vector<IndexRangeParams> params;
+    for (const auto &types : kTypes)
+    {
+        for (bool primitiveRestartEnabled : {false, true})
+        {
+            for (size_t count : {3000, 1000000})
+            {
+                params.push_back({types.first, types.second, primitiveRestartEnabled, count});
+            }
+        }
+    }
+    return params;
+}
+
+TEST_P(IndexRangePerfTest, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_CASE_P(, IndexRangePerfTest, ::testing::ValuesIn(AllIndexRangeParams()));
+
+}  // anonymous namespace
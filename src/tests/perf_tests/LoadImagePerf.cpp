@@ -0,0 +1,143 @@
+//
+// Copyright 2018 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// LoadImagePerf:
+//   Performance tests for the image loading functions used by texture uploads, for a range of
+//   format conversions and image sizes.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+
+#include "image_util/loadimage.h"
+#include "random_utils.h"
+
+using namespace angle;
+
+namespace
+{
+
+using LoadFunction = void (*)(size_t,
+                              size_t,
+                              size_t,
+                              const uint8_t *,
+                              size_t,
+                              size_t,
+                              uint8_t *,
+                              size_t,
+                              size_t);
+
+struct LoadImageParams
+{
+    std::string suffix() const
+    {
+        std::stringstream strstr;
+        strstr << "_" << name << "_" << size;
+        return strstr.str();
+    }
+
+    const char *name;
+    LoadFunction loadFunction;
+    size_t inputPixelBytes;
+    size_t outputPixelBytes;
+    size_t size;
+};
+
+std::ostream &operator<<(std::ostream &stream, const LoadImageParams &param)
+{
+    stream << param.suffix().substr(1);
+    return stream;
+}
+
+class LoadImagePerfTest : public ANGLEPerfTest,
+                          public ::testing::WithParamInterface<LoadImageParams>
+{
+  public:
+    LoadImagePerfTest();
+
+    void SetUp() override;
+    void step() override;
+
+  private:
+    std::vector<uint8_t> mInput;
+    std::vector<uint8_t> mOutput;
+};
+
+LoadImagePerfTest::LoadImagePerfTest() : ANGLEPerfTest("LoadImagePerf", GetParam().suffix())
+{
+}
+
+void LoadImagePerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    const LoadImageParams &params = GetParam();
+    size_t pixelCount             = params.size * params.size;
+
+    // Random floats are mostly in the normal range, like real image data.
+    RNG rng(1);
+    mInput.resize(pixelCount * params.inputPixelBytes);
+    for (size_t index = 0; index + sizeof(float) <= mInput.size(); index += sizeof(float))
+    {
+        float value = rng.randomNegativeOneToOne();
+        memcpy(&mInput[index], &value, sizeof(float));
+    }
+    mOutput.resize(pixelCount * params.outputPixelBytes);
+}
+
+void LoadImagePerfTest::step()
+{
+    const LoadImageParams &params = GetParam();
+    params.loadFunction(params.size, params.size, 1, mInput.data(),
+                        params.size * params.inputPixelBytes, mInput.size(), mOutput.data(),
+                        params.size * params.outputPixelBytes, mOutput.size());
+}
+
+struct LoadFunctionInfo
+{
+    const char *name;
+    LoadFunction loadFunction;
+    size_t inputPixelBytes;
+    size_t outputPixelBytes;
+};
+
+std::vector<LoadImageParams> AllLoadImageParams()
+{
+    const LoadFunctionInfo kFunctions[] = {
+        {"A8ToRGBA8", LoadA8ToRGBA8, 1, 4},
+        {"L8ToRGBA8", LoadL8ToRGBA8, 1, 4},
+        {"LA8ToRGBA8", LoadLA8ToRGBA8, 2, 4},
+        {"RGBA8ToBGRA8", LoadRGBA8ToBGRA8, 4, 4},
+        {"RGB8ToBGRX8", LoadRGB8ToBGRX8, 3, 4},
+        {"RGB8ToRGBA8", LoadToNative3To4<uint8_t, 0xFF>, 3, 4},
+        {"RGB16FToRGBA16F", LoadToNative3To4<uint16_t, gl::Float16One>, 6, 8},
+        {"RGB32FToRGBA32F", LoadToNative3To4<float, gl::Float32One>, 12, 16},
+        {"RGB8ToBGR565", LoadRGB8ToBGR565, 3, 2},
+        {"RGBA8ToBGRA4", LoadRGBA8ToBGRA4, 4, 2},
+        {"RGBA8ToBGR5A1", LoadRGBA8ToBGR5A1, 4, 2},
+        {"RGBA32FToRGBA16F", Load32FTo16F<4>, 16, 8},
+    };
+
+    std::vector<LoadImageParams> params;
+    for (const LoadFunctionInfo &function : kFunctions)
+    {
+        for (size_t size : {256, 1024, 2048})
+        {
+            params.push_back({function.name, function.loadFunction, function.inputPixelBytes,
+                              function.outputPixelBytes, size});
+        }
+    }
+    return params;
+}
+
+TEST_P(LoadImagePerfTest, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_CASE_P(, LoadImagePerfTest, ::testing::ValuesIn(AllLoadImageParams()));
+
+}  // anonymous namespace
@@ -32,6 +32,8 @@ struct TexSubImageParams final : public RenderTestParams
         subImageWidth  = 64;
         subImageHeight = 64;
         iterations     = 9;
+        internalFormat = GL_RGBA8_OES;
+        format         = GL_RGBA;
     }
 
     std::string suffix() const override;
@@ -42,6 +44,10 @@ struct TexSubImageParams final : public RenderTestParams
     int subImageWidth;
     int subImageHeight;
     unsigned int iterations;
+
+    // RGB data is converted to RGBA by most back-ends.
+    GLenum internalFormat;
+    GLenum format;
 };
 
 std::ostream &operator<<(std::ostream &os, const TexSubImageParams &params)
@@ -85,8 +91,20 @@ class TexSubImageBenchmark : public ANGLERenderTest,
 
 std::string TexSubImageParams::suffix() const
 {
-    // TODO(jmadill)
-    return RenderTestParams::suffix();
+    std::stringstream strstr;
+    strstr << RenderTestParams::suffix();
+
+    if (subImageWidth == imageWidth && subImageHeight == imageHeight)
+    {
+        strstr << "_full_" << imageWidth << "x" << imageHeight;
+    }
+
+    if (format == GL_RGB)
+    {
+        strstr << "_rgb";
+    }
+
+    return strstr.str();
 }
 
 TexSubImageBenchmark::TexSubImageBenchmark()
@@ -118,7 +136,8 @@ GLuint TexSubImageBenchmark::createTexture()
     // Bind the texture object
     glBindTexture(GL_TEXTURE_2D, texture);
 
-    glTexStorage2DEXT(GL_TEXTURE_2D, 1, GL_RGBA8, params.imageWidth, params.imageHeight);
+    glTexStorage2DEXT(GL_TEXTURE_2D, 1, params.internalFormat, params.imageWidth,
+                      params.imageHeight);
 
     // Set the filtering mode
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
@@ -186,18 +205,22 @@ void TexSubImageBenchmark::initializeBenchmark()
 
     glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
 
-    mPixels = new GLubyte[params.subImageWidth * params.subImageHeight * 4];
+    int pixelBytes = (params.format == GL_RGB) ? 3 : 4;
+    mPixels        = new GLubyte[params.subImageWidth * params.subImageHeight * pixelBytes];
 
     // Fill the pixels structure with random data:
     for (int y = 0; y < params.subImageHeight; ++y)
     {
         for (int x = 0; x < params.subImageWidth; ++x)
         {
-            int offset          = (x + (y * params.subImageWidth)) * 4;
+            int offset          = (x + (y * params.subImageWidth)) * pixelBytes;
             mPixels[offset + 0] = rand() % 255;  // Red
             mPixels[offset + 1] = rand() % 255;  // Green
             mPixels[offset + 2] = rand() % 255;  // Blue
-            mPixels[offset + 3] = 255;           // Alpha
+            if (pixelBytes == 4)
+            {
+                mPixels[offset + 3] = 255;  // Alpha
+            }
         }
     }
 
@@ -248,11 +271,15 @@ void TexSubImageBenchmark::drawBenchmark()
 
     const auto &params = GetParam();
 
+    // Full image updates always start at the origin.
+    int maxOffsetX = params.imageWidth - params.subImageWidth + 1;
+    int maxOffsetY = params.imageHeight - params.subImageHeight + 1;
+
     for (unsigned int iteration = 0; iteration < params.iterations; ++iteration)
     {
-        glTexSubImage2D(GL_TEXTURE_2D, 0, rand() % (params.imageWidth - params.subImageWidth),
-                        rand() % (params.imageHeight - params.subImageHeight), params.subImageWidth,
-                        params.subImageHeight, GL_RGBA, GL_UNSIGNED_BYTE, mPixels);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, rand() % maxOffsetX, rand() % maxOffsetY,
+                        params.subImageWidth, params.subImageHeight, params.format,
+                        GL_UNSIGNED_BYTE, mPixels);
 
         glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, 0);
     }
@@ -281,6 +308,23 @@ TexSubImageParams OpenGLOrGLESParams()
     return params;
 }
 
+// Uploads whole large images, which is where converting the data on several threads pays off.
+TexSubImageParams FullImageParams(const EGLPlatformParameters &eglParameters,
+                                  int size,
+                                  GLenum format)
+{
+    TexSubImageParams params;
+    params.eglParameters  = eglParameters;
+    params.imageWidth     = size;
+    params.imageHeight    = size;
+    params.subImageWidth  = size;
+    params.subImageHeight = size;
+    params.iterations     = 1;
+    params.internalFormat = (format == GL_RGB) ? GL_RGB8_OES : GL_RGBA8_OES;
+    params.format         = format;
+    return params;
+}
+
 }  // namespace
 
 TEST_P(TexSubImageBenchmark, Run)
@@ -288,4 +332,13 @@ TEST_P(TexSubImageBenchmark, Run)
     run();
 }
 
-ANGLE_INSTANTIATE_TEST(TexSubImageBenchmark, D3D11Params(), D3D9Params(), OpenGLOrGLESParams());
+ANGLE_INSTANTIATE_TEST(TexSubImageBenchmark,
+                       D3D11Params(),
+                       D3D9Params(),
+                       OpenGLOrGLESParams(),
+                       FullImageParams(egl_platform::D3D11(), 2048, GL_RGB),
+                       FullImageParams(egl_platform::D3D11(), 4096, GL_RGB),
+                       FullImageParams(egl_platform::D3D11(), 4096, GL_RGBA),
+                       FullImageParams(egl_platform::VULKAN(), 2048, GL_RGB),
+                       FullImageParams(egl_platform::VULKAN(), 4096, GL_RGB),
+                       FullImageParams(egl_platform::VULKAN(), 4096, GL_RGBA));
@@ -5,6 +5,7 @@
 //
 // VulkanPipelineCachePerf:
 //   Performance benchmark for the Vulkan Pipeline cache.
+//   VulkanPipelineCacheLookupPerf only measures lookups of cached pipelines.
 
 #include "ANGLEPerfTest.h"
 
@@ -15,6 +16,19 @@ using namespace rx;
 
 namespace
 {
+void RandomizeDesc(angle::RNG *rng, vk::PipelineDesc *desc)
+{
+    desc->initDefaults();
+
+    gl::Rectangle viewport(rng->randomIntBetween(0, 64), rng->randomIntBetween(0, 64),
+                           rng->randomIntBetween(1, 4096), rng->randomIntBetween(1, 4096));
+    desc->updateViewport(viewport, rng->randomFloat(), rng->randomFloat());
+    desc->updateScissor(viewport);
+    desc->updateLineWidth(rng->randomFloatBetween(1.0f, 8.0f));
+    desc->updateBlendColor(gl::ColorF(rng->randomFloat(), rng->randomFloat(),
+                                      rng->randomFloat(), rng->randomFloat()));
+}
+
 class VulkanPipelineCachePerfTest : public ANGLEPerfTest
 {
   public:
@@ -30,9 +44,6 @@ class VulkanPipelineCachePerfTest : public ANGLEPerfTest
     std::vector<vk::PipelineDesc> mCacheHits;
     std::vector<vk::PipelineDesc> mCacheMisses;
     size_t mMissIndex = 0;
-
-  private:
-    void randomizeDesc(vk::PipelineDesc *desc);
 };
 
 VulkanPipelineCachePerfTest::VulkanPipelineCachePerfTest()
@@ -52,7 +63,7 @@ void VulkanPipelineCachePerfTest::SetUp()
     {
         vk::Pipeline pipeline;
         vk::PipelineDesc desc;
-        randomizeDesc(&desc);
+        RandomizeDesc(&mRNG, &desc);
 
         if (pipelineCount < 10)
         {
@@ -64,20 +75,14 @@ void VulkanPipelineCachePerfTest::SetUp()
     for (int missCount = 0; missCount < 10000; ++missCount)
     {
         vk::PipelineDesc desc;
-        randomizeDesc(&desc);
+        RandomizeDesc(&mRNG, &desc);
         mCacheMisses.push_back(desc);
     }
 }
 
-void VulkanPipelineCachePerfTest::randomizeDesc(vk::PipelineDesc *desc)
-{
-    std::vector<uint8_t> bytes(sizeof(vk::PipelineDesc));
-    FillVectorWithRandomUBytes(&mRNG, &bytes);
-    memcpy(desc, bytes.data(), sizeof(vk::PipelineDesc));
-}
-
 void VulkanPipelineCachePerfTest::step()
 {
+    vk::PipelineCache pc;
     vk::RenderPass rp;
     vk::PipelineLayout pl;
     vk::ShaderModule sm;
@@ -88,7 +93,7 @@ void VulkanPipelineCachePerfTest::step()
     {
         for (const auto &hit : mCacheHits)
         {
-            (void)mCache.getPipeline(VK_NULL_HANDLE, rp, pl, am, sm, sm, hit, &result);
+            (void)mCache.getPipeline(VK_NULL_HANDLE, pc, rp, pl, am, sm, sm, hit, &result);
         }
     }
 
@@ -96,7 +101,69 @@ void VulkanPipelineCachePerfTest::step()
          ++missCount, ++mMissIndex)
     {
         const auto &miss = mCacheMisses[mMissIndex];
-        (void)mCache.getPipeline(VK_NULL_HANDLE, rp, pl, am, sm, sm, miss, &result);
+        (void)mCache.getPipeline(VK_NULL_HANDLE, pc, rp, pl, am, sm, sm, miss, &result);
+    }
+}
+
+constexpr size_t kLookupDescCount = 4096;
+constexpr size_t kLookupsPerStep  = 1 << 20;
+
+class VulkanPipelineCacheLookupPerfTest : public ANGLEPerfTest
+{
+  public:
+    VulkanPipelineCacheLookupPerfTest();
+    ~VulkanPipelineCacheLookupPerfTest();
+
+    void SetUp() override;
+    void step() override;
+
+    PipelineCache mCache;
+    angle::RNG mRNG;
+
+    std::vector<vk::PipelineDesc> mDescs;
+    std::vector<uint16_t> mLookupOrder;
+};
+
+VulkanPipelineCacheLookupPerfTest::VulkanPipelineCacheLookupPerfTest()
+    : ANGLEPerfTest("VulkanPipelineCacheLookupPerf", "")
+{
+}
+
+VulkanPipelineCacheLookupPerfTest::~VulkanPipelineCacheLookupPerfTest()
+{
+    mCache.destroy(VK_NULL_HANDLE);
+}
+
+void VulkanPipelineCacheLookupPerfTest::SetUp()
+{
+    mDescs.resize(kLookupDescCount);
+    for (vk::PipelineDesc &desc : mDescs)
+    {
+        RandomizeDesc(&mRNG, &desc);
+        mCache.populate(desc, vk::Pipeline());
+    }
+
+    // Visit the descriptions in a random order so the lookups don't hit the same cache lines.
+    mLookupOrder.resize(kLookupsPerStep);
+    for (uint16_t &index : mLookupOrder)
+    {
+        index = static_cast<uint16_t>(mRNG.randomIntBetween(0, static_cast<int>(kLookupDescCount) - 1));
+    }
+}
+
+void VulkanPipelineCacheLookupPerfTest::step()
+{
+    vk::PipelineCache pc;
+    vk::RenderPass rp;
+    vk::PipelineLayout pl;
+    vk::ShaderModule sm;
+    vk::PipelineAndSerial *result = nullptr;
+    gl::AttributesMask am;
+
+    for (uint16_t index : mLookupOrder)
+    {
+        (void)mCache.getPipeline(VK_NULL_HANDLE, pc, rp, pl, am, sm, sm, mDescs[index],
+                                 &result);
     }
 }
 
@@ -106,3 +173,8 @@ TEST_F(VulkanPipelineCachePerfTest, Run)
 {
     run();
 }
+
+TEST_F(VulkanPipelineCacheLookupPerfTest, Run)
+{
+    run();
+}
@@ -1033,4 +1033,77 @@ TEST_F(DefineTest, LongMacroInvocationChain)
     preprocess(inputStream.str().c_str(), settings);
 }
 
+// Defines, undefines and redefines enough macros to grow the macro set several times, and checks
+// that every macro still expands to its latest definition.
+TEST_F(DefineTest, ManyMacrosDefinedAndUndefined)
+{
+    constexpr int kMacroCount = 500;
+
+    std::stringstream inputStream;
+    std::stringstream expectedStream;
+
+    for (int i = 0; i < kMacroCount; ++i)
+    {
+        inputStream << "#define M" << i << " " << i << "\n";
+        expectedStream << "\n";
+    }
+    for (int i = 0; i < kMacroCount; i += 2)
+    {
+        inputStream << "#undef M" << i << "\n";
+        expectedStream << "\n";
+    }
+    for (int i = 0; i < kMacroCount; i += 4)
+    {
+        inputStream << "#define M" << i << " x" << i << "\n";
+        expectedStream << "\n";
+    }
+    for (int i = 0; i < kMacroCount; ++i)
+    {
+        inputStream << "M" << i << "\n";
+        if (i % 4 == 0)
+        {
+            expectedStream << "x" << i << "\n";
+        }
+        else if (i % 2 == 0)
+        {
+            expectedStream << "M" << i << "\n";
+        }
+        else
+        {
+            expectedStream << i << "\n";
+        }
+    }
+
+    preprocess(inputStream.str().c_str(), expectedStream.str().c_str());
+}
+
+// Expands nested function-like macros many times, so that the expansion contexts are reused with
+// arguments of different lengths.
+TEST_F(DefineTest, RepeatedNestedFuncMacroExpansion)
+{
+    std::stringstream inputStream;
+    std::stringstream expectedStream;
+
+    inputStream << "#define ADD(a, b) (a + b)\n"
+                   "#define MUL(a, b) (a * b)\n"
+                   "#define MAD(a, b, c) ADD(MUL(a, b), c)\n"
+                   "#define SCALE 2.0\n";
+    expectedStream << "\n\n\n\n";
+    for (int i = 0; i < 200; ++i)
+    {
+        if (i % 2 == 0)
+        {
+            inputStream << "MAD(x" << i << ", SCALE, y)\n";
+            expectedStream << "((x" << i << " * 2.0) + y)\n";
+        }
+        else
+        {
+            inputStream << "MAD(ADD(x" << i << ", 1.0), v.w, MUL(z, SCALE))\n";
+            expectedStream << "(((x" << i << " + 1.0) * v.w) + (z * 2.0))\n";
+        }
+    }
+
+    preprocess(inputStream.str().c_str(), expectedStream.str().c_str());
+}
+
 }  // namespace angle
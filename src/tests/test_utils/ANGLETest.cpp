@@ -897,6 +897,14 @@ void ANGLETestBase::setContextProgramCacheEnabled(bool enabled)
     mEGLWindow->setContextProgramCacheEnabled(enabled);
 }
 
+void ANGLETestBase::setDeferredCommandStreamEnabled(bool enabled)
+{
+    mEGLWindow->setDeferredCommandStreamEnabled(enabled);
+
+    // Deferred contexts can't use client arrays.
+    mEGLWindow->setClientArraysEnabled(!enabled);
+}
+
 void ANGLETestBase::setDeferContextInit(bool enabled)
 {
     mDeferContextInit = enabled;
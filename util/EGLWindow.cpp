@@ -127,6 +127,7 @@ EGLWindow::EGLWindow(EGLint glesMajorVersion,
       mSamples(-1),
       mDebugLayersEnabled(),
       mContextProgramCacheEnabled(),
+      mDeferredCommandStream(false),
       mPlatformMethods(nullptr)
 {
 }
@@ -354,6 +355,13 @@ EGLContext EGLWindow::createContext(EGLContext share) const
         return EGL_NO_CONTEXT;
     }
 
+    bool hasDeferredCommandStream =
+        strstr(displayExtensions, "EGL_ANGLE_deferred_command_stream") != nullptr;
+    if (mDeferredCommandStream && !hasDeferredCommandStream)
+    {
+        return EGL_NO_CONTEXT;
+    }
+
     eglBindAPI(EGL_OPENGL_ES_API);
     if (eglGetError() != EGL_SUCCESS)
     {
@@ -422,6 +430,12 @@ EGLContext EGLWindow::createContext(EGLContext share) const
             contextAttributes.push_back(EGL_ROBUST_RESOURCE_INITIALIZATION_ANGLE);
             contextAttributes.push_back(mRobustResourceInit.value() ? EGL_TRUE : EGL_FALSE);
         }
+
+        if (mDeferredCommandStream)
+        {
+            contextAttributes.push_back(EGL_CONTEXT_DEFERRED_COMMAND_STREAM_ANGLE);
+            contextAttributes.push_back(EGL_TRUE);
+        }
     }
     contextAttributes.push_back(EGL_NONE);
 
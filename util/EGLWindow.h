@@ -89,6 +89,7 @@ class ANGLE_EXPORT EGLWindow : angle::NonCopyable
         mPlatformMethods = platformMethods;
     }
     void setContextProgramCacheEnabled(bool enabled) { mContextProgramCacheEnabled = enabled; }
+    void setDeferredCommandStreamEnabled(bool enabled) { mDeferredCommandStream = enabled; }
 
     static EGLBoolean FindEGLConfig(EGLDisplay dpy, const EGLint *attrib_list, EGLConfig *config);
 
@@ -162,6 +163,7 @@ class ANGLE_EXPORT EGLWindow : angle::NonCopyable
     EGLint mSamples;
     Optional<bool> mDebugLayersEnabled;
     Optional<bool> mContextProgramCacheEnabled;
+    bool mDeferredCommandStream;
     angle::PlatformMethods *mPlatformMethods;
 };
 